@@ -72,6 +72,7 @@ bool Castle::OnInitialize()
 
    mCuller.SetCamera(mCamera);
    mCuller.ComputeVisibleSet(mScene);
+   mRayCaster.Build(mScene);
 
    InitializeCameraMotion(0.5f, 0.001f);
    InitializeObjectMotion(mScene);
@@ -94,8 +95,6 @@ void Castle::OnTerminate()
       mSpanTracker = NULL;
    }
 
-   mPicker.Records.clear();
-
    mScene      = 0;
    mTrnNode    = 0;
    mWireState  = 0;
@@ -237,14 +236,21 @@ void Castle::OnIdle()
 {
    MeasureTime();
 
-   if (MoveCamera())
+   // Marker changes from this frame's input are applied in one pass, and
+   // the visible set is computed at most once.
+   bool visible = MoveCamera();
+   if (mSpanTracker->UpdateMarkers())
    {
-      mCuller.ComputeVisibleSet(mScene);
+      visible = true;
    }
-
    if (MoveObject())
    {
       mScene->Update();
+      mSpanTracker->InvalidatePicks();
+      visible = true;
+   }
+   if (visible)
+   {
       mCuller.ComputeVisibleSet(mScene);
    }
 
@@ -356,13 +362,11 @@ bool Castle::OnMouseClick(int button, int state, int x, int y, unsigned int)
    AVector dir;
    if (mRenderer->GetPickRay(x, GetHeight() - 1 - y, pos, dir))
    {
-      mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-      if (mPicker.Records.size() > 0)
+      RayCaster::Hit hit;
+      if (mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
       {
          // Display the selected object's name.
-         const PickRecord& record  = mPicker.GetClosestNonnegative();
-         const Spatial     *object = record.Intersected;
-         sprintf(mPickMessage, "%s", object->GetName().c_str());
+         sprintf(mPickMessage, "%s", hit.Mesh->GetName().c_str());
       }
       else
       {
@@ -381,15 +385,10 @@ void Castle::AdjustVerticalDistance()
    APoint  pos = mCamera->GetPosition();
    AVector dir = -AVector::UNIT_Z;
 
-   mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-   if (mPicker.Records.size() > 0)
+   RayCaster::Hit hit;
+   if (mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
    {
-      const PickRecord& record = mPicker.GetClosestNonnegative();
-      TriMesh           *mesh  = DynamicCast<TriMesh>(record.Intersected);
-      APoint            tri[3];
-      mesh->GetWorldTriangle(record.Triangle, tri);
-      APoint closest = record.Bary[0] * tri[0] + record.Bary[1] * tri[1] +
-                       record.Bary[2] * tri[2];
+      APoint closest = pos + hit.T * dir;
 
       closest[2] += mVerticalDistance;
 	  float z = mCamera->GetPosition().Z();
@@ -410,14 +409,10 @@ bool Castle::AllowMotion(float sign)
    for (int i = 0; i < mNumRays; ++i)
    {
       AVector dir = mCos[i] * mWorldAxis[2] + sign * mSin[i] * mWorldAxis[0];
-      mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-      if (mPicker.Records.size() > 0)
+      RayCaster::Hit hit;
+      if (mRayCaster.RayCast(pos, dir, mTolerance[i], hit))
       {
-         const PickRecord& record = mPicker.GetClosestNonnegative();
-         if (record.T <= mTolerance[i])
-         {
-            return(false);
-         }
+         return(false);
       }
    }
 
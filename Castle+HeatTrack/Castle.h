@@ -6,6 +6,7 @@
 #include "Wm5WindowApplication3.h"
 #include "DLitMatTexEffect.h"
 #include "SpanTracker.h"
+#include "RayCaster.h"
 using namespace Wm5;
 
 class Castle : public WindowApplication3
@@ -188,8 +189,8 @@ private:
    // information.
    bool AllowMotion(float sign);
 
-   char   mPickMessage[1024];
-   Picker mPicker;
+   char      mPickMessage[1024];
+   RayCaster mRayCaster;
    int    mNumRays;
    float  mHalfAngle;
    float  *mCos;
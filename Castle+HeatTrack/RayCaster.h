@@ -0,0 +1,50 @@
+// Scene ray caster.
+// Flattens every TriMesh of a static scene into one TriangleBVH, in the
+// space of the scene root so that moving the root (object motion) does
+// not require a rebuild. Answers the closest-hit queries that Picker
+// answers for collision avoidance and distance measurement.
+
+#ifndef RAY_CASTER_H
+#define RAY_CASTER_H
+
+#include "Wm5Node.h"
+#include "Wm5TriMesh.h"
+#include "TriangleBVH.h"
+#include <vector>
+using namespace Wm5;
+
+class RayCaster
+{
+public:
+
+   struct Hit
+   {
+      float   T;          // origin + T * direction is the hit point
+      TriMesh *Mesh;
+      int     Triangle;   // in Mesh
+      float   Bary[3];
+   };
+
+   RayCaster();
+
+   // Gather the triangles below scene; call again if the geometry changes.
+   void Build(Node *scene);
+
+   // Closest hit in world space with 0 <= T <= tmax.
+   bool RayCast(const APoint& origin, const AVector& direction, float tmax,
+                Hit& hit) const;
+
+   int GetNumTriangles() const { return(mBVH.GetNumTriangles()); }
+
+private:
+
+   void MakeHit(const TriangleBVH::Hit& bvhHit, Hit& hit) const;
+   void Collect(Spatial *object, const Transform& toScene,
+                std::vector<float>& triangles);
+
+   Node                  *mScene;
+   TriangleBVH           mBVH;
+   std::vector<TriMesh *> mMeshes;
+   std::vector<int>      mFirstTriangle;   // per mesh, ascending
+};
+#endif
@@ -6,15 +6,17 @@ SpanTracker::SpanTracker(Castle *castle, string guiPath)
 {
    mCastle  = castle;
    mGuiPath = guiPath;
-   NodePtr marker = new0 Node();
-   castle->mScene->AttachChild(marker);
-   start = new Tracker(startColor, castle->mDLight, marker);
-   end   = new Tracker(endColor, castle->mDLight, marker);
+   mMarkers = new0 Node();
+   castle->mScene->AttachChild(mMarkers);
+   mMarkersDirty = false;
+   start         = new Tracker(startColor, castle->mDLight, mMarkers, &mMarkersDirty);
+   end           = new Tracker(endColor, castle->mDLight, mMarkers, &mMarkersDirty);
    for (int i = 0; i < NUM_MARKERS; i++)
    {
-      hot[i]  = new Tracker(hotColor, castle->mDLight, marker);
-      warm[i] = new Tracker(warmColor, castle->mDLight, marker);
+      hot[i]  = new Tracker(hotColor, castle->mDLight, mMarkers, &mMarkersDirty);
+      warm[i] = new Tracker(warmColor, castle->mDLight, mMarkers, &mMarkersDirty);
    }
+   InvalidatePicks();
    init_integrator();
    mEnabled = true;
    mWidth   = mHeight = guiWidth = guiHeight = -1;
@@ -75,8 +77,6 @@ bool SpanTracker::ToggleEnable()
          warm[i]->HideMarker();
       }
    }
-   mCastle->mScene->Update();
-   mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
    return(mEnabled);
 }
 
@@ -356,8 +356,6 @@ bool SpanTracker::TrackStartTarget()
    mDeviceRotation = Matrix3f::IDENTITY;
    mDevicePosition = Vector3f(0.0f, 0.0f, -(start->targetPosition - start->devicePosition).Length());
    init_integrator();
-   mCastle->mScene->Update();
-   mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
    return(true);
 }
 
@@ -372,8 +370,6 @@ bool SpanTracker::TrackEndTarget()
       return(false);
    }
    end->Track(targetPosition, mCastle->mCamera->GetPosition());
-   mCastle->mScene->Update();
-   mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
    return(true);
 }
 
@@ -398,23 +394,23 @@ bool SpanTracker::TrackMovementStart(int key)
       return(false);
    }
 
-   // Set warm tracker marks.
-   APoint targetPosition;
-   bool   trackerSet = false;
+   // Set warm tracker marks. Markers that stay put are left alone, so a
+   // held key (repeated presses without movement) changes nothing.
+   APoint targetPositions[NUM_MARKERS];
+   bool   picked[NUM_MARKERS];
+   bool   trackerSet = (PickTargets(targetPositions, picked) > 0);
    for (int i = 0; i < NUM_MARKERS; i++)
    {
       hot[i]->Untrack();
-      warm[i]->Untrack();
-   }
-   for (int i = 0; i < NUM_MARKERS; i++)
-   {
-      if (PickTarget(i, targetPosition) && ((targetPosition - mCastle->mCamera->GetPosition()).Length() <= MAX_RANGE))
+      if (picked[i])
+      {
+         warm[i]->Track(targetPositions[i], mCastle->mCamera->GetPosition());
+      }
+      else
       {
-         warm[i]->Track(targetPosition, mCastle->mCamera->GetPosition());
-         trackerSet = true;
+         warm[i]->Untrack();
       }
    }
-   mCastle->mScene->Update();
    return(trackerSet);
 }
 
@@ -454,14 +450,14 @@ bool SpanTracker::TrackMovementEnd(int key)
    }
 
    // Set hot tracker marks.
-   APoint targetPosition;
-   bool   trackerSet = false;
+   APoint targetPositions[NUM_MARKERS];
+   bool   picked[NUM_MARKERS];
+   bool   trackerSet = (PickTargets(targetPositions, picked) > 0);
    for (int i = 0; i < NUM_MARKERS; i++)
    {
-      if (PickTarget(i, targetPosition) && ((targetPosition - mCastle->mCamera->GetPosition()).Length() <= MAX_RANGE))
+      if (picked[i])
       {
-         hot[i]->Track(targetPosition, mCastle->mCamera->GetPosition());
-         trackerSet = true;
+         hot[i]->Track(targetPositions[i], mCastle->mCamera->GetPosition());
       }
       else
       {
@@ -574,9 +570,6 @@ bool SpanTracker::TrackMovementEnd(int key)
          mDevicePosition.Y() += vertical;
       }
    }
-
-   mCastle->mScene->Update();
-   mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
    return(true);
 }
 
@@ -607,6 +600,30 @@ void SpanTracker::UpdateDevicePosition()
 }
 
 
+// Update the marker subtree: world transforms of the markers and the
+// bounds up to the root, in one pass.
+bool SpanTracker::UpdateMarkers()
+{
+   if (!mMarkersDirty)
+   {
+      return(false);
+   }
+   mMarkers->Update();
+   mMarkersDirty = false;
+   return(true);
+}
+
+
+// Forget cached picks.
+void SpanTracker::InvalidatePicks()
+{
+   for (int i = 0; i < NUM_MARKERS; i++)
+   {
+      mPickCache[i].valid = false;
+   }
+}
+
+
 // Get target position.
 APoint SpanTracker::GetTargetPosition()
 {
@@ -697,44 +714,86 @@ void SpanTracker::setRightVector(Matrix3f& rotation, Vector3f& right)
 
 // Pick target point.
 bool SpanTracker::PickTarget(int direction, APoint& target)
+{
+   APoint         pos = mCastle->mCamera->GetPosition();
+   AVector        dir = GetPickDirection(direction);
+   RayCaster::Hit hit;
+
+   if (mCastle->mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
+   {
+      target = pos + hit.T * dir;
+      return(true);
+   }
+   return(false);
+}
+
+
+// Pick target points in all marker directions within tracking range.
+int SpanTracker::PickTargets(APoint *targets, bool *picked)
 {
    APoint  pos = mCastle->mCamera->GetPosition();
-   AVector dir;
+   int     i;
 
-   switch (direction)
+   // A move of the ray origin by p and of its (unit) direction by d moves
+   // a hit at distance T by at most about |p| + T*|d|.
+   for (i = 0; i < NUM_MARKERS; i++)
    {
-   case FORWARD:
-      dir = mCastle->mCamera->GetDVector();
-      break;
+      AVector    dir   = GetPickDirection(i);
+      PickCache& cache = mPickCache[i];
+      if (cache.valid &&
+          ((pos - cache.position).Length() +
+           cache.distance * (dir - cache.direction).Length() <= PICK_TOLERANCE))
+      {
+         continue;
+      }
+
+      // The camera vectors are unit length, so T is the distance.
+      RayCaster::Hit hit;
+      cache.valid     = true;
+      cache.position  = pos;
+      cache.direction = dir;
+      cache.picked    = mCastle->mRayCaster.RayCast(pos, dir, MAX_RANGE, hit);
+      cache.distance  = (cache.picked ? hit.T : MAX_RANGE);
+      if (cache.picked)
+      {
+         cache.target = pos + hit.T * dir;
+      }
+   }
+
+   int numPicked = 0;
+   for (i = 0; i < NUM_MARKERS; i++)
+   {
+      picked[i] = mPickCache[i].picked;
+      if (picked[i])
+      {
+         targets[i] = mPickCache[i].target;
+         numPicked++;
+      }
+   }
+   return(numPicked);
+}
 
+
+// Pick direction.
+AVector SpanTracker::GetPickDirection(int direction)
+{
+   switch (direction)
+   {
    case UP:
-      dir = mCastle->mCamera->GetUVector();
-      break;
+      return(mCastle->mCamera->GetUVector());
 
    case DOWN:
-      dir = -mCastle->mCamera->GetUVector();
-      break;
+      return(-mCastle->mCamera->GetUVector());
 
    case LEFT:
-      dir = -mCastle->mCamera->GetRVector();
-      break;
+      return(-mCastle->mCamera->GetRVector());
 
    case RIGHT:
-      dir = mCastle->mCamera->GetRVector();
-      break;
-   }
-   mCastle->mPicker.Execute(mCastle->mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-   if (mCastle->mPicker.Records.size() > 0)
-   {
-      const PickRecord& record = mCastle->mPicker.GetClosestNonnegative();
-      TriMesh           *mesh  = DynamicCast<TriMesh>(record.Intersected);
-      APoint            tri[3];
-      mesh->GetWorldTriangle(record.Triangle, tri);
-      target = record.Bary[0] * tri[0] + record.Bary[1] * tri[1] +
-               record.Bary[2] * tri[2];
-      return(true);
+      return(mCastle->mCamera->GetRVector());
+
+   default:
+      return(mCastle->mCamera->GetDVector());
    }
-   return(false);
 }
 
 // Integrate device movement.
@@ -848,6 +907,4 @@ void SpanTracker::Reset()
       hot[i]->Untrack();
       warm[i]->Untrack();
    }
-   mCastle->mScene->Update();
-   mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
 }
@@ -47,6 +47,14 @@ public:
    // Update device position.
    void UpdateDevicePosition();
 
+   // Update the marker subtree if a marker moved, appeared or
+   // disappeared since the last call; once per frame. Returns true if
+   // the visible set needs recomputing.
+   bool UpdateMarkers();
+
+   // Forget cached picks; the scene moved.
+   void InvalidatePicks();
+
    // Get target position and spanning distance.
    APoint GetTargetPosition();
    float GetDistance();
@@ -118,9 +126,19 @@ public:
    // Pick target point.
    bool PickTarget(int direction, APoint& target);
 
+   // Pick target points in all marker directions, returning the number
+   // picked within MAX_RANGE. A direction is re-cast only if the camera
+   // moved its hit point by more than PICK_TOLERANCE since it was last cast.
+   int PickTargets(APoint *targets, bool *picked);
+
+   AVector GetPickDirection(int direction);
+
    // Maximum tracking range.
    const float MAX_RANGE = 100.0f;
 
+   // Hit point movement below which a cached pick is reused.
+   const float PICK_TOLERANCE = 0.001f;
+
    // Marker colors.
    const Float3 startColor = Float3(1.0f, 0.0f, 0.0f);
    const Float3 endColor   = Float3(0.0f, 0.0f, 1.0f);
@@ -135,10 +153,12 @@ public:
       // Marker radius.
       const float radius = 0.1f;
 
-      // Constructor.
-      Marker(Float3 color, Light *light, Node *parent)
+      // Constructor. Changes set *dirty; the parent is updated once
+      // for all markers by SpanTracker::UpdateMarkers.
+      Marker(Float3 color, Light *light, Node *parent, bool *dirty)
       {
          m_parent = parent;
+         m_dirty  = dirty;
          m_node   = new0 Node();
          m_ball   = new0 RigidBall(radius, color, light);
          m_node->LocalTransform.SetTranslate(m_ball->GetPosition());
@@ -157,7 +177,11 @@ public:
       // Set position.
       void SetPosition(APoint position)
       {
-         m_node->LocalTransform.SetTranslate(position);
+         if (m_node->LocalTransform.GetTranslate() != position)
+         {
+            m_node->LocalTransform.SetTranslate(position);
+            if (attached) { *m_dirty = true; }
+         }
       }
 
 
@@ -168,8 +192,8 @@ public:
          {
             m_parent->AttachChild(m_node);
             attached = true;
+            *m_dirty = true;
          }
-         m_parent->Update();
       }
 
 
@@ -180,14 +204,15 @@ public:
          {
             m_parent->DetachChild(m_node);
             attached = false;
+            *m_dirty = true;
          }
-         m_parent->Update();
       }
 
 
       NodePtr   m_parent;
       NodePtr   m_node;
       bool      attached;
+      bool      *m_dirty;
       RigidBall *m_ball;
    };
 
@@ -200,10 +225,10 @@ public:
       APoint devicePosition;
       Marker *targetMarker;
 
-      Tracker(Float3 color, Light *light, Node *parent)
+      Tracker(Float3 color, Light *light, Node *parent, bool *dirty)
       {
          tracking     = false;
-         targetMarker = new Marker(color, light, parent);
+         targetMarker = new Marker(color, light, parent, dirty);
       }
 
 
@@ -257,6 +282,22 @@ public:
    Tracker *end;
    Tracker *hot[5];
    Tracker *warm[5];
+
+   // Marker parent node, and whether it needs updating.
+   NodePtr mMarkers;
+   bool    mMarkersDirty;
+
+   // Last pick in each marker direction.
+   struct PickCache
+   {
+      bool    valid;
+      APoint  position;
+      AVector direction;
+      bool    picked;
+      float   distance;
+      APoint  target;
+   };
+   PickCache mPickCache[NUM_MARKERS];
    char    positionBuf[BUFSIZ];
    char    distanceBuf[BUFSIZ];
 };
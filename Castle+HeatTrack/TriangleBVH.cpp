@@ -0,0 +1,569 @@
+// Triangle bounding volume hierarchy.
+
+#include "TriangleBVH.h"
+#include <assert.h>
+#include <float.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+   (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TRIANGLE_BVH_SSE
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+// Binned SAH: candidate split planes per axis.
+const int NUM_BINS = 16;
+
+// Traversal stack; a four-wide tree over a few million triangles is far
+// shallower than this.
+const int STACK_SIZE = 256;
+
+float HalfArea(const float min[3], const float max[3])
+{
+   float dx = max[0] - min[0], dy = max[1] - min[1], dz = max[2] - min[2];
+
+   return(dx * dy + dy * dz + dz * dx);
+}
+
+
+void Grow(float min[3], float max[3], const float *boxMin,
+          const float *boxMax)
+{
+   for (int i = 0; i < 3; ++i)
+   {
+      min[i] = std::min(min[i], boxMin[i]);
+      max[i] = std::max(max[i], boxMax[i]);
+   }
+}
+
+
+void Reset(float min[3], float max[3])
+{
+   for (int i = 0; i < 3; ++i)
+   {
+      min[i] = FLT_MAX;
+      max[i] = -FLT_MAX;
+   }
+}
+}
+
+//----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH()
+   :
+     mNumTriangles(0),
+     mRoot(EMPTY)
+{
+}
+
+
+//----------------------------------------------------------------------------
+void TriangleBVH::Build(const std::vector<float>& triangles)
+{
+   mNumTriangles = (int)triangles.size() / 9;
+   mRoot         = EMPTY;
+   mOrder.resize(mNumTriangles);
+   mNodes.clear();
+   mLeaves.clear();
+   if (mNumTriangles == 0)
+   {
+      return;
+   }
+
+   // Per-triangle centroids and boxes.
+   std::vector<float> centroids(3 * mNumTriangles);
+   std::vector<float> bounds(6 * mNumTriangles);
+   int                t, i;
+   for (t = 0; t < mNumTriangles; ++t)
+   {
+      const float *v = &triangles[9 * t];
+      float       *b = &bounds[6 * t];
+      for (i = 0; i < 3; ++i)
+      {
+         b[i]     = std::min(v[i], std::min(v[3 + i], v[6 + i]));
+         b[3 + i] = std::max(v[i], std::max(v[3 + i], v[6 + i]));
+         centroids[3 * t + i] = 0.5f * (b[i] + b[3 + i]);
+      }
+      mOrder[t] = t;
+   }
+
+   std::vector<BuildNode> nodes;
+   nodes.reserve(2 * mNumTriangles / WIDTH + 1);
+   BuildBinary(0, mNumTriangles, nodes, centroids, bounds);
+   mRoot = Collapse(nodes, 0, triangles);
+}
+
+
+//----------------------------------------------------------------------------
+bool TriangleBVH::RayCast(const float origin[3], const float direction[3],
+                          float tmax, Hit& hit) const
+{
+   if (mRoot == EMPTY)
+   {
+      return(false);
+   }
+
+   Ray   ray;
+   float best    = tmax;
+   int   bestTri = -1;
+   float bestU   = 0.0f, bestV = 0.0f;
+   MakeRay(origin, direction, ray);
+   Traverse(mRoot, ray, best, bestTri, bestU, bestV);
+   if (bestTri < 0)
+   {
+      return(false);
+   }
+   hit.T        = best;
+   hit.Triangle = bestTri;
+   hit.Bary[0]  = 1.0f - bestU - bestV;
+   hit.Bary[1]  = bestU;
+   hit.Bary[2]  = bestV;
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+void TriangleBVH::Traverse(int root, const Ray& ray, float& best,
+                           int& bestTri, float& bestU, float& bestV) const
+{
+   // Nearest entries on top; an entry is skipped once a closer hit has
+   // been found than its box entry distance.
+   int   stackCode[STACK_SIZE];
+   float stackNear[STACK_SIZE];
+   int   top = 0;
+   stackCode[top]   = root;
+   stackNear[top++] = 0.0f;
+
+   while (top > 0)
+   {
+      --top;
+      int code = stackCode[top];
+      if (stackNear[top] > best)
+      {
+         continue;
+      }
+
+      if (code >= 0)
+      {
+         // Push the children hit, farthest first.
+         const Node& node = mNodes[code];
+         float       tnear[WIDTH];
+         int         mask = IntersectBoxes(node, ray, best, tnear);
+         int         order[WIDTH], numHit = 0;
+         for (int c = 0; c < WIDTH; ++c)
+         {
+            if ((mask & (1 << c)) && (node.Child[c] != EMPTY))
+            {
+               int k = numHit++;
+               for ( ; k > 0 && tnear[order[k - 1]] < tnear[c]; --k)
+               {
+                  order[k] = order[k - 1];
+               }
+               order[k] = c;
+            }
+         }
+         assert(top + numHit <= STACK_SIZE);
+         for (int k = 0; k < numHit; ++k)
+         {
+            stackCode[top]   = node.Child[order[k]];
+            stackNear[top++] = tnear[order[k]];
+         }
+         continue;
+      }
+
+      TestLeaf(mLeaves[-1 - code], ray, best, bestTri, bestU, bestV);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void TriangleBVH::TestLeaf(const Leaf& leaf, const Ray& ray, float& best,
+                           int& bestTri, float& bestU, float& bestV)
+{
+   float t[WIDTH], u[WIDTH], v[WIDTH];
+   int   mask = IntersectTriangles(leaf, ray, best, t, u, v);
+
+   for (int c = 0; c < WIDTH; ++c)
+   {
+      if ((mask & (1 << c)) && ((bestTri < 0) || (t[c] < best)))
+      {
+         best    = t[c];
+         bestTri = leaf.Triangle[c];
+         bestU   = u[c];
+         bestV   = v[c];
+      }
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void TriangleBVH::MakeRay(const float origin[3], const float direction[3],
+                          Ray& ray)
+{
+   for (int i = 0; i < 3; ++i)
+   {
+      ray.Origin[i]       = origin[i];
+      ray.Direction[i]    = direction[i];
+      ray.InvDirection[i] = 1.0f / direction[i];
+   }
+}
+
+
+//----------------------------------------------------------------------------
+int TriangleBVH::IntersectBoxes(const Node& node, const Ray& ray, float tmax,
+                                float tnear[WIDTH])
+{
+   // Slab test against the four child boxes.
+   const float *origin = ray.Origin;
+   const float *invDir = ray.InvDirection;
+
+#ifdef TRIANGLE_BVH_SSE
+   __m128 tmin = _mm_setzero_ps();
+   __m128 tfar = _mm_set1_ps(tmax);
+   for (int a = 0; a < 3; ++a)
+   {
+      __m128 o  = _mm_set1_ps(origin[a]);
+      __m128 id = _mm_set1_ps(invDir[a]);
+      __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.Min[a]), o), id);
+      __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.Max[a]), o), id);
+
+      // 0 * inf is NaN: a ray parallel to the axis that starts on a box
+      // plane. It is inside that slab, so the axis does not bound it.
+      __m128 onPlane = _mm_cmpunord_ps(t0, t1);
+      tmin = _mm_max_ps(tmin, _mm_andnot_ps(onPlane, _mm_min_ps(t0, t1)));
+      tfar = _mm_min_ps(tfar, _mm_or_ps(_mm_andnot_ps(onPlane, _mm_max_ps(t0, t1)),
+                                        _mm_and_ps(onPlane, _mm_set1_ps(FLT_MAX))));
+   }
+   _mm_storeu_ps(tnear, tmin);
+   return(_mm_movemask_ps(_mm_cmple_ps(tmin, tfar)));
+#else
+   int mask = 0;
+   for (int c = 0; c < WIDTH; ++c)
+   {
+      float tmin = 0.0f, tfar = tmax;
+      for (int a = 0; a < 3; ++a)
+      {
+         float t0 = (node.Min[a][c] - origin[a]) * invDir[a];
+         float t1 = (node.Max[a][c] - origin[a]) * invDir[a];
+         if ((t0 != t0) || (t1 != t1))
+         {
+            // 0 * inf: parallel to the axis and on a box plane.
+            continue;
+         }
+         tmin = std::max(tmin, std::min(t0, t1));
+         tfar = std::min(tfar, std::max(t0, t1));
+      }
+      tnear[c] = tmin;
+      if (tmin <= tfar)
+      {
+         mask |= (1 << c);
+      }
+   }
+   return(mask);
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+int TriangleBVH::IntersectTriangles(const Leaf& leaf, const Ray& ray,
+                                    float tmax, float t[WIDTH],
+                                    float u[WIDTH], float v[WIDTH])
+{
+   // Moller-Trumbore against the four leaf triangles.
+   const float *origin    = ray.Origin;
+   const float *direction = ray.Direction;
+
+#ifdef TRIANGLE_BVH_SSE
+   const __m128 dx   = _mm_set1_ps(direction[0]);
+   const __m128 dy   = _mm_set1_ps(direction[1]);
+   const __m128 dz   = _mm_set1_ps(direction[2]);
+   const __m128 zero = _mm_setzero_ps();
+   const __m128 one  = _mm_set1_ps(1.0f);
+   __m128       e1x  = _mm_loadu_ps(leaf.E1[0]);
+   __m128       e1y  = _mm_loadu_ps(leaf.E1[1]);
+   __m128       e1z  = _mm_loadu_ps(leaf.E1[2]);
+   __m128       e2x  = _mm_loadu_ps(leaf.E2[0]);
+   __m128       e2y  = _mm_loadu_ps(leaf.E2[1]);
+   __m128       e2z  = _mm_loadu_ps(leaf.E2[2]);
+   __m128       px   = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+   __m128       py   = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+   __m128       pz   = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+   __m128       det  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px),
+                                             _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+   __m128 inv = _mm_div_ps(one, det);
+   __m128 sx  = _mm_sub_ps(_mm_set1_ps(origin[0]), _mm_loadu_ps(leaf.V0[0]));
+   __m128 sy  = _mm_sub_ps(_mm_set1_ps(origin[1]), _mm_loadu_ps(leaf.V0[1]));
+   __m128 sz  = _mm_sub_ps(_mm_set1_ps(origin[2]), _mm_loadu_ps(leaf.V0[2]));
+   __m128 uu  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px),
+                                                 _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inv);
+   __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+   __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+   __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+   __m128 vv = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx),
+                                                _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inv);
+   __m128 tt = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx),
+                                                _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inv);
+   __m128 ok = _mm_and_ps(_mm_cmpneq_ps(det, zero),
+                          _mm_and_ps(_mm_cmpge_ps(uu, zero), _mm_cmpge_ps(vv, zero)));
+   ok = _mm_and_ps(ok, _mm_cmple_ps(_mm_add_ps(uu, vv), one));
+   ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(tt, zero),
+                                  _mm_cmple_ps(tt, _mm_set1_ps(tmax))));
+   _mm_storeu_ps(t, tt);
+   _mm_storeu_ps(u, uu);
+   _mm_storeu_ps(v, vv);
+   return(_mm_movemask_ps(ok));
+#else
+   int mask = 0;
+   for (int c = 0; c < WIDTH; ++c)
+   {
+      const float e1[3] = { leaf.E1[0][c], leaf.E1[1][c], leaf.E1[2][c] };
+      const float e2[3] = { leaf.E2[0][c], leaf.E2[1][c], leaf.E2[2][c] };
+      float       p[3]  =
+      {
+         direction[1] * e2[2] - direction[2] * e2[1],
+         direction[2] * e2[0] - direction[0] * e2[2],
+         direction[0] * e2[1] - direction[1] * e2[0]
+      };
+      float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+      if (det == 0.0f)
+      {
+         continue;
+      }
+      float inv  = 1.0f / det;
+      float s[3] =
+      {
+         origin[0] - leaf.V0[0][c],
+         origin[1] - leaf.V0[1][c],
+         origin[2] - leaf.V0[2][c]
+      };
+      float q[3] =
+      {
+         s[1] * e1[2] - s[2] * e1[1],
+         s[2] * e1[0] - s[0] * e1[2],
+         s[0] * e1[1] - s[1] * e1[0]
+      };
+      u[c] = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv;
+      v[c] = (direction[0] * q[0] + direction[1] * q[1] +
+              direction[2] * q[2]) * inv;
+      t[c] = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv;
+      if ((u[c] >= 0.0f) && (v[c] >= 0.0f) && (u[c] + v[c] <= 1.0f) &&
+          (t[c] >= 0.0f) && (t[c] <= tmax))
+      {
+         mask |= (1 << c);
+      }
+   }
+   return(mask);
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+int TriangleBVH::BuildBinary(int first, int count,
+                             std::vector<BuildNode>& nodes,
+                             const std::vector<float>& centroids,
+                             const std::vector<float>& bounds)
+{
+   int       index = (int)nodes.size();
+   BuildNode node;
+   float     cmin[3], cmax[3];
+   int       i, a;
+
+   Reset(node.Min, node.Max);
+   Reset(cmin, cmax);
+   for (i = first; i < first + count; ++i)
+   {
+      int t = mOrder[i];
+      Grow(node.Min, node.Max, &bounds[6 * t], &bounds[6 * t + 3]);
+      Grow(cmin, cmax, &centroids[3 * t], &centroids[3 * t]);
+   }
+   node.Left  = node.Right = -1;
+   node.First = first;
+   node.Count = count;
+   nodes.push_back(node);
+   if (count <= WIDTH)
+   {
+      return(index);
+   }
+
+   // Cheapest split over the bins of each axis.
+   float bestCost = FLT_MAX;
+   int   bestAxis = -1, bestBin = 0;
+   for (a = 0; a < 3; ++a)
+   {
+      float extent = cmax[a] - cmin[a];
+      if (extent <= 0.0f)
+      {
+         continue;
+      }
+      float scale = NUM_BINS / extent;
+      int   binCount[NUM_BINS] = { 0 };
+      float binMin[NUM_BINS][3], binMax[NUM_BINS][3];
+      int   b;
+      for (b = 0; b < NUM_BINS; ++b)
+      {
+         Reset(binMin[b], binMax[b]);
+      }
+      for (i = first; i < first + count; ++i)
+      {
+         int t = mOrder[i];
+         b = std::min(NUM_BINS - 1,
+                      (int)((centroids[3 * t + a] - cmin[a]) * scale));
+         ++binCount[b];
+         Grow(binMin[b], binMax[b], &bounds[6 * t], &bounds[6 * t + 3]);
+      }
+
+      // Sweep from the right, then from the left.
+      float rightArea[NUM_BINS];
+      int   rightCount[NUM_BINS];
+      float min[3], max[3];
+      int   n = 0;
+      Reset(min, max);
+      for (b = NUM_BINS - 1; b > 0; --b)
+      {
+         n += binCount[b];
+         Grow(min, max, binMin[b], binMax[b]);
+         rightCount[b] = n;
+         rightArea[b]  = (n > 0 ? HalfArea(min, max) : 0.0f);
+      }
+      n = 0;
+      Reset(min, max);
+      for (b = 0; b < NUM_BINS - 1; ++b)
+      {
+         n += binCount[b];
+         Grow(min, max, binMin[b], binMax[b]);
+         if ((n == 0) || (rightCount[b + 1] == 0))
+         {
+            continue;
+         }
+         float cost = n * HalfArea(min, max) +
+                      rightCount[b + 1] * rightArea[b + 1];
+         if (cost < bestCost)
+         {
+            bestCost = cost;
+            bestAxis = a;
+            bestBin  = b;
+         }
+      }
+   }
+
+   // Partition; identical centroids are split down the middle.
+   int middle = first + count / 2;
+   if (bestAxis >= 0)
+   {
+      float scale = NUM_BINS / (cmax[bestAxis] - cmin[bestAxis]);
+      float lo    = cmin[bestAxis];
+      int   *mid  = std::partition(&mOrder[first], &mOrder[first] + count,
+                                   [&](int t)
+                                   {
+                                      int b = std::min(NUM_BINS - 1,
+                                                       (int)((centroids[3 * t + bestAxis] - lo) * scale));
+                                      return(b <= bestBin);
+                                   });
+      middle = (int)(mid - &mOrder[0]);
+      if ((middle == first) || (middle == first + count))
+      {
+         middle = first + count / 2;
+      }
+   }
+
+   node.Left    = BuildBinary(first, middle - first, nodes, centroids, bounds);
+   node.Right   = BuildBinary(middle, first + count - middle, nodes,
+                              centroids, bounds);
+   nodes[index] = node;
+   return(index);
+}
+
+
+//----------------------------------------------------------------------------
+int TriangleBVH::Collapse(const std::vector<BuildNode>& nodes, int index,
+                          const std::vector<float>& triangles)
+{
+   const BuildNode& node = nodes[index];
+
+   if (node.Left < 0)
+   {
+      return(-1 - MakeLeaf(node, triangles));
+   }
+
+   // Open the largest interior children until there are four.
+   int children[WIDTH] = { node.Left, node.Right };
+   int numChildren     = 2;
+   while (numChildren < WIDTH)
+   {
+      int   open = -1;
+      float area = -1.0f;
+      for (int c = 0; c < numChildren; ++c)
+      {
+         const BuildNode& child = nodes[children[c]];
+         if ((child.Left >= 0) && (HalfArea(child.Min, child.Max) > area))
+         {
+            open = c;
+            area = HalfArea(child.Min, child.Max);
+         }
+      }
+      if (open < 0)
+      {
+         break;
+      }
+      const BuildNode& child = nodes[children[open]];
+      children[open]          = child.Left;
+      children[numChildren++] = child.Right;
+   }
+
+   Node wide;
+   for (int c = 0; c < WIDTH; ++c)
+   {
+      if (c < numChildren)
+      {
+         const BuildNode& child = nodes[children[c]];
+         for (int a = 0; a < 3; ++a)
+         {
+            wide.Min[a][c] = child.Min[a];
+            wide.Max[a][c] = child.Max[a];
+         }
+         wide.Child[c] = Collapse(nodes, children[c], triangles);
+      }
+      else
+      {
+         for (int a = 0; a < 3; ++a)
+         {
+            wide.Min[a][c] = wide.Max[a][c] = 0.0f;
+         }
+         wide.Child[c] = EMPTY;
+      }
+   }
+   mNodes.push_back(wide);
+   return((int)mNodes.size() - 1);
+}
+
+
+//----------------------------------------------------------------------------
+int TriangleBVH::MakeLeaf(const BuildNode& node,
+                          const std::vector<float>& triangles)
+{
+   Leaf leaf;
+
+   assert(node.Count <= WIDTH);
+   for (int c = 0; c < WIDTH; ++c)
+   {
+      int t = (c < node.Count ? mOrder[node.First + c] : -1);
+      leaf.Triangle[c] = t;
+      for (int a = 0; a < 3; ++a)
+      {
+         if (t >= 0)
+         {
+            const float *v = &triangles[9 * t];
+            leaf.V0[a][c] = v[a];
+            leaf.E1[a][c] = v[3 + a] - v[a];
+            leaf.E2[a][c] = v[6 + a] - v[a];
+         }
+         else
+         {
+            leaf.V0[a][c] = leaf.E1[a][c] = leaf.E2[a][c] = 0.0f;
+         }
+      }
+   }
+   mLeaves.push_back(leaf);
+   return((int)mLeaves.size() - 1);
+}
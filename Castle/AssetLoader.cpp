@@ -0,0 +1,282 @@
+// Castle asset loader.
+
+#include "AssetLoader.h"
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+
+//----------------------------------------------------------------------------
+AssetLoader::AssetLoader(int numThreads)
+   :
+     mNumThreads(numThreads),
+     mStopping(false),
+     mStartTime(Now()),
+     mFinishTime(0.0)
+{
+   if (mNumThreads <= 0)
+   {
+      mNumThreads = (int)std::thread::hardware_concurrency();
+      if (mNumThreads <= 0)
+      {
+         mNumThreads = 1;
+      }
+   }
+   for (int i = 1; i <= mNumThreads; ++i)
+   {
+      mThreads.push_back(std::thread(&AssetLoader::Worker, this, i));
+   }
+}
+
+
+//----------------------------------------------------------------------------
+AssetLoader::~AssetLoader()
+{
+   Finish();
+
+   for (int i = 0; i < (int)mOrder.size(); ++i)
+   {
+      Asset *asset = mOrder[i];
+      if (!asset->Claimed)
+      {
+         delete0(asset->Texture);
+      }
+      delete0(asset);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void AssetLoader::RequestTexture(const std::string& filename)
+{
+   Request(TEXTURE, filename, 0, false);
+}
+
+
+//----------------------------------------------------------------------------
+void AssetLoader::RequestMesh(const std::string& filename, int numTCoords,
+                              bool multi)
+{
+   Request(MESH, filename, numTCoords, multi);
+}
+
+
+//----------------------------------------------------------------------------
+Texture2D *AssetLoader::GetTexture(const std::string& filename)
+{
+   Asset *asset = Acquire(TEXTURE, filename, 0, false);
+
+   // Once handed out, the texture belongs to the caller's smart pointers.
+   std::unique_lock<std::mutex> lock(mMutex);
+   asset->Claimed = true;
+   return(asset->Texture);
+}
+
+
+//----------------------------------------------------------------------------
+const MeshData *AssetLoader::GetMesh(const std::string& filename,
+                                     int numTCoords, bool multi)
+{
+   Asset *asset = Acquire(MESH, filename, numTCoords, multi);
+
+   return(asset->Valid ? &asset->Mesh : 0);
+}
+
+
+//----------------------------------------------------------------------------
+void AssetLoader::Finish()
+{
+   {
+      std::unique_lock<std::mutex> lock(mMutex);
+      if (mStopping)
+      {
+         return;
+      }
+      mStopping = true;
+   }
+   mQueued.notify_all();
+   for (int i = 0; i < (int)mThreads.size(); ++i)
+   {
+      mThreads[i].join();
+   }
+   mThreads.clear();
+   mFinishTime = Now();
+}
+
+
+//----------------------------------------------------------------------------
+bool AssetLoader::WriteReport(const std::string& filename) const
+{
+   FILE *fp = fopen(filename.c_str(), "w");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+
+   std::unique_lock<std::mutex> lock(mMutex);
+   std::vector<Asset *>         sorted(mOrder);
+   std::sort(sorted.begin(), sorted.end(),
+             [](const Asset *a, const Asset *b)
+             {
+                return(a->LoadTime > b->LoadTime);
+             });
+
+   fprintf(fp, "%-8s %10s %10s %10s %6s  %s\n", "kind", "bytes", "load ms",
+           "wait ms", "thread", "file");
+   double loadTime = 0.0, waitTime = 0.0;
+   for (int i = 0; i < (int)sorted.size(); ++i)
+   {
+      const Asset *asset = sorted[i];
+      fprintf(fp, "%-8s %10lld %10.2f %10.2f %6d  %s%s\n",
+              (asset->AssetKind == TEXTURE ? "texture" : "mesh"),
+              asset->Bytes, asset->LoadTime, asset->WaitTime, asset->Thread,
+              asset->Filename.c_str(),
+              (asset->AssetKind == MESH && asset->Valid &&
+               asset->Mesh.IsCompiled() ? " (compiled)" : ""));
+      loadTime += asset->LoadTime;
+      waitTime += asset->WaitTime;
+   }
+
+   double wallTime = (mFinishTime > 0.0 ? mFinishTime : Now()) - mStartTime;
+   fprintf(fp, "\n%d assets, %d worker threads\n", (int)sorted.size(),
+           mNumThreads);
+   fprintf(fp, "total load time %.2f ms, wall time %.2f ms (%.2fx)\n",
+           loadTime, wallTime, (wallTime > 0.0 ? loadTime / wallTime : 0.0));
+   fprintf(fp, "calling thread waited %.2f ms\n", waitTime);
+   fclose(fp);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+AssetLoader::Asset *AssetLoader::Request(Kind kind,
+                                         const std::string& filename,
+                                         int numTCoords, bool multi)
+{
+   std::unique_lock<std::mutex> lock(mMutex);
+
+   std::map<std::string, Asset *>::iterator it = mAssets.find(filename);
+   if (it != mAssets.end())
+   {
+      return(it->second);
+   }
+
+   Asset *asset = new0 Asset;
+   asset->AssetKind  = kind;
+   asset->Filename   = filename;
+   asset->NumTCoords = numTCoords;
+   asset->Multi      = multi;
+   asset->Bytes      = 0;
+   asset->AssetState = QUEUED;
+   asset->Texture    = 0;
+   asset->Claimed    = false;
+   asset->Valid      = false;
+   asset->Thread     = 0;
+   asset->LoadTime   = 0.0;
+   asset->WaitTime   = 0.0;
+   long long mtime;
+   MappedFile::GetFileStamp(filename, asset->Bytes, mtime);
+   mAssets[filename] = asset;
+   mOrder.push_back(asset);
+
+   // Largest first, so a big mesh is not left for last on one core.
+   std::deque<Asset *>::iterator pos = mQueue.begin();
+   while ((pos != mQueue.end()) && ((*pos)->Bytes >= asset->Bytes))
+   {
+      ++pos;
+   }
+   mQueue.insert(pos, asset);
+   lock.unlock();
+   mQueued.notify_one();
+   return(asset);
+}
+
+
+//----------------------------------------------------------------------------
+AssetLoader::Asset *AssetLoader::Acquire(Kind kind,
+                                         const std::string& filename,
+                                         int numTCoords, bool multi)
+{
+   Asset *asset = Request(kind, filename, numTCoords, multi);
+
+   assert(asset->AssetKind == kind);
+   double start = Now();
+   std::unique_lock<std::mutex> lock(mMutex);
+   if (asset->AssetState == QUEUED)
+   {
+      // Nobody has started it: do it here rather than wait.
+      mQueue.erase(std::find(mQueue.begin(), mQueue.end(), asset));
+      asset->AssetState = LOADING;
+      lock.unlock();
+      Load(asset, 0);
+      lock.lock();
+      asset->AssetState = LOADED;
+      mLoaded.notify_all();
+   }
+   while (asset->AssetState != LOADED)
+   {
+      mLoaded.wait(lock);
+   }
+   asset->WaitTime += Now() - start;
+   return(asset);
+}
+
+
+//----------------------------------------------------------------------------
+void AssetLoader::Worker(int index)
+{
+   std::unique_lock<std::mutex> lock(mMutex);
+
+   for ( ; ; )
+   {
+      while (mQueue.empty() && !mStopping)
+      {
+         mQueued.wait(lock);
+      }
+      if (mQueue.empty())
+      {
+         return;
+      }
+      Asset *asset = mQueue.front();
+      mQueue.pop_front();
+      asset->AssetState = LOADING;
+      lock.unlock();
+      Load(asset, index);
+      lock.lock();
+      asset->AssetState = LOADED;
+      mLoaded.notify_all();
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void AssetLoader::Load(Asset *asset, int thread)
+{
+   double start = Now();
+
+   if (asset->AssetKind == TEXTURE)
+   {
+      asset->Texture = Texture2D::LoadWMTF(asset->Filename);
+      if (asset->Texture != 0)
+      {
+         asset->Texture->GenerateMipmaps();
+      }
+      asset->Valid = (asset->Texture != 0);
+   }
+   else
+   {
+      asset->Valid = asset->Mesh.Load(asset->Filename, asset->NumTCoords,
+                                      asset->Multi);
+   }
+   asset->Thread   = thread;
+   asset->LoadTime = Now() - start;
+}
+
+
+//----------------------------------------------------------------------------
+double AssetLoader::Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
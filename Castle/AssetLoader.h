@@ -0,0 +1,96 @@
+// Castle asset loader.
+// Decodes textures and parses geometry files on a pool of worker threads
+// while the scene is being built. The workers only touch system memory:
+// a texture is read and its mipmaps generated, a mesh file is mapped or
+// parsed into a MeshData. Vertex/index buffers and scene objects are
+// still created on the calling thread, and the renderer binds them to the
+// GPU on first draw as before.
+//
+// Requests are queued largest file first. A Get call for an asset that no
+// worker has started runs it on the calling thread instead of waiting.
+
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "Wm5Texture2D.h"
+#include "MeshData.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace Wm5;
+
+class AssetLoader
+{
+public:
+
+   // numThreads <= 0 uses one worker per hardware thread.
+   AssetLoader(int numThreads = 0);
+   ~AssetLoader();
+
+   // Queue an asset by full path. Repeated requests are loaded once.
+   void RequestTexture(const std::string& filename);
+   void RequestMesh(const std::string& filename, int numTCoords, bool multi);
+
+   // Wait for an asset, loading it here if it was never requested. The
+   // texture is owned by the smart pointers it is assigned to; the mesh
+   // data lives until the loader is destroyed. Returns null on failure.
+   Texture2D *GetTexture(const std::string& filename);
+   const MeshData *GetMesh(const std::string& filename, int numTCoords,
+                           bool multi);
+
+   // Wait for all requests and stop the workers.
+   void Finish();
+
+   // Per-asset load times, slowest first, with totals.
+   bool WriteReport(const std::string& filename) const;
+
+private:
+
+   enum Kind { TEXTURE, MESH };
+   enum State { QUEUED, LOADING, LOADED };
+
+   struct Asset
+   {
+      Kind        AssetKind;
+      std::string Filename;
+      int         NumTCoords;
+      bool        Multi;
+      long long   Bytes;
+      State       AssetState;
+      Texture2D   *Texture;
+      bool        Claimed;
+      MeshData    Mesh;
+      bool        Valid;
+      int         Thread;        // worker index, 0 for the calling thread
+      double      LoadTime;      // milliseconds spent loading
+      double      WaitTime;      // milliseconds the calling thread waited
+   };
+
+   Asset *Request(Kind kind, const std::string& filename, int numTCoords,
+                  bool multi);
+   Asset *Acquire(Kind kind, const std::string& filename, int numTCoords,
+                  bool multi);
+   void Worker(int index);
+   void Load(Asset *asset, int thread);
+
+   static double Now();
+
+   // Not copyable.
+   AssetLoader(const AssetLoader&);
+   AssetLoader& operator=(const AssetLoader&);
+
+   int                            mNumThreads;
+   std::vector<std::thread>       mThreads;
+   mutable std::mutex             mMutex;
+   std::condition_variable        mQueued, mLoaded;
+   std::deque<Asset *>            mQueue;
+   std::map<std::string, Asset *> mAssets;
+   std::vector<Asset *>           mOrder;
+   bool                           mStopping;
+   double                         mStartTime, mFinishTime;
+};
+#endif
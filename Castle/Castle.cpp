@@ -1,6 +1,8 @@
 // SpanTracker castle demo.
 
 #include "Castle.h"
+#include "CollisionGeometry.h"
+#include <chrono>
 #include <random>
 #ifndef WIN32
 #include <unistd.h>
@@ -37,7 +39,9 @@ Castle::Castle()
       mSin[i]       = Mathf::Sin(angle);
       mTolerance[i] = 2.0f - 1.5f * Mathf::FAbs(unit);  // in [1/2,1]
    }
-   mSpanTracker = NULL;
+   mSpanTracker         = NULL;
+   mAssets              = NULL;
+   mGLExtensionReported = false;
 }
 
 
@@ -75,11 +79,15 @@ bool Castle::OnInitialize()
    mScene->Update();
 
    mCuller.SetCamera(mCamera);
+   BatchStaticProps();
    mCuller.ComputeVisibleSet(mScene);
+   mRayCaster.Build(mScene);
 
    InitializeCameraMotion(0.5f, 0.001f);
    InitializeObjectMotion(mScene);
 
+   // Start the GUI library's log writer (Log.txt) before the GUI loads.
+   Logger::initialize();
    mSpanTracker = new SpanTracker(this, WM5Path + "Projects/Castle/GUI/");
 
    MoveForward();
@@ -103,6 +111,7 @@ void Castle::OnTerminate()
 
    mScene      = 0;
    mTrnNode    = 0;
+   mProps      = 0;
    mWireState  = 0;
    mDLightRoot = 0;
    mDLight     = 0;
@@ -268,6 +277,12 @@ void Castle::OnIdle()
 
       mRenderer->PostDraw();
       mRenderer->DisplayColorBuffer();
+
+      if (!mGLExtensionReported)
+      {
+         WriteGLExtensionReport();
+         mGLExtensionReported = true;
+      }
    }
 
    UpdateFrameCount();
@@ -289,15 +304,27 @@ bool Castle::OnKeyDown(unsigned char key, int x, int y)
       AutoSpanTrack();
       return(true);
 
+   case 'g':
+      SaveCollisionGeometry();
+      return(true);
+
    case 'h':
    case '?':
       mSpanTracker->ToggleHelp();
       return(true);
 
+   case 'i':
+      mSpanTracker->ImuRateChange();
+      return(true);
+
    case 'l':
       mSpanTracker->ToggleLogging();
       return(true);
 
+   case 'p':
+      BenchmarkRayCast();
+      return(true);
+
    case 'r':
       if (WindowApplication3::OnKeyDown(key, x, y))
       {
@@ -343,6 +370,10 @@ bool Castle::OnKeyDown(unsigned char key, int x, int y)
       mWireState->Enabled = !mWireState->Enabled;
       return(true);
 
+   case 'z':
+      mSpanTracker->ToggleRest();
+      return(true);
+
    case '+':
    case '=':
       mVerticalDistance += 0.1f;
@@ -419,13 +450,12 @@ bool Castle::OnMouseClick(int button, int state, int x, int y, unsigned int)
    AVector dir;
    if (mRenderer->GetPickRay(x, GetHeight() - 1 - y, pos, dir))
    {
-      mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-      if (mPicker.Records.size() > 0)
+      RayCaster::Hit hit;
+      if (mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
       {
          // Display the selected object's name.
-         const PickRecord& record  = mPicker.GetClosestNonnegative();
-         const Spatial     *object = record.Intersected;
-         sprintf(mPickMessage, "%s", object->GetName().c_str());
+         sprintf(mPickMessage, "%s",
+                 mBatcher.GetName(hit.Mesh, hit.Triangle).c_str());
       }
       else
       {
@@ -444,15 +474,10 @@ void Castle::AdjustVerticalDistance()
    APoint  pos = mCamera->GetPosition();
    AVector dir = -AVector::UNIT_Z;
 
-   mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-   if (mPicker.Records.size() > 0)
+   RayCaster::Hit hit;
+   if (mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
    {
-      const PickRecord& record = mPicker.GetClosestNonnegative();
-      TriMesh           *mesh  = DynamicCast<TriMesh>(record.Intersected);
-      APoint            tri[3];
-      mesh->GetWorldTriangle(record.Triangle, tri);
-      APoint closest = record.Bary[0] * tri[0] + record.Bary[1] * tri[1] +
-                       record.Bary[2] * tri[2];
+      APoint closest = pos + hit.T * dir;
 
       closest[2] += mVerticalDistance;
       float z = mCamera->GetPosition().Z();
@@ -473,14 +498,10 @@ bool Castle::AllowMotion(float sign)
    for (int i = 0; i < mNumRays; ++i)
    {
       AVector dir = mCos[i] * mWorldAxis[2] + sign * mSin[i] * mWorldAxis[0];
-      mPicker.Execute(mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-      if (mPicker.Records.size() > 0)
+      RayCaster::Hit hit;
+      if (mRayCaster.RayCast(pos, dir, mTolerance[i], hit))
       {
-         const PickRecord& record = mPicker.GetClosestNonnegative();
-         if (record.T <= mTolerance[i])
-         {
-            return(false);
-         }
+         return(false);
       }
    }
 
@@ -488,6 +509,99 @@ bool Castle::AllowMotion(float sign)
 }
 
 
+//----------------------------------------------------------------------------
+void Castle::BenchmarkRayCast()
+{
+   // Rays in all directions from the camera, as the SpanTracker and the
+   // collision checks cast them.
+   const int numRays = 1000;
+
+   APoint               pos = mCamera->GetPosition();
+   std::vector<AVector> dirs(numRays);
+   int                  i;
+   for (i = 0; i < numRays; ++i)
+   {
+      float z     = 1.0f - 2.0f * (i + 0.5f) / numRays;
+      float r     = Mathf::Sqrt(1.0f - z * z);
+      float angle = 2.399963f * i;   // golden angle
+      dirs[i] = AVector(r * Mathf::Cos(angle), r * Mathf::Sin(angle), z);
+   }
+
+   std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+   std::vector<float> pickerT(numRays, -1.0f);
+   for (i = 0; i < numRays; ++i)
+   {
+      mPicker.Execute(mScene, pos, dirs[i], 0.0f, Mathf::MAX_REAL);
+      if (mPicker.Records.size() > 0)
+      {
+         pickerT[i] = mPicker.GetClosestNonnegative().T;
+      }
+   }
+   std::chrono::duration<double> pickerTime =
+      std::chrono::steady_clock::now() - start;
+
+   start = std::chrono::steady_clock::now();
+   std::vector<float> castT(numRays, -1.0f);
+   for (i = 0; i < numRays; ++i)
+   {
+      RayCaster::Hit hit;
+      if (mRayCaster.RayCast(pos, dirs[i], Mathf::MAX_REAL, hit))
+      {
+         castT[i] = hit.T;
+      }
+   }
+   std::chrono::duration<double> castTime =
+      std::chrono::steady_clock::now() - start;
+
+   int numDiffer = 0;
+   for (i = 0; i < numRays; ++i)
+   {
+      if (Mathf::FAbs(pickerT[i] - castT[i]) > 1.0e-3f * (1.0f + pickerT[i]))
+      {
+         ++numDiffer;
+      }
+   }
+   sprintf(mPickMessage,
+           "Picker %.0f rays/s, BVH %.0f rays/s (%d triangles), %d of %d differ",
+           numRays / pickerTime.count(), numRays / castTime.count(),
+           mRayCaster.GetNumTriangles(), numDiffer, numRays);
+}
+
+
+//----------------------------------------------------------------------------
+void Castle::SaveCollisionGeometry()
+{
+   const char        *filename = "castle.collision";
+   CollisionGeometry geometry;
+   APoint            pos   = mCamera->GetPosition();
+   AVector           dir   = mCamera->GetDVector();
+   AVector           up    = mCamera->GetUVector();
+   AVector           right = mCamera->GetRVector();
+
+   mRayCaster.GetTriangles(geometry.Triangles);
+   for (int i = 0; i < 3; ++i)
+   {
+      geometry.Position[i] = pos[i];
+      geometry.DVector[i]  = dir[i];
+      geometry.UVector[i]  = up[i];
+      geometry.RVector[i]  = right[i];
+   }
+   geometry.TrnSpeed         = mTrnSpeed;
+   geometry.RotSpeed         = mRotSpeed;
+   geometry.VerticalDistance = mVerticalDistance;
+   if (geometry.Save(filename))
+   {
+      sprintf(mPickMessage, "Saved %d triangles and the camera to %s",
+              mRayCaster.GetNumTriangles(), filename);
+   }
+   else
+   {
+      sprintf(mPickMessage, "Cannot save %s", filename);
+   }
+}
+
+
 //----------------------------------------------------------------------------
 void Castle::MoveForward()
 {
@@ -648,6 +762,9 @@ void Castle::CreateScene()
    mWireState = new0 WireState();
    mRenderer->SetOverrideWireState(mWireState);
 
+   mAssets = new0 AssetLoader();
+   RequestAssets();
+
    CreateLights();
    CreateEffects();
    CreateTextures();
@@ -672,6 +789,8 @@ void Castle::CreateScene()
    CreateRope(1);
    CreateRope(2);
 
+   // The props are gathered under one node for batching.
+   int firstProp = mTrnNode->GetNumChildren();
    int i;
    for (i = 1; i <= 7; ++i)
    {
@@ -756,11 +875,121 @@ void Castle::CreateScene()
    {
       CreateDoor(i);
    }
+   mProps = new0 Node();
+   for (i = firstProp; i < mTrnNode->GetNumChildren(); ++i)
+   {
+      SpatialPtr prop = mTrnNode->DetachChildAt(i);
+      if (prop != 0)
+      {
+         mProps->AttachChild(prop);
+      }
+   }
+   mTrnNode->AttachChild(mProps);
 
    CreateTerrain();
    CreateSkyDome();
    CreateWater();
    CreateWater2();
+
+   mAssets->Finish();
+   mAssets->WriteReport("AssetLoads.txt");
+   delete0(mAssets);
+}
+
+
+//----------------------------------------------------------------------------
+static int CountMeshes(const Spatial *object)
+{
+   const Node *node = DynamicCast<Node>(object);
+
+   if (node == 0)
+   {
+      return(object->IsDerived(Visual::TYPE) ? 1 : 0);
+   }
+   int count = 0;
+   for (int i = 0; i < node->GetNumChildren(); ++i)
+   {
+      if (node->GetChild(i) != 0)
+      {
+         count += CountMeshes(node->GetChild(i));
+      }
+   }
+   return(count);
+}
+
+
+//----------------------------------------------------------------------------
+void Castle::BatchStaticProps()
+{
+   // Compare culling from the start view before and after.
+   int   numMeshes = CountMeshes(mScene);
+   int   numVisible;
+   float cullTime = TimeCulling(numVisible);
+
+   int numMerged = mBatcher.Batch(mProps, mTexEffect);
+
+   mScene->Update();
+   int   batchedMeshes = CountMeshes(mScene);
+   int   batchedVisible;
+   float batchedCullTime = TimeCulling(batchedVisible);
+
+   FILE *fp = fopen("StaticBatches.txt", "w");
+   if (fp != NULL)
+   {
+      fprintf(fp, "%d prop meshes merged into %d batches\n", numMerged,
+              mBatcher.GetNumBatches());
+      fprintf(fp, "%-10s %8s %12s %10s\n", "", "meshes", "draw calls",
+              "cull ms");
+      fprintf(fp, "%-10s %8d %12d %10.4f\n", "unbatched", numMeshes,
+              numVisible, cullTime);
+      fprintf(fp, "%-10s %8d %12d %10.4f\n", "batched", batchedMeshes,
+              batchedVisible, batchedCullTime);
+      fclose(fp);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void Castle::WriteGLExtensionReport()
+{
+   FILE *fp = fopen("GLExtensions.txt", "w");
+
+   if (fp == NULL)
+   {
+      return;
+   }
+   if (!GLeeGetLazyLinking())
+   {
+      fprintf(fp, "eager linking: every supported extension linked\n");
+      fclose(fp);
+      return;
+   }
+   int numUsed = GLeeGetUsedExtensionCount();
+   fprintf(fp, "lazy linking: %d extensions used, %d functions resolved\n",
+           numUsed, GLeeGetLazyLinkedCount());
+   for (int i = 0; i < numUsed; ++i)
+   {
+      fprintf(fp, "%s\n", GLeeGetUsedExtension(i));
+   }
+   fclose(fp);
+}
+
+
+//----------------------------------------------------------------------------
+float Castle::TimeCulling(int& numVisible)
+{
+   const int numTrials = 100;
+
+   std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+   for (int i = 0; i < numTrials; ++i)
+   {
+      mCuller.ComputeVisibleSet(mScene);
+   }
+   std::chrono::duration<float, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+   numVisible = mCuller.GetVisibleSet().GetNumVisible();
+   return(elapsed.count() / numTrials);
 }
 
 
@@ -1012,220 +1241,75 @@ void Castle::CreateEffects()
 
 
 //----------------------------------------------------------------------------
-void Castle::CreateTextures()
+const Castle::TextureFile Castle::msTextureFiles[] =
 {
-   std::string name = Environment::GetPathR("outwall03.wmtf");
-
-   mOutWall = Texture2D::LoadWMTF(name);
-   mOutWall->GenerateMipmaps();
-
-   name   = Environment::GetPathR("stone01.wmtf");
-   mStone = Texture2D::LoadWMTF(name);
-   mStone->GenerateMipmaps();
-
-   name   = Environment::GetPathR("river01.wmtf");
-   mRiver = Texture2D::LoadWMTF(name);
-   mRiver->GenerateMipmaps();
-
-   name  = Environment::GetPathR("wall02.wmtf");
-   mWall = Texture2D::LoadWMTF(name);
-   mWall->GenerateMipmaps();
-
-   name          = Environment::GetPathR("walllightmap.wmtf");
-   mWallLightMap = Texture2D::LoadWMTF(name);
-   mWallLightMap->GenerateMipmaps();
-
-   name   = Environment::GetPathR("steps.wmtf");
-   mSteps = Texture2D::LoadWMTF(name);
-   mSteps->GenerateMipmaps();
-
-   name  = Environment::GetPathR("door.wmtf");
-   mDoor = Texture2D::LoadWMTF(name);
-   mDoor->GenerateMipmaps();
-
-   name   = Environment::GetPathR("floor02.wmtf");
-   mFloor = Texture2D::LoadWMTF(name);
-   mFloor->GenerateMipmaps();
-
-   name         = Environment::GetPathR("woodceiling.wmtf");
-   mWoodCeiling = Texture2D::LoadWMTF(name);
-   mWoodCeiling->GenerateMipmaps();
-
-   name      = Environment::GetPathR("keystone.wmtf");
-   mKeystone = Texture2D::LoadWMTF(name);
-   mKeystone->GenerateMipmaps();
-
-   name        = Environment::GetPathR("tileplanks.wmtf");
-   mTilePlanks = Texture2D::LoadWMTF(name);
-   mTilePlanks->GenerateMipmaps();
-
-   name  = Environment::GetPathR("rooftemp.wmtf");
-   mRoof = Texture2D::LoadWMTF(name);
-   mRoof->GenerateMipmaps();
-
-   name  = Environment::GetPathR("ramp03.wmtf");
-   mRamp = Texture2D::LoadWMTF(name);
-   mRamp->GenerateMipmaps();
-
-   name    = Environment::GetPathR("shield01.wmtf");
-   mShield = Texture2D::LoadWMTF(name);
-   mShield->GenerateMipmaps();
-
-   name   = Environment::GetPathR("metal01.wmtf");
-   mMetal = Texture2D::LoadWMTF(name);
-   mMetal->GenerateMipmaps();
-
-   name       = Environment::GetPathR("torchwood.wmtf");
-   mTorchWood = Texture2D::LoadWMTF(name);
-   mTorchWood->GenerateMipmaps();
-
-   name       = Environment::GetPathR("torchhead.wmtf");
-   mTorchHead = Texture2D::LoadWMTF(name);
-   mTorchHead->GenerateMipmaps();
-
-   name        = Environment::GetPathR("barrelbase.wmtf");
-   mBarrelBase = Texture2D::LoadWMTF(name);
-   mBarrelBase->GenerateMipmaps();
+   { "outwall03.wmtf",        &Castle::mOutWall },
+   { "stone01.wmtf",          &Castle::mStone },
+   { "river01.wmtf",          &Castle::mRiver },
+   { "wall02.wmtf",           &Castle::mWall },
+   { "walllightmap.wmtf",     &Castle::mWallLightMap },
+   { "steps.wmtf",            &Castle::mSteps },
+   { "door.wmtf",             &Castle::mDoor },
+   { "floor02.wmtf",          &Castle::mFloor },
+   { "woodceiling.wmtf",      &Castle::mWoodCeiling },
+   { "keystone.wmtf",         &Castle::mKeystone },
+   { "tileplanks.wmtf",       &Castle::mTilePlanks },
+   { "rooftemp.wmtf",         &Castle::mRoof },
+   { "ramp03.wmtf",           &Castle::mRamp },
+   { "shield01.wmtf",         &Castle::mShield },
+   { "metal01.wmtf",          &Castle::mMetal },
+   { "torchwood.wmtf",        &Castle::mTorchWood },
+   { "torchhead.wmtf",        &Castle::mTorchHead },
+   { "barrelbase.wmtf",       &Castle::mBarrelBase },
+   { "barrel.wmtf",           &Castle::mBarrel },
+   { "doorframe.wmtf",        &Castle::mDoorFrame },
+   { "bunkwood.wmtf",         &Castle::mBunkwood },
+   { "blanket.wmtf",          &Castle::mBlanket },
+   { "chest01.wmtf",          &Castle::mChest },
+   { "rope.wmtf",             &Castle::mRope },
+   { "mug.wmtf",              &Castle::mMug },
+   { "port.wmtf",             &Castle::mPort },
+   { "skyline.wmtf",          &Castle::mSky },
+   { "river02.wmtf",          &Castle::mWater },
+   { "gravel01.wmtf",         &Castle::mGravel1 },
+   { "gravel02.wmtf",         &Castle::mGravel2 },
+   { "gravel_corner_se.wmtf", &Castle::mGravelCornerSE },
+   { "gravel_corner_ne.wmtf", &Castle::mGravelCornerNE },
+   { "gravel_corner_nw.wmtf", &Castle::mGravelCornerNW },
+   { "gravel_corner_sw.wmtf", &Castle::mGravelCornerSW },
+   { "stone02.wmtf",          &Castle::mStone2 },
+   { "stone03.wmtf",          &Castle::mStone3 },
+   { "gravel_cap_ne.wmtf",    &Castle::mGravelCapNE },
+   { "gravel_cap_nw.wmtf",    &Castle::mGravelCapNW },
+   { "gravel_side_s.wmtf",    &Castle::mGravelSideS },
+   { "gravel_side_n.wmtf",    &Castle::mGravelSideN },
+   { "gravel_side_w.wmtf",    &Castle::mGravelSideW },
+   { "largestone01.wmtf",     &Castle::mLargeStone1 },
+   { "largerstone01.wmtf",    &Castle::mLargerStone1 },
+   { "largerstone02.wmtf",    &Castle::mLargerStone2 },
+   { "largeststone01.wmtf",   &Castle::mLargestStone1 },
+   { "largeststone02.wmtf",   &Castle::mLargestStone2 },
+   { "hugestone01.wmtf",      &Castle::mHugeStone1 },
+   { "hugestone02.wmtf",      &Castle::mHugeStone2 },
+   { NULL,                    NULL }
+};
 
-   name    = Environment::GetPathR("barrel.wmtf");
-   mBarrel = Texture2D::LoadWMTF(name);
-   mBarrel->GenerateMipmaps();
 
-   name       = Environment::GetPathR("doorframe.wmtf");
-   mDoorFrame = Texture2D::LoadWMTF(name);
-   mDoorFrame->GenerateMipmaps();
-
-   name      = Environment::GetPathR("bunkwood.wmtf");
-   mBunkwood = Texture2D::LoadWMTF(name);
-   mBunkwood->GenerateMipmaps();
-
-   name     = Environment::GetPathR("blanket.wmtf");
-   mBlanket = Texture2D::LoadWMTF(name);
-   mBlanket->GenerateMipmaps();
-
-   mBench      = mBunkwood;
-   mTable      = mBunkwood;
-   mBarrelRack = mTilePlanks;
-
-   name   = Environment::GetPathR("chest01.wmtf");
-   mChest = Texture2D::LoadWMTF(name);
-   mChest->GenerateMipmaps();
-
-   mLightwood = mTilePlanks;
-
-   name  = Environment::GetPathR("rope.wmtf");
-   mRope = Texture2D::LoadWMTF(name);
-   mRope->GenerateMipmaps();
+//----------------------------------------------------------------------------
+void Castle::CreateTextures()
+{
+   for (int i = 0; msTextureFiles[i].Name != NULL; ++i)
+   {
+      this->*msTextureFiles[i].Texture = LoadTexture(msTextureFiles[i].Name);
+   }
 
+   mBench       = mBunkwood;
+   mTable       = mBunkwood;
+   mBarrelRack  = mTilePlanks;
+   mLightwood   = mTilePlanks;
    mSquareTable = mTilePlanks;
    mSimpleChair = mTilePlanks;
-
-   name = Environment::GetPathR("mug.wmtf");
-   mMug = Texture2D::LoadWMTF(name);
-   mMug->GenerateMipmaps();
-
-   name  = Environment::GetPathR("port.wmtf");
-   mPort = Texture2D::LoadWMTF(name);
-   mPort->GenerateMipmaps();
-
-   name = Environment::GetPathR("skyline.wmtf");
-   mSky = Texture2D::LoadWMTF(name);
-   mSky->GenerateMipmaps();
-
-   name   = Environment::GetPathR("river02.wmtf");
-   mWater = Texture2D::LoadWMTF(name);
-   mWater->GenerateMipmaps();
-
-   // TERRAIN
-   name     = Environment::GetPathR("gravel01.wmtf");
-   mGravel1 = Texture2D::LoadWMTF(name);
-   mGravel1->GenerateMipmaps();
-
-   name     = Environment::GetPathR("gravel02.wmtf");
-   mGravel2 = Texture2D::LoadWMTF(name);
-   mGravel2->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_se.wmtf");
-   mGravelCornerSE = Texture2D::LoadWMTF(name);
-   mGravelCornerSE->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_ne.wmtf");
-   mGravelCornerNE = Texture2D::LoadWMTF(name);
-   mGravelCornerNE->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_nw.wmtf");
-   mGravelCornerNW = Texture2D::LoadWMTF(name);
-   mGravelCornerNW->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_sw.wmtf");
-   mGravelCornerSW = Texture2D::LoadWMTF(name);
-   mGravelCornerSW->GenerateMipmaps();
-
-   mStone1 = mStone;
-
-   name    = Environment::GetPathR("stone02.wmtf");
-   mStone2 = Texture2D::LoadWMTF(name);
-   mStone2->GenerateMipmaps();
-
-   name    = Environment::GetPathR("stone03.wmtf");
-   mStone3 = Texture2D::LoadWMTF(name);
-   mStone3->GenerateMipmaps();
-
-   name         = Environment::GetPathR("gravel_cap_ne.wmtf");
-   mGravelCapNE = Texture2D::LoadWMTF(name);
-   mGravelCapNE->GenerateMipmaps();
-
-   name         = Environment::GetPathR("gravel_cap_nw.wmtf");
-   mGravelCapNW = Texture2D::LoadWMTF(name);
-   mGravelCapNW->GenerateMipmaps();
-
-   name         = Environment::GetPathR("gravel_side_s.wmtf");
-   mGravelSideS = Texture2D::LoadWMTF(name);
-   mGravelSideS->GenerateMipmaps();
-
-   name         = Environment::GetPathR("gravel_side_n.wmtf");
-   mGravelSideN = Texture2D::LoadWMTF(name);
-   mGravelSideN->GenerateMipmaps();
-
-   name         = Environment::GetPathR("gravel_side_w.wmtf");
-   mGravelSideW = Texture2D::LoadWMTF(name);
-   mGravelSideW->GenerateMipmaps();
-
-   name         = Environment::GetPathR("largestone01.wmtf");
-   mLargeStone1 = Texture2D::LoadWMTF(name);
-   mLargeStone1->GenerateMipmaps();
-
-   name          = Environment::GetPathR("largerstone01.wmtf");
-   mLargerStone1 = Texture2D::LoadWMTF(name);
-   mLargerStone1->GenerateMipmaps();
-
-   name          = Environment::GetPathR("largerstone02.wmtf");
-   mLargerStone2 = Texture2D::LoadWMTF(name);
-   mLargerStone2->GenerateMipmaps();
-
-   name           = Environment::GetPathR("largeststone01.wmtf");
-   mLargestStone1 = Texture2D::LoadWMTF(name);
-   mLargestStone1->GenerateMipmaps();
-
-   name           = Environment::GetPathR("largeststone02.wmtf");
-   mLargestStone2 = Texture2D::LoadWMTF(name);
-   mLargestStone2->GenerateMipmaps();
-
-   name        = Environment::GetPathR("hugestone01.wmtf");
-   mHugeStone1 = Texture2D::LoadWMTF(name);
-   mHugeStone1->GenerateMipmaps();
-
-   name        = Environment::GetPathR("hugestone02.wmtf");
-   mHugeStone2 = Texture2D::LoadWMTF(name);
-   mHugeStone2->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_nw.wmtf");
-   mGravelCornerNW = Texture2D::LoadWMTF(name);
-   mGravelCornerNW->GenerateMipmaps();
-
-   name            = Environment::GetPathR("gravel_corner_sw.wmtf");
-   mGravelCornerSW = Texture2D::LoadWMTF(name);
-   mGravelCornerSW->GenerateMipmaps();
+   mStone1      = mStone;
 }
 
 
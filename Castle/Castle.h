@@ -6,6 +6,9 @@
 #include "Wm5WindowApplication3.h"
 #include "DLitMatTexEffect.h"
 #include "SpanTracker.h"
+#include "AssetLoader.h"
+#include "StaticBatcher.h"
+#include "RayCaster.h"
 using namespace Wm5;
 
 class Castle : public WindowApplication3
@@ -39,6 +42,43 @@ private:
    void CreateTextures();
    void CreateSharedMeshes();
 
+   // Textures and geometry files are loaded on worker threads while the
+   // scene is built; the load times are written to AssetLoads.txt.
+   void RequestAssets();
+
+   struct TextureFile
+   {
+      const char   *Name;
+      Texture2DPtr Castle::*Texture;
+   };
+   static const TextureFile msTextureFiles[];
+
+   struct MeshFile
+   {
+      const char *Name;
+      int        NumTCoords;
+      bool       Multi;
+   };
+   static const MeshFile msMeshFiles[];
+
+   AssetLoader *mAssets;
+
+   // The props (shields, torches, barrels, furniture, ...) never move, so
+   // those drawn with the texture effect are merged into a few batches.
+   // Culling and draw statistics are written to StaticBatches.txt.
+   void BatchStaticProps();
+   float TimeCulling(int& numVisible);
+
+   NodePtr       mProps;
+   StaticBatcher mBatcher;
+
+   // The GUI's GL extension entry points are resolved on first call; after
+   // the first frame the extensions actually used are written to
+   // GLExtensions.txt.
+   void WriteGLExtensionReport();
+
+   bool mGLExtensionReported;
+
    Float4       mTextColor;
    NodePtr      mScene, mTrnNode;
    WireStatePtr mWireState;
@@ -188,14 +228,22 @@ private:
    // information.
    bool AllowMotion(float sign);
 
-   char   mPickMessage[1024];
-   Picker mPicker;
+   char      mPickMessage[1024];
+   Picker    mPicker;
+   RayCaster mRayCaster;
    int    mNumRays;
    float  mHalfAngle;
    float  *mCos;
    float  *mSin;
    float  *mTolerance;
 
+   // Time the ray caster against Picker on rays fanned around the camera.
+   void BenchmarkRayCast();
+
+   // Save the ray caster's triangles and the camera for headless
+   // SpanTracker runs (benchmarks/SpanTrackBatch).
+   void SaveCollisionGeometry();
+
    // Arrange for the camera to be a fixed distance above the nearest object.
    void AdjustVerticalDistance();
 
@@ -216,34 +264,14 @@ private:
 
 private:
    // Support for loading data sets.
-   class VertexPNT1
-   {
-public:
-      VertexPNT1();
-      bool operator<(const VertexPNT1& vertex) const;
-
-      int PIndex, NIndex, TIndex;
-   };
-
-   class VertexPNT2
-   {
-public:
-      VertexPNT2();
-      bool operator<(const VertexPNT2& vertex) const;
-
-      int PIndex, NIndex, T0Index, T1Index;
-   };
-
+   Texture2D *LoadTexture(const std::string& name);
    TriMesh *LoadMeshPNT1(const std::string& name);
    TriMesh *LoadMeshPNT2(const std::string& name);
 
    std::vector<TriMesh *> LoadMeshPNT1Multi(const std::string& name);
 
-   void GetFloat3(std::ifstream& inFile, int& numElements,
-                  Float3 *& elements);
-
-   void GetFloat2(std::ifstream& inFile, int& numElements,
-                  Float2 *& elements);
+   std::vector<TriMesh *> LoadMeshes(const std::string& name,
+                                     int numTCoords, bool multi);
 
 private:
    // The list of exported objects.
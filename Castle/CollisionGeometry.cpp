@@ -0,0 +1,111 @@
+// Collision geometry.
+
+#include "CollisionGeometry.h"
+#include <stdio.h>
+#include <string.h>
+
+// File identification.
+const char CollisionGeometry::MAGIC[4] = { 'C', 'C', 'O', 'L' };
+const int  CollisionGeometry::VERSION  = 1;
+
+// Camera frame and motion settings, in file order.
+namespace
+{
+enum { NUM_SETTINGS = 15 };
+}
+
+//----------------------------------------------------------------------------
+CollisionGeometry::CollisionGeometry()
+   :
+     TrnSpeed(0.0f),
+     RotSpeed(0.0f),
+     VerticalDistance(0.0f)
+{
+   memset(Position, 0, sizeof(Position));
+   memset(DVector, 0, sizeof(DVector));
+   memset(UVector, 0, sizeof(UVector));
+   memset(RVector, 0, sizeof(RVector));
+}
+
+
+//----------------------------------------------------------------------------
+bool CollisionGeometry::Save(const std::string& filename) const
+{
+   FILE *fp = fopen(filename.c_str(), "wb");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   int   numTriangles = (int)Triangles.size() / 9;
+   float settings[NUM_SETTINGS];
+   memcpy(settings, Position, sizeof(Position));
+   memcpy(settings + 3, DVector, sizeof(DVector));
+   memcpy(settings + 6, UVector, sizeof(UVector));
+   memcpy(settings + 9, RVector, sizeof(RVector));
+   settings[12] = TrnSpeed;
+   settings[13] = RotSpeed;
+   settings[14] = VerticalDistance;
+   bool ok = true;
+   ok = ok && (fwrite(MAGIC, 4, 1, fp) == 1);
+   ok = ok && (fwrite(&VERSION, sizeof(int), 1, fp) == 1);
+   ok = ok && (fwrite(&numTriangles, sizeof(int), 1, fp) == 1);
+   ok = ok && (fwrite(settings, sizeof(settings), 1, fp) == 1);
+   if (numTriangles > 0)
+   {
+      ok = ok && (fwrite(&Triangles[0], 9 * sizeof(float), numTriangles, fp) ==
+                  (size_t)numTriangles);
+   }
+   if ((fclose(fp) != 0) || !ok)
+   {
+      remove(filename.c_str());
+      return(false);
+   }
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+bool CollisionGeometry::Load(const std::string& filename)
+{
+   FILE *fp = fopen(filename.c_str(), "rb");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   char  magic[4];
+   int   version, numTriangles;
+   float settings[NUM_SETTINGS];
+   bool  ok = true;
+   ok = ok && (fread(magic, 4, 1, fp) == 1);
+   ok = ok && (memcmp(magic, MAGIC, 4) == 0);
+   ok = ok && (fread(&version, sizeof(int), 1, fp) == 1);
+   ok = ok && (version == VERSION);
+   ok = ok && (fread(&numTriangles, sizeof(int), 1, fp) == 1);
+   ok = ok && (numTriangles >= 0);
+   ok = ok && (fread(settings, sizeof(settings), 1, fp) == 1);
+   if (ok)
+   {
+      Triangles.resize(9 * numTriangles);
+      if (numTriangles > 0)
+      {
+         ok = (fread(&Triangles[0], 9 * sizeof(float), numTriangles, fp) ==
+               (size_t)numTriangles);
+      }
+   }
+   fclose(fp);
+   if (!ok)
+   {
+      Triangles.clear();
+      return(false);
+   }
+   memcpy(Position, settings, sizeof(Position));
+   memcpy(DVector, settings + 3, sizeof(DVector));
+   memcpy(UVector, settings + 6, sizeof(UVector));
+   memcpy(RVector, settings + 9, sizeof(RVector));
+   TrnSpeed         = settings[12];
+   RotSpeed         = settings[13];
+   VerticalDistance = settings[14];
+   return(true);
+}
@@ -0,0 +1,44 @@
+// Collision geometry.
+// A snapshot of what the Castle demo casts rays against: every scene
+// triangle in world space, with the camera frame and motion settings at
+// the time of the snapshot, so that SpanTracker measurements can be run
+// without loading the scene, its textures or a renderer.
+//
+// File layout: magic "CCOL", version, number of triangles, the camera
+// position and D, U, R vectors, the translation speed, rotation speed and
+// vertical distance, then nine floats (three vertices) per triangle.
+
+#ifndef COLLISION_GEOMETRY_H
+#define COLLISION_GEOMETRY_H
+
+#include <string>
+#include <vector>
+
+class CollisionGeometry
+{
+public:
+
+   CollisionGeometry();
+
+   bool Save(const std::string& filename) const;
+   bool Load(const std::string& filename);
+
+   std::vector<float> Triangles;
+
+   // Camera frame, as WindowApplication3 keeps it.
+   float Position[3];
+   float DVector[3];
+   float UVector[3];
+   float RVector[3];
+
+   // Castle motion settings.
+   float TrnSpeed;
+   float RotSpeed;
+   float VerticalDistance;
+
+private:
+
+   static const char MAGIC[4];
+   static const int  VERSION;
+};
+#endif
@@ -229,7 +229,7 @@ class GUIFont : public NamedObject
     bool operator ==(const GUIFont &compare);
     bool operator !=(const GUIFont &compare);
 
-    bool loadXMLSettings(const TiXmlElement *node);
+    bool loadXMLSettings(const CompiledXMLElement *node);
     bool build();
 
   private:
@@ -251,7 +251,7 @@ class GUIText
     GUIText &operator =(const GUIText     &text);
     GUIText &operator =(const std::string &text);
 
-    virtual bool loadXMLSettings(const TiXmlElement *node);
+    virtual bool loadXMLSettings(const CompiledXMLElement *node);
 
     void  computeDimensions();
     void  printCenteredXY(int x, int y, int startIndex = 0, int endIndex = -1);
@@ -298,6 +298,18 @@ class GUIText
     Tuple3f     color;
     bool        update;
     int         fontIndex;
+
+  private:
+    void        invalidateVertices();
+
+    // Glyph quads of the last print, rebuilt when the string, its bounds,
+    // color, scales or font change
+    std::vector<float> vertices;
+    Tuple2i            verticesPosition;
+    int                verticesStart,
+                       verticesEnd;
+    CFont             *verticesFont;
+    bool               verticesValid;
 };
 
 /**********************************************************************************/
@@ -309,7 +321,7 @@ class GUIText
 class GUIFontManager
 {
   public:
-    static int      addFont(const TiXmlElement *fontNodex);
+    static int      addFont(const CompiledXMLElement *fontNodex);
     static int      findFontIndex(GUIFont *font);
     static GUIFont *getFont(size_t index);
 
@@ -322,6 +334,10 @@ class GUIFontManager
     static GUIFont *getDefaultFont();
     static int      getCharacterWidth(char Char, GUIFont *font);
     static int      getCharacterWidth(char Char, int      index);
+
+    // Draws the text queued by GUIText::print since the last flush, one
+    // batch per font; returns the number of draw calls
+    static int      flushText();
    
     static void     clear();
 
@@ -361,7 +377,7 @@ class GUITexCoordDescriptor
     static int getTextureWidth();
     static int getTextureHeight();
 
-    void loadXMLSettings(const TiXmlElement *element);
+    void loadXMLSettings(const CompiledXMLElement *element);
     void setType(int type);
     int  getType();
 
@@ -371,6 +387,99 @@ class GUITexCoordDescriptor
     const Tuple4f &getTexCoords();
 };
 
+/**********************************************************************************/
+/*class GUIGeometry                                                               */
+/*                                                                                */
+/*Primitives recorded by one element, in recording order. getBatch appends to     */
+/*the last batch when it has the same mode and texture and starts a new one when  */
+/*the state changes, so batches draw back to front like immediate mode did.       */
+/**********************************************************************************/
+
+typedef struct
+{
+  float s, t,
+        r, g, b, a,
+        x, y;
+} GUIVertex;
+
+typedef struct
+{
+  GLenum            mode;
+  Texture          *texture;
+  vector<GUIVertex> vertices;
+} GUIBatch;
+
+typedef vector<GUIBatch> GUIBatches;
+
+class GUIGeometry
+{
+  public:
+    GUIGeometry();
+
+    void  clear();
+    void  addQuad(const Tuple4i &bounds, const Tuple4f &color,
+                  Texture *texture = NULL, const Tuple4f *texCoords = NULL);
+    void  addFan(const Tuple2i *vertices, int count, const Tuple4f &color,
+                 Texture *texture = NULL, const Tuple2f *texCoords = NULL);
+    void  addLines(const Tuple2i *vertices, int count, const Tuple4f &color,
+                   bool strip = false);
+    int   draw() const;
+
+    const GUIBatches &getBatches() const;
+    unsigned int      getVersion() const;
+
+    static GUIBatch &getBatch(GUIBatches &batches, GLenum mode, Texture *texture);
+    static int       drawBatches(const GUIBatches &batches);
+
+  private:
+    GUIBatches   batches;
+    unsigned int version;
+};
+
+/**********************************************************************************/
+/*class GUIVertexBuffer                                                           */
+/*                                                                                */
+/*A frame's retained geometry. Elements submit their GUIGeometry in render order; */
+/*each flush concatenates the batches of the submissions since the previous one,  */
+/*merging neighbours that share mode and texture, reuses last frame's batches     */
+/*when no submission changed, draws them in order and then the queued text. When  */
+/*not retained, submissions are drawn at once.                                    */
+/**********************************************************************************/
+
+class GUIVertexBuffer
+{
+  public:
+    GUIVertexBuffer();
+
+    void  begin();
+    void  submit(const GUIGeometry &geometry);
+    void  flush();
+    void  end();
+    void  clear();
+
+    void  setRetained(bool retained);
+    bool  isRetained() const;
+
+    int   getRebuiltCount() const;
+    int   getDrawCallCount() const;
+
+  private:
+    typedef std::pair<const GUIGeometry *, unsigned int> Submission;
+    typedef struct
+    {
+      vector<Submission> submissions;
+      GUIBatches         batches;
+    } Segment;
+
+    vector<Segment> segments;
+    size_t          segmentIndex,
+                    submissionIndex;
+    bool            segmentChanged,
+                    retained;
+    int             rebuiltCount,
+                    drawCallCount;
+};
+
 /**********************************************************************************/
 /*class GUIRectangle                                                              */
 /*                                                                                */
@@ -402,6 +511,16 @@ class GUIRectangle
                   anchor,
                   z;
 
+    // Retained rendering: geometry is re-recorded only when the element is
+    // marked dirty or its bounds moved
+    GUIGeometry   geometry;
+    Tuple4i       recordedBounds;
+    bool          dirty;
+
+    bool          rebuildGeometry(bool force = false);
+    void          submitGeometry();
+    void          flushGeometry();
+
   public:
     GUIRectangle(const std::string &callback = "");
     virtual ~GUIRectangle(){};
@@ -409,7 +528,7 @@ class GUIRectangle
     void               setCallbackString(const std::string& callback);
     const std::string &getCallbackString();
 
-    bool     loadXMLSettings(const TiXmlElement *node);
+    bool     loadXMLSettings(const CompiledXMLElement *node);
 
     void     setDimensions(float width, float height);
     void     setDimensions(const Tuple2f &dimensions);
@@ -447,6 +566,8 @@ class GUIRectangle
 
     virtual  GUITexCoordDescriptor *getTexCoordsInfo(int type);
     virtual  GUIEventListener      *getEventsListener();
+    virtual  GUIVertexBuffer       *getVertexBuffer();
+    virtual  Texture               *getGUITexture();
 
     virtual void  enableGUITexture();
     virtual void  disableGUITexture();
@@ -489,7 +610,8 @@ class GUIClippedRectangle
     Tuple3f  bordersColor;
     Tuple2i  vertices[7];
     bool     drawBackground,
-             drawBounds;
+             drawBounds,
+             modified;
     int      clipSize;
 
   public:
@@ -523,7 +645,8 @@ class GUIClippedRectangle
     void     setTexture(const Texture & texture);
 
     virtual void renderClippedBounds();
-    virtual bool loadXMLClippedRectangleInfo(const TiXmlElement *element);
+    virtual void recordClippedBounds(GUIGeometry &geometry, int offset = 0);
+    virtual bool loadXMLClippedRectangleInfo(const CompiledXMLElement *element);
 };
 
 /**********************************************************************************/
@@ -536,7 +659,7 @@ class GUISeparator : public GUIRectangle
 {
   public:
     GUISeparator(int orientation = OR_HORIZONTAL);
-    virtual bool loadXMLSettings(const TiXmlElement *element);
+    virtual bool loadXMLSettings(const CompiledXMLElement *element);
     virtual void checkMouseEvents(MouseEvent  &evt, int extraInfo){};
     virtual void checkKeyboardEvents(KeyEvent evt, int extraInfo){};
     virtual void render(float);
@@ -574,7 +697,7 @@ class GUIAlphaElement : public GUIRectangle
     GUIAlphaElement(const std::string &callback = "");
 
     virtual void render(float clockTick) = 0;
-    virtual bool loadXMLSettings(const TiXmlElement *node);
+    virtual bool loadXMLSettings(const CompiledXMLElement *node);
 
     void  setMinAlpha(float minAlpha);
     float getMinAlpha();
@@ -608,7 +731,7 @@ class GUILabel : public GUIAlphaElement
              const std::string &callbackString = "");
 
     virtual void  render(float clockTick);
-    virtual bool  loadXMLSettings(const TiXmlElement *element);
+    virtual bool  loadXMLSettings(const CompiledXMLElement *element);
     virtual const Tuple4i &getWindowBounds();
 };
 
@@ -627,7 +750,7 @@ class GUITextBox : public GUIAlphaElement
     virtual void    render(float clockTick);
     virtual void    checkMouseEvents(MouseEvent &evt, int extraInfo, bool reservedBits = false);
     virtual void    checkKeyboardEvents(KeyEvent evt, int extraInfo);
-    virtual bool    loadXMLSettings(const TiXmlElement *node);
+    virtual bool    loadXMLSettings(const CompiledXMLElement *node);
     virtual const   Tuple4i &getWindowBounds();
     void            setText(const std::string &text);
     const   std::string &getText() const;
@@ -648,6 +771,7 @@ class GUITextBox : public GUIAlphaElement
             textColor;
     float   blinkerTimer;
     size_t  blinkerPosition,
+            recordedBlinker,
             textStartIndex,
             textEndIndex;
     bool    blinkerOn;
@@ -669,7 +793,7 @@ class GUIButton : public GUIAlphaElement, public GUIClippedRectangle
     GUIButton(const std::string &callback = "");
 
     virtual void  render(float clockTick);
-    virtual bool  loadXMLSettings(const TiXmlElement *node);
+    virtual bool  loadXMLSettings(const CompiledXMLElement *node);
     virtual const void computeWindowBounds();
 
     void enableBounce(bool bounce);
@@ -677,6 +801,7 @@ class GUIButton : public GUIAlphaElement, public GUIClippedRectangle
 
   private:
     bool bounce;
+    int  displacement;
 };
 
 /**********************************************************************************/
@@ -692,7 +817,7 @@ class GUICheckBox : public GUIAlphaElement
 
     virtual void render(float clockTick);
     virtual void checkMouseEvents(MouseEvent &evt, int extraInfo, bool reservedBits = false);
-    virtual bool loadXMLSettings(const TiXmlElement *node);
+    virtual bool loadXMLSettings(const CompiledXMLElement *node);
     virtual void setChecked(bool enabled);
 
     void  setAlphaMark(float mark);
@@ -747,7 +872,7 @@ class GUISlider : public GUIAlphaElement
 
     virtual const Tuple4i &getWindowBounds();
     virtual void  checkMouseEvents(MouseEvent &evt, int extreaInfo, bool reservedBits = false);
-    virtual bool  loadXMLSettings(const TiXmlElement *element);
+    virtual bool  loadXMLSettings(const CompiledXMLElement *element);
     virtual void  render(float clockTick);
 
     float getProgress();
@@ -804,7 +929,7 @@ class GUIPanel : public GUIRectangle,
     int   getTreeHeight();
 
     virtual bool  loadXMLSettings(const char *stackPath);
-    virtual bool  loadXMLSettings(const TiXmlElement *element);
+    virtual bool  loadXMLSettings(const CompiledXMLElement *element);
 
     virtual void  notify(GUIRectangle *element);
     virtual void  checkMouseEvents(MouseEvent  &evt, int extraInfo, bool bitInfo = false);
@@ -833,13 +958,14 @@ class GUIFrame : public GUIPanel
     GUIEventListener   *listener;
     GUITexCoordsInfo    texCoords;
     Texture             elementsTexture;
+    GUIVertexBuffer     vertexBuffer;
     Tuple2i             windowSize;
     int                 updateCount;
   public:
     GUIFrame();
    ~GUIFrame();
 
-    virtual bool  loadXMLSettings(const TiXmlElement *element);
+    virtual bool  loadXMLSettings(const CompiledXMLElement *element);
 
     void     addOrReplaceTexCoordsInfo(GUITexCoordDescriptor &info);
     void     setElementsTexture(const char* texturePath);
@@ -849,6 +975,15 @@ class GUIFrame : public GUIPanel
 
     virtual GUITexCoordDescriptor *getTexCoordsInfo(int type);
     virtual GUIEventListener      *getEventsListener();
+    virtual GUIVertexBuffer       *getVertexBuffer();
+    virtual Texture               *getGUITexture();
+
+    // Retained mode (the default) keeps the elements' geometry in one vertex
+    // buffer; the counts are for the last rendered frame
+    void  setRetained(bool retained);
+    bool  isRetained();
+    int   getRebuiltCount();
+    int   getDrawCallCount();
 
     virtual const Tuple4i &getWindowBounds();
     virtual void  forceUpdate(bool update);
@@ -872,7 +1007,7 @@ class GUIComboBox : public GUIRectangle, public GUIEventListener
 
     virtual GUIEventListener  *getEventsListener();
     virtual const void         computeWindowBounds();
-    virtual bool               loadXMLSettings(const TiXmlElement *node);
+    virtual bool               loadXMLSettings(const CompiledXMLElement *node);
     virtual void               render(float clockTick);
     virtual void               checkMouseEvents(MouseEvent &evt, int extraInfo, bool reservedBits = false);
     virtual void               actionPerformed(GUIEvent &evt);
@@ -935,7 +1070,7 @@ class GUITabbedPanel : public GUIRectangle, public GUIEventListener
 
     virtual GUIEventListener  *getEventsListener();
     virtual const void         computeWindowBounds();
-    virtual bool               loadXMLSettings(const TiXmlElement *node);
+    virtual bool               loadXMLSettings(const CompiledXMLElement *node);
     virtual void               render(float clockTick);
     virtual void               checkMouseEvents(MouseEvent &evt, int extraInfo, bool reservedBits = false);
     virtual void               checkKeyboardEvents(KeyEvent evt, int extraInfo);
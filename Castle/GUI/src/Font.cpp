@@ -11,7 +11,9 @@ CFont::CFont()
 {
   fontBaseRange = 0;
   fontHeight    = 0;
-  memset(spaces, 0, 256);
+  glyphHeight   = 0;
+  memset(spaces, 0, sizeof(spaces));
+  memset(glyphCoords, 0, sizeof(glyphCoords));
 }
 
 CFont::~CFont()
@@ -100,7 +102,12 @@ bool CFont::load(const char* fontPath)
       float t = (float)y / 16.0f;
       float ds = (float)spaces[i] / (float)size;
       float dt = 1.0f/ 16.0;
-  
+
+      glyphCoords[i][0] = s;
+      glyphCoords[i][1] = t;
+      glyphCoords[i][2] = ds;
+      glyphCoords[i][3] = dt;
+
       glNewList(fontBaseRange + i,GL_COMPILE);
       glBegin(GL_TRIANGLE_STRIP);
       glTexCoord2f(s + ds,t + dt); glVertex2i(spaces[i],step);
@@ -113,7 +120,8 @@ bool CFont::load(const char* fontPath)
     }
   }
   fontTexture.deactivate();
-  fontHeight = height/16;
+  glyphHeight = float(step);
+  fontHeight  = height/16;
   return true;
 }
 
@@ -243,5 +251,77 @@ void CFont::printSubString(float xPosition,  float yPosition,
   glColor3f(1,1,1);
 }
 
+void CFont::buildVertices(std::vector<float> &vertices,
+                          float xPosition,  float yPosition,
+                          float width,      float height,
+                          float r, float g, float b,
+                          int   start, int end,
+                          const std::string &string)
+{
+  if(start >= end || int(string.size()) < end)
+    return;
+
+  float x  = xPosition,
+        y0 = yPosition,
+        y1 = yPosition + glyphHeight*height;
+
+  vertices.reserve(vertices.size() + (end - start)*32);
+
+  for(int i = start; i < end; i++)
+  {
+    unsigned char c = (unsigned char)string[i];
+    if(c == '\n')
+    {
+      x   = xPosition;
+      y0 += fontHeight;
+      y1 += fontHeight;
+      continue;
+    }
+
+    const float *coords = glyphCoords[c];
+    float s0 = coords[0], s1 = coords[0] + coords[2],
+          t0 = coords[1], t1 = coords[1] + coords[3],
+          x1 = x + spaces[c]*width;
+    float quad[32] =
+    {
+      s0, t0, r, g, b, x , y0, 0,
+      s1, t0, r, g, b, x1, y0, 0,
+      s1, t1, r, g, b, x1, y1, 0,
+      s0, t1, r, g, b, x , y1, 0
+    };
+    vertices.insert(vertices.end(), quad, quad + 32);
+    x = x1;
+  }
+}
+
+void CFont::queue(const std::vector<float> &vertices)
+{
+  batch.insert(batch.end(), vertices.begin(), vertices.end());
+}
+
+bool CFont::flush()
+{
+  if(batch.empty() || !fontTexture.getID())
+  {
+    batch.clear();
+    return false;
+  }
+
+  fontTexture.activate();
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glInterleavedArrays(GL_T2F_C3F_V3F, 0, &batch[0]);
+  glDrawArrays(GL_QUADS, 0, GLsizei(batch.size()/8));
+  glPopClientAttrib();
+
+  glDisable(GL_BLEND);
+  fontTexture.deactivate();
+  glColor3f(1,1,1);
+  batch.clear();
+  return true;
+}
+
 const   int *CFont::getCharHorizontalGlyphs() const{ return spaces; }
 
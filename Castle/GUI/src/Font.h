@@ -8,6 +8,7 @@
 #define __FONT_H__
 
 #include "TextureUtils.h"
+#include <vector>
 
 class CFont
 {
@@ -31,7 +32,19 @@ class CFont
                         int   start, int end,
                         const std::string &string);
 
-    
+    // Batched path: buildVertices appends the glyph quads of string[start, end)
+    // to vertices as GL_T2F_C3F_V3F, starting a new line at each '\n'; queue
+    // adds them to this font's batch and flush draws the batch in one call,
+    // returning false when there was nothing to draw.
+    void buildVertices(std::vector<float> &vertices,
+                       float x,     float y,
+                       float width, float height,
+                       float r,     float g, float b,
+                       int   start, int end,
+                       const std::string &string);
+    void queue(const std::vector<float> &vertices);
+    bool flush();
+
     Tuple2i getStringDimensions(const std::string &string);
     bool    load(const char *fontPath);
     int     getMaxFittingLength(const std::string &string, int bounds);
@@ -43,6 +56,9 @@ class CFont
     int       spaces[256],
               fontHeight;
     GLint     fontBaseRange;
+    float     glyphCoords[256][4],
+              glyphHeight;
+    std::vector<float> batch;
 };
 
 #endif /* __FONT_H__ */
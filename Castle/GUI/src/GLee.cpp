@@ -63,6 +63,38 @@ void * __GLeeGetProcAddress(const char *extname)
 #endif
 }
 
+// Lazy linking. GLeeInit only reads the extension strings and sets the
+// querying variables; each entry point stays a trampoline which resolves
+// its own address on first call and caches it in the function pointer.
+// Turning it off links every supported extension in GLeeInit.
+
+#define GLEE_MAX_USED_EXTENSIONS 512
+
+GLboolean __GLeeLazyLinking=GL_TRUE;
+GLint __GLeeNumLazyLinked=0;
+const char * __GLeeUsedExtensions[GLEE_MAX_USED_EXTENSIONS];
+GLint __GLeeNumUsedExtensions=0;
+
+GLboolean __GLeeLazyLink(void ** function, const char * functionName, GLboolean * extensionQueryingVariable, const char * extensionName)
+{
+	void * address;
+	int i;
+	if (!__GLeeLazyLinking) return GLeeInit();
+	if (!__GLeeInited) GLeeInit();
+	if (!*extensionQueryingVariable) return GL_FALSE;
+	address=__GLeeGetProcAddress(functionName);
+	if (address==0) return GL_FALSE;
+	*function=address;
+	__GLeeNumLazyLinked++;
+	for (i=0;i<__GLeeNumUsedExtensions;i++)
+	{
+		if (strcmp(__GLeeUsedExtensions[i],extensionName)==0) return GL_TRUE;
+	}
+	if (__GLeeNumUsedExtensions<GLEE_MAX_USED_EXTENSIONS) 
+		__GLeeUsedExtensions[__GLeeNumUsedExtensions++]=extensionName;
+	return GL_TRUE;
+}
+
 
 
 // Extension querying variables
@@ -623,44 +655,44 @@ int __GLeeGLNumExtensions=273;
 //GL_VERSION_1_2
 
 #ifdef __GLEE_GL_VERSION_1_2
-void __stdcall _Lazy_glBlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)  {if (GLeeInit()) glBlendColor(red, green, blue, alpha);}
-void __stdcall _Lazy_glBlendEquation(GLenum mode)                                         {if (GLeeInit()) glBlendEquation(mode);}
-void __stdcall _Lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)  {if (GLeeInit()) glDrawRangeElements(mode, start, end, count, type, indices);}
-void __stdcall _Lazy_glColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (GLeeInit()) glColorTable(target, internalformat, width, format, type, table);}
-void __stdcall _Lazy_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glColorTableParameterfv(target, pname, params);}
-void __stdcall _Lazy_glColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glColorTableParameteriv(target, pname, params);}
-void __stdcall _Lazy_glCopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyColorTable(target, internalformat, x, y, width);}
-void __stdcall _Lazy_glGetColorTable(GLenum target, GLenum format, GLenum type, GLvoid * table)  {if (GLeeInit()) glGetColorTable(target, format, type, table);}
-void __stdcall _Lazy_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetColorTableParameterfv(target, pname, params);}
-void __stdcall _Lazy_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetColorTableParameteriv(target, pname, params);}
-void __stdcall _Lazy_glColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)  {if (GLeeInit()) glColorSubTable(target, start, count, format, type, data);}
-void __stdcall _Lazy_glCopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyColorSubTable(target, start, x, y, width);}
-void __stdcall _Lazy_glConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)  {if (GLeeInit()) glConvolutionFilter1D(target, internalformat, width, format, type, image);}
-void __stdcall _Lazy_glConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)  {if (GLeeInit()) glConvolutionFilter2D(target, internalformat, width, height, format, type, image);}
-void __stdcall _Lazy_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)  {if (GLeeInit()) glConvolutionParameterf(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glConvolutionParameterfv(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameteri(GLenum target, GLenum pname, GLint params)   {if (GLeeInit()) glConvolutionParameteri(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glConvolutionParameteriv(target, pname, params);}
-void __stdcall _Lazy_glCopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyConvolutionFilter1D(target, internalformat, x, y, width);}
-void __stdcall _Lazy_glCopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)  {if (GLeeInit()) glCopyConvolutionFilter2D(target, internalformat, x, y, width, height);}
-void __stdcall _Lazy_glGetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid * image)  {if (GLeeInit()) glGetConvolutionFilter(target, format, type, image);}
-void __stdcall _Lazy_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetConvolutionParameterfv(target, pname, params);}
-void __stdcall _Lazy_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetConvolutionParameteriv(target, pname, params);}
-void __stdcall _Lazy_glGetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)  {if (GLeeInit()) glGetSeparableFilter(target, format, type, row, column, span);}
-void __stdcall _Lazy_glSeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)  {if (GLeeInit()) glSeparableFilter2D(target, internalformat, width, height, format, type, row, column);}
-void __stdcall _Lazy_glGetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (GLeeInit()) glGetHistogram(target, reset, format, type, values);}
-void __stdcall _Lazy_glGetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetHistogramParameterfv(target, pname, params);}
-void __stdcall _Lazy_glGetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetHistogramParameteriv(target, pname, params);}
-void __stdcall _Lazy_glGetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (GLeeInit()) glGetMinmax(target, reset, format, type, values);}
-void __stdcall _Lazy_glGetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetMinmaxParameterfv(target, pname, params);}
-void __stdcall _Lazy_glGetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetMinmaxParameteriv(target, pname, params);}
-void __stdcall _Lazy_glHistogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)  {if (GLeeInit()) glHistogram(target, width, internalformat, sink);}
-void __stdcall _Lazy_glMinmax(GLenum target, GLenum internalformat, GLboolean sink)       {if (GLeeInit()) glMinmax(target, internalformat, sink);}
-void __stdcall _Lazy_glResetHistogram(GLenum target)                                      {if (GLeeInit()) glResetHistogram(target);}
-void __stdcall _Lazy_glResetMinmax(GLenum target)                                         {if (GLeeInit()) glResetMinmax(target);}
-void __stdcall _Lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);}
-void __stdcall _Lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);}
-void __stdcall _Lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (GLeeInit()) glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);}
+void __stdcall _Lazy_glBlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)  {if (__GLeeLazyLink((void**)&pglBlendColor, "glBlendColor", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glBlendColor(red, green, blue, alpha);}
+void __stdcall _Lazy_glBlendEquation(GLenum mode)                                         {if (__GLeeLazyLink((void**)&pglBlendEquation, "glBlendEquation", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glBlendEquation(mode);}
+void __stdcall _Lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)  {if (__GLeeLazyLink((void**)&pglDrawRangeElements, "glDrawRangeElements", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glDrawRangeElements(mode, start, end, count, type, indices);}
+void __stdcall _Lazy_glColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (__GLeeLazyLink((void**)&pglColorTable, "glColorTable", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glColorTable(target, internalformat, width, format, type, table);}
+void __stdcall _Lazy_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglColorTableParameterfv, "glColorTableParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glColorTableParameterfv(target, pname, params);}
+void __stdcall _Lazy_glColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglColorTableParameteriv, "glColorTableParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glColorTableParameteriv(target, pname, params);}
+void __stdcall _Lazy_glCopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyColorTable, "glCopyColorTable", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glCopyColorTable(target, internalformat, x, y, width);}
+void __stdcall _Lazy_glGetColorTable(GLenum target, GLenum format, GLenum type, GLvoid * table)  {if (__GLeeLazyLink((void**)&pglGetColorTable, "glGetColorTable", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetColorTable(target, format, type, table);}
+void __stdcall _Lazy_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameterfv, "glGetColorTableParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetColorTableParameterfv(target, pname, params);}
+void __stdcall _Lazy_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameteriv, "glGetColorTableParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetColorTableParameteriv(target, pname, params);}
+void __stdcall _Lazy_glColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglColorSubTable, "glColorSubTable", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glColorSubTable(target, start, count, format, type, data);}
+void __stdcall _Lazy_glCopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyColorSubTable, "glCopyColorSubTable", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glCopyColorSubTable(target, start, x, y, width);}
+void __stdcall _Lazy_glConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)  {if (__GLeeLazyLink((void**)&pglConvolutionFilter1D, "glConvolutionFilter1D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionFilter1D(target, internalformat, width, format, type, image);}
+void __stdcall _Lazy_glConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)  {if (__GLeeLazyLink((void**)&pglConvolutionFilter2D, "glConvolutionFilter2D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionFilter2D(target, internalformat, width, height, format, type, image);}
+void __stdcall _Lazy_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameterf, "glConvolutionParameterf", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionParameterf(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameterfv, "glConvolutionParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionParameterfv(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameteri(GLenum target, GLenum pname, GLint params)   {if (__GLeeLazyLink((void**)&pglConvolutionParameteri, "glConvolutionParameteri", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionParameteri(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameteriv, "glConvolutionParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glConvolutionParameteriv(target, pname, params);}
+void __stdcall _Lazy_glCopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyConvolutionFilter1D, "glCopyConvolutionFilter1D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glCopyConvolutionFilter1D(target, internalformat, x, y, width);}
+void __stdcall _Lazy_glCopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglCopyConvolutionFilter2D, "glCopyConvolutionFilter2D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glCopyConvolutionFilter2D(target, internalformat, x, y, width, height);}
+void __stdcall _Lazy_glGetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid * image)  {if (__GLeeLazyLink((void**)&pglGetConvolutionFilter, "glGetConvolutionFilter", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetConvolutionFilter(target, format, type, image);}
+void __stdcall _Lazy_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetConvolutionParameterfv, "glGetConvolutionParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetConvolutionParameterfv(target, pname, params);}
+void __stdcall _Lazy_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetConvolutionParameteriv, "glGetConvolutionParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetConvolutionParameteriv(target, pname, params);}
+void __stdcall _Lazy_glGetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)  {if (__GLeeLazyLink((void**)&pglGetSeparableFilter, "glGetSeparableFilter", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetSeparableFilter(target, format, type, row, column, span);}
+void __stdcall _Lazy_glSeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)  {if (__GLeeLazyLink((void**)&pglSeparableFilter2D, "glSeparableFilter2D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glSeparableFilter2D(target, internalformat, width, height, format, type, row, column);}
+void __stdcall _Lazy_glGetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (__GLeeLazyLink((void**)&pglGetHistogram, "glGetHistogram", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetHistogram(target, reset, format, type, values);}
+void __stdcall _Lazy_glGetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetHistogramParameterfv, "glGetHistogramParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetHistogramParameterfv(target, pname, params);}
+void __stdcall _Lazy_glGetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetHistogramParameteriv, "glGetHistogramParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetHistogramParameteriv(target, pname, params);}
+void __stdcall _Lazy_glGetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (__GLeeLazyLink((void**)&pglGetMinmax, "glGetMinmax", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetMinmax(target, reset, format, type, values);}
+void __stdcall _Lazy_glGetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetMinmaxParameterfv, "glGetMinmaxParameterfv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetMinmaxParameterfv(target, pname, params);}
+void __stdcall _Lazy_glGetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetMinmaxParameteriv, "glGetMinmaxParameteriv", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glGetMinmaxParameteriv(target, pname, params);}
+void __stdcall _Lazy_glHistogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)  {if (__GLeeLazyLink((void**)&pglHistogram, "glHistogram", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glHistogram(target, width, internalformat, sink);}
+void __stdcall _Lazy_glMinmax(GLenum target, GLenum internalformat, GLboolean sink)       {if (__GLeeLazyLink((void**)&pglMinmax, "glMinmax", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glMinmax(target, internalformat, sink);}
+void __stdcall _Lazy_glResetHistogram(GLenum target)                                      {if (__GLeeLazyLink((void**)&pglResetHistogram, "glResetHistogram", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glResetHistogram(target);}
+void __stdcall _Lazy_glResetMinmax(GLenum target)                                         {if (__GLeeLazyLink((void**)&pglResetMinmax, "glResetMinmax", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glResetMinmax(target);}
+void __stdcall _Lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexImage3D, "glTexImage3D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);}
+void __stdcall _Lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexSubImage3D, "glTexSubImage3D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);}
+void __stdcall _Lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglCopyTexSubImage3D, "glCopyTexSubImage3D", &_GLEE_VERSION_1_2, "GL_VERSION_1_2")) glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);}
 PFNGLBLENDCOLORPROC pglBlendColor=_Lazy_glBlendColor;
 PFNGLBLENDEQUATIONPROC pglBlendEquation=_Lazy_glBlendEquation;
 PFNGLDRAWRANGEELEMENTSPROC pglDrawRangeElements=_Lazy_glDrawRangeElements;
@@ -709,52 +741,52 @@ PFNGLCOPYTEXSUBIMAGE3DPROC pglCopyTexSubImage3D=_Lazy_glCopyTexSubImage3D;
 //GL_VERSION_1_3
 
 #ifdef __GLEE_GL_VERSION_1_3
-void __stdcall _Lazy_glActiveTexture(GLenum texture)                                      {if (GLeeInit()) glActiveTexture(texture);}
-void __stdcall _Lazy_glClientActiveTexture(GLenum texture)                                {if (GLeeInit()) glClientActiveTexture(texture);}
-void __stdcall _Lazy_glMultiTexCoord1d(GLenum target, GLdouble s)                         {if (GLeeInit()) glMultiTexCoord1d(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1dv(GLenum target, const GLdouble * v)                {if (GLeeInit()) glMultiTexCoord1dv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1f(GLenum target, GLfloat s)                          {if (GLeeInit()) glMultiTexCoord1f(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1fv(GLenum target, const GLfloat * v)                 {if (GLeeInit()) glMultiTexCoord1fv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1i(GLenum target, GLint s)                            {if (GLeeInit()) glMultiTexCoord1i(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1iv(GLenum target, const GLint * v)                   {if (GLeeInit()) glMultiTexCoord1iv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1s(GLenum target, GLshort s)                          {if (GLeeInit()) glMultiTexCoord1s(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1sv(GLenum target, const GLshort * v)                 {if (GLeeInit()) glMultiTexCoord1sv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)             {if (GLeeInit()) glMultiTexCoord2d(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2dv(GLenum target, const GLdouble * v)                {if (GLeeInit()) glMultiTexCoord2dv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)               {if (GLeeInit()) glMultiTexCoord2f(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2fv(GLenum target, const GLfloat * v)                 {if (GLeeInit()) glMultiTexCoord2fv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t)                   {if (GLeeInit()) glMultiTexCoord2i(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2iv(GLenum target, const GLint * v)                   {if (GLeeInit()) glMultiTexCoord2iv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)               {if (GLeeInit()) glMultiTexCoord2s(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2sv(GLenum target, const GLshort * v)                 {if (GLeeInit()) glMultiTexCoord2sv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)  {if (GLeeInit()) glMultiTexCoord3d(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3dv(GLenum target, const GLdouble * v)                {if (GLeeInit()) glMultiTexCoord3dv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)    {if (GLeeInit()) glMultiTexCoord3f(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3fv(GLenum target, const GLfloat * v)                 {if (GLeeInit()) glMultiTexCoord3fv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)          {if (GLeeInit()) glMultiTexCoord3i(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3iv(GLenum target, const GLint * v)                   {if (GLeeInit()) glMultiTexCoord3iv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)    {if (GLeeInit()) glMultiTexCoord3s(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3sv(GLenum target, const GLshort * v)                 {if (GLeeInit()) glMultiTexCoord3sv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)  {if (GLeeInit()) glMultiTexCoord4d(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4dv(GLenum target, const GLdouble * v)                {if (GLeeInit()) glMultiTexCoord4dv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)  {if (GLeeInit()) glMultiTexCoord4f(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4fv(GLenum target, const GLfloat * v)                 {if (GLeeInit()) glMultiTexCoord4fv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)  {if (GLeeInit()) glMultiTexCoord4i(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4iv(GLenum target, const GLint * v)                   {if (GLeeInit()) glMultiTexCoord4iv(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)  {if (GLeeInit()) glMultiTexCoord4s(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4sv(GLenum target, const GLshort * v)                 {if (GLeeInit()) glMultiTexCoord4sv(target, v);}
-void __stdcall _Lazy_glLoadTransposeMatrixf(const GLfloat * m)                            {if (GLeeInit()) glLoadTransposeMatrixf(m);}
-void __stdcall _Lazy_glLoadTransposeMatrixd(const GLdouble * m)                           {if (GLeeInit()) glLoadTransposeMatrixd(m);}
-void __stdcall _Lazy_glMultTransposeMatrixf(const GLfloat * m)                            {if (GLeeInit()) glMultTransposeMatrixf(m);}
-void __stdcall _Lazy_glMultTransposeMatrixd(const GLdouble * m)                           {if (GLeeInit()) glMultTransposeMatrixd(m);}
-void __stdcall _Lazy_glSampleCoverage(GLclampf value, GLboolean invert)                   {if (GLeeInit()) glSampleCoverage(value, invert);}
-void __stdcall _Lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);}
-void __stdcall _Lazy_glGetCompressedTexImage(GLenum target, GLint level, GLvoid * img)    {if (GLeeInit()) glGetCompressedTexImage(target, level, img);}
+void __stdcall _Lazy_glActiveTexture(GLenum texture)                                      {if (__GLeeLazyLink((void**)&pglActiveTexture, "glActiveTexture", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glActiveTexture(texture);}
+void __stdcall _Lazy_glClientActiveTexture(GLenum texture)                                {if (__GLeeLazyLink((void**)&pglClientActiveTexture, "glClientActiveTexture", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glClientActiveTexture(texture);}
+void __stdcall _Lazy_glMultiTexCoord1d(GLenum target, GLdouble s)                         {if (__GLeeLazyLink((void**)&pglMultiTexCoord1d, "glMultiTexCoord1d", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1d(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1dv(GLenum target, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord1dv, "glMultiTexCoord1dv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1dv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1f(GLenum target, GLfloat s)                          {if (__GLeeLazyLink((void**)&pglMultiTexCoord1f, "glMultiTexCoord1f", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1f(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1fv(GLenum target, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord1fv, "glMultiTexCoord1fv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1fv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1i(GLenum target, GLint s)                            {if (__GLeeLazyLink((void**)&pglMultiTexCoord1i, "glMultiTexCoord1i", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1i(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1iv(GLenum target, const GLint * v)                   {if (__GLeeLazyLink((void**)&pglMultiTexCoord1iv, "glMultiTexCoord1iv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1iv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1s(GLenum target, GLshort s)                          {if (__GLeeLazyLink((void**)&pglMultiTexCoord1s, "glMultiTexCoord1s", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1s(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1sv(GLenum target, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord1sv, "glMultiTexCoord1sv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord1sv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)             {if (__GLeeLazyLink((void**)&pglMultiTexCoord2d, "glMultiTexCoord2d", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2d(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2dv(GLenum target, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord2dv, "glMultiTexCoord2dv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2dv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)               {if (__GLeeLazyLink((void**)&pglMultiTexCoord2f, "glMultiTexCoord2f", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2f(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2fv(GLenum target, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord2fv, "glMultiTexCoord2fv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2fv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t)                   {if (__GLeeLazyLink((void**)&pglMultiTexCoord2i, "glMultiTexCoord2i", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2i(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2iv(GLenum target, const GLint * v)                   {if (__GLeeLazyLink((void**)&pglMultiTexCoord2iv, "glMultiTexCoord2iv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2iv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)               {if (__GLeeLazyLink((void**)&pglMultiTexCoord2s, "glMultiTexCoord2s", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2s(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2sv(GLenum target, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord2sv, "glMultiTexCoord2sv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord2sv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord3d, "glMultiTexCoord3d", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3d(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3dv(GLenum target, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord3dv, "glMultiTexCoord3dv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3dv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)    {if (__GLeeLazyLink((void**)&pglMultiTexCoord3f, "glMultiTexCoord3f", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3f(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3fv(GLenum target, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord3fv, "glMultiTexCoord3fv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3fv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)          {if (__GLeeLazyLink((void**)&pglMultiTexCoord3i, "glMultiTexCoord3i", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3i(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3iv(GLenum target, const GLint * v)                   {if (__GLeeLazyLink((void**)&pglMultiTexCoord3iv, "glMultiTexCoord3iv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3iv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)    {if (__GLeeLazyLink((void**)&pglMultiTexCoord3s, "glMultiTexCoord3s", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3s(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3sv(GLenum target, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord3sv, "glMultiTexCoord3sv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord3sv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4d, "glMultiTexCoord4d", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4d(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4dv(GLenum target, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord4dv, "glMultiTexCoord4dv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4dv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4f, "glMultiTexCoord4f", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4f(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4fv(GLenum target, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord4fv, "glMultiTexCoord4fv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4fv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4i, "glMultiTexCoord4i", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4i(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4iv(GLenum target, const GLint * v)                   {if (__GLeeLazyLink((void**)&pglMultiTexCoord4iv, "glMultiTexCoord4iv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4iv(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4s, "glMultiTexCoord4s", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4s(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4sv(GLenum target, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglMultiTexCoord4sv, "glMultiTexCoord4sv", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultiTexCoord4sv(target, v);}
+void __stdcall _Lazy_glLoadTransposeMatrixf(const GLfloat * m)                            {if (__GLeeLazyLink((void**)&pglLoadTransposeMatrixf, "glLoadTransposeMatrixf", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glLoadTransposeMatrixf(m);}
+void __stdcall _Lazy_glLoadTransposeMatrixd(const GLdouble * m)                           {if (__GLeeLazyLink((void**)&pglLoadTransposeMatrixd, "glLoadTransposeMatrixd", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glLoadTransposeMatrixd(m);}
+void __stdcall _Lazy_glMultTransposeMatrixf(const GLfloat * m)                            {if (__GLeeLazyLink((void**)&pglMultTransposeMatrixf, "glMultTransposeMatrixf", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultTransposeMatrixf(m);}
+void __stdcall _Lazy_glMultTransposeMatrixd(const GLdouble * m)                           {if (__GLeeLazyLink((void**)&pglMultTransposeMatrixd, "glMultTransposeMatrixd", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glMultTransposeMatrixd(m);}
+void __stdcall _Lazy_glSampleCoverage(GLclampf value, GLboolean invert)                   {if (__GLeeLazyLink((void**)&pglSampleCoverage, "glSampleCoverage", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glSampleCoverage(value, invert);}
+void __stdcall _Lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage3D, "glCompressedTexImage3D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage2D, "glCompressedTexImage2D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage1D, "glCompressedTexImage1D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage3D, "glCompressedTexSubImage3D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage2D, "glCompressedTexSubImage2D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage1D, "glCompressedTexSubImage1D", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);}
+void __stdcall _Lazy_glGetCompressedTexImage(GLenum target, GLint level, GLvoid * img)    {if (__GLeeLazyLink((void**)&pglGetCompressedTexImage, "glGetCompressedTexImage", &_GLEE_VERSION_1_3, "GL_VERSION_1_3")) glGetCompressedTexImage(target, level, img);}
 PFNGLACTIVETEXTUREPROC pglActiveTexture=_Lazy_glActiveTexture;
 PFNGLCLIENTACTIVETEXTUREPROC pglClientActiveTexture=_Lazy_glClientActiveTexture;
 PFNGLMULTITEXCOORD1DPROC pglMultiTexCoord1d=_Lazy_glMultiTexCoord1d;
@@ -806,51 +838,51 @@ PFNGLGETCOMPRESSEDTEXIMAGEPROC pglGetCompressedTexImage=_Lazy_glGetCompressedTex
 //GL_VERSION_1_4
 
 #ifdef __GLEE_GL_VERSION_1_4
-void __stdcall _Lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (GLeeInit()) glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
-void __stdcall _Lazy_glFogCoordf(GLfloat coord)                                           {if (GLeeInit()) glFogCoordf(coord);}
-void __stdcall _Lazy_glFogCoordfv(const GLfloat * coord)                                  {if (GLeeInit()) glFogCoordfv(coord);}
-void __stdcall _Lazy_glFogCoordd(GLdouble coord)                                          {if (GLeeInit()) glFogCoordd(coord);}
-void __stdcall _Lazy_glFogCoorddv(const GLdouble * coord)                                 {if (GLeeInit()) glFogCoorddv(coord);}
-void __stdcall _Lazy_glFogCoordPointer(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glFogCoordPointer(type, stride, pointer);}
-void __stdcall _Lazy_glMultiDrawArrays(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)  {if (GLeeInit()) glMultiDrawArrays(mode, first, count, primcount);}
-void __stdcall _Lazy_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const GLvoid* * indices, GLsizei primcount)  {if (GLeeInit()) glMultiDrawElements(mode, count, type, indices, primcount);}
-void __stdcall _Lazy_glPointParameterf(GLenum pname, GLfloat param)                       {if (GLeeInit()) glPointParameterf(pname, param);}
-void __stdcall _Lazy_glPointParameterfv(GLenum pname, const GLfloat * params)             {if (GLeeInit()) glPointParameterfv(pname, params);}
-void __stdcall _Lazy_glPointParameteri(GLenum pname, GLint param)                         {if (GLeeInit()) glPointParameteri(pname, param);}
-void __stdcall _Lazy_glPointParameteriv(GLenum pname, const GLint * params)               {if (GLeeInit()) glPointParameteriv(pname, params);}
-void __stdcall _Lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)            {if (GLeeInit()) glSecondaryColor3b(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3bv(const GLbyte * v)                                {if (GLeeInit()) glSecondaryColor3bv(v);}
-void __stdcall _Lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)      {if (GLeeInit()) glSecondaryColor3d(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3dv(const GLdouble * v)                              {if (GLeeInit()) glSecondaryColor3dv(v);}
-void __stdcall _Lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)         {if (GLeeInit()) glSecondaryColor3f(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3fv(const GLfloat * v)                               {if (GLeeInit()) glSecondaryColor3fv(v);}
-void __stdcall _Lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue)               {if (GLeeInit()) glSecondaryColor3i(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3iv(const GLint * v)                                 {if (GLeeInit()) glSecondaryColor3iv(v);}
-void __stdcall _Lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)         {if (GLeeInit()) glSecondaryColor3s(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3sv(const GLshort * v)                               {if (GLeeInit()) glSecondaryColor3sv(v);}
-void __stdcall _Lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)        {if (GLeeInit()) glSecondaryColor3ub(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3ubv(const GLubyte * v)                              {if (GLeeInit()) glSecondaryColor3ubv(v);}
-void __stdcall _Lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)           {if (GLeeInit()) glSecondaryColor3ui(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3uiv(const GLuint * v)                               {if (GLeeInit()) glSecondaryColor3uiv(v);}
-void __stdcall _Lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)     {if (GLeeInit()) glSecondaryColor3us(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3usv(const GLushort * v)                             {if (GLeeInit()) glSecondaryColor3usv(v);}
-void __stdcall _Lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glSecondaryColorPointer(size, type, stride, pointer);}
-void __stdcall _Lazy_glWindowPos2d(GLdouble x, GLdouble y)                                {if (GLeeInit()) glWindowPos2d(x, y);}
-void __stdcall _Lazy_glWindowPos2dv(const GLdouble * v)                                   {if (GLeeInit()) glWindowPos2dv(v);}
-void __stdcall _Lazy_glWindowPos2f(GLfloat x, GLfloat y)                                  {if (GLeeInit()) glWindowPos2f(x, y);}
-void __stdcall _Lazy_glWindowPos2fv(const GLfloat * v)                                    {if (GLeeInit()) glWindowPos2fv(v);}
-void __stdcall _Lazy_glWindowPos2i(GLint x, GLint y)                                      {if (GLeeInit()) glWindowPos2i(x, y);}
-void __stdcall _Lazy_glWindowPos2iv(const GLint * v)                                      {if (GLeeInit()) glWindowPos2iv(v);}
-void __stdcall _Lazy_glWindowPos2s(GLshort x, GLshort y)                                  {if (GLeeInit()) glWindowPos2s(x, y);}
-void __stdcall _Lazy_glWindowPos2sv(const GLshort * v)                                    {if (GLeeInit()) glWindowPos2sv(v);}
-void __stdcall _Lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)                    {if (GLeeInit()) glWindowPos3d(x, y, z);}
-void __stdcall _Lazy_glWindowPos3dv(const GLdouble * v)                                   {if (GLeeInit()) glWindowPos3dv(v);}
-void __stdcall _Lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)                       {if (GLeeInit()) glWindowPos3f(x, y, z);}
-void __stdcall _Lazy_glWindowPos3fv(const GLfloat * v)                                    {if (GLeeInit()) glWindowPos3fv(v);}
-void __stdcall _Lazy_glWindowPos3i(GLint x, GLint y, GLint z)                             {if (GLeeInit()) glWindowPos3i(x, y, z);}
-void __stdcall _Lazy_glWindowPos3iv(const GLint * v)                                      {if (GLeeInit()) glWindowPos3iv(v);}
-void __stdcall _Lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z)                       {if (GLeeInit()) glWindowPos3s(x, y, z);}
-void __stdcall _Lazy_glWindowPos3sv(const GLshort * v)                                    {if (GLeeInit()) glWindowPos3sv(v);}
+void __stdcall _Lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (__GLeeLazyLink((void**)&pglBlendFuncSeparate, "glBlendFuncSeparate", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
+void __stdcall _Lazy_glFogCoordf(GLfloat coord)                                           {if (__GLeeLazyLink((void**)&pglFogCoordf, "glFogCoordf", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glFogCoordf(coord);}
+void __stdcall _Lazy_glFogCoordfv(const GLfloat * coord)                                  {if (__GLeeLazyLink((void**)&pglFogCoordfv, "glFogCoordfv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glFogCoordfv(coord);}
+void __stdcall _Lazy_glFogCoordd(GLdouble coord)                                          {if (__GLeeLazyLink((void**)&pglFogCoordd, "glFogCoordd", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glFogCoordd(coord);}
+void __stdcall _Lazy_glFogCoorddv(const GLdouble * coord)                                 {if (__GLeeLazyLink((void**)&pglFogCoorddv, "glFogCoorddv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glFogCoorddv(coord);}
+void __stdcall _Lazy_glFogCoordPointer(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglFogCoordPointer, "glFogCoordPointer", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glFogCoordPointer(type, stride, pointer);}
+void __stdcall _Lazy_glMultiDrawArrays(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawArrays, "glMultiDrawArrays", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glMultiDrawArrays(mode, first, count, primcount);}
+void __stdcall _Lazy_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const GLvoid* * indices, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawElements, "glMultiDrawElements", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glMultiDrawElements(mode, count, type, indices, primcount);}
+void __stdcall _Lazy_glPointParameterf(GLenum pname, GLfloat param)                       {if (__GLeeLazyLink((void**)&pglPointParameterf, "glPointParameterf", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glPointParameterf(pname, param);}
+void __stdcall _Lazy_glPointParameterfv(GLenum pname, const GLfloat * params)             {if (__GLeeLazyLink((void**)&pglPointParameterfv, "glPointParameterfv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glPointParameterfv(pname, params);}
+void __stdcall _Lazy_glPointParameteri(GLenum pname, GLint param)                         {if (__GLeeLazyLink((void**)&pglPointParameteri, "glPointParameteri", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glPointParameteri(pname, param);}
+void __stdcall _Lazy_glPointParameteriv(GLenum pname, const GLint * params)               {if (__GLeeLazyLink((void**)&pglPointParameteriv, "glPointParameteriv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glPointParameteriv(pname, params);}
+void __stdcall _Lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)            {if (__GLeeLazyLink((void**)&pglSecondaryColor3b, "glSecondaryColor3b", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3b(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3bv(const GLbyte * v)                                {if (__GLeeLazyLink((void**)&pglSecondaryColor3bv, "glSecondaryColor3bv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3bv(v);}
+void __stdcall _Lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)      {if (__GLeeLazyLink((void**)&pglSecondaryColor3d, "glSecondaryColor3d", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3d(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3dv(const GLdouble * v)                              {if (__GLeeLazyLink((void**)&pglSecondaryColor3dv, "glSecondaryColor3dv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3dv(v);}
+void __stdcall _Lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)         {if (__GLeeLazyLink((void**)&pglSecondaryColor3f, "glSecondaryColor3f", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3f(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3fv(const GLfloat * v)                               {if (__GLeeLazyLink((void**)&pglSecondaryColor3fv, "glSecondaryColor3fv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3fv(v);}
+void __stdcall _Lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue)               {if (__GLeeLazyLink((void**)&pglSecondaryColor3i, "glSecondaryColor3i", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3i(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3iv(const GLint * v)                                 {if (__GLeeLazyLink((void**)&pglSecondaryColor3iv, "glSecondaryColor3iv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3iv(v);}
+void __stdcall _Lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)         {if (__GLeeLazyLink((void**)&pglSecondaryColor3s, "glSecondaryColor3s", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3s(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3sv(const GLshort * v)                               {if (__GLeeLazyLink((void**)&pglSecondaryColor3sv, "glSecondaryColor3sv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3sv(v);}
+void __stdcall _Lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)        {if (__GLeeLazyLink((void**)&pglSecondaryColor3ub, "glSecondaryColor3ub", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3ub(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3ubv(const GLubyte * v)                              {if (__GLeeLazyLink((void**)&pglSecondaryColor3ubv, "glSecondaryColor3ubv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3ubv(v);}
+void __stdcall _Lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)           {if (__GLeeLazyLink((void**)&pglSecondaryColor3ui, "glSecondaryColor3ui", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3ui(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3uiv(const GLuint * v)                               {if (__GLeeLazyLink((void**)&pglSecondaryColor3uiv, "glSecondaryColor3uiv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3uiv(v);}
+void __stdcall _Lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)     {if (__GLeeLazyLink((void**)&pglSecondaryColor3us, "glSecondaryColor3us", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3us(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3usv(const GLushort * v)                             {if (__GLeeLazyLink((void**)&pglSecondaryColor3usv, "glSecondaryColor3usv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColor3usv(v);}
+void __stdcall _Lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglSecondaryColorPointer, "glSecondaryColorPointer", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glSecondaryColorPointer(size, type, stride, pointer);}
+void __stdcall _Lazy_glWindowPos2d(GLdouble x, GLdouble y)                                {if (__GLeeLazyLink((void**)&pglWindowPos2d, "glWindowPos2d", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2d(x, y);}
+void __stdcall _Lazy_glWindowPos2dv(const GLdouble * v)                                   {if (__GLeeLazyLink((void**)&pglWindowPos2dv, "glWindowPos2dv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2dv(v);}
+void __stdcall _Lazy_glWindowPos2f(GLfloat x, GLfloat y)                                  {if (__GLeeLazyLink((void**)&pglWindowPos2f, "glWindowPos2f", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2f(x, y);}
+void __stdcall _Lazy_glWindowPos2fv(const GLfloat * v)                                    {if (__GLeeLazyLink((void**)&pglWindowPos2fv, "glWindowPos2fv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2fv(v);}
+void __stdcall _Lazy_glWindowPos2i(GLint x, GLint y)                                      {if (__GLeeLazyLink((void**)&pglWindowPos2i, "glWindowPos2i", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2i(x, y);}
+void __stdcall _Lazy_glWindowPos2iv(const GLint * v)                                      {if (__GLeeLazyLink((void**)&pglWindowPos2iv, "glWindowPos2iv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2iv(v);}
+void __stdcall _Lazy_glWindowPos2s(GLshort x, GLshort y)                                  {if (__GLeeLazyLink((void**)&pglWindowPos2s, "glWindowPos2s", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2s(x, y);}
+void __stdcall _Lazy_glWindowPos2sv(const GLshort * v)                                    {if (__GLeeLazyLink((void**)&pglWindowPos2sv, "glWindowPos2sv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos2sv(v);}
+void __stdcall _Lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)                    {if (__GLeeLazyLink((void**)&pglWindowPos3d, "glWindowPos3d", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3d(x, y, z);}
+void __stdcall _Lazy_glWindowPos3dv(const GLdouble * v)                                   {if (__GLeeLazyLink((void**)&pglWindowPos3dv, "glWindowPos3dv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3dv(v);}
+void __stdcall _Lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)                       {if (__GLeeLazyLink((void**)&pglWindowPos3f, "glWindowPos3f", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3f(x, y, z);}
+void __stdcall _Lazy_glWindowPos3fv(const GLfloat * v)                                    {if (__GLeeLazyLink((void**)&pglWindowPos3fv, "glWindowPos3fv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3fv(v);}
+void __stdcall _Lazy_glWindowPos3i(GLint x, GLint y, GLint z)                             {if (__GLeeLazyLink((void**)&pglWindowPos3i, "glWindowPos3i", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3i(x, y, z);}
+void __stdcall _Lazy_glWindowPos3iv(const GLint * v)                                      {if (__GLeeLazyLink((void**)&pglWindowPos3iv, "glWindowPos3iv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3iv(v);}
+void __stdcall _Lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z)                       {if (__GLeeLazyLink((void**)&pglWindowPos3s, "glWindowPos3s", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3s(x, y, z);}
+void __stdcall _Lazy_glWindowPos3sv(const GLshort * v)                                    {if (__GLeeLazyLink((void**)&pglWindowPos3sv, "glWindowPos3sv", &_GLEE_VERSION_1_4, "GL_VERSION_1_4")) glWindowPos3sv(v);}
 PFNGLBLENDFUNCSEPARATEPROC pglBlendFuncSeparate=_Lazy_glBlendFuncSeparate;
 PFNGLFOGCOORDFPROC pglFogCoordf=_Lazy_glFogCoordf;
 PFNGLFOGCOORDFVPROC pglFogCoordfv=_Lazy_glFogCoordfv;
@@ -901,25 +933,25 @@ PFNGLWINDOWPOS3SVPROC pglWindowPos3sv=_Lazy_glWindowPos3sv;
 //GL_VERSION_1_5
 
 #ifdef __GLEE_GL_VERSION_1_5
-void __stdcall _Lazy_glGenQueries(GLsizei n, GLuint * ids)                                {if (GLeeInit()) glGenQueries(n, ids);}
-void __stdcall _Lazy_glDeleteQueries(GLsizei n, const GLuint * ids)                       {if (GLeeInit()) glDeleteQueries(n, ids);}
-GLboolean __stdcall _Lazy_glIsQuery(GLuint id)                                            {if (GLeeInit()) return glIsQuery(id); return (GLboolean)0;}
-void __stdcall _Lazy_glBeginQuery(GLenum target, GLuint id)                               {if (GLeeInit()) glBeginQuery(target, id);}
-void __stdcall _Lazy_glEndQuery(GLenum target)                                            {if (GLeeInit()) glEndQuery(target);}
-void __stdcall _Lazy_glGetQueryiv(GLenum target, GLenum pname, GLint * params)            {if (GLeeInit()) glGetQueryiv(target, pname, params);}
-void __stdcall _Lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params)          {if (GLeeInit()) glGetQueryObjectiv(id, pname, params);}
-void __stdcall _Lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)        {if (GLeeInit()) glGetQueryObjectuiv(id, pname, params);}
-void __stdcall _Lazy_glBindBuffer(GLenum target, GLuint buffer)                           {if (GLeeInit()) glBindBuffer(target, buffer);}
-void __stdcall _Lazy_glDeleteBuffers(GLsizei n, const GLuint * buffers)                   {if (GLeeInit()) glDeleteBuffers(n, buffers);}
-void __stdcall _Lazy_glGenBuffers(GLsizei n, GLuint * buffers)                            {if (GLeeInit()) glGenBuffers(n, buffers);}
-GLboolean __stdcall _Lazy_glIsBuffer(GLuint buffer)                                       {if (GLeeInit()) return glIsBuffer(buffer); return (GLboolean)0;}
-void __stdcall _Lazy_glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage)  {if (GLeeInit()) glBufferData(target, size, data, usage);}
-void __stdcall _Lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data)  {if (GLeeInit()) glBufferSubData(target, offset, size, data);}
-void __stdcall _Lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data)  {if (GLeeInit()) glGetBufferSubData(target, offset, size, data);}
-GLvoid* __stdcall _Lazy_glMapBuffer(GLenum target, GLenum access)                         {if (GLeeInit()) return glMapBuffer(target, access); return (GLvoid*)0;}
-GLboolean __stdcall _Lazy_glUnmapBuffer(GLenum target)                                    {if (GLeeInit()) return glUnmapBuffer(target); return (GLboolean)0;}
-void __stdcall _Lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetBufferParameteriv(target, pname, params);}
-void __stdcall _Lazy_glGetBufferPointerv(GLenum target, GLenum pname, GLvoid* * params)   {if (GLeeInit()) glGetBufferPointerv(target, pname, params);}
+void __stdcall _Lazy_glGenQueries(GLsizei n, GLuint * ids)                                {if (__GLeeLazyLink((void**)&pglGenQueries, "glGenQueries", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGenQueries(n, ids);}
+void __stdcall _Lazy_glDeleteQueries(GLsizei n, const GLuint * ids)                       {if (__GLeeLazyLink((void**)&pglDeleteQueries, "glDeleteQueries", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glDeleteQueries(n, ids);}
+GLboolean __stdcall _Lazy_glIsQuery(GLuint id)                                            {if (__GLeeLazyLink((void**)&pglIsQuery, "glIsQuery", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) return glIsQuery(id); return (GLboolean)0;}
+void __stdcall _Lazy_glBeginQuery(GLenum target, GLuint id)                               {if (__GLeeLazyLink((void**)&pglBeginQuery, "glBeginQuery", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glBeginQuery(target, id);}
+void __stdcall _Lazy_glEndQuery(GLenum target)                                            {if (__GLeeLazyLink((void**)&pglEndQuery, "glEndQuery", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glEndQuery(target);}
+void __stdcall _Lazy_glGetQueryiv(GLenum target, GLenum pname, GLint * params)            {if (__GLeeLazyLink((void**)&pglGetQueryiv, "glGetQueryiv", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetQueryiv(target, pname, params);}
+void __stdcall _Lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params)          {if (__GLeeLazyLink((void**)&pglGetQueryObjectiv, "glGetQueryObjectiv", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetQueryObjectiv(id, pname, params);}
+void __stdcall _Lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)        {if (__GLeeLazyLink((void**)&pglGetQueryObjectuiv, "glGetQueryObjectuiv", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetQueryObjectuiv(id, pname, params);}
+void __stdcall _Lazy_glBindBuffer(GLenum target, GLuint buffer)                           {if (__GLeeLazyLink((void**)&pglBindBuffer, "glBindBuffer", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glBindBuffer(target, buffer);}
+void __stdcall _Lazy_glDeleteBuffers(GLsizei n, const GLuint * buffers)                   {if (__GLeeLazyLink((void**)&pglDeleteBuffers, "glDeleteBuffers", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glDeleteBuffers(n, buffers);}
+void __stdcall _Lazy_glGenBuffers(GLsizei n, GLuint * buffers)                            {if (__GLeeLazyLink((void**)&pglGenBuffers, "glGenBuffers", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGenBuffers(n, buffers);}
+GLboolean __stdcall _Lazy_glIsBuffer(GLuint buffer)                                       {if (__GLeeLazyLink((void**)&pglIsBuffer, "glIsBuffer", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) return glIsBuffer(buffer); return (GLboolean)0;}
+void __stdcall _Lazy_glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage)  {if (__GLeeLazyLink((void**)&pglBufferData, "glBufferData", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glBufferData(target, size, data, usage);}
+void __stdcall _Lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglBufferSubData, "glBufferSubData", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glBufferSubData(target, offset, size, data);}
+void __stdcall _Lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data)  {if (__GLeeLazyLink((void**)&pglGetBufferSubData, "glGetBufferSubData", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetBufferSubData(target, offset, size, data);}
+GLvoid* __stdcall _Lazy_glMapBuffer(GLenum target, GLenum access)                         {if (__GLeeLazyLink((void**)&pglMapBuffer, "glMapBuffer", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) return glMapBuffer(target, access); return (GLvoid*)0;}
+GLboolean __stdcall _Lazy_glUnmapBuffer(GLenum target)                                    {if (__GLeeLazyLink((void**)&pglUnmapBuffer, "glUnmapBuffer", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) return glUnmapBuffer(target); return (GLboolean)0;}
+void __stdcall _Lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetBufferParameteriv, "glGetBufferParameteriv", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetBufferParameteriv(target, pname, params);}
+void __stdcall _Lazy_glGetBufferPointerv(GLenum target, GLenum pname, GLvoid* * params)   {if (__GLeeLazyLink((void**)&pglGetBufferPointerv, "glGetBufferPointerv", &_GLEE_VERSION_1_5, "GL_VERSION_1_5")) glGetBufferPointerv(target, pname, params);}
 PFNGLGENQUERIESPROC pglGenQueries=_Lazy_glGenQueries;
 PFNGLDELETEQUERIESPROC pglDeleteQueries=_Lazy_glDeleteQueries;
 PFNGLISQUERYPROC pglIsQuery=_Lazy_glIsQuery;
@@ -944,99 +976,99 @@ PFNGLGETBUFFERPOINTERVPROC pglGetBufferPointerv=_Lazy_glGetBufferPointerv;
 //GL_VERSION_2_0
 
 #ifdef __GLEE_GL_VERSION_2_0
-void __stdcall _Lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)            {if (GLeeInit()) glBlendEquationSeparate(modeRGB, modeAlpha);}
-void __stdcall _Lazy_glDrawBuffers(GLsizei n, const GLenum * bufs)                        {if (GLeeInit()) glDrawBuffers(n, bufs);}
-void __stdcall _Lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)  {if (GLeeInit()) glStencilOpSeparate(face, sfail, dpfail, dppass);}
-void __stdcall _Lazy_glStencilFuncSeparate(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)  {if (GLeeInit()) glStencilFuncSeparate(frontfunc, backfunc, ref, mask);}
-void __stdcall _Lazy_glStencilMaskSeparate(GLenum face, GLuint mask)                      {if (GLeeInit()) glStencilMaskSeparate(face, mask);}
-void __stdcall _Lazy_glAttachShader(GLuint program, GLuint shader)                        {if (GLeeInit()) glAttachShader(program, shader);}
-void __stdcall _Lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name)  {if (GLeeInit()) glBindAttribLocation(program, index, name);}
-void __stdcall _Lazy_glCompileShader(GLuint shader)                                       {if (GLeeInit()) glCompileShader(shader);}
-GLuint __stdcall _Lazy_glCreateProgram(void)                                              {if (GLeeInit()) return glCreateProgram(); return (GLuint)0;}
-GLuint __stdcall _Lazy_glCreateShader(GLenum type)                                        {if (GLeeInit()) return glCreateShader(type); return (GLuint)0;}
-void __stdcall _Lazy_glDeleteProgram(GLuint program)                                      {if (GLeeInit()) glDeleteProgram(program);}
-void __stdcall _Lazy_glDeleteShader(GLuint shader)                                        {if (GLeeInit()) glDeleteShader(shader);}
-void __stdcall _Lazy_glDetachShader(GLuint program, GLuint shader)                        {if (GLeeInit()) glDetachShader(program, shader);}
-void __stdcall _Lazy_glDisableVertexAttribArray(GLuint index)                             {if (GLeeInit()) glDisableVertexAttribArray(index);}
-void __stdcall _Lazy_glEnableVertexAttribArray(GLuint index)                              {if (GLeeInit()) glEnableVertexAttribArray(index);}
-void __stdcall _Lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)  {if (GLeeInit()) glGetActiveAttrib(program, index, bufSize, length, size, type, name);}
-void __stdcall _Lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)  {if (GLeeInit()) glGetActiveUniform(program, index, bufSize, length, size, type, name);}
-void __stdcall _Lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * obj)  {if (GLeeInit()) glGetAttachedShaders(program, maxCount, count, obj);}
-GLint __stdcall _Lazy_glGetAttribLocation(GLuint program, const GLchar * name)            {if (GLeeInit()) return glGetAttribLocation(program, name); return (GLint)0;}
-void __stdcall _Lazy_glGetProgramiv(GLuint program, GLenum pname, GLint * params)         {if (GLeeInit()) glGetProgramiv(program, pname, params);}
-void __stdcall _Lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)  {if (GLeeInit()) glGetProgramInfoLog(program, bufSize, length, infoLog);}
-void __stdcall _Lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint * params)           {if (GLeeInit()) glGetShaderiv(shader, pname, params);}
-void __stdcall _Lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)  {if (GLeeInit()) glGetShaderInfoLog(shader, bufSize, length, infoLog);}
-void __stdcall _Lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)  {if (GLeeInit()) glGetShaderSource(shader, bufSize, length, source);}
-GLint __stdcall _Lazy_glGetUniformLocation(GLuint program, const GLchar * name)           {if (GLeeInit()) return glGetUniformLocation(program, name); return (GLint)0;}
-void __stdcall _Lazy_glGetUniformfv(GLuint program, GLint location, GLfloat * params)     {if (GLeeInit()) glGetUniformfv(program, location, params);}
-void __stdcall _Lazy_glGetUniformiv(GLuint program, GLint location, GLint * params)       {if (GLeeInit()) glGetUniformiv(program, location, params);}
-void __stdcall _Lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)   {if (GLeeInit()) glGetVertexAttribdv(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)    {if (GLeeInit()) glGetVertexAttribfv(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params)      {if (GLeeInit()) glGetVertexAttribiv(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid* * pointer)  {if (GLeeInit()) glGetVertexAttribPointerv(index, pname, pointer);}
-GLboolean __stdcall _Lazy_glIsProgram(GLuint program)                                     {if (GLeeInit()) return glIsProgram(program); return (GLboolean)0;}
-GLboolean __stdcall _Lazy_glIsShader(GLuint shader)                                       {if (GLeeInit()) return glIsShader(shader); return (GLboolean)0;}
-void __stdcall _Lazy_glLinkProgram(GLuint program)                                        {if (GLeeInit()) glLinkProgram(program);}
-void __stdcall _Lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar* * string, const GLint * length)  {if (GLeeInit()) glShaderSource(shader, count, string, length);}
-void __stdcall _Lazy_glUseProgram(GLuint program)                                         {if (GLeeInit()) glUseProgram(program);}
-void __stdcall _Lazy_glUniform1f(GLint location, GLfloat v0)                              {if (GLeeInit()) glUniform1f(location, v0);}
-void __stdcall _Lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1)                  {if (GLeeInit()) glUniform2f(location, v0, v1);}
-void __stdcall _Lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)      {if (GLeeInit()) glUniform3f(location, v0, v1, v2);}
-void __stdcall _Lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)  {if (GLeeInit()) glUniform4f(location, v0, v1, v2, v3);}
-void __stdcall _Lazy_glUniform1i(GLint location, GLint v0)                                {if (GLeeInit()) glUniform1i(location, v0);}
-void __stdcall _Lazy_glUniform2i(GLint location, GLint v0, GLint v1)                      {if (GLeeInit()) glUniform2i(location, v0, v1);}
-void __stdcall _Lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)            {if (GLeeInit()) glUniform3i(location, v0, v1, v2);}
-void __stdcall _Lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)  {if (GLeeInit()) glUniform4i(location, v0, v1, v2, v3);}
-void __stdcall _Lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat * value)   {if (GLeeInit()) glUniform1fv(location, count, value);}
-void __stdcall _Lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat * value)   {if (GLeeInit()) glUniform2fv(location, count, value);}
-void __stdcall _Lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat * value)   {if (GLeeInit()) glUniform3fv(location, count, value);}
-void __stdcall _Lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat * value)   {if (GLeeInit()) glUniform4fv(location, count, value);}
-void __stdcall _Lazy_glUniform1iv(GLint location, GLsizei count, const GLint * value)     {if (GLeeInit()) glUniform1iv(location, count, value);}
-void __stdcall _Lazy_glUniform2iv(GLint location, GLsizei count, const GLint * value)     {if (GLeeInit()) glUniform2iv(location, count, value);}
-void __stdcall _Lazy_glUniform3iv(GLint location, GLsizei count, const GLint * value)     {if (GLeeInit()) glUniform3iv(location, count, value);}
-void __stdcall _Lazy_glUniform4iv(GLint location, GLsizei count, const GLint * value)     {if (GLeeInit()) glUniform4iv(location, count, value);}
-void __stdcall _Lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix2fv(location, count, transpose, value);}
-void __stdcall _Lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix3fv(location, count, transpose, value);}
-void __stdcall _Lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix4fv(location, count, transpose, value);}
-void __stdcall _Lazy_glValidateProgram(GLuint program)                                    {if (GLeeInit()) glValidateProgram(program);}
-void __stdcall _Lazy_glVertexAttrib1d(GLuint index, GLdouble x)                           {if (GLeeInit()) glVertexAttrib1d(index, x);}
-void __stdcall _Lazy_glVertexAttrib1dv(GLuint index, const GLdouble * v)                  {if (GLeeInit()) glVertexAttrib1dv(index, v);}
-void __stdcall _Lazy_glVertexAttrib1f(GLuint index, GLfloat x)                            {if (GLeeInit()) glVertexAttrib1f(index, x);}
-void __stdcall _Lazy_glVertexAttrib1fv(GLuint index, const GLfloat * v)                   {if (GLeeInit()) glVertexAttrib1fv(index, v);}
-void __stdcall _Lazy_glVertexAttrib1s(GLuint index, GLshort x)                            {if (GLeeInit()) glVertexAttrib1s(index, x);}
-void __stdcall _Lazy_glVertexAttrib1sv(GLuint index, const GLshort * v)                   {if (GLeeInit()) glVertexAttrib1sv(index, v);}
-void __stdcall _Lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)               {if (GLeeInit()) glVertexAttrib2d(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2dv(GLuint index, const GLdouble * v)                  {if (GLeeInit()) glVertexAttrib2dv(index, v);}
-void __stdcall _Lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)                 {if (GLeeInit()) glVertexAttrib2f(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2fv(GLuint index, const GLfloat * v)                   {if (GLeeInit()) glVertexAttrib2fv(index, v);}
-void __stdcall _Lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)                 {if (GLeeInit()) glVertexAttrib2s(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2sv(GLuint index, const GLshort * v)                   {if (GLeeInit()) glVertexAttrib2sv(index, v);}
-void __stdcall _Lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)   {if (GLeeInit()) glVertexAttrib3d(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3dv(GLuint index, const GLdouble * v)                  {if (GLeeInit()) glVertexAttrib3dv(index, v);}
-void __stdcall _Lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)      {if (GLeeInit()) glVertexAttrib3f(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3fv(GLuint index, const GLfloat * v)                   {if (GLeeInit()) glVertexAttrib3fv(index, v);}
-void __stdcall _Lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)      {if (GLeeInit()) glVertexAttrib3s(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3sv(GLuint index, const GLshort * v)                   {if (GLeeInit()) glVertexAttrib3sv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte * v)                   {if (GLeeInit()) glVertexAttrib4Nbv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Niv(GLuint index, const GLint * v)                    {if (GLeeInit()) glVertexAttrib4Niv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Nsv(GLuint index, const GLshort * v)                  {if (GLeeInit()) glVertexAttrib4Nsv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (GLeeInit()) glVertexAttrib4Nub(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte * v)                 {if (GLeeInit()) glVertexAttrib4Nubv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint * v)                  {if (GLeeInit()) glVertexAttrib4Nuiv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4Nusv(GLuint index, const GLushort * v)                {if (GLeeInit()) glVertexAttrib4Nusv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4bv(GLuint index, const GLbyte * v)                    {if (GLeeInit()) glVertexAttrib4bv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glVertexAttrib4d(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4dv(GLuint index, const GLdouble * v)                  {if (GLeeInit()) glVertexAttrib4dv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glVertexAttrib4f(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4fv(GLuint index, const GLfloat * v)                   {if (GLeeInit()) glVertexAttrib4fv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4iv(GLuint index, const GLint * v)                     {if (GLeeInit()) glVertexAttrib4iv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (GLeeInit()) glVertexAttrib4s(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4sv(GLuint index, const GLshort * v)                   {if (GLeeInit()) glVertexAttrib4sv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4ubv(GLuint index, const GLubyte * v)                  {if (GLeeInit()) glVertexAttrib4ubv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4uiv(GLuint index, const GLuint * v)                   {if (GLeeInit()) glVertexAttrib4uiv(index, v);}
-void __stdcall _Lazy_glVertexAttrib4usv(GLuint index, const GLushort * v)                 {if (GLeeInit()) glVertexAttrib4usv(index, v);}
-void __stdcall _Lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glVertexAttribPointer(index, size, type, normalized, stride, pointer);}
+void __stdcall _Lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)            {if (__GLeeLazyLink((void**)&pglBlendEquationSeparate, "glBlendEquationSeparate", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glBlendEquationSeparate(modeRGB, modeAlpha);}
+void __stdcall _Lazy_glDrawBuffers(GLsizei n, const GLenum * bufs)                        {if (__GLeeLazyLink((void**)&pglDrawBuffers, "glDrawBuffers", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glDrawBuffers(n, bufs);}
+void __stdcall _Lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)  {if (__GLeeLazyLink((void**)&pglStencilOpSeparate, "glStencilOpSeparate", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glStencilOpSeparate(face, sfail, dpfail, dppass);}
+void __stdcall _Lazy_glStencilFuncSeparate(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)  {if (__GLeeLazyLink((void**)&pglStencilFuncSeparate, "glStencilFuncSeparate", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glStencilFuncSeparate(frontfunc, backfunc, ref, mask);}
+void __stdcall _Lazy_glStencilMaskSeparate(GLenum face, GLuint mask)                      {if (__GLeeLazyLink((void**)&pglStencilMaskSeparate, "glStencilMaskSeparate", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glStencilMaskSeparate(face, mask);}
+void __stdcall _Lazy_glAttachShader(GLuint program, GLuint shader)                        {if (__GLeeLazyLink((void**)&pglAttachShader, "glAttachShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glAttachShader(program, shader);}
+void __stdcall _Lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name)  {if (__GLeeLazyLink((void**)&pglBindAttribLocation, "glBindAttribLocation", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glBindAttribLocation(program, index, name);}
+void __stdcall _Lazy_glCompileShader(GLuint shader)                                       {if (__GLeeLazyLink((void**)&pglCompileShader, "glCompileShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glCompileShader(shader);}
+GLuint __stdcall _Lazy_glCreateProgram(void)                                              {if (__GLeeLazyLink((void**)&pglCreateProgram, "glCreateProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glCreateProgram(); return (GLuint)0;}
+GLuint __stdcall _Lazy_glCreateShader(GLenum type)                                        {if (__GLeeLazyLink((void**)&pglCreateShader, "glCreateShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glCreateShader(type); return (GLuint)0;}
+void __stdcall _Lazy_glDeleteProgram(GLuint program)                                      {if (__GLeeLazyLink((void**)&pglDeleteProgram, "glDeleteProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glDeleteProgram(program);}
+void __stdcall _Lazy_glDeleteShader(GLuint shader)                                        {if (__GLeeLazyLink((void**)&pglDeleteShader, "glDeleteShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glDeleteShader(shader);}
+void __stdcall _Lazy_glDetachShader(GLuint program, GLuint shader)                        {if (__GLeeLazyLink((void**)&pglDetachShader, "glDetachShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glDetachShader(program, shader);}
+void __stdcall _Lazy_glDisableVertexAttribArray(GLuint index)                             {if (__GLeeLazyLink((void**)&pglDisableVertexAttribArray, "glDisableVertexAttribArray", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glDisableVertexAttribArray(index);}
+void __stdcall _Lazy_glEnableVertexAttribArray(GLuint index)                              {if (__GLeeLazyLink((void**)&pglEnableVertexAttribArray, "glEnableVertexAttribArray", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glEnableVertexAttribArray(index);}
+void __stdcall _Lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)  {if (__GLeeLazyLink((void**)&pglGetActiveAttrib, "glGetActiveAttrib", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetActiveAttrib(program, index, bufSize, length, size, type, name);}
+void __stdcall _Lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)  {if (__GLeeLazyLink((void**)&pglGetActiveUniform, "glGetActiveUniform", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetActiveUniform(program, index, bufSize, length, size, type, name);}
+void __stdcall _Lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * obj)  {if (__GLeeLazyLink((void**)&pglGetAttachedShaders, "glGetAttachedShaders", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetAttachedShaders(program, maxCount, count, obj);}
+GLint __stdcall _Lazy_glGetAttribLocation(GLuint program, const GLchar * name)            {if (__GLeeLazyLink((void**)&pglGetAttribLocation, "glGetAttribLocation", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glGetAttribLocation(program, name); return (GLint)0;}
+void __stdcall _Lazy_glGetProgramiv(GLuint program, GLenum pname, GLint * params)         {if (__GLeeLazyLink((void**)&pglGetProgramiv, "glGetProgramiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetProgramiv(program, pname, params);}
+void __stdcall _Lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)  {if (__GLeeLazyLink((void**)&pglGetProgramInfoLog, "glGetProgramInfoLog", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetProgramInfoLog(program, bufSize, length, infoLog);}
+void __stdcall _Lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint * params)           {if (__GLeeLazyLink((void**)&pglGetShaderiv, "glGetShaderiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetShaderiv(shader, pname, params);}
+void __stdcall _Lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)  {if (__GLeeLazyLink((void**)&pglGetShaderInfoLog, "glGetShaderInfoLog", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetShaderInfoLog(shader, bufSize, length, infoLog);}
+void __stdcall _Lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)  {if (__GLeeLazyLink((void**)&pglGetShaderSource, "glGetShaderSource", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetShaderSource(shader, bufSize, length, source);}
+GLint __stdcall _Lazy_glGetUniformLocation(GLuint program, const GLchar * name)           {if (__GLeeLazyLink((void**)&pglGetUniformLocation, "glGetUniformLocation", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glGetUniformLocation(program, name); return (GLint)0;}
+void __stdcall _Lazy_glGetUniformfv(GLuint program, GLint location, GLfloat * params)     {if (__GLeeLazyLink((void**)&pglGetUniformfv, "glGetUniformfv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetUniformfv(program, location, params);}
+void __stdcall _Lazy_glGetUniformiv(GLuint program, GLint location, GLint * params)       {if (__GLeeLazyLink((void**)&pglGetUniformiv, "glGetUniformiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetUniformiv(program, location, params);}
+void __stdcall _Lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)   {if (__GLeeLazyLink((void**)&pglGetVertexAttribdv, "glGetVertexAttribdv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetVertexAttribdv(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)    {if (__GLeeLazyLink((void**)&pglGetVertexAttribfv, "glGetVertexAttribfv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetVertexAttribfv(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params)      {if (__GLeeLazyLink((void**)&pglGetVertexAttribiv, "glGetVertexAttribiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetVertexAttribiv(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribPointerv, "glGetVertexAttribPointerv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glGetVertexAttribPointerv(index, pname, pointer);}
+GLboolean __stdcall _Lazy_glIsProgram(GLuint program)                                     {if (__GLeeLazyLink((void**)&pglIsProgram, "glIsProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glIsProgram(program); return (GLboolean)0;}
+GLboolean __stdcall _Lazy_glIsShader(GLuint shader)                                       {if (__GLeeLazyLink((void**)&pglIsShader, "glIsShader", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) return glIsShader(shader); return (GLboolean)0;}
+void __stdcall _Lazy_glLinkProgram(GLuint program)                                        {if (__GLeeLazyLink((void**)&pglLinkProgram, "glLinkProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glLinkProgram(program);}
+void __stdcall _Lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar* * string, const GLint * length)  {if (__GLeeLazyLink((void**)&pglShaderSource, "glShaderSource", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glShaderSource(shader, count, string, length);}
+void __stdcall _Lazy_glUseProgram(GLuint program)                                         {if (__GLeeLazyLink((void**)&pglUseProgram, "glUseProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUseProgram(program);}
+void __stdcall _Lazy_glUniform1f(GLint location, GLfloat v0)                              {if (__GLeeLazyLink((void**)&pglUniform1f, "glUniform1f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform1f(location, v0);}
+void __stdcall _Lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1)                  {if (__GLeeLazyLink((void**)&pglUniform2f, "glUniform2f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform2f(location, v0, v1);}
+void __stdcall _Lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)      {if (__GLeeLazyLink((void**)&pglUniform3f, "glUniform3f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform3f(location, v0, v1, v2);}
+void __stdcall _Lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)  {if (__GLeeLazyLink((void**)&pglUniform4f, "glUniform4f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform4f(location, v0, v1, v2, v3);}
+void __stdcall _Lazy_glUniform1i(GLint location, GLint v0)                                {if (__GLeeLazyLink((void**)&pglUniform1i, "glUniform1i", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform1i(location, v0);}
+void __stdcall _Lazy_glUniform2i(GLint location, GLint v0, GLint v1)                      {if (__GLeeLazyLink((void**)&pglUniform2i, "glUniform2i", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform2i(location, v0, v1);}
+void __stdcall _Lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)            {if (__GLeeLazyLink((void**)&pglUniform3i, "glUniform3i", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform3i(location, v0, v1, v2);}
+void __stdcall _Lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)  {if (__GLeeLazyLink((void**)&pglUniform4i, "glUniform4i", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform4i(location, v0, v1, v2, v3);}
+void __stdcall _Lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat * value)   {if (__GLeeLazyLink((void**)&pglUniform1fv, "glUniform1fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform1fv(location, count, value);}
+void __stdcall _Lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat * value)   {if (__GLeeLazyLink((void**)&pglUniform2fv, "glUniform2fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform2fv(location, count, value);}
+void __stdcall _Lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat * value)   {if (__GLeeLazyLink((void**)&pglUniform3fv, "glUniform3fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform3fv(location, count, value);}
+void __stdcall _Lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat * value)   {if (__GLeeLazyLink((void**)&pglUniform4fv, "glUniform4fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform4fv(location, count, value);}
+void __stdcall _Lazy_glUniform1iv(GLint location, GLsizei count, const GLint * value)     {if (__GLeeLazyLink((void**)&pglUniform1iv, "glUniform1iv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform1iv(location, count, value);}
+void __stdcall _Lazy_glUniform2iv(GLint location, GLsizei count, const GLint * value)     {if (__GLeeLazyLink((void**)&pglUniform2iv, "glUniform2iv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform2iv(location, count, value);}
+void __stdcall _Lazy_glUniform3iv(GLint location, GLsizei count, const GLint * value)     {if (__GLeeLazyLink((void**)&pglUniform3iv, "glUniform3iv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform3iv(location, count, value);}
+void __stdcall _Lazy_glUniform4iv(GLint location, GLsizei count, const GLint * value)     {if (__GLeeLazyLink((void**)&pglUniform4iv, "glUniform4iv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniform4iv(location, count, value);}
+void __stdcall _Lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix2fv, "glUniformMatrix2fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniformMatrix2fv(location, count, transpose, value);}
+void __stdcall _Lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix3fv, "glUniformMatrix3fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniformMatrix3fv(location, count, transpose, value);}
+void __stdcall _Lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix4fv, "glUniformMatrix4fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glUniformMatrix4fv(location, count, transpose, value);}
+void __stdcall _Lazy_glValidateProgram(GLuint program)                                    {if (__GLeeLazyLink((void**)&pglValidateProgram, "glValidateProgram", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glValidateProgram(program);}
+void __stdcall _Lazy_glVertexAttrib1d(GLuint index, GLdouble x)                           {if (__GLeeLazyLink((void**)&pglVertexAttrib1d, "glVertexAttrib1d", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1d(index, x);}
+void __stdcall _Lazy_glVertexAttrib1dv(GLuint index, const GLdouble * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib1dv, "glVertexAttrib1dv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1dv(index, v);}
+void __stdcall _Lazy_glVertexAttrib1f(GLuint index, GLfloat x)                            {if (__GLeeLazyLink((void**)&pglVertexAttrib1f, "glVertexAttrib1f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1f(index, x);}
+void __stdcall _Lazy_glVertexAttrib1fv(GLuint index, const GLfloat * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib1fv, "glVertexAttrib1fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1fv(index, v);}
+void __stdcall _Lazy_glVertexAttrib1s(GLuint index, GLshort x)                            {if (__GLeeLazyLink((void**)&pglVertexAttrib1s, "glVertexAttrib1s", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1s(index, x);}
+void __stdcall _Lazy_glVertexAttrib1sv(GLuint index, const GLshort * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib1sv, "glVertexAttrib1sv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib1sv(index, v);}
+void __stdcall _Lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)               {if (__GLeeLazyLink((void**)&pglVertexAttrib2d, "glVertexAttrib2d", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2d(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2dv(GLuint index, const GLdouble * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib2dv, "glVertexAttrib2dv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2dv(index, v);}
+void __stdcall _Lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib2f, "glVertexAttrib2f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2f(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2fv(GLuint index, const GLfloat * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib2fv, "glVertexAttrib2fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2fv(index, v);}
+void __stdcall _Lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib2s, "glVertexAttrib2s", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2s(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2sv(GLuint index, const GLshort * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib2sv, "glVertexAttrib2sv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib2sv(index, v);}
+void __stdcall _Lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)   {if (__GLeeLazyLink((void**)&pglVertexAttrib3d, "glVertexAttrib3d", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3d(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3dv(GLuint index, const GLdouble * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib3dv, "glVertexAttrib3dv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3dv(index, v);}
+void __stdcall _Lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)      {if (__GLeeLazyLink((void**)&pglVertexAttrib3f, "glVertexAttrib3f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3f(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3fv(GLuint index, const GLfloat * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib3fv, "glVertexAttrib3fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3fv(index, v);}
+void __stdcall _Lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)      {if (__GLeeLazyLink((void**)&pglVertexAttrib3s, "glVertexAttrib3s", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3s(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3sv(GLuint index, const GLshort * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib3sv, "glVertexAttrib3sv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib3sv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nbv, "glVertexAttrib4Nbv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nbv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Niv(GLuint index, const GLint * v)                    {if (__GLeeLazyLink((void**)&pglVertexAttrib4Niv, "glVertexAttrib4Niv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Niv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Nsv(GLuint index, const GLshort * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nsv, "glVertexAttrib4Nsv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nsv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nub, "glVertexAttrib4Nub", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nub(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nubv, "glVertexAttrib4Nubv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nubv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nuiv, "glVertexAttrib4Nuiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nuiv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4Nusv(GLuint index, const GLushort * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4Nusv, "glVertexAttrib4Nusv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4Nusv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4bv(GLuint index, const GLbyte * v)                    {if (__GLeeLazyLink((void**)&pglVertexAttrib4bv, "glVertexAttrib4bv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4bv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4d, "glVertexAttrib4d", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4d(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4dv(GLuint index, const GLdouble * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib4dv, "glVertexAttrib4dv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4dv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4f, "glVertexAttrib4f", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4f(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4fv(GLuint index, const GLfloat * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib4fv, "glVertexAttrib4fv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4fv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4iv(GLuint index, const GLint * v)                     {if (__GLeeLazyLink((void**)&pglVertexAttrib4iv, "glVertexAttrib4iv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4iv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4s, "glVertexAttrib4s", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4s(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4sv(GLuint index, const GLshort * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib4sv, "glVertexAttrib4sv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4sv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4ubv(GLuint index, const GLubyte * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib4ubv, "glVertexAttrib4ubv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4ubv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4uiv(GLuint index, const GLuint * v)                   {if (__GLeeLazyLink((void**)&pglVertexAttrib4uiv, "glVertexAttrib4uiv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4uiv(index, v);}
+void __stdcall _Lazy_glVertexAttrib4usv(GLuint index, const GLushort * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4usv, "glVertexAttrib4usv", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttrib4usv(index, v);}
+void __stdcall _Lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglVertexAttribPointer, "glVertexAttribPointer", &_GLEE_VERSION_2_0, "GL_VERSION_2_0")) glVertexAttribPointer(index, size, type, normalized, stride, pointer);}
 PFNGLBLENDEQUATIONSEPARATEPROC pglBlendEquationSeparate=_Lazy_glBlendEquationSeparate;
 PFNGLDRAWBUFFERSPROC pglDrawBuffers=_Lazy_glDrawBuffers;
 PFNGLSTENCILOPSEPARATEPROC pglStencilOpSeparate=_Lazy_glStencilOpSeparate;
@@ -1135,40 +1167,40 @@ PFNGLVERTEXATTRIBPOINTERPROC pglVertexAttribPointer=_Lazy_glVertexAttribPointer;
 //GL_ARB_multitexture
 
 #ifdef __GLEE_GL_ARB_multitexture
-void __stdcall _Lazy_glActiveTextureARB(GLenum texture)                                   {if (GLeeInit()) glActiveTextureARB(texture);}
-void __stdcall _Lazy_glClientActiveTextureARB(GLenum texture)                             {if (GLeeInit()) glClientActiveTextureARB(texture);}
-void __stdcall _Lazy_glMultiTexCoord1dARB(GLenum target, GLdouble s)                      {if (GLeeInit()) glMultiTexCoord1dARB(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1dvARB(GLenum target, const GLdouble * v)             {if (GLeeInit()) glMultiTexCoord1dvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1fARB(GLenum target, GLfloat s)                       {if (GLeeInit()) glMultiTexCoord1fARB(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1fvARB(GLenum target, const GLfloat * v)              {if (GLeeInit()) glMultiTexCoord1fvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1iARB(GLenum target, GLint s)                         {if (GLeeInit()) glMultiTexCoord1iARB(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1ivARB(GLenum target, const GLint * v)                {if (GLeeInit()) glMultiTexCoord1ivARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord1sARB(GLenum target, GLshort s)                       {if (GLeeInit()) glMultiTexCoord1sARB(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1svARB(GLenum target, const GLshort * v)              {if (GLeeInit()) glMultiTexCoord1svARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)          {if (GLeeInit()) glMultiTexCoord2dARB(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2dvARB(GLenum target, const GLdouble * v)             {if (GLeeInit()) glMultiTexCoord2dvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)            {if (GLeeInit()) glMultiTexCoord2fARB(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2fvARB(GLenum target, const GLfloat * v)              {if (GLeeInit()) glMultiTexCoord2fvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)                {if (GLeeInit()) glMultiTexCoord2iARB(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2ivARB(GLenum target, const GLint * v)                {if (GLeeInit()) glMultiTexCoord2ivARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)            {if (GLeeInit()) glMultiTexCoord2sARB(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2svARB(GLenum target, const GLshort * v)              {if (GLeeInit()) glMultiTexCoord2svARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)  {if (GLeeInit()) glMultiTexCoord3dARB(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3dvARB(GLenum target, const GLdouble * v)             {if (GLeeInit()) glMultiTexCoord3dvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)  {if (GLeeInit()) glMultiTexCoord3fARB(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3fvARB(GLenum target, const GLfloat * v)              {if (GLeeInit()) glMultiTexCoord3fvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)       {if (GLeeInit()) glMultiTexCoord3iARB(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3ivARB(GLenum target, const GLint * v)                {if (GLeeInit()) glMultiTexCoord3ivARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)  {if (GLeeInit()) glMultiTexCoord3sARB(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3svARB(GLenum target, const GLshort * v)              {if (GLeeInit()) glMultiTexCoord3svARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)  {if (GLeeInit()) glMultiTexCoord4dARB(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4dvARB(GLenum target, const GLdouble * v)             {if (GLeeInit()) glMultiTexCoord4dvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)  {if (GLeeInit()) glMultiTexCoord4fARB(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4fvARB(GLenum target, const GLfloat * v)              {if (GLeeInit()) glMultiTexCoord4fvARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)  {if (GLeeInit()) glMultiTexCoord4iARB(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4ivARB(GLenum target, const GLint * v)                {if (GLeeInit()) glMultiTexCoord4ivARB(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)  {if (GLeeInit()) glMultiTexCoord4sARB(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4svARB(GLenum target, const GLshort * v)              {if (GLeeInit()) glMultiTexCoord4svARB(target, v);}
+void __stdcall _Lazy_glActiveTextureARB(GLenum texture)                                   {if (__GLeeLazyLink((void**)&pglActiveTextureARB, "glActiveTextureARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glActiveTextureARB(texture);}
+void __stdcall _Lazy_glClientActiveTextureARB(GLenum texture)                             {if (__GLeeLazyLink((void**)&pglClientActiveTextureARB, "glClientActiveTextureARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glClientActiveTextureARB(texture);}
+void __stdcall _Lazy_glMultiTexCoord1dARB(GLenum target, GLdouble s)                      {if (__GLeeLazyLink((void**)&pglMultiTexCoord1dARB, "glMultiTexCoord1dARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1dARB(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1dvARB(GLenum target, const GLdouble * v)             {if (__GLeeLazyLink((void**)&pglMultiTexCoord1dvARB, "glMultiTexCoord1dvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1dvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1fARB(GLenum target, GLfloat s)                       {if (__GLeeLazyLink((void**)&pglMultiTexCoord1fARB, "glMultiTexCoord1fARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1fARB(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1fvARB(GLenum target, const GLfloat * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord1fvARB, "glMultiTexCoord1fvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1fvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1iARB(GLenum target, GLint s)                         {if (__GLeeLazyLink((void**)&pglMultiTexCoord1iARB, "glMultiTexCoord1iARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1iARB(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1ivARB(GLenum target, const GLint * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord1ivARB, "glMultiTexCoord1ivARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1ivARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord1sARB(GLenum target, GLshort s)                       {if (__GLeeLazyLink((void**)&pglMultiTexCoord1sARB, "glMultiTexCoord1sARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1sARB(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1svARB(GLenum target, const GLshort * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord1svARB, "glMultiTexCoord1svARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord1svARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)          {if (__GLeeLazyLink((void**)&pglMultiTexCoord2dARB, "glMultiTexCoord2dARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2dARB(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2dvARB(GLenum target, const GLdouble * v)             {if (__GLeeLazyLink((void**)&pglMultiTexCoord2dvARB, "glMultiTexCoord2dvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2dvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)            {if (__GLeeLazyLink((void**)&pglMultiTexCoord2fARB, "glMultiTexCoord2fARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2fARB(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2fvARB(GLenum target, const GLfloat * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord2fvARB, "glMultiTexCoord2fvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2fvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord2iARB, "glMultiTexCoord2iARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2iARB(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2ivARB(GLenum target, const GLint * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord2ivARB, "glMultiTexCoord2ivARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2ivARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)            {if (__GLeeLazyLink((void**)&pglMultiTexCoord2sARB, "glMultiTexCoord2sARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2sARB(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2svARB(GLenum target, const GLshort * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord2svARB, "glMultiTexCoord2svARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord2svARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord3dARB, "glMultiTexCoord3dARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3dARB(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3dvARB(GLenum target, const GLdouble * v)             {if (__GLeeLazyLink((void**)&pglMultiTexCoord3dvARB, "glMultiTexCoord3dvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3dvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord3fARB, "glMultiTexCoord3fARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3fARB(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3fvARB(GLenum target, const GLfloat * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord3fvARB, "glMultiTexCoord3fvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3fvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)       {if (__GLeeLazyLink((void**)&pglMultiTexCoord3iARB, "glMultiTexCoord3iARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3iARB(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3ivARB(GLenum target, const GLint * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord3ivARB, "glMultiTexCoord3ivARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3ivARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord3sARB, "glMultiTexCoord3sARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3sARB(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3svARB(GLenum target, const GLshort * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord3svARB, "glMultiTexCoord3svARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord3svARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4dARB, "glMultiTexCoord4dARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4dARB(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4dvARB(GLenum target, const GLdouble * v)             {if (__GLeeLazyLink((void**)&pglMultiTexCoord4dvARB, "glMultiTexCoord4dvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4dvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4fARB, "glMultiTexCoord4fARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4fARB(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4fvARB(GLenum target, const GLfloat * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord4fvARB, "glMultiTexCoord4fvARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4fvARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4iARB, "glMultiTexCoord4iARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4iARB(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4ivARB(GLenum target, const GLint * v)                {if (__GLeeLazyLink((void**)&pglMultiTexCoord4ivARB, "glMultiTexCoord4ivARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4ivARB(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4sARB, "glMultiTexCoord4sARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4sARB(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4svARB(GLenum target, const GLshort * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord4svARB, "glMultiTexCoord4svARB", &_GLEE_ARB_multitexture, "GL_ARB_multitexture")) glMultiTexCoord4svARB(target, v);}
 PFNGLACTIVETEXTUREARBPROC pglActiveTextureARB=_Lazy_glActiveTextureARB;
 PFNGLCLIENTACTIVETEXTUREARBPROC pglClientActiveTextureARB=_Lazy_glClientActiveTextureARB;
 PFNGLMULTITEXCOORD1DARBPROC pglMultiTexCoord1dARB=_Lazy_glMultiTexCoord1dARB;
@@ -1208,10 +1240,10 @@ PFNGLMULTITEXCOORD4SVARBPROC pglMultiTexCoord4svARB=_Lazy_glMultiTexCoord4svARB;
 //GL_ARB_transpose_matrix
 
 #ifdef __GLEE_GL_ARB_transpose_matrix
-void __stdcall _Lazy_glLoadTransposeMatrixfARB(const GLfloat * m)                         {if (GLeeInit()) glLoadTransposeMatrixfARB(m);}
-void __stdcall _Lazy_glLoadTransposeMatrixdARB(const GLdouble * m)                        {if (GLeeInit()) glLoadTransposeMatrixdARB(m);}
-void __stdcall _Lazy_glMultTransposeMatrixfARB(const GLfloat * m)                         {if (GLeeInit()) glMultTransposeMatrixfARB(m);}
-void __stdcall _Lazy_glMultTransposeMatrixdARB(const GLdouble * m)                        {if (GLeeInit()) glMultTransposeMatrixdARB(m);}
+void __stdcall _Lazy_glLoadTransposeMatrixfARB(const GLfloat * m)                         {if (__GLeeLazyLink((void**)&pglLoadTransposeMatrixfARB, "glLoadTransposeMatrixfARB", &_GLEE_ARB_transpose_matrix, "GL_ARB_transpose_matrix")) glLoadTransposeMatrixfARB(m);}
+void __stdcall _Lazy_glLoadTransposeMatrixdARB(const GLdouble * m)                        {if (__GLeeLazyLink((void**)&pglLoadTransposeMatrixdARB, "glLoadTransposeMatrixdARB", &_GLEE_ARB_transpose_matrix, "GL_ARB_transpose_matrix")) glLoadTransposeMatrixdARB(m);}
+void __stdcall _Lazy_glMultTransposeMatrixfARB(const GLfloat * m)                         {if (__GLeeLazyLink((void**)&pglMultTransposeMatrixfARB, "glMultTransposeMatrixfARB", &_GLEE_ARB_transpose_matrix, "GL_ARB_transpose_matrix")) glMultTransposeMatrixfARB(m);}
+void __stdcall _Lazy_glMultTransposeMatrixdARB(const GLdouble * m)                        {if (__GLeeLazyLink((void**)&pglMultTransposeMatrixdARB, "glMultTransposeMatrixdARB", &_GLEE_ARB_transpose_matrix, "GL_ARB_transpose_matrix")) glMultTransposeMatrixdARB(m);}
 PFNGLLOADTRANSPOSEMATRIXFARBPROC pglLoadTransposeMatrixfARB=_Lazy_glLoadTransposeMatrixfARB;
 PFNGLLOADTRANSPOSEMATRIXDARBPROC pglLoadTransposeMatrixdARB=_Lazy_glLoadTransposeMatrixdARB;
 PFNGLMULTTRANSPOSEMATRIXFARBPROC pglMultTransposeMatrixfARB=_Lazy_glMultTransposeMatrixfARB;
@@ -1221,7 +1253,7 @@ PFNGLMULTTRANSPOSEMATRIXDARBPROC pglMultTransposeMatrixdARB=_Lazy_glMultTranspos
 //GL_ARB_multisample
 
 #ifdef __GLEE_GL_ARB_multisample
-void __stdcall _Lazy_glSampleCoverageARB(GLclampf value, GLboolean invert)                {if (GLeeInit()) glSampleCoverageARB(value, invert);}
+void __stdcall _Lazy_glSampleCoverageARB(GLclampf value, GLboolean invert)                {if (__GLeeLazyLink((void**)&pglSampleCoverageARB, "glSampleCoverageARB", &_GLEE_ARB_multisample, "GL_ARB_multisample")) glSampleCoverageARB(value, invert);}
 PFNGLSAMPLECOVERAGEARBPROC pglSampleCoverageARB=_Lazy_glSampleCoverageARB;
 #endif 
 
@@ -1238,13 +1270,13 @@ PFNGLSAMPLECOVERAGEARBPROC pglSampleCoverageARB=_Lazy_glSampleCoverageARB;
 //GL_ARB_texture_compression
 
 #ifdef __GLEE_GL_ARB_texture_compression
-void __stdcall _Lazy_glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);}
-void __stdcall _Lazy_glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (GLeeInit()) glCompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);}
-void __stdcall _Lazy_glGetCompressedTexImageARB(GLenum target, GLint level, GLvoid * img)  {if (GLeeInit()) glGetCompressedTexImageARB(target, level, img);}
+void __stdcall _Lazy_glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage3DARB, "glCompressedTexImage3DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage2DARB, "glCompressedTexImage2DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexImage1DARB, "glCompressedTexImage1DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage3DARB, "glCompressedTexSubImage3DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage2DARB, "glCompressedTexSubImage2DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);}
+void __stdcall _Lazy_glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglCompressedTexSubImage1DARB, "glCompressedTexSubImage1DARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glCompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);}
+void __stdcall _Lazy_glGetCompressedTexImageARB(GLenum target, GLint level, GLvoid * img)  {if (__GLeeLazyLink((void**)&pglGetCompressedTexImageARB, "glGetCompressedTexImageARB", &_GLEE_ARB_texture_compression, "GL_ARB_texture_compression")) glGetCompressedTexImageARB(target, level, img);}
 PFNGLCOMPRESSEDTEXIMAGE3DARBPROC pglCompressedTexImage3DARB=_Lazy_glCompressedTexImage3DARB;
 PFNGLCOMPRESSEDTEXIMAGE2DARBPROC pglCompressedTexImage2DARB=_Lazy_glCompressedTexImage2DARB;
 PFNGLCOMPRESSEDTEXIMAGE1DARBPROC pglCompressedTexImage1DARB=_Lazy_glCompressedTexImage1DARB;
@@ -1262,8 +1294,8 @@ PFNGLGETCOMPRESSEDTEXIMAGEARBPROC pglGetCompressedTexImageARB=_Lazy_glGetCompres
 //GL_ARB_point_parameters
 
 #ifdef __GLEE_GL_ARB_point_parameters
-void __stdcall _Lazy_glPointParameterfARB(GLenum pname, GLfloat param)                    {if (GLeeInit()) glPointParameterfARB(pname, param);}
-void __stdcall _Lazy_glPointParameterfvARB(GLenum pname, const GLfloat * params)          {if (GLeeInit()) glPointParameterfvARB(pname, params);}
+void __stdcall _Lazy_glPointParameterfARB(GLenum pname, GLfloat param)                    {if (__GLeeLazyLink((void**)&pglPointParameterfARB, "glPointParameterfARB", &_GLEE_ARB_point_parameters, "GL_ARB_point_parameters")) glPointParameterfARB(pname, param);}
+void __stdcall _Lazy_glPointParameterfvARB(GLenum pname, const GLfloat * params)          {if (__GLeeLazyLink((void**)&pglPointParameterfvARB, "glPointParameterfvARB", &_GLEE_ARB_point_parameters, "GL_ARB_point_parameters")) glPointParameterfvARB(pname, params);}
 PFNGLPOINTPARAMETERFARBPROC pglPointParameterfARB=_Lazy_glPointParameterfARB;
 PFNGLPOINTPARAMETERFVARBPROC pglPointParameterfvARB=_Lazy_glPointParameterfvARB;
 #endif 
@@ -1271,16 +1303,16 @@ PFNGLPOINTPARAMETERFVARBPROC pglPointParameterfvARB=_Lazy_glPointParameterfvARB;
 //GL_ARB_vertex_blend
 
 #ifdef __GLEE_GL_ARB_vertex_blend
-void __stdcall _Lazy_glWeightbvARB(GLint size, const GLbyte * weights)                    {if (GLeeInit()) glWeightbvARB(size, weights);}
-void __stdcall _Lazy_glWeightsvARB(GLint size, const GLshort * weights)                   {if (GLeeInit()) glWeightsvARB(size, weights);}
-void __stdcall _Lazy_glWeightivARB(GLint size, const GLint * weights)                     {if (GLeeInit()) glWeightivARB(size, weights);}
-void __stdcall _Lazy_glWeightfvARB(GLint size, const GLfloat * weights)                   {if (GLeeInit()) glWeightfvARB(size, weights);}
-void __stdcall _Lazy_glWeightdvARB(GLint size, const GLdouble * weights)                  {if (GLeeInit()) glWeightdvARB(size, weights);}
-void __stdcall _Lazy_glWeightubvARB(GLint size, const GLubyte * weights)                  {if (GLeeInit()) glWeightubvARB(size, weights);}
-void __stdcall _Lazy_glWeightusvARB(GLint size, const GLushort * weights)                 {if (GLeeInit()) glWeightusvARB(size, weights);}
-void __stdcall _Lazy_glWeightuivARB(GLint size, const GLuint * weights)                   {if (GLeeInit()) glWeightuivARB(size, weights);}
-void __stdcall _Lazy_glWeightPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glWeightPointerARB(size, type, stride, pointer);}
-void __stdcall _Lazy_glVertexBlendARB(GLint count)                                        {if (GLeeInit()) glVertexBlendARB(count);}
+void __stdcall _Lazy_glWeightbvARB(GLint size, const GLbyte * weights)                    {if (__GLeeLazyLink((void**)&pglWeightbvARB, "glWeightbvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightbvARB(size, weights);}
+void __stdcall _Lazy_glWeightsvARB(GLint size, const GLshort * weights)                   {if (__GLeeLazyLink((void**)&pglWeightsvARB, "glWeightsvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightsvARB(size, weights);}
+void __stdcall _Lazy_glWeightivARB(GLint size, const GLint * weights)                     {if (__GLeeLazyLink((void**)&pglWeightivARB, "glWeightivARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightivARB(size, weights);}
+void __stdcall _Lazy_glWeightfvARB(GLint size, const GLfloat * weights)                   {if (__GLeeLazyLink((void**)&pglWeightfvARB, "glWeightfvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightfvARB(size, weights);}
+void __stdcall _Lazy_glWeightdvARB(GLint size, const GLdouble * weights)                  {if (__GLeeLazyLink((void**)&pglWeightdvARB, "glWeightdvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightdvARB(size, weights);}
+void __stdcall _Lazy_glWeightubvARB(GLint size, const GLubyte * weights)                  {if (__GLeeLazyLink((void**)&pglWeightubvARB, "glWeightubvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightubvARB(size, weights);}
+void __stdcall _Lazy_glWeightusvARB(GLint size, const GLushort * weights)                 {if (__GLeeLazyLink((void**)&pglWeightusvARB, "glWeightusvARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightusvARB(size, weights);}
+void __stdcall _Lazy_glWeightuivARB(GLint size, const GLuint * weights)                   {if (__GLeeLazyLink((void**)&pglWeightuivARB, "glWeightuivARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightuivARB(size, weights);}
+void __stdcall _Lazy_glWeightPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglWeightPointerARB, "glWeightPointerARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glWeightPointerARB(size, type, stride, pointer);}
+void __stdcall _Lazy_glVertexBlendARB(GLint count)                                        {if (__GLeeLazyLink((void**)&pglVertexBlendARB, "glVertexBlendARB", &_GLEE_ARB_vertex_blend, "GL_ARB_vertex_blend")) glVertexBlendARB(count);}
 PFNGLWEIGHTBVARBPROC pglWeightbvARB=_Lazy_glWeightbvARB;
 PFNGLWEIGHTSVARBPROC pglWeightsvARB=_Lazy_glWeightsvARB;
 PFNGLWEIGHTIVARBPROC pglWeightivARB=_Lazy_glWeightivARB;
@@ -1296,11 +1328,11 @@ PFNGLVERTEXBLENDARBPROC pglVertexBlendARB=_Lazy_glVertexBlendARB;
 //GL_ARB_matrix_palette
 
 #ifdef __GLEE_GL_ARB_matrix_palette
-void __stdcall _Lazy_glCurrentPaletteMatrixARB(GLint index)                               {if (GLeeInit()) glCurrentPaletteMatrixARB(index);}
-void __stdcall _Lazy_glMatrixIndexubvARB(GLint size, const GLubyte * indices)             {if (GLeeInit()) glMatrixIndexubvARB(size, indices);}
-void __stdcall _Lazy_glMatrixIndexusvARB(GLint size, const GLushort * indices)            {if (GLeeInit()) glMatrixIndexusvARB(size, indices);}
-void __stdcall _Lazy_glMatrixIndexuivARB(GLint size, const GLuint * indices)              {if (GLeeInit()) glMatrixIndexuivARB(size, indices);}
-void __stdcall _Lazy_glMatrixIndexPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glMatrixIndexPointerARB(size, type, stride, pointer);}
+void __stdcall _Lazy_glCurrentPaletteMatrixARB(GLint index)                               {if (__GLeeLazyLink((void**)&pglCurrentPaletteMatrixARB, "glCurrentPaletteMatrixARB", &_GLEE_ARB_matrix_palette, "GL_ARB_matrix_palette")) glCurrentPaletteMatrixARB(index);}
+void __stdcall _Lazy_glMatrixIndexubvARB(GLint size, const GLubyte * indices)             {if (__GLeeLazyLink((void**)&pglMatrixIndexubvARB, "glMatrixIndexubvARB", &_GLEE_ARB_matrix_palette, "GL_ARB_matrix_palette")) glMatrixIndexubvARB(size, indices);}
+void __stdcall _Lazy_glMatrixIndexusvARB(GLint size, const GLushort * indices)            {if (__GLeeLazyLink((void**)&pglMatrixIndexusvARB, "glMatrixIndexusvARB", &_GLEE_ARB_matrix_palette, "GL_ARB_matrix_palette")) glMatrixIndexusvARB(size, indices);}
+void __stdcall _Lazy_glMatrixIndexuivARB(GLint size, const GLuint * indices)              {if (__GLeeLazyLink((void**)&pglMatrixIndexuivARB, "glMatrixIndexuivARB", &_GLEE_ARB_matrix_palette, "GL_ARB_matrix_palette")) glMatrixIndexuivARB(size, indices);}
+void __stdcall _Lazy_glMatrixIndexPointerARB(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglMatrixIndexPointerARB, "glMatrixIndexPointerARB", &_GLEE_ARB_matrix_palette, "GL_ARB_matrix_palette")) glMatrixIndexPointerARB(size, type, stride, pointer);}
 PFNGLCURRENTPALETTEMATRIXARBPROC pglCurrentPaletteMatrixARB=_Lazy_glCurrentPaletteMatrixARB;
 PFNGLMATRIXINDEXUBVARBPROC pglMatrixIndexubvARB=_Lazy_glMatrixIndexubvARB;
 PFNGLMATRIXINDEXUSVARBPROC pglMatrixIndexusvARB=_Lazy_glMatrixIndexusvARB;
@@ -1346,22 +1378,22 @@ PFNGLMATRIXINDEXPOINTERARBPROC pglMatrixIndexPointerARB=_Lazy_glMatrixIndexPoint
 //GL_ARB_window_pos
 
 #ifdef __GLEE_GL_ARB_window_pos
-void __stdcall _Lazy_glWindowPos2dARB(GLdouble x, GLdouble y)                             {if (GLeeInit()) glWindowPos2dARB(x, y);}
-void __stdcall _Lazy_glWindowPos2dvARB(const GLdouble * v)                                {if (GLeeInit()) glWindowPos2dvARB(v);}
-void __stdcall _Lazy_glWindowPos2fARB(GLfloat x, GLfloat y)                               {if (GLeeInit()) glWindowPos2fARB(x, y);}
-void __stdcall _Lazy_glWindowPos2fvARB(const GLfloat * v)                                 {if (GLeeInit()) glWindowPos2fvARB(v);}
-void __stdcall _Lazy_glWindowPos2iARB(GLint x, GLint y)                                   {if (GLeeInit()) glWindowPos2iARB(x, y);}
-void __stdcall _Lazy_glWindowPos2ivARB(const GLint * v)                                   {if (GLeeInit()) glWindowPos2ivARB(v);}
-void __stdcall _Lazy_glWindowPos2sARB(GLshort x, GLshort y)                               {if (GLeeInit()) glWindowPos2sARB(x, y);}
-void __stdcall _Lazy_glWindowPos2svARB(const GLshort * v)                                 {if (GLeeInit()) glWindowPos2svARB(v);}
-void __stdcall _Lazy_glWindowPos3dARB(GLdouble x, GLdouble y, GLdouble z)                 {if (GLeeInit()) glWindowPos3dARB(x, y, z);}
-void __stdcall _Lazy_glWindowPos3dvARB(const GLdouble * v)                                {if (GLeeInit()) glWindowPos3dvARB(v);}
-void __stdcall _Lazy_glWindowPos3fARB(GLfloat x, GLfloat y, GLfloat z)                    {if (GLeeInit()) glWindowPos3fARB(x, y, z);}
-void __stdcall _Lazy_glWindowPos3fvARB(const GLfloat * v)                                 {if (GLeeInit()) glWindowPos3fvARB(v);}
-void __stdcall _Lazy_glWindowPos3iARB(GLint x, GLint y, GLint z)                          {if (GLeeInit()) glWindowPos3iARB(x, y, z);}
-void __stdcall _Lazy_glWindowPos3ivARB(const GLint * v)                                   {if (GLeeInit()) glWindowPos3ivARB(v);}
-void __stdcall _Lazy_glWindowPos3sARB(GLshort x, GLshort y, GLshort z)                    {if (GLeeInit()) glWindowPos3sARB(x, y, z);}
-void __stdcall _Lazy_glWindowPos3svARB(const GLshort * v)                                 {if (GLeeInit()) glWindowPos3svARB(v);}
+void __stdcall _Lazy_glWindowPos2dARB(GLdouble x, GLdouble y)                             {if (__GLeeLazyLink((void**)&pglWindowPos2dARB, "glWindowPos2dARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2dARB(x, y);}
+void __stdcall _Lazy_glWindowPos2dvARB(const GLdouble * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos2dvARB, "glWindowPos2dvARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2dvARB(v);}
+void __stdcall _Lazy_glWindowPos2fARB(GLfloat x, GLfloat y)                               {if (__GLeeLazyLink((void**)&pglWindowPos2fARB, "glWindowPos2fARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2fARB(x, y);}
+void __stdcall _Lazy_glWindowPos2fvARB(const GLfloat * v)                                 {if (__GLeeLazyLink((void**)&pglWindowPos2fvARB, "glWindowPos2fvARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2fvARB(v);}
+void __stdcall _Lazy_glWindowPos2iARB(GLint x, GLint y)                                   {if (__GLeeLazyLink((void**)&pglWindowPos2iARB, "glWindowPos2iARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2iARB(x, y);}
+void __stdcall _Lazy_glWindowPos2ivARB(const GLint * v)                                   {if (__GLeeLazyLink((void**)&pglWindowPos2ivARB, "glWindowPos2ivARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2ivARB(v);}
+void __stdcall _Lazy_glWindowPos2sARB(GLshort x, GLshort y)                               {if (__GLeeLazyLink((void**)&pglWindowPos2sARB, "glWindowPos2sARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2sARB(x, y);}
+void __stdcall _Lazy_glWindowPos2svARB(const GLshort * v)                                 {if (__GLeeLazyLink((void**)&pglWindowPos2svARB, "glWindowPos2svARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos2svARB(v);}
+void __stdcall _Lazy_glWindowPos3dARB(GLdouble x, GLdouble y, GLdouble z)                 {if (__GLeeLazyLink((void**)&pglWindowPos3dARB, "glWindowPos3dARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3dARB(x, y, z);}
+void __stdcall _Lazy_glWindowPos3dvARB(const GLdouble * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos3dvARB, "glWindowPos3dvARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3dvARB(v);}
+void __stdcall _Lazy_glWindowPos3fARB(GLfloat x, GLfloat y, GLfloat z)                    {if (__GLeeLazyLink((void**)&pglWindowPos3fARB, "glWindowPos3fARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3fARB(x, y, z);}
+void __stdcall _Lazy_glWindowPos3fvARB(const GLfloat * v)                                 {if (__GLeeLazyLink((void**)&pglWindowPos3fvARB, "glWindowPos3fvARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3fvARB(v);}
+void __stdcall _Lazy_glWindowPos3iARB(GLint x, GLint y, GLint z)                          {if (__GLeeLazyLink((void**)&pglWindowPos3iARB, "glWindowPos3iARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3iARB(x, y, z);}
+void __stdcall _Lazy_glWindowPos3ivARB(const GLint * v)                                   {if (__GLeeLazyLink((void**)&pglWindowPos3ivARB, "glWindowPos3ivARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3ivARB(v);}
+void __stdcall _Lazy_glWindowPos3sARB(GLshort x, GLshort y, GLshort z)                    {if (__GLeeLazyLink((void**)&pglWindowPos3sARB, "glWindowPos3sARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3sARB(x, y, z);}
+void __stdcall _Lazy_glWindowPos3svARB(const GLshort * v)                                 {if (__GLeeLazyLink((void**)&pglWindowPos3svARB, "glWindowPos3svARB", &_GLEE_ARB_window_pos, "GL_ARB_window_pos")) glWindowPos3svARB(v);}
 PFNGLWINDOWPOS2DARBPROC pglWindowPos2dARB=_Lazy_glWindowPos2dARB;
 PFNGLWINDOWPOS2DVARBPROC pglWindowPos2dvARB=_Lazy_glWindowPos2dvARB;
 PFNGLWINDOWPOS2FARBPROC pglWindowPos2fARB=_Lazy_glWindowPos2fARB;
@@ -1383,68 +1415,68 @@ PFNGLWINDOWPOS3SVARBPROC pglWindowPos3svARB=_Lazy_glWindowPos3svARB;
 //GL_ARB_vertex_program
 
 #ifdef __GLEE_GL_ARB_vertex_program
-void __stdcall _Lazy_glVertexAttrib1dARB(GLuint index, GLdouble x)                        {if (GLeeInit()) glVertexAttrib1dARB(index, x);}
-void __stdcall _Lazy_glVertexAttrib1dvARB(GLuint index, const GLdouble * v)               {if (GLeeInit()) glVertexAttrib1dvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib1fARB(GLuint index, GLfloat x)                         {if (GLeeInit()) glVertexAttrib1fARB(index, x);}
-void __stdcall _Lazy_glVertexAttrib1fvARB(GLuint index, const GLfloat * v)                {if (GLeeInit()) glVertexAttrib1fvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib1sARB(GLuint index, GLshort x)                         {if (GLeeInit()) glVertexAttrib1sARB(index, x);}
-void __stdcall _Lazy_glVertexAttrib1svARB(GLuint index, const GLshort * v)                {if (GLeeInit()) glVertexAttrib1svARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)            {if (GLeeInit()) glVertexAttrib2dARB(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2dvARB(GLuint index, const GLdouble * v)               {if (GLeeInit()) glVertexAttrib2dvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)              {if (GLeeInit()) glVertexAttrib2fARB(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2fvARB(GLuint index, const GLfloat * v)                {if (GLeeInit()) glVertexAttrib2fvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib2sARB(GLuint index, GLshort x, GLshort y)              {if (GLeeInit()) glVertexAttrib2sARB(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2svARB(GLuint index, const GLshort * v)                {if (GLeeInit()) glVertexAttrib2svARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)  {if (GLeeInit()) glVertexAttrib3dARB(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3dvARB(GLuint index, const GLdouble * v)               {if (GLeeInit()) glVertexAttrib3dvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)   {if (GLeeInit()) glVertexAttrib3fARB(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3fvARB(GLuint index, const GLfloat * v)                {if (GLeeInit()) glVertexAttrib3fvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)   {if (GLeeInit()) glVertexAttrib3sARB(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3svARB(GLuint index, const GLshort * v)                {if (GLeeInit()) glVertexAttrib3svARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NbvARB(GLuint index, const GLbyte * v)                {if (GLeeInit()) glVertexAttrib4NbvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NivARB(GLuint index, const GLint * v)                 {if (GLeeInit()) glVertexAttrib4NivARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NsvARB(GLuint index, const GLshort * v)               {if (GLeeInit()) glVertexAttrib4NsvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (GLeeInit()) glVertexAttrib4NubARB(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4NubvARB(GLuint index, const GLubyte * v)              {if (GLeeInit()) glVertexAttrib4NubvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NuivARB(GLuint index, const GLuint * v)               {if (GLeeInit()) glVertexAttrib4NuivARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4NusvARB(GLuint index, const GLushort * v)             {if (GLeeInit()) glVertexAttrib4NusvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4bvARB(GLuint index, const GLbyte * v)                 {if (GLeeInit()) glVertexAttrib4bvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glVertexAttrib4dARB(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4dvARB(GLuint index, const GLdouble * v)               {if (GLeeInit()) glVertexAttrib4dvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glVertexAttrib4fARB(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4fvARB(GLuint index, const GLfloat * v)                {if (GLeeInit()) glVertexAttrib4fvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4ivARB(GLuint index, const GLint * v)                  {if (GLeeInit()) glVertexAttrib4ivARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (GLeeInit()) glVertexAttrib4sARB(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4svARB(GLuint index, const GLshort * v)                {if (GLeeInit()) glVertexAttrib4svARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4ubvARB(GLuint index, const GLubyte * v)               {if (GLeeInit()) glVertexAttrib4ubvARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4uivARB(GLuint index, const GLuint * v)                {if (GLeeInit()) glVertexAttrib4uivARB(index, v);}
-void __stdcall _Lazy_glVertexAttrib4usvARB(GLuint index, const GLushort * v)              {if (GLeeInit()) glVertexAttrib4usvARB(index, v);}
-void __stdcall _Lazy_glVertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glVertexAttribPointerARB(index, size, type, normalized, stride, pointer);}
-void __stdcall _Lazy_glEnableVertexAttribArrayARB(GLuint index)                           {if (GLeeInit()) glEnableVertexAttribArrayARB(index);}
-void __stdcall _Lazy_glDisableVertexAttribArrayARB(GLuint index)                          {if (GLeeInit()) glDisableVertexAttribArrayARB(index);}
-void __stdcall _Lazy_glProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid * string)  {if (GLeeInit()) glProgramStringARB(target, format, len, string);}
-void __stdcall _Lazy_glBindProgramARB(GLenum target, GLuint program)                      {if (GLeeInit()) glBindProgramARB(target, program);}
-void __stdcall _Lazy_glDeleteProgramsARB(GLsizei n, const GLuint * programs)              {if (GLeeInit()) glDeleteProgramsARB(n, programs);}
-void __stdcall _Lazy_glGenProgramsARB(GLsizei n, GLuint * programs)                       {if (GLeeInit()) glGenProgramsARB(n, programs);}
-void __stdcall _Lazy_glProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glProgramEnvParameter4dARB(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)  {if (GLeeInit()) glProgramEnvParameter4dvARB(target, index, params);}
-void __stdcall _Lazy_glProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glProgramEnvParameter4fARB(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)  {if (GLeeInit()) glProgramEnvParameter4fvARB(target, index, params);}
-void __stdcall _Lazy_glProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glProgramLocalParameter4dARB(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)  {if (GLeeInit()) glProgramLocalParameter4dvARB(target, index, params);}
-void __stdcall _Lazy_glProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glProgramLocalParameter4fARB(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)  {if (GLeeInit()) glProgramLocalParameter4fvARB(target, index, params);}
-void __stdcall _Lazy_glGetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)  {if (GLeeInit()) glGetProgramEnvParameterdvARB(target, index, params);}
-void __stdcall _Lazy_glGetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)  {if (GLeeInit()) glGetProgramEnvParameterfvARB(target, index, params);}
-void __stdcall _Lazy_glGetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)  {if (GLeeInit()) glGetProgramLocalParameterdvARB(target, index, params);}
-void __stdcall _Lazy_glGetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)  {if (GLeeInit()) glGetProgramLocalParameterfvARB(target, index, params);}
-void __stdcall _Lazy_glGetProgramivARB(GLenum target, GLenum pname, GLint * params)       {if (GLeeInit()) glGetProgramivARB(target, pname, params);}
-void __stdcall _Lazy_glGetProgramStringARB(GLenum target, GLenum pname, GLvoid * string)  {if (GLeeInit()) glGetProgramStringARB(target, pname, string);}
-void __stdcall _Lazy_glGetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble * params)  {if (GLeeInit()) glGetVertexAttribdvARB(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetVertexAttribfvARB(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribivARB(GLuint index, GLenum pname, GLint * params)   {if (GLeeInit()) glGetVertexAttribivARB(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribPointervARB(GLuint index, GLenum pname, GLvoid* * pointer)  {if (GLeeInit()) glGetVertexAttribPointervARB(index, pname, pointer);}
-GLboolean __stdcall _Lazy_glIsProgramARB(GLuint program)                                  {if (GLeeInit()) return glIsProgramARB(program); return (GLboolean)0;}
+void __stdcall _Lazy_glVertexAttrib1dARB(GLuint index, GLdouble x)                        {if (__GLeeLazyLink((void**)&pglVertexAttrib1dARB, "glVertexAttrib1dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1dARB(index, x);}
+void __stdcall _Lazy_glVertexAttrib1dvARB(GLuint index, const GLdouble * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib1dvARB, "glVertexAttrib1dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1dvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib1fARB(GLuint index, GLfloat x)                         {if (__GLeeLazyLink((void**)&pglVertexAttrib1fARB, "glVertexAttrib1fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1fARB(index, x);}
+void __stdcall _Lazy_glVertexAttrib1fvARB(GLuint index, const GLfloat * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib1fvARB, "glVertexAttrib1fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1fvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib1sARB(GLuint index, GLshort x)                         {if (__GLeeLazyLink((void**)&pglVertexAttrib1sARB, "glVertexAttrib1sARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1sARB(index, x);}
+void __stdcall _Lazy_glVertexAttrib1svARB(GLuint index, const GLshort * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib1svARB, "glVertexAttrib1svARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib1svARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)            {if (__GLeeLazyLink((void**)&pglVertexAttrib2dARB, "glVertexAttrib2dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2dARB(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2dvARB(GLuint index, const GLdouble * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib2dvARB, "glVertexAttrib2dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2dvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)              {if (__GLeeLazyLink((void**)&pglVertexAttrib2fARB, "glVertexAttrib2fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2fARB(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2fvARB(GLuint index, const GLfloat * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib2fvARB, "glVertexAttrib2fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2fvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib2sARB(GLuint index, GLshort x, GLshort y)              {if (__GLeeLazyLink((void**)&pglVertexAttrib2sARB, "glVertexAttrib2sARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2sARB(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2svARB(GLuint index, const GLshort * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib2svARB, "glVertexAttrib2svARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib2svARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)  {if (__GLeeLazyLink((void**)&pglVertexAttrib3dARB, "glVertexAttrib3dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3dARB(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3dvARB(GLuint index, const GLdouble * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib3dvARB, "glVertexAttrib3dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3dvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)   {if (__GLeeLazyLink((void**)&pglVertexAttrib3fARB, "glVertexAttrib3fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3fARB(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3fvARB(GLuint index, const GLfloat * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib3fvARB, "glVertexAttrib3fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3fvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)   {if (__GLeeLazyLink((void**)&pglVertexAttrib3sARB, "glVertexAttrib3sARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3sARB(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3svARB(GLuint index, const GLshort * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib3svARB, "glVertexAttrib3svARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib3svARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NbvARB(GLuint index, const GLbyte * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4NbvARB, "glVertexAttrib4NbvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NbvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NivARB(GLuint index, const GLint * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4NivARB, "glVertexAttrib4NivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NivARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NsvARB(GLuint index, const GLshort * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib4NsvARB, "glVertexAttrib4NsvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NsvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4NubARB, "glVertexAttrib4NubARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NubARB(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4NubvARB(GLuint index, const GLubyte * v)              {if (__GLeeLazyLink((void**)&pglVertexAttrib4NubvARB, "glVertexAttrib4NubvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NubvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NuivARB(GLuint index, const GLuint * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib4NuivARB, "glVertexAttrib4NuivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NuivARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4NusvARB(GLuint index, const GLushort * v)             {if (__GLeeLazyLink((void**)&pglVertexAttrib4NusvARB, "glVertexAttrib4NusvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4NusvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4bvARB(GLuint index, const GLbyte * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4bvARB, "glVertexAttrib4bvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4bvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4dARB, "glVertexAttrib4dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4dARB(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4dvARB(GLuint index, const GLdouble * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib4dvARB, "glVertexAttrib4dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4dvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4fARB, "glVertexAttrib4fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4fARB(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4fvARB(GLuint index, const GLfloat * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4fvARB, "glVertexAttrib4fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4fvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4ivARB(GLuint index, const GLint * v)                  {if (__GLeeLazyLink((void**)&pglVertexAttrib4ivARB, "glVertexAttrib4ivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4ivARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4sARB, "glVertexAttrib4sARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4sARB(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4svARB(GLuint index, const GLshort * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4svARB, "glVertexAttrib4svARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4svARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4ubvARB(GLuint index, const GLubyte * v)               {if (__GLeeLazyLink((void**)&pglVertexAttrib4ubvARB, "glVertexAttrib4ubvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4ubvARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4uivARB(GLuint index, const GLuint * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4uivARB, "glVertexAttrib4uivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4uivARB(index, v);}
+void __stdcall _Lazy_glVertexAttrib4usvARB(GLuint index, const GLushort * v)              {if (__GLeeLazyLink((void**)&pglVertexAttrib4usvARB, "glVertexAttrib4usvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttrib4usvARB(index, v);}
+void __stdcall _Lazy_glVertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglVertexAttribPointerARB, "glVertexAttribPointerARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glVertexAttribPointerARB(index, size, type, normalized, stride, pointer);}
+void __stdcall _Lazy_glEnableVertexAttribArrayARB(GLuint index)                           {if (__GLeeLazyLink((void**)&pglEnableVertexAttribArrayARB, "glEnableVertexAttribArrayARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glEnableVertexAttribArrayARB(index);}
+void __stdcall _Lazy_glDisableVertexAttribArrayARB(GLuint index)                          {if (__GLeeLazyLink((void**)&pglDisableVertexAttribArrayARB, "glDisableVertexAttribArrayARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glDisableVertexAttribArrayARB(index);}
+void __stdcall _Lazy_glProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid * string)  {if (__GLeeLazyLink((void**)&pglProgramStringARB, "glProgramStringARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramStringARB(target, format, len, string);}
+void __stdcall _Lazy_glBindProgramARB(GLenum target, GLuint program)                      {if (__GLeeLazyLink((void**)&pglBindProgramARB, "glBindProgramARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glBindProgramARB(target, program);}
+void __stdcall _Lazy_glDeleteProgramsARB(GLsizei n, const GLuint * programs)              {if (__GLeeLazyLink((void**)&pglDeleteProgramsARB, "glDeleteProgramsARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glDeleteProgramsARB(n, programs);}
+void __stdcall _Lazy_glGenProgramsARB(GLsizei n, GLuint * programs)                       {if (__GLeeLazyLink((void**)&pglGenProgramsARB, "glGenProgramsARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGenProgramsARB(n, programs);}
+void __stdcall _Lazy_glProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglProgramEnvParameter4dARB, "glProgramEnvParameter4dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramEnvParameter4dARB(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)  {if (__GLeeLazyLink((void**)&pglProgramEnvParameter4dvARB, "glProgramEnvParameter4dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramEnvParameter4dvARB(target, index, params);}
+void __stdcall _Lazy_glProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglProgramEnvParameter4fARB, "glProgramEnvParameter4fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramEnvParameter4fARB(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglProgramEnvParameter4fvARB, "glProgramEnvParameter4fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramEnvParameter4fvARB(target, index, params);}
+void __stdcall _Lazy_glProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglProgramLocalParameter4dARB, "glProgramLocalParameter4dARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramLocalParameter4dARB(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)  {if (__GLeeLazyLink((void**)&pglProgramLocalParameter4dvARB, "glProgramLocalParameter4dvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramLocalParameter4dvARB(target, index, params);}
+void __stdcall _Lazy_glProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglProgramLocalParameter4fARB, "glProgramLocalParameter4fARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramLocalParameter4fARB(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglProgramLocalParameter4fvARB, "glProgramLocalParameter4fvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glProgramLocalParameter4fvARB(target, index, params);}
+void __stdcall _Lazy_glGetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetProgramEnvParameterdvARB, "glGetProgramEnvParameterdvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramEnvParameterdvARB(target, index, params);}
+void __stdcall _Lazy_glGetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetProgramEnvParameterfvARB, "glGetProgramEnvParameterfvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramEnvParameterfvARB(target, index, params);}
+void __stdcall _Lazy_glGetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetProgramLocalParameterdvARB, "glGetProgramLocalParameterdvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramLocalParameterdvARB(target, index, params);}
+void __stdcall _Lazy_glGetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetProgramLocalParameterfvARB, "glGetProgramLocalParameterfvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramLocalParameterfvARB(target, index, params);}
+void __stdcall _Lazy_glGetProgramivARB(GLenum target, GLenum pname, GLint * params)       {if (__GLeeLazyLink((void**)&pglGetProgramivARB, "glGetProgramivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramivARB(target, pname, params);}
+void __stdcall _Lazy_glGetProgramStringARB(GLenum target, GLenum pname, GLvoid * string)  {if (__GLeeLazyLink((void**)&pglGetProgramStringARB, "glGetProgramStringARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetProgramStringARB(target, pname, string);}
+void __stdcall _Lazy_glGetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribdvARB, "glGetVertexAttribdvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetVertexAttribdvARB(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribfvARB, "glGetVertexAttribfvARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetVertexAttribfvARB(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribivARB(GLuint index, GLenum pname, GLint * params)   {if (__GLeeLazyLink((void**)&pglGetVertexAttribivARB, "glGetVertexAttribivARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetVertexAttribivARB(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribPointervARB(GLuint index, GLenum pname, GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribPointervARB, "glGetVertexAttribPointervARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) glGetVertexAttribPointervARB(index, pname, pointer);}
+GLboolean __stdcall _Lazy_glIsProgramARB(GLuint program)                                  {if (__GLeeLazyLink((void**)&pglIsProgramARB, "glIsProgramARB", &_GLEE_ARB_vertex_program, "GL_ARB_vertex_program")) return glIsProgramARB(program); return (GLboolean)0;}
 PFNGLVERTEXATTRIB1DARBPROC pglVertexAttrib1dARB=_Lazy_glVertexAttrib1dARB;
 PFNGLVERTEXATTRIB1DVARBPROC pglVertexAttrib1dvARB=_Lazy_glVertexAttrib1dvARB;
 PFNGLVERTEXATTRIB1FARBPROC pglVertexAttrib1fARB=_Lazy_glVertexAttrib1fARB;
@@ -1517,17 +1549,17 @@ PFNGLISPROGRAMARBPROC pglIsProgramARB=_Lazy_glIsProgramARB;
 //GL_ARB_vertex_buffer_object
 
 #ifdef __GLEE_GL_ARB_vertex_buffer_object
-void __stdcall _Lazy_glBindBufferARB(GLenum target, GLuint buffer)                        {if (GLeeInit()) glBindBufferARB(target, buffer);}
-void __stdcall _Lazy_glDeleteBuffersARB(GLsizei n, const GLuint * buffers)                {if (GLeeInit()) glDeleteBuffersARB(n, buffers);}
-void __stdcall _Lazy_glGenBuffersARB(GLsizei n, GLuint * buffers)                         {if (GLeeInit()) glGenBuffersARB(n, buffers);}
-GLboolean __stdcall _Lazy_glIsBufferARB(GLuint buffer)                                    {if (GLeeInit()) return glIsBufferARB(buffer); return (GLboolean)0;}
-void __stdcall _Lazy_glBufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid * data, GLenum usage)  {if (GLeeInit()) glBufferDataARB(target, size, data, usage);}
-void __stdcall _Lazy_glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid * data)  {if (GLeeInit()) glBufferSubDataARB(target, offset, size, data);}
-void __stdcall _Lazy_glGetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, GLvoid * data)  {if (GLeeInit()) glGetBufferSubDataARB(target, offset, size, data);}
-GLvoid* __stdcall _Lazy_glMapBufferARB(GLenum target, GLenum access)                      {if (GLeeInit()) return glMapBufferARB(target, access); return (GLvoid*)0;}
-GLboolean __stdcall _Lazy_glUnmapBufferARB(GLenum target)                                 {if (GLeeInit()) return glUnmapBufferARB(target); return (GLboolean)0;}
-void __stdcall _Lazy_glGetBufferParameterivARB(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetBufferParameterivARB(target, pname, params);}
-void __stdcall _Lazy_glGetBufferPointervARB(GLenum target, GLenum pname, GLvoid* * params)  {if (GLeeInit()) glGetBufferPointervARB(target, pname, params);}
+void __stdcall _Lazy_glBindBufferARB(GLenum target, GLuint buffer)                        {if (__GLeeLazyLink((void**)&pglBindBufferARB, "glBindBufferARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glBindBufferARB(target, buffer);}
+void __stdcall _Lazy_glDeleteBuffersARB(GLsizei n, const GLuint * buffers)                {if (__GLeeLazyLink((void**)&pglDeleteBuffersARB, "glDeleteBuffersARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glDeleteBuffersARB(n, buffers);}
+void __stdcall _Lazy_glGenBuffersARB(GLsizei n, GLuint * buffers)                         {if (__GLeeLazyLink((void**)&pglGenBuffersARB, "glGenBuffersARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glGenBuffersARB(n, buffers);}
+GLboolean __stdcall _Lazy_glIsBufferARB(GLuint buffer)                                    {if (__GLeeLazyLink((void**)&pglIsBufferARB, "glIsBufferARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) return glIsBufferARB(buffer); return (GLboolean)0;}
+void __stdcall _Lazy_glBufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid * data, GLenum usage)  {if (__GLeeLazyLink((void**)&pglBufferDataARB, "glBufferDataARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glBufferDataARB(target, size, data, usage);}
+void __stdcall _Lazy_glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglBufferSubDataARB, "glBufferSubDataARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glBufferSubDataARB(target, offset, size, data);}
+void __stdcall _Lazy_glGetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, GLvoid * data)  {if (__GLeeLazyLink((void**)&pglGetBufferSubDataARB, "glGetBufferSubDataARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glGetBufferSubDataARB(target, offset, size, data);}
+GLvoid* __stdcall _Lazy_glMapBufferARB(GLenum target, GLenum access)                      {if (__GLeeLazyLink((void**)&pglMapBufferARB, "glMapBufferARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) return glMapBufferARB(target, access); return (GLvoid*)0;}
+GLboolean __stdcall _Lazy_glUnmapBufferARB(GLenum target)                                 {if (__GLeeLazyLink((void**)&pglUnmapBufferARB, "glUnmapBufferARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) return glUnmapBufferARB(target); return (GLboolean)0;}
+void __stdcall _Lazy_glGetBufferParameterivARB(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetBufferParameterivARB, "glGetBufferParameterivARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glGetBufferParameterivARB(target, pname, params);}
+void __stdcall _Lazy_glGetBufferPointervARB(GLenum target, GLenum pname, GLvoid* * params)  {if (__GLeeLazyLink((void**)&pglGetBufferPointervARB, "glGetBufferPointervARB", &_GLEE_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object")) glGetBufferPointervARB(target, pname, params);}
 PFNGLBINDBUFFERARBPROC pglBindBufferARB=_Lazy_glBindBufferARB;
 PFNGLDELETEBUFFERSARBPROC pglDeleteBuffersARB=_Lazy_glDeleteBuffersARB;
 PFNGLGENBUFFERSARBPROC pglGenBuffersARB=_Lazy_glGenBuffersARB;
@@ -1544,14 +1576,14 @@ PFNGLGETBUFFERPOINTERVARBPROC pglGetBufferPointervARB=_Lazy_glGetBufferPointervA
 //GL_ARB_occlusion_query
 
 #ifdef __GLEE_GL_ARB_occlusion_query
-void __stdcall _Lazy_glGenQueriesARB(GLsizei n, GLuint * ids)                             {if (GLeeInit()) glGenQueriesARB(n, ids);}
-void __stdcall _Lazy_glDeleteQueriesARB(GLsizei n, const GLuint * ids)                    {if (GLeeInit()) glDeleteQueriesARB(n, ids);}
-GLboolean __stdcall _Lazy_glIsQueryARB(GLuint id)                                         {if (GLeeInit()) return glIsQueryARB(id); return (GLboolean)0;}
-void __stdcall _Lazy_glBeginQueryARB(GLenum target, GLuint id)                            {if (GLeeInit()) glBeginQueryARB(target, id);}
-void __stdcall _Lazy_glEndQueryARB(GLenum target)                                         {if (GLeeInit()) glEndQueryARB(target);}
-void __stdcall _Lazy_glGetQueryivARB(GLenum target, GLenum pname, GLint * params)         {if (GLeeInit()) glGetQueryivARB(target, pname, params);}
-void __stdcall _Lazy_glGetQueryObjectivARB(GLuint id, GLenum pname, GLint * params)       {if (GLeeInit()) glGetQueryObjectivARB(id, pname, params);}
-void __stdcall _Lazy_glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint * params)     {if (GLeeInit()) glGetQueryObjectuivARB(id, pname, params);}
+void __stdcall _Lazy_glGenQueriesARB(GLsizei n, GLuint * ids)                             {if (__GLeeLazyLink((void**)&pglGenQueriesARB, "glGenQueriesARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glGenQueriesARB(n, ids);}
+void __stdcall _Lazy_glDeleteQueriesARB(GLsizei n, const GLuint * ids)                    {if (__GLeeLazyLink((void**)&pglDeleteQueriesARB, "glDeleteQueriesARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glDeleteQueriesARB(n, ids);}
+GLboolean __stdcall _Lazy_glIsQueryARB(GLuint id)                                         {if (__GLeeLazyLink((void**)&pglIsQueryARB, "glIsQueryARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) return glIsQueryARB(id); return (GLboolean)0;}
+void __stdcall _Lazy_glBeginQueryARB(GLenum target, GLuint id)                            {if (__GLeeLazyLink((void**)&pglBeginQueryARB, "glBeginQueryARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glBeginQueryARB(target, id);}
+void __stdcall _Lazy_glEndQueryARB(GLenum target)                                         {if (__GLeeLazyLink((void**)&pglEndQueryARB, "glEndQueryARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glEndQueryARB(target);}
+void __stdcall _Lazy_glGetQueryivARB(GLenum target, GLenum pname, GLint * params)         {if (__GLeeLazyLink((void**)&pglGetQueryivARB, "glGetQueryivARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glGetQueryivARB(target, pname, params);}
+void __stdcall _Lazy_glGetQueryObjectivARB(GLuint id, GLenum pname, GLint * params)       {if (__GLeeLazyLink((void**)&pglGetQueryObjectivARB, "glGetQueryObjectivARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glGetQueryObjectivARB(id, pname, params);}
+void __stdcall _Lazy_glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint * params)     {if (__GLeeLazyLink((void**)&pglGetQueryObjectuivARB, "glGetQueryObjectuivARB", &_GLEE_ARB_occlusion_query, "GL_ARB_occlusion_query")) glGetQueryObjectuivARB(id, pname, params);}
 PFNGLGENQUERIESARBPROC pglGenQueriesARB=_Lazy_glGenQueriesARB;
 PFNGLDELETEQUERIESARBPROC pglDeleteQueriesARB=_Lazy_glDeleteQueriesARB;
 PFNGLISQUERYARBPROC pglIsQueryARB=_Lazy_glIsQueryARB;
@@ -1565,45 +1597,45 @@ PFNGLGETQUERYOBJECTUIVARBPROC pglGetQueryObjectuivARB=_Lazy_glGetQueryObjectuivA
 //GL_ARB_shader_objects
 
 #ifdef __GLEE_GL_ARB_shader_objects
-void __stdcall _Lazy_glDeleteObjectARB(GLhandleARB obj)                                   {if (GLeeInit()) glDeleteObjectARB(obj);}
-GLhandleARB __stdcall _Lazy_glGetHandleARB(GLenum pname)                                  {if (GLeeInit()) return glGetHandleARB(pname); return (GLhandleARB)0;}
-void __stdcall _Lazy_glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)  {if (GLeeInit()) glDetachObjectARB(containerObj, attachedObj);}
-GLhandleARB __stdcall _Lazy_glCreateShaderObjectARB(GLenum shaderType)                    {if (GLeeInit()) return glCreateShaderObjectARB(shaderType); return (GLhandleARB)0;}
-void __stdcall _Lazy_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* * string, const GLint * length)  {if (GLeeInit()) glShaderSourceARB(shaderObj, count, string, length);}
-void __stdcall _Lazy_glCompileShaderARB(GLhandleARB shaderObj)                            {if (GLeeInit()) glCompileShaderARB(shaderObj);}
-GLhandleARB __stdcall _Lazy_glCreateProgramObjectARB(void)                                {if (GLeeInit()) return glCreateProgramObjectARB(); return (GLhandleARB)0;}
-void __stdcall _Lazy_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)         {if (GLeeInit()) glAttachObjectARB(containerObj, obj);}
-void __stdcall _Lazy_glLinkProgramARB(GLhandleARB programObj)                             {if (GLeeInit()) glLinkProgramARB(programObj);}
-void __stdcall _Lazy_glUseProgramObjectARB(GLhandleARB programObj)                        {if (GLeeInit()) glUseProgramObjectARB(programObj);}
-void __stdcall _Lazy_glValidateProgramARB(GLhandleARB programObj)                         {if (GLeeInit()) glValidateProgramARB(programObj);}
-void __stdcall _Lazy_glUniform1fARB(GLint location, GLfloat v0)                           {if (GLeeInit()) glUniform1fARB(location, v0);}
-void __stdcall _Lazy_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)               {if (GLeeInit()) glUniform2fARB(location, v0, v1);}
-void __stdcall _Lazy_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)   {if (GLeeInit()) glUniform3fARB(location, v0, v1, v2);}
-void __stdcall _Lazy_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)  {if (GLeeInit()) glUniform4fARB(location, v0, v1, v2, v3);}
-void __stdcall _Lazy_glUniform1iARB(GLint location, GLint v0)                             {if (GLeeInit()) glUniform1iARB(location, v0);}
-void __stdcall _Lazy_glUniform2iARB(GLint location, GLint v0, GLint v1)                   {if (GLeeInit()) glUniform2iARB(location, v0, v1);}
-void __stdcall _Lazy_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)         {if (GLeeInit()) glUniform3iARB(location, v0, v1, v2);}
-void __stdcall _Lazy_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)  {if (GLeeInit()) glUniform4iARB(location, v0, v1, v2, v3);}
-void __stdcall _Lazy_glUniform1fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (GLeeInit()) glUniform1fvARB(location, count, value);}
-void __stdcall _Lazy_glUniform2fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (GLeeInit()) glUniform2fvARB(location, count, value);}
-void __stdcall _Lazy_glUniform3fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (GLeeInit()) glUniform3fvARB(location, count, value);}
-void __stdcall _Lazy_glUniform4fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (GLeeInit()) glUniform4fvARB(location, count, value);}
-void __stdcall _Lazy_glUniform1ivARB(GLint location, GLsizei count, const GLint * value)  {if (GLeeInit()) glUniform1ivARB(location, count, value);}
-void __stdcall _Lazy_glUniform2ivARB(GLint location, GLsizei count, const GLint * value)  {if (GLeeInit()) glUniform2ivARB(location, count, value);}
-void __stdcall _Lazy_glUniform3ivARB(GLint location, GLsizei count, const GLint * value)  {if (GLeeInit()) glUniform3ivARB(location, count, value);}
-void __stdcall _Lazy_glUniform4ivARB(GLint location, GLsizei count, const GLint * value)  {if (GLeeInit()) glUniform4ivARB(location, count, value);}
-void __stdcall _Lazy_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix2fvARB(location, count, transpose, value);}
-void __stdcall _Lazy_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix3fvARB(location, count, transpose, value);}
-void __stdcall _Lazy_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (GLeeInit()) glUniformMatrix4fvARB(location, count, transpose, value);}
-void __stdcall _Lazy_glGetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetObjectParameterfvARB(obj, pname, params);}
-void __stdcall _Lazy_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)  {if (GLeeInit()) glGetObjectParameterivARB(obj, pname, params);}
-void __stdcall _Lazy_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)  {if (GLeeInit()) glGetInfoLogARB(obj, maxLength, length, infoLog);}
-void __stdcall _Lazy_glGetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxCount, GLsizei * count, GLhandleARB * obj)  {if (GLeeInit()) glGetAttachedObjectsARB(containerObj, maxCount, count, obj);}
-GLint __stdcall _Lazy_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB * name)  {if (GLeeInit()) return glGetUniformLocationARB(programObj, name); return (GLint)0;}
-void __stdcall _Lazy_glGetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)  {if (GLeeInit()) glGetActiveUniformARB(programObj, index, maxLength, length, size, type, name);}
-void __stdcall _Lazy_glGetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat * params)  {if (GLeeInit()) glGetUniformfvARB(programObj, location, params);}
-void __stdcall _Lazy_glGetUniformivARB(GLhandleARB programObj, GLint location, GLint * params)  {if (GLeeInit()) glGetUniformivARB(programObj, location, params);}
-void __stdcall _Lazy_glGetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * source)  {if (GLeeInit()) glGetShaderSourceARB(obj, maxLength, length, source);}
+void __stdcall _Lazy_glDeleteObjectARB(GLhandleARB obj)                                   {if (__GLeeLazyLink((void**)&pglDeleteObjectARB, "glDeleteObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glDeleteObjectARB(obj);}
+GLhandleARB __stdcall _Lazy_glGetHandleARB(GLenum pname)                                  {if (__GLeeLazyLink((void**)&pglGetHandleARB, "glGetHandleARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) return glGetHandleARB(pname); return (GLhandleARB)0;}
+void __stdcall _Lazy_glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)  {if (__GLeeLazyLink((void**)&pglDetachObjectARB, "glDetachObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glDetachObjectARB(containerObj, attachedObj);}
+GLhandleARB __stdcall _Lazy_glCreateShaderObjectARB(GLenum shaderType)                    {if (__GLeeLazyLink((void**)&pglCreateShaderObjectARB, "glCreateShaderObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) return glCreateShaderObjectARB(shaderType); return (GLhandleARB)0;}
+void __stdcall _Lazy_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* * string, const GLint * length)  {if (__GLeeLazyLink((void**)&pglShaderSourceARB, "glShaderSourceARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glShaderSourceARB(shaderObj, count, string, length);}
+void __stdcall _Lazy_glCompileShaderARB(GLhandleARB shaderObj)                            {if (__GLeeLazyLink((void**)&pglCompileShaderARB, "glCompileShaderARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glCompileShaderARB(shaderObj);}
+GLhandleARB __stdcall _Lazy_glCreateProgramObjectARB(void)                                {if (__GLeeLazyLink((void**)&pglCreateProgramObjectARB, "glCreateProgramObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) return glCreateProgramObjectARB(); return (GLhandleARB)0;}
+void __stdcall _Lazy_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)         {if (__GLeeLazyLink((void**)&pglAttachObjectARB, "glAttachObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glAttachObjectARB(containerObj, obj);}
+void __stdcall _Lazy_glLinkProgramARB(GLhandleARB programObj)                             {if (__GLeeLazyLink((void**)&pglLinkProgramARB, "glLinkProgramARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glLinkProgramARB(programObj);}
+void __stdcall _Lazy_glUseProgramObjectARB(GLhandleARB programObj)                        {if (__GLeeLazyLink((void**)&pglUseProgramObjectARB, "glUseProgramObjectARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUseProgramObjectARB(programObj);}
+void __stdcall _Lazy_glValidateProgramARB(GLhandleARB programObj)                         {if (__GLeeLazyLink((void**)&pglValidateProgramARB, "glValidateProgramARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glValidateProgramARB(programObj);}
+void __stdcall _Lazy_glUniform1fARB(GLint location, GLfloat v0)                           {if (__GLeeLazyLink((void**)&pglUniform1fARB, "glUniform1fARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform1fARB(location, v0);}
+void __stdcall _Lazy_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)               {if (__GLeeLazyLink((void**)&pglUniform2fARB, "glUniform2fARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform2fARB(location, v0, v1);}
+void __stdcall _Lazy_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)   {if (__GLeeLazyLink((void**)&pglUniform3fARB, "glUniform3fARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform3fARB(location, v0, v1, v2);}
+void __stdcall _Lazy_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)  {if (__GLeeLazyLink((void**)&pglUniform4fARB, "glUniform4fARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform4fARB(location, v0, v1, v2, v3);}
+void __stdcall _Lazy_glUniform1iARB(GLint location, GLint v0)                             {if (__GLeeLazyLink((void**)&pglUniform1iARB, "glUniform1iARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform1iARB(location, v0);}
+void __stdcall _Lazy_glUniform2iARB(GLint location, GLint v0, GLint v1)                   {if (__GLeeLazyLink((void**)&pglUniform2iARB, "glUniform2iARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform2iARB(location, v0, v1);}
+void __stdcall _Lazy_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)         {if (__GLeeLazyLink((void**)&pglUniform3iARB, "glUniform3iARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform3iARB(location, v0, v1, v2);}
+void __stdcall _Lazy_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)  {if (__GLeeLazyLink((void**)&pglUniform4iARB, "glUniform4iARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform4iARB(location, v0, v1, v2, v3);}
+void __stdcall _Lazy_glUniform1fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniform1fvARB, "glUniform1fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform1fvARB(location, count, value);}
+void __stdcall _Lazy_glUniform2fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniform2fvARB, "glUniform2fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform2fvARB(location, count, value);}
+void __stdcall _Lazy_glUniform3fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniform3fvARB, "glUniform3fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform3fvARB(location, count, value);}
+void __stdcall _Lazy_glUniform4fvARB(GLint location, GLsizei count, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniform4fvARB, "glUniform4fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform4fvARB(location, count, value);}
+void __stdcall _Lazy_glUniform1ivARB(GLint location, GLsizei count, const GLint * value)  {if (__GLeeLazyLink((void**)&pglUniform1ivARB, "glUniform1ivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform1ivARB(location, count, value);}
+void __stdcall _Lazy_glUniform2ivARB(GLint location, GLsizei count, const GLint * value)  {if (__GLeeLazyLink((void**)&pglUniform2ivARB, "glUniform2ivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform2ivARB(location, count, value);}
+void __stdcall _Lazy_glUniform3ivARB(GLint location, GLsizei count, const GLint * value)  {if (__GLeeLazyLink((void**)&pglUniform3ivARB, "glUniform3ivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform3ivARB(location, count, value);}
+void __stdcall _Lazy_glUniform4ivARB(GLint location, GLsizei count, const GLint * value)  {if (__GLeeLazyLink((void**)&pglUniform4ivARB, "glUniform4ivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniform4ivARB(location, count, value);}
+void __stdcall _Lazy_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix2fvARB, "glUniformMatrix2fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniformMatrix2fvARB(location, count, transpose, value);}
+void __stdcall _Lazy_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix3fvARB, "glUniformMatrix3fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniformMatrix3fvARB(location, count, transpose, value);}
+void __stdcall _Lazy_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)  {if (__GLeeLazyLink((void**)&pglUniformMatrix4fvARB, "glUniformMatrix4fvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glUniformMatrix4fvARB(location, count, transpose, value);}
+void __stdcall _Lazy_glGetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetObjectParameterfvARB, "glGetObjectParameterfvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetObjectParameterfvARB(obj, pname, params);}
+void __stdcall _Lazy_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetObjectParameterivARB, "glGetObjectParameterivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetObjectParameterivARB(obj, pname, params);}
+void __stdcall _Lazy_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)  {if (__GLeeLazyLink((void**)&pglGetInfoLogARB, "glGetInfoLogARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetInfoLogARB(obj, maxLength, length, infoLog);}
+void __stdcall _Lazy_glGetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxCount, GLsizei * count, GLhandleARB * obj)  {if (__GLeeLazyLink((void**)&pglGetAttachedObjectsARB, "glGetAttachedObjectsARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetAttachedObjectsARB(containerObj, maxCount, count, obj);}
+GLint __stdcall _Lazy_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB * name)  {if (__GLeeLazyLink((void**)&pglGetUniformLocationARB, "glGetUniformLocationARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) return glGetUniformLocationARB(programObj, name); return (GLint)0;}
+void __stdcall _Lazy_glGetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)  {if (__GLeeLazyLink((void**)&pglGetActiveUniformARB, "glGetActiveUniformARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetActiveUniformARB(programObj, index, maxLength, length, size, type, name);}
+void __stdcall _Lazy_glGetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetUniformfvARB, "glGetUniformfvARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetUniformfvARB(programObj, location, params);}
+void __stdcall _Lazy_glGetUniformivARB(GLhandleARB programObj, GLint location, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetUniformivARB, "glGetUniformivARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetUniformivARB(programObj, location, params);}
+void __stdcall _Lazy_glGetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * source)  {if (__GLeeLazyLink((void**)&pglGetShaderSourceARB, "glGetShaderSourceARB", &_GLEE_ARB_shader_objects, "GL_ARB_shader_objects")) glGetShaderSourceARB(obj, maxLength, length, source);}
 PFNGLDELETEOBJECTARBPROC pglDeleteObjectARB=_Lazy_glDeleteObjectARB;
 PFNGLGETHANDLEARBPROC pglGetHandleARB=_Lazy_glGetHandleARB;
 PFNGLDETACHOBJECTARBPROC pglDetachObjectARB=_Lazy_glDetachObjectARB;
@@ -1648,9 +1680,9 @@ PFNGLGETSHADERSOURCEARBPROC pglGetShaderSourceARB=_Lazy_glGetShaderSourceARB;
 //GL_ARB_vertex_shader
 
 #ifdef __GLEE_GL_ARB_vertex_shader
-void __stdcall _Lazy_glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB * name)  {if (GLeeInit()) glBindAttribLocationARB(programObj, index, name);}
-void __stdcall _Lazy_glGetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)  {if (GLeeInit()) glGetActiveAttribARB(programObj, index, maxLength, length, size, type, name);}
-GLint __stdcall _Lazy_glGetAttribLocationARB(GLhandleARB programObj, const GLcharARB * name)  {if (GLeeInit()) return glGetAttribLocationARB(programObj, name); return (GLint)0;}
+void __stdcall _Lazy_glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB * name)  {if (__GLeeLazyLink((void**)&pglBindAttribLocationARB, "glBindAttribLocationARB", &_GLEE_ARB_vertex_shader, "GL_ARB_vertex_shader")) glBindAttribLocationARB(programObj, index, name);}
+void __stdcall _Lazy_glGetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)  {if (__GLeeLazyLink((void**)&pglGetActiveAttribARB, "glGetActiveAttribARB", &_GLEE_ARB_vertex_shader, "GL_ARB_vertex_shader")) glGetActiveAttribARB(programObj, index, maxLength, length, size, type, name);}
+GLint __stdcall _Lazy_glGetAttribLocationARB(GLhandleARB programObj, const GLcharARB * name)  {if (__GLeeLazyLink((void**)&pglGetAttribLocationARB, "glGetAttribLocationARB", &_GLEE_ARB_vertex_shader, "GL_ARB_vertex_shader")) return glGetAttribLocationARB(programObj, name); return (GLint)0;}
 PFNGLBINDATTRIBLOCATIONARBPROC pglBindAttribLocationARB=_Lazy_glBindAttribLocationARB;
 PFNGLGETACTIVEATTRIBARBPROC pglGetActiveAttribARB=_Lazy_glGetActiveAttribARB;
 PFNGLGETATTRIBLOCATIONARBPROC pglGetAttribLocationARB=_Lazy_glGetAttribLocationARB;
@@ -1684,7 +1716,7 @@ PFNGLGETATTRIBLOCATIONARBPROC pglGetAttribLocationARB=_Lazy_glGetAttribLocationA
 //GL_ARB_draw_buffers
 
 #ifdef __GLEE_GL_ARB_draw_buffers
-void __stdcall _Lazy_glDrawBuffersARB(GLsizei n, const GLenum * bufs)                     {if (GLeeInit()) glDrawBuffersARB(n, bufs);}
+void __stdcall _Lazy_glDrawBuffersARB(GLsizei n, const GLenum * bufs)                     {if (__GLeeLazyLink((void**)&pglDrawBuffersARB, "glDrawBuffersARB", &_GLEE_ARB_draw_buffers, "GL_ARB_draw_buffers")) glDrawBuffersARB(n, bufs);}
 PFNGLDRAWBUFFERSARBPROC pglDrawBuffersARB=_Lazy_glDrawBuffersARB;
 #endif 
 
@@ -1696,7 +1728,7 @@ PFNGLDRAWBUFFERSARBPROC pglDrawBuffersARB=_Lazy_glDrawBuffersARB;
 //GL_ARB_color_buffer_float
 
 #ifdef __GLEE_GL_ARB_color_buffer_float
-void __stdcall _Lazy_glClampColorARB(GLenum target, GLenum clamp)                         {if (GLeeInit()) glClampColorARB(target, clamp);}
+void __stdcall _Lazy_glClampColorARB(GLenum target, GLenum clamp)                         {if (__GLeeLazyLink((void**)&pglClampColorARB, "glClampColorARB", &_GLEE_ARB_color_buffer_float, "GL_ARB_color_buffer_float")) glClampColorARB(target, clamp);}
 PFNGLCLAMPCOLORARBPROC pglClampColorARB=_Lazy_glClampColorARB;
 #endif 
 
@@ -1723,14 +1755,14 @@ PFNGLCLAMPCOLORARBPROC pglClampColorARB=_Lazy_glClampColorARB;
 //GL_EXT_blend_color
 
 #ifdef __GLEE_GL_EXT_blend_color
-void __stdcall _Lazy_glBlendColorEXT(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)  {if (GLeeInit()) glBlendColorEXT(red, green, blue, alpha);}
+void __stdcall _Lazy_glBlendColorEXT(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)  {if (__GLeeLazyLink((void**)&pglBlendColorEXT, "glBlendColorEXT", &_GLEE_EXT_blend_color, "GL_EXT_blend_color")) glBlendColorEXT(red, green, blue, alpha);}
 PFNGLBLENDCOLOREXTPROC pglBlendColorEXT=_Lazy_glBlendColorEXT;
 #endif 
 
 //GL_EXT_polygon_offset
 
 #ifdef __GLEE_GL_EXT_polygon_offset
-void __stdcall _Lazy_glPolygonOffsetEXT(GLfloat factor, GLfloat bias)                     {if (GLeeInit()) glPolygonOffsetEXT(factor, bias);}
+void __stdcall _Lazy_glPolygonOffsetEXT(GLfloat factor, GLfloat bias)                     {if (__GLeeLazyLink((void**)&pglPolygonOffsetEXT, "glPolygonOffsetEXT", &_GLEE_EXT_polygon_offset, "GL_EXT_polygon_offset")) glPolygonOffsetEXT(factor, bias);}
 PFNGLPOLYGONOFFSETEXTPROC pglPolygonOffsetEXT=_Lazy_glPolygonOffsetEXT;
 #endif 
 
@@ -1742,8 +1774,8 @@ PFNGLPOLYGONOFFSETEXTPROC pglPolygonOffsetEXT=_Lazy_glPolygonOffsetEXT;
 //GL_EXT_texture3D
 
 #ifdef __GLEE_GL_EXT_texture3D
-void __stdcall _Lazy_glTexImage3DEXT(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexImage3DEXT(target, level, internalformat, width, height, depth, border, format, type, pixels);}
-void __stdcall _Lazy_glTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);}
+void __stdcall _Lazy_glTexImage3DEXT(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexImage3DEXT, "glTexImage3DEXT", &_GLEE_EXT_texture3D, "GL_EXT_texture3D")) glTexImage3DEXT(target, level, internalformat, width, height, depth, border, format, type, pixels);}
+void __stdcall _Lazy_glTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexSubImage3DEXT, "glTexSubImage3DEXT", &_GLEE_EXT_texture3D, "GL_EXT_texture3D")) glTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);}
 PFNGLTEXIMAGE3DEXTPROC pglTexImage3DEXT=_Lazy_glTexImage3DEXT;
 PFNGLTEXSUBIMAGE3DEXTPROC pglTexSubImage3DEXT=_Lazy_glTexSubImage3DEXT;
 #endif 
@@ -1751,8 +1783,8 @@ PFNGLTEXSUBIMAGE3DEXTPROC pglTexSubImage3DEXT=_Lazy_glTexSubImage3DEXT;
 //GL_SGIS_texture_filter4
 
 #ifdef __GLEE_GL_SGIS_texture_filter4
-void __stdcall _Lazy_glGetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat * weights)  {if (GLeeInit()) glGetTexFilterFuncSGIS(target, filter, weights);}
-void __stdcall _Lazy_glTexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)  {if (GLeeInit()) glTexFilterFuncSGIS(target, filter, n, weights);}
+void __stdcall _Lazy_glGetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat * weights)  {if (__GLeeLazyLink((void**)&pglGetTexFilterFuncSGIS, "glGetTexFilterFuncSGIS", &_GLEE_SGIS_texture_filter4, "GL_SGIS_texture_filter4")) glGetTexFilterFuncSGIS(target, filter, weights);}
+void __stdcall _Lazy_glTexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)  {if (__GLeeLazyLink((void**)&pglTexFilterFuncSGIS, "glTexFilterFuncSGIS", &_GLEE_SGIS_texture_filter4, "GL_SGIS_texture_filter4")) glTexFilterFuncSGIS(target, filter, n, weights);}
 PFNGLGETTEXFILTERFUNCSGISPROC pglGetTexFilterFuncSGIS=_Lazy_glGetTexFilterFuncSGIS;
 PFNGLTEXFILTERFUNCSGISPROC pglTexFilterFuncSGIS=_Lazy_glTexFilterFuncSGIS;
 #endif 
@@ -1760,8 +1792,8 @@ PFNGLTEXFILTERFUNCSGISPROC pglTexFilterFuncSGIS=_Lazy_glTexFilterFuncSGIS;
 //GL_EXT_subtexture
 
 #ifdef __GLEE_GL_EXT_subtexture
-void __stdcall _Lazy_glTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexSubImage1DEXT(target, level, xoffset, width, format, type, pixels);}
-void __stdcall _Lazy_glTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexSubImage2DEXT(target, level, xoffset, yoffset, width, height, format, type, pixels);}
+void __stdcall _Lazy_glTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexSubImage1DEXT, "glTexSubImage1DEXT", &_GLEE_EXT_subtexture, "GL_EXT_subtexture")) glTexSubImage1DEXT(target, level, xoffset, width, format, type, pixels);}
+void __stdcall _Lazy_glTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexSubImage2DEXT, "glTexSubImage2DEXT", &_GLEE_EXT_subtexture, "GL_EXT_subtexture")) glTexSubImage2DEXT(target, level, xoffset, yoffset, width, height, format, type, pixels);}
 PFNGLTEXSUBIMAGE1DEXTPROC pglTexSubImage1DEXT=_Lazy_glTexSubImage1DEXT;
 PFNGLTEXSUBIMAGE2DEXTPROC pglTexSubImage2DEXT=_Lazy_glTexSubImage2DEXT;
 #endif 
@@ -1769,11 +1801,11 @@ PFNGLTEXSUBIMAGE2DEXTPROC pglTexSubImage2DEXT=_Lazy_glTexSubImage2DEXT;
 //GL_EXT_copy_texture
 
 #ifdef __GLEE_GL_EXT_copy_texture
-void __stdcall _Lazy_glCopyTexImage1DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)  {if (GLeeInit()) glCopyTexImage1DEXT(target, level, internalformat, x, y, width, border);}
-void __stdcall _Lazy_glCopyTexImage2DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)  {if (GLeeInit()) glCopyTexImage2DEXT(target, level, internalformat, x, y, width, height, border);}
-void __stdcall _Lazy_glCopyTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyTexSubImage1DEXT(target, level, xoffset, x, y, width);}
-void __stdcall _Lazy_glCopyTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (GLeeInit()) glCopyTexSubImage2DEXT(target, level, xoffset, yoffset, x, y, width, height);}
-void __stdcall _Lazy_glCopyTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (GLeeInit()) glCopyTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, x, y, width, height);}
+void __stdcall _Lazy_glCopyTexImage1DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)  {if (__GLeeLazyLink((void**)&pglCopyTexImage1DEXT, "glCopyTexImage1DEXT", &_GLEE_EXT_copy_texture, "GL_EXT_copy_texture")) glCopyTexImage1DEXT(target, level, internalformat, x, y, width, border);}
+void __stdcall _Lazy_glCopyTexImage2DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)  {if (__GLeeLazyLink((void**)&pglCopyTexImage2DEXT, "glCopyTexImage2DEXT", &_GLEE_EXT_copy_texture, "GL_EXT_copy_texture")) glCopyTexImage2DEXT(target, level, internalformat, x, y, width, height, border);}
+void __stdcall _Lazy_glCopyTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyTexSubImage1DEXT, "glCopyTexSubImage1DEXT", &_GLEE_EXT_copy_texture, "GL_EXT_copy_texture")) glCopyTexSubImage1DEXT(target, level, xoffset, x, y, width);}
+void __stdcall _Lazy_glCopyTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglCopyTexSubImage2DEXT, "glCopyTexSubImage2DEXT", &_GLEE_EXT_copy_texture, "GL_EXT_copy_texture")) glCopyTexSubImage2DEXT(target, level, xoffset, yoffset, x, y, width, height);}
+void __stdcall _Lazy_glCopyTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglCopyTexSubImage3DEXT, "glCopyTexSubImage3DEXT", &_GLEE_EXT_copy_texture, "GL_EXT_copy_texture")) glCopyTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, x, y, width, height);}
 PFNGLCOPYTEXIMAGE1DEXTPROC pglCopyTexImage1DEXT=_Lazy_glCopyTexImage1DEXT;
 PFNGLCOPYTEXIMAGE2DEXTPROC pglCopyTexImage2DEXT=_Lazy_glCopyTexImage2DEXT;
 PFNGLCOPYTEXSUBIMAGE1DEXTPROC pglCopyTexSubImage1DEXT=_Lazy_glCopyTexSubImage1DEXT;
@@ -1784,16 +1816,16 @@ PFNGLCOPYTEXSUBIMAGE3DEXTPROC pglCopyTexSubImage3DEXT=_Lazy_glCopyTexSubImage3DE
 //GL_EXT_histogram
 
 #ifdef __GLEE_GL_EXT_histogram
-void __stdcall _Lazy_glGetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (GLeeInit()) glGetHistogramEXT(target, reset, format, type, values);}
-void __stdcall _Lazy_glGetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetHistogramParameterfvEXT(target, pname, params);}
-void __stdcall _Lazy_glGetHistogramParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetHistogramParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glGetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (GLeeInit()) glGetMinmaxEXT(target, reset, format, type, values);}
-void __stdcall _Lazy_glGetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetMinmaxParameterfvEXT(target, pname, params);}
-void __stdcall _Lazy_glGetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetMinmaxParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glHistogramEXT(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)  {if (GLeeInit()) glHistogramEXT(target, width, internalformat, sink);}
-void __stdcall _Lazy_glMinmaxEXT(GLenum target, GLenum internalformat, GLboolean sink)    {if (GLeeInit()) glMinmaxEXT(target, internalformat, sink);}
-void __stdcall _Lazy_glResetHistogramEXT(GLenum target)                                   {if (GLeeInit()) glResetHistogramEXT(target);}
-void __stdcall _Lazy_glResetMinmaxEXT(GLenum target)                                      {if (GLeeInit()) glResetMinmaxEXT(target);}
+void __stdcall _Lazy_glGetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (__GLeeLazyLink((void**)&pglGetHistogramEXT, "glGetHistogramEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetHistogramEXT(target, reset, format, type, values);}
+void __stdcall _Lazy_glGetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetHistogramParameterfvEXT, "glGetHistogramParameterfvEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetHistogramParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glGetHistogramParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetHistogramParameterivEXT, "glGetHistogramParameterivEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetHistogramParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glGetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)  {if (__GLeeLazyLink((void**)&pglGetMinmaxEXT, "glGetMinmaxEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetMinmaxEXT(target, reset, format, type, values);}
+void __stdcall _Lazy_glGetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetMinmaxParameterfvEXT, "glGetMinmaxParameterfvEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetMinmaxParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glGetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetMinmaxParameterivEXT, "glGetMinmaxParameterivEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glGetMinmaxParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glHistogramEXT(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)  {if (__GLeeLazyLink((void**)&pglHistogramEXT, "glHistogramEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glHistogramEXT(target, width, internalformat, sink);}
+void __stdcall _Lazy_glMinmaxEXT(GLenum target, GLenum internalformat, GLboolean sink)    {if (__GLeeLazyLink((void**)&pglMinmaxEXT, "glMinmaxEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glMinmaxEXT(target, internalformat, sink);}
+void __stdcall _Lazy_glResetHistogramEXT(GLenum target)                                   {if (__GLeeLazyLink((void**)&pglResetHistogramEXT, "glResetHistogramEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glResetHistogramEXT(target);}
+void __stdcall _Lazy_glResetMinmaxEXT(GLenum target)                                      {if (__GLeeLazyLink((void**)&pglResetMinmaxEXT, "glResetMinmaxEXT", &_GLEE_EXT_histogram, "GL_EXT_histogram")) glResetMinmaxEXT(target);}
 PFNGLGETHISTOGRAMEXTPROC pglGetHistogramEXT=_Lazy_glGetHistogramEXT;
 PFNGLGETHISTOGRAMPARAMETERFVEXTPROC pglGetHistogramParameterfvEXT=_Lazy_glGetHistogramParameterfvEXT;
 PFNGLGETHISTOGRAMPARAMETERIVEXTPROC pglGetHistogramParameterivEXT=_Lazy_glGetHistogramParameterivEXT;
@@ -1809,19 +1841,19 @@ PFNGLRESETMINMAXEXTPROC pglResetMinmaxEXT=_Lazy_glResetMinmaxEXT;
 //GL_EXT_convolution
 
 #ifdef __GLEE_GL_EXT_convolution
-void __stdcall _Lazy_glConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)  {if (GLeeInit()) glConvolutionFilter1DEXT(target, internalformat, width, format, type, image);}
-void __stdcall _Lazy_glConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)  {if (GLeeInit()) glConvolutionFilter2DEXT(target, internalformat, width, height, format, type, image);}
-void __stdcall _Lazy_glConvolutionParameterfEXT(GLenum target, GLenum pname, GLfloat params)  {if (GLeeInit()) glConvolutionParameterfEXT(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glConvolutionParameterfvEXT(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameteriEXT(GLenum target, GLenum pname, GLint params)  {if (GLeeInit()) glConvolutionParameteriEXT(target, pname, params);}
-void __stdcall _Lazy_glConvolutionParameterivEXT(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glConvolutionParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glCopyConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyConvolutionFilter1DEXT(target, internalformat, x, y, width);}
-void __stdcall _Lazy_glCopyConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)  {if (GLeeInit()) glCopyConvolutionFilter2DEXT(target, internalformat, x, y, width, height);}
-void __stdcall _Lazy_glGetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * image)  {if (GLeeInit()) glGetConvolutionFilterEXT(target, format, type, image);}
-void __stdcall _Lazy_glGetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetConvolutionParameterfvEXT(target, pname, params);}
-void __stdcall _Lazy_glGetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetConvolutionParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glGetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)  {if (GLeeInit()) glGetSeparableFilterEXT(target, format, type, row, column, span);}
-void __stdcall _Lazy_glSeparableFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)  {if (GLeeInit()) glSeparableFilter2DEXT(target, internalformat, width, height, format, type, row, column);}
+void __stdcall _Lazy_glConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)  {if (__GLeeLazyLink((void**)&pglConvolutionFilter1DEXT, "glConvolutionFilter1DEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionFilter1DEXT(target, internalformat, width, format, type, image);}
+void __stdcall _Lazy_glConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)  {if (__GLeeLazyLink((void**)&pglConvolutionFilter2DEXT, "glConvolutionFilter2DEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionFilter2DEXT(target, internalformat, width, height, format, type, image);}
+void __stdcall _Lazy_glConvolutionParameterfEXT(GLenum target, GLenum pname, GLfloat params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameterfEXT, "glConvolutionParameterfEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionParameterfEXT(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameterfvEXT, "glConvolutionParameterfvEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameteriEXT(GLenum target, GLenum pname, GLint params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameteriEXT, "glConvolutionParameteriEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionParameteriEXT(target, pname, params);}
+void __stdcall _Lazy_glConvolutionParameterivEXT(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglConvolutionParameterivEXT, "glConvolutionParameterivEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glConvolutionParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glCopyConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyConvolutionFilter1DEXT, "glCopyConvolutionFilter1DEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glCopyConvolutionFilter1DEXT(target, internalformat, x, y, width);}
+void __stdcall _Lazy_glCopyConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglCopyConvolutionFilter2DEXT, "glCopyConvolutionFilter2DEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glCopyConvolutionFilter2DEXT(target, internalformat, x, y, width, height);}
+void __stdcall _Lazy_glGetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * image)  {if (__GLeeLazyLink((void**)&pglGetConvolutionFilterEXT, "glGetConvolutionFilterEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glGetConvolutionFilterEXT(target, format, type, image);}
+void __stdcall _Lazy_glGetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetConvolutionParameterfvEXT, "glGetConvolutionParameterfvEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glGetConvolutionParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glGetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetConvolutionParameterivEXT, "glGetConvolutionParameterivEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glGetConvolutionParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glGetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)  {if (__GLeeLazyLink((void**)&pglGetSeparableFilterEXT, "glGetSeparableFilterEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glGetSeparableFilterEXT(target, format, type, row, column, span);}
+void __stdcall _Lazy_glSeparableFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)  {if (__GLeeLazyLink((void**)&pglSeparableFilter2DEXT, "glSeparableFilter2DEXT", &_GLEE_EXT_convolution, "GL_EXT_convolution")) glSeparableFilter2DEXT(target, internalformat, width, height, format, type, row, column);}
 PFNGLCONVOLUTIONFILTER1DEXTPROC pglConvolutionFilter1DEXT=_Lazy_glConvolutionFilter1DEXT;
 PFNGLCONVOLUTIONFILTER2DEXTPROC pglConvolutionFilter2DEXT=_Lazy_glConvolutionFilter2DEXT;
 PFNGLCONVOLUTIONPARAMETERFEXTPROC pglConvolutionParameterfEXT=_Lazy_glConvolutionParameterfEXT;
@@ -1845,13 +1877,13 @@ PFNGLSEPARABLEFILTER2DEXTPROC pglSeparableFilter2DEXT=_Lazy_glSeparableFilter2DE
 //GL_SGI_color_table
 
 #ifdef __GLEE_GL_SGI_color_table
-void __stdcall _Lazy_glColorTableSGI(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (GLeeInit()) glColorTableSGI(target, internalformat, width, format, type, table);}
-void __stdcall _Lazy_glColorTableParameterfvSGI(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glColorTableParameterfvSGI(target, pname, params);}
-void __stdcall _Lazy_glColorTableParameterivSGI(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glColorTableParameterivSGI(target, pname, params);}
-void __stdcall _Lazy_glCopyColorTableSGI(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyColorTableSGI(target, internalformat, x, y, width);}
-void __stdcall _Lazy_glGetColorTableSGI(GLenum target, GLenum format, GLenum type, GLvoid * table)  {if (GLeeInit()) glGetColorTableSGI(target, format, type, table);}
-void __stdcall _Lazy_glGetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetColorTableParameterfvSGI(target, pname, params);}
-void __stdcall _Lazy_glGetColorTableParameterivSGI(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetColorTableParameterivSGI(target, pname, params);}
+void __stdcall _Lazy_glColorTableSGI(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (__GLeeLazyLink((void**)&pglColorTableSGI, "glColorTableSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glColorTableSGI(target, internalformat, width, format, type, table);}
+void __stdcall _Lazy_glColorTableParameterfvSGI(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglColorTableParameterfvSGI, "glColorTableParameterfvSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glColorTableParameterfvSGI(target, pname, params);}
+void __stdcall _Lazy_glColorTableParameterivSGI(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglColorTableParameterivSGI, "glColorTableParameterivSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glColorTableParameterivSGI(target, pname, params);}
+void __stdcall _Lazy_glCopyColorTableSGI(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyColorTableSGI, "glCopyColorTableSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glCopyColorTableSGI(target, internalformat, x, y, width);}
+void __stdcall _Lazy_glGetColorTableSGI(GLenum target, GLenum format, GLenum type, GLvoid * table)  {if (__GLeeLazyLink((void**)&pglGetColorTableSGI, "glGetColorTableSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glGetColorTableSGI(target, format, type, table);}
+void __stdcall _Lazy_glGetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameterfvSGI, "glGetColorTableParameterfvSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glGetColorTableParameterfvSGI(target, pname, params);}
+void __stdcall _Lazy_glGetColorTableParameterivSGI(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameterivSGI, "glGetColorTableParameterivSGI", &_GLEE_SGI_color_table, "GL_SGI_color_table")) glGetColorTableParameterivSGI(target, pname, params);}
 PFNGLCOLORTABLESGIPROC pglColorTableSGI=_Lazy_glColorTableSGI;
 PFNGLCOLORTABLEPARAMETERFVSGIPROC pglColorTableParameterfvSGI=_Lazy_glColorTableParameterfvSGI;
 PFNGLCOLORTABLEPARAMETERIVSGIPROC pglColorTableParameterivSGI=_Lazy_glColorTableParameterivSGI;
@@ -1864,12 +1896,12 @@ PFNGLGETCOLORTABLEPARAMETERIVSGIPROC pglGetColorTableParameterivSGI=_Lazy_glGetC
 //GL_SGIS_pixel_texture
 
 #ifdef __GLEE_GL_SGIS_pixel_texture
-void __stdcall _Lazy_glPixelTexGenParameteriSGIS(GLenum pname, GLint param)               {if (GLeeInit()) glPixelTexGenParameteriSGIS(pname, param);}
-void __stdcall _Lazy_glPixelTexGenParameterivSGIS(GLenum pname, const GLint * params)     {if (GLeeInit()) glPixelTexGenParameterivSGIS(pname, params);}
-void __stdcall _Lazy_glPixelTexGenParameterfSGIS(GLenum pname, GLfloat param)             {if (GLeeInit()) glPixelTexGenParameterfSGIS(pname, param);}
-void __stdcall _Lazy_glPixelTexGenParameterfvSGIS(GLenum pname, const GLfloat * params)   {if (GLeeInit()) glPixelTexGenParameterfvSGIS(pname, params);}
-void __stdcall _Lazy_glGetPixelTexGenParameterivSGIS(GLenum pname, GLint * params)        {if (GLeeInit()) glGetPixelTexGenParameterivSGIS(pname, params);}
-void __stdcall _Lazy_glGetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat * params)      {if (GLeeInit()) glGetPixelTexGenParameterfvSGIS(pname, params);}
+void __stdcall _Lazy_glPixelTexGenParameteriSGIS(GLenum pname, GLint param)               {if (__GLeeLazyLink((void**)&pglPixelTexGenParameteriSGIS, "glPixelTexGenParameteriSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glPixelTexGenParameteriSGIS(pname, param);}
+void __stdcall _Lazy_glPixelTexGenParameterivSGIS(GLenum pname, const GLint * params)     {if (__GLeeLazyLink((void**)&pglPixelTexGenParameterivSGIS, "glPixelTexGenParameterivSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glPixelTexGenParameterivSGIS(pname, params);}
+void __stdcall _Lazy_glPixelTexGenParameterfSGIS(GLenum pname, GLfloat param)             {if (__GLeeLazyLink((void**)&pglPixelTexGenParameterfSGIS, "glPixelTexGenParameterfSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glPixelTexGenParameterfSGIS(pname, param);}
+void __stdcall _Lazy_glPixelTexGenParameterfvSGIS(GLenum pname, const GLfloat * params)   {if (__GLeeLazyLink((void**)&pglPixelTexGenParameterfvSGIS, "glPixelTexGenParameterfvSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glPixelTexGenParameterfvSGIS(pname, params);}
+void __stdcall _Lazy_glGetPixelTexGenParameterivSGIS(GLenum pname, GLint * params)        {if (__GLeeLazyLink((void**)&pglGetPixelTexGenParameterivSGIS, "glGetPixelTexGenParameterivSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glGetPixelTexGenParameterivSGIS(pname, params);}
+void __stdcall _Lazy_glGetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat * params)      {if (__GLeeLazyLink((void**)&pglGetPixelTexGenParameterfvSGIS, "glGetPixelTexGenParameterfvSGIS", &_GLEE_SGIS_pixel_texture, "GL_SGIS_pixel_texture")) glGetPixelTexGenParameterfvSGIS(pname, params);}
 PFNGLPIXELTEXGENPARAMETERISGISPROC pglPixelTexGenParameteriSGIS=_Lazy_glPixelTexGenParameteriSGIS;
 PFNGLPIXELTEXGENPARAMETERIVSGISPROC pglPixelTexGenParameterivSGIS=_Lazy_glPixelTexGenParameterivSGIS;
 PFNGLPIXELTEXGENPARAMETERFSGISPROC pglPixelTexGenParameterfSGIS=_Lazy_glPixelTexGenParameterfSGIS;
@@ -1881,15 +1913,15 @@ PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC pglGetPixelTexGenParameterfvSGIS=_Lazy_gl
 //GL_SGIX_pixel_texture
 
 #ifdef __GLEE_GL_SGIX_pixel_texture
-void __stdcall _Lazy_glPixelTexGenSGIX(GLenum mode)                                       {if (GLeeInit()) glPixelTexGenSGIX(mode);}
+void __stdcall _Lazy_glPixelTexGenSGIX(GLenum mode)                                       {if (__GLeeLazyLink((void**)&pglPixelTexGenSGIX, "glPixelTexGenSGIX", &_GLEE_SGIX_pixel_texture, "GL_SGIX_pixel_texture")) glPixelTexGenSGIX(mode);}
 PFNGLPIXELTEXGENSGIXPROC pglPixelTexGenSGIX=_Lazy_glPixelTexGenSGIX;
 #endif 
 
 //GL_SGIS_texture4D
 
 #ifdef __GLEE_GL_SGIS_texture4D
-void __stdcall _Lazy_glTexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexImage4DSGIS(target, level, internalformat, width, height, depth, size4d, border, format, type, pixels);}
-void __stdcall _Lazy_glTexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const GLvoid * pixels)  {if (GLeeInit()) glTexSubImage4DSGIS(target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels);}
+void __stdcall _Lazy_glTexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexImage4DSGIS, "glTexImage4DSGIS", &_GLEE_SGIS_texture4D, "GL_SGIS_texture4D")) glTexImage4DSGIS(target, level, internalformat, width, height, depth, size4d, border, format, type, pixels);}
+void __stdcall _Lazy_glTexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const GLvoid * pixels)  {if (__GLeeLazyLink((void**)&pglTexSubImage4DSGIS, "glTexSubImage4DSGIS", &_GLEE_SGIS_texture4D, "GL_SGIS_texture4D")) glTexSubImage4DSGIS(target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels);}
 PFNGLTEXIMAGE4DSGISPROC pglTexImage4DSGIS=_Lazy_glTexImage4DSGIS;
 PFNGLTEXSUBIMAGE4DSGISPROC pglTexSubImage4DSGIS=_Lazy_glTexSubImage4DSGIS;
 #endif 
@@ -1907,12 +1939,12 @@ PFNGLTEXSUBIMAGE4DSGISPROC pglTexSubImage4DSGIS=_Lazy_glTexSubImage4DSGIS;
 //GL_EXT_texture_object
 
 #ifdef __GLEE_GL_EXT_texture_object
-GLboolean __stdcall _Lazy_glAreTexturesResidentEXT(GLsizei n, const GLuint * textures, GLboolean * residences)  {if (GLeeInit()) return glAreTexturesResidentEXT(n, textures, residences); return (GLboolean)0;}
-void __stdcall _Lazy_glBindTextureEXT(GLenum target, GLuint texture)                      {if (GLeeInit()) glBindTextureEXT(target, texture);}
-void __stdcall _Lazy_glDeleteTexturesEXT(GLsizei n, const GLuint * textures)              {if (GLeeInit()) glDeleteTexturesEXT(n, textures);}
-void __stdcall _Lazy_glGenTexturesEXT(GLsizei n, GLuint * textures)                       {if (GLeeInit()) glGenTexturesEXT(n, textures);}
-GLboolean __stdcall _Lazy_glIsTextureEXT(GLuint texture)                                  {if (GLeeInit()) return glIsTextureEXT(texture); return (GLboolean)0;}
-void __stdcall _Lazy_glPrioritizeTexturesEXT(GLsizei n, const GLuint * textures, const GLclampf * priorities)  {if (GLeeInit()) glPrioritizeTexturesEXT(n, textures, priorities);}
+GLboolean __stdcall _Lazy_glAreTexturesResidentEXT(GLsizei n, const GLuint * textures, GLboolean * residences)  {if (__GLeeLazyLink((void**)&pglAreTexturesResidentEXT, "glAreTexturesResidentEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) return glAreTexturesResidentEXT(n, textures, residences); return (GLboolean)0;}
+void __stdcall _Lazy_glBindTextureEXT(GLenum target, GLuint texture)                      {if (__GLeeLazyLink((void**)&pglBindTextureEXT, "glBindTextureEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) glBindTextureEXT(target, texture);}
+void __stdcall _Lazy_glDeleteTexturesEXT(GLsizei n, const GLuint * textures)              {if (__GLeeLazyLink((void**)&pglDeleteTexturesEXT, "glDeleteTexturesEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) glDeleteTexturesEXT(n, textures);}
+void __stdcall _Lazy_glGenTexturesEXT(GLsizei n, GLuint * textures)                       {if (__GLeeLazyLink((void**)&pglGenTexturesEXT, "glGenTexturesEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) glGenTexturesEXT(n, textures);}
+GLboolean __stdcall _Lazy_glIsTextureEXT(GLuint texture)                                  {if (__GLeeLazyLink((void**)&pglIsTextureEXT, "glIsTextureEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) return glIsTextureEXT(texture); return (GLboolean)0;}
+void __stdcall _Lazy_glPrioritizeTexturesEXT(GLsizei n, const GLuint * textures, const GLclampf * priorities)  {if (__GLeeLazyLink((void**)&pglPrioritizeTexturesEXT, "glPrioritizeTexturesEXT", &_GLEE_EXT_texture_object, "GL_EXT_texture_object")) glPrioritizeTexturesEXT(n, textures, priorities);}
 PFNGLARETEXTURESRESIDENTEXTPROC pglAreTexturesResidentEXT=_Lazy_glAreTexturesResidentEXT;
 PFNGLBINDTEXTUREEXTPROC pglBindTextureEXT=_Lazy_glBindTextureEXT;
 PFNGLDELETETEXTURESEXTPROC pglDeleteTexturesEXT=_Lazy_glDeleteTexturesEXT;
@@ -1924,8 +1956,8 @@ PFNGLPRIORITIZETEXTURESEXTPROC pglPrioritizeTexturesEXT=_Lazy_glPrioritizeTextur
 //GL_SGIS_detail_texture
 
 #ifdef __GLEE_GL_SGIS_detail_texture
-void __stdcall _Lazy_glDetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)  {if (GLeeInit()) glDetailTexFuncSGIS(target, n, points);}
-void __stdcall _Lazy_glGetDetailTexFuncSGIS(GLenum target, GLfloat * points)              {if (GLeeInit()) glGetDetailTexFuncSGIS(target, points);}
+void __stdcall _Lazy_glDetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)  {if (__GLeeLazyLink((void**)&pglDetailTexFuncSGIS, "glDetailTexFuncSGIS", &_GLEE_SGIS_detail_texture, "GL_SGIS_detail_texture")) glDetailTexFuncSGIS(target, n, points);}
+void __stdcall _Lazy_glGetDetailTexFuncSGIS(GLenum target, GLfloat * points)              {if (__GLeeLazyLink((void**)&pglGetDetailTexFuncSGIS, "glGetDetailTexFuncSGIS", &_GLEE_SGIS_detail_texture, "GL_SGIS_detail_texture")) glGetDetailTexFuncSGIS(target, points);}
 PFNGLDETAILTEXFUNCSGISPROC pglDetailTexFuncSGIS=_Lazy_glDetailTexFuncSGIS;
 PFNGLGETDETAILTEXFUNCSGISPROC pglGetDetailTexFuncSGIS=_Lazy_glGetDetailTexFuncSGIS;
 #endif 
@@ -1933,8 +1965,8 @@ PFNGLGETDETAILTEXFUNCSGISPROC pglGetDetailTexFuncSGIS=_Lazy_glGetDetailTexFuncSG
 //GL_SGIS_sharpen_texture
 
 #ifdef __GLEE_GL_SGIS_sharpen_texture
-void __stdcall _Lazy_glSharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)  {if (GLeeInit()) glSharpenTexFuncSGIS(target, n, points);}
-void __stdcall _Lazy_glGetSharpenTexFuncSGIS(GLenum target, GLfloat * points)             {if (GLeeInit()) glGetSharpenTexFuncSGIS(target, points);}
+void __stdcall _Lazy_glSharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)  {if (__GLeeLazyLink((void**)&pglSharpenTexFuncSGIS, "glSharpenTexFuncSGIS", &_GLEE_SGIS_sharpen_texture, "GL_SGIS_sharpen_texture")) glSharpenTexFuncSGIS(target, n, points);}
+void __stdcall _Lazy_glGetSharpenTexFuncSGIS(GLenum target, GLfloat * points)             {if (__GLeeLazyLink((void**)&pglGetSharpenTexFuncSGIS, "glGetSharpenTexFuncSGIS", &_GLEE_SGIS_sharpen_texture, "GL_SGIS_sharpen_texture")) glGetSharpenTexFuncSGIS(target, points);}
 PFNGLSHARPENTEXFUNCSGISPROC pglSharpenTexFuncSGIS=_Lazy_glSharpenTexFuncSGIS;
 PFNGLGETSHARPENTEXFUNCSGISPROC pglGetSharpenTexFuncSGIS=_Lazy_glGetSharpenTexFuncSGIS;
 #endif 
@@ -1952,8 +1984,8 @@ PFNGLGETSHARPENTEXFUNCSGISPROC pglGetSharpenTexFuncSGIS=_Lazy_glGetSharpenTexFun
 //GL_SGIS_multisample
 
 #ifdef __GLEE_GL_SGIS_multisample
-void __stdcall _Lazy_glSampleMaskSGIS(GLclampf value, GLboolean invert)                   {if (GLeeInit()) glSampleMaskSGIS(value, invert);}
-void __stdcall _Lazy_glSamplePatternSGIS(GLenum pattern)                                  {if (GLeeInit()) glSamplePatternSGIS(pattern);}
+void __stdcall _Lazy_glSampleMaskSGIS(GLclampf value, GLboolean invert)                   {if (__GLeeLazyLink((void**)&pglSampleMaskSGIS, "glSampleMaskSGIS", &_GLEE_SGIS_multisample, "GL_SGIS_multisample")) glSampleMaskSGIS(value, invert);}
+void __stdcall _Lazy_glSamplePatternSGIS(GLenum pattern)                                  {if (__GLeeLazyLink((void**)&pglSamplePatternSGIS, "glSamplePatternSGIS", &_GLEE_SGIS_multisample, "GL_SGIS_multisample")) glSamplePatternSGIS(pattern);}
 PFNGLSAMPLEMASKSGISPROC pglSampleMaskSGIS=_Lazy_glSampleMaskSGIS;
 PFNGLSAMPLEPATTERNSGISPROC pglSamplePatternSGIS=_Lazy_glSamplePatternSGIS;
 #endif 
@@ -1966,15 +1998,15 @@ PFNGLSAMPLEPATTERNSGISPROC pglSamplePatternSGIS=_Lazy_glSamplePatternSGIS;
 //GL_EXT_vertex_array
 
 #ifdef __GLEE_GL_EXT_vertex_array
-void __stdcall _Lazy_glArrayElementEXT(GLint i)                                           {if (GLeeInit()) glArrayElementEXT(i);}
-void __stdcall _Lazy_glColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (GLeeInit()) glColorPointerEXT(size, type, stride, count, pointer);}
-void __stdcall _Lazy_glDrawArraysEXT(GLenum mode, GLint first, GLsizei count)             {if (GLeeInit()) glDrawArraysEXT(mode, first, count);}
-void __stdcall _Lazy_glEdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean * pointer)  {if (GLeeInit()) glEdgeFlagPointerEXT(stride, count, pointer);}
-void __stdcall _Lazy_glGetPointervEXT(GLenum pname, GLvoid* * params)                     {if (GLeeInit()) glGetPointervEXT(pname, params);}
-void __stdcall _Lazy_glIndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (GLeeInit()) glIndexPointerEXT(type, stride, count, pointer);}
-void __stdcall _Lazy_glNormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (GLeeInit()) glNormalPointerEXT(type, stride, count, pointer);}
-void __stdcall _Lazy_glTexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (GLeeInit()) glTexCoordPointerEXT(size, type, stride, count, pointer);}
-void __stdcall _Lazy_glVertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (GLeeInit()) glVertexPointerEXT(size, type, stride, count, pointer);}
+void __stdcall _Lazy_glArrayElementEXT(GLint i)                                           {if (__GLeeLazyLink((void**)&pglArrayElementEXT, "glArrayElementEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glArrayElementEXT(i);}
+void __stdcall _Lazy_glColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglColorPointerEXT, "glColorPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glColorPointerEXT(size, type, stride, count, pointer);}
+void __stdcall _Lazy_glDrawArraysEXT(GLenum mode, GLint first, GLsizei count)             {if (__GLeeLazyLink((void**)&pglDrawArraysEXT, "glDrawArraysEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glDrawArraysEXT(mode, first, count);}
+void __stdcall _Lazy_glEdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean * pointer)  {if (__GLeeLazyLink((void**)&pglEdgeFlagPointerEXT, "glEdgeFlagPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glEdgeFlagPointerEXT(stride, count, pointer);}
+void __stdcall _Lazy_glGetPointervEXT(GLenum pname, GLvoid* * params)                     {if (__GLeeLazyLink((void**)&pglGetPointervEXT, "glGetPointervEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glGetPointervEXT(pname, params);}
+void __stdcall _Lazy_glIndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglIndexPointerEXT, "glIndexPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glIndexPointerEXT(type, stride, count, pointer);}
+void __stdcall _Lazy_glNormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglNormalPointerEXT, "glNormalPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glNormalPointerEXT(type, stride, count, pointer);}
+void __stdcall _Lazy_glTexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglTexCoordPointerEXT, "glTexCoordPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glTexCoordPointerEXT(size, type, stride, count, pointer);}
+void __stdcall _Lazy_glVertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglVertexPointerEXT, "glVertexPointerEXT", &_GLEE_EXT_vertex_array, "GL_EXT_vertex_array")) glVertexPointerEXT(size, type, stride, count, pointer);}
 PFNGLARRAYELEMENTEXTPROC pglArrayElementEXT=_Lazy_glArrayElementEXT;
 PFNGLCOLORPOINTEREXTPROC pglColorPointerEXT=_Lazy_glColorPointerEXT;
 PFNGLDRAWARRAYSEXTPROC pglDrawArraysEXT=_Lazy_glDrawArraysEXT;
@@ -2019,7 +2051,7 @@ PFNGLVERTEXPOINTEREXTPROC pglVertexPointerEXT=_Lazy_glVertexPointerEXT;
 //GL_EXT_blend_minmax
 
 #ifdef __GLEE_GL_EXT_blend_minmax
-void __stdcall _Lazy_glBlendEquationEXT(GLenum mode)                                      {if (GLeeInit()) glBlendEquationEXT(mode);}
+void __stdcall _Lazy_glBlendEquationEXT(GLenum mode)                                      {if (__GLeeLazyLink((void**)&pglBlendEquationEXT, "glBlendEquationEXT", &_GLEE_EXT_blend_minmax, "GL_EXT_blend_minmax")) glBlendEquationEXT(mode);}
 PFNGLBLENDEQUATIONEXTPROC pglBlendEquationEXT=_Lazy_glBlendEquationEXT;
 #endif 
 
@@ -2051,10 +2083,10 @@ PFNGLBLENDEQUATIONEXTPROC pglBlendEquationEXT=_Lazy_glBlendEquationEXT;
 //GL_SGIX_sprite
 
 #ifdef __GLEE_GL_SGIX_sprite
-void __stdcall _Lazy_glSpriteParameterfSGIX(GLenum pname, GLfloat param)                  {if (GLeeInit()) glSpriteParameterfSGIX(pname, param);}
-void __stdcall _Lazy_glSpriteParameterfvSGIX(GLenum pname, const GLfloat * params)        {if (GLeeInit()) glSpriteParameterfvSGIX(pname, params);}
-void __stdcall _Lazy_glSpriteParameteriSGIX(GLenum pname, GLint param)                    {if (GLeeInit()) glSpriteParameteriSGIX(pname, param);}
-void __stdcall _Lazy_glSpriteParameterivSGIX(GLenum pname, const GLint * params)          {if (GLeeInit()) glSpriteParameterivSGIX(pname, params);}
+void __stdcall _Lazy_glSpriteParameterfSGIX(GLenum pname, GLfloat param)                  {if (__GLeeLazyLink((void**)&pglSpriteParameterfSGIX, "glSpriteParameterfSGIX", &_GLEE_SGIX_sprite, "GL_SGIX_sprite")) glSpriteParameterfSGIX(pname, param);}
+void __stdcall _Lazy_glSpriteParameterfvSGIX(GLenum pname, const GLfloat * params)        {if (__GLeeLazyLink((void**)&pglSpriteParameterfvSGIX, "glSpriteParameterfvSGIX", &_GLEE_SGIX_sprite, "GL_SGIX_sprite")) glSpriteParameterfvSGIX(pname, params);}
+void __stdcall _Lazy_glSpriteParameteriSGIX(GLenum pname, GLint param)                    {if (__GLeeLazyLink((void**)&pglSpriteParameteriSGIX, "glSpriteParameteriSGIX", &_GLEE_SGIX_sprite, "GL_SGIX_sprite")) glSpriteParameteriSGIX(pname, param);}
+void __stdcall _Lazy_glSpriteParameterivSGIX(GLenum pname, const GLint * params)          {if (__GLeeLazyLink((void**)&pglSpriteParameterivSGIX, "glSpriteParameterivSGIX", &_GLEE_SGIX_sprite, "GL_SGIX_sprite")) glSpriteParameterivSGIX(pname, params);}
 PFNGLSPRITEPARAMETERFSGIXPROC pglSpriteParameterfSGIX=_Lazy_glSpriteParameterfSGIX;
 PFNGLSPRITEPARAMETERFVSGIXPROC pglSpriteParameterfvSGIX=_Lazy_glSpriteParameterfvSGIX;
 PFNGLSPRITEPARAMETERISGIXPROC pglSpriteParameteriSGIX=_Lazy_glSpriteParameteriSGIX;
@@ -2069,8 +2101,8 @@ PFNGLSPRITEPARAMETERIVSGIXPROC pglSpriteParameterivSGIX=_Lazy_glSpriteParameteri
 //GL_EXT_point_parameters
 
 #ifdef __GLEE_GL_EXT_point_parameters
-void __stdcall _Lazy_glPointParameterfEXT(GLenum pname, GLfloat param)                    {if (GLeeInit()) glPointParameterfEXT(pname, param);}
-void __stdcall _Lazy_glPointParameterfvEXT(GLenum pname, const GLfloat * params)          {if (GLeeInit()) glPointParameterfvEXT(pname, params);}
+void __stdcall _Lazy_glPointParameterfEXT(GLenum pname, GLfloat param)                    {if (__GLeeLazyLink((void**)&pglPointParameterfEXT, "glPointParameterfEXT", &_GLEE_EXT_point_parameters, "GL_EXT_point_parameters")) glPointParameterfEXT(pname, param);}
+void __stdcall _Lazy_glPointParameterfvEXT(GLenum pname, const GLfloat * params)          {if (__GLeeLazyLink((void**)&pglPointParameterfvEXT, "glPointParameterfvEXT", &_GLEE_EXT_point_parameters, "GL_EXT_point_parameters")) glPointParameterfvEXT(pname, params);}
 PFNGLPOINTPARAMETERFEXTPROC pglPointParameterfEXT=_Lazy_glPointParameterfEXT;
 PFNGLPOINTPARAMETERFVEXTPROC pglPointParameterfvEXT=_Lazy_glPointParameterfvEXT;
 #endif 
@@ -2078,8 +2110,8 @@ PFNGLPOINTPARAMETERFVEXTPROC pglPointParameterfvEXT=_Lazy_glPointParameterfvEXT;
 //GL_SGIS_point_parameters
 
 #ifdef __GLEE_GL_SGIS_point_parameters
-void __stdcall _Lazy_glPointParameterfSGIS(GLenum pname, GLfloat param)                   {if (GLeeInit()) glPointParameterfSGIS(pname, param);}
-void __stdcall _Lazy_glPointParameterfvSGIS(GLenum pname, const GLfloat * params)         {if (GLeeInit()) glPointParameterfvSGIS(pname, params);}
+void __stdcall _Lazy_glPointParameterfSGIS(GLenum pname, GLfloat param)                   {if (__GLeeLazyLink((void**)&pglPointParameterfSGIS, "glPointParameterfSGIS", &_GLEE_SGIS_point_parameters, "GL_SGIS_point_parameters")) glPointParameterfSGIS(pname, param);}
+void __stdcall _Lazy_glPointParameterfvSGIS(GLenum pname, const GLfloat * params)         {if (__GLeeLazyLink((void**)&pglPointParameterfvSGIS, "glPointParameterfvSGIS", &_GLEE_SGIS_point_parameters, "GL_SGIS_point_parameters")) glPointParameterfvSGIS(pname, params);}
 PFNGLPOINTPARAMETERFSGISPROC pglPointParameterfSGIS=_Lazy_glPointParameterfSGIS;
 PFNGLPOINTPARAMETERFVSGISPROC pglPointParameterfvSGIS=_Lazy_glPointParameterfvSGIS;
 #endif 
@@ -2087,12 +2119,12 @@ PFNGLPOINTPARAMETERFVSGISPROC pglPointParameterfvSGIS=_Lazy_glPointParameterfvSG
 //GL_SGIX_instruments
 
 #ifdef __GLEE_GL_SGIX_instruments
-GLint __stdcall _Lazy_glGetInstrumentsSGIX(void)                                          {if (GLeeInit()) return glGetInstrumentsSGIX(); return (GLint)0;}
-void __stdcall _Lazy_glInstrumentsBufferSGIX(GLsizei size, GLint * buffer)                {if (GLeeInit()) glInstrumentsBufferSGIX(size, buffer);}
-GLint __stdcall _Lazy_glPollInstrumentsSGIX(GLint * marker_p)                             {if (GLeeInit()) return glPollInstrumentsSGIX(marker_p); return (GLint)0;}
-void __stdcall _Lazy_glReadInstrumentsSGIX(GLint marker)                                  {if (GLeeInit()) glReadInstrumentsSGIX(marker);}
-void __stdcall _Lazy_glStartInstrumentsSGIX(void)                                         {if (GLeeInit()) glStartInstrumentsSGIX();}
-void __stdcall _Lazy_glStopInstrumentsSGIX(GLint marker)                                  {if (GLeeInit()) glStopInstrumentsSGIX(marker);}
+GLint __stdcall _Lazy_glGetInstrumentsSGIX(void)                                          {if (__GLeeLazyLink((void**)&pglGetInstrumentsSGIX, "glGetInstrumentsSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) return glGetInstrumentsSGIX(); return (GLint)0;}
+void __stdcall _Lazy_glInstrumentsBufferSGIX(GLsizei size, GLint * buffer)                {if (__GLeeLazyLink((void**)&pglInstrumentsBufferSGIX, "glInstrumentsBufferSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) glInstrumentsBufferSGIX(size, buffer);}
+GLint __stdcall _Lazy_glPollInstrumentsSGIX(GLint * marker_p)                             {if (__GLeeLazyLink((void**)&pglPollInstrumentsSGIX, "glPollInstrumentsSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) return glPollInstrumentsSGIX(marker_p); return (GLint)0;}
+void __stdcall _Lazy_glReadInstrumentsSGIX(GLint marker)                                  {if (__GLeeLazyLink((void**)&pglReadInstrumentsSGIX, "glReadInstrumentsSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) glReadInstrumentsSGIX(marker);}
+void __stdcall _Lazy_glStartInstrumentsSGIX(void)                                         {if (__GLeeLazyLink((void**)&pglStartInstrumentsSGIX, "glStartInstrumentsSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) glStartInstrumentsSGIX();}
+void __stdcall _Lazy_glStopInstrumentsSGIX(GLint marker)                                  {if (__GLeeLazyLink((void**)&pglStopInstrumentsSGIX, "glStopInstrumentsSGIX", &_GLEE_SGIX_instruments, "GL_SGIX_instruments")) glStopInstrumentsSGIX(marker);}
 PFNGLGETINSTRUMENTSSGIXPROC pglGetInstrumentsSGIX=_Lazy_glGetInstrumentsSGIX;
 PFNGLINSTRUMENTSBUFFERSGIXPROC pglInstrumentsBufferSGIX=_Lazy_glInstrumentsBufferSGIX;
 PFNGLPOLLINSTRUMENTSSGIXPROC pglPollInstrumentsSGIX=_Lazy_glPollInstrumentsSGIX;
@@ -2109,14 +2141,14 @@ PFNGLSTOPINSTRUMENTSSGIXPROC pglStopInstrumentsSGIX=_Lazy_glStopInstrumentsSGIX;
 //GL_SGIX_framezoom
 
 #ifdef __GLEE_GL_SGIX_framezoom
-void __stdcall _Lazy_glFrameZoomSGIX(GLint factor)                                        {if (GLeeInit()) glFrameZoomSGIX(factor);}
+void __stdcall _Lazy_glFrameZoomSGIX(GLint factor)                                        {if (__GLeeLazyLink((void**)&pglFrameZoomSGIX, "glFrameZoomSGIX", &_GLEE_SGIX_framezoom, "GL_SGIX_framezoom")) glFrameZoomSGIX(factor);}
 PFNGLFRAMEZOOMSGIXPROC pglFrameZoomSGIX=_Lazy_glFrameZoomSGIX;
 #endif 
 
 //GL_SGIX_tag_sample_buffer
 
 #ifdef __GLEE_GL_SGIX_tag_sample_buffer
-void __stdcall _Lazy_glTagSampleBufferSGIX(void)                                          {if (GLeeInit()) glTagSampleBufferSGIX();}
+void __stdcall _Lazy_glTagSampleBufferSGIX(void)                                          {if (__GLeeLazyLink((void**)&pglTagSampleBufferSGIX, "glTagSampleBufferSGIX", &_GLEE_SGIX_tag_sample_buffer, "GL_SGIX_tag_sample_buffer")) glTagSampleBufferSGIX();}
 PFNGLTAGSAMPLEBUFFERSGIXPROC pglTagSampleBufferSGIX=_Lazy_glTagSampleBufferSGIX;
 #endif 
 
@@ -2128,10 +2160,10 @@ PFNGLTAGSAMPLEBUFFERSGIXPROC pglTagSampleBufferSGIX=_Lazy_glTagSampleBufferSGIX;
 //GL_SGIX_polynomial_ffd
 
 #ifdef __GLEE_GL_SGIX_polynomial_ffd
-void __stdcall _Lazy_glDeformationMap3dSGIX(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble * points)  {if (GLeeInit()) glDeformationMap3dSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);}
-void __stdcall _Lazy_glDeformationMap3fSGIX(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat * points)  {if (GLeeInit()) glDeformationMap3fSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);}
-void __stdcall _Lazy_glDeformSGIX(GLbitfield mask)                                        {if (GLeeInit()) glDeformSGIX(mask);}
-void __stdcall _Lazy_glLoadIdentityDeformationMapSGIX(GLbitfield mask)                    {if (GLeeInit()) glLoadIdentityDeformationMapSGIX(mask);}
+void __stdcall _Lazy_glDeformationMap3dSGIX(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble * points)  {if (__GLeeLazyLink((void**)&pglDeformationMap3dSGIX, "glDeformationMap3dSGIX", &_GLEE_SGIX_polynomial_ffd, "GL_SGIX_polynomial_ffd")) glDeformationMap3dSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);}
+void __stdcall _Lazy_glDeformationMap3fSGIX(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat * points)  {if (__GLeeLazyLink((void**)&pglDeformationMap3fSGIX, "glDeformationMap3fSGIX", &_GLEE_SGIX_polynomial_ffd, "GL_SGIX_polynomial_ffd")) glDeformationMap3fSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);}
+void __stdcall _Lazy_glDeformSGIX(GLbitfield mask)                                        {if (__GLeeLazyLink((void**)&pglDeformSGIX, "glDeformSGIX", &_GLEE_SGIX_polynomial_ffd, "GL_SGIX_polynomial_ffd")) glDeformSGIX(mask);}
+void __stdcall _Lazy_glLoadIdentityDeformationMapSGIX(GLbitfield mask)                    {if (__GLeeLazyLink((void**)&pglLoadIdentityDeformationMapSGIX, "glLoadIdentityDeformationMapSGIX", &_GLEE_SGIX_polynomial_ffd, "GL_SGIX_polynomial_ffd")) glLoadIdentityDeformationMapSGIX(mask);}
 PFNGLDEFORMATIONMAP3DSGIXPROC pglDeformationMap3dSGIX=_Lazy_glDeformationMap3dSGIX;
 PFNGLDEFORMATIONMAP3FSGIXPROC pglDeformationMap3fSGIX=_Lazy_glDeformationMap3fSGIX;
 PFNGLDEFORMSGIXPROC pglDeformSGIX=_Lazy_glDeformSGIX;
@@ -2141,14 +2173,14 @@ PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC pglLoadIdentityDeformationMapSGIX=_Lazy_
 //GL_SGIX_reference_plane
 
 #ifdef __GLEE_GL_SGIX_reference_plane
-void __stdcall _Lazy_glReferencePlaneSGIX(const GLdouble * equation)                      {if (GLeeInit()) glReferencePlaneSGIX(equation);}
+void __stdcall _Lazy_glReferencePlaneSGIX(const GLdouble * equation)                      {if (__GLeeLazyLink((void**)&pglReferencePlaneSGIX, "glReferencePlaneSGIX", &_GLEE_SGIX_reference_plane, "GL_SGIX_reference_plane")) glReferencePlaneSGIX(equation);}
 PFNGLREFERENCEPLANESGIXPROC pglReferencePlaneSGIX=_Lazy_glReferencePlaneSGIX;
 #endif 
 
 //GL_SGIX_flush_raster
 
 #ifdef __GLEE_GL_SGIX_flush_raster
-void __stdcall _Lazy_glFlushRasterSGIX(void)                                              {if (GLeeInit()) glFlushRasterSGIX();}
+void __stdcall _Lazy_glFlushRasterSGIX(void)                                              {if (__GLeeLazyLink((void**)&pglFlushRasterSGIX, "glFlushRasterSGIX", &_GLEE_SGIX_flush_raster, "GL_SGIX_flush_raster")) glFlushRasterSGIX();}
 PFNGLFLUSHRASTERSGIXPROC pglFlushRasterSGIX=_Lazy_glFlushRasterSGIX;
 #endif 
 
@@ -2160,8 +2192,8 @@ PFNGLFLUSHRASTERSGIXPROC pglFlushRasterSGIX=_Lazy_glFlushRasterSGIX;
 //GL_SGIS_fog_function
 
 #ifdef __GLEE_GL_SGIS_fog_function
-void __stdcall _Lazy_glFogFuncSGIS(GLsizei n, const GLfloat * points)                     {if (GLeeInit()) glFogFuncSGIS(n, points);}
-void __stdcall _Lazy_glGetFogFuncSGIS(GLfloat * points)                                   {if (GLeeInit()) glGetFogFuncSGIS(points);}
+void __stdcall _Lazy_glFogFuncSGIS(GLsizei n, const GLfloat * points)                     {if (__GLeeLazyLink((void**)&pglFogFuncSGIS, "glFogFuncSGIS", &_GLEE_SGIS_fog_function, "GL_SGIS_fog_function")) glFogFuncSGIS(n, points);}
+void __stdcall _Lazy_glGetFogFuncSGIS(GLfloat * points)                                   {if (__GLeeLazyLink((void**)&pglGetFogFuncSGIS, "glGetFogFuncSGIS", &_GLEE_SGIS_fog_function, "GL_SGIS_fog_function")) glGetFogFuncSGIS(points);}
 PFNGLFOGFUNCSGISPROC pglFogFuncSGIS=_Lazy_glFogFuncSGIS;
 PFNGLGETFOGFUNCSGISPROC pglGetFogFuncSGIS=_Lazy_glGetFogFuncSGIS;
 #endif 
@@ -2174,12 +2206,12 @@ PFNGLGETFOGFUNCSGISPROC pglGetFogFuncSGIS=_Lazy_glGetFogFuncSGIS;
 //GL_HP_image_transform
 
 #ifdef __GLEE_GL_HP_image_transform
-void __stdcall _Lazy_glImageTransformParameteriHP(GLenum target, GLenum pname, GLint param)  {if (GLeeInit()) glImageTransformParameteriHP(target, pname, param);}
-void __stdcall _Lazy_glImageTransformParameterfHP(GLenum target, GLenum pname, GLfloat param)  {if (GLeeInit()) glImageTransformParameterfHP(target, pname, param);}
-void __stdcall _Lazy_glImageTransformParameterivHP(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glImageTransformParameterivHP(target, pname, params);}
-void __stdcall _Lazy_glImageTransformParameterfvHP(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glImageTransformParameterfvHP(target, pname, params);}
-void __stdcall _Lazy_glGetImageTransformParameterivHP(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetImageTransformParameterivHP(target, pname, params);}
-void __stdcall _Lazy_glGetImageTransformParameterfvHP(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetImageTransformParameterfvHP(target, pname, params);}
+void __stdcall _Lazy_glImageTransformParameteriHP(GLenum target, GLenum pname, GLint param)  {if (__GLeeLazyLink((void**)&pglImageTransformParameteriHP, "glImageTransformParameteriHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glImageTransformParameteriHP(target, pname, param);}
+void __stdcall _Lazy_glImageTransformParameterfHP(GLenum target, GLenum pname, GLfloat param)  {if (__GLeeLazyLink((void**)&pglImageTransformParameterfHP, "glImageTransformParameterfHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glImageTransformParameterfHP(target, pname, param);}
+void __stdcall _Lazy_glImageTransformParameterivHP(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglImageTransformParameterivHP, "glImageTransformParameterivHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glImageTransformParameterivHP(target, pname, params);}
+void __stdcall _Lazy_glImageTransformParameterfvHP(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglImageTransformParameterfvHP, "glImageTransformParameterfvHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glImageTransformParameterfvHP(target, pname, params);}
+void __stdcall _Lazy_glGetImageTransformParameterivHP(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetImageTransformParameterivHP, "glGetImageTransformParameterivHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glGetImageTransformParameterivHP(target, pname, params);}
+void __stdcall _Lazy_glGetImageTransformParameterfvHP(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetImageTransformParameterfvHP, "glGetImageTransformParameterfvHP", &_GLEE_HP_image_transform, "GL_HP_image_transform")) glGetImageTransformParameterfvHP(target, pname, params);}
 PFNGLIMAGETRANSFORMPARAMETERIHPPROC pglImageTransformParameteriHP=_Lazy_glImageTransformParameteriHP;
 PFNGLIMAGETRANSFORMPARAMETERFHPPROC pglImageTransformParameterfHP=_Lazy_glImageTransformParameterfHP;
 PFNGLIMAGETRANSFORMPARAMETERIVHPPROC pglImageTransformParameterivHP=_Lazy_glImageTransformParameterivHP;
@@ -2206,8 +2238,8 @@ PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC pglGetImageTransformParameterfvHP=_Lazy_
 //GL_EXT_color_subtable
 
 #ifdef __GLEE_GL_EXT_color_subtable
-void __stdcall _Lazy_glColorSubTableEXT(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)  {if (GLeeInit()) glColorSubTableEXT(target, start, count, format, type, data);}
-void __stdcall _Lazy_glCopyColorSubTableEXT(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)  {if (GLeeInit()) glCopyColorSubTableEXT(target, start, x, y, width);}
+void __stdcall _Lazy_glColorSubTableEXT(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)  {if (__GLeeLazyLink((void**)&pglColorSubTableEXT, "glColorSubTableEXT", &_GLEE_EXT_color_subtable, "GL_EXT_color_subtable")) glColorSubTableEXT(target, start, count, format, type, data);}
+void __stdcall _Lazy_glCopyColorSubTableEXT(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)  {if (__GLeeLazyLink((void**)&pglCopyColorSubTableEXT, "glCopyColorSubTableEXT", &_GLEE_EXT_color_subtable, "GL_EXT_color_subtable")) glCopyColorSubTableEXT(target, start, x, y, width);}
 PFNGLCOLORSUBTABLEEXTPROC pglColorSubTableEXT=_Lazy_glColorSubTableEXT;
 PFNGLCOPYCOLORSUBTABLEEXTPROC pglCopyColorSubTableEXT=_Lazy_glCopyColorSubTableEXT;
 #endif 
@@ -2220,17 +2252,17 @@ PFNGLCOPYCOLORSUBTABLEEXTPROC pglCopyColorSubTableEXT=_Lazy_glCopyColorSubTableE
 //GL_PGI_misc_hints
 
 #ifdef __GLEE_GL_PGI_misc_hints
-void __stdcall _Lazy_glHintPGI(GLenum target, GLint mode)                                 {if (GLeeInit()) glHintPGI(target, mode);}
+void __stdcall _Lazy_glHintPGI(GLenum target, GLint mode)                                 {if (__GLeeLazyLink((void**)&pglHintPGI, "glHintPGI", &_GLEE_PGI_misc_hints, "GL_PGI_misc_hints")) glHintPGI(target, mode);}
 PFNGLHINTPGIPROC pglHintPGI=_Lazy_glHintPGI;
 #endif 
 
 //GL_EXT_paletted_texture
 
 #ifdef __GLEE_GL_EXT_paletted_texture
-void __stdcall _Lazy_glColorTableEXT(GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (GLeeInit()) glColorTableEXT(target, internalFormat, width, format, type, table);}
-void __stdcall _Lazy_glGetColorTableEXT(GLenum target, GLenum format, GLenum type, GLvoid * data)  {if (GLeeInit()) glGetColorTableEXT(target, format, type, data);}
-void __stdcall _Lazy_glGetColorTableParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetColorTableParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glGetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetColorTableParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glColorTableEXT(GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)  {if (__GLeeLazyLink((void**)&pglColorTableEXT, "glColorTableEXT", &_GLEE_EXT_paletted_texture, "GL_EXT_paletted_texture")) glColorTableEXT(target, internalFormat, width, format, type, table);}
+void __stdcall _Lazy_glGetColorTableEXT(GLenum target, GLenum format, GLenum type, GLvoid * data)  {if (__GLeeLazyLink((void**)&pglGetColorTableEXT, "glGetColorTableEXT", &_GLEE_EXT_paletted_texture, "GL_EXT_paletted_texture")) glGetColorTableEXT(target, format, type, data);}
+void __stdcall _Lazy_glGetColorTableParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameterivEXT, "glGetColorTableParameterivEXT", &_GLEE_EXT_paletted_texture, "GL_EXT_paletted_texture")) glGetColorTableParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glGetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetColorTableParameterfvEXT, "glGetColorTableParameterfvEXT", &_GLEE_EXT_paletted_texture, "GL_EXT_paletted_texture")) glGetColorTableParameterfvEXT(target, pname, params);}
 PFNGLCOLORTABLEEXTPROC pglColorTableEXT=_Lazy_glColorTableEXT;
 PFNGLGETCOLORTABLEEXTPROC pglGetColorTableEXT=_Lazy_glGetColorTableEXT;
 PFNGLGETCOLORTABLEPARAMETERIVEXTPROC pglGetColorTableParameterivEXT=_Lazy_glGetColorTableParameterivEXT;
@@ -2245,12 +2277,12 @@ PFNGLGETCOLORTABLEPARAMETERFVEXTPROC pglGetColorTableParameterfvEXT=_Lazy_glGetC
 //GL_SGIX_list_priority
 
 #ifdef __GLEE_GL_SGIX_list_priority
-void __stdcall _Lazy_glGetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetListParameterfvSGIX(list, pname, params);}
-void __stdcall _Lazy_glGetListParameterivSGIX(GLuint list, GLenum pname, GLint * params)  {if (GLeeInit()) glGetListParameterivSGIX(list, pname, params);}
-void __stdcall _Lazy_glListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)       {if (GLeeInit()) glListParameterfSGIX(list, pname, param);}
-void __stdcall _Lazy_glListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glListParameterfvSGIX(list, pname, params);}
-void __stdcall _Lazy_glListParameteriSGIX(GLuint list, GLenum pname, GLint param)         {if (GLeeInit()) glListParameteriSGIX(list, pname, param);}
-void __stdcall _Lazy_glListParameterivSGIX(GLuint list, GLenum pname, const GLint * params)  {if (GLeeInit()) glListParameterivSGIX(list, pname, params);}
+void __stdcall _Lazy_glGetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetListParameterfvSGIX, "glGetListParameterfvSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glGetListParameterfvSGIX(list, pname, params);}
+void __stdcall _Lazy_glGetListParameterivSGIX(GLuint list, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetListParameterivSGIX, "glGetListParameterivSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glGetListParameterivSGIX(list, pname, params);}
+void __stdcall _Lazy_glListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)       {if (__GLeeLazyLink((void**)&pglListParameterfSGIX, "glListParameterfSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glListParameterfSGIX(list, pname, param);}
+void __stdcall _Lazy_glListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglListParameterfvSGIX, "glListParameterfvSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glListParameterfvSGIX(list, pname, params);}
+void __stdcall _Lazy_glListParameteriSGIX(GLuint list, GLenum pname, GLint param)         {if (__GLeeLazyLink((void**)&pglListParameteriSGIX, "glListParameteriSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glListParameteriSGIX(list, pname, param);}
+void __stdcall _Lazy_glListParameterivSGIX(GLuint list, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglListParameterivSGIX, "glListParameterivSGIX", &_GLEE_SGIX_list_priority, "GL_SGIX_list_priority")) glListParameterivSGIX(list, pname, params);}
 PFNGLGETLISTPARAMETERFVSGIXPROC pglGetListParameterfvSGIX=_Lazy_glGetListParameterfvSGIX;
 PFNGLGETLISTPARAMETERIVSGIXPROC pglGetListParameterivSGIX=_Lazy_glGetListParameterivSGIX;
 PFNGLLISTPARAMETERFSGIXPROC pglListParameterfSGIX=_Lazy_glListParameterfSGIX;
@@ -2287,14 +2319,14 @@ PFNGLLISTPARAMETERIVSGIXPROC pglListParameterivSGIX=_Lazy_glListParameterivSGIX;
 //GL_EXT_index_material
 
 #ifdef __GLEE_GL_EXT_index_material
-void __stdcall _Lazy_glIndexMaterialEXT(GLenum face, GLenum mode)                         {if (GLeeInit()) glIndexMaterialEXT(face, mode);}
+void __stdcall _Lazy_glIndexMaterialEXT(GLenum face, GLenum mode)                         {if (__GLeeLazyLink((void**)&pglIndexMaterialEXT, "glIndexMaterialEXT", &_GLEE_EXT_index_material, "GL_EXT_index_material")) glIndexMaterialEXT(face, mode);}
 PFNGLINDEXMATERIALEXTPROC pglIndexMaterialEXT=_Lazy_glIndexMaterialEXT;
 #endif 
 
 //GL_EXT_index_func
 
 #ifdef __GLEE_GL_EXT_index_func
-void __stdcall _Lazy_glIndexFuncEXT(GLenum func, GLclampf ref)                            {if (GLeeInit()) glIndexFuncEXT(func, ref);}
+void __stdcall _Lazy_glIndexFuncEXT(GLenum func, GLclampf ref)                            {if (__GLeeLazyLink((void**)&pglIndexFuncEXT, "glIndexFuncEXT", &_GLEE_EXT_index_func, "GL_EXT_index_func")) glIndexFuncEXT(func, ref);}
 PFNGLINDEXFUNCEXTPROC pglIndexFuncEXT=_Lazy_glIndexFuncEXT;
 #endif 
 
@@ -2306,8 +2338,8 @@ PFNGLINDEXFUNCEXTPROC pglIndexFuncEXT=_Lazy_glIndexFuncEXT;
 //GL_EXT_compiled_vertex_array
 
 #ifdef __GLEE_GL_EXT_compiled_vertex_array
-void __stdcall _Lazy_glLockArraysEXT(GLint first, GLsizei count)                          {if (GLeeInit()) glLockArraysEXT(first, count);}
-void __stdcall _Lazy_glUnlockArraysEXT(void)                                              {if (GLeeInit()) glUnlockArraysEXT();}
+void __stdcall _Lazy_glLockArraysEXT(GLint first, GLsizei count)                          {if (__GLeeLazyLink((void**)&pglLockArraysEXT, "glLockArraysEXT", &_GLEE_EXT_compiled_vertex_array, "GL_EXT_compiled_vertex_array")) glLockArraysEXT(first, count);}
+void __stdcall _Lazy_glUnlockArraysEXT(void)                                              {if (__GLeeLazyLink((void**)&pglUnlockArraysEXT, "glUnlockArraysEXT", &_GLEE_EXT_compiled_vertex_array, "GL_EXT_compiled_vertex_array")) glUnlockArraysEXT();}
 PFNGLLOCKARRAYSEXTPROC pglLockArraysEXT=_Lazy_glLockArraysEXT;
 PFNGLUNLOCKARRAYSEXTPROC pglUnlockArraysEXT=_Lazy_glUnlockArraysEXT;
 #endif 
@@ -2315,8 +2347,8 @@ PFNGLUNLOCKARRAYSEXTPROC pglUnlockArraysEXT=_Lazy_glUnlockArraysEXT;
 //GL_EXT_cull_vertex
 
 #ifdef __GLEE_GL_EXT_cull_vertex
-void __stdcall _Lazy_glCullParameterdvEXT(GLenum pname, GLdouble * params)                {if (GLeeInit()) glCullParameterdvEXT(pname, params);}
-void __stdcall _Lazy_glCullParameterfvEXT(GLenum pname, GLfloat * params)                 {if (GLeeInit()) glCullParameterfvEXT(pname, params);}
+void __stdcall _Lazy_glCullParameterdvEXT(GLenum pname, GLdouble * params)                {if (__GLeeLazyLink((void**)&pglCullParameterdvEXT, "glCullParameterdvEXT", &_GLEE_EXT_cull_vertex, "GL_EXT_cull_vertex")) glCullParameterdvEXT(pname, params);}
+void __stdcall _Lazy_glCullParameterfvEXT(GLenum pname, GLfloat * params)                 {if (__GLeeLazyLink((void**)&pglCullParameterfvEXT, "glCullParameterfvEXT", &_GLEE_EXT_cull_vertex, "GL_EXT_cull_vertex")) glCullParameterfvEXT(pname, params);}
 PFNGLCULLPARAMETERDVEXTPROC pglCullParameterdvEXT=_Lazy_glCullParameterdvEXT;
 PFNGLCULLPARAMETERFVEXTPROC pglCullParameterfvEXT=_Lazy_glCullParameterfvEXT;
 #endif 
@@ -2329,24 +2361,24 @@ PFNGLCULLPARAMETERFVEXTPROC pglCullParameterfvEXT=_Lazy_glCullParameterfvEXT;
 //GL_SGIX_fragment_lighting
 
 #ifdef __GLEE_GL_SGIX_fragment_lighting
-void __stdcall _Lazy_glFragmentColorMaterialSGIX(GLenum face, GLenum mode)                {if (GLeeInit()) glFragmentColorMaterialSGIX(face, mode);}
-void __stdcall _Lazy_glFragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)      {if (GLeeInit()) glFragmentLightfSGIX(light, pname, param);}
-void __stdcall _Lazy_glFragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glFragmentLightfvSGIX(light, pname, params);}
-void __stdcall _Lazy_glFragmentLightiSGIX(GLenum light, GLenum pname, GLint param)        {if (GLeeInit()) glFragmentLightiSGIX(light, pname, param);}
-void __stdcall _Lazy_glFragmentLightivSGIX(GLenum light, GLenum pname, const GLint * params)  {if (GLeeInit()) glFragmentLightivSGIX(light, pname, params);}
-void __stdcall _Lazy_glFragmentLightModelfSGIX(GLenum pname, GLfloat param)               {if (GLeeInit()) glFragmentLightModelfSGIX(pname, param);}
-void __stdcall _Lazy_glFragmentLightModelfvSGIX(GLenum pname, const GLfloat * params)     {if (GLeeInit()) glFragmentLightModelfvSGIX(pname, params);}
-void __stdcall _Lazy_glFragmentLightModeliSGIX(GLenum pname, GLint param)                 {if (GLeeInit()) glFragmentLightModeliSGIX(pname, param);}
-void __stdcall _Lazy_glFragmentLightModelivSGIX(GLenum pname, const GLint * params)       {if (GLeeInit()) glFragmentLightModelivSGIX(pname, params);}
-void __stdcall _Lazy_glFragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)    {if (GLeeInit()) glFragmentMaterialfSGIX(face, pname, param);}
-void __stdcall _Lazy_glFragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glFragmentMaterialfvSGIX(face, pname, params);}
-void __stdcall _Lazy_glFragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)      {if (GLeeInit()) glFragmentMaterialiSGIX(face, pname, param);}
-void __stdcall _Lazy_glFragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint * params)  {if (GLeeInit()) glFragmentMaterialivSGIX(face, pname, params);}
-void __stdcall _Lazy_glGetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetFragmentLightfvSGIX(light, pname, params);}
-void __stdcall _Lazy_glGetFragmentLightivSGIX(GLenum light, GLenum pname, GLint * params)  {if (GLeeInit()) glGetFragmentLightivSGIX(light, pname, params);}
-void __stdcall _Lazy_glGetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetFragmentMaterialfvSGIX(face, pname, params);}
-void __stdcall _Lazy_glGetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint * params)  {if (GLeeInit()) glGetFragmentMaterialivSGIX(face, pname, params);}
-void __stdcall _Lazy_glLightEnviSGIX(GLenum pname, GLint param)                           {if (GLeeInit()) glLightEnviSGIX(pname, param);}
+void __stdcall _Lazy_glFragmentColorMaterialSGIX(GLenum face, GLenum mode)                {if (__GLeeLazyLink((void**)&pglFragmentColorMaterialSGIX, "glFragmentColorMaterialSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentColorMaterialSGIX(face, mode);}
+void __stdcall _Lazy_glFragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)      {if (__GLeeLazyLink((void**)&pglFragmentLightfSGIX, "glFragmentLightfSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightfSGIX(light, pname, param);}
+void __stdcall _Lazy_glFragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglFragmentLightfvSGIX, "glFragmentLightfvSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightfvSGIX(light, pname, params);}
+void __stdcall _Lazy_glFragmentLightiSGIX(GLenum light, GLenum pname, GLint param)        {if (__GLeeLazyLink((void**)&pglFragmentLightiSGIX, "glFragmentLightiSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightiSGIX(light, pname, param);}
+void __stdcall _Lazy_glFragmentLightivSGIX(GLenum light, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglFragmentLightivSGIX, "glFragmentLightivSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightivSGIX(light, pname, params);}
+void __stdcall _Lazy_glFragmentLightModelfSGIX(GLenum pname, GLfloat param)               {if (__GLeeLazyLink((void**)&pglFragmentLightModelfSGIX, "glFragmentLightModelfSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightModelfSGIX(pname, param);}
+void __stdcall _Lazy_glFragmentLightModelfvSGIX(GLenum pname, const GLfloat * params)     {if (__GLeeLazyLink((void**)&pglFragmentLightModelfvSGIX, "glFragmentLightModelfvSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightModelfvSGIX(pname, params);}
+void __stdcall _Lazy_glFragmentLightModeliSGIX(GLenum pname, GLint param)                 {if (__GLeeLazyLink((void**)&pglFragmentLightModeliSGIX, "glFragmentLightModeliSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightModeliSGIX(pname, param);}
+void __stdcall _Lazy_glFragmentLightModelivSGIX(GLenum pname, const GLint * params)       {if (__GLeeLazyLink((void**)&pglFragmentLightModelivSGIX, "glFragmentLightModelivSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentLightModelivSGIX(pname, params);}
+void __stdcall _Lazy_glFragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)    {if (__GLeeLazyLink((void**)&pglFragmentMaterialfSGIX, "glFragmentMaterialfSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentMaterialfSGIX(face, pname, param);}
+void __stdcall _Lazy_glFragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialfvSGIX, "glFragmentMaterialfvSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentMaterialfvSGIX(face, pname, params);}
+void __stdcall _Lazy_glFragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)      {if (__GLeeLazyLink((void**)&pglFragmentMaterialiSGIX, "glFragmentMaterialiSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentMaterialiSGIX(face, pname, param);}
+void __stdcall _Lazy_glFragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialivSGIX, "glFragmentMaterialivSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glFragmentMaterialivSGIX(face, pname, params);}
+void __stdcall _Lazy_glGetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentLightfvSGIX, "glGetFragmentLightfvSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glGetFragmentLightfvSGIX(light, pname, params);}
+void __stdcall _Lazy_glGetFragmentLightivSGIX(GLenum light, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentLightivSGIX, "glGetFragmentLightivSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glGetFragmentLightivSGIX(light, pname, params);}
+void __stdcall _Lazy_glGetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentMaterialfvSGIX, "glGetFragmentMaterialfvSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glGetFragmentMaterialfvSGIX(face, pname, params);}
+void __stdcall _Lazy_glGetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentMaterialivSGIX, "glGetFragmentMaterialivSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glGetFragmentMaterialivSGIX(face, pname, params);}
+void __stdcall _Lazy_glLightEnviSGIX(GLenum pname, GLint param)                           {if (__GLeeLazyLink((void**)&pglLightEnviSGIX, "glLightEnviSGIX", &_GLEE_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting")) glLightEnviSGIX(pname, param);}
 PFNGLFRAGMENTCOLORMATERIALSGIXPROC pglFragmentColorMaterialSGIX=_Lazy_glFragmentColorMaterialSGIX;
 PFNGLFRAGMENTLIGHTFSGIXPROC pglFragmentLightfSGIX=_Lazy_glFragmentLightfSGIX;
 PFNGLFRAGMENTLIGHTFVSGIXPROC pglFragmentLightfvSGIX=_Lazy_glFragmentLightfvSGIX;
@@ -2380,7 +2412,7 @@ PFNGLLIGHTENVISGIXPROC pglLightEnviSGIX=_Lazy_glLightEnviSGIX;
 //GL_EXT_draw_range_elements
 
 #ifdef __GLEE_GL_EXT_draw_range_elements
-void __stdcall _Lazy_glDrawRangeElementsEXT(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)  {if (GLeeInit()) glDrawRangeElementsEXT(mode, start, end, count, type, indices);}
+void __stdcall _Lazy_glDrawRangeElementsEXT(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)  {if (__GLeeLazyLink((void**)&pglDrawRangeElementsEXT, "glDrawRangeElementsEXT", &_GLEE_EXT_draw_range_elements, "GL_EXT_draw_range_elements")) glDrawRangeElementsEXT(mode, start, end, count, type, indices);}
 PFNGLDRAWRANGEELEMENTSEXTPROC pglDrawRangeElementsEXT=_Lazy_glDrawRangeElementsEXT;
 #endif 
 
@@ -2397,9 +2429,9 @@ PFNGLDRAWRANGEELEMENTSEXTPROC pglDrawRangeElementsEXT=_Lazy_glDrawRangeElementsE
 //GL_EXT_light_texture
 
 #ifdef __GLEE_GL_EXT_light_texture
-void __stdcall _Lazy_glApplyTextureEXT(GLenum mode)                                       {if (GLeeInit()) glApplyTextureEXT(mode);}
-void __stdcall _Lazy_glTextureLightEXT(GLenum pname)                                      {if (GLeeInit()) glTextureLightEXT(pname);}
-void __stdcall _Lazy_glTextureMaterialEXT(GLenum face, GLenum mode)                       {if (GLeeInit()) glTextureMaterialEXT(face, mode);}
+void __stdcall _Lazy_glApplyTextureEXT(GLenum mode)                                       {if (__GLeeLazyLink((void**)&pglApplyTextureEXT, "glApplyTextureEXT", &_GLEE_EXT_light_texture, "GL_EXT_light_texture")) glApplyTextureEXT(mode);}
+void __stdcall _Lazy_glTextureLightEXT(GLenum pname)                                      {if (__GLeeLazyLink((void**)&pglTextureLightEXT, "glTextureLightEXT", &_GLEE_EXT_light_texture, "GL_EXT_light_texture")) glTextureLightEXT(pname);}
+void __stdcall _Lazy_glTextureMaterialEXT(GLenum face, GLenum mode)                       {if (__GLeeLazyLink((void**)&pglTextureMaterialEXT, "glTextureMaterialEXT", &_GLEE_EXT_light_texture, "GL_EXT_light_texture")) glTextureMaterialEXT(face, mode);}
 PFNGLAPPLYTEXTUREEXTPROC pglApplyTextureEXT=_Lazy_glApplyTextureEXT;
 PFNGLTEXTURELIGHTEXTPROC pglTextureLightEXT=_Lazy_glTextureLightEXT;
 PFNGLTEXTUREMATERIALEXTPROC pglTextureMaterialEXT=_Lazy_glTextureMaterialEXT;
@@ -2423,12 +2455,12 @@ PFNGLTEXTUREMATERIALEXTPROC pglTextureMaterialEXT=_Lazy_glTextureMaterialEXT;
 //GL_SGIX_async
 
 #ifdef __GLEE_GL_SGIX_async
-void __stdcall _Lazy_glAsyncMarkerSGIX(GLuint marker)                                     {if (GLeeInit()) glAsyncMarkerSGIX(marker);}
-GLint __stdcall _Lazy_glFinishAsyncSGIX(GLuint * markerp)                                 {if (GLeeInit()) return glFinishAsyncSGIX(markerp); return (GLint)0;}
-GLint __stdcall _Lazy_glPollAsyncSGIX(GLuint * markerp)                                   {if (GLeeInit()) return glPollAsyncSGIX(markerp); return (GLint)0;}
-GLuint __stdcall _Lazy_glGenAsyncMarkersSGIX(GLsizei range)                               {if (GLeeInit()) return glGenAsyncMarkersSGIX(range); return (GLuint)0;}
-void __stdcall _Lazy_glDeleteAsyncMarkersSGIX(GLuint marker, GLsizei range)               {if (GLeeInit()) glDeleteAsyncMarkersSGIX(marker, range);}
-GLboolean __stdcall _Lazy_glIsAsyncMarkerSGIX(GLuint marker)                              {if (GLeeInit()) return glIsAsyncMarkerSGIX(marker); return (GLboolean)0;}
+void __stdcall _Lazy_glAsyncMarkerSGIX(GLuint marker)                                     {if (__GLeeLazyLink((void**)&pglAsyncMarkerSGIX, "glAsyncMarkerSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) glAsyncMarkerSGIX(marker);}
+GLint __stdcall _Lazy_glFinishAsyncSGIX(GLuint * markerp)                                 {if (__GLeeLazyLink((void**)&pglFinishAsyncSGIX, "glFinishAsyncSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) return glFinishAsyncSGIX(markerp); return (GLint)0;}
+GLint __stdcall _Lazy_glPollAsyncSGIX(GLuint * markerp)                                   {if (__GLeeLazyLink((void**)&pglPollAsyncSGIX, "glPollAsyncSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) return glPollAsyncSGIX(markerp); return (GLint)0;}
+GLuint __stdcall _Lazy_glGenAsyncMarkersSGIX(GLsizei range)                               {if (__GLeeLazyLink((void**)&pglGenAsyncMarkersSGIX, "glGenAsyncMarkersSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) return glGenAsyncMarkersSGIX(range); return (GLuint)0;}
+void __stdcall _Lazy_glDeleteAsyncMarkersSGIX(GLuint marker, GLsizei range)               {if (__GLeeLazyLink((void**)&pglDeleteAsyncMarkersSGIX, "glDeleteAsyncMarkersSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) glDeleteAsyncMarkersSGIX(marker, range);}
+GLboolean __stdcall _Lazy_glIsAsyncMarkerSGIX(GLuint marker)                              {if (__GLeeLazyLink((void**)&pglIsAsyncMarkerSGIX, "glIsAsyncMarkerSGIX", &_GLEE_SGIX_async, "GL_SGIX_async")) return glIsAsyncMarkerSGIX(marker); return (GLboolean)0;}
 PFNGLASYNCMARKERSGIXPROC pglAsyncMarkerSGIX=_Lazy_glAsyncMarkerSGIX;
 PFNGLFINISHASYNCSGIXPROC pglFinishAsyncSGIX=_Lazy_glFinishAsyncSGIX;
 PFNGLPOLLASYNCSGIXPROC pglPollAsyncSGIX=_Lazy_glPollAsyncSGIX;
@@ -2455,10 +2487,10 @@ PFNGLISASYNCMARKERSGIXPROC pglIsAsyncMarkerSGIX=_Lazy_glIsAsyncMarkerSGIX;
 //GL_INTEL_parallel_arrays
 
 #ifdef __GLEE_GL_INTEL_parallel_arrays
-void __stdcall _Lazy_glVertexPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (GLeeInit()) glVertexPointervINTEL(size, type, pointer);}
-void __stdcall _Lazy_glNormalPointervINTEL(GLenum type, const GLvoid* * pointer)          {if (GLeeInit()) glNormalPointervINTEL(type, pointer);}
-void __stdcall _Lazy_glColorPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (GLeeInit()) glColorPointervINTEL(size, type, pointer);}
-void __stdcall _Lazy_glTexCoordPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (GLeeInit()) glTexCoordPointervINTEL(size, type, pointer);}
+void __stdcall _Lazy_glVertexPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglVertexPointervINTEL, "glVertexPointervINTEL", &_GLEE_INTEL_parallel_arrays, "GL_INTEL_parallel_arrays")) glVertexPointervINTEL(size, type, pointer);}
+void __stdcall _Lazy_glNormalPointervINTEL(GLenum type, const GLvoid* * pointer)          {if (__GLeeLazyLink((void**)&pglNormalPointervINTEL, "glNormalPointervINTEL", &_GLEE_INTEL_parallel_arrays, "GL_INTEL_parallel_arrays")) glNormalPointervINTEL(type, pointer);}
+void __stdcall _Lazy_glColorPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglColorPointervINTEL, "glColorPointervINTEL", &_GLEE_INTEL_parallel_arrays, "GL_INTEL_parallel_arrays")) glColorPointervINTEL(size, type, pointer);}
+void __stdcall _Lazy_glTexCoordPointervINTEL(GLint size, GLenum type, const GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglTexCoordPointervINTEL, "glTexCoordPointervINTEL", &_GLEE_INTEL_parallel_arrays, "GL_INTEL_parallel_arrays")) glTexCoordPointervINTEL(size, type, pointer);}
 PFNGLVERTEXPOINTERVINTELPROC pglVertexPointervINTEL=_Lazy_glVertexPointervINTEL;
 PFNGLNORMALPOINTERVINTELPROC pglNormalPointervINTEL=_Lazy_glNormalPointervINTEL;
 PFNGLCOLORPOINTERVINTELPROC pglColorPointervINTEL=_Lazy_glColorPointervINTEL;
@@ -2473,10 +2505,10 @@ PFNGLTEXCOORDPOINTERVINTELPROC pglTexCoordPointervINTEL=_Lazy_glTexCoordPointerv
 //GL_EXT_pixel_transform
 
 #ifdef __GLEE_GL_EXT_pixel_transform
-void __stdcall _Lazy_glPixelTransformParameteriEXT(GLenum target, GLenum pname, GLint param)  {if (GLeeInit()) glPixelTransformParameteriEXT(target, pname, param);}
-void __stdcall _Lazy_glPixelTransformParameterfEXT(GLenum target, GLenum pname, GLfloat param)  {if (GLeeInit()) glPixelTransformParameterfEXT(target, pname, param);}
-void __stdcall _Lazy_glPixelTransformParameterivEXT(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glPixelTransformParameterivEXT(target, pname, params);}
-void __stdcall _Lazy_glPixelTransformParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glPixelTransformParameterfvEXT(target, pname, params);}
+void __stdcall _Lazy_glPixelTransformParameteriEXT(GLenum target, GLenum pname, GLint param)  {if (__GLeeLazyLink((void**)&pglPixelTransformParameteriEXT, "glPixelTransformParameteriEXT", &_GLEE_EXT_pixel_transform, "GL_EXT_pixel_transform")) glPixelTransformParameteriEXT(target, pname, param);}
+void __stdcall _Lazy_glPixelTransformParameterfEXT(GLenum target, GLenum pname, GLfloat param)  {if (__GLeeLazyLink((void**)&pglPixelTransformParameterfEXT, "glPixelTransformParameterfEXT", &_GLEE_EXT_pixel_transform, "GL_EXT_pixel_transform")) glPixelTransformParameterfEXT(target, pname, param);}
+void __stdcall _Lazy_glPixelTransformParameterivEXT(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglPixelTransformParameterivEXT, "glPixelTransformParameterivEXT", &_GLEE_EXT_pixel_transform, "GL_EXT_pixel_transform")) glPixelTransformParameterivEXT(target, pname, params);}
+void __stdcall _Lazy_glPixelTransformParameterfvEXT(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglPixelTransformParameterfvEXT, "glPixelTransformParameterfvEXT", &_GLEE_EXT_pixel_transform, "GL_EXT_pixel_transform")) glPixelTransformParameterfvEXT(target, pname, params);}
 PFNGLPIXELTRANSFORMPARAMETERIEXTPROC pglPixelTransformParameteriEXT=_Lazy_glPixelTransformParameteriEXT;
 PFNGLPIXELTRANSFORMPARAMETERFEXTPROC pglPixelTransformParameterfEXT=_Lazy_glPixelTransformParameterfEXT;
 PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC pglPixelTransformParameterivEXT=_Lazy_glPixelTransformParameterivEXT;
@@ -2501,23 +2533,23 @@ PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC pglPixelTransformParameterfvEXT=_Lazy_glPi
 //GL_EXT_secondary_color
 
 #ifdef __GLEE_GL_EXT_secondary_color
-void __stdcall _Lazy_glSecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)         {if (GLeeInit()) glSecondaryColor3bEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3bvEXT(const GLbyte * v)                             {if (GLeeInit()) glSecondaryColor3bvEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)   {if (GLeeInit()) glSecondaryColor3dEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3dvEXT(const GLdouble * v)                           {if (GLeeInit()) glSecondaryColor3dvEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)      {if (GLeeInit()) glSecondaryColor3fEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3fvEXT(const GLfloat * v)                            {if (GLeeInit()) glSecondaryColor3fvEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3iEXT(GLint red, GLint green, GLint blue)            {if (GLeeInit()) glSecondaryColor3iEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3ivEXT(const GLint * v)                              {if (GLeeInit()) glSecondaryColor3ivEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)      {if (GLeeInit()) glSecondaryColor3sEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3svEXT(const GLshort * v)                            {if (GLeeInit()) glSecondaryColor3svEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)     {if (GLeeInit()) glSecondaryColor3ubEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3ubvEXT(const GLubyte * v)                           {if (GLeeInit()) glSecondaryColor3ubvEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)        {if (GLeeInit()) glSecondaryColor3uiEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3uivEXT(const GLuint * v)                            {if (GLeeInit()) glSecondaryColor3uivEXT(v);}
-void __stdcall _Lazy_glSecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)  {if (GLeeInit()) glSecondaryColor3usEXT(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3usvEXT(const GLushort * v)                          {if (GLeeInit()) glSecondaryColor3usvEXT(v);}
-void __stdcall _Lazy_glSecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glSecondaryColorPointerEXT(size, type, stride, pointer);}
+void __stdcall _Lazy_glSecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)         {if (__GLeeLazyLink((void**)&pglSecondaryColor3bEXT, "glSecondaryColor3bEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3bEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3bvEXT(const GLbyte * v)                             {if (__GLeeLazyLink((void**)&pglSecondaryColor3bvEXT, "glSecondaryColor3bvEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3bvEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)   {if (__GLeeLazyLink((void**)&pglSecondaryColor3dEXT, "glSecondaryColor3dEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3dEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3dvEXT(const GLdouble * v)                           {if (__GLeeLazyLink((void**)&pglSecondaryColor3dvEXT, "glSecondaryColor3dvEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3dvEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)      {if (__GLeeLazyLink((void**)&pglSecondaryColor3fEXT, "glSecondaryColor3fEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3fEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3fvEXT(const GLfloat * v)                            {if (__GLeeLazyLink((void**)&pglSecondaryColor3fvEXT, "glSecondaryColor3fvEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3fvEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3iEXT(GLint red, GLint green, GLint blue)            {if (__GLeeLazyLink((void**)&pglSecondaryColor3iEXT, "glSecondaryColor3iEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3iEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3ivEXT(const GLint * v)                              {if (__GLeeLazyLink((void**)&pglSecondaryColor3ivEXT, "glSecondaryColor3ivEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3ivEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)      {if (__GLeeLazyLink((void**)&pglSecondaryColor3sEXT, "glSecondaryColor3sEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3sEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3svEXT(const GLshort * v)                            {if (__GLeeLazyLink((void**)&pglSecondaryColor3svEXT, "glSecondaryColor3svEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3svEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)     {if (__GLeeLazyLink((void**)&pglSecondaryColor3ubEXT, "glSecondaryColor3ubEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3ubEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3ubvEXT(const GLubyte * v)                           {if (__GLeeLazyLink((void**)&pglSecondaryColor3ubvEXT, "glSecondaryColor3ubvEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3ubvEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)        {if (__GLeeLazyLink((void**)&pglSecondaryColor3uiEXT, "glSecondaryColor3uiEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3uiEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3uivEXT(const GLuint * v)                            {if (__GLeeLazyLink((void**)&pglSecondaryColor3uivEXT, "glSecondaryColor3uivEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3uivEXT(v);}
+void __stdcall _Lazy_glSecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)  {if (__GLeeLazyLink((void**)&pglSecondaryColor3usEXT, "glSecondaryColor3usEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3usEXT(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3usvEXT(const GLushort * v)                          {if (__GLeeLazyLink((void**)&pglSecondaryColor3usvEXT, "glSecondaryColor3usvEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColor3usvEXT(v);}
+void __stdcall _Lazy_glSecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglSecondaryColorPointerEXT, "glSecondaryColorPointerEXT", &_GLEE_EXT_secondary_color, "GL_EXT_secondary_color")) glSecondaryColorPointerEXT(size, type, stride, pointer);}
 PFNGLSECONDARYCOLOR3BEXTPROC pglSecondaryColor3bEXT=_Lazy_glSecondaryColor3bEXT;
 PFNGLSECONDARYCOLOR3BVEXTPROC pglSecondaryColor3bvEXT=_Lazy_glSecondaryColor3bvEXT;
 PFNGLSECONDARYCOLOR3DEXTPROC pglSecondaryColor3dEXT=_Lazy_glSecondaryColor3dEXT;
@@ -2540,15 +2572,15 @@ PFNGLSECONDARYCOLORPOINTEREXTPROC pglSecondaryColorPointerEXT=_Lazy_glSecondaryC
 //GL_EXT_texture_perturb_normal
 
 #ifdef __GLEE_GL_EXT_texture_perturb_normal
-void __stdcall _Lazy_glTextureNormalEXT(GLenum mode)                                      {if (GLeeInit()) glTextureNormalEXT(mode);}
+void __stdcall _Lazy_glTextureNormalEXT(GLenum mode)                                      {if (__GLeeLazyLink((void**)&pglTextureNormalEXT, "glTextureNormalEXT", &_GLEE_EXT_texture_perturb_normal, "GL_EXT_texture_perturb_normal")) glTextureNormalEXT(mode);}
 PFNGLTEXTURENORMALEXTPROC pglTextureNormalEXT=_Lazy_glTextureNormalEXT;
 #endif 
 
 //GL_EXT_multi_draw_arrays
 
 #ifdef __GLEE_GL_EXT_multi_draw_arrays
-void __stdcall _Lazy_glMultiDrawArraysEXT(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)  {if (GLeeInit()) glMultiDrawArraysEXT(mode, first, count, primcount);}
-void __stdcall _Lazy_glMultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const GLvoid* * indices, GLsizei primcount)  {if (GLeeInit()) glMultiDrawElementsEXT(mode, count, type, indices, primcount);}
+void __stdcall _Lazy_glMultiDrawArraysEXT(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawArraysEXT, "glMultiDrawArraysEXT", &_GLEE_EXT_multi_draw_arrays, "GL_EXT_multi_draw_arrays")) glMultiDrawArraysEXT(mode, first, count, primcount);}
+void __stdcall _Lazy_glMultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const GLvoid* * indices, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawElementsEXT, "glMultiDrawElementsEXT", &_GLEE_EXT_multi_draw_arrays, "GL_EXT_multi_draw_arrays")) glMultiDrawElementsEXT(mode, count, type, indices, primcount);}
 PFNGLMULTIDRAWARRAYSEXTPROC pglMultiDrawArraysEXT=_Lazy_glMultiDrawArraysEXT;
 PFNGLMULTIDRAWELEMENTSEXTPROC pglMultiDrawElementsEXT=_Lazy_glMultiDrawElementsEXT;
 #endif 
@@ -2556,11 +2588,11 @@ PFNGLMULTIDRAWELEMENTSEXTPROC pglMultiDrawElementsEXT=_Lazy_glMultiDrawElementsE
 //GL_EXT_fog_coord
 
 #ifdef __GLEE_GL_EXT_fog_coord
-void __stdcall _Lazy_glFogCoordfEXT(GLfloat coord)                                        {if (GLeeInit()) glFogCoordfEXT(coord);}
-void __stdcall _Lazy_glFogCoordfvEXT(const GLfloat * coord)                               {if (GLeeInit()) glFogCoordfvEXT(coord);}
-void __stdcall _Lazy_glFogCoorddEXT(GLdouble coord)                                       {if (GLeeInit()) glFogCoorddEXT(coord);}
-void __stdcall _Lazy_glFogCoorddvEXT(const GLdouble * coord)                              {if (GLeeInit()) glFogCoorddvEXT(coord);}
-void __stdcall _Lazy_glFogCoordPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glFogCoordPointerEXT(type, stride, pointer);}
+void __stdcall _Lazy_glFogCoordfEXT(GLfloat coord)                                        {if (__GLeeLazyLink((void**)&pglFogCoordfEXT, "glFogCoordfEXT", &_GLEE_EXT_fog_coord, "GL_EXT_fog_coord")) glFogCoordfEXT(coord);}
+void __stdcall _Lazy_glFogCoordfvEXT(const GLfloat * coord)                               {if (__GLeeLazyLink((void**)&pglFogCoordfvEXT, "glFogCoordfvEXT", &_GLEE_EXT_fog_coord, "GL_EXT_fog_coord")) glFogCoordfvEXT(coord);}
+void __stdcall _Lazy_glFogCoorddEXT(GLdouble coord)                                       {if (__GLeeLazyLink((void**)&pglFogCoorddEXT, "glFogCoorddEXT", &_GLEE_EXT_fog_coord, "GL_EXT_fog_coord")) glFogCoorddEXT(coord);}
+void __stdcall _Lazy_glFogCoorddvEXT(const GLdouble * coord)                              {if (__GLeeLazyLink((void**)&pglFogCoorddvEXT, "glFogCoorddvEXT", &_GLEE_EXT_fog_coord, "GL_EXT_fog_coord")) glFogCoorddvEXT(coord);}
+void __stdcall _Lazy_glFogCoordPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglFogCoordPointerEXT, "glFogCoordPointerEXT", &_GLEE_EXT_fog_coord, "GL_EXT_fog_coord")) glFogCoordPointerEXT(type, stride, pointer);}
 PFNGLFOGCOORDFEXTPROC pglFogCoordfEXT=_Lazy_glFogCoordfEXT;
 PFNGLFOGCOORDFVEXTPROC pglFogCoordfvEXT=_Lazy_glFogCoordfvEXT;
 PFNGLFOGCOORDDEXTPROC pglFogCoorddEXT=_Lazy_glFogCoorddEXT;
@@ -2576,28 +2608,28 @@ PFNGLFOGCOORDPOINTEREXTPROC pglFogCoordPointerEXT=_Lazy_glFogCoordPointerEXT;
 //GL_EXT_coordinate_frame
 
 #ifdef __GLEE_GL_EXT_coordinate_frame
-void __stdcall _Lazy_glTangent3bEXT(GLbyte tx, GLbyte ty, GLbyte tz)                      {if (GLeeInit()) glTangent3bEXT(tx, ty, tz);}
-void __stdcall _Lazy_glTangent3bvEXT(const GLbyte * v)                                    {if (GLeeInit()) glTangent3bvEXT(v);}
-void __stdcall _Lazy_glTangent3dEXT(GLdouble tx, GLdouble ty, GLdouble tz)                {if (GLeeInit()) glTangent3dEXT(tx, ty, tz);}
-void __stdcall _Lazy_glTangent3dvEXT(const GLdouble * v)                                  {if (GLeeInit()) glTangent3dvEXT(v);}
-void __stdcall _Lazy_glTangent3fEXT(GLfloat tx, GLfloat ty, GLfloat tz)                   {if (GLeeInit()) glTangent3fEXT(tx, ty, tz);}
-void __stdcall _Lazy_glTangent3fvEXT(const GLfloat * v)                                   {if (GLeeInit()) glTangent3fvEXT(v);}
-void __stdcall _Lazy_glTangent3iEXT(GLint tx, GLint ty, GLint tz)                         {if (GLeeInit()) glTangent3iEXT(tx, ty, tz);}
-void __stdcall _Lazy_glTangent3ivEXT(const GLint * v)                                     {if (GLeeInit()) glTangent3ivEXT(v);}
-void __stdcall _Lazy_glTangent3sEXT(GLshort tx, GLshort ty, GLshort tz)                   {if (GLeeInit()) glTangent3sEXT(tx, ty, tz);}
-void __stdcall _Lazy_glTangent3svEXT(const GLshort * v)                                   {if (GLeeInit()) glTangent3svEXT(v);}
-void __stdcall _Lazy_glBinormal3bEXT(GLbyte bx, GLbyte by, GLbyte bz)                     {if (GLeeInit()) glBinormal3bEXT(bx, by, bz);}
-void __stdcall _Lazy_glBinormal3bvEXT(const GLbyte * v)                                   {if (GLeeInit()) glBinormal3bvEXT(v);}
-void __stdcall _Lazy_glBinormal3dEXT(GLdouble bx, GLdouble by, GLdouble bz)               {if (GLeeInit()) glBinormal3dEXT(bx, by, bz);}
-void __stdcall _Lazy_glBinormal3dvEXT(const GLdouble * v)                                 {if (GLeeInit()) glBinormal3dvEXT(v);}
-void __stdcall _Lazy_glBinormal3fEXT(GLfloat bx, GLfloat by, GLfloat bz)                  {if (GLeeInit()) glBinormal3fEXT(bx, by, bz);}
-void __stdcall _Lazy_glBinormal3fvEXT(const GLfloat * v)                                  {if (GLeeInit()) glBinormal3fvEXT(v);}
-void __stdcall _Lazy_glBinormal3iEXT(GLint bx, GLint by, GLint bz)                        {if (GLeeInit()) glBinormal3iEXT(bx, by, bz);}
-void __stdcall _Lazy_glBinormal3ivEXT(const GLint * v)                                    {if (GLeeInit()) glBinormal3ivEXT(v);}
-void __stdcall _Lazy_glBinormal3sEXT(GLshort bx, GLshort by, GLshort bz)                  {if (GLeeInit()) glBinormal3sEXT(bx, by, bz);}
-void __stdcall _Lazy_glBinormal3svEXT(const GLshort * v)                                  {if (GLeeInit()) glBinormal3svEXT(v);}
-void __stdcall _Lazy_glTangentPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glTangentPointerEXT(type, stride, pointer);}
-void __stdcall _Lazy_glBinormalPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glBinormalPointerEXT(type, stride, pointer);}
+void __stdcall _Lazy_glTangent3bEXT(GLbyte tx, GLbyte ty, GLbyte tz)                      {if (__GLeeLazyLink((void**)&pglTangent3bEXT, "glTangent3bEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3bEXT(tx, ty, tz);}
+void __stdcall _Lazy_glTangent3bvEXT(const GLbyte * v)                                    {if (__GLeeLazyLink((void**)&pglTangent3bvEXT, "glTangent3bvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3bvEXT(v);}
+void __stdcall _Lazy_glTangent3dEXT(GLdouble tx, GLdouble ty, GLdouble tz)                {if (__GLeeLazyLink((void**)&pglTangent3dEXT, "glTangent3dEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3dEXT(tx, ty, tz);}
+void __stdcall _Lazy_glTangent3dvEXT(const GLdouble * v)                                  {if (__GLeeLazyLink((void**)&pglTangent3dvEXT, "glTangent3dvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3dvEXT(v);}
+void __stdcall _Lazy_glTangent3fEXT(GLfloat tx, GLfloat ty, GLfloat tz)                   {if (__GLeeLazyLink((void**)&pglTangent3fEXT, "glTangent3fEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3fEXT(tx, ty, tz);}
+void __stdcall _Lazy_glTangent3fvEXT(const GLfloat * v)                                   {if (__GLeeLazyLink((void**)&pglTangent3fvEXT, "glTangent3fvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3fvEXT(v);}
+void __stdcall _Lazy_glTangent3iEXT(GLint tx, GLint ty, GLint tz)                         {if (__GLeeLazyLink((void**)&pglTangent3iEXT, "glTangent3iEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3iEXT(tx, ty, tz);}
+void __stdcall _Lazy_glTangent3ivEXT(const GLint * v)                                     {if (__GLeeLazyLink((void**)&pglTangent3ivEXT, "glTangent3ivEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3ivEXT(v);}
+void __stdcall _Lazy_glTangent3sEXT(GLshort tx, GLshort ty, GLshort tz)                   {if (__GLeeLazyLink((void**)&pglTangent3sEXT, "glTangent3sEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3sEXT(tx, ty, tz);}
+void __stdcall _Lazy_glTangent3svEXT(const GLshort * v)                                   {if (__GLeeLazyLink((void**)&pglTangent3svEXT, "glTangent3svEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangent3svEXT(v);}
+void __stdcall _Lazy_glBinormal3bEXT(GLbyte bx, GLbyte by, GLbyte bz)                     {if (__GLeeLazyLink((void**)&pglBinormal3bEXT, "glBinormal3bEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3bEXT(bx, by, bz);}
+void __stdcall _Lazy_glBinormal3bvEXT(const GLbyte * v)                                   {if (__GLeeLazyLink((void**)&pglBinormal3bvEXT, "glBinormal3bvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3bvEXT(v);}
+void __stdcall _Lazy_glBinormal3dEXT(GLdouble bx, GLdouble by, GLdouble bz)               {if (__GLeeLazyLink((void**)&pglBinormal3dEXT, "glBinormal3dEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3dEXT(bx, by, bz);}
+void __stdcall _Lazy_glBinormal3dvEXT(const GLdouble * v)                                 {if (__GLeeLazyLink((void**)&pglBinormal3dvEXT, "glBinormal3dvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3dvEXT(v);}
+void __stdcall _Lazy_glBinormal3fEXT(GLfloat bx, GLfloat by, GLfloat bz)                  {if (__GLeeLazyLink((void**)&pglBinormal3fEXT, "glBinormal3fEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3fEXT(bx, by, bz);}
+void __stdcall _Lazy_glBinormal3fvEXT(const GLfloat * v)                                  {if (__GLeeLazyLink((void**)&pglBinormal3fvEXT, "glBinormal3fvEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3fvEXT(v);}
+void __stdcall _Lazy_glBinormal3iEXT(GLint bx, GLint by, GLint bz)                        {if (__GLeeLazyLink((void**)&pglBinormal3iEXT, "glBinormal3iEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3iEXT(bx, by, bz);}
+void __stdcall _Lazy_glBinormal3ivEXT(const GLint * v)                                    {if (__GLeeLazyLink((void**)&pglBinormal3ivEXT, "glBinormal3ivEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3ivEXT(v);}
+void __stdcall _Lazy_glBinormal3sEXT(GLshort bx, GLshort by, GLshort bz)                  {if (__GLeeLazyLink((void**)&pglBinormal3sEXT, "glBinormal3sEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3sEXT(bx, by, bz);}
+void __stdcall _Lazy_glBinormal3svEXT(const GLshort * v)                                  {if (__GLeeLazyLink((void**)&pglBinormal3svEXT, "glBinormal3svEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormal3svEXT(v);}
+void __stdcall _Lazy_glTangentPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglTangentPointerEXT, "glTangentPointerEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glTangentPointerEXT(type, stride, pointer);}
+void __stdcall _Lazy_glBinormalPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglBinormalPointerEXT, "glBinormalPointerEXT", &_GLEE_EXT_coordinate_frame, "GL_EXT_coordinate_frame")) glBinormalPointerEXT(type, stride, pointer);}
 PFNGLTANGENT3BEXTPROC pglTangent3bEXT=_Lazy_glTangent3bEXT;
 PFNGLTANGENT3BVEXTPROC pglTangent3bvEXT=_Lazy_glTangent3bvEXT;
 PFNGLTANGENT3DEXTPROC pglTangent3dEXT=_Lazy_glTangent3dEXT;
@@ -2645,21 +2677,21 @@ PFNGLBINORMALPOINTEREXTPROC pglBinormalPointerEXT=_Lazy_glBinormalPointerEXT;
 //GL_SUNX_constant_data
 
 #ifdef __GLEE_GL_SUNX_constant_data
-void __stdcall _Lazy_glFinishTextureSUNX(void)                                            {if (GLeeInit()) glFinishTextureSUNX();}
+void __stdcall _Lazy_glFinishTextureSUNX(void)                                            {if (__GLeeLazyLink((void**)&pglFinishTextureSUNX, "glFinishTextureSUNX", &_GLEE_SUNX_constant_data, "GL_SUNX_constant_data")) glFinishTextureSUNX();}
 PFNGLFINISHTEXTURESUNXPROC pglFinishTextureSUNX=_Lazy_glFinishTextureSUNX;
 #endif 
 
 //GL_SUN_global_alpha
 
 #ifdef __GLEE_GL_SUN_global_alpha
-void __stdcall _Lazy_glGlobalAlphaFactorbSUN(GLbyte factor)                               {if (GLeeInit()) glGlobalAlphaFactorbSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactorsSUN(GLshort factor)                              {if (GLeeInit()) glGlobalAlphaFactorsSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactoriSUN(GLint factor)                                {if (GLeeInit()) glGlobalAlphaFactoriSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactorfSUN(GLfloat factor)                              {if (GLeeInit()) glGlobalAlphaFactorfSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactordSUN(GLdouble factor)                             {if (GLeeInit()) glGlobalAlphaFactordSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactorubSUN(GLubyte factor)                             {if (GLeeInit()) glGlobalAlphaFactorubSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactorusSUN(GLushort factor)                            {if (GLeeInit()) glGlobalAlphaFactorusSUN(factor);}
-void __stdcall _Lazy_glGlobalAlphaFactoruiSUN(GLuint factor)                              {if (GLeeInit()) glGlobalAlphaFactoruiSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactorbSUN(GLbyte factor)                               {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactorbSUN, "glGlobalAlphaFactorbSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactorbSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactorsSUN(GLshort factor)                              {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactorsSUN, "glGlobalAlphaFactorsSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactorsSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactoriSUN(GLint factor)                                {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactoriSUN, "glGlobalAlphaFactoriSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactoriSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactorfSUN(GLfloat factor)                              {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactorfSUN, "glGlobalAlphaFactorfSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactorfSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactordSUN(GLdouble factor)                             {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactordSUN, "glGlobalAlphaFactordSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactordSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactorubSUN(GLubyte factor)                             {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactorubSUN, "glGlobalAlphaFactorubSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactorubSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactorusSUN(GLushort factor)                            {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactorusSUN, "glGlobalAlphaFactorusSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactorusSUN(factor);}
+void __stdcall _Lazy_glGlobalAlphaFactoruiSUN(GLuint factor)                              {if (__GLeeLazyLink((void**)&pglGlobalAlphaFactoruiSUN, "glGlobalAlphaFactoruiSUN", &_GLEE_SUN_global_alpha, "GL_SUN_global_alpha")) glGlobalAlphaFactoruiSUN(factor);}
 PFNGLGLOBALALPHAFACTORBSUNPROC pglGlobalAlphaFactorbSUN=_Lazy_glGlobalAlphaFactorbSUN;
 PFNGLGLOBALALPHAFACTORSSUNPROC pglGlobalAlphaFactorsSUN=_Lazy_glGlobalAlphaFactorsSUN;
 PFNGLGLOBALALPHAFACTORISUNPROC pglGlobalAlphaFactoriSUN=_Lazy_glGlobalAlphaFactoriSUN;
@@ -2673,13 +2705,13 @@ PFNGLGLOBALALPHAFACTORUISUNPROC pglGlobalAlphaFactoruiSUN=_Lazy_glGlobalAlphaFac
 //GL_SUN_triangle_list
 
 #ifdef __GLEE_GL_SUN_triangle_list
-void __stdcall _Lazy_glReplacementCodeuiSUN(GLuint code)                                  {if (GLeeInit()) glReplacementCodeuiSUN(code);}
-void __stdcall _Lazy_glReplacementCodeusSUN(GLushort code)                                {if (GLeeInit()) glReplacementCodeusSUN(code);}
-void __stdcall _Lazy_glReplacementCodeubSUN(GLubyte code)                                 {if (GLeeInit()) glReplacementCodeubSUN(code);}
-void __stdcall _Lazy_glReplacementCodeuivSUN(const GLuint * code)                         {if (GLeeInit()) glReplacementCodeuivSUN(code);}
-void __stdcall _Lazy_glReplacementCodeusvSUN(const GLushort * code)                       {if (GLeeInit()) glReplacementCodeusvSUN(code);}
-void __stdcall _Lazy_glReplacementCodeubvSUN(const GLubyte * code)                        {if (GLeeInit()) glReplacementCodeubvSUN(code);}
-void __stdcall _Lazy_glReplacementCodePointerSUN(GLenum type, GLsizei stride, const GLvoid* * pointer)  {if (GLeeInit()) glReplacementCodePointerSUN(type, stride, pointer);}
+void __stdcall _Lazy_glReplacementCodeuiSUN(GLuint code)                                  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiSUN, "glReplacementCodeuiSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeuiSUN(code);}
+void __stdcall _Lazy_glReplacementCodeusSUN(GLushort code)                                {if (__GLeeLazyLink((void**)&pglReplacementCodeusSUN, "glReplacementCodeusSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeusSUN(code);}
+void __stdcall _Lazy_glReplacementCodeubSUN(GLubyte code)                                 {if (__GLeeLazyLink((void**)&pglReplacementCodeubSUN, "glReplacementCodeubSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeubSUN(code);}
+void __stdcall _Lazy_glReplacementCodeuivSUN(const GLuint * code)                         {if (__GLeeLazyLink((void**)&pglReplacementCodeuivSUN, "glReplacementCodeuivSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeuivSUN(code);}
+void __stdcall _Lazy_glReplacementCodeusvSUN(const GLushort * code)                       {if (__GLeeLazyLink((void**)&pglReplacementCodeusvSUN, "glReplacementCodeusvSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeusvSUN(code);}
+void __stdcall _Lazy_glReplacementCodeubvSUN(const GLubyte * code)                        {if (__GLeeLazyLink((void**)&pglReplacementCodeubvSUN, "glReplacementCodeubvSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodeubvSUN(code);}
+void __stdcall _Lazy_glReplacementCodePointerSUN(GLenum type, GLsizei stride, const GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglReplacementCodePointerSUN, "glReplacementCodePointerSUN", &_GLEE_SUN_triangle_list, "GL_SUN_triangle_list")) glReplacementCodePointerSUN(type, stride, pointer);}
 PFNGLREPLACEMENTCODEUISUNPROC pglReplacementCodeuiSUN=_Lazy_glReplacementCodeuiSUN;
 PFNGLREPLACEMENTCODEUSSUNPROC pglReplacementCodeusSUN=_Lazy_glReplacementCodeusSUN;
 PFNGLREPLACEMENTCODEUBSUNPROC pglReplacementCodeubSUN=_Lazy_glReplacementCodeubSUN;
@@ -2692,46 +2724,46 @@ PFNGLREPLACEMENTCODEPOINTERSUNPROC pglReplacementCodePointerSUN=_Lazy_glReplacem
 //GL_SUN_vertex
 
 #ifdef __GLEE_GL_SUN_vertex
-void __stdcall _Lazy_glColor4ubVertex2fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y)  {if (GLeeInit()) glColor4ubVertex2fSUN(r, g, b, a, x, y);}
-void __stdcall _Lazy_glColor4ubVertex2fvSUN(const GLubyte * c, const GLfloat * v)         {if (GLeeInit()) glColor4ubVertex2fvSUN(c, v);}
-void __stdcall _Lazy_glColor4ubVertex3fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glColor4ubVertex3fSUN(r, g, b, a, x, y, z);}
-void __stdcall _Lazy_glColor4ubVertex3fvSUN(const GLubyte * c, const GLfloat * v)         {if (GLeeInit()) glColor4ubVertex3fvSUN(c, v);}
-void __stdcall _Lazy_glColor3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glColor3fVertex3fSUN(r, g, b, x, y, z);}
-void __stdcall _Lazy_glColor3fVertex3fvSUN(const GLfloat * c, const GLfloat * v)          {if (GLeeInit()) glColor3fVertex3fvSUN(c, v);}
-void __stdcall _Lazy_glNormal3fVertex3fSUN(GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glNormal3fVertex3fSUN(nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glNormal3fVertex3fvSUN(const GLfloat * n, const GLfloat * v)         {if (GLeeInit()) glNormal3fVertex3fvSUN(n, v);}
-void __stdcall _Lazy_glColor4fNormal3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glColor4fNormal3fVertex3fSUN(r, g, b, a, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glColor4fNormal3fVertex3fvSUN(const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glColor4fNormal3fVertex3fvSUN(c, n, v);}
-void __stdcall _Lazy_glTexCoord2fVertex3fSUN(GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glTexCoord2fVertex3fSUN(s, t, x, y, z);}
-void __stdcall _Lazy_glTexCoord2fVertex3fvSUN(const GLfloat * tc, const GLfloat * v)      {if (GLeeInit()) glTexCoord2fVertex3fvSUN(tc, v);}
-void __stdcall _Lazy_glTexCoord4fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glTexCoord4fVertex4fSUN(s, t, p, q, x, y, z, w);}
-void __stdcall _Lazy_glTexCoord4fVertex4fvSUN(const GLfloat * tc, const GLfloat * v)      {if (GLeeInit()) glTexCoord4fVertex4fvSUN(tc, v);}
-void __stdcall _Lazy_glTexCoord2fColor4ubVertex3fSUN(GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glTexCoord2fColor4ubVertex3fSUN(s, t, r, g, b, a, x, y, z);}
-void __stdcall _Lazy_glTexCoord2fColor4ubVertex3fvSUN(const GLfloat * tc, const GLubyte * c, const GLfloat * v)  {if (GLeeInit()) glTexCoord2fColor4ubVertex3fvSUN(tc, c, v);}
-void __stdcall _Lazy_glTexCoord2fColor3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glTexCoord2fColor3fVertex3fSUN(s, t, r, g, b, x, y, z);}
-void __stdcall _Lazy_glTexCoord2fColor3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * v)  {if (GLeeInit()) glTexCoord2fColor3fVertex3fvSUN(tc, c, v);}
-void __stdcall _Lazy_glTexCoord2fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glTexCoord2fNormal3fVertex3fSUN(s, t, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glTexCoord2fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glTexCoord2fNormal3fVertex3fvSUN(tc, n, v);}
-void __stdcall _Lazy_glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glTexCoord2fColor4fNormal3fVertex3fSUN(s, t, r, g, b, a, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glTexCoord2fColor4fNormal3fVertex3fvSUN(tc, c, n, v);}
-void __stdcall _Lazy_glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glTexCoord4fColor4fNormal3fVertex4fSUN(s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w);}
-void __stdcall _Lazy_glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glTexCoord4fColor4fNormal3fVertex4fvSUN(tc, c, n, v);}
-void __stdcall _Lazy_glReplacementCodeuiVertex3fSUN(GLuint rc, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiVertex3fSUN(rc, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiVertex3fvSUN(const GLuint * rc, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiVertex3fvSUN(rc, v);}
-void __stdcall _Lazy_glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiColor4ubVertex3fSUN(rc, r, g, b, a, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint * rc, const GLubyte * c, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiColor4ubVertex3fvSUN(rc, c, v);}
-void __stdcall _Lazy_glReplacementCodeuiColor3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiColor3fVertex3fSUN(rc, r, g, b, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiColor3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiColor3fVertex3fvSUN(rc, c, v);}
-void __stdcall _Lazy_glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiNormal3fVertex3fSUN(rc, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiNormal3fVertex3fvSUN(rc, n, v);}
-void __stdcall _Lazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc, r, g, b, a, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc, c, n, v);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fVertex3fSUN(rc, s, t, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fVertex3fvSUN(rc, tc, v);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc, s, t, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc, tc, n, v);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc, s, t, r, g, b, a, nx, ny, nz, x, y, z);}
-void __stdcall _Lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (GLeeInit()) glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc, tc, c, n, v);}
+void __stdcall _Lazy_glColor4ubVertex2fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y)  {if (__GLeeLazyLink((void**)&pglColor4ubVertex2fSUN, "glColor4ubVertex2fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4ubVertex2fSUN(r, g, b, a, x, y);}
+void __stdcall _Lazy_glColor4ubVertex2fvSUN(const GLubyte * c, const GLfloat * v)         {if (__GLeeLazyLink((void**)&pglColor4ubVertex2fvSUN, "glColor4ubVertex2fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4ubVertex2fvSUN(c, v);}
+void __stdcall _Lazy_glColor4ubVertex3fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglColor4ubVertex3fSUN, "glColor4ubVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4ubVertex3fSUN(r, g, b, a, x, y, z);}
+void __stdcall _Lazy_glColor4ubVertex3fvSUN(const GLubyte * c, const GLfloat * v)         {if (__GLeeLazyLink((void**)&pglColor4ubVertex3fvSUN, "glColor4ubVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4ubVertex3fvSUN(c, v);}
+void __stdcall _Lazy_glColor3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglColor3fVertex3fSUN, "glColor3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor3fVertex3fSUN(r, g, b, x, y, z);}
+void __stdcall _Lazy_glColor3fVertex3fvSUN(const GLfloat * c, const GLfloat * v)          {if (__GLeeLazyLink((void**)&pglColor3fVertex3fvSUN, "glColor3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor3fVertex3fvSUN(c, v);}
+void __stdcall _Lazy_glNormal3fVertex3fSUN(GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglNormal3fVertex3fSUN, "glNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glNormal3fVertex3fSUN(nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glNormal3fVertex3fvSUN(const GLfloat * n, const GLfloat * v)         {if (__GLeeLazyLink((void**)&pglNormal3fVertex3fvSUN, "glNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glNormal3fVertex3fvSUN(n, v);}
+void __stdcall _Lazy_glColor4fNormal3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglColor4fNormal3fVertex3fSUN, "glColor4fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4fNormal3fVertex3fSUN(r, g, b, a, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glColor4fNormal3fVertex3fvSUN(const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglColor4fNormal3fVertex3fvSUN, "glColor4fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glColor4fNormal3fVertex3fvSUN(c, n, v);}
+void __stdcall _Lazy_glTexCoord2fVertex3fSUN(GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglTexCoord2fVertex3fSUN, "glTexCoord2fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fVertex3fSUN(s, t, x, y, z);}
+void __stdcall _Lazy_glTexCoord2fVertex3fvSUN(const GLfloat * tc, const GLfloat * v)      {if (__GLeeLazyLink((void**)&pglTexCoord2fVertex3fvSUN, "glTexCoord2fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fVertex3fvSUN(tc, v);}
+void __stdcall _Lazy_glTexCoord4fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglTexCoord4fVertex4fSUN, "glTexCoord4fVertex4fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord4fVertex4fSUN(s, t, p, q, x, y, z, w);}
+void __stdcall _Lazy_glTexCoord4fVertex4fvSUN(const GLfloat * tc, const GLfloat * v)      {if (__GLeeLazyLink((void**)&pglTexCoord4fVertex4fvSUN, "glTexCoord4fVertex4fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord4fVertex4fvSUN(tc, v);}
+void __stdcall _Lazy_glTexCoord2fColor4ubVertex3fSUN(GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor4ubVertex3fSUN, "glTexCoord2fColor4ubVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor4ubVertex3fSUN(s, t, r, g, b, a, x, y, z);}
+void __stdcall _Lazy_glTexCoord2fColor4ubVertex3fvSUN(const GLfloat * tc, const GLubyte * c, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor4ubVertex3fvSUN, "glTexCoord2fColor4ubVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor4ubVertex3fvSUN(tc, c, v);}
+void __stdcall _Lazy_glTexCoord2fColor3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor3fVertex3fSUN, "glTexCoord2fColor3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor3fVertex3fSUN(s, t, r, g, b, x, y, z);}
+void __stdcall _Lazy_glTexCoord2fColor3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor3fVertex3fvSUN, "glTexCoord2fColor3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor3fVertex3fvSUN(tc, c, v);}
+void __stdcall _Lazy_glTexCoord2fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglTexCoord2fNormal3fVertex3fSUN, "glTexCoord2fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fNormal3fVertex3fSUN(s, t, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glTexCoord2fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglTexCoord2fNormal3fVertex3fvSUN, "glTexCoord2fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fNormal3fVertex3fvSUN(tc, n, v);}
+void __stdcall _Lazy_glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor4fNormal3fVertex3fSUN, "glTexCoord2fColor4fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor4fNormal3fVertex3fSUN(s, t, r, g, b, a, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglTexCoord2fColor4fNormal3fVertex3fvSUN, "glTexCoord2fColor4fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord2fColor4fNormal3fVertex3fvSUN(tc, c, n, v);}
+void __stdcall _Lazy_glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglTexCoord4fColor4fNormal3fVertex4fSUN, "glTexCoord4fColor4fNormal3fVertex4fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord4fColor4fNormal3fVertex4fSUN(s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w);}
+void __stdcall _Lazy_glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglTexCoord4fColor4fNormal3fVertex4fvSUN, "glTexCoord4fColor4fNormal3fVertex4fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glTexCoord4fColor4fNormal3fVertex4fvSUN(tc, c, n, v);}
+void __stdcall _Lazy_glReplacementCodeuiVertex3fSUN(GLuint rc, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiVertex3fSUN, "glReplacementCodeuiVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiVertex3fSUN(rc, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiVertex3fvSUN(const GLuint * rc, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiVertex3fvSUN, "glReplacementCodeuiVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiVertex3fvSUN(rc, v);}
+void __stdcall _Lazy_glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor4ubVertex3fSUN, "glReplacementCodeuiColor4ubVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor4ubVertex3fSUN(rc, r, g, b, a, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint * rc, const GLubyte * c, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor4ubVertex3fvSUN, "glReplacementCodeuiColor4ubVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor4ubVertex3fvSUN(rc, c, v);}
+void __stdcall _Lazy_glReplacementCodeuiColor3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor3fVertex3fSUN, "glReplacementCodeuiColor3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor3fVertex3fSUN(rc, r, g, b, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiColor3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor3fVertex3fvSUN, "glReplacementCodeuiColor3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor3fVertex3fvSUN(rc, c, v);}
+void __stdcall _Lazy_glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiNormal3fVertex3fSUN, "glReplacementCodeuiNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiNormal3fVertex3fSUN(rc, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiNormal3fVertex3fvSUN, "glReplacementCodeuiNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiNormal3fVertex3fvSUN(rc, n, v);}
+void __stdcall _Lazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor4fNormal3fVertex3fSUN, "glReplacementCodeuiColor4fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc, r, g, b, a, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiColor4fNormal3fVertex3fvSUN, "glReplacementCodeuiColor4fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc, c, n, v);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fVertex3fSUN, "glReplacementCodeuiTexCoord2fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fVertex3fSUN(rc, s, t, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fVertex3fvSUN, "glReplacementCodeuiTexCoord2fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fVertex3fvSUN(rc, tc, v);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc, s, t, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN, "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc, tc, n, v);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc, s, t, r, g, b, a, nx, ny, nz, x, y, z);}
+void __stdcall _Lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint * rc, const GLfloat * tc, const GLfloat * c, const GLfloat * n, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN, "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN", &_GLEE_SUN_vertex, "GL_SUN_vertex")) glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc, tc, c, n, v);}
 PFNGLCOLOR4UBVERTEX2FSUNPROC pglColor4ubVertex2fSUN=_Lazy_glColor4ubVertex2fSUN;
 PFNGLCOLOR4UBVERTEX2FVSUNPROC pglColor4ubVertex2fvSUN=_Lazy_glColor4ubVertex2fvSUN;
 PFNGLCOLOR4UBVERTEX3FSUNPROC pglColor4ubVertex3fSUN=_Lazy_glColor4ubVertex3fSUN;
@@ -2777,7 +2809,7 @@ PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC pglReplacementCo
 //GL_EXT_blend_func_separate
 
 #ifdef __GLEE_GL_EXT_blend_func_separate
-void __stdcall _Lazy_glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (GLeeInit()) glBlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
+void __stdcall _Lazy_glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (__GLeeLazyLink((void**)&pglBlendFuncSeparateEXT, "glBlendFuncSeparateEXT", &_GLEE_EXT_blend_func_separate, "GL_EXT_blend_func_separate")) glBlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
 PFNGLBLENDFUNCSEPARATEEXTPROC pglBlendFuncSeparateEXT=_Lazy_glBlendFuncSeparateEXT;
 #endif 
 
@@ -2834,9 +2866,9 @@ PFNGLBLENDFUNCSEPARATEEXTPROC pglBlendFuncSeparateEXT=_Lazy_glBlendFuncSeparateE
 //GL_EXT_vertex_weighting
 
 #ifdef __GLEE_GL_EXT_vertex_weighting
-void __stdcall _Lazy_glVertexWeightfEXT(GLfloat weight)                                   {if (GLeeInit()) glVertexWeightfEXT(weight);}
-void __stdcall _Lazy_glVertexWeightfvEXT(const GLfloat * weight)                          {if (GLeeInit()) glVertexWeightfvEXT(weight);}
-void __stdcall _Lazy_glVertexWeightPointerEXT(GLsizei size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glVertexWeightPointerEXT(size, type, stride, pointer);}
+void __stdcall _Lazy_glVertexWeightfEXT(GLfloat weight)                                   {if (__GLeeLazyLink((void**)&pglVertexWeightfEXT, "glVertexWeightfEXT", &_GLEE_EXT_vertex_weighting, "GL_EXT_vertex_weighting")) glVertexWeightfEXT(weight);}
+void __stdcall _Lazy_glVertexWeightfvEXT(const GLfloat * weight)                          {if (__GLeeLazyLink((void**)&pglVertexWeightfvEXT, "glVertexWeightfvEXT", &_GLEE_EXT_vertex_weighting, "GL_EXT_vertex_weighting")) glVertexWeightfvEXT(weight);}
+void __stdcall _Lazy_glVertexWeightPointerEXT(GLsizei size, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglVertexWeightPointerEXT, "glVertexWeightPointerEXT", &_GLEE_EXT_vertex_weighting, "GL_EXT_vertex_weighting")) glVertexWeightPointerEXT(size, type, stride, pointer);}
 PFNGLVERTEXWEIGHTFEXTPROC pglVertexWeightfEXT=_Lazy_glVertexWeightfEXT;
 PFNGLVERTEXWEIGHTFVEXTPROC pglVertexWeightfvEXT=_Lazy_glVertexWeightfvEXT;
 PFNGLVERTEXWEIGHTPOINTEREXTPROC pglVertexWeightPointerEXT=_Lazy_glVertexWeightPointerEXT;
@@ -2850,8 +2882,8 @@ PFNGLVERTEXWEIGHTPOINTEREXTPROC pglVertexWeightPointerEXT=_Lazy_glVertexWeightPo
 //GL_NV_vertex_array_range
 
 #ifdef __GLEE_GL_NV_vertex_array_range
-void __stdcall _Lazy_glFlushVertexArrayRangeNV(void)                                      {if (GLeeInit()) glFlushVertexArrayRangeNV();}
-void __stdcall _Lazy_glVertexArrayRangeNV(GLsizei length, const GLvoid * pointer)         {if (GLeeInit()) glVertexArrayRangeNV(length, pointer);}
+void __stdcall _Lazy_glFlushVertexArrayRangeNV(void)                                      {if (__GLeeLazyLink((void**)&pglFlushVertexArrayRangeNV, "glFlushVertexArrayRangeNV", &_GLEE_NV_vertex_array_range, "GL_NV_vertex_array_range")) glFlushVertexArrayRangeNV();}
+void __stdcall _Lazy_glVertexArrayRangeNV(GLsizei length, const GLvoid * pointer)         {if (__GLeeLazyLink((void**)&pglVertexArrayRangeNV, "glVertexArrayRangeNV", &_GLEE_NV_vertex_array_range, "GL_NV_vertex_array_range")) glVertexArrayRangeNV(length, pointer);}
 PFNGLFLUSHVERTEXARRAYRANGENVPROC pglFlushVertexArrayRangeNV=_Lazy_glFlushVertexArrayRangeNV;
 PFNGLVERTEXARRAYRANGENVPROC pglVertexArrayRangeNV=_Lazy_glVertexArrayRangeNV;
 #endif 
@@ -2859,19 +2891,19 @@ PFNGLVERTEXARRAYRANGENVPROC pglVertexArrayRangeNV=_Lazy_glVertexArrayRangeNV;
 //GL_NV_register_combiners
 
 #ifdef __GLEE_GL_NV_register_combiners
-void __stdcall _Lazy_glCombinerParameterfvNV(GLenum pname, const GLfloat * params)        {if (GLeeInit()) glCombinerParameterfvNV(pname, params);}
-void __stdcall _Lazy_glCombinerParameterfNV(GLenum pname, GLfloat param)                  {if (GLeeInit()) glCombinerParameterfNV(pname, param);}
-void __stdcall _Lazy_glCombinerParameterivNV(GLenum pname, const GLint * params)          {if (GLeeInit()) glCombinerParameterivNV(pname, params);}
-void __stdcall _Lazy_glCombinerParameteriNV(GLenum pname, GLint param)                    {if (GLeeInit()) glCombinerParameteriNV(pname, param);}
-void __stdcall _Lazy_glCombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)  {if (GLeeInit()) glCombinerInputNV(stage, portion, variable, input, mapping, componentUsage);}
-void __stdcall _Lazy_glCombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)  {if (GLeeInit()) glCombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);}
-void __stdcall _Lazy_glFinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)  {if (GLeeInit()) glFinalCombinerInputNV(variable, input, mapping, componentUsage);}
-void __stdcall _Lazy_glGetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetCombinerInputParameterfvNV(stage, portion, variable, pname, params);}
-void __stdcall _Lazy_glGetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint * params)  {if (GLeeInit()) glGetCombinerInputParameterivNV(stage, portion, variable, pname, params);}
-void __stdcall _Lazy_glGetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetCombinerOutputParameterfvNV(stage, portion, pname, params);}
-void __stdcall _Lazy_glGetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint * params)  {if (GLeeInit()) glGetCombinerOutputParameterivNV(stage, portion, pname, params);}
-void __stdcall _Lazy_glGetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetFinalCombinerInputParameterfvNV(variable, pname, params);}
-void __stdcall _Lazy_glGetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint * params)  {if (GLeeInit()) glGetFinalCombinerInputParameterivNV(variable, pname, params);}
+void __stdcall _Lazy_glCombinerParameterfvNV(GLenum pname, const GLfloat * params)        {if (__GLeeLazyLink((void**)&pglCombinerParameterfvNV, "glCombinerParameterfvNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerParameterfvNV(pname, params);}
+void __stdcall _Lazy_glCombinerParameterfNV(GLenum pname, GLfloat param)                  {if (__GLeeLazyLink((void**)&pglCombinerParameterfNV, "glCombinerParameterfNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerParameterfNV(pname, param);}
+void __stdcall _Lazy_glCombinerParameterivNV(GLenum pname, const GLint * params)          {if (__GLeeLazyLink((void**)&pglCombinerParameterivNV, "glCombinerParameterivNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerParameterivNV(pname, params);}
+void __stdcall _Lazy_glCombinerParameteriNV(GLenum pname, GLint param)                    {if (__GLeeLazyLink((void**)&pglCombinerParameteriNV, "glCombinerParameteriNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerParameteriNV(pname, param);}
+void __stdcall _Lazy_glCombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)  {if (__GLeeLazyLink((void**)&pglCombinerInputNV, "glCombinerInputNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerInputNV(stage, portion, variable, input, mapping, componentUsage);}
+void __stdcall _Lazy_glCombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)  {if (__GLeeLazyLink((void**)&pglCombinerOutputNV, "glCombinerOutputNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glCombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);}
+void __stdcall _Lazy_glFinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)  {if (__GLeeLazyLink((void**)&pglFinalCombinerInputNV, "glFinalCombinerInputNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glFinalCombinerInputNV(variable, input, mapping, componentUsage);}
+void __stdcall _Lazy_glGetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetCombinerInputParameterfvNV, "glGetCombinerInputParameterfvNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetCombinerInputParameterfvNV(stage, portion, variable, pname, params);}
+void __stdcall _Lazy_glGetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetCombinerInputParameterivNV, "glGetCombinerInputParameterivNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetCombinerInputParameterivNV(stage, portion, variable, pname, params);}
+void __stdcall _Lazy_glGetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetCombinerOutputParameterfvNV, "glGetCombinerOutputParameterfvNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetCombinerOutputParameterfvNV(stage, portion, pname, params);}
+void __stdcall _Lazy_glGetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetCombinerOutputParameterivNV, "glGetCombinerOutputParameterivNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetCombinerOutputParameterivNV(stage, portion, pname, params);}
+void __stdcall _Lazy_glGetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetFinalCombinerInputParameterfvNV, "glGetFinalCombinerInputParameterfvNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetFinalCombinerInputParameterfvNV(variable, pname, params);}
+void __stdcall _Lazy_glGetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFinalCombinerInputParameterivNV, "glGetFinalCombinerInputParameterivNV", &_GLEE_NV_register_combiners, "GL_NV_register_combiners")) glGetFinalCombinerInputParameterivNV(variable, pname, params);}
 PFNGLCOMBINERPARAMETERFVNVPROC pglCombinerParameterfvNV=_Lazy_glCombinerParameterfvNV;
 PFNGLCOMBINERPARAMETERFNVPROC pglCombinerParameterfNV=_Lazy_glCombinerParameterfNV;
 PFNGLCOMBINERPARAMETERIVNVPROC pglCombinerParameterivNV=_Lazy_glCombinerParameterivNV;
@@ -2910,37 +2942,37 @@ PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC pglGetFinalCombinerInputParameterivN
 //GL_MESA_resize_buffers
 
 #ifdef __GLEE_GL_MESA_resize_buffers
-void __stdcall _Lazy_glResizeBuffersMESA(void)                                            {if (GLeeInit()) glResizeBuffersMESA();}
+void __stdcall _Lazy_glResizeBuffersMESA(void)                                            {if (__GLeeLazyLink((void**)&pglResizeBuffersMESA, "glResizeBuffersMESA", &_GLEE_MESA_resize_buffers, "GL_MESA_resize_buffers")) glResizeBuffersMESA();}
 PFNGLRESIZEBUFFERSMESAPROC pglResizeBuffersMESA=_Lazy_glResizeBuffersMESA;
 #endif 
 
 //GL_MESA_window_pos
 
 #ifdef __GLEE_GL_MESA_window_pos
-void __stdcall _Lazy_glWindowPos2dMESA(GLdouble x, GLdouble y)                            {if (GLeeInit()) glWindowPos2dMESA(x, y);}
-void __stdcall _Lazy_glWindowPos2dvMESA(const GLdouble * v)                               {if (GLeeInit()) glWindowPos2dvMESA(v);}
-void __stdcall _Lazy_glWindowPos2fMESA(GLfloat x, GLfloat y)                              {if (GLeeInit()) glWindowPos2fMESA(x, y);}
-void __stdcall _Lazy_glWindowPos2fvMESA(const GLfloat * v)                                {if (GLeeInit()) glWindowPos2fvMESA(v);}
-void __stdcall _Lazy_glWindowPos2iMESA(GLint x, GLint y)                                  {if (GLeeInit()) glWindowPos2iMESA(x, y);}
-void __stdcall _Lazy_glWindowPos2ivMESA(const GLint * v)                                  {if (GLeeInit()) glWindowPos2ivMESA(v);}
-void __stdcall _Lazy_glWindowPos2sMESA(GLshort x, GLshort y)                              {if (GLeeInit()) glWindowPos2sMESA(x, y);}
-void __stdcall _Lazy_glWindowPos2svMESA(const GLshort * v)                                {if (GLeeInit()) glWindowPos2svMESA(v);}
-void __stdcall _Lazy_glWindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)                {if (GLeeInit()) glWindowPos3dMESA(x, y, z);}
-void __stdcall _Lazy_glWindowPos3dvMESA(const GLdouble * v)                               {if (GLeeInit()) glWindowPos3dvMESA(v);}
-void __stdcall _Lazy_glWindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)                   {if (GLeeInit()) glWindowPos3fMESA(x, y, z);}
-void __stdcall _Lazy_glWindowPos3fvMESA(const GLfloat * v)                                {if (GLeeInit()) glWindowPos3fvMESA(v);}
-void __stdcall _Lazy_glWindowPos3iMESA(GLint x, GLint y, GLint z)                         {if (GLeeInit()) glWindowPos3iMESA(x, y, z);}
-void __stdcall _Lazy_glWindowPos3ivMESA(const GLint * v)                                  {if (GLeeInit()) glWindowPos3ivMESA(v);}
-void __stdcall _Lazy_glWindowPos3sMESA(GLshort x, GLshort y, GLshort z)                   {if (GLeeInit()) glWindowPos3sMESA(x, y, z);}
-void __stdcall _Lazy_glWindowPos3svMESA(const GLshort * v)                                {if (GLeeInit()) glWindowPos3svMESA(v);}
-void __stdcall _Lazy_glWindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)    {if (GLeeInit()) glWindowPos4dMESA(x, y, z, w);}
-void __stdcall _Lazy_glWindowPos4dvMESA(const GLdouble * v)                               {if (GLeeInit()) glWindowPos4dvMESA(v);}
-void __stdcall _Lazy_glWindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)        {if (GLeeInit()) glWindowPos4fMESA(x, y, z, w);}
-void __stdcall _Lazy_glWindowPos4fvMESA(const GLfloat * v)                                {if (GLeeInit()) glWindowPos4fvMESA(v);}
-void __stdcall _Lazy_glWindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)                {if (GLeeInit()) glWindowPos4iMESA(x, y, z, w);}
-void __stdcall _Lazy_glWindowPos4ivMESA(const GLint * v)                                  {if (GLeeInit()) glWindowPos4ivMESA(v);}
-void __stdcall _Lazy_glWindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)        {if (GLeeInit()) glWindowPos4sMESA(x, y, z, w);}
-void __stdcall _Lazy_glWindowPos4svMESA(const GLshort * v)                                {if (GLeeInit()) glWindowPos4svMESA(v);}
+void __stdcall _Lazy_glWindowPos2dMESA(GLdouble x, GLdouble y)                            {if (__GLeeLazyLink((void**)&pglWindowPos2dMESA, "glWindowPos2dMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2dMESA(x, y);}
+void __stdcall _Lazy_glWindowPos2dvMESA(const GLdouble * v)                               {if (__GLeeLazyLink((void**)&pglWindowPos2dvMESA, "glWindowPos2dvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2dvMESA(v);}
+void __stdcall _Lazy_glWindowPos2fMESA(GLfloat x, GLfloat y)                              {if (__GLeeLazyLink((void**)&pglWindowPos2fMESA, "glWindowPos2fMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2fMESA(x, y);}
+void __stdcall _Lazy_glWindowPos2fvMESA(const GLfloat * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos2fvMESA, "glWindowPos2fvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2fvMESA(v);}
+void __stdcall _Lazy_glWindowPos2iMESA(GLint x, GLint y)                                  {if (__GLeeLazyLink((void**)&pglWindowPos2iMESA, "glWindowPos2iMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2iMESA(x, y);}
+void __stdcall _Lazy_glWindowPos2ivMESA(const GLint * v)                                  {if (__GLeeLazyLink((void**)&pglWindowPos2ivMESA, "glWindowPos2ivMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2ivMESA(v);}
+void __stdcall _Lazy_glWindowPos2sMESA(GLshort x, GLshort y)                              {if (__GLeeLazyLink((void**)&pglWindowPos2sMESA, "glWindowPos2sMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2sMESA(x, y);}
+void __stdcall _Lazy_glWindowPos2svMESA(const GLshort * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos2svMESA, "glWindowPos2svMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos2svMESA(v);}
+void __stdcall _Lazy_glWindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)                {if (__GLeeLazyLink((void**)&pglWindowPos3dMESA, "glWindowPos3dMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3dMESA(x, y, z);}
+void __stdcall _Lazy_glWindowPos3dvMESA(const GLdouble * v)                               {if (__GLeeLazyLink((void**)&pglWindowPos3dvMESA, "glWindowPos3dvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3dvMESA(v);}
+void __stdcall _Lazy_glWindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)                   {if (__GLeeLazyLink((void**)&pglWindowPos3fMESA, "glWindowPos3fMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3fMESA(x, y, z);}
+void __stdcall _Lazy_glWindowPos3fvMESA(const GLfloat * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos3fvMESA, "glWindowPos3fvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3fvMESA(v);}
+void __stdcall _Lazy_glWindowPos3iMESA(GLint x, GLint y, GLint z)                         {if (__GLeeLazyLink((void**)&pglWindowPos3iMESA, "glWindowPos3iMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3iMESA(x, y, z);}
+void __stdcall _Lazy_glWindowPos3ivMESA(const GLint * v)                                  {if (__GLeeLazyLink((void**)&pglWindowPos3ivMESA, "glWindowPos3ivMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3ivMESA(v);}
+void __stdcall _Lazy_glWindowPos3sMESA(GLshort x, GLshort y, GLshort z)                   {if (__GLeeLazyLink((void**)&pglWindowPos3sMESA, "glWindowPos3sMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3sMESA(x, y, z);}
+void __stdcall _Lazy_glWindowPos3svMESA(const GLshort * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos3svMESA, "glWindowPos3svMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos3svMESA(v);}
+void __stdcall _Lazy_glWindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)    {if (__GLeeLazyLink((void**)&pglWindowPos4dMESA, "glWindowPos4dMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4dMESA(x, y, z, w);}
+void __stdcall _Lazy_glWindowPos4dvMESA(const GLdouble * v)                               {if (__GLeeLazyLink((void**)&pglWindowPos4dvMESA, "glWindowPos4dvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4dvMESA(v);}
+void __stdcall _Lazy_glWindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)        {if (__GLeeLazyLink((void**)&pglWindowPos4fMESA, "glWindowPos4fMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4fMESA(x, y, z, w);}
+void __stdcall _Lazy_glWindowPos4fvMESA(const GLfloat * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos4fvMESA, "glWindowPos4fvMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4fvMESA(v);}
+void __stdcall _Lazy_glWindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)                {if (__GLeeLazyLink((void**)&pglWindowPos4iMESA, "glWindowPos4iMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4iMESA(x, y, z, w);}
+void __stdcall _Lazy_glWindowPos4ivMESA(const GLint * v)                                  {if (__GLeeLazyLink((void**)&pglWindowPos4ivMESA, "glWindowPos4ivMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4ivMESA(v);}
+void __stdcall _Lazy_glWindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)        {if (__GLeeLazyLink((void**)&pglWindowPos4sMESA, "glWindowPos4sMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4sMESA(x, y, z, w);}
+void __stdcall _Lazy_glWindowPos4svMESA(const GLshort * v)                                {if (__GLeeLazyLink((void**)&pglWindowPos4svMESA, "glWindowPos4svMESA", &_GLEE_MESA_window_pos, "GL_MESA_window_pos")) glWindowPos4svMESA(v);}
 PFNGLWINDOWPOS2DMESAPROC pglWindowPos2dMESA=_Lazy_glWindowPos2dMESA;
 PFNGLWINDOWPOS2DVMESAPROC pglWindowPos2dvMESA=_Lazy_glWindowPos2dvMESA;
 PFNGLWINDOWPOS2FMESAPROC pglWindowPos2fMESA=_Lazy_glWindowPos2fMESA;
@@ -2980,8 +3012,8 @@ PFNGLWINDOWPOS4SVMESAPROC pglWindowPos4svMESA=_Lazy_glWindowPos4svMESA;
 //GL_IBM_multimode_draw_arrays
 
 #ifdef __GLEE_GL_IBM_multimode_draw_arrays
-void __stdcall _Lazy_glMultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)  {if (GLeeInit()) glMultiModeDrawArraysIBM(mode, first, count, primcount, modestride);}
-void __stdcall _Lazy_glMultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid* const * indices, GLsizei primcount, GLint modestride)  {if (GLeeInit()) glMultiModeDrawElementsIBM(mode, count, type, indices, primcount, modestride);}
+void __stdcall _Lazy_glMultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)  {if (__GLeeLazyLink((void**)&pglMultiModeDrawArraysIBM, "glMultiModeDrawArraysIBM", &_GLEE_IBM_multimode_draw_arrays, "GL_IBM_multimode_draw_arrays")) glMultiModeDrawArraysIBM(mode, first, count, primcount, modestride);}
+void __stdcall _Lazy_glMultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid* const * indices, GLsizei primcount, GLint modestride)  {if (__GLeeLazyLink((void**)&pglMultiModeDrawElementsIBM, "glMultiModeDrawElementsIBM", &_GLEE_IBM_multimode_draw_arrays, "GL_IBM_multimode_draw_arrays")) glMultiModeDrawElementsIBM(mode, count, type, indices, primcount, modestride);}
 PFNGLMULTIMODEDRAWARRAYSIBMPROC pglMultiModeDrawArraysIBM=_Lazy_glMultiModeDrawArraysIBM;
 PFNGLMULTIMODEDRAWELEMENTSIBMPROC pglMultiModeDrawElementsIBM=_Lazy_glMultiModeDrawElementsIBM;
 #endif 
@@ -2989,14 +3021,14 @@ PFNGLMULTIMODEDRAWELEMENTSIBMPROC pglMultiModeDrawElementsIBM=_Lazy_glMultiModeD
 //GL_IBM_vertex_array_lists
 
 #ifdef __GLEE_GL_IBM_vertex_array_lists
-void __stdcall _Lazy_glColorPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glColorPointerListIBM(size, type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glSecondaryColorPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glSecondaryColorPointerListIBM(size, type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glEdgeFlagPointerListIBM(GLint stride, const GLboolean* * pointer, GLint ptrstride)  {if (GLeeInit()) glEdgeFlagPointerListIBM(stride, pointer, ptrstride);}
-void __stdcall _Lazy_glFogCoordPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glFogCoordPointerListIBM(type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glIndexPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glIndexPointerListIBM(type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glNormalPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glNormalPointerListIBM(type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glTexCoordPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glTexCoordPointerListIBM(size, type, stride, pointer, ptrstride);}
-void __stdcall _Lazy_glVertexPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (GLeeInit()) glVertexPointerListIBM(size, type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glColorPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglColorPointerListIBM, "glColorPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glColorPointerListIBM(size, type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glSecondaryColorPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglSecondaryColorPointerListIBM, "glSecondaryColorPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glSecondaryColorPointerListIBM(size, type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glEdgeFlagPointerListIBM(GLint stride, const GLboolean* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglEdgeFlagPointerListIBM, "glEdgeFlagPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glEdgeFlagPointerListIBM(stride, pointer, ptrstride);}
+void __stdcall _Lazy_glFogCoordPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglFogCoordPointerListIBM, "glFogCoordPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glFogCoordPointerListIBM(type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glIndexPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglIndexPointerListIBM, "glIndexPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glIndexPointerListIBM(type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glNormalPointerListIBM(GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglNormalPointerListIBM, "glNormalPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glNormalPointerListIBM(type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glTexCoordPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglTexCoordPointerListIBM, "glTexCoordPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glTexCoordPointerListIBM(size, type, stride, pointer, ptrstride);}
+void __stdcall _Lazy_glVertexPointerListIBM(GLint size, GLenum type, GLint stride, const GLvoid* * pointer, GLint ptrstride)  {if (__GLeeLazyLink((void**)&pglVertexPointerListIBM, "glVertexPointerListIBM", &_GLEE_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists")) glVertexPointerListIBM(size, type, stride, pointer, ptrstride);}
 PFNGLCOLORPOINTERLISTIBMPROC pglColorPointerListIBM=_Lazy_glColorPointerListIBM;
 PFNGLSECONDARYCOLORPOINTERLISTIBMPROC pglSecondaryColorPointerListIBM=_Lazy_glSecondaryColorPointerListIBM;
 PFNGLEDGEFLAGPOINTERLISTIBMPROC pglEdgeFlagPointerListIBM=_Lazy_glEdgeFlagPointerListIBM;
@@ -3040,15 +3072,15 @@ PFNGLVERTEXPOINTERLISTIBMPROC pglVertexPointerListIBM=_Lazy_glVertexPointerListI
 //GL_3DFX_tbuffer
 
 #ifdef __GLEE_GL_3DFX_tbuffer
-void __stdcall _Lazy_glTbufferMask3DFX(GLuint mask)                                       {if (GLeeInit()) glTbufferMask3DFX(mask);}
+void __stdcall _Lazy_glTbufferMask3DFX(GLuint mask)                                       {if (__GLeeLazyLink((void**)&pglTbufferMask3DFX, "glTbufferMask3DFX", &_GLEE_3DFX_tbuffer, "GL_3DFX_tbuffer")) glTbufferMask3DFX(mask);}
 PFNGLTBUFFERMASK3DFXPROC pglTbufferMask3DFX=_Lazy_glTbufferMask3DFX;
 #endif 
 
 //GL_EXT_multisample
 
 #ifdef __GLEE_GL_EXT_multisample
-void __stdcall _Lazy_glSampleMaskEXT(GLclampf value, GLboolean invert)                    {if (GLeeInit()) glSampleMaskEXT(value, invert);}
-void __stdcall _Lazy_glSamplePatternEXT(GLenum pattern)                                   {if (GLeeInit()) glSamplePatternEXT(pattern);}
+void __stdcall _Lazy_glSampleMaskEXT(GLclampf value, GLboolean invert)                    {if (__GLeeLazyLink((void**)&pglSampleMaskEXT, "glSampleMaskEXT", &_GLEE_EXT_multisample, "GL_EXT_multisample")) glSampleMaskEXT(value, invert);}
+void __stdcall _Lazy_glSamplePatternEXT(GLenum pattern)                                   {if (__GLeeLazyLink((void**)&pglSamplePatternEXT, "glSamplePatternEXT", &_GLEE_EXT_multisample, "GL_EXT_multisample")) glSamplePatternEXT(pattern);}
 PFNGLSAMPLEMASKEXTPROC pglSampleMaskEXT=_Lazy_glSampleMaskEXT;
 PFNGLSAMPLEPATTERNEXTPROC pglSamplePatternEXT=_Lazy_glSamplePatternEXT;
 #endif 
@@ -3076,7 +3108,7 @@ PFNGLSAMPLEPATTERNEXTPROC pglSamplePatternEXT=_Lazy_glSamplePatternEXT;
 //GL_SGIS_texture_color_mask
 
 #ifdef __GLEE_GL_SGIS_texture_color_mask
-void __stdcall _Lazy_glTextureColorMaskSGIS(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)  {if (GLeeInit()) glTextureColorMaskSGIS(red, green, blue, alpha);}
+void __stdcall _Lazy_glTextureColorMaskSGIS(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)  {if (__GLeeLazyLink((void**)&pglTextureColorMaskSGIS, "glTextureColorMaskSGIS", &_GLEE_SGIS_texture_color_mask, "GL_SGIS_texture_color_mask")) glTextureColorMaskSGIS(red, green, blue, alpha);}
 PFNGLTEXTURECOLORMASKSGISPROC pglTextureColorMaskSGIS=_Lazy_glTextureColorMaskSGIS;
 #endif 
 
@@ -3093,13 +3125,13 @@ PFNGLTEXTURECOLORMASKSGISPROC pglTextureColorMaskSGIS=_Lazy_glTextureColorMaskSG
 //GL_NV_fence
 
 #ifdef __GLEE_GL_NV_fence
-void __stdcall _Lazy_glDeleteFencesNV(GLsizei n, const GLuint * fences)                   {if (GLeeInit()) glDeleteFencesNV(n, fences);}
-void __stdcall _Lazy_glGenFencesNV(GLsizei n, GLuint * fences)                            {if (GLeeInit()) glGenFencesNV(n, fences);}
-GLboolean __stdcall _Lazy_glIsFenceNV(GLuint fence)                                       {if (GLeeInit()) return glIsFenceNV(fence); return (GLboolean)0;}
-GLboolean __stdcall _Lazy_glTestFenceNV(GLuint fence)                                     {if (GLeeInit()) return glTestFenceNV(fence); return (GLboolean)0;}
-void __stdcall _Lazy_glGetFenceivNV(GLuint fence, GLenum pname, GLint * params)           {if (GLeeInit()) glGetFenceivNV(fence, pname, params);}
-void __stdcall _Lazy_glFinishFenceNV(GLuint fence)                                        {if (GLeeInit()) glFinishFenceNV(fence);}
-void __stdcall _Lazy_glSetFenceNV(GLuint fence, GLenum condition)                         {if (GLeeInit()) glSetFenceNV(fence, condition);}
+void __stdcall _Lazy_glDeleteFencesNV(GLsizei n, const GLuint * fences)                   {if (__GLeeLazyLink((void**)&pglDeleteFencesNV, "glDeleteFencesNV", &_GLEE_NV_fence, "GL_NV_fence")) glDeleteFencesNV(n, fences);}
+void __stdcall _Lazy_glGenFencesNV(GLsizei n, GLuint * fences)                            {if (__GLeeLazyLink((void**)&pglGenFencesNV, "glGenFencesNV", &_GLEE_NV_fence, "GL_NV_fence")) glGenFencesNV(n, fences);}
+GLboolean __stdcall _Lazy_glIsFenceNV(GLuint fence)                                       {if (__GLeeLazyLink((void**)&pglIsFenceNV, "glIsFenceNV", &_GLEE_NV_fence, "GL_NV_fence")) return glIsFenceNV(fence); return (GLboolean)0;}
+GLboolean __stdcall _Lazy_glTestFenceNV(GLuint fence)                                     {if (__GLeeLazyLink((void**)&pglTestFenceNV, "glTestFenceNV", &_GLEE_NV_fence, "GL_NV_fence")) return glTestFenceNV(fence); return (GLboolean)0;}
+void __stdcall _Lazy_glGetFenceivNV(GLuint fence, GLenum pname, GLint * params)           {if (__GLeeLazyLink((void**)&pglGetFenceivNV, "glGetFenceivNV", &_GLEE_NV_fence, "GL_NV_fence")) glGetFenceivNV(fence, pname, params);}
+void __stdcall _Lazy_glFinishFenceNV(GLuint fence)                                        {if (__GLeeLazyLink((void**)&pglFinishFenceNV, "glFinishFenceNV", &_GLEE_NV_fence, "GL_NV_fence")) glFinishFenceNV(fence);}
+void __stdcall _Lazy_glSetFenceNV(GLuint fence, GLenum condition)                         {if (__GLeeLazyLink((void**)&pglSetFenceNV, "glSetFenceNV", &_GLEE_NV_fence, "GL_NV_fence")) glSetFenceNV(fence, condition);}
 PFNGLDELETEFENCESNVPROC pglDeleteFencesNV=_Lazy_glDeleteFencesNV;
 PFNGLGENFENCESNVPROC pglGenFencesNV=_Lazy_glGenFencesNV;
 PFNGLISFENCENVPROC pglIsFenceNV=_Lazy_glIsFenceNV;
@@ -3117,15 +3149,15 @@ PFNGLSETFENCENVPROC pglSetFenceNV=_Lazy_glSetFenceNV;
 //GL_NV_evaluators
 
 #ifdef __GLEE_GL_NV_evaluators
-void __stdcall _Lazy_glMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const GLvoid * points)  {if (GLeeInit()) glMapControlPointsNV(target, index, type, ustride, vstride, uorder, vorder, packed, points);}
-void __stdcall _Lazy_glMapParameterivNV(GLenum target, GLenum pname, const GLint * params)  {if (GLeeInit()) glMapParameterivNV(target, pname, params);}
-void __stdcall _Lazy_glMapParameterfvNV(GLenum target, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glMapParameterfvNV(target, pname, params);}
-void __stdcall _Lazy_glGetMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, GLvoid * points)  {if (GLeeInit()) glGetMapControlPointsNV(target, index, type, ustride, vstride, packed, points);}
-void __stdcall _Lazy_glGetMapParameterivNV(GLenum target, GLenum pname, GLint * params)   {if (GLeeInit()) glGetMapParameterivNV(target, pname, params);}
-void __stdcall _Lazy_glGetMapParameterfvNV(GLenum target, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetMapParameterfvNV(target, pname, params);}
-void __stdcall _Lazy_glGetMapAttribParameterivNV(GLenum target, GLuint index, GLenum pname, GLint * params)  {if (GLeeInit()) glGetMapAttribParameterivNV(target, index, pname, params);}
-void __stdcall _Lazy_glGetMapAttribParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetMapAttribParameterfvNV(target, index, pname, params);}
-void __stdcall _Lazy_glEvalMapsNV(GLenum target, GLenum mode)                             {if (GLeeInit()) glEvalMapsNV(target, mode);}
+void __stdcall _Lazy_glMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const GLvoid * points)  {if (__GLeeLazyLink((void**)&pglMapControlPointsNV, "glMapControlPointsNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glMapControlPointsNV(target, index, type, ustride, vstride, uorder, vorder, packed, points);}
+void __stdcall _Lazy_glMapParameterivNV(GLenum target, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglMapParameterivNV, "glMapParameterivNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glMapParameterivNV(target, pname, params);}
+void __stdcall _Lazy_glMapParameterfvNV(GLenum target, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglMapParameterfvNV, "glMapParameterfvNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glMapParameterfvNV(target, pname, params);}
+void __stdcall _Lazy_glGetMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, GLvoid * points)  {if (__GLeeLazyLink((void**)&pglGetMapControlPointsNV, "glGetMapControlPointsNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glGetMapControlPointsNV(target, index, type, ustride, vstride, packed, points);}
+void __stdcall _Lazy_glGetMapParameterivNV(GLenum target, GLenum pname, GLint * params)   {if (__GLeeLazyLink((void**)&pglGetMapParameterivNV, "glGetMapParameterivNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glGetMapParameterivNV(target, pname, params);}
+void __stdcall _Lazy_glGetMapParameterfvNV(GLenum target, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetMapParameterfvNV, "glGetMapParameterfvNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glGetMapParameterfvNV(target, pname, params);}
+void __stdcall _Lazy_glGetMapAttribParameterivNV(GLenum target, GLuint index, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetMapAttribParameterivNV, "glGetMapAttribParameterivNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glGetMapAttribParameterivNV(target, index, pname, params);}
+void __stdcall _Lazy_glGetMapAttribParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetMapAttribParameterfvNV, "glGetMapAttribParameterfvNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glGetMapAttribParameterfvNV(target, index, pname, params);}
+void __stdcall _Lazy_glEvalMapsNV(GLenum target, GLenum mode)                             {if (__GLeeLazyLink((void**)&pglEvalMapsNV, "glEvalMapsNV", &_GLEE_NV_evaluators, "GL_NV_evaluators")) glEvalMapsNV(target, mode);}
 PFNGLMAPCONTROLPOINTSNVPROC pglMapControlPointsNV=_Lazy_glMapControlPointsNV;
 PFNGLMAPPARAMETERIVNVPROC pglMapParameterivNV=_Lazy_glMapParameterivNV;
 PFNGLMAPPARAMETERFVNVPROC pglMapParameterfvNV=_Lazy_glMapParameterfvNV;
@@ -3145,8 +3177,8 @@ PFNGLEVALMAPSNVPROC pglEvalMapsNV=_Lazy_glEvalMapsNV;
 //GL_NV_register_combiners2
 
 #ifdef __GLEE_GL_NV_register_combiners2
-void __stdcall _Lazy_glCombinerStageParameterfvNV(GLenum stage, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glCombinerStageParameterfvNV(stage, pname, params);}
-void __stdcall _Lazy_glGetCombinerStageParameterfvNV(GLenum stage, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetCombinerStageParameterfvNV(stage, pname, params);}
+void __stdcall _Lazy_glCombinerStageParameterfvNV(GLenum stage, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglCombinerStageParameterfvNV, "glCombinerStageParameterfvNV", &_GLEE_NV_register_combiners2, "GL_NV_register_combiners2")) glCombinerStageParameterfvNV(stage, pname, params);}
+void __stdcall _Lazy_glGetCombinerStageParameterfvNV(GLenum stage, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetCombinerStageParameterfvNV, "glGetCombinerStageParameterfvNV", &_GLEE_NV_register_combiners2, "GL_NV_register_combiners2")) glGetCombinerStageParameterfvNV(stage, pname, params);}
 PFNGLCOMBINERSTAGEPARAMETERFVNVPROC pglCombinerStageParameterfvNV=_Lazy_glCombinerStageParameterfvNV;
 PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC pglGetCombinerStageParameterfvNV=_Lazy_glGetCombinerStageParameterfvNV;
 #endif 
@@ -3179,70 +3211,70 @@ PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC pglGetCombinerStageParameterfvNV=_Lazy_gl
 //GL_NV_vertex_program
 
 #ifdef __GLEE_GL_NV_vertex_program
-GLboolean __stdcall _Lazy_glAreProgramsResidentNV(GLsizei n, const GLuint * programs, GLboolean * residences)  {if (GLeeInit()) return glAreProgramsResidentNV(n, programs, residences); return (GLboolean)0;}
-void __stdcall _Lazy_glBindProgramNV(GLenum target, GLuint id)                            {if (GLeeInit()) glBindProgramNV(target, id);}
-void __stdcall _Lazy_glDeleteProgramsNV(GLsizei n, const GLuint * programs)               {if (GLeeInit()) glDeleteProgramsNV(n, programs);}
-void __stdcall _Lazy_glExecuteProgramNV(GLenum target, GLuint id, const GLfloat * params)  {if (GLeeInit()) glExecuteProgramNV(target, id, params);}
-void __stdcall _Lazy_glGenProgramsNV(GLsizei n, GLuint * programs)                        {if (GLeeInit()) glGenProgramsNV(n, programs);}
-void __stdcall _Lazy_glGetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble * params)  {if (GLeeInit()) glGetProgramParameterdvNV(target, index, pname, params);}
-void __stdcall _Lazy_glGetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetProgramParameterfvNV(target, index, pname, params);}
-void __stdcall _Lazy_glGetProgramivNV(GLuint id, GLenum pname, GLint * params)            {if (GLeeInit()) glGetProgramivNV(id, pname, params);}
-void __stdcall _Lazy_glGetProgramStringNV(GLuint id, GLenum pname, GLubyte * program)     {if (GLeeInit()) glGetProgramStringNV(id, pname, program);}
-void __stdcall _Lazy_glGetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint * params)  {if (GLeeInit()) glGetTrackMatrixivNV(target, address, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble * params)  {if (GLeeInit()) glGetVertexAttribdvNV(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetVertexAttribfvNV(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribivNV(GLuint index, GLenum pname, GLint * params)    {if (GLeeInit()) glGetVertexAttribivNV(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribPointervNV(GLuint index, GLenum pname, GLvoid* * pointer)  {if (GLeeInit()) glGetVertexAttribPointervNV(index, pname, pointer);}
-GLboolean __stdcall _Lazy_glIsProgramNV(GLuint id)                                        {if (GLeeInit()) return glIsProgramNV(id); return (GLboolean)0;}
-void __stdcall _Lazy_glLoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte * program)  {if (GLeeInit()) glLoadProgramNV(target, id, len, program);}
-void __stdcall _Lazy_glProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glProgramParameter4dNV(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble * v)  {if (GLeeInit()) glProgramParameter4dvNV(target, index, v);}
-void __stdcall _Lazy_glProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glProgramParameter4fNV(target, index, x, y, z, w);}
-void __stdcall _Lazy_glProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat * v)  {if (GLeeInit()) glProgramParameter4fvNV(target, index, v);}
-void __stdcall _Lazy_glProgramParameters4dvNV(GLenum target, GLuint index, GLuint count, const GLdouble * v)  {if (GLeeInit()) glProgramParameters4dvNV(target, index, count, v);}
-void __stdcall _Lazy_glProgramParameters4fvNV(GLenum target, GLuint index, GLuint count, const GLfloat * v)  {if (GLeeInit()) glProgramParameters4fvNV(target, index, count, v);}
-void __stdcall _Lazy_glRequestResidentProgramsNV(GLsizei n, const GLuint * programs)      {if (GLeeInit()) glRequestResidentProgramsNV(n, programs);}
-void __stdcall _Lazy_glTrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)  {if (GLeeInit()) glTrackMatrixNV(target, address, matrix, transform);}
-void __stdcall _Lazy_glVertexAttribPointerNV(GLuint index, GLint fsize, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (GLeeInit()) glVertexAttribPointerNV(index, fsize, type, stride, pointer);}
-void __stdcall _Lazy_glVertexAttrib1dNV(GLuint index, GLdouble x)                         {if (GLeeInit()) glVertexAttrib1dNV(index, x);}
-void __stdcall _Lazy_glVertexAttrib1dvNV(GLuint index, const GLdouble * v)                {if (GLeeInit()) glVertexAttrib1dvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib1fNV(GLuint index, GLfloat x)                          {if (GLeeInit()) glVertexAttrib1fNV(index, x);}
-void __stdcall _Lazy_glVertexAttrib1fvNV(GLuint index, const GLfloat * v)                 {if (GLeeInit()) glVertexAttrib1fvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib1sNV(GLuint index, GLshort x)                          {if (GLeeInit()) glVertexAttrib1sNV(index, x);}
-void __stdcall _Lazy_glVertexAttrib1svNV(GLuint index, const GLshort * v)                 {if (GLeeInit()) glVertexAttrib1svNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)             {if (GLeeInit()) glVertexAttrib2dNV(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2dvNV(GLuint index, const GLdouble * v)                {if (GLeeInit()) glVertexAttrib2dvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)               {if (GLeeInit()) glVertexAttrib2fNV(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2fvNV(GLuint index, const GLfloat * v)                 {if (GLeeInit()) glVertexAttrib2fvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib2sNV(GLuint index, GLshort x, GLshort y)               {if (GLeeInit()) glVertexAttrib2sNV(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2svNV(GLuint index, const GLshort * v)                 {if (GLeeInit()) glVertexAttrib2svNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)  {if (GLeeInit()) glVertexAttrib3dNV(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3dvNV(GLuint index, const GLdouble * v)                {if (GLeeInit()) glVertexAttrib3dvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)    {if (GLeeInit()) glVertexAttrib3fNV(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3fvNV(GLuint index, const GLfloat * v)                 {if (GLeeInit()) glVertexAttrib3fvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)    {if (GLeeInit()) glVertexAttrib3sNV(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3svNV(GLuint index, const GLshort * v)                 {if (GLeeInit()) glVertexAttrib3svNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glVertexAttrib4dNV(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4dvNV(GLuint index, const GLdouble * v)                {if (GLeeInit()) glVertexAttrib4dvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glVertexAttrib4fNV(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4fvNV(GLuint index, const GLfloat * v)                 {if (GLeeInit()) glVertexAttrib4fvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (GLeeInit()) glVertexAttrib4sNV(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4svNV(GLuint index, const GLshort * v)                 {if (GLeeInit()) glVertexAttrib4svNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (GLeeInit()) glVertexAttrib4ubNV(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4ubvNV(GLuint index, const GLubyte * v)                {if (GLeeInit()) glVertexAttrib4ubvNV(index, v);}
-void __stdcall _Lazy_glVertexAttribs1dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (GLeeInit()) glVertexAttribs1dvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs1fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (GLeeInit()) glVertexAttribs1fvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs1svNV(GLuint index, GLsizei count, const GLshort * v)  {if (GLeeInit()) glVertexAttribs1svNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs2dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (GLeeInit()) glVertexAttribs2dvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs2fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (GLeeInit()) glVertexAttribs2fvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs2svNV(GLuint index, GLsizei count, const GLshort * v)  {if (GLeeInit()) glVertexAttribs2svNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs3dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (GLeeInit()) glVertexAttribs3dvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs3fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (GLeeInit()) glVertexAttribs3fvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs3svNV(GLuint index, GLsizei count, const GLshort * v)  {if (GLeeInit()) glVertexAttribs3svNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs4dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (GLeeInit()) glVertexAttribs4dvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs4fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (GLeeInit()) glVertexAttribs4fvNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs4svNV(GLuint index, GLsizei count, const GLshort * v)  {if (GLeeInit()) glVertexAttribs4svNV(index, count, v);}
-void __stdcall _Lazy_glVertexAttribs4ubvNV(GLuint index, GLsizei count, const GLubyte * v)  {if (GLeeInit()) glVertexAttribs4ubvNV(index, count, v);}
+GLboolean __stdcall _Lazy_glAreProgramsResidentNV(GLsizei n, const GLuint * programs, GLboolean * residences)  {if (__GLeeLazyLink((void**)&pglAreProgramsResidentNV, "glAreProgramsResidentNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) return glAreProgramsResidentNV(n, programs, residences); return (GLboolean)0;}
+void __stdcall _Lazy_glBindProgramNV(GLenum target, GLuint id)                            {if (__GLeeLazyLink((void**)&pglBindProgramNV, "glBindProgramNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glBindProgramNV(target, id);}
+void __stdcall _Lazy_glDeleteProgramsNV(GLsizei n, const GLuint * programs)               {if (__GLeeLazyLink((void**)&pglDeleteProgramsNV, "glDeleteProgramsNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glDeleteProgramsNV(n, programs);}
+void __stdcall _Lazy_glExecuteProgramNV(GLenum target, GLuint id, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglExecuteProgramNV, "glExecuteProgramNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glExecuteProgramNV(target, id, params);}
+void __stdcall _Lazy_glGenProgramsNV(GLsizei n, GLuint * programs)                        {if (__GLeeLazyLink((void**)&pglGenProgramsNV, "glGenProgramsNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGenProgramsNV(n, programs);}
+void __stdcall _Lazy_glGetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetProgramParameterdvNV, "glGetProgramParameterdvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetProgramParameterdvNV(target, index, pname, params);}
+void __stdcall _Lazy_glGetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetProgramParameterfvNV, "glGetProgramParameterfvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetProgramParameterfvNV(target, index, pname, params);}
+void __stdcall _Lazy_glGetProgramivNV(GLuint id, GLenum pname, GLint * params)            {if (__GLeeLazyLink((void**)&pglGetProgramivNV, "glGetProgramivNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetProgramivNV(id, pname, params);}
+void __stdcall _Lazy_glGetProgramStringNV(GLuint id, GLenum pname, GLubyte * program)     {if (__GLeeLazyLink((void**)&pglGetProgramStringNV, "glGetProgramStringNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetProgramStringNV(id, pname, program);}
+void __stdcall _Lazy_glGetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetTrackMatrixivNV, "glGetTrackMatrixivNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetTrackMatrixivNV(target, address, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribdvNV, "glGetVertexAttribdvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetVertexAttribdvNV(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribfvNV, "glGetVertexAttribfvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetVertexAttribfvNV(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribivNV(GLuint index, GLenum pname, GLint * params)    {if (__GLeeLazyLink((void**)&pglGetVertexAttribivNV, "glGetVertexAttribivNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetVertexAttribivNV(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribPointervNV(GLuint index, GLenum pname, GLvoid* * pointer)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribPointervNV, "glGetVertexAttribPointervNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glGetVertexAttribPointervNV(index, pname, pointer);}
+GLboolean __stdcall _Lazy_glIsProgramNV(GLuint id)                                        {if (__GLeeLazyLink((void**)&pglIsProgramNV, "glIsProgramNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) return glIsProgramNV(id); return (GLboolean)0;}
+void __stdcall _Lazy_glLoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte * program)  {if (__GLeeLazyLink((void**)&pglLoadProgramNV, "glLoadProgramNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glLoadProgramNV(target, id, len, program);}
+void __stdcall _Lazy_glProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglProgramParameter4dNV, "glProgramParameter4dNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameter4dNV(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglProgramParameter4dvNV, "glProgramParameter4dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameter4dvNV(target, index, v);}
+void __stdcall _Lazy_glProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglProgramParameter4fNV, "glProgramParameter4fNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameter4fNV(target, index, x, y, z, w);}
+void __stdcall _Lazy_glProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglProgramParameter4fvNV, "glProgramParameter4fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameter4fvNV(target, index, v);}
+void __stdcall _Lazy_glProgramParameters4dvNV(GLenum target, GLuint index, GLuint count, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglProgramParameters4dvNV, "glProgramParameters4dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameters4dvNV(target, index, count, v);}
+void __stdcall _Lazy_glProgramParameters4fvNV(GLenum target, GLuint index, GLuint count, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglProgramParameters4fvNV, "glProgramParameters4fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glProgramParameters4fvNV(target, index, count, v);}
+void __stdcall _Lazy_glRequestResidentProgramsNV(GLsizei n, const GLuint * programs)      {if (__GLeeLazyLink((void**)&pglRequestResidentProgramsNV, "glRequestResidentProgramsNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glRequestResidentProgramsNV(n, programs);}
+void __stdcall _Lazy_glTrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)  {if (__GLeeLazyLink((void**)&pglTrackMatrixNV, "glTrackMatrixNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glTrackMatrixNV(target, address, matrix, transform);}
+void __stdcall _Lazy_glVertexAttribPointerNV(GLuint index, GLint fsize, GLenum type, GLsizei stride, const GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglVertexAttribPointerNV, "glVertexAttribPointerNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribPointerNV(index, fsize, type, stride, pointer);}
+void __stdcall _Lazy_glVertexAttrib1dNV(GLuint index, GLdouble x)                         {if (__GLeeLazyLink((void**)&pglVertexAttrib1dNV, "glVertexAttrib1dNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1dNV(index, x);}
+void __stdcall _Lazy_glVertexAttrib1dvNV(GLuint index, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib1dvNV, "glVertexAttrib1dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1dvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib1fNV(GLuint index, GLfloat x)                          {if (__GLeeLazyLink((void**)&pglVertexAttrib1fNV, "glVertexAttrib1fNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1fNV(index, x);}
+void __stdcall _Lazy_glVertexAttrib1fvNV(GLuint index, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib1fvNV, "glVertexAttrib1fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1fvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib1sNV(GLuint index, GLshort x)                          {if (__GLeeLazyLink((void**)&pglVertexAttrib1sNV, "glVertexAttrib1sNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1sNV(index, x);}
+void __stdcall _Lazy_glVertexAttrib1svNV(GLuint index, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib1svNV, "glVertexAttrib1svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib1svNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)             {if (__GLeeLazyLink((void**)&pglVertexAttrib2dNV, "glVertexAttrib2dNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2dNV(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2dvNV(GLuint index, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib2dvNV, "glVertexAttrib2dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2dvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)               {if (__GLeeLazyLink((void**)&pglVertexAttrib2fNV, "glVertexAttrib2fNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2fNV(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2fvNV(GLuint index, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib2fvNV, "glVertexAttrib2fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2fvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib2sNV(GLuint index, GLshort x, GLshort y)               {if (__GLeeLazyLink((void**)&pglVertexAttrib2sNV, "glVertexAttrib2sNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2sNV(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2svNV(GLuint index, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib2svNV, "glVertexAttrib2svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib2svNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)  {if (__GLeeLazyLink((void**)&pglVertexAttrib3dNV, "glVertexAttrib3dNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3dNV(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3dvNV(GLuint index, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib3dvNV, "glVertexAttrib3dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3dvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)    {if (__GLeeLazyLink((void**)&pglVertexAttrib3fNV, "glVertexAttrib3fNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3fNV(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3fvNV(GLuint index, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib3fvNV, "glVertexAttrib3fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3fvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)    {if (__GLeeLazyLink((void**)&pglVertexAttrib3sNV, "glVertexAttrib3sNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3sNV(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3svNV(GLuint index, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib3svNV, "glVertexAttrib3svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib3svNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4dNV, "glVertexAttrib4dNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4dNV(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4dvNV(GLuint index, const GLdouble * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4dvNV, "glVertexAttrib4dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4dvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4fNV, "glVertexAttrib4fNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4fNV(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4fvNV(GLuint index, const GLfloat * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4fvNV, "glVertexAttrib4fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4fvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4sNV, "glVertexAttrib4sNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4sNV(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4svNV(GLuint index, const GLshort * v)                 {if (__GLeeLazyLink((void**)&pglVertexAttrib4svNV, "glVertexAttrib4svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4svNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4ubNV, "glVertexAttrib4ubNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4ubNV(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4ubvNV(GLuint index, const GLubyte * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4ubvNV, "glVertexAttrib4ubvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttrib4ubvNV(index, v);}
+void __stdcall _Lazy_glVertexAttribs1dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs1dvNV, "glVertexAttribs1dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs1dvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs1fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs1fvNV, "glVertexAttribs1fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs1fvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs1svNV(GLuint index, GLsizei count, const GLshort * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs1svNV, "glVertexAttribs1svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs1svNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs2dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs2dvNV, "glVertexAttribs2dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs2dvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs2fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs2fvNV, "glVertexAttribs2fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs2fvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs2svNV(GLuint index, GLsizei count, const GLshort * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs2svNV, "glVertexAttribs2svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs2svNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs3dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs3dvNV, "glVertexAttribs3dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs3dvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs3fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs3fvNV, "glVertexAttribs3fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs3fvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs3svNV(GLuint index, GLsizei count, const GLshort * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs3svNV, "glVertexAttribs3svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs3svNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs4dvNV(GLuint index, GLsizei count, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs4dvNV, "glVertexAttribs4dvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs4dvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs4fvNV(GLuint index, GLsizei count, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs4fvNV, "glVertexAttribs4fvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs4fvNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs4svNV(GLuint index, GLsizei count, const GLshort * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs4svNV, "glVertexAttribs4svNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs4svNV(index, count, v);}
+void __stdcall _Lazy_glVertexAttribs4ubvNV(GLuint index, GLsizei count, const GLubyte * v)  {if (__GLeeLazyLink((void**)&pglVertexAttribs4ubvNV, "glVertexAttribs4ubvNV", &_GLEE_NV_vertex_program, "GL_NV_vertex_program")) glVertexAttribs4ubvNV(index, count, v);}
 PFNGLAREPROGRAMSRESIDENTNVPROC pglAreProgramsResidentNV=_Lazy_glAreProgramsResidentNV;
 PFNGLBINDPROGRAMNVPROC pglBindProgramNV=_Lazy_glBindProgramNV;
 PFNGLDELETEPROGRAMSNVPROC pglDeleteProgramsNV=_Lazy_glDeleteProgramsNV;
@@ -3342,10 +3374,10 @@ PFNGLVERTEXATTRIBS4UBVNVPROC pglVertexAttribs4ubvNV=_Lazy_glVertexAttribs4ubvNV;
 //GL_ATI_envmap_bumpmap
 
 #ifdef __GLEE_GL_ATI_envmap_bumpmap
-void __stdcall _Lazy_glTexBumpParameterivATI(GLenum pname, const GLint * param)           {if (GLeeInit()) glTexBumpParameterivATI(pname, param);}
-void __stdcall _Lazy_glTexBumpParameterfvATI(GLenum pname, const GLfloat * param)         {if (GLeeInit()) glTexBumpParameterfvATI(pname, param);}
-void __stdcall _Lazy_glGetTexBumpParameterivATI(GLenum pname, GLint * param)              {if (GLeeInit()) glGetTexBumpParameterivATI(pname, param);}
-void __stdcall _Lazy_glGetTexBumpParameterfvATI(GLenum pname, GLfloat * param)            {if (GLeeInit()) glGetTexBumpParameterfvATI(pname, param);}
+void __stdcall _Lazy_glTexBumpParameterivATI(GLenum pname, const GLint * param)           {if (__GLeeLazyLink((void**)&pglTexBumpParameterivATI, "glTexBumpParameterivATI", &_GLEE_ATI_envmap_bumpmap, "GL_ATI_envmap_bumpmap")) glTexBumpParameterivATI(pname, param);}
+void __stdcall _Lazy_glTexBumpParameterfvATI(GLenum pname, const GLfloat * param)         {if (__GLeeLazyLink((void**)&pglTexBumpParameterfvATI, "glTexBumpParameterfvATI", &_GLEE_ATI_envmap_bumpmap, "GL_ATI_envmap_bumpmap")) glTexBumpParameterfvATI(pname, param);}
+void __stdcall _Lazy_glGetTexBumpParameterivATI(GLenum pname, GLint * param)              {if (__GLeeLazyLink((void**)&pglGetTexBumpParameterivATI, "glGetTexBumpParameterivATI", &_GLEE_ATI_envmap_bumpmap, "GL_ATI_envmap_bumpmap")) glGetTexBumpParameterivATI(pname, param);}
+void __stdcall _Lazy_glGetTexBumpParameterfvATI(GLenum pname, GLfloat * param)            {if (__GLeeLazyLink((void**)&pglGetTexBumpParameterfvATI, "glGetTexBumpParameterfvATI", &_GLEE_ATI_envmap_bumpmap, "GL_ATI_envmap_bumpmap")) glGetTexBumpParameterfvATI(pname, param);}
 PFNGLTEXBUMPPARAMETERIVATIPROC pglTexBumpParameterivATI=_Lazy_glTexBumpParameterivATI;
 PFNGLTEXBUMPPARAMETERFVATIPROC pglTexBumpParameterfvATI=_Lazy_glTexBumpParameterfvATI;
 PFNGLGETTEXBUMPPARAMETERIVATIPROC pglGetTexBumpParameterivATI=_Lazy_glGetTexBumpParameterivATI;
@@ -3355,20 +3387,20 @@ PFNGLGETTEXBUMPPARAMETERFVATIPROC pglGetTexBumpParameterfvATI=_Lazy_glGetTexBump
 //GL_ATI_fragment_shader
 
 #ifdef __GLEE_GL_ATI_fragment_shader
-GLuint __stdcall _Lazy_glGenFragmentShadersATI(GLuint range)                              {if (GLeeInit()) return glGenFragmentShadersATI(range); return (GLuint)0;}
-void __stdcall _Lazy_glBindFragmentShaderATI(GLuint id)                                   {if (GLeeInit()) glBindFragmentShaderATI(id);}
-void __stdcall _Lazy_glDeleteFragmentShaderATI(GLuint id)                                 {if (GLeeInit()) glDeleteFragmentShaderATI(id);}
-void __stdcall _Lazy_glBeginFragmentShaderATI(void)                                       {if (GLeeInit()) glBeginFragmentShaderATI();}
-void __stdcall _Lazy_glEndFragmentShaderATI(void)                                         {if (GLeeInit()) glEndFragmentShaderATI();}
-void __stdcall _Lazy_glPassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)          {if (GLeeInit()) glPassTexCoordATI(dst, coord, swizzle);}
-void __stdcall _Lazy_glSampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)            {if (GLeeInit()) glSampleMapATI(dst, interp, swizzle);}
-void __stdcall _Lazy_glColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)  {if (GLeeInit()) glColorFragmentOp1ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);}
-void __stdcall _Lazy_glColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)  {if (GLeeInit()) glColorFragmentOp2ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);}
-void __stdcall _Lazy_glColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)  {if (GLeeInit()) glColorFragmentOp3ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);}
-void __stdcall _Lazy_glAlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)  {if (GLeeInit()) glAlphaFragmentOp1ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod);}
-void __stdcall _Lazy_glAlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)  {if (GLeeInit()) glAlphaFragmentOp2ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);}
-void __stdcall _Lazy_glAlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)  {if (GLeeInit()) glAlphaFragmentOp3ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);}
-void __stdcall _Lazy_glSetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)    {if (GLeeInit()) glSetFragmentShaderConstantATI(dst, value);}
+GLuint __stdcall _Lazy_glGenFragmentShadersATI(GLuint range)                              {if (__GLeeLazyLink((void**)&pglGenFragmentShadersATI, "glGenFragmentShadersATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) return glGenFragmentShadersATI(range); return (GLuint)0;}
+void __stdcall _Lazy_glBindFragmentShaderATI(GLuint id)                                   {if (__GLeeLazyLink((void**)&pglBindFragmentShaderATI, "glBindFragmentShaderATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glBindFragmentShaderATI(id);}
+void __stdcall _Lazy_glDeleteFragmentShaderATI(GLuint id)                                 {if (__GLeeLazyLink((void**)&pglDeleteFragmentShaderATI, "glDeleteFragmentShaderATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glDeleteFragmentShaderATI(id);}
+void __stdcall _Lazy_glBeginFragmentShaderATI(void)                                       {if (__GLeeLazyLink((void**)&pglBeginFragmentShaderATI, "glBeginFragmentShaderATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glBeginFragmentShaderATI();}
+void __stdcall _Lazy_glEndFragmentShaderATI(void)                                         {if (__GLeeLazyLink((void**)&pglEndFragmentShaderATI, "glEndFragmentShaderATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glEndFragmentShaderATI();}
+void __stdcall _Lazy_glPassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)          {if (__GLeeLazyLink((void**)&pglPassTexCoordATI, "glPassTexCoordATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glPassTexCoordATI(dst, coord, swizzle);}
+void __stdcall _Lazy_glSampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)            {if (__GLeeLazyLink((void**)&pglSampleMapATI, "glSampleMapATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glSampleMapATI(dst, interp, swizzle);}
+void __stdcall _Lazy_glColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)  {if (__GLeeLazyLink((void**)&pglColorFragmentOp1ATI, "glColorFragmentOp1ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glColorFragmentOp1ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);}
+void __stdcall _Lazy_glColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)  {if (__GLeeLazyLink((void**)&pglColorFragmentOp2ATI, "glColorFragmentOp2ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glColorFragmentOp2ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);}
+void __stdcall _Lazy_glColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)  {if (__GLeeLazyLink((void**)&pglColorFragmentOp3ATI, "glColorFragmentOp3ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glColorFragmentOp3ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);}
+void __stdcall _Lazy_glAlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)  {if (__GLeeLazyLink((void**)&pglAlphaFragmentOp1ATI, "glAlphaFragmentOp1ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glAlphaFragmentOp1ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod);}
+void __stdcall _Lazy_glAlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)  {if (__GLeeLazyLink((void**)&pglAlphaFragmentOp2ATI, "glAlphaFragmentOp2ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glAlphaFragmentOp2ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);}
+void __stdcall _Lazy_glAlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)  {if (__GLeeLazyLink((void**)&pglAlphaFragmentOp3ATI, "glAlphaFragmentOp3ATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glAlphaFragmentOp3ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);}
+void __stdcall _Lazy_glSetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)    {if (__GLeeLazyLink((void**)&pglSetFragmentShaderConstantATI, "glSetFragmentShaderConstantATI", &_GLEE_ATI_fragment_shader, "GL_ATI_fragment_shader")) glSetFragmentShaderConstantATI(dst, value);}
 PFNGLGENFRAGMENTSHADERSATIPROC pglGenFragmentShadersATI=_Lazy_glGenFragmentShadersATI;
 PFNGLBINDFRAGMENTSHADERATIPROC pglBindFragmentShaderATI=_Lazy_glBindFragmentShaderATI;
 PFNGLDELETEFRAGMENTSHADERATIPROC pglDeleteFragmentShaderATI=_Lazy_glDeleteFragmentShaderATI;
@@ -3388,8 +3420,8 @@ PFNGLSETFRAGMENTSHADERCONSTANTATIPROC pglSetFragmentShaderConstantATI=_Lazy_glSe
 //GL_ATI_pn_triangles
 
 #ifdef __GLEE_GL_ATI_pn_triangles
-void __stdcall _Lazy_glPNTrianglesiATI(GLenum pname, GLint param)                         {if (GLeeInit()) glPNTrianglesiATI(pname, param);}
-void __stdcall _Lazy_glPNTrianglesfATI(GLenum pname, GLfloat param)                       {if (GLeeInit()) glPNTrianglesfATI(pname, param);}
+void __stdcall _Lazy_glPNTrianglesiATI(GLenum pname, GLint param)                         {if (__GLeeLazyLink((void**)&pglPNTrianglesiATI, "glPNTrianglesiATI", &_GLEE_ATI_pn_triangles, "GL_ATI_pn_triangles")) glPNTrianglesiATI(pname, param);}
+void __stdcall _Lazy_glPNTrianglesfATI(GLenum pname, GLfloat param)                       {if (__GLeeLazyLink((void**)&pglPNTrianglesfATI, "glPNTrianglesfATI", &_GLEE_ATI_pn_triangles, "GL_ATI_pn_triangles")) glPNTrianglesfATI(pname, param);}
 PFNGLPNTRIANGLESIATIPROC pglPNTrianglesiATI=_Lazy_glPNTrianglesiATI;
 PFNGLPNTRIANGLESFATIPROC pglPNTrianglesfATI=_Lazy_glPNTrianglesfATI;
 #endif 
@@ -3397,18 +3429,18 @@ PFNGLPNTRIANGLESFATIPROC pglPNTrianglesfATI=_Lazy_glPNTrianglesfATI;
 //GL_ATI_vertex_array_object
 
 #ifdef __GLEE_GL_ATI_vertex_array_object
-GLuint __stdcall _Lazy_glNewObjectBufferATI(GLsizei size, const GLvoid * pointer, GLenum usage)  {if (GLeeInit()) return glNewObjectBufferATI(size, pointer, usage); return (GLuint)0;}
-GLboolean __stdcall _Lazy_glIsObjectBufferATI(GLuint buffer)                              {if (GLeeInit()) return glIsObjectBufferATI(buffer); return (GLboolean)0;}
-void __stdcall _Lazy_glUpdateObjectBufferATI(GLuint buffer, GLuint offset, GLsizei size, const GLvoid * pointer, GLenum preserve)  {if (GLeeInit()) glUpdateObjectBufferATI(buffer, offset, size, pointer, preserve);}
-void __stdcall _Lazy_glGetObjectBufferfvATI(GLuint buffer, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetObjectBufferfvATI(buffer, pname, params);}
-void __stdcall _Lazy_glGetObjectBufferivATI(GLuint buffer, GLenum pname, GLint * params)  {if (GLeeInit()) glGetObjectBufferivATI(buffer, pname, params);}
-void __stdcall _Lazy_glFreeObjectBufferATI(GLuint buffer)                                 {if (GLeeInit()) glFreeObjectBufferATI(buffer);}
-void __stdcall _Lazy_glArrayObjectATI(GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)  {if (GLeeInit()) glArrayObjectATI(array, size, type, stride, buffer, offset);}
-void __stdcall _Lazy_glGetArrayObjectfvATI(GLenum array, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetArrayObjectfvATI(array, pname, params);}
-void __stdcall _Lazy_glGetArrayObjectivATI(GLenum array, GLenum pname, GLint * params)    {if (GLeeInit()) glGetArrayObjectivATI(array, pname, params);}
-void __stdcall _Lazy_glVariantArrayObjectATI(GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)  {if (GLeeInit()) glVariantArrayObjectATI(id, type, stride, buffer, offset);}
-void __stdcall _Lazy_glGetVariantArrayObjectfvATI(GLuint id, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetVariantArrayObjectfvATI(id, pname, params);}
-void __stdcall _Lazy_glGetVariantArrayObjectivATI(GLuint id, GLenum pname, GLint * params)  {if (GLeeInit()) glGetVariantArrayObjectivATI(id, pname, params);}
+GLuint __stdcall _Lazy_glNewObjectBufferATI(GLsizei size, const GLvoid * pointer, GLenum usage)  {if (__GLeeLazyLink((void**)&pglNewObjectBufferATI, "glNewObjectBufferATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) return glNewObjectBufferATI(size, pointer, usage); return (GLuint)0;}
+GLboolean __stdcall _Lazy_glIsObjectBufferATI(GLuint buffer)                              {if (__GLeeLazyLink((void**)&pglIsObjectBufferATI, "glIsObjectBufferATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) return glIsObjectBufferATI(buffer); return (GLboolean)0;}
+void __stdcall _Lazy_glUpdateObjectBufferATI(GLuint buffer, GLuint offset, GLsizei size, const GLvoid * pointer, GLenum preserve)  {if (__GLeeLazyLink((void**)&pglUpdateObjectBufferATI, "glUpdateObjectBufferATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glUpdateObjectBufferATI(buffer, offset, size, pointer, preserve);}
+void __stdcall _Lazy_glGetObjectBufferfvATI(GLuint buffer, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetObjectBufferfvATI, "glGetObjectBufferfvATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetObjectBufferfvATI(buffer, pname, params);}
+void __stdcall _Lazy_glGetObjectBufferivATI(GLuint buffer, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetObjectBufferivATI, "glGetObjectBufferivATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetObjectBufferivATI(buffer, pname, params);}
+void __stdcall _Lazy_glFreeObjectBufferATI(GLuint buffer)                                 {if (__GLeeLazyLink((void**)&pglFreeObjectBufferATI, "glFreeObjectBufferATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glFreeObjectBufferATI(buffer);}
+void __stdcall _Lazy_glArrayObjectATI(GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)  {if (__GLeeLazyLink((void**)&pglArrayObjectATI, "glArrayObjectATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glArrayObjectATI(array, size, type, stride, buffer, offset);}
+void __stdcall _Lazy_glGetArrayObjectfvATI(GLenum array, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetArrayObjectfvATI, "glGetArrayObjectfvATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetArrayObjectfvATI(array, pname, params);}
+void __stdcall _Lazy_glGetArrayObjectivATI(GLenum array, GLenum pname, GLint * params)    {if (__GLeeLazyLink((void**)&pglGetArrayObjectivATI, "glGetArrayObjectivATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetArrayObjectivATI(array, pname, params);}
+void __stdcall _Lazy_glVariantArrayObjectATI(GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)  {if (__GLeeLazyLink((void**)&pglVariantArrayObjectATI, "glVariantArrayObjectATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glVariantArrayObjectATI(id, type, stride, buffer, offset);}
+void __stdcall _Lazy_glGetVariantArrayObjectfvATI(GLuint id, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetVariantArrayObjectfvATI, "glGetVariantArrayObjectfvATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetVariantArrayObjectfvATI(id, pname, params);}
+void __stdcall _Lazy_glGetVariantArrayObjectivATI(GLuint id, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetVariantArrayObjectivATI, "glGetVariantArrayObjectivATI", &_GLEE_ATI_vertex_array_object, "GL_ATI_vertex_array_object")) glGetVariantArrayObjectivATI(id, pname, params);}
 PFNGLNEWOBJECTBUFFERATIPROC pglNewObjectBufferATI=_Lazy_glNewObjectBufferATI;
 PFNGLISOBJECTBUFFERATIPROC pglIsObjectBufferATI=_Lazy_glIsObjectBufferATI;
 PFNGLUPDATEOBJECTBUFFERATIPROC pglUpdateObjectBufferATI=_Lazy_glUpdateObjectBufferATI;
@@ -3426,48 +3458,48 @@ PFNGLGETVARIANTARRAYOBJECTIVATIPROC pglGetVariantArrayObjectivATI=_Lazy_glGetVar
 //GL_EXT_vertex_shader
 
 #ifdef __GLEE_GL_EXT_vertex_shader
-void __stdcall _Lazy_glBeginVertexShaderEXT(void)                                         {if (GLeeInit()) glBeginVertexShaderEXT();}
-void __stdcall _Lazy_glEndVertexShaderEXT(void)                                           {if (GLeeInit()) glEndVertexShaderEXT();}
-void __stdcall _Lazy_glBindVertexShaderEXT(GLuint id)                                     {if (GLeeInit()) glBindVertexShaderEXT(id);}
-GLuint __stdcall _Lazy_glGenVertexShadersEXT(GLuint range)                                {if (GLeeInit()) return glGenVertexShadersEXT(range); return (GLuint)0;}
-void __stdcall _Lazy_glDeleteVertexShaderEXT(GLuint id)                                   {if (GLeeInit()) glDeleteVertexShaderEXT(id);}
-void __stdcall _Lazy_glShaderOp1EXT(GLenum op, GLuint res, GLuint arg1)                   {if (GLeeInit()) glShaderOp1EXT(op, res, arg1);}
-void __stdcall _Lazy_glShaderOp2EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2)      {if (GLeeInit()) glShaderOp2EXT(op, res, arg1, arg2);}
-void __stdcall _Lazy_glShaderOp3EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3)  {if (GLeeInit()) glShaderOp3EXT(op, res, arg1, arg2, arg3);}
-void __stdcall _Lazy_glSwizzleEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)  {if (GLeeInit()) glSwizzleEXT(res, in, outX, outY, outZ, outW);}
-void __stdcall _Lazy_glWriteMaskEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)  {if (GLeeInit()) glWriteMaskEXT(res, in, outX, outY, outZ, outW);}
-void __stdcall _Lazy_glInsertComponentEXT(GLuint res, GLuint src, GLuint num)             {if (GLeeInit()) glInsertComponentEXT(res, src, num);}
-void __stdcall _Lazy_glExtractComponentEXT(GLuint res, GLuint src, GLuint num)            {if (GLeeInit()) glExtractComponentEXT(res, src, num);}
-GLuint __stdcall _Lazy_glGenSymbolsEXT(GLenum datatype, GLenum storagetype, GLenum range, GLuint components)  {if (GLeeInit()) return glGenSymbolsEXT(datatype, storagetype, range, components); return (GLuint)0;}
-void __stdcall _Lazy_glSetInvariantEXT(GLuint id, GLenum type, const GLvoid * addr)       {if (GLeeInit()) glSetInvariantEXT(id, type, addr);}
-void __stdcall _Lazy_glSetLocalConstantEXT(GLuint id, GLenum type, const GLvoid * addr)   {if (GLeeInit()) glSetLocalConstantEXT(id, type, addr);}
-void __stdcall _Lazy_glVariantbvEXT(GLuint id, const GLbyte * addr)                       {if (GLeeInit()) glVariantbvEXT(id, addr);}
-void __stdcall _Lazy_glVariantsvEXT(GLuint id, const GLshort * addr)                      {if (GLeeInit()) glVariantsvEXT(id, addr);}
-void __stdcall _Lazy_glVariantivEXT(GLuint id, const GLint * addr)                        {if (GLeeInit()) glVariantivEXT(id, addr);}
-void __stdcall _Lazy_glVariantfvEXT(GLuint id, const GLfloat * addr)                      {if (GLeeInit()) glVariantfvEXT(id, addr);}
-void __stdcall _Lazy_glVariantdvEXT(GLuint id, const GLdouble * addr)                     {if (GLeeInit()) glVariantdvEXT(id, addr);}
-void __stdcall _Lazy_glVariantubvEXT(GLuint id, const GLubyte * addr)                     {if (GLeeInit()) glVariantubvEXT(id, addr);}
-void __stdcall _Lazy_glVariantusvEXT(GLuint id, const GLushort * addr)                    {if (GLeeInit()) glVariantusvEXT(id, addr);}
-void __stdcall _Lazy_glVariantuivEXT(GLuint id, const GLuint * addr)                      {if (GLeeInit()) glVariantuivEXT(id, addr);}
-void __stdcall _Lazy_glVariantPointerEXT(GLuint id, GLenum type, GLuint stride, const GLvoid * addr)  {if (GLeeInit()) glVariantPointerEXT(id, type, stride, addr);}
-void __stdcall _Lazy_glEnableVariantClientStateEXT(GLuint id)                             {if (GLeeInit()) glEnableVariantClientStateEXT(id);}
-void __stdcall _Lazy_glDisableVariantClientStateEXT(GLuint id)                            {if (GLeeInit()) glDisableVariantClientStateEXT(id);}
-GLuint __stdcall _Lazy_glBindLightParameterEXT(GLenum light, GLenum value)                {if (GLeeInit()) return glBindLightParameterEXT(light, value); return (GLuint)0;}
-GLuint __stdcall _Lazy_glBindMaterialParameterEXT(GLenum face, GLenum value)              {if (GLeeInit()) return glBindMaterialParameterEXT(face, value); return (GLuint)0;}
-GLuint __stdcall _Lazy_glBindTexGenParameterEXT(GLenum unit, GLenum coord, GLenum value)  {if (GLeeInit()) return glBindTexGenParameterEXT(unit, coord, value); return (GLuint)0;}
-GLuint __stdcall _Lazy_glBindTextureUnitParameterEXT(GLenum unit, GLenum value)           {if (GLeeInit()) return glBindTextureUnitParameterEXT(unit, value); return (GLuint)0;}
-GLuint __stdcall _Lazy_glBindParameterEXT(GLenum value)                                   {if (GLeeInit()) return glBindParameterEXT(value); return (GLuint)0;}
-GLboolean __stdcall _Lazy_glIsVariantEnabledEXT(GLuint id, GLenum cap)                    {if (GLeeInit()) return glIsVariantEnabledEXT(id, cap); return (GLboolean)0;}
-void __stdcall _Lazy_glGetVariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)   {if (GLeeInit()) glGetVariantBooleanvEXT(id, value, data);}
-void __stdcall _Lazy_glGetVariantIntegervEXT(GLuint id, GLenum value, GLint * data)       {if (GLeeInit()) glGetVariantIntegervEXT(id, value, data);}
-void __stdcall _Lazy_glGetVariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)       {if (GLeeInit()) glGetVariantFloatvEXT(id, value, data);}
-void __stdcall _Lazy_glGetVariantPointervEXT(GLuint id, GLenum value, GLvoid* * data)     {if (GLeeInit()) glGetVariantPointervEXT(id, value, data);}
-void __stdcall _Lazy_glGetInvariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)  {if (GLeeInit()) glGetInvariantBooleanvEXT(id, value, data);}
-void __stdcall _Lazy_glGetInvariantIntegervEXT(GLuint id, GLenum value, GLint * data)     {if (GLeeInit()) glGetInvariantIntegervEXT(id, value, data);}
-void __stdcall _Lazy_glGetInvariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)     {if (GLeeInit()) glGetInvariantFloatvEXT(id, value, data);}
-void __stdcall _Lazy_glGetLocalConstantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)  {if (GLeeInit()) glGetLocalConstantBooleanvEXT(id, value, data);}
-void __stdcall _Lazy_glGetLocalConstantIntegervEXT(GLuint id, GLenum value, GLint * data)  {if (GLeeInit()) glGetLocalConstantIntegervEXT(id, value, data);}
-void __stdcall _Lazy_glGetLocalConstantFloatvEXT(GLuint id, GLenum value, GLfloat * data)  {if (GLeeInit()) glGetLocalConstantFloatvEXT(id, value, data);}
+void __stdcall _Lazy_glBeginVertexShaderEXT(void)                                         {if (__GLeeLazyLink((void**)&pglBeginVertexShaderEXT, "glBeginVertexShaderEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glBeginVertexShaderEXT();}
+void __stdcall _Lazy_glEndVertexShaderEXT(void)                                           {if (__GLeeLazyLink((void**)&pglEndVertexShaderEXT, "glEndVertexShaderEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glEndVertexShaderEXT();}
+void __stdcall _Lazy_glBindVertexShaderEXT(GLuint id)                                     {if (__GLeeLazyLink((void**)&pglBindVertexShaderEXT, "glBindVertexShaderEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glBindVertexShaderEXT(id);}
+GLuint __stdcall _Lazy_glGenVertexShadersEXT(GLuint range)                                {if (__GLeeLazyLink((void**)&pglGenVertexShadersEXT, "glGenVertexShadersEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glGenVertexShadersEXT(range); return (GLuint)0;}
+void __stdcall _Lazy_glDeleteVertexShaderEXT(GLuint id)                                   {if (__GLeeLazyLink((void**)&pglDeleteVertexShaderEXT, "glDeleteVertexShaderEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glDeleteVertexShaderEXT(id);}
+void __stdcall _Lazy_glShaderOp1EXT(GLenum op, GLuint res, GLuint arg1)                   {if (__GLeeLazyLink((void**)&pglShaderOp1EXT, "glShaderOp1EXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glShaderOp1EXT(op, res, arg1);}
+void __stdcall _Lazy_glShaderOp2EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2)      {if (__GLeeLazyLink((void**)&pglShaderOp2EXT, "glShaderOp2EXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glShaderOp2EXT(op, res, arg1, arg2);}
+void __stdcall _Lazy_glShaderOp3EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3)  {if (__GLeeLazyLink((void**)&pglShaderOp3EXT, "glShaderOp3EXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glShaderOp3EXT(op, res, arg1, arg2, arg3);}
+void __stdcall _Lazy_glSwizzleEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)  {if (__GLeeLazyLink((void**)&pglSwizzleEXT, "glSwizzleEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glSwizzleEXT(res, in, outX, outY, outZ, outW);}
+void __stdcall _Lazy_glWriteMaskEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)  {if (__GLeeLazyLink((void**)&pglWriteMaskEXT, "glWriteMaskEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glWriteMaskEXT(res, in, outX, outY, outZ, outW);}
+void __stdcall _Lazy_glInsertComponentEXT(GLuint res, GLuint src, GLuint num)             {if (__GLeeLazyLink((void**)&pglInsertComponentEXT, "glInsertComponentEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glInsertComponentEXT(res, src, num);}
+void __stdcall _Lazy_glExtractComponentEXT(GLuint res, GLuint src, GLuint num)            {if (__GLeeLazyLink((void**)&pglExtractComponentEXT, "glExtractComponentEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glExtractComponentEXT(res, src, num);}
+GLuint __stdcall _Lazy_glGenSymbolsEXT(GLenum datatype, GLenum storagetype, GLenum range, GLuint components)  {if (__GLeeLazyLink((void**)&pglGenSymbolsEXT, "glGenSymbolsEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glGenSymbolsEXT(datatype, storagetype, range, components); return (GLuint)0;}
+void __stdcall _Lazy_glSetInvariantEXT(GLuint id, GLenum type, const GLvoid * addr)       {if (__GLeeLazyLink((void**)&pglSetInvariantEXT, "glSetInvariantEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glSetInvariantEXT(id, type, addr);}
+void __stdcall _Lazy_glSetLocalConstantEXT(GLuint id, GLenum type, const GLvoid * addr)   {if (__GLeeLazyLink((void**)&pglSetLocalConstantEXT, "glSetLocalConstantEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glSetLocalConstantEXT(id, type, addr);}
+void __stdcall _Lazy_glVariantbvEXT(GLuint id, const GLbyte * addr)                       {if (__GLeeLazyLink((void**)&pglVariantbvEXT, "glVariantbvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantbvEXT(id, addr);}
+void __stdcall _Lazy_glVariantsvEXT(GLuint id, const GLshort * addr)                      {if (__GLeeLazyLink((void**)&pglVariantsvEXT, "glVariantsvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantsvEXT(id, addr);}
+void __stdcall _Lazy_glVariantivEXT(GLuint id, const GLint * addr)                        {if (__GLeeLazyLink((void**)&pglVariantivEXT, "glVariantivEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantivEXT(id, addr);}
+void __stdcall _Lazy_glVariantfvEXT(GLuint id, const GLfloat * addr)                      {if (__GLeeLazyLink((void**)&pglVariantfvEXT, "glVariantfvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantfvEXT(id, addr);}
+void __stdcall _Lazy_glVariantdvEXT(GLuint id, const GLdouble * addr)                     {if (__GLeeLazyLink((void**)&pglVariantdvEXT, "glVariantdvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantdvEXT(id, addr);}
+void __stdcall _Lazy_glVariantubvEXT(GLuint id, const GLubyte * addr)                     {if (__GLeeLazyLink((void**)&pglVariantubvEXT, "glVariantubvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantubvEXT(id, addr);}
+void __stdcall _Lazy_glVariantusvEXT(GLuint id, const GLushort * addr)                    {if (__GLeeLazyLink((void**)&pglVariantusvEXT, "glVariantusvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantusvEXT(id, addr);}
+void __stdcall _Lazy_glVariantuivEXT(GLuint id, const GLuint * addr)                      {if (__GLeeLazyLink((void**)&pglVariantuivEXT, "glVariantuivEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantuivEXT(id, addr);}
+void __stdcall _Lazy_glVariantPointerEXT(GLuint id, GLenum type, GLuint stride, const GLvoid * addr)  {if (__GLeeLazyLink((void**)&pglVariantPointerEXT, "glVariantPointerEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glVariantPointerEXT(id, type, stride, addr);}
+void __stdcall _Lazy_glEnableVariantClientStateEXT(GLuint id)                             {if (__GLeeLazyLink((void**)&pglEnableVariantClientStateEXT, "glEnableVariantClientStateEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glEnableVariantClientStateEXT(id);}
+void __stdcall _Lazy_glDisableVariantClientStateEXT(GLuint id)                            {if (__GLeeLazyLink((void**)&pglDisableVariantClientStateEXT, "glDisableVariantClientStateEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glDisableVariantClientStateEXT(id);}
+GLuint __stdcall _Lazy_glBindLightParameterEXT(GLenum light, GLenum value)                {if (__GLeeLazyLink((void**)&pglBindLightParameterEXT, "glBindLightParameterEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glBindLightParameterEXT(light, value); return (GLuint)0;}
+GLuint __stdcall _Lazy_glBindMaterialParameterEXT(GLenum face, GLenum value)              {if (__GLeeLazyLink((void**)&pglBindMaterialParameterEXT, "glBindMaterialParameterEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glBindMaterialParameterEXT(face, value); return (GLuint)0;}
+GLuint __stdcall _Lazy_glBindTexGenParameterEXT(GLenum unit, GLenum coord, GLenum value)  {if (__GLeeLazyLink((void**)&pglBindTexGenParameterEXT, "glBindTexGenParameterEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glBindTexGenParameterEXT(unit, coord, value); return (GLuint)0;}
+GLuint __stdcall _Lazy_glBindTextureUnitParameterEXT(GLenum unit, GLenum value)           {if (__GLeeLazyLink((void**)&pglBindTextureUnitParameterEXT, "glBindTextureUnitParameterEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glBindTextureUnitParameterEXT(unit, value); return (GLuint)0;}
+GLuint __stdcall _Lazy_glBindParameterEXT(GLenum value)                                   {if (__GLeeLazyLink((void**)&pglBindParameterEXT, "glBindParameterEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glBindParameterEXT(value); return (GLuint)0;}
+GLboolean __stdcall _Lazy_glIsVariantEnabledEXT(GLuint id, GLenum cap)                    {if (__GLeeLazyLink((void**)&pglIsVariantEnabledEXT, "glIsVariantEnabledEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) return glIsVariantEnabledEXT(id, cap); return (GLboolean)0;}
+void __stdcall _Lazy_glGetVariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)   {if (__GLeeLazyLink((void**)&pglGetVariantBooleanvEXT, "glGetVariantBooleanvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetVariantBooleanvEXT(id, value, data);}
+void __stdcall _Lazy_glGetVariantIntegervEXT(GLuint id, GLenum value, GLint * data)       {if (__GLeeLazyLink((void**)&pglGetVariantIntegervEXT, "glGetVariantIntegervEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetVariantIntegervEXT(id, value, data);}
+void __stdcall _Lazy_glGetVariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)       {if (__GLeeLazyLink((void**)&pglGetVariantFloatvEXT, "glGetVariantFloatvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetVariantFloatvEXT(id, value, data);}
+void __stdcall _Lazy_glGetVariantPointervEXT(GLuint id, GLenum value, GLvoid* * data)     {if (__GLeeLazyLink((void**)&pglGetVariantPointervEXT, "glGetVariantPointervEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetVariantPointervEXT(id, value, data);}
+void __stdcall _Lazy_glGetInvariantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)  {if (__GLeeLazyLink((void**)&pglGetInvariantBooleanvEXT, "glGetInvariantBooleanvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetInvariantBooleanvEXT(id, value, data);}
+void __stdcall _Lazy_glGetInvariantIntegervEXT(GLuint id, GLenum value, GLint * data)     {if (__GLeeLazyLink((void**)&pglGetInvariantIntegervEXT, "glGetInvariantIntegervEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetInvariantIntegervEXT(id, value, data);}
+void __stdcall _Lazy_glGetInvariantFloatvEXT(GLuint id, GLenum value, GLfloat * data)     {if (__GLeeLazyLink((void**)&pglGetInvariantFloatvEXT, "glGetInvariantFloatvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetInvariantFloatvEXT(id, value, data);}
+void __stdcall _Lazy_glGetLocalConstantBooleanvEXT(GLuint id, GLenum value, GLboolean * data)  {if (__GLeeLazyLink((void**)&pglGetLocalConstantBooleanvEXT, "glGetLocalConstantBooleanvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetLocalConstantBooleanvEXT(id, value, data);}
+void __stdcall _Lazy_glGetLocalConstantIntegervEXT(GLuint id, GLenum value, GLint * data)  {if (__GLeeLazyLink((void**)&pglGetLocalConstantIntegervEXT, "glGetLocalConstantIntegervEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetLocalConstantIntegervEXT(id, value, data);}
+void __stdcall _Lazy_glGetLocalConstantFloatvEXT(GLuint id, GLenum value, GLfloat * data)  {if (__GLeeLazyLink((void**)&pglGetLocalConstantFloatvEXT, "glGetLocalConstantFloatvEXT", &_GLEE_EXT_vertex_shader, "GL_EXT_vertex_shader")) glGetLocalConstantFloatvEXT(id, value, data);}
 PFNGLBEGINVERTEXSHADEREXTPROC pglBeginVertexShaderEXT=_Lazy_glBeginVertexShaderEXT;
 PFNGLENDVERTEXSHADEREXTPROC pglEndVertexShaderEXT=_Lazy_glEndVertexShaderEXT;
 PFNGLBINDVERTEXSHADEREXTPROC pglBindVertexShaderEXT=_Lazy_glBindVertexShaderEXT;
@@ -3515,51 +3547,51 @@ PFNGLGETLOCALCONSTANTFLOATVEXTPROC pglGetLocalConstantFloatvEXT=_Lazy_glGetLocal
 //GL_ATI_vertex_streams
 
 #ifdef __GLEE_GL_ATI_vertex_streams
-void __stdcall _Lazy_glVertexStream1sATI(GLenum stream, GLshort x)                        {if (GLeeInit()) glVertexStream1sATI(stream, x);}
-void __stdcall _Lazy_glVertexStream1svATI(GLenum stream, const GLshort * coords)          {if (GLeeInit()) glVertexStream1svATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream1iATI(GLenum stream, GLint x)                          {if (GLeeInit()) glVertexStream1iATI(stream, x);}
-void __stdcall _Lazy_glVertexStream1ivATI(GLenum stream, const GLint * coords)            {if (GLeeInit()) glVertexStream1ivATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream1fATI(GLenum stream, GLfloat x)                        {if (GLeeInit()) glVertexStream1fATI(stream, x);}
-void __stdcall _Lazy_glVertexStream1fvATI(GLenum stream, const GLfloat * coords)          {if (GLeeInit()) glVertexStream1fvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream1dATI(GLenum stream, GLdouble x)                       {if (GLeeInit()) glVertexStream1dATI(stream, x);}
-void __stdcall _Lazy_glVertexStream1dvATI(GLenum stream, const GLdouble * coords)         {if (GLeeInit()) glVertexStream1dvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream2sATI(GLenum stream, GLshort x, GLshort y)             {if (GLeeInit()) glVertexStream2sATI(stream, x, y);}
-void __stdcall _Lazy_glVertexStream2svATI(GLenum stream, const GLshort * coords)          {if (GLeeInit()) glVertexStream2svATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream2iATI(GLenum stream, GLint x, GLint y)                 {if (GLeeInit()) glVertexStream2iATI(stream, x, y);}
-void __stdcall _Lazy_glVertexStream2ivATI(GLenum stream, const GLint * coords)            {if (GLeeInit()) glVertexStream2ivATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream2fATI(GLenum stream, GLfloat x, GLfloat y)             {if (GLeeInit()) glVertexStream2fATI(stream, x, y);}
-void __stdcall _Lazy_glVertexStream2fvATI(GLenum stream, const GLfloat * coords)          {if (GLeeInit()) glVertexStream2fvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream2dATI(GLenum stream, GLdouble x, GLdouble y)           {if (GLeeInit()) glVertexStream2dATI(stream, x, y);}
-void __stdcall _Lazy_glVertexStream2dvATI(GLenum stream, const GLdouble * coords)         {if (GLeeInit()) glVertexStream2dvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream3sATI(GLenum stream, GLshort x, GLshort y, GLshort z)  {if (GLeeInit()) glVertexStream3sATI(stream, x, y, z);}
-void __stdcall _Lazy_glVertexStream3svATI(GLenum stream, const GLshort * coords)          {if (GLeeInit()) glVertexStream3svATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream3iATI(GLenum stream, GLint x, GLint y, GLint z)        {if (GLeeInit()) glVertexStream3iATI(stream, x, y, z);}
-void __stdcall _Lazy_glVertexStream3ivATI(GLenum stream, const GLint * coords)            {if (GLeeInit()) glVertexStream3ivATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream3fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z)  {if (GLeeInit()) glVertexStream3fATI(stream, x, y, z);}
-void __stdcall _Lazy_glVertexStream3fvATI(GLenum stream, const GLfloat * coords)          {if (GLeeInit()) glVertexStream3fvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream3dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z)  {if (GLeeInit()) glVertexStream3dATI(stream, x, y, z);}
-void __stdcall _Lazy_glVertexStream3dvATI(GLenum stream, const GLdouble * coords)         {if (GLeeInit()) glVertexStream3dvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream4sATI(GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w)  {if (GLeeInit()) glVertexStream4sATI(stream, x, y, z, w);}
-void __stdcall _Lazy_glVertexStream4svATI(GLenum stream, const GLshort * coords)          {if (GLeeInit()) glVertexStream4svATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream4iATI(GLenum stream, GLint x, GLint y, GLint z, GLint w)  {if (GLeeInit()) glVertexStream4iATI(stream, x, y, z, w);}
-void __stdcall _Lazy_glVertexStream4ivATI(GLenum stream, const GLint * coords)            {if (GLeeInit()) glVertexStream4ivATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream4fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glVertexStream4fATI(stream, x, y, z, w);}
-void __stdcall _Lazy_glVertexStream4fvATI(GLenum stream, const GLfloat * coords)          {if (GLeeInit()) glVertexStream4fvATI(stream, coords);}
-void __stdcall _Lazy_glVertexStream4dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glVertexStream4dATI(stream, x, y, z, w);}
-void __stdcall _Lazy_glVertexStream4dvATI(GLenum stream, const GLdouble * coords)         {if (GLeeInit()) glVertexStream4dvATI(stream, coords);}
-void __stdcall _Lazy_glNormalStream3bATI(GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz)  {if (GLeeInit()) glNormalStream3bATI(stream, nx, ny, nz);}
-void __stdcall _Lazy_glNormalStream3bvATI(GLenum stream, const GLbyte * coords)           {if (GLeeInit()) glNormalStream3bvATI(stream, coords);}
-void __stdcall _Lazy_glNormalStream3sATI(GLenum stream, GLshort nx, GLshort ny, GLshort nz)  {if (GLeeInit()) glNormalStream3sATI(stream, nx, ny, nz);}
-void __stdcall _Lazy_glNormalStream3svATI(GLenum stream, const GLshort * coords)          {if (GLeeInit()) glNormalStream3svATI(stream, coords);}
-void __stdcall _Lazy_glNormalStream3iATI(GLenum stream, GLint nx, GLint ny, GLint nz)     {if (GLeeInit()) glNormalStream3iATI(stream, nx, ny, nz);}
-void __stdcall _Lazy_glNormalStream3ivATI(GLenum stream, const GLint * coords)            {if (GLeeInit()) glNormalStream3ivATI(stream, coords);}
-void __stdcall _Lazy_glNormalStream3fATI(GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz)  {if (GLeeInit()) glNormalStream3fATI(stream, nx, ny, nz);}
-void __stdcall _Lazy_glNormalStream3fvATI(GLenum stream, const GLfloat * coords)          {if (GLeeInit()) glNormalStream3fvATI(stream, coords);}
-void __stdcall _Lazy_glNormalStream3dATI(GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz)  {if (GLeeInit()) glNormalStream3dATI(stream, nx, ny, nz);}
-void __stdcall _Lazy_glNormalStream3dvATI(GLenum stream, const GLdouble * coords)         {if (GLeeInit()) glNormalStream3dvATI(stream, coords);}
-void __stdcall _Lazy_glClientActiveVertexStreamATI(GLenum stream)                         {if (GLeeInit()) glClientActiveVertexStreamATI(stream);}
-void __stdcall _Lazy_glVertexBlendEnviATI(GLenum pname, GLint param)                      {if (GLeeInit()) glVertexBlendEnviATI(pname, param);}
-void __stdcall _Lazy_glVertexBlendEnvfATI(GLenum pname, GLfloat param)                    {if (GLeeInit()) glVertexBlendEnvfATI(pname, param);}
+void __stdcall _Lazy_glVertexStream1sATI(GLenum stream, GLshort x)                        {if (__GLeeLazyLink((void**)&pglVertexStream1sATI, "glVertexStream1sATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1sATI(stream, x);}
+void __stdcall _Lazy_glVertexStream1svATI(GLenum stream, const GLshort * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream1svATI, "glVertexStream1svATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1svATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream1iATI(GLenum stream, GLint x)                          {if (__GLeeLazyLink((void**)&pglVertexStream1iATI, "glVertexStream1iATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1iATI(stream, x);}
+void __stdcall _Lazy_glVertexStream1ivATI(GLenum stream, const GLint * coords)            {if (__GLeeLazyLink((void**)&pglVertexStream1ivATI, "glVertexStream1ivATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1ivATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream1fATI(GLenum stream, GLfloat x)                        {if (__GLeeLazyLink((void**)&pglVertexStream1fATI, "glVertexStream1fATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1fATI(stream, x);}
+void __stdcall _Lazy_glVertexStream1fvATI(GLenum stream, const GLfloat * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream1fvATI, "glVertexStream1fvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1fvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream1dATI(GLenum stream, GLdouble x)                       {if (__GLeeLazyLink((void**)&pglVertexStream1dATI, "glVertexStream1dATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1dATI(stream, x);}
+void __stdcall _Lazy_glVertexStream1dvATI(GLenum stream, const GLdouble * coords)         {if (__GLeeLazyLink((void**)&pglVertexStream1dvATI, "glVertexStream1dvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream1dvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream2sATI(GLenum stream, GLshort x, GLshort y)             {if (__GLeeLazyLink((void**)&pglVertexStream2sATI, "glVertexStream2sATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2sATI(stream, x, y);}
+void __stdcall _Lazy_glVertexStream2svATI(GLenum stream, const GLshort * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream2svATI, "glVertexStream2svATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2svATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream2iATI(GLenum stream, GLint x, GLint y)                 {if (__GLeeLazyLink((void**)&pglVertexStream2iATI, "glVertexStream2iATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2iATI(stream, x, y);}
+void __stdcall _Lazy_glVertexStream2ivATI(GLenum stream, const GLint * coords)            {if (__GLeeLazyLink((void**)&pglVertexStream2ivATI, "glVertexStream2ivATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2ivATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream2fATI(GLenum stream, GLfloat x, GLfloat y)             {if (__GLeeLazyLink((void**)&pglVertexStream2fATI, "glVertexStream2fATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2fATI(stream, x, y);}
+void __stdcall _Lazy_glVertexStream2fvATI(GLenum stream, const GLfloat * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream2fvATI, "glVertexStream2fvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2fvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream2dATI(GLenum stream, GLdouble x, GLdouble y)           {if (__GLeeLazyLink((void**)&pglVertexStream2dATI, "glVertexStream2dATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2dATI(stream, x, y);}
+void __stdcall _Lazy_glVertexStream2dvATI(GLenum stream, const GLdouble * coords)         {if (__GLeeLazyLink((void**)&pglVertexStream2dvATI, "glVertexStream2dvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream2dvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream3sATI(GLenum stream, GLshort x, GLshort y, GLshort z)  {if (__GLeeLazyLink((void**)&pglVertexStream3sATI, "glVertexStream3sATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3sATI(stream, x, y, z);}
+void __stdcall _Lazy_glVertexStream3svATI(GLenum stream, const GLshort * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream3svATI, "glVertexStream3svATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3svATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream3iATI(GLenum stream, GLint x, GLint y, GLint z)        {if (__GLeeLazyLink((void**)&pglVertexStream3iATI, "glVertexStream3iATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3iATI(stream, x, y, z);}
+void __stdcall _Lazy_glVertexStream3ivATI(GLenum stream, const GLint * coords)            {if (__GLeeLazyLink((void**)&pglVertexStream3ivATI, "glVertexStream3ivATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3ivATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream3fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z)  {if (__GLeeLazyLink((void**)&pglVertexStream3fATI, "glVertexStream3fATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3fATI(stream, x, y, z);}
+void __stdcall _Lazy_glVertexStream3fvATI(GLenum stream, const GLfloat * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream3fvATI, "glVertexStream3fvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3fvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream3dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z)  {if (__GLeeLazyLink((void**)&pglVertexStream3dATI, "glVertexStream3dATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3dATI(stream, x, y, z);}
+void __stdcall _Lazy_glVertexStream3dvATI(GLenum stream, const GLdouble * coords)         {if (__GLeeLazyLink((void**)&pglVertexStream3dvATI, "glVertexStream3dvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream3dvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream4sATI(GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w)  {if (__GLeeLazyLink((void**)&pglVertexStream4sATI, "glVertexStream4sATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4sATI(stream, x, y, z, w);}
+void __stdcall _Lazy_glVertexStream4svATI(GLenum stream, const GLshort * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream4svATI, "glVertexStream4svATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4svATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream4iATI(GLenum stream, GLint x, GLint y, GLint z, GLint w)  {if (__GLeeLazyLink((void**)&pglVertexStream4iATI, "glVertexStream4iATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4iATI(stream, x, y, z, w);}
+void __stdcall _Lazy_glVertexStream4ivATI(GLenum stream, const GLint * coords)            {if (__GLeeLazyLink((void**)&pglVertexStream4ivATI, "glVertexStream4ivATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4ivATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream4fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglVertexStream4fATI, "glVertexStream4fATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4fATI(stream, x, y, z, w);}
+void __stdcall _Lazy_glVertexStream4fvATI(GLenum stream, const GLfloat * coords)          {if (__GLeeLazyLink((void**)&pglVertexStream4fvATI, "glVertexStream4fvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4fvATI(stream, coords);}
+void __stdcall _Lazy_glVertexStream4dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglVertexStream4dATI, "glVertexStream4dATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4dATI(stream, x, y, z, w);}
+void __stdcall _Lazy_glVertexStream4dvATI(GLenum stream, const GLdouble * coords)         {if (__GLeeLazyLink((void**)&pglVertexStream4dvATI, "glVertexStream4dvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexStream4dvATI(stream, coords);}
+void __stdcall _Lazy_glNormalStream3bATI(GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz)  {if (__GLeeLazyLink((void**)&pglNormalStream3bATI, "glNormalStream3bATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3bATI(stream, nx, ny, nz);}
+void __stdcall _Lazy_glNormalStream3bvATI(GLenum stream, const GLbyte * coords)           {if (__GLeeLazyLink((void**)&pglNormalStream3bvATI, "glNormalStream3bvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3bvATI(stream, coords);}
+void __stdcall _Lazy_glNormalStream3sATI(GLenum stream, GLshort nx, GLshort ny, GLshort nz)  {if (__GLeeLazyLink((void**)&pglNormalStream3sATI, "glNormalStream3sATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3sATI(stream, nx, ny, nz);}
+void __stdcall _Lazy_glNormalStream3svATI(GLenum stream, const GLshort * coords)          {if (__GLeeLazyLink((void**)&pglNormalStream3svATI, "glNormalStream3svATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3svATI(stream, coords);}
+void __stdcall _Lazy_glNormalStream3iATI(GLenum stream, GLint nx, GLint ny, GLint nz)     {if (__GLeeLazyLink((void**)&pglNormalStream3iATI, "glNormalStream3iATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3iATI(stream, nx, ny, nz);}
+void __stdcall _Lazy_glNormalStream3ivATI(GLenum stream, const GLint * coords)            {if (__GLeeLazyLink((void**)&pglNormalStream3ivATI, "glNormalStream3ivATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3ivATI(stream, coords);}
+void __stdcall _Lazy_glNormalStream3fATI(GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz)  {if (__GLeeLazyLink((void**)&pglNormalStream3fATI, "glNormalStream3fATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3fATI(stream, nx, ny, nz);}
+void __stdcall _Lazy_glNormalStream3fvATI(GLenum stream, const GLfloat * coords)          {if (__GLeeLazyLink((void**)&pglNormalStream3fvATI, "glNormalStream3fvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3fvATI(stream, coords);}
+void __stdcall _Lazy_glNormalStream3dATI(GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz)  {if (__GLeeLazyLink((void**)&pglNormalStream3dATI, "glNormalStream3dATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3dATI(stream, nx, ny, nz);}
+void __stdcall _Lazy_glNormalStream3dvATI(GLenum stream, const GLdouble * coords)         {if (__GLeeLazyLink((void**)&pglNormalStream3dvATI, "glNormalStream3dvATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glNormalStream3dvATI(stream, coords);}
+void __stdcall _Lazy_glClientActiveVertexStreamATI(GLenum stream)                         {if (__GLeeLazyLink((void**)&pglClientActiveVertexStreamATI, "glClientActiveVertexStreamATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glClientActiveVertexStreamATI(stream);}
+void __stdcall _Lazy_glVertexBlendEnviATI(GLenum pname, GLint param)                      {if (__GLeeLazyLink((void**)&pglVertexBlendEnviATI, "glVertexBlendEnviATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexBlendEnviATI(pname, param);}
+void __stdcall _Lazy_glVertexBlendEnvfATI(GLenum pname, GLfloat param)                    {if (__GLeeLazyLink((void**)&pglVertexBlendEnvfATI, "glVertexBlendEnvfATI", &_GLEE_ATI_vertex_streams, "GL_ATI_vertex_streams")) glVertexBlendEnvfATI(pname, param);}
 PFNGLVERTEXSTREAM1SATIPROC pglVertexStream1sATI=_Lazy_glVertexStream1sATI;
 PFNGLVERTEXSTREAM1SVATIPROC pglVertexStream1svATI=_Lazy_glVertexStream1svATI;
 PFNGLVERTEXSTREAM1IATIPROC pglVertexStream1iATI=_Lazy_glVertexStream1iATI;
@@ -3610,9 +3642,9 @@ PFNGLVERTEXBLENDENVFATIPROC pglVertexBlendEnvfATI=_Lazy_glVertexBlendEnvfATI;
 //GL_ATI_element_array
 
 #ifdef __GLEE_GL_ATI_element_array
-void __stdcall _Lazy_glElementPointerATI(GLenum type, const GLvoid * pointer)             {if (GLeeInit()) glElementPointerATI(type, pointer);}
-void __stdcall _Lazy_glDrawElementArrayATI(GLenum mode, GLsizei count)                    {if (GLeeInit()) glDrawElementArrayATI(mode, count);}
-void __stdcall _Lazy_glDrawRangeElementArrayATI(GLenum mode, GLuint start, GLuint end, GLsizei count)  {if (GLeeInit()) glDrawRangeElementArrayATI(mode, start, end, count);}
+void __stdcall _Lazy_glElementPointerATI(GLenum type, const GLvoid * pointer)             {if (__GLeeLazyLink((void**)&pglElementPointerATI, "glElementPointerATI", &_GLEE_ATI_element_array, "GL_ATI_element_array")) glElementPointerATI(type, pointer);}
+void __stdcall _Lazy_glDrawElementArrayATI(GLenum mode, GLsizei count)                    {if (__GLeeLazyLink((void**)&pglDrawElementArrayATI, "glDrawElementArrayATI", &_GLEE_ATI_element_array, "GL_ATI_element_array")) glDrawElementArrayATI(mode, count);}
+void __stdcall _Lazy_glDrawRangeElementArrayATI(GLenum mode, GLuint start, GLuint end, GLsizei count)  {if (__GLeeLazyLink((void**)&pglDrawRangeElementArrayATI, "glDrawRangeElementArrayATI", &_GLEE_ATI_element_array, "GL_ATI_element_array")) glDrawRangeElementArrayATI(mode, start, end, count);}
 PFNGLELEMENTPOINTERATIPROC pglElementPointerATI=_Lazy_glElementPointerATI;
 PFNGLDRAWELEMENTARRAYATIPROC pglDrawElementArrayATI=_Lazy_glDrawElementArrayATI;
 PFNGLDRAWRANGEELEMENTARRAYATIPROC pglDrawRangeElementArrayATI=_Lazy_glDrawRangeElementArrayATI;
@@ -3621,7 +3653,7 @@ PFNGLDRAWRANGEELEMENTARRAYATIPROC pglDrawRangeElementArrayATI=_Lazy_glDrawRangeE
 //GL_SUN_mesh_array
 
 #ifdef __GLEE_GL_SUN_mesh_array
-void __stdcall _Lazy_glDrawMeshArraysSUN(GLenum mode, GLint first, GLsizei count, GLsizei width)  {if (GLeeInit()) glDrawMeshArraysSUN(mode, first, count, width);}
+void __stdcall _Lazy_glDrawMeshArraysSUN(GLenum mode, GLint first, GLsizei count, GLsizei width)  {if (__GLeeLazyLink((void**)&pglDrawMeshArraysSUN, "glDrawMeshArraysSUN", &_GLEE_SUN_mesh_array, "GL_SUN_mesh_array")) glDrawMeshArraysSUN(mode, first, count, width);}
 PFNGLDRAWMESHARRAYSSUNPROC pglDrawMeshArraysSUN=_Lazy_glDrawMeshArraysSUN;
 #endif 
 
@@ -3643,13 +3675,13 @@ PFNGLDRAWMESHARRAYSSUNPROC pglDrawMeshArraysSUN=_Lazy_glDrawMeshArraysSUN;
 //GL_NV_occlusion_query
 
 #ifdef __GLEE_GL_NV_occlusion_query
-void __stdcall _Lazy_glGenOcclusionQueriesNV(GLsizei n, GLuint * ids)                     {if (GLeeInit()) glGenOcclusionQueriesNV(n, ids);}
-void __stdcall _Lazy_glDeleteOcclusionQueriesNV(GLsizei n, const GLuint * ids)            {if (GLeeInit()) glDeleteOcclusionQueriesNV(n, ids);}
-GLboolean __stdcall _Lazy_glIsOcclusionQueryNV(GLuint id)                                 {if (GLeeInit()) return glIsOcclusionQueryNV(id); return (GLboolean)0;}
-void __stdcall _Lazy_glBeginOcclusionQueryNV(GLuint id)                                   {if (GLeeInit()) glBeginOcclusionQueryNV(id);}
-void __stdcall _Lazy_glEndOcclusionQueryNV(void)                                          {if (GLeeInit()) glEndOcclusionQueryNV();}
-void __stdcall _Lazy_glGetOcclusionQueryivNV(GLuint id, GLenum pname, GLint * params)     {if (GLeeInit()) glGetOcclusionQueryivNV(id, pname, params);}
-void __stdcall _Lazy_glGetOcclusionQueryuivNV(GLuint id, GLenum pname, GLuint * params)   {if (GLeeInit()) glGetOcclusionQueryuivNV(id, pname, params);}
+void __stdcall _Lazy_glGenOcclusionQueriesNV(GLsizei n, GLuint * ids)                     {if (__GLeeLazyLink((void**)&pglGenOcclusionQueriesNV, "glGenOcclusionQueriesNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glGenOcclusionQueriesNV(n, ids);}
+void __stdcall _Lazy_glDeleteOcclusionQueriesNV(GLsizei n, const GLuint * ids)            {if (__GLeeLazyLink((void**)&pglDeleteOcclusionQueriesNV, "glDeleteOcclusionQueriesNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glDeleteOcclusionQueriesNV(n, ids);}
+GLboolean __stdcall _Lazy_glIsOcclusionQueryNV(GLuint id)                                 {if (__GLeeLazyLink((void**)&pglIsOcclusionQueryNV, "glIsOcclusionQueryNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) return glIsOcclusionQueryNV(id); return (GLboolean)0;}
+void __stdcall _Lazy_glBeginOcclusionQueryNV(GLuint id)                                   {if (__GLeeLazyLink((void**)&pglBeginOcclusionQueryNV, "glBeginOcclusionQueryNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glBeginOcclusionQueryNV(id);}
+void __stdcall _Lazy_glEndOcclusionQueryNV(void)                                          {if (__GLeeLazyLink((void**)&pglEndOcclusionQueryNV, "glEndOcclusionQueryNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glEndOcclusionQueryNV();}
+void __stdcall _Lazy_glGetOcclusionQueryivNV(GLuint id, GLenum pname, GLint * params)     {if (__GLeeLazyLink((void**)&pglGetOcclusionQueryivNV, "glGetOcclusionQueryivNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glGetOcclusionQueryivNV(id, pname, params);}
+void __stdcall _Lazy_glGetOcclusionQueryuivNV(GLuint id, GLenum pname, GLuint * params)   {if (__GLeeLazyLink((void**)&pglGetOcclusionQueryuivNV, "glGetOcclusionQueryuivNV", &_GLEE_NV_occlusion_query, "GL_NV_occlusion_query")) glGetOcclusionQueryuivNV(id, pname, params);}
 PFNGLGENOCCLUSIONQUERIESNVPROC pglGenOcclusionQueriesNV=_Lazy_glGenOcclusionQueriesNV;
 PFNGLDELETEOCCLUSIONQUERIESNVPROC pglDeleteOcclusionQueriesNV=_Lazy_glDeleteOcclusionQueriesNV;
 PFNGLISOCCLUSIONQUERYNVPROC pglIsOcclusionQueryNV=_Lazy_glIsOcclusionQueryNV;
@@ -3662,8 +3694,8 @@ PFNGLGETOCCLUSIONQUERYUIVNVPROC pglGetOcclusionQueryuivNV=_Lazy_glGetOcclusionQu
 //GL_NV_point_sprite
 
 #ifdef __GLEE_GL_NV_point_sprite
-void __stdcall _Lazy_glPointParameteriNV(GLenum pname, GLint param)                       {if (GLeeInit()) glPointParameteriNV(pname, param);}
-void __stdcall _Lazy_glPointParameterivNV(GLenum pname, const GLint * params)             {if (GLeeInit()) glPointParameterivNV(pname, params);}
+void __stdcall _Lazy_glPointParameteriNV(GLenum pname, GLint param)                       {if (__GLeeLazyLink((void**)&pglPointParameteriNV, "glPointParameteriNV", &_GLEE_NV_point_sprite, "GL_NV_point_sprite")) glPointParameteriNV(pname, param);}
+void __stdcall _Lazy_glPointParameterivNV(GLenum pname, const GLint * params)             {if (__GLeeLazyLink((void**)&pglPointParameterivNV, "glPointParameterivNV", &_GLEE_NV_point_sprite, "GL_NV_point_sprite")) glPointParameterivNV(pname, params);}
 PFNGLPOINTPARAMETERINVPROC pglPointParameteriNV=_Lazy_glPointParameteriNV;
 PFNGLPOINTPARAMETERIVNVPROC pglPointParameterivNV=_Lazy_glPointParameterivNV;
 #endif 
@@ -3686,7 +3718,7 @@ PFNGLPOINTPARAMETERIVNVPROC pglPointParameterivNV=_Lazy_glPointParameterivNV;
 //GL_EXT_stencil_two_side
 
 #ifdef __GLEE_GL_EXT_stencil_two_side
-void __stdcall _Lazy_glActiveStencilFaceEXT(GLenum face)                                  {if (GLeeInit()) glActiveStencilFaceEXT(face);}
+void __stdcall _Lazy_glActiveStencilFaceEXT(GLenum face)                                  {if (__GLeeLazyLink((void**)&pglActiveStencilFaceEXT, "glActiveStencilFaceEXT", &_GLEE_EXT_stencil_two_side, "GL_EXT_stencil_two_side")) glActiveStencilFaceEXT(face);}
 PFNGLACTIVESTENCILFACEEXTPROC pglActiveStencilFaceEXT=_Lazy_glActiveStencilFaceEXT;
 #endif 
 
@@ -3703,11 +3735,11 @@ PFNGLACTIVESTENCILFACEEXTPROC pglActiveStencilFaceEXT=_Lazy_glActiveStencilFaceE
 //GL_APPLE_element_array
 
 #ifdef __GLEE_GL_APPLE_element_array
-void __stdcall _Lazy_glElementPointerAPPLE(GLenum type, const GLvoid * pointer)           {if (GLeeInit()) glElementPointerAPPLE(type, pointer);}
-void __stdcall _Lazy_glDrawElementArrayAPPLE(GLenum mode, GLint first, GLsizei count)     {if (GLeeInit()) glDrawElementArrayAPPLE(mode, first, count);}
-void __stdcall _Lazy_glDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count)  {if (GLeeInit()) glDrawRangeElementArrayAPPLE(mode, start, end, first, count);}
-void __stdcall _Lazy_glMultiDrawElementArrayAPPLE(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount)  {if (GLeeInit()) glMultiDrawElementArrayAPPLE(mode, first, count, primcount);}
-void __stdcall _Lazy_glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, const GLint * first, const GLsizei * count, GLsizei primcount)  {if (GLeeInit()) glMultiDrawRangeElementArrayAPPLE(mode, start, end, first, count, primcount);}
+void __stdcall _Lazy_glElementPointerAPPLE(GLenum type, const GLvoid * pointer)           {if (__GLeeLazyLink((void**)&pglElementPointerAPPLE, "glElementPointerAPPLE", &_GLEE_APPLE_element_array, "GL_APPLE_element_array")) glElementPointerAPPLE(type, pointer);}
+void __stdcall _Lazy_glDrawElementArrayAPPLE(GLenum mode, GLint first, GLsizei count)     {if (__GLeeLazyLink((void**)&pglDrawElementArrayAPPLE, "glDrawElementArrayAPPLE", &_GLEE_APPLE_element_array, "GL_APPLE_element_array")) glDrawElementArrayAPPLE(mode, first, count);}
+void __stdcall _Lazy_glDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count)  {if (__GLeeLazyLink((void**)&pglDrawRangeElementArrayAPPLE, "glDrawRangeElementArrayAPPLE", &_GLEE_APPLE_element_array, "GL_APPLE_element_array")) glDrawRangeElementArrayAPPLE(mode, start, end, first, count);}
+void __stdcall _Lazy_glMultiDrawElementArrayAPPLE(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawElementArrayAPPLE, "glMultiDrawElementArrayAPPLE", &_GLEE_APPLE_element_array, "GL_APPLE_element_array")) glMultiDrawElementArrayAPPLE(mode, first, count, primcount);}
+void __stdcall _Lazy_glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, const GLint * first, const GLsizei * count, GLsizei primcount)  {if (__GLeeLazyLink((void**)&pglMultiDrawRangeElementArrayAPPLE, "glMultiDrawRangeElementArrayAPPLE", &_GLEE_APPLE_element_array, "GL_APPLE_element_array")) glMultiDrawRangeElementArrayAPPLE(mode, start, end, first, count, primcount);}
 PFNGLELEMENTPOINTERAPPLEPROC pglElementPointerAPPLE=_Lazy_glElementPointerAPPLE;
 PFNGLDRAWELEMENTARRAYAPPLEPROC pglDrawElementArrayAPPLE=_Lazy_glDrawElementArrayAPPLE;
 PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC pglDrawRangeElementArrayAPPLE=_Lazy_glDrawRangeElementArrayAPPLE;
@@ -3718,14 +3750,14 @@ PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC pglMultiDrawRangeElementArrayAPPLE=_Laz
 //GL_APPLE_fence
 
 #ifdef __GLEE_GL_APPLE_fence
-void __stdcall _Lazy_glGenFencesAPPLE(GLsizei n, GLuint * fences)                         {if (GLeeInit()) glGenFencesAPPLE(n, fences);}
-void __stdcall _Lazy_glDeleteFencesAPPLE(GLsizei n, const GLuint * fences)                {if (GLeeInit()) glDeleteFencesAPPLE(n, fences);}
-void __stdcall _Lazy_glSetFenceAPPLE(GLuint fence)                                        {if (GLeeInit()) glSetFenceAPPLE(fence);}
-GLboolean __stdcall _Lazy_glIsFenceAPPLE(GLuint fence)                                    {if (GLeeInit()) return glIsFenceAPPLE(fence); return (GLboolean)0;}
-GLboolean __stdcall _Lazy_glTestFenceAPPLE(GLuint fence)                                  {if (GLeeInit()) return glTestFenceAPPLE(fence); return (GLboolean)0;}
-void __stdcall _Lazy_glFinishFenceAPPLE(GLuint fence)                                     {if (GLeeInit()) glFinishFenceAPPLE(fence);}
-GLboolean __stdcall _Lazy_glTestObjectAPPLE(GLenum object, GLuint name)                   {if (GLeeInit()) return glTestObjectAPPLE(object, name); return (GLboolean)0;}
-void __stdcall _Lazy_glFinishObjectAPPLE(GLenum object, GLint name)                       {if (GLeeInit()) glFinishObjectAPPLE(object, name);}
+void __stdcall _Lazy_glGenFencesAPPLE(GLsizei n, GLuint * fences)                         {if (__GLeeLazyLink((void**)&pglGenFencesAPPLE, "glGenFencesAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) glGenFencesAPPLE(n, fences);}
+void __stdcall _Lazy_glDeleteFencesAPPLE(GLsizei n, const GLuint * fences)                {if (__GLeeLazyLink((void**)&pglDeleteFencesAPPLE, "glDeleteFencesAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) glDeleteFencesAPPLE(n, fences);}
+void __stdcall _Lazy_glSetFenceAPPLE(GLuint fence)                                        {if (__GLeeLazyLink((void**)&pglSetFenceAPPLE, "glSetFenceAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) glSetFenceAPPLE(fence);}
+GLboolean __stdcall _Lazy_glIsFenceAPPLE(GLuint fence)                                    {if (__GLeeLazyLink((void**)&pglIsFenceAPPLE, "glIsFenceAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) return glIsFenceAPPLE(fence); return (GLboolean)0;}
+GLboolean __stdcall _Lazy_glTestFenceAPPLE(GLuint fence)                                  {if (__GLeeLazyLink((void**)&pglTestFenceAPPLE, "glTestFenceAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) return glTestFenceAPPLE(fence); return (GLboolean)0;}
+void __stdcall _Lazy_glFinishFenceAPPLE(GLuint fence)                                     {if (__GLeeLazyLink((void**)&pglFinishFenceAPPLE, "glFinishFenceAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) glFinishFenceAPPLE(fence);}
+GLboolean __stdcall _Lazy_glTestObjectAPPLE(GLenum object, GLuint name)                   {if (__GLeeLazyLink((void**)&pglTestObjectAPPLE, "glTestObjectAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) return glTestObjectAPPLE(object, name); return (GLboolean)0;}
+void __stdcall _Lazy_glFinishObjectAPPLE(GLenum object, GLint name)                       {if (__GLeeLazyLink((void**)&pglFinishObjectAPPLE, "glFinishObjectAPPLE", &_GLEE_APPLE_fence, "GL_APPLE_fence")) glFinishObjectAPPLE(object, name);}
 PFNGLGENFENCESAPPLEPROC pglGenFencesAPPLE=_Lazy_glGenFencesAPPLE;
 PFNGLDELETEFENCESAPPLEPROC pglDeleteFencesAPPLE=_Lazy_glDeleteFencesAPPLE;
 PFNGLSETFENCEAPPLEPROC pglSetFenceAPPLE=_Lazy_glSetFenceAPPLE;
@@ -3739,10 +3771,10 @@ PFNGLFINISHOBJECTAPPLEPROC pglFinishObjectAPPLE=_Lazy_glFinishObjectAPPLE;
 //GL_APPLE_vertex_array_object
 
 #ifdef __GLEE_GL_APPLE_vertex_array_object
-void __stdcall _Lazy_glBindVertexArrayAPPLE(GLuint array)                                 {if (GLeeInit()) glBindVertexArrayAPPLE(array);}
-void __stdcall _Lazy_glDeleteVertexArraysAPPLE(GLsizei n, const GLuint * arrays)          {if (GLeeInit()) glDeleteVertexArraysAPPLE(n, arrays);}
-void __stdcall _Lazy_glGenVertexArraysAPPLE(GLsizei n, const GLuint * arrays)             {if (GLeeInit()) glGenVertexArraysAPPLE(n, arrays);}
-GLboolean __stdcall _Lazy_glIsVertexArrayAPPLE(GLuint array)                              {if (GLeeInit()) return glIsVertexArrayAPPLE(array); return (GLboolean)0;}
+void __stdcall _Lazy_glBindVertexArrayAPPLE(GLuint array)                                 {if (__GLeeLazyLink((void**)&pglBindVertexArrayAPPLE, "glBindVertexArrayAPPLE", &_GLEE_APPLE_vertex_array_object, "GL_APPLE_vertex_array_object")) glBindVertexArrayAPPLE(array);}
+void __stdcall _Lazy_glDeleteVertexArraysAPPLE(GLsizei n, const GLuint * arrays)          {if (__GLeeLazyLink((void**)&pglDeleteVertexArraysAPPLE, "glDeleteVertexArraysAPPLE", &_GLEE_APPLE_vertex_array_object, "GL_APPLE_vertex_array_object")) glDeleteVertexArraysAPPLE(n, arrays);}
+void __stdcall _Lazy_glGenVertexArraysAPPLE(GLsizei n, const GLuint * arrays)             {if (__GLeeLazyLink((void**)&pglGenVertexArraysAPPLE, "glGenVertexArraysAPPLE", &_GLEE_APPLE_vertex_array_object, "GL_APPLE_vertex_array_object")) glGenVertexArraysAPPLE(n, arrays);}
+GLboolean __stdcall _Lazy_glIsVertexArrayAPPLE(GLuint array)                              {if (__GLeeLazyLink((void**)&pglIsVertexArrayAPPLE, "glIsVertexArrayAPPLE", &_GLEE_APPLE_vertex_array_object, "GL_APPLE_vertex_array_object")) return glIsVertexArrayAPPLE(array); return (GLboolean)0;}
 PFNGLBINDVERTEXARRAYAPPLEPROC pglBindVertexArrayAPPLE=_Lazy_glBindVertexArrayAPPLE;
 PFNGLDELETEVERTEXARRAYSAPPLEPROC pglDeleteVertexArraysAPPLE=_Lazy_glDeleteVertexArraysAPPLE;
 PFNGLGENVERTEXARRAYSAPPLEPROC pglGenVertexArraysAPPLE=_Lazy_glGenVertexArraysAPPLE;
@@ -3752,9 +3784,9 @@ PFNGLISVERTEXARRAYAPPLEPROC pglIsVertexArrayAPPLE=_Lazy_glIsVertexArrayAPPLE;
 //GL_APPLE_vertex_array_range
 
 #ifdef __GLEE_GL_APPLE_vertex_array_range
-void __stdcall _Lazy_glVertexArrayRangeAPPLE(GLsizei length, GLvoid * pointer)            {if (GLeeInit()) glVertexArrayRangeAPPLE(length, pointer);}
-void __stdcall _Lazy_glFlushVertexArrayRangeAPPLE(GLsizei length, GLvoid * pointer)       {if (GLeeInit()) glFlushVertexArrayRangeAPPLE(length, pointer);}
-void __stdcall _Lazy_glVertexArrayParameteriAPPLE(GLenum pname, GLint param)              {if (GLeeInit()) glVertexArrayParameteriAPPLE(pname, param);}
+void __stdcall _Lazy_glVertexArrayRangeAPPLE(GLsizei length, GLvoid * pointer)            {if (__GLeeLazyLink((void**)&pglVertexArrayRangeAPPLE, "glVertexArrayRangeAPPLE", &_GLEE_APPLE_vertex_array_range, "GL_APPLE_vertex_array_range")) glVertexArrayRangeAPPLE(length, pointer);}
+void __stdcall _Lazy_glFlushVertexArrayRangeAPPLE(GLsizei length, GLvoid * pointer)       {if (__GLeeLazyLink((void**)&pglFlushVertexArrayRangeAPPLE, "glFlushVertexArrayRangeAPPLE", &_GLEE_APPLE_vertex_array_range, "GL_APPLE_vertex_array_range")) glFlushVertexArrayRangeAPPLE(length, pointer);}
+void __stdcall _Lazy_glVertexArrayParameteriAPPLE(GLenum pname, GLint param)              {if (__GLeeLazyLink((void**)&pglVertexArrayParameteriAPPLE, "glVertexArrayParameteriAPPLE", &_GLEE_APPLE_vertex_array_range, "GL_APPLE_vertex_array_range")) glVertexArrayParameteriAPPLE(pname, param);}
 PFNGLVERTEXARRAYRANGEAPPLEPROC pglVertexArrayRangeAPPLE=_Lazy_glVertexArrayRangeAPPLE;
 PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC pglFlushVertexArrayRangeAPPLE=_Lazy_glFlushVertexArrayRangeAPPLE;
 PFNGLVERTEXARRAYPARAMETERIAPPLEPROC pglVertexArrayParameteriAPPLE=_Lazy_glVertexArrayParameteriAPPLE;
@@ -3773,7 +3805,7 @@ PFNGLVERTEXARRAYPARAMETERIAPPLEPROC pglVertexArrayParameteriAPPLE=_Lazy_glVertex
 //GL_ATI_draw_buffers
 
 #ifdef __GLEE_GL_ATI_draw_buffers
-void __stdcall _Lazy_glDrawBuffersATI(GLsizei n, const GLenum * bufs)                     {if (GLeeInit()) glDrawBuffersATI(n, bufs);}
+void __stdcall _Lazy_glDrawBuffersATI(GLsizei n, const GLenum * bufs)                     {if (__GLeeLazyLink((void**)&pglDrawBuffersATI, "glDrawBuffersATI", &_GLEE_ATI_draw_buffers, "GL_ATI_draw_buffers")) glDrawBuffersATI(n, bufs);}
 PFNGLDRAWBUFFERSATIPROC pglDrawBuffersATI=_Lazy_glDrawBuffersATI;
 #endif 
 
@@ -3800,12 +3832,12 @@ PFNGLDRAWBUFFERSATIPROC pglDrawBuffersATI=_Lazy_glDrawBuffersATI;
 //GL_NV_fragment_program
 
 #ifdef __GLEE_GL_NV_fragment_program
-void __stdcall _Lazy_glProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (GLeeInit()) glProgramNamedParameter4fNV(id, len, name, x, y, z, w);}
-void __stdcall _Lazy_glProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (GLeeInit()) glProgramNamedParameter4dNV(id, len, name, x, y, z, w);}
-void __stdcall _Lazy_glProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)  {if (GLeeInit()) glProgramNamedParameter4fvNV(id, len, name, v);}
-void __stdcall _Lazy_glProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)  {if (GLeeInit()) glProgramNamedParameter4dvNV(id, len, name, v);}
-void __stdcall _Lazy_glGetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)  {if (GLeeInit()) glGetProgramNamedParameterfvNV(id, len, name, params);}
-void __stdcall _Lazy_glGetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)  {if (GLeeInit()) glGetProgramNamedParameterdvNV(id, len, name, params);}
+void __stdcall _Lazy_glProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)  {if (__GLeeLazyLink((void**)&pglProgramNamedParameter4fNV, "glProgramNamedParameter4fNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glProgramNamedParameter4fNV(id, len, name, x, y, z, w);}
+void __stdcall _Lazy_glProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)  {if (__GLeeLazyLink((void**)&pglProgramNamedParameter4dNV, "glProgramNamedParameter4dNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glProgramNamedParameter4dNV(id, len, name, x, y, z, w);}
+void __stdcall _Lazy_glProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)  {if (__GLeeLazyLink((void**)&pglProgramNamedParameter4fvNV, "glProgramNamedParameter4fvNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glProgramNamedParameter4fvNV(id, len, name, v);}
+void __stdcall _Lazy_glProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)  {if (__GLeeLazyLink((void**)&pglProgramNamedParameter4dvNV, "glProgramNamedParameter4dvNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glProgramNamedParameter4dvNV(id, len, name, v);}
+void __stdcall _Lazy_glGetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetProgramNamedParameterfvNV, "glGetProgramNamedParameterfvNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glGetProgramNamedParameterfvNV(id, len, name, params);}
+void __stdcall _Lazy_glGetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)  {if (__GLeeLazyLink((void**)&pglGetProgramNamedParameterdvNV, "glGetProgramNamedParameterdvNV", &_GLEE_NV_fragment_program, "GL_NV_fragment_program")) glGetProgramNamedParameterdvNV(id, len, name, params);}
 PFNGLPROGRAMNAMEDPARAMETER4FNVPROC pglProgramNamedParameter4fNV=_Lazy_glProgramNamedParameter4fNV;
 PFNGLPROGRAMNAMEDPARAMETER4DNVPROC pglProgramNamedParameter4dNV=_Lazy_glProgramNamedParameter4dNV;
 PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC pglProgramNamedParameter4fvNV=_Lazy_glProgramNamedParameter4fvNV;
@@ -3817,52 +3849,52 @@ PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC pglGetProgramNamedParameterdvNV=_Lazy_glGe
 //GL_NV_half_float
 
 #ifdef __GLEE_GL_NV_half_float
-void __stdcall _Lazy_glVertex2hNV(GLhalfNV x, GLhalfNV y)                                 {if (GLeeInit()) glVertex2hNV(x, y);}
-void __stdcall _Lazy_glVertex2hvNV(const GLhalfNV * v)                                    {if (GLeeInit()) glVertex2hvNV(v);}
-void __stdcall _Lazy_glVertex3hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z)                     {if (GLeeInit()) glVertex3hNV(x, y, z);}
-void __stdcall _Lazy_glVertex3hvNV(const GLhalfNV * v)                                    {if (GLeeInit()) glVertex3hvNV(v);}
-void __stdcall _Lazy_glVertex4hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)         {if (GLeeInit()) glVertex4hNV(x, y, z, w);}
-void __stdcall _Lazy_glVertex4hvNV(const GLhalfNV * v)                                    {if (GLeeInit()) glVertex4hvNV(v);}
-void __stdcall _Lazy_glNormal3hNV(GLhalfNV nx, GLhalfNV ny, GLhalfNV nz)                  {if (GLeeInit()) glNormal3hNV(nx, ny, nz);}
-void __stdcall _Lazy_glNormal3hvNV(const GLhalfNV * v)                                    {if (GLeeInit()) glNormal3hvNV(v);}
-void __stdcall _Lazy_glColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)             {if (GLeeInit()) glColor3hNV(red, green, blue);}
-void __stdcall _Lazy_glColor3hvNV(const GLhalfNV * v)                                     {if (GLeeInit()) glColor3hvNV(v);}
-void __stdcall _Lazy_glColor4hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha)  {if (GLeeInit()) glColor4hNV(red, green, blue, alpha);}
-void __stdcall _Lazy_glColor4hvNV(const GLhalfNV * v)                                     {if (GLeeInit()) glColor4hvNV(v);}
-void __stdcall _Lazy_glTexCoord1hNV(GLhalfNV s)                                           {if (GLeeInit()) glTexCoord1hNV(s);}
-void __stdcall _Lazy_glTexCoord1hvNV(const GLhalfNV * v)                                  {if (GLeeInit()) glTexCoord1hvNV(v);}
-void __stdcall _Lazy_glTexCoord2hNV(GLhalfNV s, GLhalfNV t)                               {if (GLeeInit()) glTexCoord2hNV(s, t);}
-void __stdcall _Lazy_glTexCoord2hvNV(const GLhalfNV * v)                                  {if (GLeeInit()) glTexCoord2hvNV(v);}
-void __stdcall _Lazy_glTexCoord3hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r)                   {if (GLeeInit()) glTexCoord3hNV(s, t, r);}
-void __stdcall _Lazy_glTexCoord3hvNV(const GLhalfNV * v)                                  {if (GLeeInit()) glTexCoord3hvNV(v);}
-void __stdcall _Lazy_glTexCoord4hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)       {if (GLeeInit()) glTexCoord4hNV(s, t, r, q);}
-void __stdcall _Lazy_glTexCoord4hvNV(const GLhalfNV * v)                                  {if (GLeeInit()) glTexCoord4hvNV(v);}
-void __stdcall _Lazy_glMultiTexCoord1hNV(GLenum target, GLhalfNV s)                       {if (GLeeInit()) glMultiTexCoord1hNV(target, s);}
-void __stdcall _Lazy_glMultiTexCoord1hvNV(GLenum target, const GLhalfNV * v)              {if (GLeeInit()) glMultiTexCoord1hvNV(target, v);}
-void __stdcall _Lazy_glMultiTexCoord2hNV(GLenum target, GLhalfNV s, GLhalfNV t)           {if (GLeeInit()) glMultiTexCoord2hNV(target, s, t);}
-void __stdcall _Lazy_glMultiTexCoord2hvNV(GLenum target, const GLhalfNV * v)              {if (GLeeInit()) glMultiTexCoord2hvNV(target, v);}
-void __stdcall _Lazy_glMultiTexCoord3hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r)  {if (GLeeInit()) glMultiTexCoord3hNV(target, s, t, r);}
-void __stdcall _Lazy_glMultiTexCoord3hvNV(GLenum target, const GLhalfNV * v)              {if (GLeeInit()) glMultiTexCoord3hvNV(target, v);}
-void __stdcall _Lazy_glMultiTexCoord4hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)  {if (GLeeInit()) glMultiTexCoord4hNV(target, s, t, r, q);}
-void __stdcall _Lazy_glMultiTexCoord4hvNV(GLenum target, const GLhalfNV * v)              {if (GLeeInit()) glMultiTexCoord4hvNV(target, v);}
-void __stdcall _Lazy_glFogCoordhNV(GLhalfNV fog)                                          {if (GLeeInit()) glFogCoordhNV(fog);}
-void __stdcall _Lazy_glFogCoordhvNV(const GLhalfNV * fog)                                 {if (GLeeInit()) glFogCoordhvNV(fog);}
-void __stdcall _Lazy_glSecondaryColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)    {if (GLeeInit()) glSecondaryColor3hNV(red, green, blue);}
-void __stdcall _Lazy_glSecondaryColor3hvNV(const GLhalfNV * v)                            {if (GLeeInit()) glSecondaryColor3hvNV(v);}
-void __stdcall _Lazy_glVertexWeighthNV(GLhalfNV weight)                                   {if (GLeeInit()) glVertexWeighthNV(weight);}
-void __stdcall _Lazy_glVertexWeighthvNV(const GLhalfNV * weight)                          {if (GLeeInit()) glVertexWeighthvNV(weight);}
-void __stdcall _Lazy_glVertexAttrib1hNV(GLuint index, GLhalfNV x)                         {if (GLeeInit()) glVertexAttrib1hNV(index, x);}
-void __stdcall _Lazy_glVertexAttrib1hvNV(GLuint index, const GLhalfNV * v)                {if (GLeeInit()) glVertexAttrib1hvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib2hNV(GLuint index, GLhalfNV x, GLhalfNV y)             {if (GLeeInit()) glVertexAttrib2hNV(index, x, y);}
-void __stdcall _Lazy_glVertexAttrib2hvNV(GLuint index, const GLhalfNV * v)                {if (GLeeInit()) glVertexAttrib2hvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib3hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z)  {if (GLeeInit()) glVertexAttrib3hNV(index, x, y, z);}
-void __stdcall _Lazy_glVertexAttrib3hvNV(GLuint index, const GLhalfNV * v)                {if (GLeeInit()) glVertexAttrib3hvNV(index, v);}
-void __stdcall _Lazy_glVertexAttrib4hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)  {if (GLeeInit()) glVertexAttrib4hNV(index, x, y, z, w);}
-void __stdcall _Lazy_glVertexAttrib4hvNV(GLuint index, const GLhalfNV * v)                {if (GLeeInit()) glVertexAttrib4hvNV(index, v);}
-void __stdcall _Lazy_glVertexAttribs1hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (GLeeInit()) glVertexAttribs1hvNV(index, n, v);}
-void __stdcall _Lazy_glVertexAttribs2hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (GLeeInit()) glVertexAttribs2hvNV(index, n, v);}
-void __stdcall _Lazy_glVertexAttribs3hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (GLeeInit()) glVertexAttribs3hvNV(index, n, v);}
-void __stdcall _Lazy_glVertexAttribs4hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (GLeeInit()) glVertexAttribs4hvNV(index, n, v);}
+void __stdcall _Lazy_glVertex2hNV(GLhalfNV x, GLhalfNV y)                                 {if (__GLeeLazyLink((void**)&pglVertex2hNV, "glVertex2hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex2hNV(x, y);}
+void __stdcall _Lazy_glVertex2hvNV(const GLhalfNV * v)                                    {if (__GLeeLazyLink((void**)&pglVertex2hvNV, "glVertex2hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex2hvNV(v);}
+void __stdcall _Lazy_glVertex3hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z)                     {if (__GLeeLazyLink((void**)&pglVertex3hNV, "glVertex3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex3hNV(x, y, z);}
+void __stdcall _Lazy_glVertex3hvNV(const GLhalfNV * v)                                    {if (__GLeeLazyLink((void**)&pglVertex3hvNV, "glVertex3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex3hvNV(v);}
+void __stdcall _Lazy_glVertex4hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)         {if (__GLeeLazyLink((void**)&pglVertex4hNV, "glVertex4hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex4hNV(x, y, z, w);}
+void __stdcall _Lazy_glVertex4hvNV(const GLhalfNV * v)                                    {if (__GLeeLazyLink((void**)&pglVertex4hvNV, "glVertex4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertex4hvNV(v);}
+void __stdcall _Lazy_glNormal3hNV(GLhalfNV nx, GLhalfNV ny, GLhalfNV nz)                  {if (__GLeeLazyLink((void**)&pglNormal3hNV, "glNormal3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glNormal3hNV(nx, ny, nz);}
+void __stdcall _Lazy_glNormal3hvNV(const GLhalfNV * v)                                    {if (__GLeeLazyLink((void**)&pglNormal3hvNV, "glNormal3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glNormal3hvNV(v);}
+void __stdcall _Lazy_glColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)             {if (__GLeeLazyLink((void**)&pglColor3hNV, "glColor3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glColor3hNV(red, green, blue);}
+void __stdcall _Lazy_glColor3hvNV(const GLhalfNV * v)                                     {if (__GLeeLazyLink((void**)&pglColor3hvNV, "glColor3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glColor3hvNV(v);}
+void __stdcall _Lazy_glColor4hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha)  {if (__GLeeLazyLink((void**)&pglColor4hNV, "glColor4hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glColor4hNV(red, green, blue, alpha);}
+void __stdcall _Lazy_glColor4hvNV(const GLhalfNV * v)                                     {if (__GLeeLazyLink((void**)&pglColor4hvNV, "glColor4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glColor4hvNV(v);}
+void __stdcall _Lazy_glTexCoord1hNV(GLhalfNV s)                                           {if (__GLeeLazyLink((void**)&pglTexCoord1hNV, "glTexCoord1hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord1hNV(s);}
+void __stdcall _Lazy_glTexCoord1hvNV(const GLhalfNV * v)                                  {if (__GLeeLazyLink((void**)&pglTexCoord1hvNV, "glTexCoord1hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord1hvNV(v);}
+void __stdcall _Lazy_glTexCoord2hNV(GLhalfNV s, GLhalfNV t)                               {if (__GLeeLazyLink((void**)&pglTexCoord2hNV, "glTexCoord2hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord2hNV(s, t);}
+void __stdcall _Lazy_glTexCoord2hvNV(const GLhalfNV * v)                                  {if (__GLeeLazyLink((void**)&pglTexCoord2hvNV, "glTexCoord2hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord2hvNV(v);}
+void __stdcall _Lazy_glTexCoord3hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r)                   {if (__GLeeLazyLink((void**)&pglTexCoord3hNV, "glTexCoord3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord3hNV(s, t, r);}
+void __stdcall _Lazy_glTexCoord3hvNV(const GLhalfNV * v)                                  {if (__GLeeLazyLink((void**)&pglTexCoord3hvNV, "glTexCoord3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord3hvNV(v);}
+void __stdcall _Lazy_glTexCoord4hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)       {if (__GLeeLazyLink((void**)&pglTexCoord4hNV, "glTexCoord4hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord4hNV(s, t, r, q);}
+void __stdcall _Lazy_glTexCoord4hvNV(const GLhalfNV * v)                                  {if (__GLeeLazyLink((void**)&pglTexCoord4hvNV, "glTexCoord4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glTexCoord4hvNV(v);}
+void __stdcall _Lazy_glMultiTexCoord1hNV(GLenum target, GLhalfNV s)                       {if (__GLeeLazyLink((void**)&pglMultiTexCoord1hNV, "glMultiTexCoord1hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord1hNV(target, s);}
+void __stdcall _Lazy_glMultiTexCoord1hvNV(GLenum target, const GLhalfNV * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord1hvNV, "glMultiTexCoord1hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord1hvNV(target, v);}
+void __stdcall _Lazy_glMultiTexCoord2hNV(GLenum target, GLhalfNV s, GLhalfNV t)           {if (__GLeeLazyLink((void**)&pglMultiTexCoord2hNV, "glMultiTexCoord2hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord2hNV(target, s, t);}
+void __stdcall _Lazy_glMultiTexCoord2hvNV(GLenum target, const GLhalfNV * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord2hvNV, "glMultiTexCoord2hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord2hvNV(target, v);}
+void __stdcall _Lazy_glMultiTexCoord3hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord3hNV, "glMultiTexCoord3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord3hNV(target, s, t, r);}
+void __stdcall _Lazy_glMultiTexCoord3hvNV(GLenum target, const GLhalfNV * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord3hvNV, "glMultiTexCoord3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord3hvNV(target, v);}
+void __stdcall _Lazy_glMultiTexCoord4hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q)  {if (__GLeeLazyLink((void**)&pglMultiTexCoord4hNV, "glMultiTexCoord4hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord4hNV(target, s, t, r, q);}
+void __stdcall _Lazy_glMultiTexCoord4hvNV(GLenum target, const GLhalfNV * v)              {if (__GLeeLazyLink((void**)&pglMultiTexCoord4hvNV, "glMultiTexCoord4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glMultiTexCoord4hvNV(target, v);}
+void __stdcall _Lazy_glFogCoordhNV(GLhalfNV fog)                                          {if (__GLeeLazyLink((void**)&pglFogCoordhNV, "glFogCoordhNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glFogCoordhNV(fog);}
+void __stdcall _Lazy_glFogCoordhvNV(const GLhalfNV * fog)                                 {if (__GLeeLazyLink((void**)&pglFogCoordhvNV, "glFogCoordhvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glFogCoordhvNV(fog);}
+void __stdcall _Lazy_glSecondaryColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue)    {if (__GLeeLazyLink((void**)&pglSecondaryColor3hNV, "glSecondaryColor3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glSecondaryColor3hNV(red, green, blue);}
+void __stdcall _Lazy_glSecondaryColor3hvNV(const GLhalfNV * v)                            {if (__GLeeLazyLink((void**)&pglSecondaryColor3hvNV, "glSecondaryColor3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glSecondaryColor3hvNV(v);}
+void __stdcall _Lazy_glVertexWeighthNV(GLhalfNV weight)                                   {if (__GLeeLazyLink((void**)&pglVertexWeighthNV, "glVertexWeighthNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexWeighthNV(weight);}
+void __stdcall _Lazy_glVertexWeighthvNV(const GLhalfNV * weight)                          {if (__GLeeLazyLink((void**)&pglVertexWeighthvNV, "glVertexWeighthvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexWeighthvNV(weight);}
+void __stdcall _Lazy_glVertexAttrib1hNV(GLuint index, GLhalfNV x)                         {if (__GLeeLazyLink((void**)&pglVertexAttrib1hNV, "glVertexAttrib1hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib1hNV(index, x);}
+void __stdcall _Lazy_glVertexAttrib1hvNV(GLuint index, const GLhalfNV * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib1hvNV, "glVertexAttrib1hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib1hvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib2hNV(GLuint index, GLhalfNV x, GLhalfNV y)             {if (__GLeeLazyLink((void**)&pglVertexAttrib2hNV, "glVertexAttrib2hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib2hNV(index, x, y);}
+void __stdcall _Lazy_glVertexAttrib2hvNV(GLuint index, const GLhalfNV * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib2hvNV, "glVertexAttrib2hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib2hvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib3hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z)  {if (__GLeeLazyLink((void**)&pglVertexAttrib3hNV, "glVertexAttrib3hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib3hNV(index, x, y, z);}
+void __stdcall _Lazy_glVertexAttrib3hvNV(GLuint index, const GLhalfNV * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib3hvNV, "glVertexAttrib3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib3hvNV(index, v);}
+void __stdcall _Lazy_glVertexAttrib4hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w)  {if (__GLeeLazyLink((void**)&pglVertexAttrib4hNV, "glVertexAttrib4hNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib4hNV(index, x, y, z, w);}
+void __stdcall _Lazy_glVertexAttrib4hvNV(GLuint index, const GLhalfNV * v)                {if (__GLeeLazyLink((void**)&pglVertexAttrib4hvNV, "glVertexAttrib4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttrib4hvNV(index, v);}
+void __stdcall _Lazy_glVertexAttribs1hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (__GLeeLazyLink((void**)&pglVertexAttribs1hvNV, "glVertexAttribs1hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttribs1hvNV(index, n, v);}
+void __stdcall _Lazy_glVertexAttribs2hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (__GLeeLazyLink((void**)&pglVertexAttribs2hvNV, "glVertexAttribs2hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttribs2hvNV(index, n, v);}
+void __stdcall _Lazy_glVertexAttribs3hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (__GLeeLazyLink((void**)&pglVertexAttribs3hvNV, "glVertexAttribs3hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttribs3hvNV(index, n, v);}
+void __stdcall _Lazy_glVertexAttribs4hvNV(GLuint index, GLsizei n, const GLhalfNV * v)    {if (__GLeeLazyLink((void**)&pglVertexAttribs4hvNV, "glVertexAttribs4hvNV", &_GLEE_NV_half_float, "GL_NV_half_float")) glVertexAttribs4hvNV(index, n, v);}
 PFNGLVERTEX2HNVPROC pglVertex2hNV=_Lazy_glVertex2hNV;
 PFNGLVERTEX2HVNVPROC pglVertex2hvNV=_Lazy_glVertex2hvNV;
 PFNGLVERTEX3HNVPROC pglVertex3hNV=_Lazy_glVertex3hNV;
@@ -3914,8 +3946,8 @@ PFNGLVERTEXATTRIBS4HVNVPROC pglVertexAttribs4hvNV=_Lazy_glVertexAttribs4hvNV;
 //GL_NV_pixel_data_range
 
 #ifdef __GLEE_GL_NV_pixel_data_range
-void __stdcall _Lazy_glPixelDataRangeNV(GLenum target, GLsizei length, GLvoid * pointer)  {if (GLeeInit()) glPixelDataRangeNV(target, length, pointer);}
-void __stdcall _Lazy_glFlushPixelDataRangeNV(GLenum target)                               {if (GLeeInit()) glFlushPixelDataRangeNV(target);}
+void __stdcall _Lazy_glPixelDataRangeNV(GLenum target, GLsizei length, GLvoid * pointer)  {if (__GLeeLazyLink((void**)&pglPixelDataRangeNV, "glPixelDataRangeNV", &_GLEE_NV_pixel_data_range, "GL_NV_pixel_data_range")) glPixelDataRangeNV(target, length, pointer);}
+void __stdcall _Lazy_glFlushPixelDataRangeNV(GLenum target)                               {if (__GLeeLazyLink((void**)&pglFlushPixelDataRangeNV, "glFlushPixelDataRangeNV", &_GLEE_NV_pixel_data_range, "GL_NV_pixel_data_range")) glFlushPixelDataRangeNV(target);}
 PFNGLPIXELDATARANGENVPROC pglPixelDataRangeNV=_Lazy_glPixelDataRangeNV;
 PFNGLFLUSHPIXELDATARANGENVPROC pglFlushPixelDataRangeNV=_Lazy_glFlushPixelDataRangeNV;
 #endif 
@@ -3923,8 +3955,8 @@ PFNGLFLUSHPIXELDATARANGENVPROC pglFlushPixelDataRangeNV=_Lazy_glFlushPixelDataRa
 //GL_NV_primitive_restart
 
 #ifdef __GLEE_GL_NV_primitive_restart
-void __stdcall _Lazy_glPrimitiveRestartNV(void)                                           {if (GLeeInit()) glPrimitiveRestartNV();}
-void __stdcall _Lazy_glPrimitiveRestartIndexNV(GLuint index)                              {if (GLeeInit()) glPrimitiveRestartIndexNV(index);}
+void __stdcall _Lazy_glPrimitiveRestartNV(void)                                           {if (__GLeeLazyLink((void**)&pglPrimitiveRestartNV, "glPrimitiveRestartNV", &_GLEE_NV_primitive_restart, "GL_NV_primitive_restart")) glPrimitiveRestartNV();}
+void __stdcall _Lazy_glPrimitiveRestartIndexNV(GLuint index)                              {if (__GLeeLazyLink((void**)&pglPrimitiveRestartIndexNV, "glPrimitiveRestartIndexNV", &_GLEE_NV_primitive_restart, "GL_NV_primitive_restart")) glPrimitiveRestartIndexNV(index);}
 PFNGLPRIMITIVERESTARTNVPROC pglPrimitiveRestartNV=_Lazy_glPrimitiveRestartNV;
 PFNGLPRIMITIVERESTARTINDEXNVPROC pglPrimitiveRestartIndexNV=_Lazy_glPrimitiveRestartIndexNV;
 #endif 
@@ -3942,8 +3974,8 @@ PFNGLPRIMITIVERESTARTINDEXNVPROC pglPrimitiveRestartIndexNV=_Lazy_glPrimitiveRes
 //GL_ATI_map_object_buffer
 
 #ifdef __GLEE_GL_ATI_map_object_buffer
-GLvoid* __stdcall _Lazy_glMapObjectBufferATI(GLuint buffer)                               {if (GLeeInit()) return glMapObjectBufferATI(buffer); return (GLvoid*)0;}
-void __stdcall _Lazy_glUnmapObjectBufferATI(GLuint buffer)                                {if (GLeeInit()) glUnmapObjectBufferATI(buffer);}
+GLvoid* __stdcall _Lazy_glMapObjectBufferATI(GLuint buffer)                               {if (__GLeeLazyLink((void**)&pglMapObjectBufferATI, "glMapObjectBufferATI", &_GLEE_ATI_map_object_buffer, "GL_ATI_map_object_buffer")) return glMapObjectBufferATI(buffer); return (GLvoid*)0;}
+void __stdcall _Lazy_glUnmapObjectBufferATI(GLuint buffer)                                {if (__GLeeLazyLink((void**)&pglUnmapObjectBufferATI, "glUnmapObjectBufferATI", &_GLEE_ATI_map_object_buffer, "GL_ATI_map_object_buffer")) glUnmapObjectBufferATI(buffer);}
 PFNGLMAPOBJECTBUFFERATIPROC pglMapObjectBufferATI=_Lazy_glMapObjectBufferATI;
 PFNGLUNMAPOBJECTBUFFERATIPROC pglUnmapObjectBufferATI=_Lazy_glUnmapObjectBufferATI;
 #endif 
@@ -3951,8 +3983,8 @@ PFNGLUNMAPOBJECTBUFFERATIPROC pglUnmapObjectBufferATI=_Lazy_glUnmapObjectBufferA
 //GL_ATI_separate_stencil
 
 #ifdef __GLEE_GL_ATI_separate_stencil
-void __stdcall _Lazy_glStencilOpSeparateATI(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)  {if (GLeeInit()) glStencilOpSeparateATI(face, sfail, dpfail, dppass);}
-void __stdcall _Lazy_glStencilFuncSeparateATI(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)  {if (GLeeInit()) glStencilFuncSeparateATI(frontfunc, backfunc, ref, mask);}
+void __stdcall _Lazy_glStencilOpSeparateATI(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)  {if (__GLeeLazyLink((void**)&pglStencilOpSeparateATI, "glStencilOpSeparateATI", &_GLEE_ATI_separate_stencil, "GL_ATI_separate_stencil")) glStencilOpSeparateATI(face, sfail, dpfail, dppass);}
+void __stdcall _Lazy_glStencilFuncSeparateATI(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)  {if (__GLeeLazyLink((void**)&pglStencilFuncSeparateATI, "glStencilFuncSeparateATI", &_GLEE_ATI_separate_stencil, "GL_ATI_separate_stencil")) glStencilFuncSeparateATI(frontfunc, backfunc, ref, mask);}
 PFNGLSTENCILOPSEPARATEATIPROC pglStencilOpSeparateATI=_Lazy_glStencilOpSeparateATI;
 PFNGLSTENCILFUNCSEPARATEATIPROC pglStencilFuncSeparateATI=_Lazy_glStencilFuncSeparateATI;
 #endif 
@@ -3960,9 +3992,9 @@ PFNGLSTENCILFUNCSEPARATEATIPROC pglStencilFuncSeparateATI=_Lazy_glStencilFuncSep
 //GL_ATI_vertex_attrib_array_object
 
 #ifdef __GLEE_GL_ATI_vertex_attrib_array_object
-void __stdcall _Lazy_glVertexAttribArrayObjectATI(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset)  {if (GLeeInit()) glVertexAttribArrayObjectATI(index, size, type, normalized, stride, buffer, offset);}
-void __stdcall _Lazy_glGetVertexAttribArrayObjectfvATI(GLuint index, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetVertexAttribArrayObjectfvATI(index, pname, params);}
-void __stdcall _Lazy_glGetVertexAttribArrayObjectivATI(GLuint index, GLenum pname, GLint * params)  {if (GLeeInit()) glGetVertexAttribArrayObjectivATI(index, pname, params);}
+void __stdcall _Lazy_glVertexAttribArrayObjectATI(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset)  {if (__GLeeLazyLink((void**)&pglVertexAttribArrayObjectATI, "glVertexAttribArrayObjectATI", &_GLEE_ATI_vertex_attrib_array_object, "GL_ATI_vertex_attrib_array_object")) glVertexAttribArrayObjectATI(index, size, type, normalized, stride, buffer, offset);}
+void __stdcall _Lazy_glGetVertexAttribArrayObjectfvATI(GLuint index, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribArrayObjectfvATI, "glGetVertexAttribArrayObjectfvATI", &_GLEE_ATI_vertex_attrib_array_object, "GL_ATI_vertex_attrib_array_object")) glGetVertexAttribArrayObjectfvATI(index, pname, params);}
+void __stdcall _Lazy_glGetVertexAttribArrayObjectivATI(GLuint index, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetVertexAttribArrayObjectivATI, "glGetVertexAttribArrayObjectivATI", &_GLEE_ATI_vertex_attrib_array_object, "GL_ATI_vertex_attrib_array_object")) glGetVertexAttribArrayObjectivATI(index, pname, params);}
 PFNGLVERTEXATTRIBARRAYOBJECTATIPROC pglVertexAttribArrayObjectATI=_Lazy_glVertexAttribArrayObjectATI;
 PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC pglGetVertexAttribArrayObjectfvATI=_Lazy_glGetVertexAttribArrayObjectfvATI;
 PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC pglGetVertexAttribArrayObjectivATI=_Lazy_glGetVertexAttribArrayObjectivATI;
@@ -3976,7 +4008,7 @@ PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC pglGetVertexAttribArrayObjectivATI=_Laz
 //GL_EXT_depth_bounds_test
 
 #ifdef __GLEE_GL_EXT_depth_bounds_test
-void __stdcall _Lazy_glDepthBoundsEXT(GLclampd zmin, GLclampd zmax)                       {if (GLeeInit()) glDepthBoundsEXT(zmin, zmax);}
+void __stdcall _Lazy_glDepthBoundsEXT(GLclampd zmin, GLclampd zmax)                       {if (__GLeeLazyLink((void**)&pglDepthBoundsEXT, "glDepthBoundsEXT", &_GLEE_EXT_depth_bounds_test, "GL_EXT_depth_bounds_test")) glDepthBoundsEXT(zmin, zmax);}
 PFNGLDEPTHBOUNDSEXTPROC pglDepthBoundsEXT=_Lazy_glDepthBoundsEXT;
 #endif 
 
@@ -3988,7 +4020,7 @@ PFNGLDEPTHBOUNDSEXTPROC pglDepthBoundsEXT=_Lazy_glDepthBoundsEXT;
 //GL_EXT_blend_equation_separate
 
 #ifdef __GLEE_GL_EXT_blend_equation_separate
-void __stdcall _Lazy_glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha)         {if (GLeeInit()) glBlendEquationSeparateEXT(modeRGB, modeAlpha);}
+void __stdcall _Lazy_glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha)         {if (__GLeeLazyLink((void**)&pglBlendEquationSeparateEXT, "glBlendEquationSeparateEXT", &_GLEE_EXT_blend_equation_separate, "GL_EXT_blend_equation_separate")) glBlendEquationSeparateEXT(modeRGB, modeAlpha);}
 PFNGLBLENDEQUATIONSEPARATEEXTPROC pglBlendEquationSeparateEXT=_Lazy_glBlendEquationSeparateEXT;
 #endif 
 
@@ -4030,23 +4062,23 @@ PFNGLBLENDEQUATIONSEPARATEEXTPROC pglBlendEquationSeparateEXT=_Lazy_glBlendEquat
 //GL_EXT_framebuffer_object
 
 #ifdef __GLEE_GL_EXT_framebuffer_object
-GLboolean __stdcall _Lazy_glIsRenderbufferEXT(GLuint renderbuffer)                        {if (GLeeInit()) return glIsRenderbufferEXT(renderbuffer); return (GLboolean)0;}
-void __stdcall _Lazy_glBindRenderbufferEXT(GLenum target, GLuint renderbuffer)            {if (GLeeInit()) glBindRenderbufferEXT(target, renderbuffer);}
-void __stdcall _Lazy_glDeleteRenderbuffersEXT(GLsizei n, const GLuint * renderbuffers)    {if (GLeeInit()) glDeleteRenderbuffersEXT(n, renderbuffers);}
-void __stdcall _Lazy_glGenRenderbuffersEXT(GLsizei n, GLuint * renderbuffers)             {if (GLeeInit()) glGenRenderbuffersEXT(n, renderbuffers);}
-void __stdcall _Lazy_glRenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)  {if (GLeeInit()) glRenderbufferStorageEXT(target, internalformat, width, height);}
-void __stdcall _Lazy_glGetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (GLeeInit()) glGetRenderbufferParameterivEXT(target, pname, params);}
-GLboolean __stdcall _Lazy_glIsFramebufferEXT(GLuint framebuffer)                          {if (GLeeInit()) return glIsFramebufferEXT(framebuffer); return (GLboolean)0;}
-void __stdcall _Lazy_glBindFramebufferEXT(GLenum target, GLuint framebuffer)              {if (GLeeInit()) glBindFramebufferEXT(target, framebuffer);}
-void __stdcall _Lazy_glDeleteFramebuffersEXT(GLsizei n, const GLuint * framebuffers)      {if (GLeeInit()) glDeleteFramebuffersEXT(n, framebuffers);}
-void __stdcall _Lazy_glGenFramebuffersEXT(GLsizei n, GLuint * framebuffers)               {if (GLeeInit()) glGenFramebuffersEXT(n, framebuffers);}
-GLenum __stdcall _Lazy_glCheckFramebufferStatusEXT(GLenum target)                         {if (GLeeInit()) return glCheckFramebufferStatusEXT(target); return (GLenum)0;}
-void __stdcall _Lazy_glFramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)  {if (GLeeInit()) glFramebufferTexture1DEXT(target, attachment, textarget, texture, level);}
-void __stdcall _Lazy_glFramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)  {if (GLeeInit()) glFramebufferTexture2DEXT(target, attachment, textarget, texture, level);}
-void __stdcall _Lazy_glFramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)  {if (GLeeInit()) glFramebufferTexture3DEXT(target, attachment, textarget, texture, level, zoffset);}
-void __stdcall _Lazy_glFramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)  {if (GLeeInit()) glFramebufferRenderbufferEXT(target, attachment, renderbuffertarget, renderbuffer);}
-void __stdcall _Lazy_glGetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint * params)  {if (GLeeInit()) glGetFramebufferAttachmentParameterivEXT(target, attachment, pname, params);}
-void __stdcall _Lazy_glGenerateMipmapEXT(GLenum target)                                   {if (GLeeInit()) glGenerateMipmapEXT(target);}
+GLboolean __stdcall _Lazy_glIsRenderbufferEXT(GLuint renderbuffer)                        {if (__GLeeLazyLink((void**)&pglIsRenderbufferEXT, "glIsRenderbufferEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) return glIsRenderbufferEXT(renderbuffer); return (GLboolean)0;}
+void __stdcall _Lazy_glBindRenderbufferEXT(GLenum target, GLuint renderbuffer)            {if (__GLeeLazyLink((void**)&pglBindRenderbufferEXT, "glBindRenderbufferEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glBindRenderbufferEXT(target, renderbuffer);}
+void __stdcall _Lazy_glDeleteRenderbuffersEXT(GLsizei n, const GLuint * renderbuffers)    {if (__GLeeLazyLink((void**)&pglDeleteRenderbuffersEXT, "glDeleteRenderbuffersEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glDeleteRenderbuffersEXT(n, renderbuffers);}
+void __stdcall _Lazy_glGenRenderbuffersEXT(GLsizei n, GLuint * renderbuffers)             {if (__GLeeLazyLink((void**)&pglGenRenderbuffersEXT, "glGenRenderbuffersEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glGenRenderbuffersEXT(n, renderbuffers);}
+void __stdcall _Lazy_glRenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)  {if (__GLeeLazyLink((void**)&pglRenderbufferStorageEXT, "glRenderbufferStorageEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glRenderbufferStorageEXT(target, internalformat, width, height);}
+void __stdcall _Lazy_glGetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetRenderbufferParameterivEXT, "glGetRenderbufferParameterivEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glGetRenderbufferParameterivEXT(target, pname, params);}
+GLboolean __stdcall _Lazy_glIsFramebufferEXT(GLuint framebuffer)                          {if (__GLeeLazyLink((void**)&pglIsFramebufferEXT, "glIsFramebufferEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) return glIsFramebufferEXT(framebuffer); return (GLboolean)0;}
+void __stdcall _Lazy_glBindFramebufferEXT(GLenum target, GLuint framebuffer)              {if (__GLeeLazyLink((void**)&pglBindFramebufferEXT, "glBindFramebufferEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glBindFramebufferEXT(target, framebuffer);}
+void __stdcall _Lazy_glDeleteFramebuffersEXT(GLsizei n, const GLuint * framebuffers)      {if (__GLeeLazyLink((void**)&pglDeleteFramebuffersEXT, "glDeleteFramebuffersEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glDeleteFramebuffersEXT(n, framebuffers);}
+void __stdcall _Lazy_glGenFramebuffersEXT(GLsizei n, GLuint * framebuffers)               {if (__GLeeLazyLink((void**)&pglGenFramebuffersEXT, "glGenFramebuffersEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glGenFramebuffersEXT(n, framebuffers);}
+GLenum __stdcall _Lazy_glCheckFramebufferStatusEXT(GLenum target)                         {if (__GLeeLazyLink((void**)&pglCheckFramebufferStatusEXT, "glCheckFramebufferStatusEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) return glCheckFramebufferStatusEXT(target); return (GLenum)0;}
+void __stdcall _Lazy_glFramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)  {if (__GLeeLazyLink((void**)&pglFramebufferTexture1DEXT, "glFramebufferTexture1DEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glFramebufferTexture1DEXT(target, attachment, textarget, texture, level);}
+void __stdcall _Lazy_glFramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)  {if (__GLeeLazyLink((void**)&pglFramebufferTexture2DEXT, "glFramebufferTexture2DEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glFramebufferTexture2DEXT(target, attachment, textarget, texture, level);}
+void __stdcall _Lazy_glFramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)  {if (__GLeeLazyLink((void**)&pglFramebufferTexture3DEXT, "glFramebufferTexture3DEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glFramebufferTexture3DEXT(target, attachment, textarget, texture, level, zoffset);}
+void __stdcall _Lazy_glFramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)  {if (__GLeeLazyLink((void**)&pglFramebufferRenderbufferEXT, "glFramebufferRenderbufferEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glFramebufferRenderbufferEXT(target, attachment, renderbuffertarget, renderbuffer);}
+void __stdcall _Lazy_glGetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFramebufferAttachmentParameterivEXT, "glGetFramebufferAttachmentParameterivEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glGetFramebufferAttachmentParameterivEXT(target, attachment, pname, params);}
+void __stdcall _Lazy_glGenerateMipmapEXT(GLenum target)                                   {if (__GLeeLazyLink((void**)&pglGenerateMipmapEXT, "glGenerateMipmapEXT", &_GLEE_EXT_framebuffer_object, "GL_EXT_framebuffer_object")) glGenerateMipmapEXT(target);}
 PFNGLISRENDERBUFFEREXTPROC pglIsRenderbufferEXT=_Lazy_glIsRenderbufferEXT;
 PFNGLBINDRENDERBUFFEREXTPROC pglBindRenderbufferEXT=_Lazy_glBindRenderbufferEXT;
 PFNGLDELETERENDERBUFFERSEXTPROC pglDeleteRenderbuffersEXT=_Lazy_glDeleteRenderbuffersEXT;
@@ -4069,7 +4101,7 @@ PFNGLGENERATEMIPMAPEXTPROC pglGenerateMipmapEXT=_Lazy_glGenerateMipmapEXT;
 //GL_GREMEDY_string_marker
 
 #ifdef __GLEE_GL_GREMEDY_string_marker
-void __stdcall _Lazy_glStringMarkerGREMEDY(GLsizei len, const GLvoid * string)            {if (GLeeInit()) glStringMarkerGREMEDY(len, string);}
+void __stdcall _Lazy_glStringMarkerGREMEDY(GLsizei len, const GLvoid * string)            {if (__GLeeLazyLink((void**)&pglStringMarkerGREMEDY, "glStringMarkerGREMEDY", &_GLEE_GREMEDY_string_marker, "GL_GREMEDY_string_marker")) glStringMarkerGREMEDY(len, string);}
 PFNGLSTRINGMARKERGREMEDYPROC pglStringMarkerGREMEDY=_Lazy_glStringMarkerGREMEDY;
 #endif 
 
@@ -4086,7 +4118,7 @@ PFNGLSTRINGMARKERGREMEDYPROC pglStringMarkerGREMEDY=_Lazy_glStringMarkerGREMEDY;
 //GL_INGR_blend_func_separate
 
 #ifdef __GLEE_GL_INGR_blend_func_separate
-void __stdcall _Lazy_glBlendFuncSeparateINGR(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (GLeeInit()) glBlendFuncSeparateINGR(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
+void __stdcall _Lazy_glBlendFuncSeparateINGR(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)  {if (__GLeeLazyLink((void**)&pglBlendFuncSeparateINGR, "glBlendFuncSeparateINGR", &_GLEE_INGR_blend_func_separate, "GL_INGR_blend_func_separate")) glBlendFuncSeparateINGR(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);}
 PFNGLBLENDFUNCSEPARATEINGRPROC pglBlendFuncSeparateINGR=_Lazy_glBlendFuncSeparateINGR;
 #endif 
 
@@ -4098,31 +4130,31 @@ PFNGLBLENDFUNCSEPARATEINGRPROC pglBlendFuncSeparateINGR=_Lazy_glBlendFuncSeparat
 //GL_SGIX_igloo_interface
 
 #ifdef __GLEE_GL_SGIX_igloo_interface
-void __stdcall _Lazy_glIglooInterfaceSGIX(GLenum pname, const GLvoid * params)            {if (GLeeInit()) glIglooInterfaceSGIX(pname, params);}
+void __stdcall _Lazy_glIglooInterfaceSGIX(GLenum pname, const GLvoid * params)            {if (__GLeeLazyLink((void**)&pglIglooInterfaceSGIX, "glIglooInterfaceSGIX", &_GLEE_SGIX_igloo_interface, "GL_SGIX_igloo_interface")) glIglooInterfaceSGIX(pname, params);}
 PFNGLIGLOOINTERFACESGIXPROC pglIglooInterfaceSGIX=_Lazy_glIglooInterfaceSGIX;
 #endif 
 
 //GL_EXT_fragment_lighting
 
 #ifdef __GLEE_GL_EXT_fragment_lighting
-GLvoid __stdcall _Lazy_glFragmentLightModeliEXT(GLenum pname, GLint param)                {if (GLeeInit()) glFragmentLightModeliEXT(pname, param);}
-GLvoid __stdcall _Lazy_glFragmentLightModelfEXT(GLenum pname, GLfloat param)              {if (GLeeInit()) glFragmentLightModelfEXT(pname, param);}
-GLvoid __stdcall _Lazy_glFragmentLightModelivEXT(GLenum pname, GLint * params)            {if (GLeeInit()) glFragmentLightModelivEXT(pname, params);}
-GLvoid __stdcall _Lazy_glFragmentLightModelfvEXT(GLenum pname, GLfloat * params)          {if (GLeeInit()) glFragmentLightModelfvEXT(pname, params);}
-GLvoid __stdcall _Lazy_glFragmentLightiEXT(GLenum light, GLenum pname, GLint param)       {if (GLeeInit()) glFragmentLightiEXT(light, pname, param);}
-GLvoid __stdcall _Lazy_glFragmentLightfEXT(GLenum light, GLenum pname, GLfloat param)     {if (GLeeInit()) glFragmentLightfEXT(light, pname, param);}
-GLvoid __stdcall _Lazy_glFragmentLightivEXT(GLenum light, GLenum pname, GLint * params)   {if (GLeeInit()) glFragmentLightivEXT(light, pname, params);}
-GLvoid __stdcall _Lazy_glFragmentLightfvEXT(GLenum light, GLenum pname, GLfloat * params)  {if (GLeeInit()) glFragmentLightfvEXT(light, pname, params);}
-GLvoid __stdcall _Lazy_glGetFragmentLightivEXT(GLenum light, GLenum pname, GLint * params)  {if (GLeeInit()) glGetFragmentLightivEXT(light, pname, params);}
-GLvoid __stdcall _Lazy_glGetFragmentLightfvEXT(GLenum light, GLenum pname, GLfloat * params)  {if (GLeeInit()) glGetFragmentLightfvEXT(light, pname, params);}
-GLvoid __stdcall _Lazy_glFragmentMaterialfEXT(GLenum face, GLenum pname, const GLfloat param)  {if (GLeeInit()) glFragmentMaterialfEXT(face, pname, param);}
-GLvoid __stdcall _Lazy_glFragmentMaterialiEXT(GLenum face, GLenum pname, const GLint param)  {if (GLeeInit()) glFragmentMaterialiEXT(face, pname, param);}
-GLvoid __stdcall _Lazy_glFragmentMaterialfvEXT(GLenum face, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glFragmentMaterialfvEXT(face, pname, params);}
-GLvoid __stdcall _Lazy_glFragmentMaterialivEXT(GLenum face, GLenum pname, const GLint * params)  {if (GLeeInit()) glFragmentMaterialivEXT(face, pname, params);}
-GLvoid __stdcall _Lazy_glFragmentColorMaterialEXT(GLenum face, GLenum mode)               {if (GLeeInit()) glFragmentColorMaterialEXT(face, mode);}
-GLvoid __stdcall _Lazy_glGetFragmentMaterialfvEXT(GLenum face, GLenum pname, const GLfloat * params)  {if (GLeeInit()) glGetFragmentMaterialfvEXT(face, pname, params);}
-GLvoid __stdcall _Lazy_glGetFragmentMaterialivEXT(GLenum face, GLenum pname, const GLint * params)  {if (GLeeInit()) glGetFragmentMaterialivEXT(face, pname, params);}
-GLvoid __stdcall _Lazy_glLightEnviEXT(GLenum pname, GLint param)                          {if (GLeeInit()) glLightEnviEXT(pname, param);}
+GLvoid __stdcall _Lazy_glFragmentLightModeliEXT(GLenum pname, GLint param)                {if (__GLeeLazyLink((void**)&pglFragmentLightModeliEXT, "glFragmentLightModeliEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightModeliEXT(pname, param);}
+GLvoid __stdcall _Lazy_glFragmentLightModelfEXT(GLenum pname, GLfloat param)              {if (__GLeeLazyLink((void**)&pglFragmentLightModelfEXT, "glFragmentLightModelfEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightModelfEXT(pname, param);}
+GLvoid __stdcall _Lazy_glFragmentLightModelivEXT(GLenum pname, GLint * params)            {if (__GLeeLazyLink((void**)&pglFragmentLightModelivEXT, "glFragmentLightModelivEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightModelivEXT(pname, params);}
+GLvoid __stdcall _Lazy_glFragmentLightModelfvEXT(GLenum pname, GLfloat * params)          {if (__GLeeLazyLink((void**)&pglFragmentLightModelfvEXT, "glFragmentLightModelfvEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightModelfvEXT(pname, params);}
+GLvoid __stdcall _Lazy_glFragmentLightiEXT(GLenum light, GLenum pname, GLint param)       {if (__GLeeLazyLink((void**)&pglFragmentLightiEXT, "glFragmentLightiEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightiEXT(light, pname, param);}
+GLvoid __stdcall _Lazy_glFragmentLightfEXT(GLenum light, GLenum pname, GLfloat param)     {if (__GLeeLazyLink((void**)&pglFragmentLightfEXT, "glFragmentLightfEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightfEXT(light, pname, param);}
+GLvoid __stdcall _Lazy_glFragmentLightivEXT(GLenum light, GLenum pname, GLint * params)   {if (__GLeeLazyLink((void**)&pglFragmentLightivEXT, "glFragmentLightivEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightivEXT(light, pname, params);}
+GLvoid __stdcall _Lazy_glFragmentLightfvEXT(GLenum light, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglFragmentLightfvEXT, "glFragmentLightfvEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentLightfvEXT(light, pname, params);}
+GLvoid __stdcall _Lazy_glGetFragmentLightivEXT(GLenum light, GLenum pname, GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentLightivEXT, "glGetFragmentLightivEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glGetFragmentLightivEXT(light, pname, params);}
+GLvoid __stdcall _Lazy_glGetFragmentLightfvEXT(GLenum light, GLenum pname, GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentLightfvEXT, "glGetFragmentLightfvEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glGetFragmentLightfvEXT(light, pname, params);}
+GLvoid __stdcall _Lazy_glFragmentMaterialfEXT(GLenum face, GLenum pname, const GLfloat param)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialfEXT, "glFragmentMaterialfEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentMaterialfEXT(face, pname, param);}
+GLvoid __stdcall _Lazy_glFragmentMaterialiEXT(GLenum face, GLenum pname, const GLint param)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialiEXT, "glFragmentMaterialiEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentMaterialiEXT(face, pname, param);}
+GLvoid __stdcall _Lazy_glFragmentMaterialfvEXT(GLenum face, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialfvEXT, "glFragmentMaterialfvEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentMaterialfvEXT(face, pname, params);}
+GLvoid __stdcall _Lazy_glFragmentMaterialivEXT(GLenum face, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglFragmentMaterialivEXT, "glFragmentMaterialivEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentMaterialivEXT(face, pname, params);}
+GLvoid __stdcall _Lazy_glFragmentColorMaterialEXT(GLenum face, GLenum mode)               {if (__GLeeLazyLink((void**)&pglFragmentColorMaterialEXT, "glFragmentColorMaterialEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glFragmentColorMaterialEXT(face, mode);}
+GLvoid __stdcall _Lazy_glGetFragmentMaterialfvEXT(GLenum face, GLenum pname, const GLfloat * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentMaterialfvEXT, "glGetFragmentMaterialfvEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glGetFragmentMaterialfvEXT(face, pname, params);}
+GLvoid __stdcall _Lazy_glGetFragmentMaterialivEXT(GLenum face, GLenum pname, const GLint * params)  {if (__GLeeLazyLink((void**)&pglGetFragmentMaterialivEXT, "glGetFragmentMaterialivEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glGetFragmentMaterialivEXT(face, pname, params);}
+GLvoid __stdcall _Lazy_glLightEnviEXT(GLenum pname, GLint param)                          {if (__GLeeLazyLink((void**)&pglLightEnviEXT, "glLightEnviEXT", &_GLEE_EXT_fragment_lighting, "GL_EXT_fragment_lighting")) glLightEnviEXT(pname, param);}
 PFNGLFRAGMENTLIGHTMODELIEXTPROC pglFragmentLightModeliEXT=_Lazy_glFragmentLightModeliEXT;
 PFNGLFRAGMENTLIGHTMODELFEXTPROC pglFragmentLightModelfEXT=_Lazy_glFragmentLightModelfEXT;
 PFNGLFRAGMENTLIGHTMODELIVEXTPROC pglFragmentLightModelivEXT=_Lazy_glFragmentLightModelivEXT;
@@ -4151,8 +4183,8 @@ PFNGLLIGHTENVIEXTPROC pglLightEnviEXT=_Lazy_glLightEnviEXT;
 //GL_EXT_scene_marker
 
 #ifdef __GLEE_GL_EXT_scene_marker
-GLvoid __stdcall _Lazy_glBeginSceneEXT(void)                                              {if (GLeeInit()) glBeginSceneEXT();}
-GLvoid __stdcall _Lazy_glEndSceneEXT(void)                                                {if (GLeeInit()) glEndSceneEXT();}
+GLvoid __stdcall _Lazy_glBeginSceneEXT(void)                                              {if (__GLeeLazyLink((void**)&pglBeginSceneEXT, "glBeginSceneEXT", &_GLEE_EXT_scene_marker, "GL_EXT_scene_marker")) glBeginSceneEXT();}
+GLvoid __stdcall _Lazy_glEndSceneEXT(void)                                                {if (__GLeeLazyLink((void**)&pglEndSceneEXT, "glEndSceneEXT", &_GLEE_EXT_scene_marker, "GL_EXT_scene_marker")) glEndSceneEXT();}
 PFNGLBEGINSCENEEXTPROC pglBeginSceneEXT=_Lazy_glBeginSceneEXT;
 PFNGLENDSCENEEXTPROC pglEndSceneEXT=_Lazy_glEndSceneEXT;
 #endif 
@@ -4185,12 +4217,12 @@ PFNGLENDSCENEEXTPROC pglEndSceneEXT=_Lazy_glEndSceneEXT;
 //GL_OES_single_precision
 
 #ifdef __GLEE_GL_OES_single_precision
-GLvoid __stdcall _Lazy_glDepthRangefOES(GLclampf n, GLclampf f)                           {if (GLeeInit()) glDepthRangefOES(n, f);}
-GLvoid __stdcall _Lazy_glFrustumfOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)  {if (GLeeInit()) glFrustumfOES(l, r, b, t, n, f);}
-GLvoid __stdcall _Lazy_glOrthofOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)  {if (GLeeInit()) glOrthofOES(l, r, b, t, n, f);}
-GLvoid __stdcall _Lazy_glClipPlanefOES(GLenum plane, const GLfloat* equation)             {if (GLeeInit()) glClipPlanefOES(plane, equation);}
-GLvoid __stdcall _Lazy_glGetClipPlanefOES(GLenum plane, GLfloat* equation)                {if (GLeeInit()) glGetClipPlanefOES(plane, equation);}
-GLvoid __stdcall _Lazy_glClearDepthfOES(GLclampd depth)                                   {if (GLeeInit()) glClearDepthfOES(depth);}
+GLvoid __stdcall _Lazy_glDepthRangefOES(GLclampf n, GLclampf f)                           {if (__GLeeLazyLink((void**)&pglDepthRangefOES, "glDepthRangefOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glDepthRangefOES(n, f);}
+GLvoid __stdcall _Lazy_glFrustumfOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)  {if (__GLeeLazyLink((void**)&pglFrustumfOES, "glFrustumfOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glFrustumfOES(l, r, b, t, n, f);}
+GLvoid __stdcall _Lazy_glOrthofOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)  {if (__GLeeLazyLink((void**)&pglOrthofOES, "glOrthofOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glOrthofOES(l, r, b, t, n, f);}
+GLvoid __stdcall _Lazy_glClipPlanefOES(GLenum plane, const GLfloat* equation)             {if (__GLeeLazyLink((void**)&pglClipPlanefOES, "glClipPlanefOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glClipPlanefOES(plane, equation);}
+GLvoid __stdcall _Lazy_glGetClipPlanefOES(GLenum plane, GLfloat* equation)                {if (__GLeeLazyLink((void**)&pglGetClipPlanefOES, "glGetClipPlanefOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glGetClipPlanefOES(plane, equation);}
+GLvoid __stdcall _Lazy_glClearDepthfOES(GLclampd depth)                                   {if (__GLeeLazyLink((void**)&pglClearDepthfOES, "glClearDepthfOES", &_GLEE_OES_single_precision, "GL_OES_single_precision")) glClearDepthfOES(depth);}
 PFNGLDEPTHRANGEFOESPROC pglDepthRangefOES=_Lazy_glDepthRangefOES;
 PFNGLFRUSTUMFOESPROC pglFrustumfOES=_Lazy_glFrustumfOES;
 PFNGLORTHOFOESPROC pglOrthofOES=_Lazy_glOrthofOES;
@@ -4282,10 +4314,10 @@ int __GLeeWGLNumExtensions=29;
 //WGL_ARB_buffer_region
 
 #ifdef __GLEE_WGL_ARB_buffer_region
-HANDLE __stdcall _Lazy_wglCreateBufferRegionARB(HDC hDC, int iLayerPlane, UINT uType)     {if (GLeeInit()) return wglCreateBufferRegionARB(hDC, iLayerPlane, uType); return (HANDLE)0;}
-VOID __stdcall _Lazy_wglDeleteBufferRegionARB(HANDLE hRegion)                             {if (GLeeInit()) wglDeleteBufferRegionARB(hRegion);}
-BOOL __stdcall _Lazy_wglSaveBufferRegionARB(HANDLE hRegion, int x, int y, int width, int height)  {if (GLeeInit()) return wglSaveBufferRegionARB(hRegion, x, y, width, height); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglRestoreBufferRegionARB(HANDLE hRegion, int x, int y, int width, int height, int xSrc, int ySrc)  {if (GLeeInit()) return wglRestoreBufferRegionARB(hRegion, x, y, width, height, xSrc, ySrc); return (BOOL)0;}
+HANDLE __stdcall _Lazy_wglCreateBufferRegionARB(HDC hDC, int iLayerPlane, UINT uType)     {if (__GLeeLazyLink((void**)&pwglCreateBufferRegionARB, "wglCreateBufferRegionARB", &_GLEE_WGL_ARB_buffer_region, "WGL_ARB_buffer_region")) return wglCreateBufferRegionARB(hDC, iLayerPlane, uType); return (HANDLE)0;}
+VOID __stdcall _Lazy_wglDeleteBufferRegionARB(HANDLE hRegion)                             {if (__GLeeLazyLink((void**)&pwglDeleteBufferRegionARB, "wglDeleteBufferRegionARB", &_GLEE_WGL_ARB_buffer_region, "WGL_ARB_buffer_region")) wglDeleteBufferRegionARB(hRegion);}
+BOOL __stdcall _Lazy_wglSaveBufferRegionARB(HANDLE hRegion, int x, int y, int width, int height)  {if (__GLeeLazyLink((void**)&pwglSaveBufferRegionARB, "wglSaveBufferRegionARB", &_GLEE_WGL_ARB_buffer_region, "WGL_ARB_buffer_region")) return wglSaveBufferRegionARB(hRegion, x, y, width, height); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglRestoreBufferRegionARB(HANDLE hRegion, int x, int y, int width, int height, int xSrc, int ySrc)  {if (__GLeeLazyLink((void**)&pwglRestoreBufferRegionARB, "wglRestoreBufferRegionARB", &_GLEE_WGL_ARB_buffer_region, "WGL_ARB_buffer_region")) return wglRestoreBufferRegionARB(hRegion, x, y, width, height, xSrc, ySrc); return (BOOL)0;}
 PFNWGLCREATEBUFFERREGIONARBPROC pwglCreateBufferRegionARB=_Lazy_wglCreateBufferRegionARB;
 PFNWGLDELETEBUFFERREGIONARBPROC pwglDeleteBufferRegionARB=_Lazy_wglDeleteBufferRegionARB;
 PFNWGLSAVEBUFFERREGIONARBPROC pwglSaveBufferRegionARB=_Lazy_wglSaveBufferRegionARB;
@@ -4300,16 +4332,16 @@ PFNWGLRESTOREBUFFERREGIONARBPROC pwglRestoreBufferRegionARB=_Lazy_wglRestoreBuff
 //WGL_ARB_extensions_string
 
 #ifdef __GLEE_WGL_ARB_extensions_string
-const char * __stdcall _Lazy_wglGetExtensionsStringARB(HDC hdc)                           {if (GLeeInit()) return wglGetExtensionsStringARB(hdc); return (const char *)0;}
+const char * __stdcall _Lazy_wglGetExtensionsStringARB(HDC hdc)                           {if (__GLeeLazyLink((void**)&pwglGetExtensionsStringARB, "wglGetExtensionsStringARB", &_GLEE_WGL_ARB_extensions_string, "WGL_ARB_extensions_string")) return wglGetExtensionsStringARB(hdc); return (const char *)0;}
 PFNWGLGETEXTENSIONSSTRINGARBPROC pwglGetExtensionsStringARB=_Lazy_wglGetExtensionsStringARB;
 #endif 
 
 //WGL_ARB_pixel_format
 
 #ifdef __GLEE_WGL_ARB_pixel_format
-BOOL __stdcall _Lazy_wglGetPixelFormatAttribivARB(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int * piAttributes, int * piValues)  {if (GLeeInit()) return wglGetPixelFormatAttribivARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetPixelFormatAttribfvARB(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int * piAttributes, FLOAT * pfValues)  {if (GLeeInit()) return wglGetPixelFormatAttribfvARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglChoosePixelFormatARB(HDC hdc, const int * piAttribIList, const FLOAT * pfAttribFList, UINT nMaxFormats, int * piFormats, UINT * nNumFormats)  {if (GLeeInit()) return wglChoosePixelFormatARB(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetPixelFormatAttribivARB(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int * piAttributes, int * piValues)  {if (__GLeeLazyLink((void**)&pwglGetPixelFormatAttribivARB, "wglGetPixelFormatAttribivARB", &_GLEE_WGL_ARB_pixel_format, "WGL_ARB_pixel_format")) return wglGetPixelFormatAttribivARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetPixelFormatAttribfvARB(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int * piAttributes, FLOAT * pfValues)  {if (__GLeeLazyLink((void**)&pwglGetPixelFormatAttribfvARB, "wglGetPixelFormatAttribfvARB", &_GLEE_WGL_ARB_pixel_format, "WGL_ARB_pixel_format")) return wglGetPixelFormatAttribfvARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglChoosePixelFormatARB(HDC hdc, const int * piAttribIList, const FLOAT * pfAttribFList, UINT nMaxFormats, int * piFormats, UINT * nNumFormats)  {if (__GLeeLazyLink((void**)&pwglChoosePixelFormatARB, "wglChoosePixelFormatARB", &_GLEE_WGL_ARB_pixel_format, "WGL_ARB_pixel_format")) return wglChoosePixelFormatARB(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats); return (BOOL)0;}
 PFNWGLGETPIXELFORMATATTRIBIVARBPROC pwglGetPixelFormatAttribivARB=_Lazy_wglGetPixelFormatAttribivARB;
 PFNWGLGETPIXELFORMATATTRIBFVARBPROC pwglGetPixelFormatAttribfvARB=_Lazy_wglGetPixelFormatAttribfvARB;
 PFNWGLCHOOSEPIXELFORMATARBPROC pwglChoosePixelFormatARB=_Lazy_wglChoosePixelFormatARB;
@@ -4318,8 +4350,8 @@ PFNWGLCHOOSEPIXELFORMATARBPROC pwglChoosePixelFormatARB=_Lazy_wglChoosePixelForm
 //WGL_ARB_make_current_read
 
 #ifdef __GLEE_WGL_ARB_make_current_read
-BOOL __stdcall _Lazy_wglMakeContextCurrentARB(HDC hDrawDC, HDC hReadDC, HGLRC hglrc)      {if (GLeeInit()) return wglMakeContextCurrentARB(hDrawDC, hReadDC, hglrc); return (BOOL)0;}
-HDC __stdcall _Lazy_wglGetCurrentReadDCARB(void)                                          {if (GLeeInit()) return wglGetCurrentReadDCARB(); return (HDC)0;}
+BOOL __stdcall _Lazy_wglMakeContextCurrentARB(HDC hDrawDC, HDC hReadDC, HGLRC hglrc)      {if (__GLeeLazyLink((void**)&pwglMakeContextCurrentARB, "wglMakeContextCurrentARB", &_GLEE_WGL_ARB_make_current_read, "WGL_ARB_make_current_read")) return wglMakeContextCurrentARB(hDrawDC, hReadDC, hglrc); return (BOOL)0;}
+HDC __stdcall _Lazy_wglGetCurrentReadDCARB(void)                                          {if (__GLeeLazyLink((void**)&pwglGetCurrentReadDCARB, "wglGetCurrentReadDCARB", &_GLEE_WGL_ARB_make_current_read, "WGL_ARB_make_current_read")) return wglGetCurrentReadDCARB(); return (HDC)0;}
 PFNWGLMAKECONTEXTCURRENTARBPROC pwglMakeContextCurrentARB=_Lazy_wglMakeContextCurrentARB;
 PFNWGLGETCURRENTREADDCARBPROC pwglGetCurrentReadDCARB=_Lazy_wglGetCurrentReadDCARB;
 #endif 
@@ -4327,11 +4359,11 @@ PFNWGLGETCURRENTREADDCARBPROC pwglGetCurrentReadDCARB=_Lazy_wglGetCurrentReadDCA
 //WGL_ARB_pbuffer
 
 #ifdef __GLEE_WGL_ARB_pbuffer
-HPBUFFERARB __stdcall _Lazy_wglCreatePbufferARB(HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int * piAttribList)  {if (GLeeInit()) return wglCreatePbufferARB(hDC, iPixelFormat, iWidth, iHeight, piAttribList); return (HPBUFFERARB)0;}
-HDC __stdcall _Lazy_wglGetPbufferDCARB(HPBUFFERARB hPbuffer)                              {if (GLeeInit()) return wglGetPbufferDCARB(hPbuffer); return (HDC)0;}
-int __stdcall _Lazy_wglReleasePbufferDCARB(HPBUFFERARB hPbuffer, HDC hDC)                 {if (GLeeInit()) return wglReleasePbufferDCARB(hPbuffer, hDC); return (int)0;}
-BOOL __stdcall _Lazy_wglDestroyPbufferARB(HPBUFFERARB hPbuffer)                           {if (GLeeInit()) return wglDestroyPbufferARB(hPbuffer); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglQueryPbufferARB(HPBUFFERARB hPbuffer, int iAttribute, int * piValue)  {if (GLeeInit()) return wglQueryPbufferARB(hPbuffer, iAttribute, piValue); return (BOOL)0;}
+HPBUFFERARB __stdcall _Lazy_wglCreatePbufferARB(HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int * piAttribList)  {if (__GLeeLazyLink((void**)&pwglCreatePbufferARB, "wglCreatePbufferARB", &_GLEE_WGL_ARB_pbuffer, "WGL_ARB_pbuffer")) return wglCreatePbufferARB(hDC, iPixelFormat, iWidth, iHeight, piAttribList); return (HPBUFFERARB)0;}
+HDC __stdcall _Lazy_wglGetPbufferDCARB(HPBUFFERARB hPbuffer)                              {if (__GLeeLazyLink((void**)&pwglGetPbufferDCARB, "wglGetPbufferDCARB", &_GLEE_WGL_ARB_pbuffer, "WGL_ARB_pbuffer")) return wglGetPbufferDCARB(hPbuffer); return (HDC)0;}
+int __stdcall _Lazy_wglReleasePbufferDCARB(HPBUFFERARB hPbuffer, HDC hDC)                 {if (__GLeeLazyLink((void**)&pwglReleasePbufferDCARB, "wglReleasePbufferDCARB", &_GLEE_WGL_ARB_pbuffer, "WGL_ARB_pbuffer")) return wglReleasePbufferDCARB(hPbuffer, hDC); return (int)0;}
+BOOL __stdcall _Lazy_wglDestroyPbufferARB(HPBUFFERARB hPbuffer)                           {if (__GLeeLazyLink((void**)&pwglDestroyPbufferARB, "wglDestroyPbufferARB", &_GLEE_WGL_ARB_pbuffer, "WGL_ARB_pbuffer")) return wglDestroyPbufferARB(hPbuffer); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglQueryPbufferARB(HPBUFFERARB hPbuffer, int iAttribute, int * piValue)  {if (__GLeeLazyLink((void**)&pwglQueryPbufferARB, "wglQueryPbufferARB", &_GLEE_WGL_ARB_pbuffer, "WGL_ARB_pbuffer")) return wglQueryPbufferARB(hPbuffer, iAttribute, piValue); return (BOOL)0;}
 PFNWGLCREATEPBUFFERARBPROC pwglCreatePbufferARB=_Lazy_wglCreatePbufferARB;
 PFNWGLGETPBUFFERDCARBPROC pwglGetPbufferDCARB=_Lazy_wglGetPbufferDCARB;
 PFNWGLRELEASEPBUFFERDCARBPROC pwglReleasePbufferDCARB=_Lazy_wglReleasePbufferDCARB;
@@ -4342,9 +4374,9 @@ PFNWGLQUERYPBUFFERARBPROC pwglQueryPbufferARB=_Lazy_wglQueryPbufferARB;
 //WGL_ARB_render_texture
 
 #ifdef __GLEE_WGL_ARB_render_texture
-BOOL __stdcall _Lazy_wglBindTexImageARB(HPBUFFERARB hPbuffer, int iBuffer)                {if (GLeeInit()) return wglBindTexImageARB(hPbuffer, iBuffer); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglReleaseTexImageARB(HPBUFFERARB hPbuffer, int iBuffer)             {if (GLeeInit()) return wglReleaseTexImageARB(hPbuffer, iBuffer); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglSetPbufferAttribARB(HPBUFFERARB hPbuffer, const int * piAttribList)  {if (GLeeInit()) return wglSetPbufferAttribARB(hPbuffer, piAttribList); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglBindTexImageARB(HPBUFFERARB hPbuffer, int iBuffer)                {if (__GLeeLazyLink((void**)&pwglBindTexImageARB, "wglBindTexImageARB", &_GLEE_WGL_ARB_render_texture, "WGL_ARB_render_texture")) return wglBindTexImageARB(hPbuffer, iBuffer); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglReleaseTexImageARB(HPBUFFERARB hPbuffer, int iBuffer)             {if (__GLeeLazyLink((void**)&pwglReleaseTexImageARB, "wglReleaseTexImageARB", &_GLEE_WGL_ARB_render_texture, "WGL_ARB_render_texture")) return wglReleaseTexImageARB(hPbuffer, iBuffer); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglSetPbufferAttribARB(HPBUFFERARB hPbuffer, const int * piAttribList)  {if (__GLeeLazyLink((void**)&pwglSetPbufferAttribARB, "wglSetPbufferAttribARB", &_GLEE_WGL_ARB_render_texture, "WGL_ARB_render_texture")) return wglSetPbufferAttribARB(hPbuffer, piAttribList); return (BOOL)0;}
 PFNWGLBINDTEXIMAGEARBPROC pwglBindTexImageARB=_Lazy_wglBindTexImageARB;
 PFNWGLRELEASETEXIMAGEARBPROC pwglReleaseTexImageARB=_Lazy_wglReleaseTexImageARB;
 PFNWGLSETPBUFFERATTRIBARBPROC pwglSetPbufferAttribARB=_Lazy_wglSetPbufferAttribARB;
@@ -4358,8 +4390,8 @@ PFNWGLSETPBUFFERATTRIBARBPROC pwglSetPbufferAttribARB=_Lazy_wglSetPbufferAttribA
 //WGL_EXT_make_current_read
 
 #ifdef __GLEE_WGL_EXT_make_current_read
-BOOL __stdcall _Lazy_wglMakeContextCurrentEXT(HDC hDrawDC, HDC hReadDC, HGLRC hglrc)      {if (GLeeInit()) return wglMakeContextCurrentEXT(hDrawDC, hReadDC, hglrc); return (BOOL)0;}
-HDC __stdcall _Lazy_wglGetCurrentReadDCEXT(void)                                          {if (GLeeInit()) return wglGetCurrentReadDCEXT(); return (HDC)0;}
+BOOL __stdcall _Lazy_wglMakeContextCurrentEXT(HDC hDrawDC, HDC hReadDC, HGLRC hglrc)      {if (__GLeeLazyLink((void**)&pwglMakeContextCurrentEXT, "wglMakeContextCurrentEXT", &_GLEE_WGL_EXT_make_current_read, "WGL_EXT_make_current_read")) return wglMakeContextCurrentEXT(hDrawDC, hReadDC, hglrc); return (BOOL)0;}
+HDC __stdcall _Lazy_wglGetCurrentReadDCEXT(void)                                          {if (__GLeeLazyLink((void**)&pwglGetCurrentReadDCEXT, "wglGetCurrentReadDCEXT", &_GLEE_WGL_EXT_make_current_read, "WGL_EXT_make_current_read")) return wglGetCurrentReadDCEXT(); return (HDC)0;}
 PFNWGLMAKECONTEXTCURRENTEXTPROC pwglMakeContextCurrentEXT=_Lazy_wglMakeContextCurrentEXT;
 PFNWGLGETCURRENTREADDCEXTPROC pwglGetCurrentReadDCEXT=_Lazy_wglGetCurrentReadDCEXT;
 #endif 
@@ -4367,9 +4399,9 @@ PFNWGLGETCURRENTREADDCEXTPROC pwglGetCurrentReadDCEXT=_Lazy_wglGetCurrentReadDCE
 //WGL_EXT_pixel_format
 
 #ifdef __GLEE_WGL_EXT_pixel_format
-BOOL __stdcall _Lazy_wglGetPixelFormatAttribivEXT(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int * piAttributes, int * piValues)  {if (GLeeInit()) return wglGetPixelFormatAttribivEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetPixelFormatAttribfvEXT(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int * piAttributes, FLOAT * pfValues)  {if (GLeeInit()) return wglGetPixelFormatAttribfvEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglChoosePixelFormatEXT(HDC hdc, const int * piAttribIList, const FLOAT * pfAttribFList, UINT nMaxFormats, int * piFormats, UINT * nNumFormats)  {if (GLeeInit()) return wglChoosePixelFormatEXT(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetPixelFormatAttribivEXT(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int * piAttributes, int * piValues)  {if (__GLeeLazyLink((void**)&pwglGetPixelFormatAttribivEXT, "wglGetPixelFormatAttribivEXT", &_GLEE_WGL_EXT_pixel_format, "WGL_EXT_pixel_format")) return wglGetPixelFormatAttribivEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetPixelFormatAttribfvEXT(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int * piAttributes, FLOAT * pfValues)  {if (__GLeeLazyLink((void**)&pwglGetPixelFormatAttribfvEXT, "wglGetPixelFormatAttribfvEXT", &_GLEE_WGL_EXT_pixel_format, "WGL_EXT_pixel_format")) return wglGetPixelFormatAttribfvEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglChoosePixelFormatEXT(HDC hdc, const int * piAttribIList, const FLOAT * pfAttribFList, UINT nMaxFormats, int * piFormats, UINT * nNumFormats)  {if (__GLeeLazyLink((void**)&pwglChoosePixelFormatEXT, "wglChoosePixelFormatEXT", &_GLEE_WGL_EXT_pixel_format, "WGL_EXT_pixel_format")) return wglChoosePixelFormatEXT(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats); return (BOOL)0;}
 PFNWGLGETPIXELFORMATATTRIBIVEXTPROC pwglGetPixelFormatAttribivEXT=_Lazy_wglGetPixelFormatAttribivEXT;
 PFNWGLGETPIXELFORMATATTRIBFVEXTPROC pwglGetPixelFormatAttribfvEXT=_Lazy_wglGetPixelFormatAttribfvEXT;
 PFNWGLCHOOSEPIXELFORMATEXTPROC pwglChoosePixelFormatEXT=_Lazy_wglChoosePixelFormatEXT;
@@ -4378,11 +4410,11 @@ PFNWGLCHOOSEPIXELFORMATEXTPROC pwglChoosePixelFormatEXT=_Lazy_wglChoosePixelForm
 //WGL_EXT_pbuffer
 
 #ifdef __GLEE_WGL_EXT_pbuffer
-HPBUFFEREXT __stdcall _Lazy_wglCreatePbufferEXT(HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int * piAttribList)  {if (GLeeInit()) return wglCreatePbufferEXT(hDC, iPixelFormat, iWidth, iHeight, piAttribList); return (HPBUFFEREXT)0;}
-HDC __stdcall _Lazy_wglGetPbufferDCEXT(HPBUFFEREXT hPbuffer)                              {if (GLeeInit()) return wglGetPbufferDCEXT(hPbuffer); return (HDC)0;}
-int __stdcall _Lazy_wglReleasePbufferDCEXT(HPBUFFEREXT hPbuffer, HDC hDC)                 {if (GLeeInit()) return wglReleasePbufferDCEXT(hPbuffer, hDC); return (int)0;}
-BOOL __stdcall _Lazy_wglDestroyPbufferEXT(HPBUFFEREXT hPbuffer)                           {if (GLeeInit()) return wglDestroyPbufferEXT(hPbuffer); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglQueryPbufferEXT(HPBUFFEREXT hPbuffer, int iAttribute, int * piValue)  {if (GLeeInit()) return wglQueryPbufferEXT(hPbuffer, iAttribute, piValue); return (BOOL)0;}
+HPBUFFEREXT __stdcall _Lazy_wglCreatePbufferEXT(HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int * piAttribList)  {if (__GLeeLazyLink((void**)&pwglCreatePbufferEXT, "wglCreatePbufferEXT", &_GLEE_WGL_EXT_pbuffer, "WGL_EXT_pbuffer")) return wglCreatePbufferEXT(hDC, iPixelFormat, iWidth, iHeight, piAttribList); return (HPBUFFEREXT)0;}
+HDC __stdcall _Lazy_wglGetPbufferDCEXT(HPBUFFEREXT hPbuffer)                              {if (__GLeeLazyLink((void**)&pwglGetPbufferDCEXT, "wglGetPbufferDCEXT", &_GLEE_WGL_EXT_pbuffer, "WGL_EXT_pbuffer")) return wglGetPbufferDCEXT(hPbuffer); return (HDC)0;}
+int __stdcall _Lazy_wglReleasePbufferDCEXT(HPBUFFEREXT hPbuffer, HDC hDC)                 {if (__GLeeLazyLink((void**)&pwglReleasePbufferDCEXT, "wglReleasePbufferDCEXT", &_GLEE_WGL_EXT_pbuffer, "WGL_EXT_pbuffer")) return wglReleasePbufferDCEXT(hPbuffer, hDC); return (int)0;}
+BOOL __stdcall _Lazy_wglDestroyPbufferEXT(HPBUFFEREXT hPbuffer)                           {if (__GLeeLazyLink((void**)&pwglDestroyPbufferEXT, "wglDestroyPbufferEXT", &_GLEE_WGL_EXT_pbuffer, "WGL_EXT_pbuffer")) return wglDestroyPbufferEXT(hPbuffer); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglQueryPbufferEXT(HPBUFFEREXT hPbuffer, int iAttribute, int * piValue)  {if (__GLeeLazyLink((void**)&pwglQueryPbufferEXT, "wglQueryPbufferEXT", &_GLEE_WGL_EXT_pbuffer, "WGL_EXT_pbuffer")) return wglQueryPbufferEXT(hPbuffer, iAttribute, piValue); return (BOOL)0;}
 PFNWGLCREATEPBUFFEREXTPROC pwglCreatePbufferEXT=_Lazy_wglCreatePbufferEXT;
 PFNWGLGETPBUFFERDCEXTPROC pwglGetPbufferDCEXT=_Lazy_wglGetPbufferDCEXT;
 PFNWGLRELEASEPBUFFERDCEXTPROC pwglReleasePbufferDCEXT=_Lazy_wglReleasePbufferDCEXT;
@@ -4408,8 +4440,8 @@ PFNWGLQUERYPBUFFEREXTPROC pwglQueryPbufferEXT=_Lazy_wglQueryPbufferEXT;
 //WGL_I3D_digital_video_control
 
 #ifdef __GLEE_WGL_I3D_digital_video_control
-BOOL __stdcall _Lazy_wglGetDigitalVideoParametersI3D(HDC hDC, int iAttribute, int * piValue)  {if (GLeeInit()) return wglGetDigitalVideoParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglSetDigitalVideoParametersI3D(HDC hDC, int iAttribute, const int * piValue)  {if (GLeeInit()) return wglSetDigitalVideoParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetDigitalVideoParametersI3D(HDC hDC, int iAttribute, int * piValue)  {if (__GLeeLazyLink((void**)&pwglGetDigitalVideoParametersI3D, "wglGetDigitalVideoParametersI3D", &_GLEE_WGL_I3D_digital_video_control, "WGL_I3D_digital_video_control")) return wglGetDigitalVideoParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglSetDigitalVideoParametersI3D(HDC hDC, int iAttribute, const int * piValue)  {if (__GLeeLazyLink((void**)&pwglSetDigitalVideoParametersI3D, "wglSetDigitalVideoParametersI3D", &_GLEE_WGL_I3D_digital_video_control, "WGL_I3D_digital_video_control")) return wglSetDigitalVideoParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
 PFNWGLGETDIGITALVIDEOPARAMETERSI3DPROC pwglGetDigitalVideoParametersI3D=_Lazy_wglGetDigitalVideoParametersI3D;
 PFNWGLSETDIGITALVIDEOPARAMETERSI3DPROC pwglSetDigitalVideoParametersI3D=_Lazy_wglSetDigitalVideoParametersI3D;
 #endif 
@@ -4417,10 +4449,10 @@ PFNWGLSETDIGITALVIDEOPARAMETERSI3DPROC pwglSetDigitalVideoParametersI3D=_Lazy_wg
 //WGL_I3D_gamma
 
 #ifdef __GLEE_WGL_I3D_gamma
-BOOL __stdcall _Lazy_wglGetGammaTableParametersI3D(HDC hDC, int iAttribute, int * piValue)  {if (GLeeInit()) return wglGetGammaTableParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglSetGammaTableParametersI3D(HDC hDC, int iAttribute, const int * piValue)  {if (GLeeInit()) return wglSetGammaTableParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetGammaTableI3D(HDC hDC, int iEntries, USHORT * puRed, USHORT * puGreen, USHORT * puBlue)  {if (GLeeInit()) return wglGetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglSetGammaTableI3D(HDC hDC, int iEntries, const USHORT * puRed, const USHORT * puGreen, const USHORT * puBlue)  {if (GLeeInit()) return wglSetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGammaTableParametersI3D(HDC hDC, int iAttribute, int * piValue)  {if (__GLeeLazyLink((void**)&pwglGetGammaTableParametersI3D, "wglGetGammaTableParametersI3D", &_GLEE_WGL_I3D_gamma, "WGL_I3D_gamma")) return wglGetGammaTableParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglSetGammaTableParametersI3D(HDC hDC, int iAttribute, const int * piValue)  {if (__GLeeLazyLink((void**)&pwglSetGammaTableParametersI3D, "wglSetGammaTableParametersI3D", &_GLEE_WGL_I3D_gamma, "WGL_I3D_gamma")) return wglSetGammaTableParametersI3D(hDC, iAttribute, piValue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGammaTableI3D(HDC hDC, int iEntries, USHORT * puRed, USHORT * puGreen, USHORT * puBlue)  {if (__GLeeLazyLink((void**)&pwglGetGammaTableI3D, "wglGetGammaTableI3D", &_GLEE_WGL_I3D_gamma, "WGL_I3D_gamma")) return wglGetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglSetGammaTableI3D(HDC hDC, int iEntries, const USHORT * puRed, const USHORT * puGreen, const USHORT * puBlue)  {if (__GLeeLazyLink((void**)&pwglSetGammaTableI3D, "wglSetGammaTableI3D", &_GLEE_WGL_I3D_gamma, "WGL_I3D_gamma")) return wglSetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue); return (BOOL)0;}
 PFNWGLGETGAMMATABLEPARAMETERSI3DPROC pwglGetGammaTableParametersI3D=_Lazy_wglGetGammaTableParametersI3D;
 PFNWGLSETGAMMATABLEPARAMETERSI3DPROC pwglSetGammaTableParametersI3D=_Lazy_wglSetGammaTableParametersI3D;
 PFNWGLGETGAMMATABLEI3DPROC pwglGetGammaTableI3D=_Lazy_wglGetGammaTableI3D;
@@ -4430,18 +4462,18 @@ PFNWGLSETGAMMATABLEI3DPROC pwglSetGammaTableI3D=_Lazy_wglSetGammaTableI3D;
 //WGL_I3D_genlock
 
 #ifdef __GLEE_WGL_I3D_genlock
-BOOL __stdcall _Lazy_wglEnableGenlockI3D(HDC hDC)                                         {if (GLeeInit()) return wglEnableGenlockI3D(hDC); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglDisableGenlockI3D(HDC hDC)                                        {if (GLeeInit()) return wglDisableGenlockI3D(hDC); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglIsEnabledGenlockI3D(HDC hDC, BOOL * pFlag)                        {if (GLeeInit()) return wglIsEnabledGenlockI3D(hDC, pFlag); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGenlockSourceI3D(HDC hDC, UINT uSource)                           {if (GLeeInit()) return wglGenlockSourceI3D(hDC, uSource); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetGenlockSourceI3D(HDC hDC, UINT * uSource)                      {if (GLeeInit()) return wglGetGenlockSourceI3D(hDC, uSource); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGenlockSourceEdgeI3D(HDC hDC, UINT uEdge)                         {if (GLeeInit()) return wglGenlockSourceEdgeI3D(hDC, uEdge); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetGenlockSourceEdgeI3D(HDC hDC, UINT * uEdge)                    {if (GLeeInit()) return wglGetGenlockSourceEdgeI3D(hDC, uEdge); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGenlockSampleRateI3D(HDC hDC, UINT uRate)                         {if (GLeeInit()) return wglGenlockSampleRateI3D(hDC, uRate); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetGenlockSampleRateI3D(HDC hDC, UINT * uRate)                    {if (GLeeInit()) return wglGetGenlockSampleRateI3D(hDC, uRate); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGenlockSourceDelayI3D(HDC hDC, UINT uDelay)                       {if (GLeeInit()) return wglGenlockSourceDelayI3D(hDC, uDelay); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetGenlockSourceDelayI3D(HDC hDC, UINT * uDelay)                  {if (GLeeInit()) return wglGetGenlockSourceDelayI3D(hDC, uDelay); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglQueryGenlockMaxSourceDelayI3D(HDC hDC, UINT * uMaxLineDelay, UINT * uMaxPixelDelay)  {if (GLeeInit()) return wglQueryGenlockMaxSourceDelayI3D(hDC, uMaxLineDelay, uMaxPixelDelay); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglEnableGenlockI3D(HDC hDC)                                         {if (__GLeeLazyLink((void**)&pwglEnableGenlockI3D, "wglEnableGenlockI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglEnableGenlockI3D(hDC); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglDisableGenlockI3D(HDC hDC)                                        {if (__GLeeLazyLink((void**)&pwglDisableGenlockI3D, "wglDisableGenlockI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglDisableGenlockI3D(hDC); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglIsEnabledGenlockI3D(HDC hDC, BOOL * pFlag)                        {if (__GLeeLazyLink((void**)&pwglIsEnabledGenlockI3D, "wglIsEnabledGenlockI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglIsEnabledGenlockI3D(hDC, pFlag); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGenlockSourceI3D(HDC hDC, UINT uSource)                           {if (__GLeeLazyLink((void**)&pwglGenlockSourceI3D, "wglGenlockSourceI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGenlockSourceI3D(hDC, uSource); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGenlockSourceI3D(HDC hDC, UINT * uSource)                      {if (__GLeeLazyLink((void**)&pwglGetGenlockSourceI3D, "wglGetGenlockSourceI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGetGenlockSourceI3D(hDC, uSource); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGenlockSourceEdgeI3D(HDC hDC, UINT uEdge)                         {if (__GLeeLazyLink((void**)&pwglGenlockSourceEdgeI3D, "wglGenlockSourceEdgeI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGenlockSourceEdgeI3D(hDC, uEdge); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGenlockSourceEdgeI3D(HDC hDC, UINT * uEdge)                    {if (__GLeeLazyLink((void**)&pwglGetGenlockSourceEdgeI3D, "wglGetGenlockSourceEdgeI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGetGenlockSourceEdgeI3D(hDC, uEdge); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGenlockSampleRateI3D(HDC hDC, UINT uRate)                         {if (__GLeeLazyLink((void**)&pwglGenlockSampleRateI3D, "wglGenlockSampleRateI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGenlockSampleRateI3D(hDC, uRate); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGenlockSampleRateI3D(HDC hDC, UINT * uRate)                    {if (__GLeeLazyLink((void**)&pwglGetGenlockSampleRateI3D, "wglGetGenlockSampleRateI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGetGenlockSampleRateI3D(hDC, uRate); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGenlockSourceDelayI3D(HDC hDC, UINT uDelay)                       {if (__GLeeLazyLink((void**)&pwglGenlockSourceDelayI3D, "wglGenlockSourceDelayI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGenlockSourceDelayI3D(hDC, uDelay); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetGenlockSourceDelayI3D(HDC hDC, UINT * uDelay)                  {if (__GLeeLazyLink((void**)&pwglGetGenlockSourceDelayI3D, "wglGetGenlockSourceDelayI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglGetGenlockSourceDelayI3D(hDC, uDelay); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglQueryGenlockMaxSourceDelayI3D(HDC hDC, UINT * uMaxLineDelay, UINT * uMaxPixelDelay)  {if (__GLeeLazyLink((void**)&pwglQueryGenlockMaxSourceDelayI3D, "wglQueryGenlockMaxSourceDelayI3D", &_GLEE_WGL_I3D_genlock, "WGL_I3D_genlock")) return wglQueryGenlockMaxSourceDelayI3D(hDC, uMaxLineDelay, uMaxPixelDelay); return (BOOL)0;}
 PFNWGLENABLEGENLOCKI3DPROC pwglEnableGenlockI3D=_Lazy_wglEnableGenlockI3D;
 PFNWGLDISABLEGENLOCKI3DPROC pwglDisableGenlockI3D=_Lazy_wglDisableGenlockI3D;
 PFNWGLISENABLEDGENLOCKI3DPROC pwglIsEnabledGenlockI3D=_Lazy_wglIsEnabledGenlockI3D;
@@ -4459,10 +4491,10 @@ PFNWGLQUERYGENLOCKMAXSOURCEDELAYI3DPROC pwglQueryGenlockMaxSourceDelayI3D=_Lazy_
 //WGL_I3D_image_buffer
 
 #ifdef __GLEE_WGL_I3D_image_buffer
-LPVOID __stdcall _Lazy_wglCreateImageBufferI3D(HDC hDC, DWORD dwSize, UINT uFlags)        {if (GLeeInit()) return wglCreateImageBufferI3D(hDC, dwSize, uFlags); return (LPVOID)0;}
-BOOL __stdcall _Lazy_wglDestroyImageBufferI3D(HDC hDC, LPVOID pAddress)                   {if (GLeeInit()) return wglDestroyImageBufferI3D(hDC, pAddress); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglAssociateImageBufferEventsI3D(HDC hDC, const HANDLE * pEvent, const LPVOID * pAddress, const DWORD * pSize, UINT count)  {if (GLeeInit()) return wglAssociateImageBufferEventsI3D(hDC, pEvent, pAddress, pSize, count); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglReleaseImageBufferEventsI3D(HDC hDC, const LPVOID * pAddress, UINT count)  {if (GLeeInit()) return wglReleaseImageBufferEventsI3D(hDC, pAddress, count); return (BOOL)0;}
+LPVOID __stdcall _Lazy_wglCreateImageBufferI3D(HDC hDC, DWORD dwSize, UINT uFlags)        {if (__GLeeLazyLink((void**)&pwglCreateImageBufferI3D, "wglCreateImageBufferI3D", &_GLEE_WGL_I3D_image_buffer, "WGL_I3D_image_buffer")) return wglCreateImageBufferI3D(hDC, dwSize, uFlags); return (LPVOID)0;}
+BOOL __stdcall _Lazy_wglDestroyImageBufferI3D(HDC hDC, LPVOID pAddress)                   {if (__GLeeLazyLink((void**)&pwglDestroyImageBufferI3D, "wglDestroyImageBufferI3D", &_GLEE_WGL_I3D_image_buffer, "WGL_I3D_image_buffer")) return wglDestroyImageBufferI3D(hDC, pAddress); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglAssociateImageBufferEventsI3D(HDC hDC, const HANDLE * pEvent, const LPVOID * pAddress, const DWORD * pSize, UINT count)  {if (__GLeeLazyLink((void**)&pwglAssociateImageBufferEventsI3D, "wglAssociateImageBufferEventsI3D", &_GLEE_WGL_I3D_image_buffer, "WGL_I3D_image_buffer")) return wglAssociateImageBufferEventsI3D(hDC, pEvent, pAddress, pSize, count); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglReleaseImageBufferEventsI3D(HDC hDC, const LPVOID * pAddress, UINT count)  {if (__GLeeLazyLink((void**)&pwglReleaseImageBufferEventsI3D, "wglReleaseImageBufferEventsI3D", &_GLEE_WGL_I3D_image_buffer, "WGL_I3D_image_buffer")) return wglReleaseImageBufferEventsI3D(hDC, pAddress, count); return (BOOL)0;}
 PFNWGLCREATEIMAGEBUFFERI3DPROC pwglCreateImageBufferI3D=_Lazy_wglCreateImageBufferI3D;
 PFNWGLDESTROYIMAGEBUFFERI3DPROC pwglDestroyImageBufferI3D=_Lazy_wglDestroyImageBufferI3D;
 PFNWGLASSOCIATEIMAGEBUFFEREVENTSI3DPROC pwglAssociateImageBufferEventsI3D=_Lazy_wglAssociateImageBufferEventsI3D;
@@ -4472,10 +4504,10 @@ PFNWGLRELEASEIMAGEBUFFEREVENTSI3DPROC pwglReleaseImageBufferEventsI3D=_Lazy_wglR
 //WGL_I3D_swap_frame_lock
 
 #ifdef __GLEE_WGL_I3D_swap_frame_lock
-BOOL __stdcall _Lazy_wglEnableFrameLockI3D(void)                                          {if (GLeeInit()) return wglEnableFrameLockI3D(); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglDisableFrameLockI3D(void)                                         {if (GLeeInit()) return wglDisableFrameLockI3D(); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglIsEnabledFrameLockI3D(BOOL * pFlag)                               {if (GLeeInit()) return wglIsEnabledFrameLockI3D(pFlag); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglQueryFrameLockMasterI3D(BOOL * pFlag)                             {if (GLeeInit()) return wglQueryFrameLockMasterI3D(pFlag); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglEnableFrameLockI3D(void)                                          {if (__GLeeLazyLink((void**)&pwglEnableFrameLockI3D, "wglEnableFrameLockI3D", &_GLEE_WGL_I3D_swap_frame_lock, "WGL_I3D_swap_frame_lock")) return wglEnableFrameLockI3D(); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglDisableFrameLockI3D(void)                                         {if (__GLeeLazyLink((void**)&pwglDisableFrameLockI3D, "wglDisableFrameLockI3D", &_GLEE_WGL_I3D_swap_frame_lock, "WGL_I3D_swap_frame_lock")) return wglDisableFrameLockI3D(); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglIsEnabledFrameLockI3D(BOOL * pFlag)                               {if (__GLeeLazyLink((void**)&pwglIsEnabledFrameLockI3D, "wglIsEnabledFrameLockI3D", &_GLEE_WGL_I3D_swap_frame_lock, "WGL_I3D_swap_frame_lock")) return wglIsEnabledFrameLockI3D(pFlag); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglQueryFrameLockMasterI3D(BOOL * pFlag)                             {if (__GLeeLazyLink((void**)&pwglQueryFrameLockMasterI3D, "wglQueryFrameLockMasterI3D", &_GLEE_WGL_I3D_swap_frame_lock, "WGL_I3D_swap_frame_lock")) return wglQueryFrameLockMasterI3D(pFlag); return (BOOL)0;}
 PFNWGLENABLEFRAMELOCKI3DPROC pwglEnableFrameLockI3D=_Lazy_wglEnableFrameLockI3D;
 PFNWGLDISABLEFRAMELOCKI3DPROC pwglDisableFrameLockI3D=_Lazy_wglDisableFrameLockI3D;
 PFNWGLISENABLEDFRAMELOCKI3DPROC pwglIsEnabledFrameLockI3D=_Lazy_wglIsEnabledFrameLockI3D;
@@ -4505,10 +4537,10 @@ PFNWGLQUERYFRAMELOCKMASTERI3DPROC pwglQueryFrameLockMasterI3D=_Lazy_wglQueryFram
 //WGL_EXT_display_color_table
 
 #ifdef __GLEE_WGL_EXT_display_color_table
-GLboolean __stdcall _Lazy_wglCreateDisplayColorTableEXT(GLushort id)                      {if (GLeeInit()) return wglCreateDisplayColorTableEXT(id); return (GLboolean)0;}
-GLboolean __stdcall _Lazy_wglLoadDisplayColorTableEXT(const GLushort * table, GLuint length)  {if (GLeeInit()) return wglLoadDisplayColorTableEXT(table, length); return (GLboolean)0;}
-GLboolean __stdcall _Lazy_wglBindDisplayColorTableEXT(GLushort id)                        {if (GLeeInit()) return wglBindDisplayColorTableEXT(id); return (GLboolean)0;}
-VOID __stdcall _Lazy_wglDestroyDisplayColorTableEXT(GLushort id)                          {if (GLeeInit()) wglDestroyDisplayColorTableEXT(id);}
+GLboolean __stdcall _Lazy_wglCreateDisplayColorTableEXT(GLushort id)                      {if (__GLeeLazyLink((void**)&pwglCreateDisplayColorTableEXT, "wglCreateDisplayColorTableEXT", &_GLEE_WGL_EXT_display_color_table, "WGL_EXT_display_color_table")) return wglCreateDisplayColorTableEXT(id); return (GLboolean)0;}
+GLboolean __stdcall _Lazy_wglLoadDisplayColorTableEXT(const GLushort * table, GLuint length)  {if (__GLeeLazyLink((void**)&pwglLoadDisplayColorTableEXT, "wglLoadDisplayColorTableEXT", &_GLEE_WGL_EXT_display_color_table, "WGL_EXT_display_color_table")) return wglLoadDisplayColorTableEXT(table, length); return (GLboolean)0;}
+GLboolean __stdcall _Lazy_wglBindDisplayColorTableEXT(GLushort id)                        {if (__GLeeLazyLink((void**)&pwglBindDisplayColorTableEXT, "wglBindDisplayColorTableEXT", &_GLEE_WGL_EXT_display_color_table, "WGL_EXT_display_color_table")) return wglBindDisplayColorTableEXT(id); return (GLboolean)0;}
+VOID __stdcall _Lazy_wglDestroyDisplayColorTableEXT(GLushort id)                          {if (__GLeeLazyLink((void**)&pwglDestroyDisplayColorTableEXT, "wglDestroyDisplayColorTableEXT", &_GLEE_WGL_EXT_display_color_table, "WGL_EXT_display_color_table")) wglDestroyDisplayColorTableEXT(id);}
 PFNWGLCREATEDISPLAYCOLORTABLEEXTPROC pwglCreateDisplayColorTableEXT=_Lazy_wglCreateDisplayColorTableEXT;
 PFNWGLLOADDISPLAYCOLORTABLEEXTPROC pwglLoadDisplayColorTableEXT=_Lazy_wglLoadDisplayColorTableEXT;
 PFNWGLBINDDISPLAYCOLORTABLEEXTPROC pwglBindDisplayColorTableEXT=_Lazy_wglBindDisplayColorTableEXT;
@@ -4518,15 +4550,15 @@ PFNWGLDESTROYDISPLAYCOLORTABLEEXTPROC pwglDestroyDisplayColorTableEXT=_Lazy_wglD
 //WGL_EXT_extensions_string
 
 #ifdef __GLEE_WGL_EXT_extensions_string
-const char * __stdcall _Lazy_wglGetExtensionsStringEXT(void)                              {if (GLeeInit()) return wglGetExtensionsStringEXT(); return (const char *)0;}
+const char * __stdcall _Lazy_wglGetExtensionsStringEXT(void)                              {if (__GLeeLazyLink((void**)&pwglGetExtensionsStringEXT, "wglGetExtensionsStringEXT", &_GLEE_WGL_EXT_extensions_string, "WGL_EXT_extensions_string")) return wglGetExtensionsStringEXT(); return (const char *)0;}
 PFNWGLGETEXTENSIONSSTRINGEXTPROC pwglGetExtensionsStringEXT=_Lazy_wglGetExtensionsStringEXT;
 #endif 
 
 //WGL_EXT_swap_control
 
 #ifdef __GLEE_WGL_EXT_swap_control
-BOOL __stdcall _Lazy_wglSwapIntervalEXT(int interval)                                     {if (GLeeInit()) return wglSwapIntervalEXT(interval); return (BOOL)0;}
-int __stdcall _Lazy_wglGetSwapIntervalEXT(void)                                           {if (GLeeInit()) return wglGetSwapIntervalEXT(); return (int)0;}
+BOOL __stdcall _Lazy_wglSwapIntervalEXT(int interval)                                     {if (__GLeeLazyLink((void**)&pwglSwapIntervalEXT, "wglSwapIntervalEXT", &_GLEE_WGL_EXT_swap_control, "WGL_EXT_swap_control")) return wglSwapIntervalEXT(interval); return (BOOL)0;}
+int __stdcall _Lazy_wglGetSwapIntervalEXT(void)                                           {if (__GLeeLazyLink((void**)&pwglGetSwapIntervalEXT, "wglGetSwapIntervalEXT", &_GLEE_WGL_EXT_swap_control, "WGL_EXT_swap_control")) return wglGetSwapIntervalEXT(); return (int)0;}
 PFNWGLSWAPINTERVALEXTPROC pwglSwapIntervalEXT=_Lazy_wglSwapIntervalEXT;
 PFNWGLGETSWAPINTERVALEXTPROC pwglGetSwapIntervalEXT=_Lazy_wglGetSwapIntervalEXT;
 #endif 
@@ -4534,8 +4566,8 @@ PFNWGLGETSWAPINTERVALEXTPROC pwglGetSwapIntervalEXT=_Lazy_wglGetSwapIntervalEXT;
 //WGL_NV_vertex_array_range
 
 #ifdef __GLEE_WGL_NV_vertex_array_range
-void* __stdcall _Lazy_wglAllocateMemoryNV(GLsizei size, GLfloat readfreq, GLfloat writefreq, GLfloat priority)  {if (GLeeInit()) return wglAllocateMemoryNV(size, readfreq, writefreq, priority); return (void*)0;}
-void __stdcall _Lazy_wglFreeMemoryNV(void * pointer)                                      {if (GLeeInit()) wglFreeMemoryNV(pointer);}
+void* __stdcall _Lazy_wglAllocateMemoryNV(GLsizei size, GLfloat readfreq, GLfloat writefreq, GLfloat priority)  {if (__GLeeLazyLink((void**)&pwglAllocateMemoryNV, "wglAllocateMemoryNV", &_GLEE_WGL_NV_vertex_array_range, "WGL_NV_vertex_array_range")) return wglAllocateMemoryNV(size, readfreq, writefreq, priority); return (void*)0;}
+void __stdcall _Lazy_wglFreeMemoryNV(void * pointer)                                      {if (__GLeeLazyLink((void**)&pwglFreeMemoryNV, "wglFreeMemoryNV", &_GLEE_WGL_NV_vertex_array_range, "WGL_NV_vertex_array_range")) wglFreeMemoryNV(pointer);}
 PFNWGLALLOCATEMEMORYNVPROC pwglAllocateMemoryNV=_Lazy_wglAllocateMemoryNV;
 PFNWGLFREEMEMORYNVPROC pwglFreeMemoryNV=_Lazy_wglFreeMemoryNV;
 #endif 
@@ -4543,12 +4575,12 @@ PFNWGLFREEMEMORYNVPROC pwglFreeMemoryNV=_Lazy_wglFreeMemoryNV;
 //WGL_OML_sync_control
 
 #ifdef __GLEE_WGL_OML_sync_control
-BOOL __stdcall _Lazy_wglGetSyncValuesOML(HDC hdc, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (GLeeInit()) return wglGetSyncValuesOML(hdc, ust, msc, sbc); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglGetMscRateOML(HDC hdc, INT32 * numerator, INT32 * denominator)    {if (GLeeInit()) return wglGetMscRateOML(hdc, numerator, denominator); return (BOOL)0;}
-INT64 __stdcall _Lazy_wglSwapBuffersMscOML(HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder)  {if (GLeeInit()) return wglSwapBuffersMscOML(hdc, target_msc, divisor, remainder); return (INT64)0;}
-INT64 __stdcall _Lazy_wglSwapLayerBuffersMscOML(HDC hdc, int fuPlanes, INT64 target_msc, INT64 divisor, INT64 remainder)  {if (GLeeInit()) return wglSwapLayerBuffersMscOML(hdc, fuPlanes, target_msc, divisor, remainder); return (INT64)0;}
-BOOL __stdcall _Lazy_wglWaitForMscOML(HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (GLeeInit()) return wglWaitForMscOML(hdc, target_msc, divisor, remainder, ust, msc, sbc); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglWaitForSbcOML(HDC hdc, INT64 target_sbc, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (GLeeInit()) return wglWaitForSbcOML(hdc, target_sbc, ust, msc, sbc); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetSyncValuesOML(HDC hdc, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (__GLeeLazyLink((void**)&pwglGetSyncValuesOML, "wglGetSyncValuesOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglGetSyncValuesOML(hdc, ust, msc, sbc); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetMscRateOML(HDC hdc, INT32 * numerator, INT32 * denominator)    {if (__GLeeLazyLink((void**)&pwglGetMscRateOML, "wglGetMscRateOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglGetMscRateOML(hdc, numerator, denominator); return (BOOL)0;}
+INT64 __stdcall _Lazy_wglSwapBuffersMscOML(HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder)  {if (__GLeeLazyLink((void**)&pwglSwapBuffersMscOML, "wglSwapBuffersMscOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglSwapBuffersMscOML(hdc, target_msc, divisor, remainder); return (INT64)0;}
+INT64 __stdcall _Lazy_wglSwapLayerBuffersMscOML(HDC hdc, int fuPlanes, INT64 target_msc, INT64 divisor, INT64 remainder)  {if (__GLeeLazyLink((void**)&pwglSwapLayerBuffersMscOML, "wglSwapLayerBuffersMscOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglSwapLayerBuffersMscOML(hdc, fuPlanes, target_msc, divisor, remainder); return (INT64)0;}
+BOOL __stdcall _Lazy_wglWaitForMscOML(HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (__GLeeLazyLink((void**)&pwglWaitForMscOML, "wglWaitForMscOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglWaitForMscOML(hdc, target_msc, divisor, remainder, ust, msc, sbc); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglWaitForSbcOML(HDC hdc, INT64 target_sbc, INT64 * ust, INT64 * msc, INT64 * sbc)  {if (__GLeeLazyLink((void**)&pwglWaitForSbcOML, "wglWaitForSbcOML", &_GLEE_WGL_OML_sync_control, "WGL_OML_sync_control")) return wglWaitForSbcOML(hdc, target_sbc, ust, msc, sbc); return (BOOL)0;}
 PFNWGLGETSYNCVALUESOMLPROC pwglGetSyncValuesOML=_Lazy_wglGetSyncValuesOML;
 PFNWGLGETMSCRATEOMLPROC pwglGetMscRateOML=_Lazy_wglGetMscRateOML;
 PFNWGLSWAPBUFFERSMSCOMLPROC pwglSwapBuffersMscOML=_Lazy_wglSwapBuffersMscOML;
@@ -4560,10 +4592,10 @@ PFNWGLWAITFORSBCOMLPROC pwglWaitForSbcOML=_Lazy_wglWaitForSbcOML;
 //WGL_I3D_swap_frame_usage
 
 #ifdef __GLEE_WGL_I3D_swap_frame_usage
-BOOL __stdcall _Lazy_wglGetFrameUsageI3D(float * pUsage)                                  {if (GLeeInit()) return wglGetFrameUsageI3D(pUsage); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglBeginFrameTrackingI3D(void)                                       {if (GLeeInit()) return wglBeginFrameTrackingI3D(); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglEndFrameTrackingI3D(void)                                         {if (GLeeInit()) return wglEndFrameTrackingI3D(); return (BOOL)0;}
-BOOL __stdcall _Lazy_wglQueryFrameTrackingI3D(DWORD * pFrameCount, DWORD * pMissedFrames, float * pLastMissedUsage)  {if (GLeeInit()) return wglQueryFrameTrackingI3D(pFrameCount, pMissedFrames, pLastMissedUsage); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglGetFrameUsageI3D(float * pUsage)                                  {if (__GLeeLazyLink((void**)&pwglGetFrameUsageI3D, "wglGetFrameUsageI3D", &_GLEE_WGL_I3D_swap_frame_usage, "WGL_I3D_swap_frame_usage")) return wglGetFrameUsageI3D(pUsage); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglBeginFrameTrackingI3D(void)                                       {if (__GLeeLazyLink((void**)&pwglBeginFrameTrackingI3D, "wglBeginFrameTrackingI3D", &_GLEE_WGL_I3D_swap_frame_usage, "WGL_I3D_swap_frame_usage")) return wglBeginFrameTrackingI3D(); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglEndFrameTrackingI3D(void)                                         {if (__GLeeLazyLink((void**)&pwglEndFrameTrackingI3D, "wglEndFrameTrackingI3D", &_GLEE_WGL_I3D_swap_frame_usage, "WGL_I3D_swap_frame_usage")) return wglEndFrameTrackingI3D(); return (BOOL)0;}
+BOOL __stdcall _Lazy_wglQueryFrameTrackingI3D(DWORD * pFrameCount, DWORD * pMissedFrames, float * pLastMissedUsage)  {if (__GLeeLazyLink((void**)&pwglQueryFrameTrackingI3D, "wglQueryFrameTrackingI3D", &_GLEE_WGL_I3D_swap_frame_usage, "WGL_I3D_swap_frame_usage")) return wglQueryFrameTrackingI3D(pFrameCount, pMissedFrames, pLastMissedUsage); return (BOOL)0;}
 PFNWGLGETFRAMEUSAGEI3DPROC pwglGetFrameUsageI3D=_Lazy_wglGetFrameUsageI3D;
 PFNWGLBEGINFRAMETRACKINGI3DPROC pwglBeginFrameTrackingI3D=_Lazy_wglBeginFrameTrackingI3D;
 PFNWGLENDFRAMETRACKINGI3DPROC pwglEndFrameTrackingI3D=_Lazy_wglEndFrameTrackingI3D;
@@ -4646,24 +4678,24 @@ int __GLeeGLXNumExtensions=32;
 //GLX_VERSION_1_3
 
 #ifdef __GLEE_GLX_VERSION_1_3
-GLXFBConfig * __stdcall _Lazy_glXGetFBConfigs(Display * dpy, int screen, int * nelements)  {if (GLeeInit()) return glXGetFBConfigs(dpy, screen, nelements); return (GLXFBConfig *)0;}
-GLXFBConfig * __stdcall _Lazy_glXChooseFBConfig(Display * dpy, int screen, const int * attrib_list, int * nelements)  {if (GLeeInit()) return glXChooseFBConfig(dpy, screen, attrib_list, nelements); return (GLXFBConfig *)0;}
-int __stdcall _Lazy_glXGetFBConfigAttrib(Display * dpy, GLXFBConfig config, int attribute, int * value)  {if (GLeeInit()) return glXGetFBConfigAttrib(dpy, config, attribute, value); return (int)0;}
-XVisualInfo * __stdcall _Lazy_glXGetVisualFromFBConfig(Display * dpy, GLXFBConfig config)  {if (GLeeInit()) return glXGetVisualFromFBConfig(dpy, config); return (XVisualInfo *)0;}
-GLXWindow __stdcall _Lazy_glXCreateWindow(Display * dpy, GLXFBConfig config, Window win, const int * attrib_list)  {if (GLeeInit()) return glXCreateWindow(dpy, config, win, attrib_list); return (GLXWindow)0;}
-void __stdcall _Lazy_glXDestroyWindow(Display * dpy, GLXWindow win)                       {if (GLeeInit()) glXDestroyWindow(dpy, win);}
-GLXPixmap __stdcall _Lazy_glXCreatePixmap(Display * dpy, GLXFBConfig config, Pixmap pixmap, const int * attrib_list)  {if (GLeeInit()) return glXCreatePixmap(dpy, config, pixmap, attrib_list); return (GLXPixmap)0;}
-void __stdcall _Lazy_glXDestroyPixmap(Display * dpy, GLXPixmap pixmap)                    {if (GLeeInit()) glXDestroyPixmap(dpy, pixmap);}
-GLXPbuffer __stdcall _Lazy_glXCreatePbuffer(Display * dpy, GLXFBConfig config, const int * attrib_list)  {if (GLeeInit()) return glXCreatePbuffer(dpy, config, attrib_list); return (GLXPbuffer)0;}
-void __stdcall _Lazy_glXDestroyPbuffer(Display * dpy, GLXPbuffer pbuf)                    {if (GLeeInit()) glXDestroyPbuffer(dpy, pbuf);}
-void __stdcall _Lazy_glXQueryDrawable(Display * dpy, GLXDrawable draw, int attribute, unsigned int * value)  {if (GLeeInit()) glXQueryDrawable(dpy, draw, attribute, value);}
-GLXContext __stdcall _Lazy_glXCreateNewContext(Display * dpy, GLXFBConfig config, int render_type, GLXContext share_list, Bool direct)  {if (GLeeInit()) return glXCreateNewContext(dpy, config, render_type, share_list, direct); return (GLXContext)0;}
-Bool __stdcall _Lazy_glXMakeContextCurrent(Display * dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)  {if (GLeeInit()) return glXMakeContextCurrent(dpy, draw, read, ctx); return (Bool)0;}
-GLXDrawable __stdcall _Lazy_glXGetCurrentReadDrawable(void)                               {if (GLeeInit()) return glXGetCurrentReadDrawable(); return (GLXDrawable)0;}
-Display * __stdcall _Lazy_glXGetCurrentDisplay(void)                                      {if (GLeeInit()) return glXGetCurrentDisplay(); return (Display *)0;}
-int __stdcall _Lazy_glXQueryContext(Display * dpy, GLXContext ctx, int attribute, int * value)  {if (GLeeInit()) return glXQueryContext(dpy, ctx, attribute, value); return (int)0;}
-void __stdcall _Lazy_glXSelectEvent(Display * dpy, GLXDrawable draw, unsigned long event_mask)  {if (GLeeInit()) glXSelectEvent(dpy, draw, event_mask);}
-void __stdcall _Lazy_glXGetSelectedEvent(Display * dpy, GLXDrawable draw, unsigned long * event_mask)  {if (GLeeInit()) glXGetSelectedEvent(dpy, draw, event_mask);}
+GLXFBConfig * __stdcall _Lazy_glXGetFBConfigs(Display * dpy, int screen, int * nelements)  {if (__GLeeLazyLink((void**)&pglXGetFBConfigs, "glXGetFBConfigs", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXGetFBConfigs(dpy, screen, nelements); return (GLXFBConfig *)0;}
+GLXFBConfig * __stdcall _Lazy_glXChooseFBConfig(Display * dpy, int screen, const int * attrib_list, int * nelements)  {if (__GLeeLazyLink((void**)&pglXChooseFBConfig, "glXChooseFBConfig", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXChooseFBConfig(dpy, screen, attrib_list, nelements); return (GLXFBConfig *)0;}
+int __stdcall _Lazy_glXGetFBConfigAttrib(Display * dpy, GLXFBConfig config, int attribute, int * value)  {if (__GLeeLazyLink((void**)&pglXGetFBConfigAttrib, "glXGetFBConfigAttrib", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXGetFBConfigAttrib(dpy, config, attribute, value); return (int)0;}
+XVisualInfo * __stdcall _Lazy_glXGetVisualFromFBConfig(Display * dpy, GLXFBConfig config)  {if (__GLeeLazyLink((void**)&pglXGetVisualFromFBConfig, "glXGetVisualFromFBConfig", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXGetVisualFromFBConfig(dpy, config); return (XVisualInfo *)0;}
+GLXWindow __stdcall _Lazy_glXCreateWindow(Display * dpy, GLXFBConfig config, Window win, const int * attrib_list)  {if (__GLeeLazyLink((void**)&pglXCreateWindow, "glXCreateWindow", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXCreateWindow(dpy, config, win, attrib_list); return (GLXWindow)0;}
+void __stdcall _Lazy_glXDestroyWindow(Display * dpy, GLXWindow win)                       {if (__GLeeLazyLink((void**)&pglXDestroyWindow, "glXDestroyWindow", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXDestroyWindow(dpy, win);}
+GLXPixmap __stdcall _Lazy_glXCreatePixmap(Display * dpy, GLXFBConfig config, Pixmap pixmap, const int * attrib_list)  {if (__GLeeLazyLink((void**)&pglXCreatePixmap, "glXCreatePixmap", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXCreatePixmap(dpy, config, pixmap, attrib_list); return (GLXPixmap)0;}
+void __stdcall _Lazy_glXDestroyPixmap(Display * dpy, GLXPixmap pixmap)                    {if (__GLeeLazyLink((void**)&pglXDestroyPixmap, "glXDestroyPixmap", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXDestroyPixmap(dpy, pixmap);}
+GLXPbuffer __stdcall _Lazy_glXCreatePbuffer(Display * dpy, GLXFBConfig config, const int * attrib_list)  {if (__GLeeLazyLink((void**)&pglXCreatePbuffer, "glXCreatePbuffer", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXCreatePbuffer(dpy, config, attrib_list); return (GLXPbuffer)0;}
+void __stdcall _Lazy_glXDestroyPbuffer(Display * dpy, GLXPbuffer pbuf)                    {if (__GLeeLazyLink((void**)&pglXDestroyPbuffer, "glXDestroyPbuffer", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXDestroyPbuffer(dpy, pbuf);}
+void __stdcall _Lazy_glXQueryDrawable(Display * dpy, GLXDrawable draw, int attribute, unsigned int * value)  {if (__GLeeLazyLink((void**)&pglXQueryDrawable, "glXQueryDrawable", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXQueryDrawable(dpy, draw, attribute, value);}
+GLXContext __stdcall _Lazy_glXCreateNewContext(Display * dpy, GLXFBConfig config, int render_type, GLXContext share_list, Bool direct)  {if (__GLeeLazyLink((void**)&pglXCreateNewContext, "glXCreateNewContext", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXCreateNewContext(dpy, config, render_type, share_list, direct); return (GLXContext)0;}
+Bool __stdcall _Lazy_glXMakeContextCurrent(Display * dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)  {if (__GLeeLazyLink((void**)&pglXMakeContextCurrent, "glXMakeContextCurrent", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXMakeContextCurrent(dpy, draw, read, ctx); return (Bool)0;}
+GLXDrawable __stdcall _Lazy_glXGetCurrentReadDrawable(void)                               {if (__GLeeLazyLink((void**)&pglXGetCurrentReadDrawable, "glXGetCurrentReadDrawable", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXGetCurrentReadDrawable(); return (GLXDrawable)0;}
+Display * __stdcall _Lazy_glXGetCurrentDisplay(void)                                      {if (__GLeeLazyLink((void**)&pglXGetCurrentDisplay, "glXGetCurrentDisplay", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXGetCurrentDisplay(); return (Display *)0;}
+int __stdcall _Lazy_glXQueryContext(Display * dpy, GLXContext ctx, int attribute, int * value)  {if (__GLeeLazyLink((void**)&pglXQueryContext, "glXQueryContext", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) return glXQueryContext(dpy, ctx, attribute, value); return (int)0;}
+void __stdcall _Lazy_glXSelectEvent(Display * dpy, GLXDrawable draw, unsigned long event_mask)  {if (__GLeeLazyLink((void**)&pglXSelectEvent, "glXSelectEvent", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXSelectEvent(dpy, draw, event_mask);}
+void __stdcall _Lazy_glXGetSelectedEvent(Display * dpy, GLXDrawable draw, unsigned long * event_mask)  {if (__GLeeLazyLink((void**)&pglXGetSelectedEvent, "glXGetSelectedEvent", &_GLEE_GLX_VERSION_1_3, "GLX_VERSION_1_3")) glXGetSelectedEvent(dpy, draw, event_mask);}
 PFNGLXGETFBCONFIGSPROC pglXGetFBConfigs=_Lazy_glXGetFBConfigs;
 PFNGLXCHOOSEFBCONFIGPROC pglXChooseFBConfig=_Lazy_glXChooseFBConfig;
 PFNGLXGETFBCONFIGATTRIBPROC pglXGetFBConfigAttrib=_Lazy_glXGetFBConfigAttrib;
@@ -4687,7 +4719,7 @@ PFNGLXGETSELECTEDEVENTPROC pglXGetSelectedEvent=_Lazy_glXGetSelectedEvent;
 //GLX_VERSION_1_4
 
 #ifdef __GLEE_GLX_VERSION_1_4
-__GLXextFuncPtr __stdcall _Lazy_glXGetProcAddress(const GLubyte * procName)               {if (GLeeInit()) return glXGetProcAddress(procName); return (__GLXextFuncPtr)0;}
+__GLXextFuncPtr __stdcall _Lazy_glXGetProcAddress(const GLubyte * procName)               {if (__GLeeLazyLink((void**)&pglXGetProcAddress, "glXGetProcAddress", &_GLEE_GLX_VERSION_1_4, "GLX_VERSION_1_4")) return glXGetProcAddress(procName); return (__GLXextFuncPtr)0;}
 PFNGLXGETPROCADDRESSPROC pglXGetProcAddress=_Lazy_glXGetProcAddress;
 #endif 
 
@@ -4714,15 +4746,15 @@ PFNGLXGETPROCADDRESSPROC pglXGetProcAddress=_Lazy_glXGetProcAddress;
 //GLX_SGI_swap_control
 
 #ifdef __GLEE_GLX_SGI_swap_control
-int __stdcall _Lazy_glXSwapIntervalSGI(int interval)                                      {if (GLeeInit()) return glXSwapIntervalSGI(interval); return (int)0;}
+int __stdcall _Lazy_glXSwapIntervalSGI(int interval)                                      {if (__GLeeLazyLink((void**)&pglXSwapIntervalSGI, "glXSwapIntervalSGI", &_GLEE_GLX_SGI_swap_control, "GLX_SGI_swap_control")) return glXSwapIntervalSGI(interval); return (int)0;}
 PFNGLXSWAPINTERVALSGIPROC pglXSwapIntervalSGI=_Lazy_glXSwapIntervalSGI;
 #endif 
 
 //GLX_SGI_video_sync
 
 #ifdef __GLEE_GLX_SGI_video_sync
-int __stdcall _Lazy_glXGetVideoSyncSGI(unsigned int * count)                              {if (GLeeInit()) return glXGetVideoSyncSGI(count); return (int)0;}
-int __stdcall _Lazy_glXWaitVideoSyncSGI(int divisor, int remainder, unsigned int * count)  {if (GLeeInit()) return glXWaitVideoSyncSGI(divisor, remainder, count); return (int)0;}
+int __stdcall _Lazy_glXGetVideoSyncSGI(unsigned int * count)                              {if (__GLeeLazyLink((void**)&pglXGetVideoSyncSGI, "glXGetVideoSyncSGI", &_GLEE_GLX_SGI_video_sync, "GLX_SGI_video_sync")) return glXGetVideoSyncSGI(count); return (int)0;}
+int __stdcall _Lazy_glXWaitVideoSyncSGI(int divisor, int remainder, unsigned int * count)  {if (__GLeeLazyLink((void**)&pglXWaitVideoSyncSGI, "glXWaitVideoSyncSGI", &_GLEE_GLX_SGI_video_sync, "GLX_SGI_video_sync")) return glXWaitVideoSyncSGI(divisor, remainder, count); return (int)0;}
 PFNGLXGETVIDEOSYNCSGIPROC pglXGetVideoSyncSGI=_Lazy_glXGetVideoSyncSGI;
 PFNGLXWAITVIDEOSYNCSGIPROC pglXWaitVideoSyncSGI=_Lazy_glXWaitVideoSyncSGI;
 #endif 
@@ -4730,8 +4762,8 @@ PFNGLXWAITVIDEOSYNCSGIPROC pglXWaitVideoSyncSGI=_Lazy_glXWaitVideoSyncSGI;
 //GLX_SGI_make_current_read
 
 #ifdef __GLEE_GLX_SGI_make_current_read
-Bool __stdcall _Lazy_glXMakeCurrentReadSGI(Display * dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)  {if (GLeeInit()) return glXMakeCurrentReadSGI(dpy, draw, read, ctx); return (Bool)0;}
-GLXDrawable __stdcall _Lazy_glXGetCurrentReadDrawableSGI(void)                            {if (GLeeInit()) return glXGetCurrentReadDrawableSGI(); return (GLXDrawable)0;}
+Bool __stdcall _Lazy_glXMakeCurrentReadSGI(Display * dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)  {if (__GLeeLazyLink((void**)&pglXMakeCurrentReadSGI, "glXMakeCurrentReadSGI", &_GLEE_GLX_SGI_make_current_read, "GLX_SGI_make_current_read")) return glXMakeCurrentReadSGI(dpy, draw, read, ctx); return (Bool)0;}
+GLXDrawable __stdcall _Lazy_glXGetCurrentReadDrawableSGI(void)                            {if (__GLeeLazyLink((void**)&pglXGetCurrentReadDrawableSGI, "glXGetCurrentReadDrawableSGI", &_GLEE_GLX_SGI_make_current_read, "GLX_SGI_make_current_read")) return glXGetCurrentReadDrawableSGI(); return (GLXDrawable)0;}
 PFNGLXMAKECURRENTREADSGIPROC pglXMakeCurrentReadSGI=_Lazy_glXMakeCurrentReadSGI;
 PFNGLXGETCURRENTREADDRAWABLESGIPROC pglXGetCurrentReadDrawableSGI=_Lazy_glXGetCurrentReadDrawableSGI;
 #endif 
@@ -4744,11 +4776,11 @@ PFNGLXGETCURRENTREADDRAWABLESGIPROC pglXGetCurrentReadDrawableSGI=_Lazy_glXGetCu
 //GLX_EXT_import_context
 
 #ifdef __GLEE_GLX_EXT_import_context
-Display * __stdcall _Lazy_glXGetCurrentDisplayEXT(void)                                   {if (GLeeInit()) return glXGetCurrentDisplayEXT(); return (Display *)0;}
-int __stdcall _Lazy_glXQueryContextInfoEXT(Display * dpy, GLXContext context, int attribute, int * value)  {if (GLeeInit()) return glXQueryContextInfoEXT(dpy, context, attribute, value); return (int)0;}
-GLXContextID __stdcall _Lazy_glXGetContextIDEXT(const GLXContext context)                 {if (GLeeInit()) return glXGetContextIDEXT(context); return (GLXContextID)0;}
-GLXContext __stdcall _Lazy_glXImportContextEXT(Display * dpy, GLXContextID contextID)     {if (GLeeInit()) return glXImportContextEXT(dpy, contextID); return (GLXContext)0;}
-void __stdcall _Lazy_glXFreeContextEXT(Display * dpy, GLXContext context)                 {if (GLeeInit()) glXFreeContextEXT(dpy, context);}
+Display * __stdcall _Lazy_glXGetCurrentDisplayEXT(void)                                   {if (__GLeeLazyLink((void**)&pglXGetCurrentDisplayEXT, "glXGetCurrentDisplayEXT", &_GLEE_GLX_EXT_import_context, "GLX_EXT_import_context")) return glXGetCurrentDisplayEXT(); return (Display *)0;}
+int __stdcall _Lazy_glXQueryContextInfoEXT(Display * dpy, GLXContext context, int attribute, int * value)  {if (__GLeeLazyLink((void**)&pglXQueryContextInfoEXT, "glXQueryContextInfoEXT", &_GLEE_GLX_EXT_import_context, "GLX_EXT_import_context")) return glXQueryContextInfoEXT(dpy, context, attribute, value); return (int)0;}
+GLXContextID __stdcall _Lazy_glXGetContextIDEXT(const GLXContext context)                 {if (__GLeeLazyLink((void**)&pglXGetContextIDEXT, "glXGetContextIDEXT", &_GLEE_GLX_EXT_import_context, "GLX_EXT_import_context")) return glXGetContextIDEXT(context); return (GLXContextID)0;}
+GLXContext __stdcall _Lazy_glXImportContextEXT(Display * dpy, GLXContextID contextID)     {if (__GLeeLazyLink((void**)&pglXImportContextEXT, "glXImportContextEXT", &_GLEE_GLX_EXT_import_context, "GLX_EXT_import_context")) return glXImportContextEXT(dpy, contextID); return (GLXContext)0;}
+void __stdcall _Lazy_glXFreeContextEXT(Display * dpy, GLXContext context)                 {if (__GLeeLazyLink((void**)&pglXFreeContextEXT, "glXFreeContextEXT", &_GLEE_GLX_EXT_import_context, "GLX_EXT_import_context")) glXFreeContextEXT(dpy, context);}
 PFNGLXGETCURRENTDISPLAYEXTPROC pglXGetCurrentDisplayEXT=_Lazy_glXGetCurrentDisplayEXT;
 PFNGLXQUERYCONTEXTINFOEXTPROC pglXQueryContextInfoEXT=_Lazy_glXQueryContextInfoEXT;
 PFNGLXGETCONTEXTIDEXTPROC pglXGetContextIDEXT=_Lazy_glXGetContextIDEXT;
@@ -4759,12 +4791,12 @@ PFNGLXFREECONTEXTEXTPROC pglXFreeContextEXT=_Lazy_glXFreeContextEXT;
 //GLX_SGIX_fbconfig
 
 #ifdef __GLEE_GLX_SGIX_fbconfig
-int __stdcall _Lazy_glXGetFBConfigAttribSGIX(Display * dpy, GLXFBConfigSGIX config, int attribute, int * value)  {if (GLeeInit()) return glXGetFBConfigAttribSGIX(dpy, config, attribute, value); return (int)0;}
-GLXFBConfigSGIX * __stdcall _Lazy_glXChooseFBConfigSGIX(Display * dpy, int screen, int * attrib_list, int * nelements)  {if (GLeeInit()) return glXChooseFBConfigSGIX(dpy, screen, attrib_list, nelements); return (GLXFBConfigSGIX *)0;}
-GLXPixmap __stdcall _Lazy_glXCreateGLXPixmapWithConfigSGIX(Display * dpy, GLXFBConfigSGIX config, Pixmap pixmap)  {if (GLeeInit()) return glXCreateGLXPixmapWithConfigSGIX(dpy, config, pixmap); return (GLXPixmap)0;}
-GLXContext __stdcall _Lazy_glXCreateContextWithConfigSGIX(Display * dpy, GLXFBConfigSGIX config, int render_type, GLXContext share_list, Bool direct)  {if (GLeeInit()) return glXCreateContextWithConfigSGIX(dpy, config, render_type, share_list, direct); return (GLXContext)0;}
-XVisualInfo * __stdcall _Lazy_glXGetVisualFromFBConfigSGIX(Display * dpy, GLXFBConfigSGIX config)  {if (GLeeInit()) return glXGetVisualFromFBConfigSGIX(dpy, config); return (XVisualInfo *)0;}
-GLXFBConfigSGIX __stdcall _Lazy_glXGetFBConfigFromVisualSGIX(Display * dpy, XVisualInfo * vis)  {if (GLeeInit()) return glXGetFBConfigFromVisualSGIX(dpy, vis); return (GLXFBConfigSGIX)0;}
+int __stdcall _Lazy_glXGetFBConfigAttribSGIX(Display * dpy, GLXFBConfigSGIX config, int attribute, int * value)  {if (__GLeeLazyLink((void**)&pglXGetFBConfigAttribSGIX, "glXGetFBConfigAttribSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXGetFBConfigAttribSGIX(dpy, config, attribute, value); return (int)0;}
+GLXFBConfigSGIX * __stdcall _Lazy_glXChooseFBConfigSGIX(Display * dpy, int screen, int * attrib_list, int * nelements)  {if (__GLeeLazyLink((void**)&pglXChooseFBConfigSGIX, "glXChooseFBConfigSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXChooseFBConfigSGIX(dpy, screen, attrib_list, nelements); return (GLXFBConfigSGIX *)0;}
+GLXPixmap __stdcall _Lazy_glXCreateGLXPixmapWithConfigSGIX(Display * dpy, GLXFBConfigSGIX config, Pixmap pixmap)  {if (__GLeeLazyLink((void**)&pglXCreateGLXPixmapWithConfigSGIX, "glXCreateGLXPixmapWithConfigSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXCreateGLXPixmapWithConfigSGIX(dpy, config, pixmap); return (GLXPixmap)0;}
+GLXContext __stdcall _Lazy_glXCreateContextWithConfigSGIX(Display * dpy, GLXFBConfigSGIX config, int render_type, GLXContext share_list, Bool direct)  {if (__GLeeLazyLink((void**)&pglXCreateContextWithConfigSGIX, "glXCreateContextWithConfigSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXCreateContextWithConfigSGIX(dpy, config, render_type, share_list, direct); return (GLXContext)0;}
+XVisualInfo * __stdcall _Lazy_glXGetVisualFromFBConfigSGIX(Display * dpy, GLXFBConfigSGIX config)  {if (__GLeeLazyLink((void**)&pglXGetVisualFromFBConfigSGIX, "glXGetVisualFromFBConfigSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXGetVisualFromFBConfigSGIX(dpy, config); return (XVisualInfo *)0;}
+GLXFBConfigSGIX __stdcall _Lazy_glXGetFBConfigFromVisualSGIX(Display * dpy, XVisualInfo * vis)  {if (__GLeeLazyLink((void**)&pglXGetFBConfigFromVisualSGIX, "glXGetFBConfigFromVisualSGIX", &_GLEE_GLX_SGIX_fbconfig, "GLX_SGIX_fbconfig")) return glXGetFBConfigFromVisualSGIX(dpy, vis); return (GLXFBConfigSGIX)0;}
 PFNGLXGETFBCONFIGATTRIBSGIXPROC pglXGetFBConfigAttribSGIX=_Lazy_glXGetFBConfigAttribSGIX;
 PFNGLXCHOOSEFBCONFIGSGIXPROC pglXChooseFBConfigSGIX=_Lazy_glXChooseFBConfigSGIX;
 PFNGLXCREATEGLXPIXMAPWITHCONFIGSGIXPROC pglXCreateGLXPixmapWithConfigSGIX=_Lazy_glXCreateGLXPixmapWithConfigSGIX;
@@ -4776,11 +4808,11 @@ PFNGLXGETFBCONFIGFROMVISUALSGIXPROC pglXGetFBConfigFromVisualSGIX=_Lazy_glXGetFB
 //GLX_SGIX_pbuffer
 
 #ifdef __GLEE_GLX_SGIX_pbuffer
-GLXPbufferSGIX __stdcall _Lazy_glXCreateGLXPbufferSGIX(Display * dpy, GLXFBConfigSGIX config, unsigned int width, unsigned int height, int * attrib_list)  {if (GLeeInit()) return glXCreateGLXPbufferSGIX(dpy, config, width, height, attrib_list); return (GLXPbufferSGIX)0;}
-void __stdcall _Lazy_glXDestroyGLXPbufferSGIX(Display * dpy, GLXPbufferSGIX pbuf)         {if (GLeeInit()) glXDestroyGLXPbufferSGIX(dpy, pbuf);}
-int __stdcall _Lazy_glXQueryGLXPbufferSGIX(Display * dpy, GLXPbufferSGIX pbuf, int attribute, unsigned int * value)  {if (GLeeInit()) return glXQueryGLXPbufferSGIX(dpy, pbuf, attribute, value); return (int)0;}
-void __stdcall _Lazy_glXSelectEventSGIX(Display * dpy, GLXDrawable drawable, unsigned long mask)  {if (GLeeInit()) glXSelectEventSGIX(dpy, drawable, mask);}
-void __stdcall _Lazy_glXGetSelectedEventSGIX(Display * dpy, GLXDrawable drawable, unsigned long * mask)  {if (GLeeInit()) glXGetSelectedEventSGIX(dpy, drawable, mask);}
+GLXPbufferSGIX __stdcall _Lazy_glXCreateGLXPbufferSGIX(Display * dpy, GLXFBConfigSGIX config, unsigned int width, unsigned int height, int * attrib_list)  {if (__GLeeLazyLink((void**)&pglXCreateGLXPbufferSGIX, "glXCreateGLXPbufferSGIX", &_GLEE_GLX_SGIX_pbuffer, "GLX_SGIX_pbuffer")) return glXCreateGLXPbufferSGIX(dpy, config, width, height, attrib_list); return (GLXPbufferSGIX)0;}
+void __stdcall _Lazy_glXDestroyGLXPbufferSGIX(Display * dpy, GLXPbufferSGIX pbuf)         {if (__GLeeLazyLink((void**)&pglXDestroyGLXPbufferSGIX, "glXDestroyGLXPbufferSGIX", &_GLEE_GLX_SGIX_pbuffer, "GLX_SGIX_pbuffer")) glXDestroyGLXPbufferSGIX(dpy, pbuf);}
+int __stdcall _Lazy_glXQueryGLXPbufferSGIX(Display * dpy, GLXPbufferSGIX pbuf, int attribute, unsigned int * value)  {if (__GLeeLazyLink((void**)&pglXQueryGLXPbufferSGIX, "glXQueryGLXPbufferSGIX", &_GLEE_GLX_SGIX_pbuffer, "GLX_SGIX_pbuffer")) return glXQueryGLXPbufferSGIX(dpy, pbuf, attribute, value); return (int)0;}
+void __stdcall _Lazy_glXSelectEventSGIX(Display * dpy, GLXDrawable drawable, unsigned long mask)  {if (__GLeeLazyLink((void**)&pglXSelectEventSGIX, "glXSelectEventSGIX", &_GLEE_GLX_SGIX_pbuffer, "GLX_SGIX_pbuffer")) glXSelectEventSGIX(dpy, drawable, mask);}
+void __stdcall _Lazy_glXGetSelectedEventSGIX(Display * dpy, GLXDrawable drawable, unsigned long * mask)  {if (__GLeeLazyLink((void**)&pglXGetSelectedEventSGIX, "glXGetSelectedEventSGIX", &_GLEE_GLX_SGIX_pbuffer, "GLX_SGIX_pbuffer")) glXGetSelectedEventSGIX(dpy, drawable, mask);}
 PFNGLXCREATEGLXPBUFFERSGIXPROC pglXCreateGLXPbufferSGIX=_Lazy_glXCreateGLXPbufferSGIX;
 PFNGLXDESTROYGLXPBUFFERSGIXPROC pglXDestroyGLXPbufferSGIX=_Lazy_glXDestroyGLXPbufferSGIX;
 PFNGLXQUERYGLXPBUFFERSGIXPROC pglXQueryGLXPbufferSGIX=_Lazy_glXQueryGLXPbufferSGIX;
@@ -4791,18 +4823,18 @@ PFNGLXGETSELECTEDEVENTSGIXPROC pglXGetSelectedEventSGIX=_Lazy_glXGetSelectedEven
 //GLX_SGI_cushion
 
 #ifdef __GLEE_GLX_SGI_cushion
-void __stdcall _Lazy_glXCushionSGI(Display * dpy, Window window, float cushion)           {if (GLeeInit()) glXCushionSGI(dpy, window, cushion);}
+void __stdcall _Lazy_glXCushionSGI(Display * dpy, Window window, float cushion)           {if (__GLeeLazyLink((void**)&pglXCushionSGI, "glXCushionSGI", &_GLEE_GLX_SGI_cushion, "GLX_SGI_cushion")) glXCushionSGI(dpy, window, cushion);}
 PFNGLXCUSHIONSGIPROC pglXCushionSGI=_Lazy_glXCushionSGI;
 #endif 
 
 //GLX_SGIX_video_resize
 
 #ifdef __GLEE_GLX_SGIX_video_resize
-int __stdcall _Lazy_glXBindChannelToWindowSGIX(Display * display, int screen, int channel, Window window)  {if (GLeeInit()) return glXBindChannelToWindowSGIX(display, screen, channel, window); return (int)0;}
-int __stdcall _Lazy_glXChannelRectSGIX(Display * display, int screen, int channel, int x, int y, int w, int h)  {if (GLeeInit()) return glXChannelRectSGIX(display, screen, channel, x, y, w, h); return (int)0;}
-int __stdcall _Lazy_glXQueryChannelRectSGIX(Display * display, int screen, int channel, int * dx, int * dy, int * dw, int * dh)  {if (GLeeInit()) return glXQueryChannelRectSGIX(display, screen, channel, dx, dy, dw, dh); return (int)0;}
-int __stdcall _Lazy_glXQueryChannelDeltasSGIX(Display * display, int screen, int channel, int * x, int * y, int * w, int * h)  {if (GLeeInit()) return glXQueryChannelDeltasSGIX(display, screen, channel, x, y, w, h); return (int)0;}
-int __stdcall _Lazy_glXChannelRectSyncSGIX(Display * display, int screen, int channel, GLenum synctype)  {if (GLeeInit()) return glXChannelRectSyncSGIX(display, screen, channel, synctype); return (int)0;}
+int __stdcall _Lazy_glXBindChannelToWindowSGIX(Display * display, int screen, int channel, Window window)  {if (__GLeeLazyLink((void**)&pglXBindChannelToWindowSGIX, "glXBindChannelToWindowSGIX", &_GLEE_GLX_SGIX_video_resize, "GLX_SGIX_video_resize")) return glXBindChannelToWindowSGIX(display, screen, channel, window); return (int)0;}
+int __stdcall _Lazy_glXChannelRectSGIX(Display * display, int screen, int channel, int x, int y, int w, int h)  {if (__GLeeLazyLink((void**)&pglXChannelRectSGIX, "glXChannelRectSGIX", &_GLEE_GLX_SGIX_video_resize, "GLX_SGIX_video_resize")) return glXChannelRectSGIX(display, screen, channel, x, y, w, h); return (int)0;}
+int __stdcall _Lazy_glXQueryChannelRectSGIX(Display * display, int screen, int channel, int * dx, int * dy, int * dw, int * dh)  {if (__GLeeLazyLink((void**)&pglXQueryChannelRectSGIX, "glXQueryChannelRectSGIX", &_GLEE_GLX_SGIX_video_resize, "GLX_SGIX_video_resize")) return glXQueryChannelRectSGIX(display, screen, channel, dx, dy, dw, dh); return (int)0;}
+int __stdcall _Lazy_glXQueryChannelDeltasSGIX(Display * display, int screen, int channel, int * x, int * y, int * w, int * h)  {if (__GLeeLazyLink((void**)&pglXQueryChannelDeltasSGIX, "glXQueryChannelDeltasSGIX", &_GLEE_GLX_SGIX_video_resize, "GLX_SGIX_video_resize")) return glXQueryChannelDeltasSGIX(display, screen, channel, x, y, w, h); return (int)0;}
+int __stdcall _Lazy_glXChannelRectSyncSGIX(Display * display, int screen, int channel, GLenum synctype)  {if (__GLeeLazyLink((void**)&pglXChannelRectSyncSGIX, "glXChannelRectSyncSGIX", &_GLEE_GLX_SGIX_video_resize, "GLX_SGIX_video_resize")) return glXChannelRectSyncSGIX(display, screen, channel, synctype); return (int)0;}
 PFNGLXBINDCHANNELTOWINDOWSGIXPROC pglXBindChannelToWindowSGIX=_Lazy_glXBindChannelToWindowSGIX;
 PFNGLXCHANNELRECTSGIXPROC pglXChannelRectSGIX=_Lazy_glXChannelRectSGIX;
 PFNGLXQUERYCHANNELRECTSGIXPROC pglXQueryChannelRectSGIX=_Lazy_glXQueryChannelRectSGIX;
@@ -4813,15 +4845,15 @@ PFNGLXCHANNELRECTSYNCSGIXPROC pglXChannelRectSyncSGIX=_Lazy_glXChannelRectSyncSG
 //GLX_SGIX_swap_group
 
 #ifdef __GLEE_GLX_SGIX_swap_group
-void __stdcall _Lazy_glXJoinSwapGroupSGIX(Display * dpy, GLXDrawable drawable, GLXDrawable member)  {if (GLeeInit()) glXJoinSwapGroupSGIX(dpy, drawable, member);}
+void __stdcall _Lazy_glXJoinSwapGroupSGIX(Display * dpy, GLXDrawable drawable, GLXDrawable member)  {if (__GLeeLazyLink((void**)&pglXJoinSwapGroupSGIX, "glXJoinSwapGroupSGIX", &_GLEE_GLX_SGIX_swap_group, "GLX_SGIX_swap_group")) glXJoinSwapGroupSGIX(dpy, drawable, member);}
 PFNGLXJOINSWAPGROUPSGIXPROC pglXJoinSwapGroupSGIX=_Lazy_glXJoinSwapGroupSGIX;
 #endif 
 
 //GLX_SGIX_swap_barrier
 
 #ifdef __GLEE_GLX_SGIX_swap_barrier
-void __stdcall _Lazy_glXBindSwapBarrierSGIX(Display * dpy, GLXDrawable drawable, int barrier)  {if (GLeeInit()) glXBindSwapBarrierSGIX(dpy, drawable, barrier);}
-Bool __stdcall _Lazy_glXQueryMaxSwapBarriersSGIX(Display * dpy, int screen, int * max)    {if (GLeeInit()) return glXQueryMaxSwapBarriersSGIX(dpy, screen, max); return (Bool)0;}
+void __stdcall _Lazy_glXBindSwapBarrierSGIX(Display * dpy, GLXDrawable drawable, int barrier)  {if (__GLeeLazyLink((void**)&pglXBindSwapBarrierSGIX, "glXBindSwapBarrierSGIX", &_GLEE_GLX_SGIX_swap_barrier, "GLX_SGIX_swap_barrier")) glXBindSwapBarrierSGIX(dpy, drawable, barrier);}
+Bool __stdcall _Lazy_glXQueryMaxSwapBarriersSGIX(Display * dpy, int screen, int * max)    {if (__GLeeLazyLink((void**)&pglXQueryMaxSwapBarriersSGIX, "glXQueryMaxSwapBarriersSGIX", &_GLEE_GLX_SGIX_swap_barrier, "GLX_SGIX_swap_barrier")) return glXQueryMaxSwapBarriersSGIX(dpy, screen, max); return (Bool)0;}
 PFNGLXBINDSWAPBARRIERSGIXPROC pglXBindSwapBarrierSGIX=_Lazy_glXBindSwapBarrierSGIX;
 PFNGLXQUERYMAXSWAPBARRIERSSGIXPROC pglXQueryMaxSwapBarriersSGIX=_Lazy_glXQueryMaxSwapBarriersSGIX;
 #endif 
@@ -4839,7 +4871,7 @@ PFNGLXQUERYMAXSWAPBARRIERSSGIXPROC pglXQueryMaxSwapBarriersSGIX=_Lazy_glXQueryMa
 //GLX_SUN_get_transparent_index
 
 #ifdef __GLEE_GLX_SUN_get_transparent_index
-Status __stdcall _Lazy_glXGetTransparentIndexSUN(Display * dpy, Window overlay, Window underlay, long * pTransparentIndex)  {if (GLeeInit()) return glXGetTransparentIndexSUN(dpy, overlay, underlay, pTransparentIndex); return (Status)0;}
+Status __stdcall _Lazy_glXGetTransparentIndexSUN(Display * dpy, Window overlay, Window underlay, long * pTransparentIndex)  {if (__GLeeLazyLink((void**)&pglXGetTransparentIndexSUN, "glXGetTransparentIndexSUN", &_GLEE_GLX_SUN_get_transparent_index, "GLX_SUN_get_transparent_index")) return glXGetTransparentIndexSUN(dpy, overlay, underlay, pTransparentIndex); return (Status)0;}
 PFNGLXGETTRANSPARENTINDEXSUNPROC pglXGetTransparentIndexSUN=_Lazy_glXGetTransparentIndexSUN;
 #endif 
 
@@ -4851,28 +4883,28 @@ PFNGLXGETTRANSPARENTINDEXSUNPROC pglXGetTransparentIndexSUN=_Lazy_glXGetTranspar
 //GLX_MESA_copy_sub_buffer
 
 #ifdef __GLEE_GLX_MESA_copy_sub_buffer
-void __stdcall _Lazy_glXCopySubBufferMESA(Display * dpy, GLXDrawable drawable, int x, int y, int width, int height)  {if (GLeeInit()) glXCopySubBufferMESA(dpy, drawable, x, y, width, height);}
+void __stdcall _Lazy_glXCopySubBufferMESA(Display * dpy, GLXDrawable drawable, int x, int y, int width, int height)  {if (__GLeeLazyLink((void**)&pglXCopySubBufferMESA, "glXCopySubBufferMESA", &_GLEE_GLX_MESA_copy_sub_buffer, "GLX_MESA_copy_sub_buffer")) glXCopySubBufferMESA(dpy, drawable, x, y, width, height);}
 PFNGLXCOPYSUBBUFFERMESAPROC pglXCopySubBufferMESA=_Lazy_glXCopySubBufferMESA;
 #endif 
 
 //GLX_MESA_pixmap_colormap
 
 #ifdef __GLEE_GLX_MESA_pixmap_colormap
-GLXPixmap __stdcall _Lazy_glXCreateGLXPixmapMESA(Display * dpy, XVisualInfo * visual, Pixmap pixmap, Colormap cmap)  {if (GLeeInit()) return glXCreateGLXPixmapMESA(dpy, visual, pixmap, cmap); return (GLXPixmap)0;}
+GLXPixmap __stdcall _Lazy_glXCreateGLXPixmapMESA(Display * dpy, XVisualInfo * visual, Pixmap pixmap, Colormap cmap)  {if (__GLeeLazyLink((void**)&pglXCreateGLXPixmapMESA, "glXCreateGLXPixmapMESA", &_GLEE_GLX_MESA_pixmap_colormap, "GLX_MESA_pixmap_colormap")) return glXCreateGLXPixmapMESA(dpy, visual, pixmap, cmap); return (GLXPixmap)0;}
 PFNGLXCREATEGLXPIXMAPMESAPROC pglXCreateGLXPixmapMESA=_Lazy_glXCreateGLXPixmapMESA;
 #endif 
 
 //GLX_MESA_release_buffers
 
 #ifdef __GLEE_GLX_MESA_release_buffers
-Bool __stdcall _Lazy_glXReleaseBuffersMESA(Display * dpy, GLXDrawable drawable)           {if (GLeeInit()) return glXReleaseBuffersMESA(dpy, drawable); return (Bool)0;}
+Bool __stdcall _Lazy_glXReleaseBuffersMESA(Display * dpy, GLXDrawable drawable)           {if (__GLeeLazyLink((void**)&pglXReleaseBuffersMESA, "glXReleaseBuffersMESA", &_GLEE_GLX_MESA_release_buffers, "GLX_MESA_release_buffers")) return glXReleaseBuffersMESA(dpy, drawable); return (Bool)0;}
 PFNGLXRELEASEBUFFERSMESAPROC pglXReleaseBuffersMESA=_Lazy_glXReleaseBuffersMESA;
 #endif 
 
 //GLX_MESA_set_3dfx_mode
 
 #ifdef __GLEE_GLX_MESA_set_3dfx_mode
-Bool __stdcall _Lazy_glXSet3DfxModeMESA(int mode)                                         {if (GLeeInit()) return glXSet3DfxModeMESA(mode); return (Bool)0;}
+Bool __stdcall _Lazy_glXSet3DfxModeMESA(int mode)                                         {if (__GLeeLazyLink((void**)&pglXSet3DfxModeMESA, "glXSet3DfxModeMESA", &_GLEE_GLX_MESA_set_3dfx_mode, "GLX_MESA_set_3dfx_mode")) return glXSet3DfxModeMESA(mode); return (Bool)0;}
 PFNGLXSET3DFXMODEMESAPROC pglXSet3DfxModeMESA=_Lazy_glXSet3DfxModeMESA;
 #endif 
 
@@ -4889,11 +4921,11 @@ PFNGLXSET3DFXMODEMESAPROC pglXSet3DfxModeMESA=_Lazy_glXSet3DfxModeMESA;
 //GLX_OML_sync_control
 
 #ifdef __GLEE_GLX_OML_sync_control
-Bool __stdcall _Lazy_glXGetSyncValuesOML(Display * dpy, GLXDrawable drawable, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (GLeeInit()) return glXGetSyncValuesOML(dpy, drawable, ust, msc, sbc); return (Bool)0;}
-Bool __stdcall _Lazy_glXGetMscRateOML(Display * dpy, GLXDrawable drawable, int32_t * numerator, int32_t * denominator)  {if (GLeeInit()) return glXGetMscRateOML(dpy, drawable, numerator, denominator); return (Bool)0;}
-int64_t __stdcall _Lazy_glXSwapBuffersMscOML(Display * dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder)  {if (GLeeInit()) return glXSwapBuffersMscOML(dpy, drawable, target_msc, divisor, remainder); return (int64_t)0;}
-Bool __stdcall _Lazy_glXWaitForMscOML(Display * dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (GLeeInit()) return glXWaitForMscOML(dpy, drawable, target_msc, divisor, remainder, ust, msc, sbc); return (Bool)0;}
-Bool __stdcall _Lazy_glXWaitForSbcOML(Display * dpy, GLXDrawable drawable, int64_t target_sbc, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (GLeeInit()) return glXWaitForSbcOML(dpy, drawable, target_sbc, ust, msc, sbc); return (Bool)0;}
+Bool __stdcall _Lazy_glXGetSyncValuesOML(Display * dpy, GLXDrawable drawable, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (__GLeeLazyLink((void**)&pglXGetSyncValuesOML, "glXGetSyncValuesOML", &_GLEE_GLX_OML_sync_control, "GLX_OML_sync_control")) return glXGetSyncValuesOML(dpy, drawable, ust, msc, sbc); return (Bool)0;}
+Bool __stdcall _Lazy_glXGetMscRateOML(Display * dpy, GLXDrawable drawable, int32_t * numerator, int32_t * denominator)  {if (__GLeeLazyLink((void**)&pglXGetMscRateOML, "glXGetMscRateOML", &_GLEE_GLX_OML_sync_control, "GLX_OML_sync_control")) return glXGetMscRateOML(dpy, drawable, numerator, denominator); return (Bool)0;}
+int64_t __stdcall _Lazy_glXSwapBuffersMscOML(Display * dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder)  {if (__GLeeLazyLink((void**)&pglXSwapBuffersMscOML, "glXSwapBuffersMscOML", &_GLEE_GLX_OML_sync_control, "GLX_OML_sync_control")) return glXSwapBuffersMscOML(dpy, drawable, target_msc, divisor, remainder); return (int64_t)0;}
+Bool __stdcall _Lazy_glXWaitForMscOML(Display * dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (__GLeeLazyLink((void**)&pglXWaitForMscOML, "glXWaitForMscOML", &_GLEE_GLX_OML_sync_control, "GLX_OML_sync_control")) return glXWaitForMscOML(dpy, drawable, target_msc, divisor, remainder, ust, msc, sbc); return (Bool)0;}
+Bool __stdcall _Lazy_glXWaitForSbcOML(Display * dpy, GLXDrawable drawable, int64_t target_sbc, int64_t * ust, int64_t * msc, int64_t * sbc)  {if (__GLeeLazyLink((void**)&pglXWaitForSbcOML, "glXWaitForSbcOML", &_GLEE_GLX_OML_sync_control, "GLX_OML_sync_control")) return glXWaitForSbcOML(dpy, drawable, target_sbc, ust, msc, sbc); return (Bool)0;}
 PFNGLXGETSYNCVALUESOMLPROC pglXGetSyncValuesOML=_Lazy_glXGetSyncValuesOML;
 PFNGLXGETMSCRATEOMLPROC pglXGetMscRateOML=_Lazy_glXGetMscRateOML;
 PFNGLXSWAPBUFFERSMSCOMLPROC pglXSwapBuffersMscOML=_Lazy_glXSwapBuffersMscOML;
@@ -4909,14 +4941,14 @@ PFNGLXWAITFORSBCOMLPROC pglXWaitForSbcOML=_Lazy_glXWaitForSbcOML;
 //GLX_SGIX_hyperpipe
 
 #ifdef __GLEE_GLX_SGIX_hyperpipe
-GLXHyperpipeNetworkSGIX * __stdcall _Lazy_glXQueryHyperpipeNetworkSGIX(Display * dpy, int * npipes)  {if (GLeeInit()) return glXQueryHyperpipeNetworkSGIX(dpy, npipes); return (GLXHyperpipeNetworkSGIX *)0;}
-int __stdcall _Lazy_glXHyperpipeConfigSGIX(Display * dpy, int networkId, int npipes, GLXHyperpipeConfigSGIX * cfg, int * hpId)  {if (GLeeInit()) return glXHyperpipeConfigSGIX(dpy, networkId, npipes, cfg, hpId); return (int)0;}
-GLXHyperpipeConfigSGIX * __stdcall _Lazy_glXQueryHyperpipeConfigSGIX(Display * dpy, int hpId, int * npipes)  {if (GLeeInit()) return glXQueryHyperpipeConfigSGIX(dpy, hpId, npipes); return (GLXHyperpipeConfigSGIX *)0;}
-int __stdcall _Lazy_glXDestroyHyperpipeConfigSGIX(Display * dpy, int hpId)                {if (GLeeInit()) return glXDestroyHyperpipeConfigSGIX(dpy, hpId); return (int)0;}
-int __stdcall _Lazy_glXBindHyperpipeSGIX(Display * dpy, int hpId)                         {if (GLeeInit()) return glXBindHyperpipeSGIX(dpy, hpId); return (int)0;}
-int __stdcall _Lazy_glXQueryHyperpipeBestAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * attribList, void * returnAttribList)  {if (GLeeInit()) return glXQueryHyperpipeBestAttribSGIX(dpy, timeSlice, attrib, size, attribList, returnAttribList); return (int)0;}
-int __stdcall _Lazy_glXHyperpipeAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * attribList)  {if (GLeeInit()) return glXHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, attribList); return (int)0;}
-int __stdcall _Lazy_glXQueryHyperpipeAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * returnAttribList)  {if (GLeeInit()) return glXQueryHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, returnAttribList); return (int)0;}
+GLXHyperpipeNetworkSGIX * __stdcall _Lazy_glXQueryHyperpipeNetworkSGIX(Display * dpy, int * npipes)  {if (__GLeeLazyLink((void**)&pglXQueryHyperpipeNetworkSGIX, "glXQueryHyperpipeNetworkSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXQueryHyperpipeNetworkSGIX(dpy, npipes); return (GLXHyperpipeNetworkSGIX *)0;}
+int __stdcall _Lazy_glXHyperpipeConfigSGIX(Display * dpy, int networkId, int npipes, GLXHyperpipeConfigSGIX * cfg, int * hpId)  {if (__GLeeLazyLink((void**)&pglXHyperpipeConfigSGIX, "glXHyperpipeConfigSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXHyperpipeConfigSGIX(dpy, networkId, npipes, cfg, hpId); return (int)0;}
+GLXHyperpipeConfigSGIX * __stdcall _Lazy_glXQueryHyperpipeConfigSGIX(Display * dpy, int hpId, int * npipes)  {if (__GLeeLazyLink((void**)&pglXQueryHyperpipeConfigSGIX, "glXQueryHyperpipeConfigSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXQueryHyperpipeConfigSGIX(dpy, hpId, npipes); return (GLXHyperpipeConfigSGIX *)0;}
+int __stdcall _Lazy_glXDestroyHyperpipeConfigSGIX(Display * dpy, int hpId)                {if (__GLeeLazyLink((void**)&pglXDestroyHyperpipeConfigSGIX, "glXDestroyHyperpipeConfigSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXDestroyHyperpipeConfigSGIX(dpy, hpId); return (int)0;}
+int __stdcall _Lazy_glXBindHyperpipeSGIX(Display * dpy, int hpId)                         {if (__GLeeLazyLink((void**)&pglXBindHyperpipeSGIX, "glXBindHyperpipeSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXBindHyperpipeSGIX(dpy, hpId); return (int)0;}
+int __stdcall _Lazy_glXQueryHyperpipeBestAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * attribList, void * returnAttribList)  {if (__GLeeLazyLink((void**)&pglXQueryHyperpipeBestAttribSGIX, "glXQueryHyperpipeBestAttribSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXQueryHyperpipeBestAttribSGIX(dpy, timeSlice, attrib, size, attribList, returnAttribList); return (int)0;}
+int __stdcall _Lazy_glXHyperpipeAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * attribList)  {if (__GLeeLazyLink((void**)&pglXHyperpipeAttribSGIX, "glXHyperpipeAttribSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, attribList); return (int)0;}
+int __stdcall _Lazy_glXQueryHyperpipeAttribSGIX(Display * dpy, int timeSlice, int attrib, int size, void * returnAttribList)  {if (__GLeeLazyLink((void**)&pglXQueryHyperpipeAttribSGIX, "glXQueryHyperpipeAttribSGIX", &_GLEE_GLX_SGIX_hyperpipe, "GLX_SGIX_hyperpipe")) return glXQueryHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, returnAttribList); return (int)0;}
 PFNGLXQUERYHYPERPIPENETWORKSGIXPROC pglXQueryHyperpipeNetworkSGIX=_Lazy_glXQueryHyperpipeNetworkSGIX;
 PFNGLXHYPERPIPECONFIGSGIXPROC pglXHyperpipeConfigSGIX=_Lazy_glXHyperpipeConfigSGIX;
 PFNGLXQUERYHYPERPIPECONFIGSGIXPROC pglXQueryHyperpipeConfigSGIX=_Lazy_glXQueryHyperpipeConfigSGIX;
@@ -4930,7 +4962,7 @@ PFNGLXQUERYHYPERPIPEATTRIBSGIXPROC pglXQueryHyperpipeAttribSGIX=_Lazy_glXQueryHy
 //GLX_MESA_agp_offset
 
 #ifdef __GLEE_GLX_MESA_agp_offset
-unsigned int __stdcall _Lazy_glXGetAGPOffsetMESA(const void * pointer)                    {if (GLeeInit()) return glXGetAGPOffsetMESA(pointer); return (unsigned int)0;}
+unsigned int __stdcall _Lazy_glXGetAGPOffsetMESA(const void * pointer)                    {if (__GLeeLazyLink((void**)&pglXGetAGPOffsetMESA, "glXGetAGPOffsetMESA", &_GLEE_GLX_MESA_agp_offset, "GLX_MESA_agp_offset")) return glXGetAGPOffsetMESA(pointer); return (unsigned int)0;}
 PFNGLXGETAGPOFFSETMESAPROC pglXGetAGPOffsetMESA=_Lazy_glXGetAGPOffsetMESA;
 #endif 
 
@@ -8721,6 +8753,32 @@ GLEE_EXTERN const char * GLeeGetErrorString()
 	return GLeeErrorString;
 }
 
+GLEE_EXTERN void GLeeSetLazyLinking(GLboolean lazy)
+{
+	if (!__GLeeInited) __GLeeLazyLinking=lazy;
+}
+
+GLEE_EXTERN GLboolean GLeeGetLazyLinking()
+{
+	return __GLeeLazyLinking;
+}
+
+GLEE_EXTERN GLint GLeeGetLazyLinkedCount()
+{
+	return __GLeeNumLazyLinked;
+}
+
+GLEE_EXTERN GLint GLeeGetUsedExtensionCount()
+{
+	return __GLeeNumUsedExtensions;
+}
+
+GLEE_EXTERN const char * GLeeGetUsedExtension(GLint index)
+{
+	if (index<0 || index>=__GLeeNumUsedExtensions) return 0;
+	return __GLeeUsedExtensions[index];
+}
+
 GLboolean __GLeeInitedLoadFunctions=GL_FALSE;
 
 GLEE_EXTERN GLint GLeeForceLink(const char * extensionName)
@@ -8785,1674 +8843,1674 @@ GLEE_EXTERN GLboolean GLeeInit()
     if (version>=258)
     {
         _GLEE_VERSION_1_2 = GL_TRUE;
-        __GLeeLink_GL_VERSION_1_2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_VERSION_1_2();
     }
     if (__GLeeCheckExtension("GL_ARB_imaging", &extensionNames) )
     {
         _GLEE_ARB_imaging = GL_TRUE;
-        __GLeeLink_GL_ARB_imaging();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_imaging();
     }
     if (version>=259)
     {
         _GLEE_VERSION_1_3 = GL_TRUE;
-        __GLeeLink_GL_VERSION_1_3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_VERSION_1_3();
     }
     if (version>=260)
     {
         _GLEE_VERSION_1_4 = GL_TRUE;
-        __GLeeLink_GL_VERSION_1_4();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_VERSION_1_4();
     }
     if (version>=261)
     {
         _GLEE_VERSION_1_5 = GL_TRUE;
-        __GLeeLink_GL_VERSION_1_5();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_VERSION_1_5();
     }
     if (version>=512)
     {
         _GLEE_VERSION_2_0 = GL_TRUE;
-        __GLeeLink_GL_VERSION_2_0();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_VERSION_2_0();
     }
     if (__GLeeCheckExtension("GL_ARB_multitexture", &extensionNames) )
     {
         _GLEE_ARB_multitexture = GL_TRUE;
-        __GLeeLink_GL_ARB_multitexture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_multitexture();
     }
     if (__GLeeCheckExtension("GL_ARB_transpose_matrix", &extensionNames) )
     {
         _GLEE_ARB_transpose_matrix = GL_TRUE;
-        __GLeeLink_GL_ARB_transpose_matrix();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_transpose_matrix();
     }
     if (__GLeeCheckExtension("GL_ARB_multisample", &extensionNames) )
     {
         _GLEE_ARB_multisample = GL_TRUE;
-        __GLeeLink_GL_ARB_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_multisample();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_env_add", &extensionNames) )
     {
         _GLEE_ARB_texture_env_add = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_env_add();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_env_add();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_cube_map", &extensionNames) )
     {
         _GLEE_ARB_texture_cube_map = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_cube_map();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_cube_map();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_compression", &extensionNames) )
     {
         _GLEE_ARB_texture_compression = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_compression();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_compression();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_border_clamp", &extensionNames) )
     {
         _GLEE_ARB_texture_border_clamp = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_border_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_border_clamp();
     }
     if (__GLeeCheckExtension("GL_ARB_point_parameters", &extensionNames) )
     {
         _GLEE_ARB_point_parameters = GL_TRUE;
-        __GLeeLink_GL_ARB_point_parameters();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_point_parameters();
     }
     if (__GLeeCheckExtension("GL_ARB_vertex_blend", &extensionNames) )
     {
         _GLEE_ARB_vertex_blend = GL_TRUE;
-        __GLeeLink_GL_ARB_vertex_blend();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_vertex_blend();
     }
     if (__GLeeCheckExtension("GL_ARB_matrix_palette", &extensionNames) )
     {
         _GLEE_ARB_matrix_palette = GL_TRUE;
-        __GLeeLink_GL_ARB_matrix_palette();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_matrix_palette();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_env_combine", &extensionNames) )
     {
         _GLEE_ARB_texture_env_combine = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_env_combine();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_env_combine();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_env_crossbar", &extensionNames) )
     {
         _GLEE_ARB_texture_env_crossbar = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_env_crossbar();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_env_crossbar();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_env_dot3", &extensionNames) )
     {
         _GLEE_ARB_texture_env_dot3 = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_env_dot3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_env_dot3();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_mirrored_repeat", &extensionNames) )
     {
         _GLEE_ARB_texture_mirrored_repeat = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_mirrored_repeat();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_mirrored_repeat();
     }
     if (__GLeeCheckExtension("GL_ARB_depth_texture", &extensionNames) )
     {
         _GLEE_ARB_depth_texture = GL_TRUE;
-        __GLeeLink_GL_ARB_depth_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_depth_texture();
     }
     if (__GLeeCheckExtension("GL_ARB_shadow", &extensionNames) )
     {
         _GLEE_ARB_shadow = GL_TRUE;
-        __GLeeLink_GL_ARB_shadow();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_shadow();
     }
     if (__GLeeCheckExtension("GL_ARB_shadow_ambient", &extensionNames) )
     {
         _GLEE_ARB_shadow_ambient = GL_TRUE;
-        __GLeeLink_GL_ARB_shadow_ambient();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_shadow_ambient();
     }
     if (__GLeeCheckExtension("GL_ARB_window_pos", &extensionNames) )
     {
         _GLEE_ARB_window_pos = GL_TRUE;
-        __GLeeLink_GL_ARB_window_pos();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_window_pos();
     }
     if (__GLeeCheckExtension("GL_ARB_vertex_program", &extensionNames) )
     {
         _GLEE_ARB_vertex_program = GL_TRUE;
-        __GLeeLink_GL_ARB_vertex_program();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_vertex_program();
     }
     if (__GLeeCheckExtension("GL_ARB_fragment_program", &extensionNames) )
     {
         _GLEE_ARB_fragment_program = GL_TRUE;
-        __GLeeLink_GL_ARB_fragment_program();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_fragment_program();
     }
     if (__GLeeCheckExtension("GL_ARB_vertex_buffer_object", &extensionNames) )
     {
         _GLEE_ARB_vertex_buffer_object = GL_TRUE;
-        __GLeeLink_GL_ARB_vertex_buffer_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_vertex_buffer_object();
     }
     if (__GLeeCheckExtension("GL_ARB_occlusion_query", &extensionNames) )
     {
         _GLEE_ARB_occlusion_query = GL_TRUE;
-        __GLeeLink_GL_ARB_occlusion_query();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_occlusion_query();
     }
     if (__GLeeCheckExtension("GL_ARB_shader_objects", &extensionNames) )
     {
         _GLEE_ARB_shader_objects = GL_TRUE;
-        __GLeeLink_GL_ARB_shader_objects();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_shader_objects();
     }
     if (__GLeeCheckExtension("GL_ARB_vertex_shader", &extensionNames) )
     {
         _GLEE_ARB_vertex_shader = GL_TRUE;
-        __GLeeLink_GL_ARB_vertex_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_vertex_shader();
     }
     if (__GLeeCheckExtension("GL_ARB_fragment_shader", &extensionNames) )
     {
         _GLEE_ARB_fragment_shader = GL_TRUE;
-        __GLeeLink_GL_ARB_fragment_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_fragment_shader();
     }
     if (__GLeeCheckExtension("GL_ARB_shading_language_100", &extensionNames) )
     {
         _GLEE_ARB_shading_language_100 = GL_TRUE;
-        __GLeeLink_GL_ARB_shading_language_100();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_shading_language_100();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_non_power_of_two", &extensionNames) )
     {
         _GLEE_ARB_texture_non_power_of_two = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_non_power_of_two();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_non_power_of_two();
     }
     if (__GLeeCheckExtension("GL_ARB_point_sprite", &extensionNames) )
     {
         _GLEE_ARB_point_sprite = GL_TRUE;
-        __GLeeLink_GL_ARB_point_sprite();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_point_sprite();
     }
     if (__GLeeCheckExtension("GL_ARB_fragment_program_shadow", &extensionNames) )
     {
         _GLEE_ARB_fragment_program_shadow = GL_TRUE;
-        __GLeeLink_GL_ARB_fragment_program_shadow();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_fragment_program_shadow();
     }
     if (__GLeeCheckExtension("GL_ARB_draw_buffers", &extensionNames) )
     {
         _GLEE_ARB_draw_buffers = GL_TRUE;
-        __GLeeLink_GL_ARB_draw_buffers();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_draw_buffers();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_rectangle", &extensionNames) )
     {
         _GLEE_ARB_texture_rectangle = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_rectangle();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_rectangle();
     }
     if (__GLeeCheckExtension("GL_ARB_color_buffer_float", &extensionNames) )
     {
         _GLEE_ARB_color_buffer_float = GL_TRUE;
-        __GLeeLink_GL_ARB_color_buffer_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_color_buffer_float();
     }
     if (__GLeeCheckExtension("GL_ARB_half_float_pixel", &extensionNames) )
     {
         _GLEE_ARB_half_float_pixel = GL_TRUE;
-        __GLeeLink_GL_ARB_half_float_pixel();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_half_float_pixel();
     }
     if (__GLeeCheckExtension("GL_ARB_texture_float", &extensionNames) )
     {
         _GLEE_ARB_texture_float = GL_TRUE;
-        __GLeeLink_GL_ARB_texture_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_texture_float();
     }
     if (__GLeeCheckExtension("GL_ARB_pixel_buffer_object", &extensionNames) )
     {
         _GLEE_ARB_pixel_buffer_object = GL_TRUE;
-        __GLeeLink_GL_ARB_pixel_buffer_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ARB_pixel_buffer_object();
     }
     if (__GLeeCheckExtension("GL_EXT_abgr", &extensionNames) )
     {
         _GLEE_EXT_abgr = GL_TRUE;
-        __GLeeLink_GL_EXT_abgr();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_abgr();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_color", &extensionNames) )
     {
         _GLEE_EXT_blend_color = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_color();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_color();
     }
     if (__GLeeCheckExtension("GL_EXT_polygon_offset", &extensionNames) )
     {
         _GLEE_EXT_polygon_offset = GL_TRUE;
-        __GLeeLink_GL_EXT_polygon_offset();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_polygon_offset();
     }
     if (__GLeeCheckExtension("GL_EXT_texture", &extensionNames) )
     {
         _GLEE_EXT_texture = GL_TRUE;
-        __GLeeLink_GL_EXT_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_texture3D", &extensionNames) )
     {
         _GLEE_EXT_texture3D = GL_TRUE;
-        __GLeeLink_GL_EXT_texture3D();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture3D();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_filter4", &extensionNames) )
     {
         _GLEE_SGIS_texture_filter4 = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_filter4();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_filter4();
     }
     if (__GLeeCheckExtension("GL_EXT_subtexture", &extensionNames) )
     {
         _GLEE_EXT_subtexture = GL_TRUE;
-        __GLeeLink_GL_EXT_subtexture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_subtexture();
     }
     if (__GLeeCheckExtension("GL_EXT_copy_texture", &extensionNames) )
     {
         _GLEE_EXT_copy_texture = GL_TRUE;
-        __GLeeLink_GL_EXT_copy_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_copy_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_histogram", &extensionNames) )
     {
         _GLEE_EXT_histogram = GL_TRUE;
-        __GLeeLink_GL_EXT_histogram();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_histogram();
     }
     if (__GLeeCheckExtension("GL_EXT_convolution", &extensionNames) )
     {
         _GLEE_EXT_convolution = GL_TRUE;
-        __GLeeLink_GL_EXT_convolution();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_convolution();
     }
     if (__GLeeCheckExtension("GL_SGI_color_matrix", &extensionNames) )
     {
         _GLEE_SGI_color_matrix = GL_TRUE;
-        __GLeeLink_GL_SGI_color_matrix();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGI_color_matrix();
     }
     if (__GLeeCheckExtension("GL_SGI_color_table", &extensionNames) )
     {
         _GLEE_SGI_color_table = GL_TRUE;
-        __GLeeLink_GL_SGI_color_table();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGI_color_table();
     }
     if (__GLeeCheckExtension("GL_SGIS_pixel_texture", &extensionNames) )
     {
         _GLEE_SGIS_pixel_texture = GL_TRUE;
-        __GLeeLink_GL_SGIS_pixel_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_pixel_texture();
     }
     if (__GLeeCheckExtension("GL_SGIX_pixel_texture", &extensionNames) )
     {
         _GLEE_SGIX_pixel_texture = GL_TRUE;
-        __GLeeLink_GL_SGIX_pixel_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_pixel_texture();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture4D", &extensionNames) )
     {
         _GLEE_SGIS_texture4D = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture4D();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture4D();
     }
     if (__GLeeCheckExtension("GL_SGI_texture_color_table", &extensionNames) )
     {
         _GLEE_SGI_texture_color_table = GL_TRUE;
-        __GLeeLink_GL_SGI_texture_color_table();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGI_texture_color_table();
     }
     if (__GLeeCheckExtension("GL_EXT_cmyka", &extensionNames) )
     {
         _GLEE_EXT_cmyka = GL_TRUE;
-        __GLeeLink_GL_EXT_cmyka();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_cmyka();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_object", &extensionNames) )
     {
         _GLEE_EXT_texture_object = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_object();
     }
     if (__GLeeCheckExtension("GL_SGIS_detail_texture", &extensionNames) )
     {
         _GLEE_SGIS_detail_texture = GL_TRUE;
-        __GLeeLink_GL_SGIS_detail_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_detail_texture();
     }
     if (__GLeeCheckExtension("GL_SGIS_sharpen_texture", &extensionNames) )
     {
         _GLEE_SGIS_sharpen_texture = GL_TRUE;
-        __GLeeLink_GL_SGIS_sharpen_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_sharpen_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_packed_pixels", &extensionNames) )
     {
         _GLEE_EXT_packed_pixels = GL_TRUE;
-        __GLeeLink_GL_EXT_packed_pixels();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_packed_pixels();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_lod", &extensionNames) )
     {
         _GLEE_SGIS_texture_lod = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_lod();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_lod();
     }
     if (__GLeeCheckExtension("GL_SGIS_multisample", &extensionNames) )
     {
         _GLEE_SGIS_multisample = GL_TRUE;
-        __GLeeLink_GL_SGIS_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_multisample();
     }
     if (__GLeeCheckExtension("GL_EXT_rescale_normal", &extensionNames) )
     {
         _GLEE_EXT_rescale_normal = GL_TRUE;
-        __GLeeLink_GL_EXT_rescale_normal();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_rescale_normal();
     }
     if (__GLeeCheckExtension("GL_EXT_vertex_array", &extensionNames) )
     {
         _GLEE_EXT_vertex_array = GL_TRUE;
-        __GLeeLink_GL_EXT_vertex_array();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_vertex_array();
     }
     if (__GLeeCheckExtension("GL_EXT_misc_attribute", &extensionNames) )
     {
         _GLEE_EXT_misc_attribute = GL_TRUE;
-        __GLeeLink_GL_EXT_misc_attribute();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_misc_attribute();
     }
     if (__GLeeCheckExtension("GL_SGIS_generate_mipmap", &extensionNames) )
     {
         _GLEE_SGIS_generate_mipmap = GL_TRUE;
-        __GLeeLink_GL_SGIS_generate_mipmap();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_generate_mipmap();
     }
     if (__GLeeCheckExtension("GL_SGIX_clipmap", &extensionNames) )
     {
         _GLEE_SGIX_clipmap = GL_TRUE;
-        __GLeeLink_GL_SGIX_clipmap();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_clipmap();
     }
     if (__GLeeCheckExtension("GL_SGIX_shadow", &extensionNames) )
     {
         _GLEE_SGIX_shadow = GL_TRUE;
-        __GLeeLink_GL_SGIX_shadow();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_shadow();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_edge_clamp", &extensionNames) )
     {
         _GLEE_SGIS_texture_edge_clamp = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_edge_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_edge_clamp();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_border_clamp", &extensionNames) )
     {
         _GLEE_SGIS_texture_border_clamp = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_border_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_border_clamp();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_minmax", &extensionNames) )
     {
         _GLEE_EXT_blend_minmax = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_minmax();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_minmax();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_subtract", &extensionNames) )
     {
         _GLEE_EXT_blend_subtract = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_subtract();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_subtract();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_logic_op", &extensionNames) )
     {
         _GLEE_EXT_blend_logic_op = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_logic_op();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_logic_op();
     }
     if (__GLeeCheckExtension("GL_SGIX_interlace", &extensionNames) )
     {
         _GLEE_SGIX_interlace = GL_TRUE;
-        __GLeeLink_GL_SGIX_interlace();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_interlace();
     }
     if (__GLeeCheckExtension("GL_SGIX_pixel_tiles", &extensionNames) )
     {
         _GLEE_SGIX_pixel_tiles = GL_TRUE;
-        __GLeeLink_GL_SGIX_pixel_tiles();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_pixel_tiles();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_select", &extensionNames) )
     {
         _GLEE_SGIS_texture_select = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_select();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_select();
     }
     if (__GLeeCheckExtension("GL_SGIX_sprite", &extensionNames) )
     {
         _GLEE_SGIX_sprite = GL_TRUE;
-        __GLeeLink_GL_SGIX_sprite();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_sprite();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_multi_buffer", &extensionNames) )
     {
         _GLEE_SGIX_texture_multi_buffer = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_multi_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_multi_buffer();
     }
     if (__GLeeCheckExtension("GL_EXT_point_parameters", &extensionNames) )
     {
         _GLEE_EXT_point_parameters = GL_TRUE;
-        __GLeeLink_GL_EXT_point_parameters();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_point_parameters();
     }
     if (__GLeeCheckExtension("GL_SGIS_point_parameters", &extensionNames) )
     {
         _GLEE_SGIS_point_parameters = GL_TRUE;
-        __GLeeLink_GL_SGIS_point_parameters();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_point_parameters();
     }
     if (__GLeeCheckExtension("GL_SGIX_instruments", &extensionNames) )
     {
         _GLEE_SGIX_instruments = GL_TRUE;
-        __GLeeLink_GL_SGIX_instruments();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_instruments();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_scale_bias", &extensionNames) )
     {
         _GLEE_SGIX_texture_scale_bias = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_scale_bias();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_scale_bias();
     }
     if (__GLeeCheckExtension("GL_SGIX_framezoom", &extensionNames) )
     {
         _GLEE_SGIX_framezoom = GL_TRUE;
-        __GLeeLink_GL_SGIX_framezoom();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_framezoom();
     }
     if (__GLeeCheckExtension("GL_SGIX_tag_sample_buffer", &extensionNames) )
     {
         _GLEE_SGIX_tag_sample_buffer = GL_TRUE;
-        __GLeeLink_GL_SGIX_tag_sample_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_tag_sample_buffer();
     }
     if (__GLeeCheckExtension("GL_FfdMaskSGIX", &extensionNames) )
     {
         _GLEE_FfdMaskSGIX = GL_TRUE;
-        __GLeeLink_GL_FfdMaskSGIX();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_FfdMaskSGIX();
     }
     if (__GLeeCheckExtension("GL_SGIX_polynomial_ffd", &extensionNames) )
     {
         _GLEE_SGIX_polynomial_ffd = GL_TRUE;
-        __GLeeLink_GL_SGIX_polynomial_ffd();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_polynomial_ffd();
     }
     if (__GLeeCheckExtension("GL_SGIX_reference_plane", &extensionNames) )
     {
         _GLEE_SGIX_reference_plane = GL_TRUE;
-        __GLeeLink_GL_SGIX_reference_plane();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_reference_plane();
     }
     if (__GLeeCheckExtension("GL_SGIX_flush_raster", &extensionNames) )
     {
         _GLEE_SGIX_flush_raster = GL_TRUE;
-        __GLeeLink_GL_SGIX_flush_raster();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_flush_raster();
     }
     if (__GLeeCheckExtension("GL_SGIX_depth_texture", &extensionNames) )
     {
         _GLEE_SGIX_depth_texture = GL_TRUE;
-        __GLeeLink_GL_SGIX_depth_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_depth_texture();
     }
     if (__GLeeCheckExtension("GL_SGIS_fog_function", &extensionNames) )
     {
         _GLEE_SGIS_fog_function = GL_TRUE;
-        __GLeeLink_GL_SGIS_fog_function();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_fog_function();
     }
     if (__GLeeCheckExtension("GL_SGIX_fog_offset", &extensionNames) )
     {
         _GLEE_SGIX_fog_offset = GL_TRUE;
-        __GLeeLink_GL_SGIX_fog_offset();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_fog_offset();
     }
     if (__GLeeCheckExtension("GL_HP_image_transform", &extensionNames) )
     {
         _GLEE_HP_image_transform = GL_TRUE;
-        __GLeeLink_GL_HP_image_transform();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_HP_image_transform();
     }
     if (__GLeeCheckExtension("GL_HP_convolution_border_modes", &extensionNames) )
     {
         _GLEE_HP_convolution_border_modes = GL_TRUE;
-        __GLeeLink_GL_HP_convolution_border_modes();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_HP_convolution_border_modes();
     }
     if (__GLeeCheckExtension("GL_INGR_palette_buffer", &extensionNames) )
     {
         _GLEE_INGR_palette_buffer = GL_TRUE;
-        __GLeeLink_GL_INGR_palette_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INGR_palette_buffer();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_add_env", &extensionNames) )
     {
         _GLEE_SGIX_texture_add_env = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_add_env();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_add_env();
     }
     if (__GLeeCheckExtension("GL_EXT_color_subtable", &extensionNames) )
     {
         _GLEE_EXT_color_subtable = GL_TRUE;
-        __GLeeLink_GL_EXT_color_subtable();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_color_subtable();
     }
     if (__GLeeCheckExtension("GL_PGI_vertex_hints", &extensionNames) )
     {
         _GLEE_PGI_vertex_hints = GL_TRUE;
-        __GLeeLink_GL_PGI_vertex_hints();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_PGI_vertex_hints();
     }
     if (__GLeeCheckExtension("GL_PGI_misc_hints", &extensionNames) )
     {
         _GLEE_PGI_misc_hints = GL_TRUE;
-        __GLeeLink_GL_PGI_misc_hints();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_PGI_misc_hints();
     }
     if (__GLeeCheckExtension("GL_EXT_paletted_texture", &extensionNames) )
     {
         _GLEE_EXT_paletted_texture = GL_TRUE;
-        __GLeeLink_GL_EXT_paletted_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_paletted_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_clip_volume_hint", &extensionNames) )
     {
         _GLEE_EXT_clip_volume_hint = GL_TRUE;
-        __GLeeLink_GL_EXT_clip_volume_hint();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_clip_volume_hint();
     }
     if (__GLeeCheckExtension("GL_SGIX_list_priority", &extensionNames) )
     {
         _GLEE_SGIX_list_priority = GL_TRUE;
-        __GLeeLink_GL_SGIX_list_priority();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_list_priority();
     }
     if (__GLeeCheckExtension("GL_SGIX_ir_instrument1", &extensionNames) )
     {
         _GLEE_SGIX_ir_instrument1 = GL_TRUE;
-        __GLeeLink_GL_SGIX_ir_instrument1();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_ir_instrument1();
     }
     if (__GLeeCheckExtension("GL_SGIX_calligraphic_fragment", &extensionNames) )
     {
         _GLEE_SGIX_calligraphic_fragment = GL_TRUE;
-        __GLeeLink_GL_SGIX_calligraphic_fragment();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_calligraphic_fragment();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_lod_bias", &extensionNames) )
     {
         _GLEE_SGIX_texture_lod_bias = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_lod_bias();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_lod_bias();
     }
     if (__GLeeCheckExtension("GL_SGIX_shadow_ambient", &extensionNames) )
     {
         _GLEE_SGIX_shadow_ambient = GL_TRUE;
-        __GLeeLink_GL_SGIX_shadow_ambient();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_shadow_ambient();
     }
     if (__GLeeCheckExtension("GL_EXT_index_texture", &extensionNames) )
     {
         _GLEE_EXT_index_texture = GL_TRUE;
-        __GLeeLink_GL_EXT_index_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_index_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_index_material", &extensionNames) )
     {
         _GLEE_EXT_index_material = GL_TRUE;
-        __GLeeLink_GL_EXT_index_material();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_index_material();
     }
     if (__GLeeCheckExtension("GL_EXT_index_func", &extensionNames) )
     {
         _GLEE_EXT_index_func = GL_TRUE;
-        __GLeeLink_GL_EXT_index_func();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_index_func();
     }
     if (__GLeeCheckExtension("GL_EXT_index_array_formats", &extensionNames) )
     {
         _GLEE_EXT_index_array_formats = GL_TRUE;
-        __GLeeLink_GL_EXT_index_array_formats();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_index_array_formats();
     }
     if (__GLeeCheckExtension("GL_EXT_compiled_vertex_array", &extensionNames) )
     {
         _GLEE_EXT_compiled_vertex_array = GL_TRUE;
-        __GLeeLink_GL_EXT_compiled_vertex_array();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_compiled_vertex_array();
     }
     if (__GLeeCheckExtension("GL_EXT_cull_vertex", &extensionNames) )
     {
         _GLEE_EXT_cull_vertex = GL_TRUE;
-        __GLeeLink_GL_EXT_cull_vertex();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_cull_vertex();
     }
     if (__GLeeCheckExtension("GL_SGIX_ycrcb", &extensionNames) )
     {
         _GLEE_SGIX_ycrcb = GL_TRUE;
-        __GLeeLink_GL_SGIX_ycrcb();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_ycrcb();
     }
     if (__GLeeCheckExtension("GL_SGIX_fragment_lighting", &extensionNames) )
     {
         _GLEE_SGIX_fragment_lighting = GL_TRUE;
-        __GLeeLink_GL_SGIX_fragment_lighting();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_fragment_lighting();
     }
     if (__GLeeCheckExtension("GL_IBM_rasterpos_clip", &extensionNames) )
     {
         _GLEE_IBM_rasterpos_clip = GL_TRUE;
-        __GLeeLink_GL_IBM_rasterpos_clip();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_rasterpos_clip();
     }
     if (__GLeeCheckExtension("GL_HP_texture_lighting", &extensionNames) )
     {
         _GLEE_HP_texture_lighting = GL_TRUE;
-        __GLeeLink_GL_HP_texture_lighting();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_HP_texture_lighting();
     }
     if (__GLeeCheckExtension("GL_EXT_draw_range_elements", &extensionNames) )
     {
         _GLEE_EXT_draw_range_elements = GL_TRUE;
-        __GLeeLink_GL_EXT_draw_range_elements();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_draw_range_elements();
     }
     if (__GLeeCheckExtension("GL_WIN_phong_shading", &extensionNames) )
     {
         _GLEE_WIN_phong_shading = GL_TRUE;
-        __GLeeLink_GL_WIN_phong_shading();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_WIN_phong_shading();
     }
     if (__GLeeCheckExtension("GL_WIN_specular_fog", &extensionNames) )
     {
         _GLEE_WIN_specular_fog = GL_TRUE;
-        __GLeeLink_GL_WIN_specular_fog();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_WIN_specular_fog();
     }
     if (__GLeeCheckExtension("GL_EXT_light_texture", &extensionNames) )
     {
         _GLEE_EXT_light_texture = GL_TRUE;
-        __GLeeLink_GL_EXT_light_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_light_texture();
     }
     if (__GLeeCheckExtension("GL_SGIX_blend_alpha_minmax", &extensionNames) )
     {
         _GLEE_SGIX_blend_alpha_minmax = GL_TRUE;
-        __GLeeLink_GL_SGIX_blend_alpha_minmax();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_blend_alpha_minmax();
     }
     if (__GLeeCheckExtension("GL_SGIX_impact_pixel_texture", &extensionNames) )
     {
         _GLEE_SGIX_impact_pixel_texture = GL_TRUE;
-        __GLeeLink_GL_SGIX_impact_pixel_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_impact_pixel_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_bgra", &extensionNames) )
     {
         _GLEE_EXT_bgra = GL_TRUE;
-        __GLeeLink_GL_EXT_bgra();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_bgra();
     }
     if (__GLeeCheckExtension("GL_SGIX_async", &extensionNames) )
     {
         _GLEE_SGIX_async = GL_TRUE;
-        __GLeeLink_GL_SGIX_async();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_async();
     }
     if (__GLeeCheckExtension("GL_SGIX_async_pixel", &extensionNames) )
     {
         _GLEE_SGIX_async_pixel = GL_TRUE;
-        __GLeeLink_GL_SGIX_async_pixel();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_async_pixel();
     }
     if (__GLeeCheckExtension("GL_SGIX_async_histogram", &extensionNames) )
     {
         _GLEE_SGIX_async_histogram = GL_TRUE;
-        __GLeeLink_GL_SGIX_async_histogram();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_async_histogram();
     }
     if (__GLeeCheckExtension("GL_INTEL_texture_scissor", &extensionNames) )
     {
         _GLEE_INTEL_texture_scissor = GL_TRUE;
-        __GLeeLink_GL_INTEL_texture_scissor();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INTEL_texture_scissor();
     }
     if (__GLeeCheckExtension("GL_INTEL_parallel_arrays", &extensionNames) )
     {
         _GLEE_INTEL_parallel_arrays = GL_TRUE;
-        __GLeeLink_GL_INTEL_parallel_arrays();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INTEL_parallel_arrays();
     }
     if (__GLeeCheckExtension("GL_HP_occlusion_test", &extensionNames) )
     {
         _GLEE_HP_occlusion_test = GL_TRUE;
-        __GLeeLink_GL_HP_occlusion_test();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_HP_occlusion_test();
     }
     if (__GLeeCheckExtension("GL_EXT_pixel_transform", &extensionNames) )
     {
         _GLEE_EXT_pixel_transform = GL_TRUE;
-        __GLeeLink_GL_EXT_pixel_transform();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_pixel_transform();
     }
     if (__GLeeCheckExtension("GL_EXT_pixel_transform_color_table", &extensionNames) )
     {
         _GLEE_EXT_pixel_transform_color_table = GL_TRUE;
-        __GLeeLink_GL_EXT_pixel_transform_color_table();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_pixel_transform_color_table();
     }
     if (__GLeeCheckExtension("GL_EXT_shared_texture_palette", &extensionNames) )
     {
         _GLEE_EXT_shared_texture_palette = GL_TRUE;
-        __GLeeLink_GL_EXT_shared_texture_palette();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_shared_texture_palette();
     }
     if (__GLeeCheckExtension("GL_EXT_separate_specular_color", &extensionNames) )
     {
         _GLEE_EXT_separate_specular_color = GL_TRUE;
-        __GLeeLink_GL_EXT_separate_specular_color();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_separate_specular_color();
     }
     if (__GLeeCheckExtension("GL_EXT_secondary_color", &extensionNames) )
     {
         _GLEE_EXT_secondary_color = GL_TRUE;
-        __GLeeLink_GL_EXT_secondary_color();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_secondary_color();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_perturb_normal", &extensionNames) )
     {
         _GLEE_EXT_texture_perturb_normal = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_perturb_normal();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_perturb_normal();
     }
     if (__GLeeCheckExtension("GL_EXT_multi_draw_arrays", &extensionNames) )
     {
         _GLEE_EXT_multi_draw_arrays = GL_TRUE;
-        __GLeeLink_GL_EXT_multi_draw_arrays();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_multi_draw_arrays();
     }
     if (__GLeeCheckExtension("GL_EXT_fog_coord", &extensionNames) )
     {
         _GLEE_EXT_fog_coord = GL_TRUE;
-        __GLeeLink_GL_EXT_fog_coord();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_fog_coord();
     }
     if (__GLeeCheckExtension("GL_REND_screen_coordinates", &extensionNames) )
     {
         _GLEE_REND_screen_coordinates = GL_TRUE;
-        __GLeeLink_GL_REND_screen_coordinates();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_REND_screen_coordinates();
     }
     if (__GLeeCheckExtension("GL_EXT_coordinate_frame", &extensionNames) )
     {
         _GLEE_EXT_coordinate_frame = GL_TRUE;
-        __GLeeLink_GL_EXT_coordinate_frame();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_coordinate_frame();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_env_combine", &extensionNames) )
     {
         _GLEE_EXT_texture_env_combine = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_env_combine();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_env_combine();
     }
     if (__GLeeCheckExtension("GL_APPLE_specular_vector", &extensionNames) )
     {
         _GLEE_APPLE_specular_vector = GL_TRUE;
-        __GLeeLink_GL_APPLE_specular_vector();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_specular_vector();
     }
     if (__GLeeCheckExtension("GL_APPLE_transform_hint", &extensionNames) )
     {
         _GLEE_APPLE_transform_hint = GL_TRUE;
-        __GLeeLink_GL_APPLE_transform_hint();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_transform_hint();
     }
     if (__GLeeCheckExtension("GL_SGIX_fog_scale", &extensionNames) )
     {
         _GLEE_SGIX_fog_scale = GL_TRUE;
-        __GLeeLink_GL_SGIX_fog_scale();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_fog_scale();
     }
     if (__GLeeCheckExtension("GL_SUNX_constant_data", &extensionNames) )
     {
         _GLEE_SUNX_constant_data = GL_TRUE;
-        __GLeeLink_GL_SUNX_constant_data();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUNX_constant_data();
     }
     if (__GLeeCheckExtension("GL_SUN_global_alpha", &extensionNames) )
     {
         _GLEE_SUN_global_alpha = GL_TRUE;
-        __GLeeLink_GL_SUN_global_alpha();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_global_alpha();
     }
     if (__GLeeCheckExtension("GL_SUN_triangle_list", &extensionNames) )
     {
         _GLEE_SUN_triangle_list = GL_TRUE;
-        __GLeeLink_GL_SUN_triangle_list();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_triangle_list();
     }
     if (__GLeeCheckExtension("GL_SUN_vertex", &extensionNames) )
     {
         _GLEE_SUN_vertex = GL_TRUE;
-        __GLeeLink_GL_SUN_vertex();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_vertex();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_func_separate", &extensionNames) )
     {
         _GLEE_EXT_blend_func_separate = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_func_separate();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_func_separate();
     }
     if (__GLeeCheckExtension("GL_INGR_color_clamp", &extensionNames) )
     {
         _GLEE_INGR_color_clamp = GL_TRUE;
-        __GLeeLink_GL_INGR_color_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INGR_color_clamp();
     }
     if (__GLeeCheckExtension("GL_INGR_interlace_read", &extensionNames) )
     {
         _GLEE_INGR_interlace_read = GL_TRUE;
-        __GLeeLink_GL_INGR_interlace_read();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INGR_interlace_read();
     }
     if (__GLeeCheckExtension("GL_EXT_stencil_wrap", &extensionNames) )
     {
         _GLEE_EXT_stencil_wrap = GL_TRUE;
-        __GLeeLink_GL_EXT_stencil_wrap();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_stencil_wrap();
     }
     if (__GLeeCheckExtension("GL_EXT_422_pixels", &extensionNames) )
     {
         _GLEE_EXT_422_pixels = GL_TRUE;
-        __GLeeLink_GL_EXT_422_pixels();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_422_pixels();
     }
     if (__GLeeCheckExtension("GL_NV_texgen_reflection", &extensionNames) )
     {
         _GLEE_NV_texgen_reflection = GL_TRUE;
-        __GLeeLink_GL_NV_texgen_reflection();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texgen_reflection();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_cube_map", &extensionNames) )
     {
         _GLEE_EXT_texture_cube_map = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_cube_map();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_cube_map();
     }
     if (__GLeeCheckExtension("GL_SUN_convolution_border_modes", &extensionNames) )
     {
         _GLEE_SUN_convolution_border_modes = GL_TRUE;
-        __GLeeLink_GL_SUN_convolution_border_modes();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_convolution_border_modes();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_env_add", &extensionNames) )
     {
         _GLEE_EXT_texture_env_add = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_env_add();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_env_add();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_lod_bias", &extensionNames) )
     {
         _GLEE_EXT_texture_lod_bias = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_lod_bias();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_lod_bias();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_filter_anisotropic", &extensionNames) )
     {
         _GLEE_EXT_texture_filter_anisotropic = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_filter_anisotropic();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_filter_anisotropic();
     }
     if (__GLeeCheckExtension("GL_EXT_vertex_weighting", &extensionNames) )
     {
         _GLEE_EXT_vertex_weighting = GL_TRUE;
-        __GLeeLink_GL_EXT_vertex_weighting();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_vertex_weighting();
     }
     if (__GLeeCheckExtension("GL_NV_light_max_exponent", &extensionNames) )
     {
         _GLEE_NV_light_max_exponent = GL_TRUE;
-        __GLeeLink_GL_NV_light_max_exponent();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_light_max_exponent();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_array_range", &extensionNames) )
     {
         _GLEE_NV_vertex_array_range = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_array_range();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_array_range();
     }
     if (__GLeeCheckExtension("GL_NV_register_combiners", &extensionNames) )
     {
         _GLEE_NV_register_combiners = GL_TRUE;
-        __GLeeLink_GL_NV_register_combiners();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_register_combiners();
     }
     if (__GLeeCheckExtension("GL_NV_fog_distance", &extensionNames) )
     {
         _GLEE_NV_fog_distance = GL_TRUE;
-        __GLeeLink_GL_NV_fog_distance();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_fog_distance();
     }
     if (__GLeeCheckExtension("GL_NV_texgen_emboss", &extensionNames) )
     {
         _GLEE_NV_texgen_emboss = GL_TRUE;
-        __GLeeLink_GL_NV_texgen_emboss();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texgen_emboss();
     }
     if (__GLeeCheckExtension("GL_NV_blend_square", &extensionNames) )
     {
         _GLEE_NV_blend_square = GL_TRUE;
-        __GLeeLink_GL_NV_blend_square();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_blend_square();
     }
     if (__GLeeCheckExtension("GL_NV_texture_env_combine4", &extensionNames) )
     {
         _GLEE_NV_texture_env_combine4 = GL_TRUE;
-        __GLeeLink_GL_NV_texture_env_combine4();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_env_combine4();
     }
     if (__GLeeCheckExtension("GL_MESA_resize_buffers", &extensionNames) )
     {
         _GLEE_MESA_resize_buffers = GL_TRUE;
-        __GLeeLink_GL_MESA_resize_buffers();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_MESA_resize_buffers();
     }
     if (__GLeeCheckExtension("GL_MESA_window_pos", &extensionNames) )
     {
         _GLEE_MESA_window_pos = GL_TRUE;
-        __GLeeLink_GL_MESA_window_pos();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_MESA_window_pos();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_compression_s3tc", &extensionNames) )
     {
         _GLEE_EXT_texture_compression_s3tc = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_compression_s3tc();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_compression_s3tc();
     }
     if (__GLeeCheckExtension("GL_IBM_cull_vertex", &extensionNames) )
     {
         _GLEE_IBM_cull_vertex = GL_TRUE;
-        __GLeeLink_GL_IBM_cull_vertex();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_cull_vertex();
     }
     if (__GLeeCheckExtension("GL_IBM_multimode_draw_arrays", &extensionNames) )
     {
         _GLEE_IBM_multimode_draw_arrays = GL_TRUE;
-        __GLeeLink_GL_IBM_multimode_draw_arrays();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_multimode_draw_arrays();
     }
     if (__GLeeCheckExtension("GL_IBM_vertex_array_lists", &extensionNames) )
     {
         _GLEE_IBM_vertex_array_lists = GL_TRUE;
-        __GLeeLink_GL_IBM_vertex_array_lists();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_vertex_array_lists();
     }
     if (__GLeeCheckExtension("GL_SGIX_subsample", &extensionNames) )
     {
         _GLEE_SGIX_subsample = GL_TRUE;
-        __GLeeLink_GL_SGIX_subsample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_subsample();
     }
     if (__GLeeCheckExtension("GL_SGIX_ycrcb_subsample", &extensionNames) )
     {
         _GLEE_SGIX_ycrcb_subsample = GL_TRUE;
-        __GLeeLink_GL_SGIX_ycrcb_subsample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_ycrcb_subsample();
     }
     if (__GLeeCheckExtension("GL_SGIX_ycrcba", &extensionNames) )
     {
         _GLEE_SGIX_ycrcba = GL_TRUE;
-        __GLeeLink_GL_SGIX_ycrcba();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_ycrcba();
     }
     if (__GLeeCheckExtension("GL_SGI_depth_pass_instrument", &extensionNames) )
     {
         _GLEE_SGI_depth_pass_instrument = GL_TRUE;
-        __GLeeLink_GL_SGI_depth_pass_instrument();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGI_depth_pass_instrument();
     }
     if (__GLeeCheckExtension("GL_3DFX_texture_compression_FXT1", &extensionNames) )
     {
         _GLEE_3DFX_texture_compression_FXT1 = GL_TRUE;
-        __GLeeLink_GL_3DFX_texture_compression_FXT1();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_3DFX_texture_compression_FXT1();
     }
     if (__GLeeCheckExtension("GL_3DFX_multisample", &extensionNames) )
     {
         _GLEE_3DFX_multisample = GL_TRUE;
-        __GLeeLink_GL_3DFX_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_3DFX_multisample();
     }
     if (__GLeeCheckExtension("GL_3DFX_tbuffer", &extensionNames) )
     {
         _GLEE_3DFX_tbuffer = GL_TRUE;
-        __GLeeLink_GL_3DFX_tbuffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_3DFX_tbuffer();
     }
     if (__GLeeCheckExtension("GL_EXT_multisample", &extensionNames) )
     {
         _GLEE_EXT_multisample = GL_TRUE;
-        __GLeeLink_GL_EXT_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_multisample();
     }
     if (__GLeeCheckExtension("GL_SGIX_vertex_preclip", &extensionNames) )
     {
         _GLEE_SGIX_vertex_preclip = GL_TRUE;
-        __GLeeLink_GL_SGIX_vertex_preclip();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_vertex_preclip();
     }
     if (__GLeeCheckExtension("GL_SGIX_convolution_accuracy", &extensionNames) )
     {
         _GLEE_SGIX_convolution_accuracy = GL_TRUE;
-        __GLeeLink_GL_SGIX_convolution_accuracy();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_convolution_accuracy();
     }
     if (__GLeeCheckExtension("GL_SGIX_resample", &extensionNames) )
     {
         _GLEE_SGIX_resample = GL_TRUE;
-        __GLeeLink_GL_SGIX_resample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_resample();
     }
     if (__GLeeCheckExtension("GL_SGIS_point_line_texgen", &extensionNames) )
     {
         _GLEE_SGIS_point_line_texgen = GL_TRUE;
-        __GLeeLink_GL_SGIS_point_line_texgen();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_point_line_texgen();
     }
     if (__GLeeCheckExtension("GL_SGIS_texture_color_mask", &extensionNames) )
     {
         _GLEE_SGIS_texture_color_mask = GL_TRUE;
-        __GLeeLink_GL_SGIS_texture_color_mask();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIS_texture_color_mask();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_env_dot3", &extensionNames) )
     {
         _GLEE_EXT_texture_env_dot3 = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_env_dot3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_env_dot3();
     }
     if (__GLeeCheckExtension("GL_ATI_texture_mirror_once", &extensionNames) )
     {
         _GLEE_ATI_texture_mirror_once = GL_TRUE;
-        __GLeeLink_GL_ATI_texture_mirror_once();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_texture_mirror_once();
     }
     if (__GLeeCheckExtension("GL_NV_fence", &extensionNames) )
     {
         _GLEE_NV_fence = GL_TRUE;
-        __GLeeLink_GL_NV_fence();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_fence();
     }
     if (__GLeeCheckExtension("GL_IBM_texture_mirrored_repeat", &extensionNames) )
     {
         _GLEE_IBM_texture_mirrored_repeat = GL_TRUE;
-        __GLeeLink_GL_IBM_texture_mirrored_repeat();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_texture_mirrored_repeat();
     }
     if (__GLeeCheckExtension("GL_NV_evaluators", &extensionNames) )
     {
         _GLEE_NV_evaluators = GL_TRUE;
-        __GLeeLink_GL_NV_evaluators();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_evaluators();
     }
     if (__GLeeCheckExtension("GL_NV_packed_depth_stencil", &extensionNames) )
     {
         _GLEE_NV_packed_depth_stencil = GL_TRUE;
-        __GLeeLink_GL_NV_packed_depth_stencil();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_packed_depth_stencil();
     }
     if (__GLeeCheckExtension("GL_NV_register_combiners2", &extensionNames) )
     {
         _GLEE_NV_register_combiners2 = GL_TRUE;
-        __GLeeLink_GL_NV_register_combiners2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_register_combiners2();
     }
     if (__GLeeCheckExtension("GL_NV_texture_compression_vtc", &extensionNames) )
     {
         _GLEE_NV_texture_compression_vtc = GL_TRUE;
-        __GLeeLink_GL_NV_texture_compression_vtc();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_compression_vtc();
     }
     if (__GLeeCheckExtension("GL_NV_texture_rectangle", &extensionNames) )
     {
         _GLEE_NV_texture_rectangle = GL_TRUE;
-        __GLeeLink_GL_NV_texture_rectangle();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_rectangle();
     }
     if (__GLeeCheckExtension("GL_NV_texture_shader", &extensionNames) )
     {
         _GLEE_NV_texture_shader = GL_TRUE;
-        __GLeeLink_GL_NV_texture_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_shader();
     }
     if (__GLeeCheckExtension("GL_NV_texture_shader2", &extensionNames) )
     {
         _GLEE_NV_texture_shader2 = GL_TRUE;
-        __GLeeLink_GL_NV_texture_shader2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_shader2();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_array_range2", &extensionNames) )
     {
         _GLEE_NV_vertex_array_range2 = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_array_range2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_array_range2();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_program", &extensionNames) )
     {
         _GLEE_NV_vertex_program = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_program();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_program();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_coordinate_clamp", &extensionNames) )
     {
         _GLEE_SGIX_texture_coordinate_clamp = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_coordinate_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_coordinate_clamp();
     }
     if (__GLeeCheckExtension("GL_SGIX_scalebias_hint", &extensionNames) )
     {
         _GLEE_SGIX_scalebias_hint = GL_TRUE;
-        __GLeeLink_GL_SGIX_scalebias_hint();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_scalebias_hint();
     }
     if (__GLeeCheckExtension("GL_OML_interlace", &extensionNames) )
     {
         _GLEE_OML_interlace = GL_TRUE;
-        __GLeeLink_GL_OML_interlace();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OML_interlace();
     }
     if (__GLeeCheckExtension("GL_OML_subsample", &extensionNames) )
     {
         _GLEE_OML_subsample = GL_TRUE;
-        __GLeeLink_GL_OML_subsample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OML_subsample();
     }
     if (__GLeeCheckExtension("GL_OML_resample", &extensionNames) )
     {
         _GLEE_OML_resample = GL_TRUE;
-        __GLeeLink_GL_OML_resample();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OML_resample();
     }
     if (__GLeeCheckExtension("GL_NV_copy_depth_to_color", &extensionNames) )
     {
         _GLEE_NV_copy_depth_to_color = GL_TRUE;
-        __GLeeLink_GL_NV_copy_depth_to_color();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_copy_depth_to_color();
     }
     if (__GLeeCheckExtension("GL_ATI_envmap_bumpmap", &extensionNames) )
     {
         _GLEE_ATI_envmap_bumpmap = GL_TRUE;
-        __GLeeLink_GL_ATI_envmap_bumpmap();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_envmap_bumpmap();
     }
     if (__GLeeCheckExtension("GL_ATI_fragment_shader", &extensionNames) )
     {
         _GLEE_ATI_fragment_shader = GL_TRUE;
-        __GLeeLink_GL_ATI_fragment_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_fragment_shader();
     }
     if (__GLeeCheckExtension("GL_ATI_pn_triangles", &extensionNames) )
     {
         _GLEE_ATI_pn_triangles = GL_TRUE;
-        __GLeeLink_GL_ATI_pn_triangles();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_pn_triangles();
     }
     if (__GLeeCheckExtension("GL_ATI_vertex_array_object", &extensionNames) )
     {
         _GLEE_ATI_vertex_array_object = GL_TRUE;
-        __GLeeLink_GL_ATI_vertex_array_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_vertex_array_object();
     }
     if (__GLeeCheckExtension("GL_EXT_vertex_shader", &extensionNames) )
     {
         _GLEE_EXT_vertex_shader = GL_TRUE;
-        __GLeeLink_GL_EXT_vertex_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_vertex_shader();
     }
     if (__GLeeCheckExtension("GL_ATI_vertex_streams", &extensionNames) )
     {
         _GLEE_ATI_vertex_streams = GL_TRUE;
-        __GLeeLink_GL_ATI_vertex_streams();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_vertex_streams();
     }
     if (__GLeeCheckExtension("GL_ATI_element_array", &extensionNames) )
     {
         _GLEE_ATI_element_array = GL_TRUE;
-        __GLeeLink_GL_ATI_element_array();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_element_array();
     }
     if (__GLeeCheckExtension("GL_SUN_mesh_array", &extensionNames) )
     {
         _GLEE_SUN_mesh_array = GL_TRUE;
-        __GLeeLink_GL_SUN_mesh_array();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_mesh_array();
     }
     if (__GLeeCheckExtension("GL_SUN_slice_accum", &extensionNames) )
     {
         _GLEE_SUN_slice_accum = GL_TRUE;
-        __GLeeLink_GL_SUN_slice_accum();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SUN_slice_accum();
     }
     if (__GLeeCheckExtension("GL_NV_multisample_filter_hint", &extensionNames) )
     {
         _GLEE_NV_multisample_filter_hint = GL_TRUE;
-        __GLeeLink_GL_NV_multisample_filter_hint();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_multisample_filter_hint();
     }
     if (__GLeeCheckExtension("GL_NV_depth_clamp", &extensionNames) )
     {
         _GLEE_NV_depth_clamp = GL_TRUE;
-        __GLeeLink_GL_NV_depth_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_depth_clamp();
     }
     if (__GLeeCheckExtension("GL_NV_occlusion_query", &extensionNames) )
     {
         _GLEE_NV_occlusion_query = GL_TRUE;
-        __GLeeLink_GL_NV_occlusion_query();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_occlusion_query();
     }
     if (__GLeeCheckExtension("GL_NV_point_sprite", &extensionNames) )
     {
         _GLEE_NV_point_sprite = GL_TRUE;
-        __GLeeLink_GL_NV_point_sprite();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_point_sprite();
     }
     if (__GLeeCheckExtension("GL_NV_texture_shader3", &extensionNames) )
     {
         _GLEE_NV_texture_shader3 = GL_TRUE;
-        __GLeeLink_GL_NV_texture_shader3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_shader3();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_program1_1", &extensionNames) )
     {
         _GLEE_NV_vertex_program1_1 = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_program1_1();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_program1_1();
     }
     if (__GLeeCheckExtension("GL_EXT_shadow_funcs", &extensionNames) )
     {
         _GLEE_EXT_shadow_funcs = GL_TRUE;
-        __GLeeLink_GL_EXT_shadow_funcs();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_shadow_funcs();
     }
     if (__GLeeCheckExtension("GL_EXT_stencil_two_side", &extensionNames) )
     {
         _GLEE_EXT_stencil_two_side = GL_TRUE;
-        __GLeeLink_GL_EXT_stencil_two_side();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_stencil_two_side();
     }
     if (__GLeeCheckExtension("GL_ATI_text_fragment_shader", &extensionNames) )
     {
         _GLEE_ATI_text_fragment_shader = GL_TRUE;
-        __GLeeLink_GL_ATI_text_fragment_shader();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_text_fragment_shader();
     }
     if (__GLeeCheckExtension("GL_APPLE_client_storage", &extensionNames) )
     {
         _GLEE_APPLE_client_storage = GL_TRUE;
-        __GLeeLink_GL_APPLE_client_storage();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_client_storage();
     }
     if (__GLeeCheckExtension("GL_APPLE_element_array", &extensionNames) )
     {
         _GLEE_APPLE_element_array = GL_TRUE;
-        __GLeeLink_GL_APPLE_element_array();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_element_array();
     }
     if (__GLeeCheckExtension("GL_APPLE_fence", &extensionNames) )
     {
         _GLEE_APPLE_fence = GL_TRUE;
-        __GLeeLink_GL_APPLE_fence();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_fence();
     }
     if (__GLeeCheckExtension("GL_APPLE_vertex_array_object", &extensionNames) )
     {
         _GLEE_APPLE_vertex_array_object = GL_TRUE;
-        __GLeeLink_GL_APPLE_vertex_array_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_vertex_array_object();
     }
     if (__GLeeCheckExtension("GL_APPLE_vertex_array_range", &extensionNames) )
     {
         _GLEE_APPLE_vertex_array_range = GL_TRUE;
-        __GLeeLink_GL_APPLE_vertex_array_range();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_vertex_array_range();
     }
     if (__GLeeCheckExtension("GL_APPLE_ycbcr_422", &extensionNames) )
     {
         _GLEE_APPLE_ycbcr_422 = GL_TRUE;
-        __GLeeLink_GL_APPLE_ycbcr_422();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_APPLE_ycbcr_422();
     }
     if (__GLeeCheckExtension("GL_S3_s3tc", &extensionNames) )
     {
         _GLEE_S3_s3tc = GL_TRUE;
-        __GLeeLink_GL_S3_s3tc();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_S3_s3tc();
     }
     if (__GLeeCheckExtension("GL_ATI_draw_buffers", &extensionNames) )
     {
         _GLEE_ATI_draw_buffers = GL_TRUE;
-        __GLeeLink_GL_ATI_draw_buffers();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_draw_buffers();
     }
     if (__GLeeCheckExtension("GL_ATI_pixel_format_float", &extensionNames) )
     {
         _GLEE_ATI_pixel_format_float = GL_TRUE;
-        __GLeeLink_GL_ATI_pixel_format_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_pixel_format_float();
     }
     if (__GLeeCheckExtension("GL_ATI_texture_env_combine3", &extensionNames) )
     {
         _GLEE_ATI_texture_env_combine3 = GL_TRUE;
-        __GLeeLink_GL_ATI_texture_env_combine3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_texture_env_combine3();
     }
     if (__GLeeCheckExtension("GL_ATI_texture_float", &extensionNames) )
     {
         _GLEE_ATI_texture_float = GL_TRUE;
-        __GLeeLink_GL_ATI_texture_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_texture_float();
     }
     if (__GLeeCheckExtension("GL_NV_float_buffer", &extensionNames) )
     {
         _GLEE_NV_float_buffer = GL_TRUE;
-        __GLeeLink_GL_NV_float_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_float_buffer();
     }
     if (__GLeeCheckExtension("GL_NV_fragment_program", &extensionNames) )
     {
         _GLEE_NV_fragment_program = GL_TRUE;
-        __GLeeLink_GL_NV_fragment_program();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_fragment_program();
     }
     if (__GLeeCheckExtension("GL_NV_half_float", &extensionNames) )
     {
         _GLEE_NV_half_float = GL_TRUE;
-        __GLeeLink_GL_NV_half_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_half_float();
     }
     if (__GLeeCheckExtension("GL_NV_pixel_data_range", &extensionNames) )
     {
         _GLEE_NV_pixel_data_range = GL_TRUE;
-        __GLeeLink_GL_NV_pixel_data_range();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_pixel_data_range();
     }
     if (__GLeeCheckExtension("GL_NV_primitive_restart", &extensionNames) )
     {
         _GLEE_NV_primitive_restart = GL_TRUE;
-        __GLeeLink_GL_NV_primitive_restart();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_primitive_restart();
     }
     if (__GLeeCheckExtension("GL_NV_texture_expand_normal", &extensionNames) )
     {
         _GLEE_NV_texture_expand_normal = GL_TRUE;
-        __GLeeLink_GL_NV_texture_expand_normal();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_texture_expand_normal();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_program2", &extensionNames) )
     {
         _GLEE_NV_vertex_program2 = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_program2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_program2();
     }
     if (__GLeeCheckExtension("GL_ATI_map_object_buffer", &extensionNames) )
     {
         _GLEE_ATI_map_object_buffer = GL_TRUE;
-        __GLeeLink_GL_ATI_map_object_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_map_object_buffer();
     }
     if (__GLeeCheckExtension("GL_ATI_separate_stencil", &extensionNames) )
     {
         _GLEE_ATI_separate_stencil = GL_TRUE;
-        __GLeeLink_GL_ATI_separate_stencil();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_separate_stencil();
     }
     if (__GLeeCheckExtension("GL_ATI_vertex_attrib_array_object", &extensionNames) )
     {
         _GLEE_ATI_vertex_attrib_array_object = GL_TRUE;
-        __GLeeLink_GL_ATI_vertex_attrib_array_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_ATI_vertex_attrib_array_object();
     }
     if (__GLeeCheckExtension("GL_OES_read_format", &extensionNames) )
     {
         _GLEE_OES_read_format = GL_TRUE;
-        __GLeeLink_GL_OES_read_format();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OES_read_format();
     }
     if (__GLeeCheckExtension("GL_EXT_depth_bounds_test", &extensionNames) )
     {
         _GLEE_EXT_depth_bounds_test = GL_TRUE;
-        __GLeeLink_GL_EXT_depth_bounds_test();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_depth_bounds_test();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_mirror_clamp", &extensionNames) )
     {
         _GLEE_EXT_texture_mirror_clamp = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_mirror_clamp();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_mirror_clamp();
     }
     if (__GLeeCheckExtension("GL_EXT_blend_equation_separate", &extensionNames) )
     {
         _GLEE_EXT_blend_equation_separate = GL_TRUE;
-        __GLeeLink_GL_EXT_blend_equation_separate();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_blend_equation_separate();
     }
     if (__GLeeCheckExtension("GL_MESA_pack_invert", &extensionNames) )
     {
         _GLEE_MESA_pack_invert = GL_TRUE;
-        __GLeeLink_GL_MESA_pack_invert();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_MESA_pack_invert();
     }
     if (__GLeeCheckExtension("GL_MESA_ycbcr_texture", &extensionNames) )
     {
         _GLEE_MESA_ycbcr_texture = GL_TRUE;
-        __GLeeLink_GL_MESA_ycbcr_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_MESA_ycbcr_texture();
     }
     if (__GLeeCheckExtension("GL_EXT_pixel_buffer_object", &extensionNames) )
     {
         _GLEE_EXT_pixel_buffer_object = GL_TRUE;
-        __GLeeLink_GL_EXT_pixel_buffer_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_pixel_buffer_object();
     }
     if (__GLeeCheckExtension("GL_NV_fragment_program_option", &extensionNames) )
     {
         _GLEE_NV_fragment_program_option = GL_TRUE;
-        __GLeeLink_GL_NV_fragment_program_option();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_fragment_program_option();
     }
     if (__GLeeCheckExtension("GL_NV_fragment_program2", &extensionNames) )
     {
         _GLEE_NV_fragment_program2 = GL_TRUE;
-        __GLeeLink_GL_NV_fragment_program2();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_fragment_program2();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_program2_option", &extensionNames) )
     {
         _GLEE_NV_vertex_program2_option = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_program2_option();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_program2_option();
     }
     if (__GLeeCheckExtension("GL_NV_vertex_program3", &extensionNames) )
     {
         _GLEE_NV_vertex_program3 = GL_TRUE;
-        __GLeeLink_GL_NV_vertex_program3();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_NV_vertex_program3();
     }
     if (__GLeeCheckExtension("GL_EXT_framebuffer_object", &extensionNames) )
     {
         _GLEE_EXT_framebuffer_object = GL_TRUE;
-        __GLeeLink_GL_EXT_framebuffer_object();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_framebuffer_object();
     }
     if (__GLeeCheckExtension("GL_GREMEDY_string_marker", &extensionNames) )
     {
         _GLEE_GREMEDY_string_marker = GL_TRUE;
-        __GLeeLink_GL_GREMEDY_string_marker();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_GREMEDY_string_marker();
     }
     if (__GLeeCheckExtension("GL_EXT_color_matrix", &extensionNames) )
     {
         _GLEE_EXT_color_matrix = GL_TRUE;
-        __GLeeLink_GL_EXT_color_matrix();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_color_matrix();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_select", &extensionNames) )
     {
         _GLEE_SGIX_texture_select = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_select();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_select();
     }
     if (__GLeeCheckExtension("GL_INGR_blend_func_separate", &extensionNames) )
     {
         _GLEE_INGR_blend_func_separate = GL_TRUE;
-        __GLeeLink_GL_INGR_blend_func_separate();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_INGR_blend_func_separate();
     }
     if (__GLeeCheckExtension("GL_SGIX_depth_pass_instrument", &extensionNames) )
     {
         _GLEE_SGIX_depth_pass_instrument = GL_TRUE;
-        __GLeeLink_GL_SGIX_depth_pass_instrument();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_depth_pass_instrument();
     }
     if (__GLeeCheckExtension("GL_SGIX_igloo_interface", &extensionNames) )
     {
         _GLEE_SGIX_igloo_interface = GL_TRUE;
-        __GLeeLink_GL_SGIX_igloo_interface();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_igloo_interface();
     }
     if (__GLeeCheckExtension("GL_EXT_fragment_lighting", &extensionNames) )
     {
         _GLEE_EXT_fragment_lighting = GL_TRUE;
-        __GLeeLink_GL_EXT_fragment_lighting();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_fragment_lighting();
     }
     if (__GLeeCheckExtension("GL_EXT_packed_depth_stencil", &extensionNames) )
     {
         _GLEE_EXT_packed_depth_stencil = GL_TRUE;
-        __GLeeLink_GL_EXT_packed_depth_stencil();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_packed_depth_stencil();
     }
     if (__GLeeCheckExtension("GL_EXT_scene_marker", &extensionNames) )
     {
         _GLEE_EXT_scene_marker = GL_TRUE;
-        __GLeeLink_GL_EXT_scene_marker();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_scene_marker();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_compression_dxt1", &extensionNames) )
     {
         _GLEE_EXT_texture_compression_dxt1 = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_compression_dxt1();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_compression_dxt1();
     }
     if (__GLeeCheckExtension("GL_EXT_texture_env", &extensionNames) )
     {
         _GLEE_EXT_texture_env = GL_TRUE;
-        __GLeeLink_GL_EXT_texture_env();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_EXT_texture_env();
     }
     if (__GLeeCheckExtension("GL_IBM_static_data", &extensionNames) )
     {
         _GLEE_IBM_static_data = GL_TRUE;
-        __GLeeLink_GL_IBM_static_data();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_IBM_static_data();
     }
     if (__GLeeCheckExtension("GL_OES_byte_coordinates", &extensionNames) )
     {
         _GLEE_OES_byte_coordinates = GL_TRUE;
-        __GLeeLink_GL_OES_byte_coordinates();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OES_byte_coordinates();
     }
     if (__GLeeCheckExtension("GL_OES_compressed_paletted_texture", &extensionNames) )
     {
         _GLEE_OES_compressed_paletted_texture = GL_TRUE;
-        __GLeeLink_GL_OES_compressed_paletted_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OES_compressed_paletted_texture();
     }
     if (__GLeeCheckExtension("GL_OES_single_precision", &extensionNames) )
     {
         _GLEE_OES_single_precision = GL_TRUE;
-        __GLeeLink_GL_OES_single_precision();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_OES_single_precision();
     }
     if (__GLeeCheckExtension("GL_SGIX_pixel_texture_bits", &extensionNames) )
     {
         _GLEE_SGIX_pixel_texture_bits = GL_TRUE;
-        __GLeeLink_GL_SGIX_pixel_texture_bits();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_pixel_texture_bits();
     }
     if (__GLeeCheckExtension("GL_SGIX_texture_range", &extensionNames) )
     {
         _GLEE_SGIX_texture_range = GL_TRUE;
-        __GLeeLink_GL_SGIX_texture_range();
+        if (!__GLeeLazyLinking) __GLeeLink_GL_SGIX_texture_range();
     }
 #ifdef WIN32
     if (__GLeeCheckExtension("WGL_ARB_buffer_region", &extensionNames) )
     {
         _GLEE_WGL_ARB_buffer_region = GL_TRUE;
-        __GLeeLink_WGL_ARB_buffer_region();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_buffer_region();
     }
     if (__GLeeCheckExtension("WGL_ARB_multisample", &extensionNames) )
     {
         _GLEE_WGL_ARB_multisample = GL_TRUE;
-        __GLeeLink_WGL_ARB_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_multisample();
     }
     if (__GLeeCheckExtension("WGL_ARB_extensions_string", &extensionNames) )
     {
         _GLEE_WGL_ARB_extensions_string = GL_TRUE;
-        __GLeeLink_WGL_ARB_extensions_string();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_extensions_string();
     }
     if (__GLeeCheckExtension("WGL_ARB_pixel_format", &extensionNames) )
     {
         _GLEE_WGL_ARB_pixel_format = GL_TRUE;
-        __GLeeLink_WGL_ARB_pixel_format();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_pixel_format();
     }
     if (__GLeeCheckExtension("WGL_ARB_make_current_read", &extensionNames) )
     {
         _GLEE_WGL_ARB_make_current_read = GL_TRUE;
-        __GLeeLink_WGL_ARB_make_current_read();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_make_current_read();
     }
     if (__GLeeCheckExtension("WGL_ARB_pbuffer", &extensionNames) )
     {
         _GLEE_WGL_ARB_pbuffer = GL_TRUE;
-        __GLeeLink_WGL_ARB_pbuffer();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_pbuffer();
     }
     if (__GLeeCheckExtension("WGL_ARB_render_texture", &extensionNames) )
     {
         _GLEE_WGL_ARB_render_texture = GL_TRUE;
-        __GLeeLink_WGL_ARB_render_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_render_texture();
     }
     if (__GLeeCheckExtension("WGL_ARB_pixel_format_float", &extensionNames) )
     {
         _GLEE_WGL_ARB_pixel_format_float = GL_TRUE;
-        __GLeeLink_WGL_ARB_pixel_format_float();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ARB_pixel_format_float();
     }
     if (__GLeeCheckExtension("WGL_EXT_make_current_read", &extensionNames) )
     {
         _GLEE_WGL_EXT_make_current_read = GL_TRUE;
-        __GLeeLink_WGL_EXT_make_current_read();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_make_current_read();
     }
     if (__GLeeCheckExtension("WGL_EXT_pixel_format", &extensionNames) )
     {
         _GLEE_WGL_EXT_pixel_format = GL_TRUE;
-        __GLeeLink_WGL_EXT_pixel_format();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_pixel_format();
     }
     if (__GLeeCheckExtension("WGL_EXT_pbuffer", &extensionNames) )
     {
         _GLEE_WGL_EXT_pbuffer = GL_TRUE;
-        __GLeeLink_WGL_EXT_pbuffer();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_pbuffer();
     }
     if (__GLeeCheckExtension("WGL_EXT_depth_float", &extensionNames) )
     {
         _GLEE_WGL_EXT_depth_float = GL_TRUE;
-        __GLeeLink_WGL_EXT_depth_float();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_depth_float();
     }
     if (__GLeeCheckExtension("WGL_3DFX_multisample", &extensionNames) )
     {
         _GLEE_WGL_3DFX_multisample = GL_TRUE;
-        __GLeeLink_WGL_3DFX_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_3DFX_multisample();
     }
     if (__GLeeCheckExtension("WGL_EXT_multisample", &extensionNames) )
     {
         _GLEE_WGL_EXT_multisample = GL_TRUE;
-        __GLeeLink_WGL_EXT_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_multisample();
     }
     if (__GLeeCheckExtension("WGL_I3D_digital_video_control", &extensionNames) )
     {
         _GLEE_WGL_I3D_digital_video_control = GL_TRUE;
-        __GLeeLink_WGL_I3D_digital_video_control();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_digital_video_control();
     }
     if (__GLeeCheckExtension("WGL_I3D_gamma", &extensionNames) )
     {
         _GLEE_WGL_I3D_gamma = GL_TRUE;
-        __GLeeLink_WGL_I3D_gamma();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_gamma();
     }
     if (__GLeeCheckExtension("WGL_I3D_genlock", &extensionNames) )
     {
         _GLEE_WGL_I3D_genlock = GL_TRUE;
-        __GLeeLink_WGL_I3D_genlock();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_genlock();
     }
     if (__GLeeCheckExtension("WGL_I3D_image_buffer", &extensionNames) )
     {
         _GLEE_WGL_I3D_image_buffer = GL_TRUE;
-        __GLeeLink_WGL_I3D_image_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_image_buffer();
     }
     if (__GLeeCheckExtension("WGL_I3D_swap_frame_lock", &extensionNames) )
     {
         _GLEE_WGL_I3D_swap_frame_lock = GL_TRUE;
-        __GLeeLink_WGL_I3D_swap_frame_lock();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_swap_frame_lock();
     }
     if (__GLeeCheckExtension("WGL_NV_render_depth_texture", &extensionNames) )
     {
         _GLEE_WGL_NV_render_depth_texture = GL_TRUE;
-        __GLeeLink_WGL_NV_render_depth_texture();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_NV_render_depth_texture();
     }
     if (__GLeeCheckExtension("WGL_NV_render_texture_rectangle", &extensionNames) )
     {
         _GLEE_WGL_NV_render_texture_rectangle = GL_TRUE;
-        __GLeeLink_WGL_NV_render_texture_rectangle();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_NV_render_texture_rectangle();
     }
     if (__GLeeCheckExtension("WGL_ATI_pixel_format_float", &extensionNames) )
     {
         _GLEE_WGL_ATI_pixel_format_float = GL_TRUE;
-        __GLeeLink_WGL_ATI_pixel_format_float();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_ATI_pixel_format_float();
     }
     if (__GLeeCheckExtension("WGL_NV_float_buffer", &extensionNames) )
     {
         _GLEE_WGL_NV_float_buffer = GL_TRUE;
-        __GLeeLink_WGL_NV_float_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_NV_float_buffer();
     }
     if (__GLeeCheckExtension("WGL_EXT_display_color_table", &extensionNames) )
     {
         _GLEE_WGL_EXT_display_color_table = GL_TRUE;
-        __GLeeLink_WGL_EXT_display_color_table();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_display_color_table();
     }
     if (__GLeeCheckExtension("WGL_EXT_extensions_string", &extensionNames) )
     {
         _GLEE_WGL_EXT_extensions_string = GL_TRUE;
-        __GLeeLink_WGL_EXT_extensions_string();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_extensions_string();
     }
     if (__GLeeCheckExtension("WGL_EXT_swap_control", &extensionNames) )
     {
         _GLEE_WGL_EXT_swap_control = GL_TRUE;
-        __GLeeLink_WGL_EXT_swap_control();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_EXT_swap_control();
     }
     if (__GLeeCheckExtension("WGL_NV_vertex_array_range", &extensionNames) )
     {
         _GLEE_WGL_NV_vertex_array_range = GL_TRUE;
-        __GLeeLink_WGL_NV_vertex_array_range();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_NV_vertex_array_range();
     }
     if (__GLeeCheckExtension("WGL_OML_sync_control", &extensionNames) )
     {
         _GLEE_WGL_OML_sync_control = GL_TRUE;
-        __GLeeLink_WGL_OML_sync_control();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_OML_sync_control();
     }
     if (__GLeeCheckExtension("WGL_I3D_swap_frame_usage", &extensionNames) )
     {
         _GLEE_WGL_I3D_swap_frame_usage = GL_TRUE;
-        __GLeeLink_WGL_I3D_swap_frame_usage();
+        if (!__GLeeLazyLinking) __GLeeLink_WGL_I3D_swap_frame_usage();
     }
 #else //end WGL
     if (__GLeeCheckExtension("GLX_VERSION_1_3", &extensionNames) )
     {
         _GLEE_GLX_VERSION_1_3 = GL_TRUE;
-        __GLeeLink_GLX_VERSION_1_3();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_VERSION_1_3();
     }
     if (__GLeeCheckExtension("GLX_VERSION_1_4", &extensionNames) )
     {
         _GLEE_GLX_VERSION_1_4 = GL_TRUE;
-        __GLeeLink_GLX_VERSION_1_4();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_VERSION_1_4();
     }
     if (__GLeeCheckExtension("GLX_ARB_multisample", &extensionNames) )
     {
         _GLEE_GLX_ARB_multisample = GL_TRUE;
-        __GLeeLink_GLX_ARB_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_ARB_multisample();
     }
     if (__GLeeCheckExtension("GLX_ARB_fbconfig_float", &extensionNames) )
     {
         _GLEE_GLX_ARB_fbconfig_float = GL_TRUE;
-        __GLeeLink_GLX_ARB_fbconfig_float();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_ARB_fbconfig_float();
     }
     if (__GLeeCheckExtension("GLX_SGIS_multisample", &extensionNames) )
     {
         _GLEE_GLX_SGIS_multisample = GL_TRUE;
-        __GLeeLink_GLX_SGIS_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIS_multisample();
     }
     if (__GLeeCheckExtension("GLX_EXT_visual_info", &extensionNames) )
     {
         _GLEE_GLX_EXT_visual_info = GL_TRUE;
-        __GLeeLink_GLX_EXT_visual_info();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_EXT_visual_info();
     }
     if (__GLeeCheckExtension("GLX_SGI_swap_control", &extensionNames) )
     {
         _GLEE_GLX_SGI_swap_control = GL_TRUE;
-        __GLeeLink_GLX_SGI_swap_control();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGI_swap_control();
     }
     if (__GLeeCheckExtension("GLX_SGI_video_sync", &extensionNames) )
     {
         _GLEE_GLX_SGI_video_sync = GL_TRUE;
-        __GLeeLink_GLX_SGI_video_sync();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGI_video_sync();
     }
     if (__GLeeCheckExtension("GLX_SGI_make_current_read", &extensionNames) )
     {
         _GLEE_GLX_SGI_make_current_read = GL_TRUE;
-        __GLeeLink_GLX_SGI_make_current_read();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGI_make_current_read();
     }
     if (__GLeeCheckExtension("GLX_EXT_visual_rating", &extensionNames) )
     {
         _GLEE_GLX_EXT_visual_rating = GL_TRUE;
-        __GLeeLink_GLX_EXT_visual_rating();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_EXT_visual_rating();
     }
     if (__GLeeCheckExtension("GLX_EXT_import_context", &extensionNames) )
     {
         _GLEE_GLX_EXT_import_context = GL_TRUE;
-        __GLeeLink_GLX_EXT_import_context();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_EXT_import_context();
     }
     if (__GLeeCheckExtension("GLX_SGIX_fbconfig", &extensionNames) )
     {
         _GLEE_GLX_SGIX_fbconfig = GL_TRUE;
-        __GLeeLink_GLX_SGIX_fbconfig();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_fbconfig();
     }
     if (__GLeeCheckExtension("GLX_SGIX_pbuffer", &extensionNames) )
     {
         _GLEE_GLX_SGIX_pbuffer = GL_TRUE;
-        __GLeeLink_GLX_SGIX_pbuffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_pbuffer();
     }
     if (__GLeeCheckExtension("GLX_SGI_cushion", &extensionNames) )
     {
         _GLEE_GLX_SGI_cushion = GL_TRUE;
-        __GLeeLink_GLX_SGI_cushion();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGI_cushion();
     }
     if (__GLeeCheckExtension("GLX_SGIX_video_resize", &extensionNames) )
     {
         _GLEE_GLX_SGIX_video_resize = GL_TRUE;
-        __GLeeLink_GLX_SGIX_video_resize();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_video_resize();
     }
     if (__GLeeCheckExtension("GLX_SGIX_swap_group", &extensionNames) )
     {
         _GLEE_GLX_SGIX_swap_group = GL_TRUE;
-        __GLeeLink_GLX_SGIX_swap_group();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_swap_group();
     }
     if (__GLeeCheckExtension("GLX_SGIX_swap_barrier", &extensionNames) )
     {
         _GLEE_GLX_SGIX_swap_barrier = GL_TRUE;
-        __GLeeLink_GLX_SGIX_swap_barrier();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_swap_barrier();
     }
     if (__GLeeCheckExtension("GLX_SGIS_blended_overlay", &extensionNames) )
     {
         _GLEE_GLX_SGIS_blended_overlay = GL_TRUE;
-        __GLeeLink_GLX_SGIS_blended_overlay();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIS_blended_overlay();
     }
     if (__GLeeCheckExtension("GLX_SGIS_shared_multisample", &extensionNames) )
     {
         _GLEE_GLX_SGIS_shared_multisample = GL_TRUE;
-        __GLeeLink_GLX_SGIS_shared_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIS_shared_multisample();
     }
     if (__GLeeCheckExtension("GLX_SUN_get_transparent_index", &extensionNames) )
     {
         _GLEE_GLX_SUN_get_transparent_index = GL_TRUE;
-        __GLeeLink_GLX_SUN_get_transparent_index();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SUN_get_transparent_index();
     }
     if (__GLeeCheckExtension("GLX_3DFX_multisample", &extensionNames) )
     {
         _GLEE_GLX_3DFX_multisample = GL_TRUE;
-        __GLeeLink_GLX_3DFX_multisample();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_3DFX_multisample();
     }
     if (__GLeeCheckExtension("GLX_MESA_copy_sub_buffer", &extensionNames) )
     {
         _GLEE_GLX_MESA_copy_sub_buffer = GL_TRUE;
-        __GLeeLink_GLX_MESA_copy_sub_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_MESA_copy_sub_buffer();
     }
     if (__GLeeCheckExtension("GLX_MESA_pixmap_colormap", &extensionNames) )
     {
         _GLEE_GLX_MESA_pixmap_colormap = GL_TRUE;
-        __GLeeLink_GLX_MESA_pixmap_colormap();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_MESA_pixmap_colormap();
     }
     if (__GLeeCheckExtension("GLX_MESA_release_buffers", &extensionNames) )
     {
         _GLEE_GLX_MESA_release_buffers = GL_TRUE;
-        __GLeeLink_GLX_MESA_release_buffers();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_MESA_release_buffers();
     }
     if (__GLeeCheckExtension("GLX_MESA_set_3dfx_mode", &extensionNames) )
     {
         _GLEE_GLX_MESA_set_3dfx_mode = GL_TRUE;
-        __GLeeLink_GLX_MESA_set_3dfx_mode();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_MESA_set_3dfx_mode();
     }
     if (__GLeeCheckExtension("GLX_SGIX_visual_select_group", &extensionNames) )
     {
         _GLEE_GLX_SGIX_visual_select_group = GL_TRUE;
-        __GLeeLink_GLX_SGIX_visual_select_group();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_visual_select_group();
     }
     if (__GLeeCheckExtension("GLX_OML_swap_method", &extensionNames) )
     {
         _GLEE_GLX_OML_swap_method = GL_TRUE;
-        __GLeeLink_GLX_OML_swap_method();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_OML_swap_method();
     }
     if (__GLeeCheckExtension("GLX_OML_sync_control", &extensionNames) )
     {
         _GLEE_GLX_OML_sync_control = GL_TRUE;
-        __GLeeLink_GLX_OML_sync_control();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_OML_sync_control();
     }
     if (__GLeeCheckExtension("GLX_NV_float_buffer", &extensionNames) )
     {
         _GLEE_GLX_NV_float_buffer = GL_TRUE;
-        __GLeeLink_GLX_NV_float_buffer();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_NV_float_buffer();
     }
     if (__GLeeCheckExtension("GLX_SGIX_hyperpipe", &extensionNames) )
     {
         _GLEE_GLX_SGIX_hyperpipe = GL_TRUE;
-        __GLeeLink_GLX_SGIX_hyperpipe();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_SGIX_hyperpipe();
     }
     if (__GLeeCheckExtension("GLX_MESA_agp_offset", &extensionNames) )
     {
         _GLEE_GLX_MESA_agp_offset = GL_TRUE;
-        __GLeeLink_GLX_MESA_agp_offset();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_MESA_agp_offset();
     }
     if (__GLeeCheckExtension("GLX_EXT_scene_marker", &extensionNames) )
     {
         _GLEE_GLX_EXT_scene_marker = GL_TRUE;
-        __GLeeLink_GLX_EXT_scene_marker();
+        if (!__GLeeLazyLinking) __GLeeLink_GLX_EXT_scene_marker();
     }
 #endif //end GLX
 
@@ -9941,6 +9941,13 @@ GLEE_EXTERN const char * GLeeGetErrorString();
 GLEE_EXTERN const char * GLeeGetExtStrGL();
 GLEE_EXTERN GLboolean GLeeEnabled(GLboolean * extensionQueryingVariable);
 
+//lazy linking: on by default, set before GLeeInit or the first GL call
+GLEE_EXTERN void GLeeSetLazyLinking(GLboolean lazy);
+GLEE_EXTERN GLboolean GLeeGetLazyLinking();
+GLEE_EXTERN GLint GLeeGetLazyLinkedCount();
+GLEE_EXTERN GLint GLeeGetUsedExtensionCount();
+GLEE_EXTERN const char * GLeeGetUsedExtension(GLint index);
+
 #ifdef WIN32
 GLEE_EXTERN const char * GLeeGetExtStrWGL();
 #else 
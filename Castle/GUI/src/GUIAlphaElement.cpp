@@ -8,7 +8,7 @@ GUIAlphaElement::GUIAlphaElement(const std::string &callback) :  GUIRectangle(ca
   color.w        = minAlpha;
 }
 
-bool GUIAlphaElement::loadXMLSettings(const TiXmlElement *element)
+bool GUIAlphaElement::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!element)
     return false;
@@ -16,7 +16,7 @@ bool GUIAlphaElement::loadXMLSettings(const TiXmlElement *element)
   setAlphaFadeScale(XMLArbiter::fillComponents1f(element, "alphaFadeScale", alphaFadeScale));
   setMinAlpha(XMLArbiter::fillComponents1f(element, "minAlpha", minAlpha));
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -51,6 +51,7 @@ void GUIAlphaElement::setColor(float r, float g, float b)
   color.x /= (color.x > 1.0) ? 255.0f : 1.0f;
   color.y /= (color.y > 1.0) ? 255.0f : 1.0f;
   color.z /= (color.z > 1.0) ? 255.0f : 1.0f;
+  dirty    = true;
 }
 
 const Tuple4f &GUIAlphaElement::getColor()
@@ -75,7 +76,10 @@ const std::string &GUIAlphaElement::getLabelString()
 
 void  GUIAlphaElement::setAlpha(float alphaArg)
 {
-  color.w = clamp(alphaArg, minAlpha, 1.0f);
+  float alpha = clamp(alphaArg, minAlpha, 1.0f);
+
+  dirty  |= (alpha != color.w);
+  color.w = alpha;
 }
 
 float GUIAlphaElement::getAlpha()
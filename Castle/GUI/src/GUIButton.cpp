@@ -12,9 +12,10 @@ GUIButton::GUIButton(const std::string &callback) :  GUIAlphaElement(callback),
   drawBackground = true;
   drawBounds     = true;
   bounce         = true;
+  displacement   = 0;
 }
 
-bool GUIButton::loadXMLSettings(const TiXmlElement *element)
+bool GUIButton::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "Button"))
     return Logger::writeErrorLog("Need a Button node in the xml file");
@@ -33,17 +34,19 @@ void GUIButton::render(float clockTick)
     return;
 
   modifyCurrentAlpha(clockTick);
-  bgColor = color;
 
-  Tuple3f tempColor    = label.getColor();
-  float   displacement = 2.0f*(pressed || clicked)*bounce;
+  int     offset       = 2*(pressed || clicked)*bounce;
   int     xCenter      = (windowBounds.x + windowBounds.z)/2,
           yCenter      = (windowBounds.y + windowBounds.w)/2;
 
-  glTranslatef(displacement, displacement, 0.0);
-  renderClippedBounds();
-  label.printCenteredXY(xCenter, yCenter);
-  glTranslatef(-displacement, -displacement, 0.0f);
+  if(rebuildGeometry(modified || offset != displacement))
+  {
+    bgColor      = color;
+    displacement = offset;
+    recordClippedBounds(geometry, displacement);
+  }
+  submitGeometry();
+  label.printCenteredXY(xCenter + displacement, yCenter + displacement);
 }
 
 const void GUIButton::computeWindowBounds()
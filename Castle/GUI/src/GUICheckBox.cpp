@@ -16,7 +16,7 @@ GUICheckBox::GUICheckBox(const std::string &callback) :  GUIAlphaElement(callbac
   extra            = 0;
 }
 
-bool GUICheckBox::loadXMLSettings(const TiXmlElement *element)
+bool GUICheckBox::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(widgetType == WT_CHECK_BOX)
   if(!element || !element->Value() || strcmp(element->Value(),  "CheckBox"))
@@ -28,7 +28,7 @@ bool GUICheckBox::loadXMLSettings(const TiXmlElement *element)
 
   setChecked(XMLArbiter::analyzeBooleanAttr(element,  "checked", false));
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -58,7 +58,10 @@ float  GUICheckBox::getMinAlphaMark()
 
 void  GUICheckBox::setAlphaMark(float mark)
 {
-  alphaMark = clamp(mark, minAlphaMark, 10.0f);
+  float newMark = clamp(mark, minAlphaMark, 10.0f);
+
+  dirty    |= (newMark != alphaMark);
+  alphaMark = newMark;
 }
 
 float  GUICheckBox::getAlphaMark()
@@ -107,83 +110,37 @@ void GUICheckBox::render(float clockTick)
 
   int yCenter = (windowBounds.y + windowBounds.w)/2;
 
-  glEnable(GL_BLEND);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-  glColor4fv(color);
-
-  if(descriptor)
-  {
-    const Tuple4f &texCoords = descriptor->getTexCoords();
-    parent->enableGUITexture();
-
-    glBegin(GL_TRIANGLE_STRIP);
-    glTexCoord2f(texCoords.x, texCoords.y);
-    glVertex2i(windowBounds.x, windowBounds.y);
-
-    glTexCoord2f(texCoords.x, texCoords.w);
-    glVertex2i(windowBounds.x, windowBounds.w);
-
-    glTexCoord2f(texCoords.z, texCoords.y);
-    glVertex2i(windowBounds.x + extra, windowBounds.y);
-
-    glTexCoord2f(texCoords.z, texCoords.w);
-    glVertex2i(windowBounds.x + extra, windowBounds.w);
-    glEnd();
-
-    parent->disableGUITexture();
-  }
-  else
-  {
-    glBegin(GL_TRIANGLE_STRIP);
-    glVertex2i(windowBounds.x, windowBounds.y);
-    glVertex2i(windowBounds.x, windowBounds.w);
-    glVertex2i(windowBounds.x + extra, windowBounds.y);
-    glVertex2i(windowBounds.x + extra, windowBounds.w);
-    glEnd();
-  }
-
   if(!checked)
     setAlphaMark(alphaMark - clockTick*alphaFadeScale*10.0f);
   else
     setAlphaMark(alphaMark + clockTick*alphaFadeScale*10.0f);
- 
-  if(alphaMark != minAlphaMark)
-  {
-    glColor4f(1.0f, 1.0f, 1.0f, alphaMark);
-
-    if(descriptorCB)
-    { 
-      const Tuple4f &texCoords = descriptorCB->getTexCoords();
-      parent->enableGUITexture();
 
-      glBegin(GL_TRIANGLE_STRIP);
-      glTexCoord2f(texCoords.x, texCoords.y);
-      glVertex2i(windowBounds.x + markOffset, windowBounds.y + markOffset); 
+  if(rebuildGeometry())
+  {
+    Texture *texture = getGUITexture();
+    Tuple4i  bounds(windowBounds.x, windowBounds.y,
+                    windowBounds.x + extra, windowBounds.w);
 
-      glTexCoord2f(texCoords.x, texCoords.w);
-      glVertex2i(windowBounds.x + markOffset, windowBounds.w - markOffset); 
+    if(descriptor)
+      geometry.addQuad(bounds, color, texture, &descriptor->getTexCoords());
+    else
+      geometry.addQuad(bounds, color);
 
-      glTexCoord2f(texCoords.z, texCoords.y);
-      glVertex2i(windowBounds.x - markOffset + extra, windowBounds.y + markOffset); 
+    if(alphaMark != minAlphaMark)
+    {
+      Tuple4f markColor(1.0f, 1.0f, 1.0f, alphaMark);
 
-      glTexCoord2f(texCoords.z, texCoords.w);
-      glVertex2i(windowBounds.x - markOffset + extra, windowBounds.w - markOffset); 
-      glEnd();
+      bounds.set(windowBounds.x + markOffset, windowBounds.y + markOffset,
+                 windowBounds.x - markOffset + extra, windowBounds.w - markOffset);
 
-      parent->disableGUITexture();
+      if(descriptorCB)
+        geometry.addQuad(bounds, markColor, texture, &descriptorCB->getTexCoords());
+      else
+        geometry.addQuad(bounds, markColor);
     }
-    else
-    {
-      glBegin(GL_TRIANGLE_STRIP);
-      glVertex2i(windowBounds.x + markOffset, windowBounds.y + markOffset); 
-      glVertex2i(windowBounds.x + markOffset, windowBounds.w - markOffset); 
-      glVertex2i(windowBounds.x - markOffset + extra, windowBounds.y + markOffset); 
-      glVertex2i(windowBounds.x - markOffset + extra, windowBounds.w - markOffset); 
-      glEnd();
-   }
   }
+  submitGeometry();
 
-  glDisable(GL_BLEND);
   label.printCenteredY(windowBounds.x + extra + 2, yCenter);
 }
 
@@ -9,11 +9,13 @@ GUIClippedRectangle::GUIClippedRectangle(int size)
 
   drawBackground = false;
   drawBounds     = false;
+  modified       = true;
 }
 
 void  GUIClippedRectangle::setClipSize(int clipSizeArg)
 {
   clipSize = clamp(clipSizeArg, 0, 100);
+  modified = true;
 }
 
 int GUIClippedRectangle::getClipSize()
@@ -24,6 +26,7 @@ int GUIClippedRectangle::getClipSize()
 void GUIClippedRectangle::setVisibleBounds(bool visibleArg)
 {
   drawBounds = visibleArg;
+  modified   = true;
 }
 
 bool  GUIClippedRectangle::boundsVisible()
@@ -31,20 +34,23 @@ bool  GUIClippedRectangle::boundsVisible()
   return drawBounds;
 }
 
-bool GUIClippedRectangle::loadXMLClippedRectangleInfo(const TiXmlElement *element)
+bool GUIClippedRectangle::loadXMLClippedRectangleInfo(const CompiledXMLElement *element)
 {
   if(!element)
     return false;
 
-  const TiXmlElement *absolutePriority = XMLArbiter::getChildElementByName(element, "Texture");
+  const CompiledXMLElement *absolutePriority = XMLArbiter::getChildElementByName(element, "Texture");
   setVisibleBounds(XMLArbiter::analyzeBooleanAttr(element,  "drawBounds",     drawBounds));
   enableBGColor(XMLArbiter::analyzeBooleanAttr(element,     "drawBackground", drawBackground));
   setClipSize(XMLArbiter::fillComponents1i(element,         "clipSize",       clipSize));
  
   if(absolutePriority)
-    texture.loadXMLSettings(absolutePriority);
+  {
+    TiXmlElement textureNode(absolutePriority->Value());
+    texture.loadXMLSettings(absolutePriority->toXMLElement(textureNode));
+  }
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -82,6 +88,7 @@ void  GUIClippedRectangle::setBGColor(float r, float g, float b, float a)
   bgColor.y /= (bgColor.y > 1.0) ? 255.0f : 1.0f;
   bgColor.z /= (bgColor.z > 1.0) ? 255.0f : 1.0f;
   bgColor.w /= (bgColor.w > 1.0) ? 255.0f : 1.0f;
+  modified   = true;
 }
 
 void  GUIClippedRectangle::setBordersColor(const Tuple3f& color)
@@ -102,6 +109,7 @@ void  GUIClippedRectangle::setBordersColor(float r, float g, float b)
   bordersColor.x /= (bordersColor.x > 1.0) ? 255.0f : 1.0f;
   bordersColor.y /= (bordersColor.y > 1.0) ? 255.0f : 1.0f;
   bordersColor.z /= (bordersColor.z > 1.0) ? 255.0f : 1.0f;
+  modified        = true;
 }
 
 void GUIClippedRectangle::renderClippedBounds()
@@ -144,6 +152,22 @@ void GUIClippedRectangle::renderClippedBounds()
   glDisableClientState(GL_VERTEX_ARRAY);
 }
 
+void GUIClippedRectangle::recordClippedBounds(GUIGeometry &geometry, int offset)
+{
+  Tuple2i offsetVertices[7];
+
+  for(int i = 0; i < 7; i++)
+    offsetVertices[i].set(vertices[i].x + offset, vertices[i].y + offset);
+
+  if(drawBackground)
+    geometry.addFan(offsetVertices, 7, bgColor, &texture, texCoords);
+
+  if(drawBounds)
+    geometry.addLines(offsetVertices, 7, Tuple4f(bordersColor, 1.0f), true);
+
+  modified = false;
+}
+
 void  GUIClippedRectangle::computeClippedBounds(const Tuple4i &windowBounds)
 {
   float yTexOffset    = float(clipSize)/(windowBounds.w - windowBounds.y),
@@ -167,11 +191,13 @@ void  GUIClippedRectangle::computeClippedBounds(const Tuple4i &windowBounds)
   texCoords[4].set(textureRectangle.z             , textureRectangle.w);
   texCoords[5].set(textureRectangle.x + xTexOffset, textureRectangle.w             );
   texCoords[6].set(textureRectangle.x             , textureRectangle.w - yTexOffset);
+  modified = true;
 }
 
 void  GUIClippedRectangle::enableBGColor(bool enable)
 {
   drawBackground = enable;
+  modified       = true;
 }
 
 void GUIClippedRectangle::setTextureRectangle(const Tuple4f &tr)
@@ -201,6 +227,7 @@ void GUIClippedRectangle::setTextureRectangle(float x, float y, float z, float w
                        clamp(y, 0.0f, 1.0f),
                        clamp(z, 0.0f, 1.0f),
                        clamp(w, 0.0f, 1.0f));
+  modified = true;
 }
 
 const  Tuple4f &GUIClippedRectangle::getTextureRectangle()
@@ -215,7 +242,8 @@ Texture &GUIClippedRectangle::getTexture()
 
 void  GUIClippedRectangle::setTexture(const Texture & textureArg)
 {
-  texture = textureArg;
+  texture  = textureArg;
+  modified = true;
 }
 
 bool  GUIClippedRectangle::isBGColorOn()
@@ -63,12 +63,12 @@ const Tuple2f  &GUIComboBox::getFontScales()
   return fontScales;
 }
 
-bool GUIComboBox::loadXMLSettings(const TiXmlElement *element)
+bool GUIComboBox::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "ComboBox"))
     return Logger::writeErrorLog("Need a ComboBox node in the xml file");
 
-  const   TiXmlElement *child  = NULL;
+  const   CompiledXMLElement *child  = NULL;
   Tuple3f bordersColor         = upperPanel->getBordersColor();
   Tuple4f bgColor              = upperPanel->getBGColor();
   float   lowerPanelColorScale = 1.0f;
@@ -184,6 +184,7 @@ void GUIComboBox::render(float clockTick)
 
   if(lowerPanel->isVisible())
   {
+    flushGeometry();
     lowerPanel->renderClippedBounds();
     lowerPanel->enableBGColor(false);
     lowerPanel->setVisibleBounds(false);
@@ -8,7 +8,7 @@ bool GUIFont::build()
   return font.load(getName().c_str());
 }
 
-bool GUIFont::loadXMLSettings(const TiXmlElement *element)
+bool GUIFont::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "Font"))
     return Logger::writeErrorLog("Need a Font node in the xml file");
@@ -80,7 +80,7 @@ GUIFont *GUIFontManager::getFont(size_t index)
   return index >= guiFontList.size() ? NULL : guiFontList[index];
 }
 
-int GUIFontManager::addFont(const TiXmlElement *fontNode)
+int GUIFontManager::addFont(const CompiledXMLElement *fontNode)
 {
   GUIFont *newFont  = new GUIFont();
   int      index    = -1;
@@ -120,6 +120,14 @@ bool GUIFontManager::addFont(GUIFont *font)
   return true;
 }
 
+int GUIFontManager::flushText()
+{
+  int drawCalls = 0;
+  for(size_t i = 0; i < guiFontList.size(); i++)
+    drawCalls += guiFontList[i]->getFontObject()->flush();
+  return drawCalls;
+}
+
 void GUIFontManager::clear()
 {
   for(size_t i = 0; i < guiFontList.size(); i++)
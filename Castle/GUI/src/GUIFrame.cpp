@@ -6,14 +6,14 @@ GUIFrame::GUIFrame() : GUIPanel("GUI MAIN PANEL")
   update   = true;
 }
 
-bool GUIFrame::loadXMLSettings(const TiXmlElement *element) 
+bool GUIFrame::loadXMLSettings(const CompiledXMLElement *element) 
 {
   if(!XMLArbiter::inspectElementInfo(element, "Panel"))
     return Logger::writeErrorLog("Need a Panel node in the xml file");
 
   bool defaultFont = true;
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -35,7 +35,8 @@ bool GUIFrame::loadXMLSettings(const TiXmlElement *element)
  
     if(elementName == "Texture")
     {
-      if(elementsTexture.loadXMLSettings(child))
+      TiXmlElement textureNode(elementName);
+      if(elementsTexture.loadXMLSettings(child->toXMLElement(textureNode)))
       {
         GUITexCoordDescriptor::setTextureHeight(elementsTexture.getHeight());
         GUITexCoordDescriptor::setTextureWidth(elementsTexture.getWidth());
@@ -56,6 +57,9 @@ bool GUIFrame::loadXMLSettings(const TiXmlElement *element)
 
 void  GUIFrame::render(float tick)
 {
+  // Skins loaded with async = "true" fill in over the next frames.
+  TexturesManager::uploadTextureStreams();
+
   if(!visible)
     return;
 
@@ -68,8 +72,40 @@ void  GUIFrame::render(float tick)
     updateCount--;
   }
 
+  vertexBuffer.begin();
   for(t = 0; t < elements.size(); t++)
     elements[t]->render(tick);
+  vertexBuffer.end();
+}
+
+void GUIFrame::setRetained(bool retained)
+{
+  vertexBuffer.setRetained(retained);
+}
+
+bool GUIFrame::isRetained()
+{
+  return vertexBuffer.isRetained();
+}
+
+int GUIFrame::getRebuiltCount()
+{
+  return vertexBuffer.getRebuiltCount();
+}
+
+int GUIFrame::getDrawCallCount()
+{
+  return vertexBuffer.getDrawCallCount();
+}
+
+GUIVertexBuffer *GUIFrame::getVertexBuffer()
+{
+  return &vertexBuffer;
+}
+
+Texture *GUIFrame::getGUITexture()
+{
+  return !elementsTexture.getID() ? NULL : &elementsTexture;
 }
 
 void GUIFrame::addOrReplaceTexCoordsInfo(GUITexCoordDescriptor &info)
@@ -134,9 +170,11 @@ void GUIFrame::forceUpdate(bool update)
 
 void GUIFrame::clear()
 {
+  vertexBuffer.clear();
   elementsTexture.destroy();
   texCoords.clear();
   GUIPanel::clear();
+  TexturesManager::flushUnusedTextures();
 }
 
 const Tuple4i &GUIFrame::getWindowBounds()
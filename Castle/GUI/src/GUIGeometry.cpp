@@ -0,0 +1,171 @@
+#include "EasyGL.h"
+
+static unsigned int versionCounter = 0;
+
+GUIGeometry::GUIGeometry()
+{
+  version = ++versionCounter;
+}
+
+void GUIGeometry::clear()
+{
+  for(size_t i = 0; i < batches.size(); i++)
+    batches[i].vertices.clear();
+  version = ++versionCounter;
+}
+
+GUIBatch &GUIGeometry::getBatch(GUIBatches &batches, GLenum mode, Texture *texture)
+{
+  size_t t = batches.size();
+
+  // Trailing empty batches are left by clear() to keep their storage
+  while(t && batches[t - 1].vertices.empty())
+    t--;
+
+  if(t && batches[t - 1].mode == mode && batches[t - 1].texture == texture)
+    return batches[t - 1];
+
+  if(t == batches.size())
+    batches.push_back(GUIBatch());
+
+  batches[t].mode    = mode;
+  batches[t].texture = texture;
+  return batches[t];
+}
+
+void GUIGeometry::addQuad(const Tuple4i &bounds, const Tuple4f &color,
+                          Texture *texture, const Tuple4f *texCoords)
+{
+  Tuple2i vertices[4];
+  Tuple2f coords[4];
+
+  vertices[0].set(bounds.x, bounds.y);
+  vertices[1].set(bounds.x, bounds.w);
+  vertices[2].set(bounds.z, bounds.w);
+  vertices[3].set(bounds.z, bounds.y);
+
+  if(texCoords)
+  {
+    coords[0].set(texCoords->x, texCoords->y);
+    coords[1].set(texCoords->x, texCoords->w);
+    coords[2].set(texCoords->z, texCoords->w);
+    coords[3].set(texCoords->z, texCoords->y);
+  }
+  addFan(vertices, 4, color, texture, texCoords ? coords : NULL);
+}
+
+void GUIGeometry::addFan(const Tuple2i *vertices, int count, const Tuple4f &color,
+                         Texture *texture, const Tuple2f *texCoords)
+{
+  if(count < 3)
+    return;
+
+  texture = (texture && texture->getID() && texCoords) ? texture : NULL;
+
+  vector<GUIVertex> &batch = getBatch(batches, GL_TRIANGLES, texture).vertices;
+  GUIVertex          vertex;
+
+  vertex.s = vertex.t = 0.0f;
+  vertex.r = color.x;
+  vertex.g = color.y;
+  vertex.b = color.z;
+  vertex.a = color.w;
+
+  for(int i = 1; i < count - 1; i++)
+  {
+    int corners[3] = { 0, i, i + 1 };
+    for(int j = 0; j < 3; j++)
+    {
+      if(texture)
+      {
+        vertex.s = texCoords[corners[j]].x;
+        vertex.t = texCoords[corners[j]].y;
+      }
+      vertex.x = float(vertices[corners[j]].x);
+      vertex.y = float(vertices[corners[j]].y);
+      batch.push_back(vertex);
+    }
+  }
+}
+
+void GUIGeometry::addLines(const Tuple2i *vertices, int count, const Tuple4f &color,
+                           bool strip)
+{
+  vector<GUIVertex> &batch = getBatch(batches, GL_LINES, NULL).vertices;
+  GUIVertex          vertex;
+
+  vertex.s = vertex.t = 0.0f;
+  vertex.r = color.x;
+  vertex.g = color.y;
+  vertex.b = color.z;
+  vertex.a = color.w;
+
+  for(int i = 0; i + 1 < count; i += strip ? 1 : 2)
+    for(int j = i; j < i + 2; j++)
+    {
+      vertex.x = float(vertices[j].x);
+      vertex.y = float(vertices[j].y);
+      batch.push_back(vertex);
+    }
+}
+
+int GUIGeometry::draw() const
+{
+  return drawBatches(batches);
+}
+
+int GUIGeometry::drawBatches(const GUIBatches &batches)
+{
+  int drawCalls = 0;
+
+  if(!batches.size())
+    return 0;
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_COLOR_ARRAY);
+
+  for(size_t t = 0; t < batches.size(); t++)
+  {
+    const GUIBatch &batch = batches[t];
+    if(batch.vertices.empty())
+      continue;
+
+    const GUIVertex *vertices = &batch.vertices[0];
+    glVertexPointer(2, GL_FLOAT, sizeof(GUIVertex), &vertices->x);
+    glColorPointer(4, GL_FLOAT, sizeof(GUIVertex), &vertices->r);
+
+    if(batch.texture)
+    {
+      glTexCoordPointer(2, GL_FLOAT, sizeof(GUIVertex), &vertices->s);
+      glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+      batch.texture->activate();
+    }
+
+    glDrawArrays(batch.mode, 0, GLsizei(batch.vertices.size()));
+    drawCalls++;
+
+    if(batch.texture)
+    {
+      batch.texture->deactivate();
+      glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    }
+  }
+
+  glPopClientAttrib();
+  glDisable(GL_BLEND);
+  glColor3f(1,1,1);
+  return drawCalls;
+}
+
+const GUIBatches &GUIGeometry::getBatches() const
+{
+  return batches;
+}
+
+unsigned int GUIGeometry::getVersion() const
+{
+  return version;
+}
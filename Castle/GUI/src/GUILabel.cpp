@@ -8,7 +8,7 @@ GUILabel::GUILabel(const std::string &ls,
   widgetType = WT_LABEL;
 }
 
-bool GUILabel::loadXMLSettings(const TiXmlElement *element)
+bool GUILabel::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "Label"))
     return Logger::writeErrorLog("Need a Label node in the xml file");
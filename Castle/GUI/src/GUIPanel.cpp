@@ -1,4 +1,5 @@
 #include "EasyGL.h"
+#include <chrono>
 
 GUIPanel::GUIPanel(const std::string &cbs) : GUIRectangle(cbs), GUIClippedRectangle()
 {
@@ -9,23 +10,25 @@ GUIPanel::GUIPanel(const std::string &cbs) : GUIRectangle(cbs), GUIClippedRectan
 
 bool GUIPanel::loadXMLSettings(const char *stackPath)
 {
-  std::string xmlFile = MediaPathManager::lookUpMediaPath(stackPath);
-  bool        result = false;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  CompiledXML                           cfgStack;
+  bool                                  result = false;
 
-  if(!xmlFile.size())
-    return Logger::writeErrorLog("Failed to locate the XML GUI file");
-
-  TiXmlDocument cfgStack(xmlFile);
-
-  if(!cfgStack.LoadFile())
+  if(!cfgStack.loadFile(stackPath))
     return  Logger::writeErrorLog("Invalid XML GUI description file");
 
   result = loadXMLSettings(cfgStack.FirstChildElement());
   forceUpdate(true);
+
+  char timing[64];
+  sprintf(timing, " in %.2f ms",
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+  logInfo(std::string("Built GUI from ") + stackPath +
+          (cfgStack.isFromBinary() ? " (compiled)" : " (XML)") + timing);
   return result;
 }
 
-bool GUIPanel::loadXMLSettings(const TiXmlElement *element)
+bool GUIPanel::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "Panel"))
     return Logger::writeErrorLog("Need a Panel node in the xml file");
@@ -41,7 +44,7 @@ bool GUIPanel::loadXMLSettings(const TiXmlElement *element)
            (type == "XAXIS"    ) ? PL_XAXIS_LAYOUT     :
            (type == "GRID"     ) ? PL_GRID_LAYOUT      : PL_FREE_LAYOUT;
 
-  for(const TiXmlElement *child = element->FirstChildElement();
+  for(const CompiledXMLElement *child = element->FirstChildElement();
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -219,7 +222,10 @@ void  GUIPanel::render(float tick)
 
   if(visible)
   {
-    renderClippedBounds();
+    if(rebuildGeometry(modified))
+      recordClippedBounds(geometry);
+    submitGeometry();
+
     for(int t = (int)elements.size() - 1; t >= 0; t--)
       if(elements[t]->getWidgetType() != WT_COMBO_BOX)
         elements[t]->render(tick);
@@ -232,8 +238,17 @@ void  GUIPanel::render(float tick)
           comboBoxes.push_back(elements[t]);
       }
 
+    // Deployed lists cover the widgets below them, so they go in a later
+    // batch
+    if(comboBoxes.size())
+      flushGeometry();
+
     for(size_t t = 0; t < comboBoxes.size(); t++)
       comboBoxes[t]->render(tick);
+
+    // Panels may overlap whatever renders after them, so their text is
+    // drawn now rather than on top of it
+    flushGeometry();
   }
 }
 
@@ -295,6 +310,7 @@ void GUIPanel::pack()
 void GUIPanel::forceUpdate(bool updateArg)
 {
   update = updateArg;
+  dirty |= updateArg;
   pack();
 }
 
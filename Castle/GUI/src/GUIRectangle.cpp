@@ -20,6 +20,7 @@ GUIRectangle::GUIRectangle(const std::string &callback)
   visible    =   true;
   active     =   true;
   update     =  false;
+  dirty      =   true;
 }
 
 void GUIRectangle::setParent(GUIRectangle *parentArg)
@@ -41,9 +42,10 @@ int   GUIRectangle::getWidgetType()
 void  GUIRectangle::forceUpdate(bool updateArg)
 {
   update = updateArg;
+  dirty |= updateArg;
 }
 
-bool GUIRectangle::loadXMLSettings(const TiXmlElement *element)
+bool GUIRectangle::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!element)
     return false;
@@ -63,7 +65,7 @@ bool GUIRectangle::loadXMLSettings(const TiXmlElement *element)
   setVisible(XMLArbiter::analyzeBooleanAttr(element, "visible", true));
   setActive(XMLArbiter::analyzeBooleanAttr(element,  "active", true));
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -82,6 +84,47 @@ bool GUIRectangle::loadXMLSettings(const TiXmlElement *element)
   return true;
 }
 
+GUIVertexBuffer *GUIRectangle::getVertexBuffer()
+{
+  return !parent ? NULL : parent->getVertexBuffer();
+}
+
+Texture *GUIRectangle::getGUITexture()
+{
+  return !parent ? NULL : parent->getGUITexture();
+}
+
+bool GUIRectangle::rebuildGeometry(bool force)
+{
+  if(!force && !dirty && recordedBounds == windowBounds)
+    return false;
+
+  geometry.clear();
+  recordedBounds = windowBounds;
+  dirty          = false;
+  return true;
+}
+
+void GUIRectangle::submitGeometry()
+{
+  GUIVertexBuffer *buffer = getVertexBuffer();
+
+  if(buffer)
+    buffer->submit(geometry);
+  else
+    geometry.draw();
+}
+
+void GUIRectangle::flushGeometry()
+{
+  GUIVertexBuffer *buffer = getVertexBuffer();
+
+  if(buffer)
+    buffer->flush();
+  else
+    GUIFontManager::flushText();
+}
+
 void  GUIRectangle::enableGUITexture()
 {
   if(parent)
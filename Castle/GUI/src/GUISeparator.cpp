@@ -7,7 +7,7 @@ GUISeparator::GUISeparator(int orientation_) : GUIRectangle()
   widgetType = WT_SEPARATOR;
 }
 
-bool GUISeparator::loadXMLSettings(const TiXmlElement *element)
+bool GUISeparator::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!element || !element->Value() || strcmp(element->Value(),  "Separator"))
     return Logger::writeErrorLog("Need a <Separator> tag");
@@ -41,13 +41,15 @@ void GUISeparator::render(float tick)
   if(!parent || !((GUIPanel*)parent)->isBGColorOn())
     return;
 
-  glColor3fv(((GUIPanel*)parent)->getBordersColor());
+  if(rebuildGeometry())
+  {
+    Tuple2i vertices[2];
 
-  glBegin(GL_LINES);
-  glVertex2i(windowBounds.x, windowBounds.y);
-  glVertex2i(windowBounds.z, (orientation == OR_VERTICAL) ? windowBounds.w : windowBounds.y);
-  glEnd();
-  glColor3f(1.0f, 1.0f, 1.0f);
+    vertices[0].set(windowBounds.x, windowBounds.y);
+    vertices[1].set(windowBounds.z, (orientation == OR_VERTICAL) ? windowBounds.w : windowBounds.y);
+    geometry.addLines(vertices, 2, Tuple4f(((GUIPanel*)parent)->getBordersColor(), 1.0f));
+  }
+  submitGeometry();
 }
 
 void const GUISeparator::computeWindowBounds()
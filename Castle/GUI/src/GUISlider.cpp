@@ -12,7 +12,7 @@ GUISlider::GUISlider(const std::string &callback, const int   orientation_) :  G
                 (orientation_ == OR_VERTICAL) ?  85.0f :  18.0f);
 }
 
-bool GUISlider::loadXMLSettings(const TiXmlElement *element)
+bool GUISlider::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "Slider"))
     return Logger::writeErrorLog("Need a Slider node in the xml file");
@@ -63,6 +63,7 @@ void GUISlider::render(float clockTick)
     return;
 
   modifyCurrentAlpha(clockTick);  
+  flushGeometry();
 
   if(orientation == OR_VERTICAL)
   {
@@ -58,7 +58,7 @@ const Tuple2f  &GUITabbedPanel::getFontScales()
   return fontScales;
 }
 
-bool GUITabbedPanel::loadXMLSettings(const TiXmlElement *element)
+bool GUITabbedPanel::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "TabbedPanel"))
     return Logger::writeErrorLog("Need a TabbedPanel node in the xml file");
@@ -71,7 +71,7 @@ bool GUITabbedPanel::loadXMLSettings(const TiXmlElement *element)
   fontScales.x  = XMLArbiter::fillComponents1f(element,   "wScale",    fontScales.x);
   fontIndex     = XMLArbiter::fillComponents1i(element,   "fontIndex", fontIndex);
 
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
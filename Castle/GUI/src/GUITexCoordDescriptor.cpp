@@ -79,7 +79,7 @@ int GUITexCoordDescriptor::getType()
   return widgetType;
 }
 
-void GUITexCoordDescriptor::loadXMLSettings(const TiXmlElement *element)
+void GUITexCoordDescriptor::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "TexCoordsDesc"))
     return;
@@ -5,6 +5,7 @@ GUIText::GUIText(const std::string &text)
   fontIndex =    -1;
   update    = true;
 
+  invalidateVertices();
   color.set(1.0,1.0,1.0);
   scales.set(1.0f, 1.0f);
   setString(text);
@@ -25,6 +26,7 @@ GUIText &GUIText::operator =(const GUIText & copy)
     color     = copy.color;
     size      = copy.size;
     text      = copy.text;
+    invalidateVertices();
   }
   return *this;
 }
@@ -35,12 +37,12 @@ GUIText &GUIText::operator =(const std::string & str)
   return *this;
 }
 
-bool GUIText::loadXMLSettings(const TiXmlElement *element)
+bool GUIText::loadXMLSettings(const CompiledXMLElement *element)
 {
   if(!element || !element->Value() || strcmp(element->Value(),  "Text"))
     return Logger::writeErrorLog("Need a Text node in the xml file");
  
-  for(const TiXmlElement *child = element->FirstChildElement();	
+  for(const CompiledXMLElement *child = element->FirstChildElement();	
       child;
    	  child = child->NextSiblingElement() )
   {
@@ -72,6 +74,7 @@ void GUIText::setString(const std::string &textArg)
   {
     text   = textArg;
     update = true;
+    invalidateVertices();
   }
 }
 
@@ -81,6 +84,7 @@ void GUIText::setString(const char *textArg)
   {
     text   = textArg;
     update = true;
+    invalidateVertices();
   }
 }
 
@@ -93,6 +97,7 @@ void GUIText::clear()
 #endif
   update = false;
   size.set(0,0);
+  invalidateVertices();
 }
 
 int GUIText::getFontIndex()
@@ -103,6 +108,13 @@ int GUIText::getFontIndex()
 void GUIText::setFontIndex(int index)
 {
   fontIndex = index;
+  invalidateVertices();
+}
+
+void GUIText::invalidateVertices()
+{
+  verticesFont  = NULL;
+  verticesValid = false;
 }
 
 void  GUIText::print(int x, int y, int startIndex, int endIndex)
@@ -120,32 +132,23 @@ void  GUIText::print(int x, int y, int startIndex, int endIndex)
   if(!currentFont && !(currentFont = GUIFontManager::getDefaultFont()))
     return;
 
-  int s,e,y2;
-  s = startIndex;
-  e = endIndex;
-  y2 = y;
-  while (true)
+  CFont *font = currentFont->getFontObject();
+  if(!verticesValid || verticesFont != font ||
+     verticesPosition.x != x || verticesPosition.y != y ||
+     verticesStart != startIndex || verticesEnd != endIndex)
   {
-      std::string::size_type p = text.find("\n", s);
-      if(p == std::string::npos) break;
-      if (int(p) >= endIndex) break;
-      e = int(p);
-      if (s < e)
-      {
-        currentFont->getFontObject()->printSubString(float(x), float(y2), scales.x, scales.y,
-                                                 color.x, color.y, color.z,
-                                                 s, e,
-                                                 text);
-      }
-      s = e + 1;
-      e = endIndex;
-      if (s >= e) return;
-      y2 += currentFont->getFontObject()->getHeight();
+    vertices.clear();
+    font->buildVertices(vertices, float(x), float(y), scales.x, scales.y,
+                        color.x, color.y, color.z,
+                        startIndex, endIndex,
+                        text);
+    verticesPosition.set(x, y);
+    verticesStart = startIndex;
+    verticesEnd   = endIndex;
+    verticesFont  = font;
+    verticesValid = true;
   }
-  currentFont->getFontObject()->printSubString(float(x), float(y2), scales.x, scales.y,
-                                               color.x, color.y, color.z,
-                                               s, e,
-                                               text);
+  font->queue(vertices);
 }
 
 void  GUIText::printCenteredX (int x, int y, int startIndex, int endIndex)
@@ -217,6 +220,7 @@ void GUIText::setColor(float r, float g, float b)
   color.set(clamp(r, 0.0f, 255.0f),
             clamp(g, 0.0f, 255.0f),
             clamp(b, 0.0f, 255.0f));
+  invalidateVertices();
 
   color.x /= (color.x > 1.0) ? 255.0f : 1.0f;
   color.y /= (color.y > 1.0) ? 255.0f : 1.0f;
@@ -226,10 +230,12 @@ void GUIText::setColor(float r, float g, float b)
 void   GUIText::setHeightScale(float hs)
 {
   scales.y = clamp(hs, 0.1f, 20.0f);
+  invalidateVertices();
 }
 void   GUIText::setWidthScale(float ws)
 {
   scales.x = clamp(ws, 0.1f, 20.0f);
+  invalidateVertices();
 }
 void   GUIText::setScales(Tuple2f scales)
 {
@@ -10,6 +10,7 @@ GUITextBox::GUITextBox(const std::string &callback, const std::string &text) : G
   label.setString(text);
 
   blinkerPosition = 2;
+  recordedBlinker = 0;
   blinkerTimer    = 0.0f;
   blinkerOn       = false;
 
@@ -21,7 +22,7 @@ GUITextBox::GUITextBox(const std::string &callback, const std::string &text) : G
   widgetType      = WT_TEXT_BOX;
 }
 
-bool GUITextBox::loadXMLSettings(const TiXmlElement* element)
+bool GUITextBox::loadXMLSettings(const CompiledXMLElement* element)
 {
   if(!XMLArbiter::inspectElementInfo(element, "TextBox"))
     return Logger::writeErrorLog("Need a TextBox node in the xml file");
@@ -49,6 +50,7 @@ void  GUITextBox::setBordersColor(float r, float g, float b)
   bordersColor.x /= (bordersColor.x > 1.0) ? 255.0f : 1.0f;
   bordersColor.y /= (bordersColor.y > 1.0) ? 255.0f : 1.0f;
   bordersColor.z /= (bordersColor.z > 1.0) ? 255.0f : 1.0f;
+  dirty           = true;
 }
 
 void  GUITextBox::setPadding(const Tuple2i& p)
@@ -60,6 +62,7 @@ void  GUITextBox::setPadding(int x, int y)
 {
   padding.set(clamp(x, 0, 25),
               clamp(y, 0, 25));
+  dirty = true;
 }
 
 const Tuple2i &GUITextBox::getPadding() const
@@ -80,37 +83,32 @@ void GUITextBox::render(float clockTick)
   blinkerTimer += clockTick;
   blinkerTimer -= blinkerTimer > 1.0f ? 1.0f : 0.0f;
 
-  glEnable(GL_BLEND);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-  glColor4fv(color);
-
-  glBegin(GL_TRIANGLE_STRIP);
-  glVertex2i(windowBounds.x, windowBounds.y);
-  glVertex2i(windowBounds.x, windowBounds.w);
-  glVertex2i(windowBounds.z + padding.x, windowBounds.y);
-  glVertex2i(windowBounds.z + padding.x, windowBounds.w);
-  glEnd();
-
-  glColor3fv(bordersColor);
-  glBegin(GL_LINE_LOOP);
-  glVertex2i(windowBounds.x, windowBounds.y);
-  glVertex2i(windowBounds.x, windowBounds.w);
-  glVertex2i(windowBounds.z + padding.x, windowBounds.w);
-  glVertex2i(windowBounds.z + padding.x, windowBounds.y);
-  glEnd();
-  glDisable(GL_BLEND);
+  size_t blinker = (blinkerOn && (blinkerTimer > 0.5f)) ? realBlinkerPosition : 0;
 
-  label.print(windowBounds.x + padding.x, windowBounds.y, int(textStartIndex), int(textEndIndex));
-
-  if(blinkerOn && (blinkerTimer > 0.5f))
+  if(rebuildGeometry(blinker != recordedBlinker))
   {
-    glColor3fv(label.getColor());
-    glBegin(GL_LINES);
-    glVertex2i((int)realBlinkerPosition, windowBounds.y + padding.y/2);
-    glVertex2i((int)realBlinkerPosition, windowBounds.w - padding.y);
-    glEnd();
-    glColor3f(1,1,1);
+    Tuple2i vertices[5];
+
+    vertices[0].set(windowBounds.x, windowBounds.y);
+    vertices[1].set(windowBounds.x, windowBounds.w);
+    vertices[2].set(windowBounds.z + padding.x, windowBounds.w);
+    vertices[3].set(windowBounds.z + padding.x, windowBounds.y);
+    vertices[4] = vertices[0];
+
+    geometry.addFan(vertices, 4, color);
+    geometry.addLines(vertices, 5, Tuple4f(bordersColor, 1.0f), true);
+
+    if(blinker)
+    {
+      vertices[0].set(int(blinker), windowBounds.y + padding.y/2);
+      vertices[1].set(int(blinker), windowBounds.w - padding.y);
+      geometry.addLines(vertices, 2, Tuple4f(label.getColor(), 1.0f));
+    }
+    recordedBlinker = blinker;
   }
+  submitGeometry();
+
+  label.print(windowBounds.x + padding.x, windowBounds.y, int(textStartIndex), int(textEndIndex));
 }
 
 void GUITextBox::checkMouseEvents(MouseEvent &newEvent, int extraInfo, bool reservedBits)
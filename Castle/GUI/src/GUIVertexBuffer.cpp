@@ -0,0 +1,120 @@
+#include "EasyGL.h"
+
+GUIVertexBuffer::GUIVertexBuffer()
+{
+  segmentIndex    = 0;
+  submissionIndex = 0;
+  segmentChanged  = false;
+  retained        = true;
+  rebuiltCount    = 0;
+  drawCallCount   = 0;
+}
+
+void GUIVertexBuffer::begin()
+{
+  segmentIndex    = 0;
+  submissionIndex = 0;
+  segmentChanged  = false;
+  rebuiltCount    = 0;
+  drawCallCount   = 0;
+}
+
+void GUIVertexBuffer::submit(const GUIGeometry &geometry)
+{
+  if(segmentIndex == segments.size())
+    segments.push_back(Segment());
+
+  vector<Submission> &submissions = segments[segmentIndex].submissions;
+  Submission          entry(&geometry, geometry.getVersion());
+
+  if(submissionIndex == submissions.size())
+  {
+    submissions.push_back(entry);
+    segmentChanged = true;
+    rebuiltCount++;
+  }
+  else if(submissions[submissionIndex] != entry)
+  {
+    submissions[submissionIndex] = entry;
+    segmentChanged = true;
+    rebuiltCount++;
+  }
+  submissionIndex++;
+
+  if(!retained)
+    drawCallCount += geometry.draw();
+}
+
+void GUIVertexBuffer::flush()
+{
+  if(segmentIndex == segments.size())
+    segments.push_back(Segment());
+
+  Segment &segment = segments[segmentIndex];
+
+  if(submissionIndex != segment.submissions.size())
+  {
+    segment.submissions.resize(submissionIndex);
+    segmentChanged = true;
+  }
+
+  if(segmentChanged && retained)
+  {
+    for(size_t t = 0; t < segment.batches.size(); t++)
+      segment.batches[t].vertices.clear();
+
+    for(size_t s = 0; s < segment.submissions.size(); s++)
+    {
+      const GUIBatches &batches = segment.submissions[s].first->getBatches();
+      for(size_t t = 0; t < batches.size(); t++)
+      {
+        vector<GUIVertex> &vertices = GUIGeometry::getBatch(segment.batches,
+                                                            batches[t].mode,
+                                                            batches[t].texture).vertices;
+        vertices.insert(vertices.end(), batches[t].vertices.begin(), batches[t].vertices.end());
+      }
+    }
+  }
+
+  if(retained)
+    drawCallCount += GUIGeometry::drawBatches(segment.batches);
+  drawCallCount += GUIFontManager::flushText();
+
+  segmentIndex++;
+  submissionIndex = 0;
+  segmentChanged  = false;
+}
+
+void GUIVertexBuffer::end()
+{
+  flush();
+  segments.resize(segmentIndex);
+}
+
+void GUIVertexBuffer::clear()
+{
+  segments.clear();
+  begin();
+}
+
+void GUIVertexBuffer::setRetained(bool retainedArg)
+{
+  if(retained != retainedArg)
+    clear();
+  retained = retainedArg;
+}
+
+bool GUIVertexBuffer::isRetained() const
+{
+  return retained;
+}
+
+int GUIVertexBuffer::getRebuiltCount() const
+{
+  return rebuiltCount;
+}
+
+int GUIVertexBuffer::getDrawCallCount() const
+{
+  return drawCallCount;
+}
@@ -1,4 +1,13 @@
 #include "GenUtils.h"
+#include <sys/stat.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
 
 /*******************************************************************************************/
 /*NamedObject                                                                              */
@@ -70,62 +79,207 @@ NamedObject::~NamedObject()
 /*                                                                                         */
 /*******************************************************************************************/
 
-std::vector<std::string> Logger::logStrings;
-std::string              Logger::logPath;
+/*
+ * Slot sequences count from the start of the slot's current lap around the
+ * ring: 0 free, 1 filled, QUEUE_SIZE drained into the next lap. That way the
+ * zero-initialized ring needs no setup.
+ */
+Logger::Slot                            Logger::slots[QUEUE_SIZE];
+std::atomic<unsigned long long>         Logger::head(0);
+std::atomic<unsigned long long>         Logger::tail(0);
+std::atomic<unsigned long long>         Logger::dropped(0);
+std::atomic<int>                        Logger::level(LL_INFO);
+std::atomic<bool>                       Logger::running(false);
+std::thread                             Logger::thread;
+std::string                             Logger::logPath;
 
 void Logger::initialize(const char* logfilename)
 {
+  static bool registered = false;
+
+  close();
+
   logPath     = !logfilename ? "Log.txt" : logfilename;
   std::ofstream logFile(logPath.c_str());
   logFile.close();
+
+  if(!registered)
+    registered = !atexit(Logger::close);
+
+  running.store(true);
+  thread = std::thread(Logger::writer);
+}
+
+void Logger::close()
+{
+  if(!running.exchange(false))
+    return;
+
+  if(thread.joinable())
+    thread.join();
 }
 
 void Logger::flush()
 {
-  if(!logPath.size() || !logStrings.size())
+  if(!running.load())
     return;
 
-  std::ofstream logFile(logPath.c_str(), std::ios::app);
+  unsigned long long queued = head.load();
 
-  for(size_t t = 0; t < logStrings.size(); t++)
-    logFile << logStrings[t];
+  while(tail.load(std::memory_order_acquire) < queued && running.load())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
 
-  logStrings.clear();
-  logFile.close();
+void Logger::setLevel(LOGLEVEL levelArg)
+{
+  level.store(int(levelArg), std::memory_order_relaxed);
+}
+
+LOGLEVEL Logger::getLevel()
+{
+  return LOGLEVEL(level.load(std::memory_order_relaxed));
+}
+
+bool Logger::isEnabled(LOGLEVEL levelArg)
+{
+  return int(levelArg) >= level.load(std::memory_order_relaxed);
+}
+
+bool Logger::push(LOGLEVEL levelArg, const std::string &message)
+{
+  //Nothing would drain the ring
+  if(!running.load(std::memory_order_relaxed))
+    return false;
+
+  unsigned long long position = head.load(std::memory_order_relaxed),
+                     lap      = 0;
+  Slot              *slot     = NULL;
+
+  for(;;)
+  {
+    slot = &slots[position % QUEUE_SIZE];
+    lap  = position - position % QUEUE_SIZE;
+
+    long long difference = (long long)(slot->sequence.load(std::memory_order_acquire) - lap);
+
+    if(!difference)
+    {
+      if(head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if(difference < 0)
+    {
+      //Ring full: info is dropped, errors wait for the writer
+      if(levelArg == LL_INFO || !running.load())
+      {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      std::this_thread::yield();
+      position = head.load(std::memory_order_relaxed);
+    }
+    else
+      position = head.load(std::memory_order_relaxed);
+  }
+
+  int length = message.size() < MESSAGE_SIZE ? int(message.size()) : int(MESSAGE_SIZE);
+
+  memcpy(slot->text, message.data(), length);
+  if(length < int(message.size()))
+    memcpy(slot->text + MESSAGE_SIZE - 3, "...", 3);
+
+  slot->level  = int(levelArg);
+  slot->length = length;
+  slot->sequence.store(lap + 1, std::memory_order_release);
+  return true;
+}
+
+void Logger::writer()
+{
+  static const char *prefixes[] = { "<+>", "<!>", "<X>" };
+
+  FILE               *logFile  = fopen(logPath.c_str(), "a");
+  unsigned long long  position = tail.load();
+  std::string         batch;
+  int                 count    = 0;
+
+  for(;;)
+  {
+    Slot               *slot = &slots[position % QUEUE_SIZE];
+    unsigned long long  lap  = position - position % QUEUE_SIZE;
+
+    if(slot->sequence.load(std::memory_order_acquire) == lap + 1)
+    {
+      batch += prefixes[slot->level];
+      batch.append(slot->text, slot->length);
+      batch += '\n';
+      slot->sequence.store(lap + QUEUE_SIZE, std::memory_order_release);
+      position++;
+
+      if(++count < WRITE_BATCH)
+        continue;
+    }
+
+    unsigned long long lost = dropped.exchange(0, std::memory_order_relaxed);
+    if(lost)
+    {
+      char notice[64];
+      sprintf(notice, "<!>Dropped %llu log messages\n", lost);
+      batch += notice;
+    }
+
+    if(batch.size())
+    {
+      if(logFile)
+      {
+        fwrite(batch.data(), 1, batch.size(), logFile);
+        fflush(logFile);
+      }
+      batch.clear();
+      tail.store(position, std::memory_order_release);
+      count = 0;
+      continue;
+    }
+
+    tail.store(position, std::memory_order_release);
+
+    if(!running.load() && position == head.load())
+      break;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  if(logFile)
+    fclose(logFile);
 }
 
 void Logger::writeImmidiateInfoLog(const std::string &info)
 {
-  if(info.size())
+  if(info.size() && isEnabled(LL_INFO))
   {
-    logStrings.push_back(std::string("<+>") + info + "\n");
+    push(LL_INFO, info);
     flush();
   }
 }
 
 void Logger::writeInfoLog(const std::string &info)
 {
-  logStrings.push_back(std::string("<+>") + info + "\n");
-  if(logStrings.size() >= 10)
-    flush();
+  if(isEnabled(LL_INFO))
+    push(LL_INFO, info);
 }
 
 bool Logger::writeErrorLog(const std::string &info)
 {
-  if(info.size())
-  {
-    logStrings.push_back(std::string("<!>") + info + "\n");
-    flush();
-  }
+  if(info.size() && isEnabled(LL_ERROR))
+    push(LL_ERROR, info);
   return false;
 }
 
 void Logger::writeFatalErrorLog(const std::string &info)
 {
-  if(info.size())
+  if(info.size() && isEnabled(LL_FATAL))
   {
-   logStrings.push_back(std::string("<X>") + info + "\n");
-
+    push(LL_FATAL, info);
     flush();
   }
   exit(1);
@@ -136,38 +290,176 @@ void Logger::writeFatalErrorLog(const std::string &info)
 /*                                                                                         */
 /*******************************************************************************************/
 
-std::vector<std::string> MediaPathManager::dataPaths;
+std::unordered_map<std::string, std::string> MediaPathManager::resolvedPaths;
+std::unordered_set<std::string>              MediaPathManager::indexedFiles;
+std::vector<std::string>                     MediaPathManager::dataPaths;
+bool                                         MediaPathManager::indexing = false;
 
 const std::string MediaPathManager::lookUpMediaPath(const std::string  &path)
 {
-  std::ifstream test;
-  std::string   pathBuffer = path;
-  size_t        count      = dataPaths.size();
+  std::unordered_map<std::string, std::string>::const_iterator cached = resolvedPaths.find(path);
 
-  test.open(path.c_str());
+  if(cached != resolvedPaths.end())
+    return cached->second;
 
-  if(test.is_open())
+  std::string pathBuffer = path;
+  size_t      count      = dataPaths.size();
+
+  if(fileExists(path))
   {
-    test.close();
+    resolvedPaths[path] = pathBuffer;
     return pathBuffer;
   }
 
+  //The index only holds plain relative names, anything else is probed
+  bool indexed = indexing &&
+                 path.size() &&
+                 path[0] != '/' && path[0] != '\\' &&
+                 path.find(':')  == std::string::npos &&
+                 path.find("..") == std::string::npos;
+
+  std::string key = path;
+  for(size_t i = 0; i < key.size(); i++)
+    if(key[i] == '\\')
+      key[i] = '/';
+
   for(size_t i = 0; i < count; i++)
   {
     pathBuffer  = dataPaths[i];
     pathBuffer += path;
 
-    test.open(pathBuffer.c_str());
-    if(test.is_open())
+    if(indexed ? indexedFiles.count(dataPaths[i] + key) != 0 : fileExists(pathBuffer))
     {
-      test.close();
-      break;
+      resolvedPaths[path] = pathBuffer;
+      return pathBuffer;
     }
   }
 
+  //A miss is not cached: the file may be written later
   return pathBuffer;
 }
 
+bool MediaPathManager::fileExists(const std::string &path)
+{
+  struct stat info;
+
+  if(stat(path.c_str(), &info))
+    return false;
+
+  return (info.st_mode & S_IFMT) == S_IFREG;
+}
+
+void MediaPathManager::indexPath(const std::string &root, const std::string &relative, int depth)
+{
+  std::string directory = root + relative;
+
+#ifdef WIN32
+  WIN32_FIND_DATAA findData;
+  HANDLE           handle = FindFirstFileA((directory + "*").c_str(), &findData);
+
+  if(handle == INVALID_HANDLE_VALUE)
+    return;
+
+  do
+  {
+    std::string name = findData.cFileName;
+    if(name == "." || name == "..")
+      continue;
+
+    if(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+    {
+      if(depth > 0)
+        indexPath(root, relative + name + "/", depth - 1);
+    }
+    else
+      indexedFiles.insert(root + relative + name);
+  }
+  while(FindNextFileA(handle, &findData));
+
+  FindClose(handle);
+#else
+  DIR *handle = opendir(directory.c_str());
+
+  if(!handle)
+    return;
+
+  struct dirent *entry;
+  while((entry = readdir(handle)) != NULL)
+  {
+    std::string name = entry->d_name;
+    if(name == "." || name == "..")
+      continue;
+
+    struct stat info;
+    if(stat((directory + name).c_str(), &info))
+      continue;
+
+    if(S_ISDIR(info.st_mode))
+    {
+      if(depth > 0)
+        indexPath(root, relative + name + "/", depth - 1);
+    }
+    else if(S_ISREG(info.st_mode))
+      indexedFiles.insert(root + relative + name);
+  }
+
+  closedir(handle);
+#endif
+}
+
+void MediaPathManager::setIndexing(bool indexingArg)
+{
+  if(indexing == indexingArg)
+    return;
+
+  indexing = indexingArg;
+  indexedFiles.clear();
+  resolvedPaths.clear();
+
+  if(indexing)
+    for(size_t i = 0; i < dataPaths.size(); i++)
+      indexPath(dataPaths[i], "", INDEX_DEPTH);
+}
+
+bool MediaPathManager::isIndexing()
+{
+  return indexing;
+}
+
+void MediaPathManager::clearCache()
+{
+  resolvedPaths.clear();
+}
+
+void MediaPathManager::registerFile(const std::string &path)
+{
+  std::string key = path;
+  for(size_t i = 0; i < key.size(); i++)
+    if(key[i] == '\\')
+      key[i] = '/';
+
+  resolvedPaths.erase(path);
+  resolvedPaths.erase(key);
+
+  for(size_t i = 0; i < dataPaths.size(); i++)
+  {
+    std::string root = dataPaths[i];
+    for(size_t j = 0; j < root.size(); j++)
+      if(root[j] == '\\')
+        root[j] = '/';
+
+    if(key.size() <= root.size() || key.compare(0, root.size(), root))
+      continue;
+
+    //An earlier lookup of the relative name may have resolved elsewhere
+    std::string relative = key.substr(root.size());
+    resolvedPaths.erase(relative);
+
+    if(indexing)
+      indexedFiles.insert(dataPaths[i] + relative);
+  }
+}
+
 bool MediaPathManager::registerPath(const TiXmlElement *mediaPathNode)
 
 {
@@ -188,8 +480,13 @@ bool MediaPathManager::registerPath(const std::string  &path)
 
   std::string stringBuffer = path;
 
-  Logger::writeInfoLog(std::string("Registering data path -> ") + path);
+  logInfo(std::string("Registering data path -> ") + path);
   dataPaths.push_back(stringBuffer);
+  resolvedPaths.clear();
+
+  if(indexing)
+    indexPath(stringBuffer, "", INDEX_DEPTH);
+
   return true;
 }
 
@@ -5,6 +5,10 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <atomic>
+#include <thread>
 #include "GLee.h"
 
 #define deleteObject(A){ if(A){ delete   A; A = NULL; } }
@@ -12,6 +16,29 @@
 
 #define MAX_TEX_UNITS 8
 
+/*
+ * Evaluates the message only when its level is enabled, so disabled
+ * logging costs no string building.
+ */
+#define logInfo(A)  do { if(Logger::isEnabled(LL_INFO))  Logger::writeInfoLog(A);  } while(0)
+#define logError(A) do { if(Logger::isEnabled(LL_ERROR)) Logger::writeErrorLog(A); } while(0)
+
+typedef enum
+{
+  LL_INFO,
+  LL_ERROR,
+  LL_FATAL,
+  LL_NONE
+} LOGLEVEL;
+
+/*
+ * Messages are copied into a fixed ring of pre-sized slots that any thread
+ * may fill without locking; a background writer started by initialize()
+ * drains it to the log file in batches. Info messages are dropped when the
+ * ring is full, errors wait for room. flush() waits for everything queued
+ * so far to reach the file. Until initialize() and after close() logging is
+ * off and messages are discarded without touching the ring.
+ */
 class Logger
 {
   public:
@@ -21,10 +48,39 @@ class Logger
     static void writeInfoLog(const std::string &info);
     static void initialize(const char* logfilename = NULL);
     static void flush();
+    static void close();
+
+    static void     setLevel(LOGLEVEL level);
+    static LOGLEVEL getLevel();
+    static bool     isEnabled(LOGLEVEL level);
 
   private:
-    static vector<std::string> logStrings;
-    static std::string         logPath;
+    enum
+    {
+      QUEUE_SIZE   = 1024,
+      MESSAGE_SIZE = 256,
+      WRITE_BATCH  = 64
+    };
+
+    struct Slot
+    {
+      std::atomic<unsigned long long> sequence;
+      int                             level;
+      int                             length;
+      char                            text[MESSAGE_SIZE];
+    };
+
+    static bool push(LOGLEVEL level, const std::string &message);
+    static void writer();
+
+    static Slot                            slots[QUEUE_SIZE];
+    static std::atomic<unsigned long long> head;
+    static std::atomic<unsigned long long> tail;
+    static std::atomic<unsigned long long> dropped;
+    static std::atomic<int>                level;
+    static std::atomic<bool>               running;
+    static std::thread                     thread;
+    static std::string                     logPath;
 };
 
 class NamedObject
@@ -79,8 +135,29 @@ class MediaPathManager
     static int   getPathCount();
     static void  printAllPaths();
 
+    /*
+     * Lookups that found a file are cached until the next registerPath or
+     * clearCache; misses are probed again each time. With indexing on,
+     * registered data paths are listed once and lookups under them are
+     * answered from the index instead of probing the disk. Files written
+     * after that are passed to registerFile, which indexes them and drops
+     * the cached lookups they supersede.
+     */
+    static void  setIndexing(bool indexing);
+    static bool  isIndexing();
+    static void  clearCache();
+    static void  registerFile(const std::string &path);
+
   private:
-    static std::vector<std::string> dataPaths;
+    enum { INDEX_DEPTH = 8 };
+
+    static void  indexPath(const std::string &root, const std::string &relative, int depth);
+    static bool  fileExists(const std::string &path);
+
+    static std::unordered_map<std::string, std::string> resolvedPaths;
+    static std::unordered_set<std::string>              indexedFiles;
+    static std::vector<std::string>                     dataPaths;
+    static bool                                         indexing;
 };
 
 template <class ODT>
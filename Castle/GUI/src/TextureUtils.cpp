@@ -114,15 +114,11 @@ void Texture::setID(GLuint texID)
               *oldTextureInfo = TexturesManager::getTextureInfo(id);
 
   if(newTextureInfo)
-    newTextureInfo->increaseUserCount();
+    TexturesManager::retainTexture(newTextureInfo);
   else
-  {
-    newTextureInfo = new TextureInfo(std::string("Unknown texture"), texID);
     unknown++;
-  }
 
-  if(oldTextureInfo)
-    oldTextureInfo->decreaseUserCount();
+  TexturesManager::releaseTexture(oldTextureInfo);
 
   id = texID;
 
@@ -155,6 +151,7 @@ bool Texture::loadXMLSettings(const TiXmlElement *element)
                magFilter = GL_LINEAR,
                minFilter = GL_LINEAR;
   bool         mipmap    = false,
+               async     = false,
                result    = false;
 
   const char *description = element->Attribute("description");
@@ -162,6 +159,7 @@ bool Texture::loadXMLSettings(const TiXmlElement *element)
     return  IOXMLObject::loadXMLSettings(description);
 
   mipmap = XMLArbiter::analyzeBooleanAttr(element, "mipmap", true);
+  async  = XMLArbiter::analyzeBooleanAttr(element, "async",  false);
   target = getTypei(element->Attribute("type"));
   path   = element->Attribute("path");
 
@@ -198,7 +196,8 @@ bool Texture::loadXMLSettings(const TiXmlElement *element)
     }
   }
 
-  result = (target == GL_TEXTURE_2D      ) ? load2D  (path.c_str(), clampS, clampT, magFilter, minFilter, mipmap) :
+  result = (target == GL_TEXTURE_2D      ) ? async ? load2DAsync(path.c_str(), clampS, clampT, magFilter, minFilter, mipmap) :
+                                                     load2D     (path.c_str(), clampS, clampT, magFilter, minFilter, mipmap) :
            (target == GL_TEXTURE_CUBE_MAP) ? loadCube(path.c_str(), clampS, clampT, magFilter, minFilter, mipmap) :
            Logger::writeErrorLog("Unsupported texture type");
   return result;
@@ -304,12 +303,10 @@ void Texture::destroy()
   TextureInfo *textureInfo = TexturesManager::getTextureInfo(id);
 
   if(textureInfo)
-    textureInfo->decreaseUserCount();
+    TexturesManager::releaseTexture(textureInfo);
   else
     glDeleteTextures(1, &id);
 
-  TexturesManager::flushUnusedTextures();
-
   height         = 0;
   width          = 0;
   depth          = 0;
@@ -342,6 +339,81 @@ bool Texture::load2D(const char* filename,
   return load2DImage(image, clampS, clampT, magFilter, minFilter, mipmap);
 }
 
+bool Texture::load2DAsync(const char* filename,
+                          GLuint clampS   , GLuint clampT,
+                          GLuint magFilter, GLuint minFilter,
+                          bool  mipmap)
+{
+  if(!strstr(filename, "png") && !strstr(filename, "PNG"))
+    return load2D(filename, clampS, clampT, magFilter, minFilter, mipmap);
+
+  std::string texturePath = MediaPathManager::lookUpMediaPath(filename);
+
+  if(!texturePath.size())
+    return Logger::writeErrorLog(std::string("Couldn't locate the Texture file at <") + filename + "> even with a look up");
+
+  if(checkForRepeat(texturePath.c_str()))
+    return true;
+
+  TextureStream *textureStream = new TextureStream(texturePath.c_str());
+
+  // 16 bit and interlaced PNGs, among others, are decoded in one go.
+  if(!textureStream->stream)
+  {
+    deleteObject(textureStream);
+    return load2D(filename, clampS, clampT, magFilter, minFilter, mipmap);
+  }
+
+  const pngRawInfo &info = textureStream->info;
+  GLuint format          = info.Components == 4 ? GL_RGBA            :
+                           info.Components == 3 ? GL_RGB             :
+                           info.Components == 2 ? GL_LUMINANCE_ALPHA : GL_LUMINANCE;
+  GLuint internalFormat  = info.Components == 4 ? GL_RGBA8            :
+                           info.Components == 3 ? GL_RGB8             :
+                           info.Components == 2 ? GL_LUMINANCE8_ALPHA8 : GL_LUMINANCE8;
+
+  destroy();
+  target = GL_TEXTURE_2D;
+
+  // Until the last row is in, the texture's levels are not sampled.
+  glGenTextures(1, &id);
+  glBindTexture(GL_TEXTURE_2D, id);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, getValidMagFilter(magFilter));
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, getValidMagFilter(minFilter));
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     getValidWrapMode(clampS));
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     getValidWrapMode(clampT));
+  glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, info.Width, info.Height, 0,
+               format, GL_UNSIGNED_BYTE, NULL);
+
+  for(GLuint level = 1, w = info.Width, h = info.Height; mipmap && (w > 1 || h > 1); level++)
+  {
+    w = w > 1 ? w/2 : 1;
+    h = h > 1 ? h/2 : 1;
+    glTexImage2D(GL_TEXTURE_2D, level, internalFormat, w, h, 0, format,
+                 GL_UNSIGNED_BYTE, NULL);
+  }
+
+  height = info.Height;
+  width  = info.Width;
+  depth  = 1;
+
+  textureStream->id             = id;
+  textureStream->format         = format;
+  textureStream->internalFormat = internalFormat;
+  textureStream->minFilter      = getValidMinFilter(minFilter);
+  textureStream->mipmap         = mipmap;
+
+  if(!finalizeLoading(texturePath.c_str()))
+  {
+    deleteObject(textureStream);
+    return false;
+  }
+
+  TexturesManager::addTextureStream(textureStream);
+  logInfo(std::string("Streaming Texture2D file at -> ") + texturePath);
+  return true;
+}
+
 bool Texture::load2DImage(const Image& image,
                           GLuint clampS   , GLuint clampT,
                           GLuint magFilter, GLuint minFilter,
@@ -374,7 +446,7 @@ bool Texture::load2DImage(const Image& image,
 
   if(finalizeLoading(path))
   {
-    Logger::writeInfoLog(std::string("Loaded Texture2D file at -> ") + path);
+    logInfo(std::string("Loaded Texture2D file at -> ") + path);
     return true;
   }
   return false;
@@ -460,7 +532,7 @@ bool Texture::loadCube(const char* pathPXdotExtension,
     }
   }
 
-  Logger::writeInfoLog(std::string("Loaded TextureCubeMap at ->") + initialPath);
+  logInfo(std::string("Loaded TextureCubeMap at ->") + initialPath);
   return  finalizeLoading(initialPath.c_str());
 }
 
@@ -479,7 +551,7 @@ bool Texture::create2DShell(const char* name,
   destroy();
   target = GL_TEXTURE_2D;
 
-  Logger::writeInfoLog(std::string("Loading new 2D Shell") + name);
+  logInfo(std::string("Loading new 2D Shell") + name);
 
   glGenTextures(1, &id);
   glBindTexture(GL_TEXTURE_2D, id);
@@ -508,7 +580,7 @@ bool Texture::createNoise3D(const char* name, GLuint size)
   destroy();
   target = GL_TEXTURE_3D;
 
-  Logger::writeInfoLog(std::string("Creating new Noise3D Texture: ") + name);
+  logInfo(std::string("Creating new Noise3D Texture: ") + name);
 
 
   GLubyte *noise3DBuffer = new GLubyte[size * size * size * 4],
@@ -574,7 +646,7 @@ bool Texture::createRectShell(const char* name,
   destroy();
   target = GL_TEXTURE_RECTANGLE_ARB;
 
-  Logger::writeInfoLog(std::string("Loading new Rectangle Shell: ") + name);
+  logInfo(std::string("Loading new Rectangle Shell: ") + name);
 
   glGenTextures(1, &id);
   glBindTexture(GL_TEXTURE_RECTANGLE_ARB, id);
@@ -604,7 +676,7 @@ bool Texture::create1DShell(const char* name,
   target = GL_TEXTURE_1D;
 
 
-  Logger::writeInfoLog(std::string("Loading new 1D Shell: ") + name);
+  logInfo(std::string("Loading new 1D Shell: ") + name);
 
   glGenTextures(1, &id);
   glBindTexture(target, id);
@@ -634,7 +706,7 @@ bool Texture::create3DShell(const char* name,
   target = GL_TEXTURE_3D;
 
 
-  Logger::writeInfoLog(std::string("Loading new 3D Shell: ") + name);
+  logInfo(std::string("Loading new 3D Shell: ") + name);
 
   glGenTextures(1, &id);
   glBindTexture(target, id);
@@ -676,7 +748,7 @@ bool Texture::createCubeShell(const char* name,
   glTexParameteri(GL_TEXTURE_CUBE_MAP_ARB, GL_TEXTURE_WRAP_S,     getValidWrapMode(clampS));
   glTexParameteri(GL_TEXTURE_CUBE_MAP_ARB, GL_TEXTURE_WRAP_T,     getValidWrapMode(clampT));
 
-  Logger::writeInfoLog(std::string("Loading Cube Shell: ") + name);
+  logInfo(std::string("Loading Cube Shell: ") + name);
 
   for(int i = 0; i < 6; i++)
    glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X_ARB + i,
@@ -712,7 +784,7 @@ bool Texture::createNormalizingCube(const char* name,
 
   int levels = buildMipmaps ? int(log(double(size))/log(2.0)) : 1;
   target = GL_TEXTURE_CUBE_MAP;
-  Logger::writeInfoLog(std::string("Creating Normalization Texture Cube Map: ") + name);
+  logInfo(std::string("Creating Normalization Texture Cube Map: ") + name);
 
   GLuint minFilter = buildMipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
 
@@ -1006,35 +1078,301 @@ bool Texture::loadTextureFace(const  Image &image,
   return true;
 }
 
+/*******************************************************************************************/
+/*TextureStream                                                                            */
+/*Info: a PNG decoded by a worker thread into the buffer allocated when its header was     */
+/*      read, and uploaded to its texture on the GL thread as its rows are finished.       */
+/*******************************************************************************************/
+
+TextureStream::TextureStream(const char* path_) : rows(0), status(1), cancelled(false)
+{
+  path           = path_;
+  id             = 0;
+  format         = 0;
+  internalFormat = 0;
+  minFilter      = 0;
+  mipmap         = false;
+  bottomUp       = false;
+  complete       = false;
+  uploaded       = 0;
+  level          = 1;
+  levelOffset    = 0;
+  levelRows      = 0;
+  memset(&info, 0, sizeof(pngRawInfo));
+
+  stream = pngStreamOpen(path_, &info);
+  if(stream)
+  {
+    unsigned int first = 0;
+    rows     = pngStreamGetRows(stream, &first);
+    bottomUp = (first != 0);
+  }
+}
+
+void TextureStream::start()
+{
+  worker = std::async(std::launch::async, TextureStream::decode, this);
+}
+
+void TextureStream::decode(TextureStream *textureStream)
+{
+  int result = 1;
+
+  while(result > 0 && !textureStream->cancelled)
+  {
+    result = pngStreamRead(textureStream->stream, READ_SIZE);
+    textureStream->rows.store(pngStreamGetRows(textureStream->stream, NULL), std::memory_order_release);
+  }
+
+  if(!result && textureStream->mipmap && !textureStream->cancelled)
+    textureStream->buildMipmaps();
+
+  textureStream->status = textureStream->cancelled ? -1 : result;
+}
+
+// Each level averages 2x2 blocks of the one above, clamped at odd edges.
+void TextureStream::buildMipmaps()
+{
+  unsigned int components = info.Components,
+               width      = info.Width,
+               height     = info.Height,
+               size       = 0;
+
+  for(unsigned int w = width, h = height; w > 1 || h > 1; )
+  {
+    w     = w > 1 ? w/2 : 1;
+    h     = h > 1 ? h/2 : 1;
+    size += w*h*components;
+  }
+  mipmaps.resize(size);
+
+  const unsigned char *source = info.Data;
+  unsigned char       *target = mipmaps.size() ? &mipmaps[0] : NULL;
+
+  while(width > 1 || height > 1)
+  {
+    unsigned int w = width  > 1 ? width/2  : 1,
+                 h = height > 1 ? height/2 : 1;
+
+    for(unsigned int y = 0; y < h; y++)
+    {
+      const unsigned char *row0 = source + (2*y)*width*components,
+                          *row1 = (2*y + 1 < height) ? row0 + width*components : row0;
+      unsigned char       *out  = target + y*w*components;
+
+      for(unsigned int x = 0; x < w; x++)
+      {
+        unsigned int x0 = 2*x*components,
+                     x1 = (2*x + 1 < width) ? x0 + components : x0;
+
+        for(unsigned int c = 0; c < components; c++)
+          *out++ = (unsigned char)((row0[x0 + c] + row0[x1 + c] +
+                                    row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+      }
+    }
+    source  = target;
+    target += w*h*components;
+    width   = w;
+    height  = h;
+  }
+}
+
+unsigned int TextureStream::upload(unsigned int maxBytes)
+{
+  unsigned int rowBytes = info.Width*info.Components,
+               count    = rows.load(std::memory_order_acquire) - uploaded,
+               bytes    = 0;
+
+  if(maxBytes && count*rowBytes > maxBytes)
+    count = maxBytes/rowBytes ? maxBytes/rowBytes : 1;
+
+  bool levels = (uploaded + count == info.Height) && mipmap && !status;
+
+  if(!count && !levels)
+    return 0;
+
+  glBindTexture(GL_TEXTURE_2D, id);
+
+  if(count)
+  {
+    unsigned int y = bottomUp ? info.Height - uploaded - count : uploaded;
+
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, info.Width, count, format,
+                    GL_UNSIGNED_BYTE, info.Data + y*rowBytes);
+    uploaded += count;
+    bytes    += count*rowBytes;
+  }
+
+  while(levels && levelOffset < mipmaps.size() && (!maxBytes || bytes < maxBytes))
+  {
+    unsigned int w             = info.Width  >> level ? info.Width  >> level : 1,
+                 h             = info.Height >> level ? info.Height >> level : 1,
+                 levelRowBytes = w*info.Components,
+                 levelCount    = h - levelRows;
+
+    if(maxBytes && levelCount*levelRowBytes > maxBytes - bytes)
+      levelCount = (maxBytes - bytes)/levelRowBytes ? (maxBytes - bytes)/levelRowBytes : 1;
+
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, levelRows, w, levelCount, format,
+                    GL_UNSIGNED_BYTE, &mipmaps[levelOffset + levelRows*levelRowBytes]);
+    levelRows += levelCount;
+    bytes     += levelCount*levelRowBytes;
+
+    if(levelRows == h)
+    {
+      levelOffset += h*levelRowBytes;
+      levelRows    = 0;
+      level++;
+    }
+  }
+
+  if(uploaded == info.Height && (!mipmap || (levels && levelOffset == mipmaps.size())))
+  {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+    complete = true;
+  }
+  return bytes;
+}
+
+bool TextureStream::isDone() const
+{
+  return complete || status < 0;
+}
+
+TextureStream::~TextureStream()
+{
+  cancelled = true;
+  if(worker.valid())
+    worker.wait();
+
+  pngStreamClose(stream);
+  if(info.Data)
+    free(info.Data);
+}
+
 /*******************************************************************************************/
 /*TexturesManager                                                                          */
 /*Info:                                                                                    */
 /*                                                                                         */
 /*******************************************************************************************/
 
-vector<TextureInfo*> TexturesManager::textureCollection;
+std::unordered_map<GLuint, TextureInfo*>      TexturesManager::textureCollection;
+std::unordered_map<std::string, TextureInfo*> TexturesManager::texturePaths;
+vector<GLuint>                                TexturesManager::unusedTextures;
+vector<TextureStream*>                        TexturesManager::textureStreams;
 
-bool TexturesManager::addTextureInfo(TextureInfo *textureInfo)
+void TexturesManager::addTextureStream(TextureStream *textureStream)
+{
+  if(!textureStream)
+    return;
+
+  textureStreams.push_back(textureStream);
+  textureStream->start();
+}
+
+void TexturesManager::uploadTextureStreams(unsigned int maxBytes)
 {
-  flushUnusedTextures();
+  if(!textureStreams.size())
+    return;
+
+  // Not GL_TEXTURE_BIT: popping it would restore the filters of a texture
+  // bound when it was pushed, the last one streamed included.
+  GLint binding = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &binding);
+  glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+  for(size_t i = 0; i < textureStreams.size(); i++)
+  {
+    TextureStream *textureStream = textureStreams[i];
 
+    // The texture was flushed before it finished loading.
+    if(!getTextureInfo(textureStream->id))
+      continue;
+
+    // Each call uploads a row at least, however small the budget.
+    unsigned int bytes = textureStream->upload(maxBytes);
+
+    if(maxBytes)
+    {
+      if(bytes >= maxBytes)
+        break;
+      maxBytes -= bytes;
+    }
+  }
+
+  glPopClientAttrib();
+  glBindTexture(GL_TEXTURE_2D, binding);
+
+  flushTextureStreams(false);
+}
+
+size_t TexturesManager::getTextureStreamCount()
+{
+  return textureStreams.size();
+}
+
+void TexturesManager::flushTextureStreams(bool all)
+{
+  size_t count = 0;
+
+  for(size_t i = 0; i < textureStreams.size(); i++)
+  {
+    TextureStream *textureStream = textureStreams[i];
+
+    if(all || textureStream->isDone() || !getTextureInfo(textureStream->id))
+    {
+      if(textureStream->status < 0 && !all)
+        Logger::writeErrorLog(std::string("Failed to decode streamed Texture2D file at -> ") +
+                              textureStream->path);
+      deleteObject(textureStream);
+    }
+    else
+      textureStreams[count++] = textureStream;
+  }
+  textureStreams.resize(count);
+}
+
+std::string TexturesManager::normalizePath(const char *texturePath)
+{
+  std::string path;
+  path.reserve(strlen(texturePath));
+
+  for(const char *c = texturePath; *c; c++)
+  {
+    char ch = (*c == '\\') ? '/' : *c;
+#ifdef WIN32
+    ch = (char)tolower(ch);
+#endif
+    if(ch == '/' && path.size() && path[path.size() - 1] == '/')
+      continue;
+    path += ch;
+  }
+
+  while(path.size() > 2 && path[0] == '.' && path[1] == '/')
+    path.erase(0, 2);
+
+  return path;
+}
+
+bool TexturesManager::addTextureInfo(TextureInfo *textureInfo)
+{
   if(!textureInfo)
     return false;
-  textureCollection.push_back(textureInfo);
+
+  textureCollection[textureInfo->getMedia()]                   = textureInfo;
+  texturePaths[normalizePath(textureInfo->getMediaPath().c_str())] = textureInfo;
   return true;
 }
 
 TextureInfo *TexturesManager::getTextureInfo(const char* texturePath)
 {
-  flushUnusedTextures();
-  if(!texturePath || !textureCollection.size())
+  if(!texturePath || !texturePaths.size())
     return NULL;
 
-  for(size_t i = 0; i < textureCollection.size(); i++)
-    if(textureCollection[i]->getMediaPath() == texturePath)
-      return textureCollection[i];
-
-  return NULL;
+  std::unordered_map<std::string, TextureInfo*>::iterator it = texturePaths.find(normalizePath(texturePath));
+  return it == texturePaths.end() ? NULL : it->second;
 }
 
 TextureInfo *TexturesManager::getTextureInfo(GLuint textureID)
@@ -1042,55 +1380,78 @@ TextureInfo *TexturesManager::getTextureInfo(GLuint textureID)
   if(!textureID || !textureCollection.size())
     return NULL;
 
-  for(size_t i = 0; i < textureCollection.size(); i++)
-    if(textureCollection[i]->getMedia() == textureID)
-      return textureCollection[i];
+  std::unordered_map<GLuint, TextureInfo*>::iterator it = textureCollection.find(textureID);
+  return it == textureCollection.end() ? NULL : it->second;
+}
 
-  return NULL;
+void TexturesManager::retainTexture(TextureInfo *textureInfo)
+{
+  if(textureInfo)
+    textureInfo->increaseUserCount();
+}
+
+void TexturesManager::releaseTexture(TextureInfo *textureInfo)
+{
+  if(!textureInfo || !textureInfo->getUserCount())
+    return;
+
+  textureInfo->decreaseUserCount();
+  if(textureInfo->getUserCount())
+    return;
+
+  unusedTextures.push_back(textureInfo->getMedia());
+  if(unusedTextures.size() >= FLUSH_INTERVAL)
+    flushUnusedTextures();
 }
 
 void TexturesManager::flushUnusedTextures()
 {
-  vector<TextureInfo*> validTextures;
-  size_t i         = 0,
-         count     = 0;
-  GLuint textureID = 0;
+  size_t count = 0;
 
-  for(i = 0; i < textureCollection.size(); i++)
-    if(textureCollection[i]->getUserCount() > 0)
-    {
-      validTextures.push_back(textureCollection[i]);
-    }
-    else
-    {
-      count++;
-      textureID = textureCollection[i]->getMedia();
-      glDeleteTextures(1, &textureID);
-      deleteObject(textureCollection[i]);
-    }
+  for(size_t i = 0; i < unusedTextures.size(); i++)
+  {
+    std::unordered_map<GLuint, TextureInfo*>::iterator it = textureCollection.find(unusedTextures[i]);
+    if(it == textureCollection.end() || it->second->getUserCount() > 0)
+      continue;
 
-  textureCollection.clear();
+    TextureInfo *textureInfo = it->second;
+    GLuint       textureID   = textureInfo->getMedia();
+    std::string  path        = normalizePath(textureInfo->getMediaPath().c_str());
 
-  for(i = 0; i < validTextures.size(); i++)
-      textureCollection.push_back(validTextures[i]);
+    std::unordered_map<std::string, TextureInfo*>::iterator pathIt = texturePaths.find(path);
+    if(pathIt != texturePaths.end() && pathIt->second == textureInfo)
+      texturePaths.erase(pathIt);
+    textureCollection.erase(it);
+
+    glDeleteTextures(1, &textureID);
+    deleteObject(textureInfo);
+    count++;
+  }
+  unusedTextures.clear();
+  flushTextureStreams(false);
 
   if(count)
-    Logger::writeInfoLog(std::string("Flushed texture."));
+    logInfo(std::string("Flushed texture."));
 }
 
 void TexturesManager::flushAllTextures(){
   GLuint textureID = 0;
+  size_t count     = textureCollection.size();
+
+  flushTextureStreams(true);
 
-	size_t i = 0;
-  for(i = 0; i < textureCollection.size(); i++)
+  for(std::unordered_map<GLuint, TextureInfo*>::iterator it = textureCollection.begin();
+      it != textureCollection.end(); it++)
   {
-    textureID = textureCollection[i]->getMedia();
+    textureID = it->first;
     glDeleteTextures(1, &textureID);
-    deleteObject(textureCollection[i]);
+    deleteObject(it->second);
   }
 
   textureCollection.clear();
-  if(i) Logger::writeInfoLog("Flushed all active textures");
+  texturePaths.clear();
+  unusedTextures.clear();
+  if(count) logInfo("Flushed all active textures");
 }
 
 void TexturesManager::printTexturesInfo()
@@ -1099,10 +1460,11 @@ void TexturesManager::printTexturesInfo()
     cout << "This Manager contains no Textures as of yet." << endl;
   else{
     cout << "Textures list: " << endl;
-    for(size_t i = 0; i < textureCollection.size(); i++)
-      cout <<  "<users = \"" << textureCollection[i]->getUserCount() << "\" "
-           <<  " path  = \"" << textureCollection[i]->getMediaPath() << "\" "
-           <<  " id    = \"" << textureCollection[i]->getMedia()     << "\" />" << endl;
+    for(std::unordered_map<GLuint, TextureInfo*>::iterator it = textureCollection.begin();
+        it != textureCollection.end(); it++)
+      cout <<  "<users = \"" << it->second->getUserCount() << "\" "
+           <<  " path  = \"" << it->second->getMediaPath() << "\" "
+           <<  " id    = \"" << it->second->getMedia()     << "\" />" << endl;
   }
 }
 
@@ -1213,6 +1575,28 @@ bool Image::load(const char* path_)
   if(!verifiedPath.size())
     return false;
 
+  return decode(path_, verifiedPath);
+}
+
+std::future<Image*> Image::loadAsync(const char* path_)
+{
+  std::string verifiedPath = MediaPathManager::lookUpMediaPath(path_);
+
+  return std::async(std::launch::async, Image::decodeAsync, std::string(path_), verifiedPath);
+}
+
+Image *Image::decodeAsync(std::string name, std::string verifiedPath)
+{
+  Image *image = new Image();
+
+  if(!verifiedPath.size() || !image->decode(name.c_str(), verifiedPath))
+    deleteObject(image);
+
+  return image;
+}
+
+bool Image::decode(const char* path_, const std::string &verifiedPath)
+{
   const char* cPath = verifiedPath.c_str();
   path              = verifiedPath;
 
@@ -1261,17 +1645,10 @@ Image::~Image()
 #define min(a, b) (((a)<(b))?(a):(b))
 #endif
 
-unsigned char getByte();
-char fileOpen(const char *);
-
-void decodeQTable(int);
-void strmSkip(int n);
-void decodeBlock();
-void fileClose();
-void getInfo();
-void fidct();
-
-int  wordDec(int);
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JPG_SSE2
+#endif
 
 typedef unsigned short qTable[64];
 
@@ -1283,8 +1660,6 @@ typedef struct
   } TSmall[512], TLarge[65536];
 } HuffTable;
 
-void decodeHuffTable(int);
-
 typedef struct
 {
   HuffTable *huffAC, *huffDC;
@@ -1293,20 +1668,7 @@ typedef struct
   float t[256];
 }ComponentTable;
 
-ComponentTable component[4];
-HuffTable      huffTableAC[4],
-               huffTableDC[4];
-qTable         qtable[4];
-
-unsigned int xblock, yblock, blockx, blocky,
-             bsize, restartInt, bfree,
-             dt;
-unsigned char *data, *bpos  , *dend,
-              eof  , ssStart, ssEnd,
-              sbits, prec   , ncomp;
-float dctt[64];
-
-int zigzag[64]=
+static const int zigzag[64]=
 {
    0,	1,	8,	16,	9,	2,	3,	10,
   17,	24,	32,	25,	18,	11,	4,	5,
@@ -1318,8 +1680,61 @@ int zigzag[64]=
   53,	60,	61,	54,	47,	55,	62,	63
 };
 
+/*
+ * Decoder state is held per decode rather than in globals, so several
+ * images can be decoded at once on different threads.
+ */
+class JPGDecoder
+{
+  public:
+    ComponentTable component[4];
+    HuffTable      huffTableAC[4],
+                   huffTableDC[4];
+    qTable         qtable[4];
+
+    unsigned int xblock, yblock, blockx, blocky,
+                 bsize, restartInt, bfree,
+                 dt;
+    unsigned char *data, *bpos  , *dend,
+                  eof  , ssStart, ssEnd,
+                  sbits, prec   , ncomp;
+    float dctt[64];
+
+    unsigned char  *pixels;
+    unsigned int    components;
+    unsigned short  height,
+                    width;
+
+    JPGDecoder();
+   ~JPGDecoder();
+
+    char fileOpen(const char *filename);
+    void fileClose();
+    unsigned char getByte();
+    void strmSkip(int n);
+    int  huffDec(HuffTable *h);
+    int  wordDec(int n);
+    void getInfo();
+    void decodeHuffTable(int len);
+    void decodeQTable(int len);
+    void decodeBlock();
+    void fidct();
+    int  decodeScan();
+    int  decode();
+};
 
-char fileOpen(const char *filename)
+JPGDecoder::JPGDecoder()
+{
+  memset(this, 0, sizeof(JPGDecoder));
+}
+
+JPGDecoder::~JPGDecoder()
+{
+  fileClose();
+  deleteArray(pixels);
+}
+
+char JPGDecoder::fileOpen(const char *filename)
 {
   FILE *stream;
   data = NULL;
@@ -1339,13 +1754,12 @@ char fileOpen(const char *filename)
   }
 }
 
-void fileClose(void)
+void JPGDecoder::fileClose(void)
 {
-  if(data)
-    delete[] data;
+  deleteArray(data);
 }
 
-unsigned char getByte(void)
+unsigned char JPGDecoder::getByte(void)
 {
   if(bpos>=dend){
     eof = 1;
@@ -1355,7 +1769,7 @@ unsigned char getByte(void)
     return *bpos++;
 }
 
-void strmSkip(int n)
+void JPGDecoder::strmSkip(int n)
 {
   unsigned char a, b;
   bfree+=n;
@@ -1368,9 +1782,10 @@ void strmSkip(int n)
       a=getByte();
     dt|=(b<<bfree);
   }
+  (void)a;
 }
 
-int huffDec(HuffTable *h)
+int JPGDecoder::huffDec(HuffTable *h)
 {
   unsigned int id, n, c;
 
@@ -1388,7 +1803,7 @@ int huffDec(HuffTable *h)
   return c;
 }
 
-int wordDec(int n)
+int JPGDecoder::wordDec(int n)
 {
   int w;
   unsigned int s;
@@ -1405,7 +1820,7 @@ int wordDec(int n)
   return w;
 }
 
-void Image::getJPGInfo()
+void JPGDecoder::getInfo()
 {
   unsigned char cn, sf, qt;
   int i;
@@ -1454,7 +1869,7 @@ void Image::getJPGInfo()
     yblock++;
 }
 
-void decodeHuffTable(int len)
+void JPGDecoder::decodeHuffTable(int len)
 {
   int length[257], i, j, n, code, codelen, delta, rcode, cd, rng;
   unsigned char lengths[16], b, symbol[257];
@@ -1533,8 +1948,109 @@ void decodeHuffTable(int len)
   }
 }
 
-void fidct(void)
+#ifdef JPG_SSE2
+
+/*
+ * One dimensional pass of fidct over four lanes at once, x[k] holding the
+ * k-th coefficient of each lane.
+ */
+static inline void idctPassSSE2(__m128 x[8])
+{
+  const __m128 a  = _mm_set1_ps(0.353553385f),
+               b  = _mm_set1_ps(0.490392625f),
+               c  = _mm_set1_ps(0.415734798f),
+               d  = _mm_set1_ps(0.277785122f),
+               e  = _mm_set1_ps(0.097545162f),
+               f  = _mm_set1_ps(0.461939752f),
+               g  = _mm_set1_ps(0.191341713f),
+               cd = _mm_set1_ps(0.6935199499f),
+               be = _mm_set1_ps(0.5879377723f),
+               bc = _mm_set1_ps(0.9061274529f),
+               de = _mm_set1_ps(0.3753302693f);
+
+  __m128 a0 = _mm_mul_ps(a, x[0]),
+         f2 = _mm_mul_ps(f, x[2]),
+         g2 = _mm_mul_ps(g, x[2]),
+         a4 = _mm_mul_ps(a, x[4]),
+         g6 = _mm_mul_ps(g, x[6]),
+         f6 = _mm_mul_ps(f, x[6]),
+         m0 = _mm_add_ps(a0, a4),
+         m1 = _mm_sub_ps(a0, a4),
+         m2 = _mm_add_ps(f2, g6),
+         m3 = _mm_sub_ps(g2, f6),
+         s0 = _mm_add_ps(m0, m2),
+         s1 = _mm_add_ps(m1, m3),
+         s2 = _mm_sub_ps(m1, m3),
+         s3 = _mm_sub_ps(m0, m2),
+         h2 = _mm_add_ps(x[7], x[1]),
+         h3 = _mm_sub_ps(x[7], x[1]),
+         r2 = _mm_add_ps(x[3], x[5]),
+         r3 = _mm_sub_ps(x[3], x[5]),
+         h0 = _mm_mul_ps(cd, x[1]),
+         h1 = _mm_mul_ps(be, x[1]),
+         r0 = _mm_mul_ps(be, x[5]),
+         r1 = _mm_mul_ps(cd, x[3]),
+         w  = _mm_mul_ps(de, r3),
+         t0 = _mm_sub_ps(_mm_add_ps(_mm_add_ps(h1, r1), _mm_mul_ps(e, _mm_add_ps(h3, r3))), w),
+         t1 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(h0, r0), _mm_mul_ps(d, _mm_sub_ps(h2, r3))), w),
+         t2, t3;
+
+  w  = _mm_mul_ps(bc, r2);
+  t2 = _mm_sub_ps(_mm_add_ps(_mm_add_ps(h0, r0), _mm_mul_ps(c, _mm_add_ps(h3, r2))), w);
+  t3 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(h1, r1), _mm_mul_ps(b, _mm_add_ps(h2, r2))), w);
+
+  x[0] = _mm_add_ps(s0, t0);
+  x[1] = _mm_add_ps(s1, t1);
+  x[2] = _mm_add_ps(s2, t2);
+  x[3] = _mm_add_ps(s3, t3);
+  x[4] = _mm_sub_ps(s3, t3);
+  x[5] = _mm_sub_ps(s2, t2);
+  x[6] = _mm_sub_ps(s1, t1);
+  x[7] = _mm_sub_ps(s0, t0);
+}
+
+//Transposes an 8x8 block held as left (columns 0-3) and right (4-7) halves
+static inline void transposeSSE2(__m128 left[8], __m128 right[8])
+{
+  _MM_TRANSPOSE4_PS(left[0],  left[1],  left[2],  left[3]);
+  _MM_TRANSPOSE4_PS(left[4],  left[5],  left[6],  left[7]);
+  _MM_TRANSPOSE4_PS(right[0], right[1], right[2], right[3]);
+  _MM_TRANSPOSE4_PS(right[4], right[5], right[6], right[7]);
+
+  for(int i = 0; i < 4; i++)
+  {
+    __m128 swap  = right[i];
+    right[i]     = left[i + 4];
+    left[i + 4]  = swap;
+  }
+}
+
+#endif
+
+void JPGDecoder::fidct(void)
 {
+#ifdef JPG_SSE2
+  //Rows then columns, as below; the zero shortcuts give the same values
+  __m128 left[8], right[8];
+  int    i;
+
+  for(i=0;i<8;i++){
+    left[i]  = _mm_loadu_ps(dctt + 8*i);
+    right[i] = _mm_loadu_ps(dctt + 8*i + 4);
+  }
+
+  transposeSSE2(left, right);
+  idctPassSSE2(left);
+  idctPassSSE2(right);
+  transposeSSE2(left, right);
+  idctPassSSE2(left);
+  idctPassSSE2(right);
+
+  for(i=0;i<8;i++){
+    _mm_storeu_ps(dctt + 8*i,     left[i]);
+    _mm_storeu_ps(dctt + 8*i + 4, right[i]);
+  }
+#else
   float a = 0.353553385f,
         b = 0.490392625f,
         c = 0.415734798f,
@@ -1642,9 +2158,10 @@ void fidct(void)
       dctt[i]=dctt[i+8]=dctt[i+16]=dctt[i+24]=dctt[i+32]=dctt[i+40]=dctt[i+48]=dctt[i+56]=a0;
     }
   }
+#endif
 }
 
-void decodeQTable(int len)
+void JPGDecoder::decodeQTable(int len)
 {
   int i;
   unsigned char b;
@@ -1668,7 +2185,7 @@ void decodeQTable(int len)
   }
 }
 
-void decodeBlock(void)
+void JPGDecoder::decodeBlock(void)
 {
   int compn, i, j, b, p, codelen, code, cx, cy, otab[64];
   qTable *qtab;
@@ -1720,23 +2237,96 @@ void decodeBlock(void)
   }
 }
 
-int Image::decodeScanJPG()
+/*
+ * Converts count YCbCr samples to BGR bytes, clamped to 0-255; the vector
+ * loop does the same float arithmetic as the scalar tail.
+ */
+static void convertYCbCr(const float *y, const float *u, const float *v,
+                         unsigned char *bgr, int count)
+{
+  int j = 0;
+
+#ifdef JPG_SSE2
+  const __m128 half = _mm_set1_ps(128.0f),
+               rv   = _mm_set1_ps(1.402f),
+               gu   = _mm_set1_ps(0.34414f),
+               gv   = _mm_set1_ps(0.71414f),
+               bu   = _mm_set1_ps(1.772f);
+  unsigned char packed[16];
+
+  for(; j + 4 <= count; j += 4)
+  {
+    __m128 cy = _mm_loadu_ps(y + j),
+           cu = _mm_sub_ps(_mm_loadu_ps(u + j), half),
+           cv = _mm_sub_ps(_mm_loadu_ps(v + j), half);
+
+    __m128i cr = _mm_cvttps_epi32(_mm_add_ps(cy, _mm_mul_ps(rv, cv))),
+            cg = _mm_cvttps_epi32(_mm_sub_ps(_mm_sub_ps(cy, _mm_mul_ps(gu, cu)), _mm_mul_ps(gv, cv))),
+            cb = _mm_cvttps_epi32(_mm_add_ps(cy, _mm_mul_ps(bu, cu)));
+
+    //b0-b3 g0-g3 r0-r3, saturated to 0-255
+    _mm_storeu_si128((__m128i*)packed,
+                     _mm_packus_epi16(_mm_packs_epi32(cb, cg),
+                                      _mm_packs_epi32(cr, _mm_setzero_si128())));
+
+    for(int k = 0; k < 4; k++, bgr += 3)
+    {
+      bgr[0] = packed[k];
+      bgr[1] = packed[k + 4];
+      bgr[2] = packed[k + 8];
+    }
+  }
+#endif
+
+  for(; j < count; j++, bgr += 3)
+  {
+    float cy = y[j],
+          cu = u[j] - 128.0f,
+          cv = v[j] - 128.0f;
+    int   cr = (int)(cy+1.402f*cv),
+          cg = (int)(cy-0.34414f*cu-0.71414f*cv),
+          cb = (int)(cy+1.772f*cu);
+
+    bgr[0] = max(0, min(255, cb));
+    bgr[1] = max(0, min(255, cg));
+    bgr[2] = max(0, min(255, cr));
+  }
+}
+
+static void convertLuminance(const float *y, unsigned char *lum, int count)
+{
+  int j = 0;
+
+#ifdef JPG_SSE2
+  for(; j + 8 <= count; j += 8)
+  {
+    __m128i low  = _mm_cvttps_epi32(_mm_loadu_ps(y + j)),
+            high = _mm_cvttps_epi32(_mm_loadu_ps(y + j + 4));
+
+    _mm_storel_epi64((__m128i*)(lum + j),
+                     _mm_packus_epi16(_mm_packs_epi32(low, high), _mm_setzero_si128()));
+  }
+#endif
+
+  for(; j < count; j++)
+  {
+    int value = (int)y[j];
+    lum[j] = max(0, min(255, value));
+  }
+}
+
+int JPGDecoder::decodeScan()
 {
   unsigned int nnx, nny, i, j,
                xmin, ymin, xmax, ymax, blockn, adr1, adr2,
                y1, u1, v1, y2, u2, v2, u3, v3,
                dux, duy, dvx, dvy;
   unsigned char sc, ts;
-  float cy, cu, cv;
-  components = GLuint(getByte());
-
-  setFormat(GL_BGR);
-  setInternalFormat(GL_RGB8);
-
-  if(dataBuffer)
-    deleteArray(dataBuffer);
+  float         cu[16], cv[16];
+  components = getByte();
 
-  dataBuffer = new unsigned char[width*height*components];
+  deleteArray(pixels);
+  pixels = new unsigned char[width*height*components];
 
   for(i=0;i<components;i++){
     sc = getByte();
@@ -1813,24 +2403,15 @@ int Image::decodeScanJPG()
             v1+=dvy;
             u2=v2=0;
 
-            for(j=xmin;j<xmax;j++){
-              int cr, cg, cb;
-              cy=component[0].t[y2++];
-              cu=component[1].t[u3+(u2>>1)]-128.0f;
-              cv=component[2].t[v3+(v2>>1)]-128.0f;
-
-              cr=(int)(cy+1.402f*cv);
-              cg=(int)(cy-0.34414f*cu-0.71414f*cv);
-              cb=(int)(cy+1.772f*cu);
-
-              dataBuffer[3*adr2]   = max(0, min(255, cb));
-              dataBuffer[3*adr2+1] = max(0, min(255, cg));
-              dataBuffer[3*adr2+2] = max(0, min(255, cr));
-              adr2++;
-
+            //Gather the (possibly subsampled) chroma, then convert the row
+            for(j=0;j<xmax-xmin;j++){
+              cu[j]=component[1].t[u3+(u2>>1)];
+              cv[j]=component[2].t[v3+(v2>>1)];
               u2+=dux;
               v2+=dvx;
             }
+
+            convertYCbCr(component[0].t+y2, cu, cv, pixels+3*adr2, xmax-xmin);
           }
         }
         else
@@ -1845,10 +2426,7 @@ int Image::decodeScanJPG()
               y2=y1;
               y1+=16;
 
-              for(j=xmin;j<xmax;j++){
-                int lum=(int)component[0].t[y2++];
-                dataBuffer[adr2++]=max(0, min(255, lum));
-              }
+              convertLuminance(component[0].t+y2, pixels+adr2, xmax-xmin);
             }
           }
           xmin=xmax;
@@ -1858,7 +2436,7 @@ int Image::decodeScanJPG()
   return 1;
 }
 
-int Image::decodeJPG()
+int JPGDecoder::decode()
 {
   int w;
   unsigned char a, hdr=0, scan=0;
@@ -1903,7 +2481,7 @@ int Image::decodeJPG()
       break;
 
      case 0xc0:
-     getJPGInfo();
+     getInfo();
      w=0;
      break;
 
@@ -1922,7 +2500,7 @@ int Image::decodeJPG()
 
        scan=1;
 
-       if(!decodeScanJPG())
+       if(!decodeScan())
          return 0;
 
         w=0;
@@ -1950,21 +2528,28 @@ int Image::decodeJPG()
 
 bool Image::loadJPG(const char *filename)
 {
-  int i;
-  for(i=0;i<4;i++)
-    component[i].dcPrev=0;
+  //The tables run to about a megabyte, too much for a worker thread's stack
+  JPGDecoder *decoder = new JPGDecoder();
+
+  if(!decoder->fileOpen(filename) || !decoder->decode() || !decoder->pixels)
+  {
+    deleteObject(decoder);
+    return false;
+  }
 
-  restartInt = 0;
+  width      = decoder->width;
+  height     = decoder->height;
+  components = decoder->components;
 
-   if(fileOpen(filename)){
-      int ret= decodeJPG();
-      fileClose();
-      if(!ret)
-        return false;
-       return true;
-    }
-    else
-     return false;
+  setFormat(components == 1 ? GL_LUMINANCE  : GL_BGR);
+  setInternalFormat(components == 1 ? GL_LUMINANCE8 : GL_RGB8);
+
+  deleteArray(dataBuffer);
+  dataBuffer      = decoder->pixels;
+  decoder->pixels = NULL;
+
+  deleteObject(decoder);
+  return true;
 }
 
 /*******************************************************************************************/
@@ -1989,8 +2574,8 @@ bool loadPNG(const char* filename, Image* image)
                            info.Components == 3 ? GL_RGB8  : GL_LUMINANCE8);
   image->setDataBuffer(info.Data);
 
-  delete info.Data;
-  delete info.Palette;
+  // Data comes from malloc, and Palette belongs to the destroyed png_struct.
+  free(info.Data);
 
   return true;
 }
@@ -2150,7 +2735,7 @@ bool Image::loadUncompressedTrueColorTGA(const char * filename)
   //save data into class member variables
   setWidth(header[1]*256+header[0]);           //determine the image width
   setHeight(header[3]*256+header[2]);            //determine image height
-  setComponentsCount(header[4]/3);
+  setComponentsCount(header[4]/8);
 
   if(width <=0 ||                      //if width <=0
      height<=0 ||                      //or height<=0
@@ -2192,6 +2777,39 @@ bool Image::loadUncompressedTrueColorTGA(const char * filename)
   return true;
 }
 
+/*
+ * Repeats one pixel count times; 32 bit pixels four at a time, 24 bit ones
+ * by doubling the filled span.
+ */
+static void fillPixels(unsigned char *destination, const unsigned char *pixel,
+                       int count, int bytesPerPixel)
+{
+  int filled = 0;
+
+  if(bytesPerPixel == 4)
+  {
+    unsigned int value;
+    memcpy(&value, pixel, 4);
+
+#ifdef JPG_SSE2
+    __m128i quad = _mm_set1_epi32(int(value));
+
+    for(; filled + 4 <= count; filled += 4)
+      _mm_storeu_si128((__m128i*)(destination + filled*4), quad);
+#endif
+
+    for(; filled < count; filled++)
+      memcpy(destination + filled*4, &value, 4);
+    return;
+  }
+
+  int total = count*bytesPerPixel;
+
+  memcpy(destination, pixel, bytesPerPixel);
+  for(filled = bytesPerPixel; filled < total; filled *= 2)
+    memcpy(destination + filled, destination, min(filled, total - filled));
+}
+
 //load a compressed TGA texture (24 or 32 bpp)
 bool Image::loadCompressedTrueColorTGA(const char * filename)
 {
@@ -2229,15 +2847,15 @@ bool Image::loadCompressedTrueColorTGA(const char * filename)
     return Logger::writeErrorLog(std::string("The height or width is less than zero, or the TGA is not 24 bpp -> ") + filename);
   }
 
-  //set format
+  //Pixels are kept in file (BGR) order, as for uncompressed TGAs
   if(header[4] == 24)
   {
-    setFormat(GL_RGB);
+    setFormat(GL_BGR);
     setInternalFormat(GL_RGB8);
   }
   else
   {
-    setFormat(GL_RGBA);
+    setFormat(GL_BGRA);
     setInternalFormat(GL_RGBA8);
   }
 
@@ -2247,105 +2865,58 @@ bool Image::loadCompressedTrueColorTGA(const char * filename)
     deleteArray(dataBuffer);
   dataBuffer = new unsigned char[imageSize];
 
-  if(!dataBuffer)                         //Does the storage memory exist?
-  {
-    fclose(file);
-    return Logger::writeErrorLog(std::string("Unable to allocate memory for image -> ") + filename);
-  }
+  //read the packets in one go and expand them from memory
+  long start = ftell(file);
+  fseek(file, 0, SEEK_END);
+  long end   = ftell(file);
+  fseek(file, start, SEEK_SET);
 
-  //read in the image data
-  int pixelCount  = width*height;
-  int currentPixel= 0;
-  int currentByte = 0;
-  unsigned char *colorBuffer = new unsigned char[getComponentsCount()];
+  unsigned int   packetsSize = end > start ? (unsigned int)(end - start) : 0;
+  unsigned char *packets     = new unsigned char[packetsSize + 1];
 
-  do
-  {
-    unsigned char chunkHeader=0;
+  packetsSize = (unsigned int)fread(packets, 1, packetsSize, file);
+  fclose(file);
 
-    if(!fread(&chunkHeader, sizeof(unsigned char), 1, file))
+  unsigned int pixelCount   = width*height,
+               currentPixel = 0,
+               position     = 0;
+
+  while(currentPixel < pixelCount)
+  {
+    if(position >= packetsSize)
     {
-      if(file)
-        fclose(file);
+      deleteArray(packets);
       deleteArray(dataBuffer);
       return Logger::writeErrorLog("Could not read RLE chunk header");
     }
 
-    if(chunkHeader<128) //Read raw color values
-    {
-      chunkHeader++;
-
-      for(short counter=0; counter<chunkHeader; counter++)
-      {
-        if(fread(colorBuffer, 1, bytesPerPixel, file) != bytesPerPixel)
-        {
-          if(file)
-            fclose(file);
-          deleteArray(colorBuffer);
-          deleteArray(dataBuffer);
-          return Logger::writeErrorLog(std::string("Could not read image data -> ") + filename);
-        }
-
-        //transfer pixel color to data (swapping r and b values)
-        dataBuffer[currentByte]   = colorBuffer[2];
-        dataBuffer[currentByte+1] = colorBuffer[1];
-        dataBuffer[currentByte+2] = colorBuffer[0];
-
-        if(bytesPerPixel==4)
-          dataBuffer[currentByte+3]=colorBuffer[3];
-
-        currentByte+=bytesPerPixel;
-        currentPixel++;
+    unsigned char chunkHeader = packets[position++];
+    unsigned int  count       = chunkHeader < 128 ? chunkHeader + 1 : chunkHeader - 127,
+                  bytes       = chunkHeader < 128 ? count*bytesPerPixel : bytesPerPixel;
 
-        if(currentPixel > pixelCount)
-        {
-          if(file)
-            fclose(file);
-          deleteArray(colorBuffer);
-          deleteArray(dataBuffer);
-          return Logger::writeErrorLog("Too many pixels read");
-        }
-      }
-    }
-    else  //chunkHeader>=128
+    if(currentPixel + count > pixelCount)
     {
-      chunkHeader-=127;
-
-      if(fread(colorBuffer, 1, bytesPerPixel, file) != bytesPerPixel)
-      {
-        if(file)
-          fclose(file);
-        deleteArray(colorBuffer);
-        deleteArray(dataBuffer);
-        return Logger::writeErrorLog(std::string("Unable to read image data -> ") + filename);
-      }
-
-      for(short counter=0; counter<chunkHeader; counter++)
-      {
-        //transfer pixel color to data (swapping r and b values)
-        dataBuffer[currentByte]   = colorBuffer[2];
-        dataBuffer[currentByte+1] = colorBuffer[1];
-        dataBuffer[currentByte+2] = colorBuffer[0];
+      deleteArray(packets);
+      deleteArray(dataBuffer);
+      return Logger::writeErrorLog("Too many pixels read");
+    }
 
-        if(bytesPerPixel==4)
-          dataBuffer[currentByte+3]=colorBuffer[3];
+    if(position + bytes > packetsSize)
+    {
+      deleteArray(packets);
+      deleteArray(dataBuffer);
+      return Logger::writeErrorLog(std::string("Could not read image data -> ") + filename);
+    }
 
-        currentByte+=bytesPerPixel;
-        currentPixel++;
+    if(chunkHeader < 128) //Raw color values
+      memcpy(dataBuffer + currentPixel*bytesPerPixel, packets + position, bytes);
+    else                  //One color repeated
+      fillPixels(dataBuffer + currentPixel*bytesPerPixel, packets + position, count, bytesPerPixel);
 
-        if(currentPixel > pixelCount)
-        {
-          if(file)
-            fclose(file);
-          deleteArray(colorBuffer);
-          deleteArray(dataBuffer);
-          return Logger::writeErrorLog("Too many pixels read");
-        }
-      }
-    }
-  }while(currentPixel<pixelCount);
+    position     += bytes;
+    currentPixel += count;
+  }
 
-  fclose(file);
-  deleteArray(colorBuffer);
+  deleteArray(packets);
   return true;
 }
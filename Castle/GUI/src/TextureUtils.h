@@ -2,6 +2,8 @@
 #define TEXTURE_UTILS_H
 
 #include "GenUtils.h"
+#include <unordered_map>
+#include <future>
 
 /*******************************************************************************************/
 /*MediaInfo                                                                                */
@@ -102,6 +104,8 @@ class MediaInfo
 
 typedef MediaInfo<unsigned int> TextureInfo;
 
+class TextureStream;
+
 /*******************************************************************************************/
 /*TexturesManager                                                                          */
 /*                                                                                         */
@@ -113,13 +117,35 @@ class TexturesManager
     static bool        addTextureInfo(TextureInfo *textureInfo);
     static TextureInfo *getTextureInfo(const char* texturePath);
     static TextureInfo *getTextureInfo(GLuint textureID);
+
+    // A texture whose user count drops to zero stays cached, and is found
+    // again by path, until the next flush. Flushes run when FLUSH_INTERVAL
+    // textures are pending, or when called.
+    static void         retainTexture(TextureInfo *textureInfo);
+    static void         releaseTexture(TextureInfo *textureInfo);
     static void         flushUnusedTextures();
 
+    // Textures loaded with Texture::load2DAsync decode on worker threads;
+    // their finished rows are uploaded here, on the GL thread, at most
+    // maxBytes a call, or all those ready with 0.
+    enum { UPLOAD_BUDGET = 256*1024 };
+    static void         addTextureStream(TextureStream *textureStream);
+    static void         uploadTextureStreams(unsigned int maxBytes = UPLOAD_BUDGET);
+    static size_t       getTextureStreamCount();
+
     static void printTexturesInfo();
     static void flushAllTextures();
   private:
-    static vector<TextureInfo*> textureCollection;
+    enum { FLUSH_INTERVAL = 32 };
+
+    static void         flushTextureStreams(bool all);
 
+    static std::string normalizePath(const char *texturePath);
+
+    static std::unordered_map<GLuint, TextureInfo*>      textureCollection;
+    static std::unordered_map<std::string, TextureInfo*> texturePaths;
+    static vector<GLuint>                                unusedTextures;
+    static vector<TextureStream*>                        textureStreams;
 };
 
 /*******************************************************************************************/
@@ -146,9 +172,9 @@ class Image
     bool loadUncompressedTrueColorTGA(const char * filename);
 
     bool loadJPG(const char* filename);
-    void getJPGInfo();
-    int  decodeScanJPG();
-    int  decodeJPG();
+
+    bool decode(const char* path, const std::string &verifiedPath);
+    static Image *decodeAsync(std::string name, std::string verifiedPath);
 
   public:
     Image(const char* path = NULL);
@@ -169,6 +195,12 @@ class Image
 
    bool load(const char*);
 
+   /*
+    * Looks the path up on the calling thread and decodes on a worker; the
+    * future yields a new Image the caller owns, or NULL if loading failed.
+    */
+   static std::future<Image*> loadAsync(const char*);
+
    const std::string    &getPath()            const;
    const unsigned int    getComponentsCount() const;
    const unsigned int    getInternalFormat()  const;
@@ -263,9 +295,22 @@ typedef struct {
 	unsigned char *Palette;
 } pngRawInfo;
 
+typedef struct pngStream pngStream;
+
 extern int APIENTRY pngLoadRaw(const char *filename, pngRawInfo *rawinfo);
 extern int APIENTRY pngLoadRawF(FILE *file, pngRawInfo *rawinfo);
 
+/* Streaming decoding. pngStreamOpen reads the header and allocates the
+ * Data buffer, which the caller frees once the stream is closed. Each
+ * pngStreamRead feeds the next bytes of the file to the decoder and returns
+ * 1 while there is more, 0 once the image is complete or -1 on an error.
+ * pngStreamGetRows returns how many rows are final, from *first in Data.
+ * Only 8 bit, non-interlaced images can be streamed. */
+extern pngStream * APIENTRY pngStreamOpen(const char *filename, pngRawInfo *rawinfo);
+extern int APIENTRY pngStreamRead(pngStream *stream, unsigned int bytes);
+extern unsigned int APIENTRY pngStreamGetRows(pngStream *stream, unsigned int *first);
+extern void APIENTRY pngStreamClose(pngStream *stream);
+
 extern int APIENTRY pngLoad(const char *filename, int mipmap, int trans, pngInfo *info);
 extern int APIENTRY pngLoadF(FILE *file, int mipmap, int trans, pngInfo *info);
 
@@ -285,6 +330,57 @@ bool loadPNG(const char* filename, Image* image);
 
 #endif
 
+/*******************************************************************************************/
+/*TextureStream                                                                            */
+/*                                                                                         */
+/*******************************************************************************************/
+
+class TextureStream
+{
+  public:
+    enum { READ_SIZE = 32*1024 };
+
+    TextureStream(const char* path);
+   ~TextureStream();
+
+    void         start();
+    unsigned int upload(unsigned int maxBytes);
+    bool         isDone() const;
+
+    std::string                path;
+    pngStream                 *stream;
+    pngRawInfo                 info;
+    GLuint                     id,
+                               format,
+                               internalFormat,
+                               minFilter;
+    bool                       mipmap,
+                               bottomUp,
+                               complete;
+
+    // Rows decoded by the worker, and those the GL thread has uploaded;
+    // both count from the top of the image.
+    std::atomic<unsigned int>  rows;
+    unsigned int               uploaded;
+
+    // The smaller levels, built by the worker once the image is in, and
+    // the next one to upload, with its rows already uploaded.
+    vector<unsigned char>      mipmaps;
+    unsigned int               level,
+                               levelOffset,
+                               levelRows;
+
+    // 1 while decoding, 0 once the image and its levels are in, -1 on errors.
+    std::atomic<int>           status;
+    std::atomic<bool>          cancelled;
+
+  private:
+    static void decode(TextureStream *textureStream);
+    void        buildMipmaps();
+
+    std::future<void>          worker;
+};
+
 /*******************************************************************************************/
 /*Texture                                                                                  */
 /*                                                                                         */
@@ -307,6 +403,18 @@ class Texture : public IOXMLObject
                 GLuint minFilter = GL_LINEAR_MIPMAP_LINEAR,
                 bool   mipmap    = true);
 
+    /*
+     * Reads the size of a PNG, allocates the texture and returns; the image
+     * is decoded on a worker thread and uploaded a few rows at a time by
+     * TexturesManager::uploadTextureStreams. Other files load as load2D.
+     */
+    bool load2DAsync(const char* infoEndOrPath,
+                     GLuint clampS    = GL_REPEAT,
+                     GLuint clampT    = GL_REPEAT,
+                     GLuint magFilter = GL_LINEAR,
+                     GLuint minFilter = GL_LINEAR_MIPMAP_LINEAR,
+                     bool   mipmap    = true);
+
     bool load2DImage(const Image &image,
                      GLuint clampS    = GL_REPEAT,
                      GLuint clampT    = GL_REPEAT,
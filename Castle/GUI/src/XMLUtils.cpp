@@ -42,6 +42,7 @@ bool IOXMLObject::exportXMLSettings(const std::string &xmlPath)
   ofstream xmlFile(xmlPath.c_str(), ios::app | ios::binary);
   bool result = exportXMLSettings(xmlFile);
   xmlFile.close();
+  MediaPathManager::registerFile(xmlPath);
   return result;
 }
 
@@ -409,6 +410,614 @@ bool XMLArbiter::inspectElementInfo(const TiXmlElement *element,
   return true;
 }
 
+Tuple4f &XMLArbiter::fillComponents4f(const CompiledXMLElement *element, Tuple4f &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = float(element->getComponent(0)->DoubleValue());
+    if(element->getComponent(1)) tuple.y = float(element->getComponent(1)->DoubleValue());
+    if(element->getComponent(2)) tuple.z = float(element->getComponent(2)->DoubleValue());
+    if(element->getComponent(3)) tuple.w = float(element->getComponent(3)->DoubleValue());
+  }
+  return tuple;
+}
+
+Tuple4i &XMLArbiter::fillComponents4i(const CompiledXMLElement *element, Tuple4i &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->IntValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->IntValue();
+    if(element->getComponent(2)) tuple.z = element->getComponent(2)->IntValue();
+    if(element->getComponent(3)) tuple.w = element->getComponent(3)->IntValue();
+  }
+  return tuple;
+}
+
+Tuple4d &XMLArbiter::fillComponents4d(const CompiledXMLElement *element, Tuple4d &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->DoubleValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->DoubleValue();
+    if(element->getComponent(2)) tuple.z = element->getComponent(2)->DoubleValue();
+    if(element->getComponent(3)) tuple.w = element->getComponent(3)->DoubleValue();
+  }
+  return tuple;
+}
+
+Tuple3f &XMLArbiter::fillComponents3f(const CompiledXMLElement *element, Tuple3f &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = float(element->getComponent(0)->DoubleValue());
+    if(element->getComponent(1)) tuple.y = float(element->getComponent(1)->DoubleValue());
+    if(element->getComponent(2)) tuple.z = float(element->getComponent(2)->DoubleValue());
+  }
+  return tuple;
+}
+
+Tuple3i &XMLArbiter::fillComponents3i(const CompiledXMLElement *element, Tuple3i &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->IntValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->IntValue();
+    if(element->getComponent(2)) tuple.z = element->getComponent(2)->IntValue();
+  }
+  return tuple;
+}
+
+Tuple3d &XMLArbiter::fillComponents3d(const CompiledXMLElement *element, Tuple3d &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->DoubleValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->DoubleValue();
+    if(element->getComponent(2)) tuple.z = element->getComponent(2)->DoubleValue();
+  }
+  return tuple;
+}
+
+Tuple2f &XMLArbiter::fillComponents2f(const CompiledXMLElement *element, Tuple2f &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = float(element->getComponent(0)->DoubleValue());
+    if(element->getComponent(1)) tuple.y = float(element->getComponent(1)->DoubleValue());
+  }
+  return tuple;
+}
+
+Tuple2i &XMLArbiter::fillComponents2i(const CompiledXMLElement *element, Tuple2i &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->IntValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->IntValue();
+  }
+  return tuple;
+}
+
+Tuple2d &XMLArbiter::fillComponents2d(const CompiledXMLElement *element, Tuple2d &tuple)
+{
+  if(element)
+  {
+    if(element->getComponent(0)) tuple.x = element->getComponent(0)->DoubleValue();
+    if(element->getComponent(1)) tuple.y = element->getComponent(1)->DoubleValue();
+  }
+  return tuple;
+}
+
+double  XMLArbiter::fillComponents1d(const CompiledXMLElement *element,
+                                     const char               *attr,
+                                     double                    valueArg)
+{
+  const CompiledXMLAttribute *attribute = element && attr ? element->findAttribute(attr) : NULL;
+  return attribute ? attribute->DoubleValue() : valueArg;
+}
+
+float   XMLArbiter::fillComponents1f(const CompiledXMLElement *element,
+                                     const char               *attr,
+                                     float                     valueArg)
+{
+  const CompiledXMLAttribute *attribute = element && attr ? element->findAttribute(attr) : NULL;
+  return attribute ? float(attribute->DoubleValue()) : valueArg;
+}
+
+int     XMLArbiter::fillComponents1i(const CompiledXMLElement *element,
+                                     const char               *attr,
+                                     int                       valueArg)
+{
+  const CompiledXMLAttribute *attribute = element && attr ? element->findAttribute(attr) : NULL;
+  return attribute ? attribute->IntValue() : valueArg;
+}
+
+bool XMLArbiter::analyzeBooleanAttr(const CompiledXMLElement *element,
+                                    const char               *attr,
+                                    bool                      source)
+{
+  const CompiledXMLAttribute *attribute = element && attr ? element->findAttribute(attr) : NULL;
+  return attribute ? attribute->BoolValue() : source;
+}
+
+const CompiledXMLElement *XMLArbiter::getChildElementByName(const CompiledXMLElement *element,
+                                                            const char               *name)
+{
+  if(element && name)
+  for(const CompiledXMLElement *child = element->FirstChildElement();
+      child;
+      child = child->NextSiblingElement() )
+  {
+    if(!strcmp(name, child->Value()))
+      return child;
+  }
+  return NULL;
+}
+
+bool XMLArbiter::inspectElementInfo(const CompiledXMLElement *element,
+                                    const char               *desiredType)
+{
+  if(!element || !desiredType || strcmp(element->Value(), desiredType))
+    return false;
+
+  return true;
+}
+
+/*******************************************************************************************/
+/*CompiledXML                                                                              */
+/*                                                                                         */
+/*******************************************************************************************/
+
+bool CompiledXML::binaryEnabled = true;
+
+const CompiledXMLAttribute *CompiledXMLElement::findAttribute(const char *name) const
+{
+  for(const CompiledXMLAttribute *attribute = firstAttribute;
+      attribute;
+      attribute = attribute->Next())
+  {
+    if(!strcmp(attribute->Name(), name))
+      return attribute;
+  }
+  return NULL;
+}
+
+const char *CompiledXMLElement::Attribute(const char *name) const
+{
+  const CompiledXMLAttribute *attribute = findAttribute(name);
+  return attribute ? attribute->Value() : NULL;
+}
+
+const char *CompiledXMLElement::Attribute(const char *name, int *i) const
+{
+  const CompiledXMLAttribute *attribute = findAttribute(name);
+
+  if(i)
+    *i = attribute ? attribute->IntValue() : 0;
+
+  return attribute ? attribute->Value() : NULL;
+}
+
+const char *CompiledXMLElement::Attribute(const char *name, double *d) const
+{
+  const CompiledXMLAttribute *attribute = findAttribute(name);
+
+  if(d)
+    *d = attribute ? attribute->DoubleValue() : 0.0;
+
+  return attribute ? attribute->Value() : NULL;
+}
+
+const TiXmlElement *CompiledXMLElement::toXMLElement(TiXmlElement &element) const
+{
+  element.SetValue(value);
+
+  for(const CompiledXMLAttribute *attribute = firstAttribute;
+      attribute;
+      attribute = attribute->Next())
+    element.SetAttribute(attribute->Name(), attribute->Value());
+
+  for(const CompiledXMLElement *child = firstChild;
+      child;
+      child = child->NextSiblingElement() )
+  {
+    TiXmlElement childElement(child->Value());
+    element.InsertEndChild(*child->toXMLElement(childElement));
+  }
+  return &element;
+}
+
+CompiledXML::CompiledXML()
+{
+  sourceSize = 0;
+  sourceHash = 0;
+  fromBinary = false;
+}
+
+bool CompiledXML::loadFile(const std::string &path)
+{
+  std::string xmlFile = MediaPathManager::lookUpMediaPath(path),
+              binFile = getBinaryPath(xmlFile);
+
+  FILE *file = fopen(xmlFile.c_str(), "rb");
+
+  // Without the source, a compiled file shipped on its own is loaded as is
+  if(!file)
+  {
+    if(loadBinary(MediaPathManager::lookUpMediaPath(getBinaryPath(path))))
+      return true;
+
+    return Logger::writeErrorLog(std::string("Couldn't open the XML file -> ") + xmlFile);
+  }
+
+  std::string text;
+  char        buffer[2048];
+  size_t      count;
+
+  while((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    text.append(buffer, count);
+  fclose(file);
+
+  unsigned int size = (unsigned int)text.size(),
+               hash = hashText(text.data(), text.size());
+
+  // The cache is current when it was compiled from this very text
+  if(binaryEnabled && loadBinary(binFile) &&
+     sourceSize == size && sourceHash == hash)
+    return true;
+
+  TiXmlDocument document(xmlFile);
+  document.Parse(text.c_str());
+
+  if(document.Error())
+    return Logger::writeErrorLog(std::string("Invalid XML file -> ") + xmlFile);
+
+  if(!compile(document, size, hash))
+    return false;
+
+  if(binaryEnabled && !saveBinary(binFile))
+    logInfo(std::string("Couldn't write the compiled XML file -> ") + binFile);
+
+  return true;
+}
+
+bool CompiledXML::compile(const TiXmlDocument &document,
+                          unsigned int         size,
+                          unsigned int         hash)
+{
+  clear();
+  sourceSize = size;
+  sourceHash = hash;
+
+  int previous = -1;
+
+  for(const TiXmlElement *child = document.FirstChildElement();
+      child;
+      child = child->NextSiblingElement() )
+  {
+    int index = compileElement(child);
+    if(previous >= 0)
+      elementRecords[previous].nextSibling = index;
+    previous = index;
+  }
+  internedStrings.clear();
+
+  if(elementRecords.empty())
+    return Logger::writeErrorLog("Cannot compile an XML document without elements");
+
+  link();
+  return true;
+}
+
+int CompiledXML::compileElement(const TiXmlElement *element)
+{
+  ElementRecord record;
+  int           index = int(elementRecords.size());
+
+  record.value          = intern(element->Value());
+  record.firstAttribute = int(attributeRecords.size());
+  record.attributeCount = 0;
+  record.firstChild     = -1;
+  record.nextSibling    = -1;
+  record.components[0]  = record.components[1] =
+  record.components[2]  = record.components[3] = -1;
+
+  for(const TiXmlAttribute *attribute = element->FirstAttribute();
+      attribute;
+      attribute = attribute->Next())
+  {
+    const char *name  = attribute->Name(),
+               *value = attribute->Value();
+
+    if(!name || !value)
+      continue;
+
+    // Same component names as XMLArbiter::fillComponents4f
+    switch(name[0])
+    {
+      case 'x': case 'X': case 'r': case 'R': case 's': case 'S':
+        record.components[0] = int(attributeRecords.size());
+      break;
+
+      case 'y': case 'Y': case 'g': case 'G': case 't': case 'T':
+        record.components[1] = int(attributeRecords.size());
+      break;
+
+      case 'z': case 'Z': case 'b': case 'B': case 'u': case 'U':
+        record.components[2] = int(attributeRecords.size());
+      break;
+
+      case 'w': case 'W': case 'a': case 'A': case 'v': case 'V':
+        record.components[3] = int(attributeRecords.size());
+      break;
+    }
+
+    AttributeRecord attributeRecord;
+    attributeRecord.name    = intern(name);
+    attributeRecord.value   = intern(value);
+    attributeRecord.number  = atof(value);
+    attributeRecord.integer = atoi(value);
+    attributeRecord.boolean = !strcmp(value, "true");
+    attributeRecords.push_back(attributeRecord);
+    record.attributeCount++;
+  }
+  elementRecords.push_back(record);
+
+  int previous = -1;
+
+  for(const TiXmlElement *child = element->FirstChildElement();
+      child;
+      child = child->NextSiblingElement() )
+  {
+    int childIndex = compileElement(child);
+    if(previous < 0)
+      elementRecords[index].firstChild = childIndex;
+    else
+      elementRecords[previous].nextSibling = childIndex;
+    previous = childIndex;
+  }
+  return index;
+}
+
+int CompiledXML::intern(const char *text)
+{
+  std::unordered_map<std::string,int>::iterator found = internedStrings.find(text);
+
+  if(found != internedStrings.end())
+    return found->second;
+
+  int offset = int(strings.size());
+  strings.insert(strings.end(), text, text + strlen(text) + 1);
+  internedStrings[text] = offset;
+  return offset;
+}
+
+bool CompiledXML::loadBinary(const std::string &path)
+{
+  FILE *file = fopen(path.c_str(), "rb");
+
+  if(!file)
+    return false;
+
+  Header header;
+  long   length = 0;
+
+  fseek(file, 0, SEEK_END);
+  length = ftell(file);
+  fseek(file, 0, SEEK_SET);
+
+  clear();
+
+  bool valid = fread(&header, sizeof(Header), 1, file) == 1 &&
+               header.magic   == MAGIC                      &&
+               header.version == VERSION                    &&
+               header.elementCount > 0                      &&
+               header.stringBytes  > 0                      &&
+               (unsigned long)length == sizeof(Header)                                  +
+                                        header.elementCount   * sizeof(ElementRecord)   +
+                                        header.attributeCount * sizeof(AttributeRecord) +
+                                        header.stringBytes;
+  if(valid)
+  {
+    elementRecords.resize(header.elementCount);
+    attributeRecords.resize(header.attributeCount);
+    strings.resize(header.stringBytes);
+
+    valid = fread(&elementRecords[0], sizeof(ElementRecord), header.elementCount, file) == header.elementCount &&
+            (!header.attributeCount ||
+             fread(&attributeRecords[0], sizeof(AttributeRecord), header.attributeCount, file) == header.attributeCount) &&
+            fread(&strings[0], 1, header.stringBytes, file) == header.stringBytes;
+  }
+  fclose(file);
+
+  if(!valid || !validate())
+  {
+    clear();
+    return Logger::writeErrorLog(std::string("Invalid compiled XML file -> ") + path);
+  }
+
+  sourceSize = header.sourceSize;
+  sourceHash = header.sourceHash;
+  fromBinary = true;
+  link();
+  return true;
+}
+
+bool CompiledXML::saveBinary(const std::string &path) const
+{
+  if(elementRecords.empty())
+    return false;
+
+  FILE *file = fopen(path.c_str(), "wb");
+
+  if(!file)
+    return false;
+
+  Header header;
+  header.magic          = MAGIC;
+  header.version        = VERSION;
+  header.sourceSize     = sourceSize;
+  header.sourceHash     = sourceHash;
+  header.elementCount   = (unsigned int)elementRecords.size();
+  header.attributeCount = (unsigned int)attributeRecords.size();
+  header.stringBytes    = (unsigned int)strings.size();
+
+  bool written = fwrite(&header, sizeof(Header), 1, file) == 1 &&
+                 fwrite(&elementRecords[0], sizeof(ElementRecord), elementRecords.size(), file) == elementRecords.size() &&
+                 (attributeRecords.empty() ||
+                  fwrite(&attributeRecords[0], sizeof(AttributeRecord), attributeRecords.size(), file) == attributeRecords.size()) &&
+                 fwrite(&strings[0], 1, strings.size(), file) == strings.size();
+
+  if(fclose(file) != 0)
+    written = false;
+
+  if(!written)
+    remove(path.c_str());
+  else
+    MediaPathManager::registerFile(path);
+
+  return written;
+}
+
+bool CompiledXML::validate() const
+{
+  int elementCount   = int(elementRecords.size()),
+      attributeCount = int(attributeRecords.size()),
+      stringBytes    = int(strings.size());
+
+  if(strings[stringBytes - 1])
+    return false;
+
+  for(int e = 0; e < elementCount; e++)
+  {
+    const ElementRecord &record = elementRecords[e];
+
+    if(record.value          < 0 || record.value >= stringBytes                          ||
+       record.firstAttribute < 0 || record.attributeCount < 0                            ||
+       record.firstAttribute + record.attributeCount > attributeCount                     ||
+       record.firstChild     < -1 || record.firstChild  >= elementCount                  ||
+       record.nextSibling    < -1 || record.nextSibling >= elementCount)
+      return false;
+
+    // Children and siblings follow their element, so the tree has no cycles
+    if((record.firstChild >= 0 && record.firstChild <= e) ||
+       (record.nextSibling >= 0 && record.nextSibling <= e))
+      return false;
+
+    for(int c = 0; c < 4; c++)
+    if(record.components[c] != -1 &&
+       (record.components[c] < record.firstAttribute ||
+        record.components[c] >= record.firstAttribute + record.attributeCount))
+      return false;
+  }
+
+  for(int a = 0; a < attributeCount; a++)
+  {
+    const AttributeRecord &record = attributeRecords[a];
+
+    if(record.name  < 0 || record.name  >= stringBytes ||
+       record.value < 0 || record.value >= stringBytes)
+      return false;
+  }
+  return true;
+}
+
+void CompiledXML::link()
+{
+  const char *table = &strings[0];
+
+  elements.resize(elementRecords.size());
+  attributes.resize(attributeRecords.size());
+
+  for(size_t a = 0; a < attributeRecords.size(); a++)
+  {
+    const AttributeRecord &record    = attributeRecords[a];
+    CompiledXMLAttribute  &attribute = attributes[a];
+
+    attribute.next    = NULL;
+    attribute.name    = table + record.name;
+    attribute.value   = table + record.value;
+    attribute.number  = record.number;
+    attribute.integer = record.integer;
+    attribute.boolean = record.boolean != 0;
+  }
+
+  for(size_t e = 0; e < elementRecords.size(); e++)
+  {
+    const ElementRecord &record  = elementRecords[e];
+    CompiledXMLElement  &element = elements[e];
+
+    element.value          = table + record.value;
+    element.firstAttribute = record.attributeCount ? &attributes[record.firstAttribute]  : NULL;
+    element.firstChild     = record.firstChild  >= 0 ? &elements[record.firstChild]      : NULL;
+    element.nextSibling    = record.nextSibling >= 0 ? &elements[record.nextSibling]     : NULL;
+
+    for(int a = 1; a < record.attributeCount; a++)
+      attributes[record.firstAttribute + a - 1].next = &attributes[record.firstAttribute + a];
+
+    for(int c = 0; c < 4; c++)
+      element.components[c] = record.components[c] >= 0 ? &attributes[record.components[c]] : NULL;
+  }
+}
+
+void CompiledXML::clear()
+{
+  elementRecords.clear();
+  attributeRecords.clear();
+  strings.clear();
+  internedStrings.clear();
+  elements.clear();
+  attributes.clear();
+  sourceSize = 0;
+  sourceHash = 0;
+  fromBinary = false;
+}
+
+const CompiledXMLElement *CompiledXML::FirstChildElement() const
+{
+  return elements.size() ? &elements[0] : NULL;
+}
+
+bool CompiledXML::isFromBinary()      const { return fromBinary;                 }
+int  CompiledXML::getElementCount()   const { return int(elements.size());       }
+int  CompiledXML::getAttributeCount() const { return int(attributes.size());     }
+int  CompiledXML::getStringBytes()    const { return int(strings.size());        }
+
+std::string CompiledXML::getBinaryPath(const std::string &xmlPath)
+{
+  size_t dot   = xmlPath.find_last_of('.'),
+         slash = xmlPath.find_last_of("/\\");
+
+  if(dot == std::string::npos || (slash != std::string::npos && dot < slash))
+    return xmlPath + ".bxml";
+
+  return xmlPath.substr(0, dot) + ".bxml";
+}
+
+// FNV-1a
+unsigned int CompiledXML::hashText(const char *text, size_t length)
+{
+  unsigned int hash = 2166136261u;
+
+  for(size_t i = 0; i < length; i++)
+  {
+    hash ^= (unsigned char)text[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void CompiledXML::setBinaryEnabled(bool enabled)
+{
+  binaryEnabled = enabled;
+}
+
+bool CompiledXML::isBinaryEnabled()
+{
+  return binaryEnabled;
+}
+
 /*
 www.sourceforge.net/projects/tinyxml
 Original code (2.0 and earlier )copyright (c) 2000-2002 Lee Thomason (www.grinninglizard.com)
@@ -39,6 +39,8 @@ distribution.
 #include <assert.h>
 #include <string.h>
 #include <fstream>
+#include <vector>
+#include <unordered_map>
 
 // Help out windows:
 #if defined( _DEBUG ) && !defined( DEBUG )
@@ -1444,6 +1446,8 @@ class IOXMLObject
 /*                                                                                         */
 /*******************************************************************************************/
 
+class CompiledXMLElement;
+
 class XMLArbiter
 {
   public:
@@ -1480,6 +1484,209 @@ class XMLArbiter
 
     static bool    inspectElementInfo(const TiXmlElement *element,
                                       const char         *desiredType);
+
+  /*
+   *The same queries on a compiled element, answered from its pre-parsed
+   *attribute values and tuple components
+   **/
+    static Tuple4f &fillComponents4f(const CompiledXMLElement *element, Tuple4f &tuple);
+    static Tuple4i &fillComponents4i(const CompiledXMLElement *element, Tuple4i &tuple);
+    static Tuple4d &fillComponents4d(const CompiledXMLElement *element, Tuple4d &tuple);
+
+    static Tuple3f &fillComponents3f(const CompiledXMLElement *element, Tuple3f &tuple);
+    static Tuple3i &fillComponents3i(const CompiledXMLElement *element, Tuple3i &tuple);
+    static Tuple3d &fillComponents3d(const CompiledXMLElement *element, Tuple3d &tuple);
+
+    static Tuple2f &fillComponents2f(const CompiledXMLElement *element, Tuple2f &tuple);
+    static Tuple2i &fillComponents2i(const CompiledXMLElement *element, Tuple2i &tuple);
+    static Tuple2d &fillComponents2d(const CompiledXMLElement *element, Tuple2d &tuple);
+
+    static const CompiledXMLElement *getChildElementByName(const CompiledXMLElement *element,
+                                                           const char               *name);
+
+    static double  fillComponents1d(const CompiledXMLElement *element,
+                                    const char               *attribute,
+                                    double                    initialValue);
+
+    static float   fillComponents1f(const CompiledXMLElement *element,
+                                    const char               *attribute,
+                                    float                     initialValue);
+
+    static int     fillComponents1i(const CompiledXMLElement *element,
+                                    const char               *attribute,
+                                    int                       initialValue);
+
+    static bool    analyzeBooleanAttr(const CompiledXMLElement *element,
+                                      const char               *attribute,
+                                      bool                      initialValue);
+
+    static bool    inspectElementInfo(const CompiledXMLElement *element,
+                                      const char               *desiredType);
+};
+
+/*******************************************************************************************/
+/*CompiledXML                                                                              */
+/*                                                                                         */
+/*******************************************************************************************/
+
+/*
+ *A TinyXML document compiled to a compact read-only tree. Element names,
+ *attribute names and values are interned once in a string table, every
+ *attribute value is parsed up front as a number and a boolean, and the
+ *attributes filling a tuple (x/r/s, y/g/t, z/b/u, w/a/v) are resolved per
+ *element. The compiled tree is cached in a binary file next to the XML
+ *file and later loaded with one read and no XML parsing, as long as the
+ *XML file it was compiled from is unchanged.
+ **/
+
+class CompiledXMLAttribute
+{
+  public:
+    const char                 *Name()        const { return name;    }
+    const char                 *Value()       const { return value;   }
+    const CompiledXMLAttribute *Next()        const { return next;    }
+    double                      DoubleValue() const { return number;  }
+    int                         IntValue()    const { return integer; }
+    bool                        BoolValue()   const { return boolean; }
+
+  private:
+    friend class CompiledXML;
+
+    const CompiledXMLAttribute *next;
+    const char                 *name,
+                               *value;
+    double                      number;
+    int                         integer;
+    bool                        boolean;
+};
+
+class CompiledXMLElement
+{
+  public:
+    const char                 *Value()                                  const { return value;          }
+    const CompiledXMLAttribute *FirstAttribute()                         const { return firstAttribute; }
+    const CompiledXMLElement   *FirstChildElement()                      const { return firstChild;     }
+    const CompiledXMLElement   *NextSiblingElement()                     const { return nextSibling;    }
+
+  /*
+   *Tuple component 0 to 3, the last attribute naming it, or NULL
+   **/
+    const CompiledXMLAttribute *getComponent(int index)                  const { return components[index]; }
+
+    const CompiledXMLAttribute *findAttribute(const char *name)          const;
+    const char                 *Attribute(const char *name)              const;
+    const char                 *Attribute(const char *name, int    *i)   const;
+    const char                 *Attribute(const char *name, double *d)   const;
+
+  /*
+   *Copy this element and its children into a TinyXML element, for loaders
+   *that only take TinyXML nodes
+   **/
+    const TiXmlElement         *toXMLElement(TiXmlElement &element)      const;
+
+  private:
+    friend class CompiledXML;
+
+    const CompiledXMLAttribute *firstAttribute,
+                               *components[4];
+    const CompiledXMLElement   *firstChild,
+                               *nextSibling;
+    const char                 *value;
+};
+
+class CompiledXML
+{
+  public:
+    CompiledXML();
+
+  /*
+   *Load the XML file at path, looked up through the MediaPathManager: from
+   *its binary cache when that is current, otherwise by parsing and
+   *compiling the XML and rewriting the cache. With no XML file the cache
+   *alone is loaded.
+   **/
+    bool  loadFile(const std::string &path);
+
+    bool  compile(const TiXmlDocument &document,
+                  unsigned int         sourceSize = 0,
+                  unsigned int         sourceHash = 0);
+    bool  loadBinary(const std::string &path);
+    bool  saveBinary(const std::string &path) const;
+
+    const CompiledXMLElement *FirstChildElement() const;
+
+    bool  isFromBinary()      const;
+    int   getElementCount()   const;
+    int   getAttributeCount() const;
+    int   getStringBytes()    const;
+
+    static std::string getBinaryPath(const std::string &xmlPath);
+    static unsigned int hashText(const char *text, size_t length);
+
+  /*
+   *Turn the binary cache off to always parse the XML
+   **/
+    static void setBinaryEnabled(bool enabled);
+    static bool isBinaryEnabled();
+
+  private:
+    CompiledXML(const CompiledXML &);
+    CompiledXML &operator =(const CompiledXML &);
+
+    enum { MAGIC = 0x4C4D5842, VERSION = 1 };
+
+    // The binary file: a Header, then the element and attribute records,
+    // then the string table; strings are offsets into the table and
+    // elements and attributes indices, -1 for none
+    struct Header
+    {
+      unsigned int magic,
+                   version,
+                   sourceSize,
+                   sourceHash,
+                   elementCount,
+                   attributeCount,
+                   stringBytes;
+    };
+
+    struct ElementRecord
+    {
+      int value,
+          firstAttribute,
+          attributeCount,
+          firstChild,
+          nextSibling,
+          components[4];
+    };
+
+    struct AttributeRecord
+    {
+      double number;
+      int    name,
+             value,
+             integer,
+             boolean;
+    };
+
+    int   compileElement(const TiXmlElement *element);
+    int   intern(const char *text);
+    bool  validate() const;
+    void  link();
+    void  clear();
+
+    std::vector<ElementRecord>          elementRecords;
+    std::vector<AttributeRecord>        attributeRecords;
+    std::vector<char>                   strings;
+    std::unordered_map<std::string,int> internedStrings;
+
+    std::vector<CompiledXMLElement>     elements;
+    std::vector<CompiledXMLAttribute>   attributes;
+
+    unsigned int                        sourceSize,
+                                        sourceHash;
+    bool                                fromBinary;
+
+    static bool                         binaryEnabled;
 };
 
 #endif
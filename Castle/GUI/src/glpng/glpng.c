@@ -346,6 +346,166 @@ int APIENTRY pngLoadRawF(FILE *fp, pngRawInfo *pinfo) {
 	return 1;
 }
 
+/* Streaming decoding: libpng's progressive reader is fed the file a piece
+ * at a time, and decodes each row straight into the image buffer, which is
+ * allocated as soon as the header has been read */
+struct pngStream {
+	FILE        *File;
+	png_structp  Png;
+	png_infop    Info;
+	png_infop    EndInfo;
+	pngRawInfo   Raw;
+	png_uint_32  RowBytes;
+	png_uint_32  Rows;
+	int          Orientation;
+	int          HaveInfo;
+	int          Done;
+	int          Error;
+};
+
+static void StreamInfo(png_structp png, png_infop info) {
+	pngStream *stream = (pngStream *) png_get_progressive_ptr(png);
+	png_uint_32 width, height;
+	int depth, color, interlace;
+	double fileGamma;
+
+	png_get_IHDR(png, info, &width, &height, &depth, &color, &interlace, NULL, NULL);
+
+	/* Rows go to GL as they are finished: one byte a channel, and no passes.
+	 * This libpng has no 16 to 8 bit stripping nor interlace handling */
+	if (depth != 8 || interlace != PNG_INTERLACE_NONE)
+		png_error(png, "Not streamable");
+
+	stream->Raw.Width  = width;
+	stream->Raw.Height = height;
+	stream->Raw.Depth  = depth;
+
+	/*--GAMMA--*/
+	checkForGammaEnv();
+	if (png_get_gAMA(png, info, &fileGamma))
+		png_set_gamma(png, screenGamma, fileGamma);
+	else
+		png_set_gamma(png, screenGamma, 1.0/2.2);
+
+	png_read_update_info(png, info);
+
+	stream->RowBytes = png_get_rowbytes(png, info);
+	stream->Raw.Data = (unsigned char *) malloc(stream->RowBytes*height);
+	if (stream->Raw.Data == NULL) png_error(png, "Out of memory");
+
+	if (color&PNG_COLOR_MASK_ALPHA) {
+		if (color&PNG_COLOR_MASK_PALETTE || color == PNG_COLOR_TYPE_GRAY_ALPHA)
+			stream->Raw.Components = 2;
+		else
+			stream->Raw.Components = 4;
+		stream->Raw.Alpha = 8;
+	}
+	else {
+		if (color&PNG_COLOR_MASK_PALETTE || color == PNG_COLOR_TYPE_GRAY)
+			stream->Raw.Components = 1;
+		else
+			stream->Raw.Components = 3;
+		stream->Raw.Alpha = 0;
+	}
+	stream->Raw.Palette = NULL;
+	stream->HaveInfo = 1;
+}
+
+static void StreamRow(png_structp png, png_bytep row, png_uint_32 rownum, int pass) {
+	pngStream *stream = (pngStream *) png_get_progressive_ptr(png);
+	png_uint_32 i = stream->Orientation ? stream->Raw.Height - 1 - rownum : rownum;
+
+	png_progressive_combine_row(png, stream->Raw.Data + stream->RowBytes*i, row);
+	stream->Rows = rownum + 1;
+	pass = pass;
+}
+
+static void StreamEnd(png_structp png, png_infop info) {
+	pngStream *stream = (pngStream *) png_get_progressive_ptr(png);
+
+	stream->Rows = stream->Raw.Height;
+	stream->Done = 1;
+	info = info;
+}
+
+pngStream * APIENTRY pngStreamOpen(const char *filename, pngRawInfo *pinfo) {
+	pngStream *stream;
+
+	if (pinfo == NULL) return NULL;
+
+	stream = (pngStream *) calloc(1, sizeof(pngStream));
+	if (stream == NULL) return NULL;
+
+	stream->File = fopen(filename, "rb");
+	if (stream->File == NULL) {
+		free(stream);
+		return NULL;
+	}
+
+	stream->Png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	stream->Info = png_create_info_struct(stream->Png);
+	stream->EndInfo = png_create_info_struct(stream->Png);
+	stream->Orientation = StandardOrientation;
+
+	png_set_progressive_read_fn(stream->Png, stream, StreamInfo, StreamRow, StreamEnd);
+
+	/* The header is read here, so that the size is known before any decoding */
+	while (!stream->HaveInfo) {
+		if (pngStreamRead(stream, 1024) <= 0) {
+			free(stream->Raw.Data);
+			pngStreamClose(stream);
+			return NULL;
+		}
+	}
+
+	*pinfo = stream->Raw;
+	return stream;
+}
+
+static int StreamFeed(pngStream *stream, unsigned int bytes) {
+	png_byte buffer[8192];
+	png_size_t size;
+
+	while (bytes > 0 && !stream->Done) {
+		size = fread(buffer, 1, bytes < sizeof(buffer) ? bytes : sizeof(buffer), stream->File);
+
+		/* Truncated file */
+		if (size == 0) return 0;
+
+		png_process_data(stream->Png, stream->Info, buffer, size);
+		bytes -= size;
+	}
+
+	return 1;
+}
+
+int APIENTRY pngStreamRead(pngStream *stream, unsigned int bytes) {
+	if (stream == NULL || stream->Error) return -1;
+	if (stream->Done) return 0;
+
+	if (setjmp(stream->Png->jmpbuf) || !StreamFeed(stream, bytes)) {
+		stream->Error = 1;
+		return -1;
+	}
+
+	return !stream->Done;
+}
+
+unsigned int APIENTRY pngStreamGetRows(pngStream *stream, unsigned int *first) {
+	if (first != NULL)
+		*first = stream->Orientation ? stream->Raw.Height - stream->Rows : 0;
+
+	return stream->Rows;
+}
+
+void APIENTRY pngStreamClose(pngStream *stream) {
+	if (stream == NULL) return;
+
+	png_destroy_read_struct(&stream->Png, &stream->Info, &stream->EndInfo);
+	fclose(stream->File);
+	free(stream);
+}
+
 int APIENTRY pngLoad(const char *filename, int mipmap, int trans, pngInfo *pinfo) {
 	int result;
 	FILE *fp = fopen(filename, "rb");
@@ -80,9 +80,22 @@ typedef struct {
 	unsigned char *Palette;
 } pngRawInfo;
 
+typedef struct pngStream pngStream;
+
 extern int APIENTRY pngLoadRaw(const char *filename, pngRawInfo *rawinfo);
 extern int APIENTRY pngLoadRawF(FILE *file, pngRawInfo *rawinfo);
 
+/* Streaming decoding. pngStreamOpen reads the header and allocates the
+ * Data buffer, which the caller frees once the stream is closed. Each
+ * pngStreamRead feeds the next bytes of the file to the decoder and returns
+ * 1 while there is more, 0 once the image is complete or -1 on an error.
+ * pngStreamGetRows returns how many rows are final, from *first in Data.
+ * Only 8 bit, non-interlaced images can be streamed. */
+extern pngStream * APIENTRY pngStreamOpen(const char *filename, pngRawInfo *rawinfo);
+extern int APIENTRY pngStreamRead(pngStream *stream, unsigned int bytes);
+extern unsigned int APIENTRY pngStreamGetRows(pngStream *stream, unsigned int *first);
+extern void APIENTRY pngStreamClose(pngStream *stream);
+
 extern int APIENTRY pngLoad(const char *filename, int mipmap, int trans, pngInfo *info);
 extern int APIENTRY pngLoadF(FILE *file, int mipmap, int trans, pngInfo *info);
 
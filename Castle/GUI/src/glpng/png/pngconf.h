@@ -268,6 +268,11 @@ __dont__ include it again
 #endif
 #define PNG_WRITE_INTERLACING_SUPPORTED
 
+/* glpng: the push reader, for pngStreamRead */
+#ifndef PNG_NO_PROGRESSIVE_READ
+#define PNG_PROGRESSIVE_READ_SUPPORTED
+#endif
+
 #ifndef PNG_NO_STDIO
 #define PNG_TIME_RFC1123_SUPPORTED
 #endif
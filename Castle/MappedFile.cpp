@@ -0,0 +1,167 @@
+// Read-only memory-mapped file.
+
+#include "MappedFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+//----------------------------------------------------------------------------
+MappedFile::MappedFile()
+   :
+     mData(0),
+     mSize(0),
+     mMapped(false)
+#ifdef WIN32
+     ,
+     mFileHandle(0),
+     mMapHandle(0)
+#endif
+{
+}
+
+
+//----------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+   Close();
+}
+
+
+//----------------------------------------------------------------------------
+bool MappedFile::Open(const std::string& filename)
+{
+   Close();
+
+#ifdef WIN32
+   HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                             0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      return(false);
+   }
+   LARGE_INTEGER size;
+   if (!GetFileSizeEx(file, &size))
+   {
+      CloseHandle(file);
+      return(false);
+   }
+   mSize = (size_t)size.QuadPart;
+   if (mSize == 0)
+   {
+      CloseHandle(file);
+      return(true);
+   }
+   HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+   if (mapping != 0)
+   {
+      void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (data != 0)
+      {
+         mFileHandle = file;
+         mMapHandle  = mapping;
+         mData       = (const char *)data;
+         mMapped     = true;
+         return(true);
+      }
+      CloseHandle(mapping);
+   }
+   CloseHandle(file);
+#else
+   int fd = open(filename.c_str(), O_RDONLY);
+   if (fd < 0)
+   {
+      return(false);
+   }
+   struct stat st;
+   if (fstat(fd, &st) != 0)
+   {
+      close(fd);
+      return(false);
+   }
+   mSize = (size_t)st.st_size;
+   if (mSize == 0)
+   {
+      close(fd);
+      return(true);
+   }
+   void *data = mmap(0, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (data != MAP_FAILED)
+   {
+      mData   = (const char *)data;
+      mMapped = true;
+      return(true);
+   }
+#endif
+
+   // Mapping failed: read the whole file instead.
+   FILE *fp = fopen(filename.c_str(), "rb");
+   if (fp == NULL)
+   {
+      mSize = 0;
+      return(false);
+   }
+   char *buffer = (char *)malloc(mSize);
+   if ((buffer == NULL) || (fread(buffer, 1, mSize, fp) != mSize))
+   {
+      free(buffer);
+      fclose(fp);
+      mSize = 0;
+      return(false);
+   }
+   fclose(fp);
+   mData = buffer;
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+void MappedFile::Close()
+{
+   if (mData != 0)
+   {
+      if (mMapped)
+      {
+#ifdef WIN32
+         UnmapViewOfFile(mData);
+         CloseHandle((HANDLE)mMapHandle);
+         CloseHandle((HANDLE)mFileHandle);
+         mMapHandle  = 0;
+         mFileHandle = 0;
+#else
+         munmap((void *)mData, mSize);
+#endif
+      }
+      else
+      {
+         free((void *)mData);
+      }
+   }
+   mData   = 0;
+   mSize   = 0;
+   mMapped = false;
+}
+
+
+//----------------------------------------------------------------------------
+bool MappedFile::GetFileStamp(const std::string& filename, long long& size,
+                              long long& mtime)
+{
+   struct stat st;
+
+   if (stat(filename.c_str(), &st) != 0)
+   {
+      return(false);
+   }
+   size  = (long long)st.st_size;
+   mtime = (long long)st.st_mtime;
+   return(true);
+}
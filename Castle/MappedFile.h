@@ -0,0 +1,41 @@
+// Read-only memory-mapped file.
+// Falls back to reading the file into memory where mapping is unavailable.
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+
+class MappedFile
+{
+public:
+
+   MappedFile();
+   ~MappedFile();
+
+   // Map the file; returns false if it cannot be opened.
+   bool Open(const std::string& filename);
+   void Close();
+
+   const char *GetData() const { return(mData); }
+   size_t GetSize() const { return(mSize); }
+
+   // Size and modification time of a file without mapping it.
+   static bool GetFileStamp(const std::string& filename, long long& size,
+                            long long& mtime);
+
+private:
+
+   // Not copyable.
+   MappedFile(const MappedFile&);
+   MappedFile& operator=(const MappedFile&);
+
+   const char *mData;
+   size_t     mSize;
+   bool       mMapped;
+#ifdef WIN32
+   void *mFileHandle;
+   void *mMapHandle;
+#endif
+};
+#endif
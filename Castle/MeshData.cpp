@@ -0,0 +1,357 @@
+// Castle mesh data.
+
+#include "MeshData.h"
+#include "VertexWelder.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+
+// Binary file identification.
+const char MeshData::MAGIC[4] = { 'C', 'M', 'S', 'H' };
+const int  MeshData::VERSION  = 1;
+
+// Binary file header: magic, version, source size, source modification
+// time, then the counts below; followed by the per-mesh index counts, the
+// vertices and the indices.
+namespace
+{
+enum
+{
+   HEADER_COUNTS = 4,        // tcoord sets, vertices, vertex size, meshes
+   HEADER_SIZE   = 4 + sizeof(int) + 2 * sizeof(long long) +
+                   HEADER_COUNTS * sizeof(int)
+};
+}
+
+//----------------------------------------------------------------------------
+MeshData::MeshData()
+   :
+     mNumVertices(0),
+     mVertexSize(0),
+     mVertices(0),
+     mCompiled(false)
+{
+}
+
+
+//----------------------------------------------------------------------------
+MeshData::~MeshData()
+{
+}
+
+
+//----------------------------------------------------------------------------
+void MeshData::Clear()
+{
+   mNumVertices = 0;
+   mVertexSize  = 0;
+   mVertices    = 0;
+   mNumIndices.clear();
+   mIndices.clear();
+   mCompiled = false;
+   mFile.Close();
+   mVertexStorage.clear();
+   mIndexStorage.clear();
+}
+
+
+//----------------------------------------------------------------------------
+std::string MeshData::GetCompiledName(const std::string& filename)
+{
+   std::string::size_type dot   = filename.rfind('.');
+   std::string::size_type slash = filename.find_last_of("/\\");
+
+   if ((dot == std::string::npos) ||
+       ((slash != std::string::npos) && (dot < slash)))
+   {
+      return(filename + ".mesh");
+   }
+   return(filename.substr(0, dot) + ".mesh");
+}
+
+
+//----------------------------------------------------------------------------
+bool MeshData::Load(const std::string& filename, int numTCoords, bool multi)
+{
+   if (LoadCompiled(filename, numTCoords))
+   {
+      return(true);
+   }
+   if (!LoadText(filename, numTCoords, multi))
+   {
+      return(false);
+   }
+
+   // First run: leave the binary form behind for next time.  A read-only
+   // data directory just means the text is parsed again.
+   WriteCompiled(filename);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+bool MeshData::LoadCompiled(const std::string& filename, int numTCoords)
+{
+   Clear();
+
+   long long sourceSize, sourceMtime;
+   if (!MappedFile::GetFileStamp(filename, sourceSize, sourceMtime))
+   {
+      return(false);
+   }
+   if (!mFile.Open(GetCompiledName(filename)) ||
+       (mFile.GetSize() < (size_t)HEADER_SIZE))
+   {
+      mFile.Close();
+      return(false);
+   }
+
+   // Validate the header against the text file.
+   const char *data = mFile.GetData();
+   int        version;
+   long long  size, mtime;
+   int        counts[HEADER_COUNTS];
+   size_t     offset = 4;
+   memcpy(&version, data + offset, sizeof(int));
+   offset += sizeof(int);
+   memcpy(&size, data + offset, sizeof(long long));
+   offset += sizeof(long long);
+   memcpy(&mtime, data + offset, sizeof(long long));
+   offset += sizeof(long long);
+   memcpy(counts, data + offset, sizeof(counts));
+   offset += sizeof(counts);
+   if ((memcmp(data, MAGIC, 4) != 0) || (version != VERSION) ||
+       (size != sourceSize) || (mtime != sourceMtime) ||
+       (counts[0] != numTCoords) || (counts[1] < 0) ||
+       (counts[2] != (int)((6 + 2 * numTCoords) * sizeof(float))) ||
+       (counts[3] <= 0))
+   {
+      mFile.Close();
+      return(false);
+   }
+   int numMeshes = counts[3];
+   if (offset + numMeshes * sizeof(int) > mFile.GetSize())
+   {
+      mFile.Close();
+      return(false);
+   }
+   mNumIndices.resize(numMeshes);
+   memcpy(&mNumIndices[0], data + offset, numMeshes * sizeof(int));
+   offset += numMeshes * sizeof(int);
+
+   // The vertices and indices are used in place.
+   size_t expected = offset + (size_t)counts[1] * counts[2];
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      if (mNumIndices[m] < 0)
+      {
+         Clear();
+         return(false);
+      }
+      expected += mNumIndices[m] * sizeof(int);
+   }
+   if (expected != mFile.GetSize())
+   {
+      Clear();
+      return(false);
+   }
+   mNumVertices = counts[1];
+   mVertexSize  = counts[2];
+   mVertices    = (const float *)(data + offset);
+   offset      += (size_t)mNumVertices * mVertexSize;
+   mIndices.resize(numMeshes);
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      mIndices[m] = (const int *)(data + offset);
+      offset     += mNumIndices[m] * sizeof(int);
+   }
+   mCompiled = true;
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+bool MeshData::LoadText(const std::string& filename, int numTCoords,
+                        bool multi)
+{
+   Clear();
+   assert(numTCoords == 1 || numTCoords == 2);
+
+   std::ifstream inFile(filename.c_str());
+   if (!inFile)
+   {
+      return(false);
+   }
+
+   // Get the positions, normals and texture coordinates.
+   int                               numElements, i, t, k;
+   std::vector<float>                positions, normals;
+   std::vector<std::vector<float> >  tcoords(numTCoords);
+   inFile >> numElements;
+   positions.resize(3 * numElements);
+   for (i = 0; i < 3 * numElements; ++i)
+   {
+      inFile >> positions[i];
+   }
+   inFile >> numElements;
+   normals.resize(3 * numElements);
+   for (i = 0; i < 3 * numElements; ++i)
+   {
+      inFile >> normals[i];
+   }
+   for (t = 0; t < numTCoords; ++t)
+   {
+      inFile >> numElements;
+      tcoords[t].resize(2 * numElements);
+      for (i = 0; i < 2 * numElements; ++i)
+      {
+         inFile >> tcoords[t][i];
+      }
+   }
+
+   // Get the triangle counts.
+   int              numMeshes = 1;
+   std::vector<int> numTriangles(1);
+   if (multi)
+   {
+      inFile >> numMeshes;
+      numTriangles.resize(numMeshes);
+      for (int m = 0; m < numMeshes; ++m)
+      {
+         inFile >> numTriangles[m];
+      }
+   }
+   else
+   {
+      inFile >> numTriangles[0];
+   }
+   if (!inFile || (numMeshes <= 0))
+   {
+      return(false);
+   }
+
+   // Get the vertices and indices, welding repeated index tuples.  The
+   // hash table is sized for the worst case of no repeats at all.
+   int numCorners = 0;
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      numCorners += 3 * numTriangles[m];
+   }
+   int          tupleSize = 2 + numTCoords;
+   VertexWelder welder(tupleSize, numCorners);
+   mVertexSize = (6 + 2 * numTCoords) * sizeof(float);
+   mVertexStorage.reserve(numCorners * (6 + 2 * numTCoords));
+   mIndexStorage.resize(numMeshes);
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      std::vector<int>& indices = mIndexStorage[m];
+      indices.resize(3 * numTriangles[m]);
+      for (k = 0; k < 3 * numTriangles[m]; ++k)
+      {
+         // tuple = { position, normal, tcoord0 [, tcoord1] }
+         int tuple[4];
+         for (t = 0; t < tupleSize; ++t)
+         {
+            inFile >> tuple[t];
+         }
+         bool isNew;
+         indices[k] = welder.Insert(tuple, isNew);
+         if (isNew)
+         {
+            // First time the vertex is encountered.
+            mVertexStorage.insert(mVertexStorage.end(),
+                                  &positions[3 * tuple[0]],
+                                  &positions[3 * tuple[0]] + 3);
+            mVertexStorage.insert(mVertexStorage.end(),
+                                  &normals[3 * tuple[1]],
+                                  &normals[3 * tuple[1]] + 3);
+            for (t = 0; t < numTCoords; ++t)
+            {
+               mVertexStorage.insert(mVertexStorage.end(),
+                                     &tcoords[t][2 * tuple[2 + t]],
+                                     &tcoords[t][2 * tuple[2 + t]] + 2);
+            }
+         }
+      }
+   }
+   mNumVertices = welder.GetNumVertices();
+   if (!inFile)
+   {
+      Clear();
+      return(false);
+   }
+   inFile.close();
+
+   mVertices = (mNumVertices > 0 ? &mVertexStorage[0] : 0);
+   mNumIndices.resize(numMeshes);
+   mIndices.resize(numMeshes);
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      mNumIndices[m] = (int)mIndexStorage[m].size();
+      mIndices[m]    = (mNumIndices[m] > 0 ? &mIndexStorage[m][0] : 0);
+   }
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+bool MeshData::WriteCompiled(const std::string& filename) const
+{
+   long long sourceSize, sourceMtime;
+
+   if (!MappedFile::GetFileStamp(filename, sourceSize, sourceMtime))
+   {
+      return(false);
+   }
+
+   // Write to a temporary and rename, so a concurrent loader never maps
+   // a partial file.
+   std::string compiledName = GetCompiledName(filename);
+   std::string tempName     = compiledName + ".tmp";
+   FILE        *fp          = fopen(tempName.c_str(), "wb");
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   int  numTCoords = (mVertexSize / (int)sizeof(float) - 6) / 2;
+   int  numMeshes  = GetNumMeshes();
+   int  counts[HEADER_COUNTS] = { numTCoords, mNumVertices, mVertexSize,
+                                  numMeshes };
+   bool ok = true;
+   ok = ok && (fwrite(MAGIC, 4, 1, fp) == 1);
+   ok = ok && (fwrite(&VERSION, sizeof(int), 1, fp) == 1);
+   ok = ok && (fwrite(&sourceSize, sizeof(long long), 1, fp) == 1);
+   ok = ok && (fwrite(&sourceMtime, sizeof(long long), 1, fp) == 1);
+   ok = ok && (fwrite(counts, sizeof(counts), 1, fp) == 1);
+   ok = ok && (fwrite(&mNumIndices[0], sizeof(int), numMeshes, fp) ==
+               (size_t)numMeshes);
+   if (mNumVertices > 0)
+   {
+      ok = ok && (fwrite(mVertices, mVertexSize, mNumVertices, fp) ==
+                  (size_t)mNumVertices);
+   }
+   for (int m = 0; m < numMeshes; ++m)
+   {
+      if (mNumIndices[m] > 0)
+      {
+         ok = ok && (fwrite(mIndices[m], sizeof(int), mNumIndices[m], fp) ==
+                     (size_t)mNumIndices[m]);
+      }
+   }
+   if ((fclose(fp) != 0) || !ok)
+   {
+      remove(tempName.c_str());
+      return(false);
+   }
+   remove(compiledName.c_str());
+   if (rename(tempName.c_str(), compiledName.c_str()) != 0)
+   {
+      remove(tempName.c_str());
+      return(false);
+   }
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
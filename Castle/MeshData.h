@@ -0,0 +1,69 @@
+// Castle mesh data.
+// Vertices and indices for one geometry file, laid out for direct copy
+// into a vertex buffer: an interleaved position/normal/texture coordinate
+// stream and one triangle index list per mesh.
+//
+// The text files in Geometry are compiled on first use to a binary
+// sidecar (Exterior.txt -> Exterior.mesh) stamped with the size and
+// modification time of the text file. Later loads map the binary file
+// and use it in place.
+
+#ifndef MESH_DATA_H
+#define MESH_DATA_H
+
+#include "MappedFile.h"
+#include <string>
+#include <vector>
+
+class MeshData
+{
+public:
+
+   MeshData();
+   ~MeshData();
+
+   // Load a geometry file with numTCoords (1 or 2) texture coordinate sets.
+   // A multi file holds several meshes sharing one vertex set.
+   bool Load(const std::string& filename, int numTCoords, bool multi);
+
+   // Parse the text file even when a current binary file exists.
+   bool LoadText(const std::string& filename, int numTCoords, bool multi);
+
+   // Interleaved vertices: position (3), normal (3), tcoord0 (2) and
+   // optionally tcoord1 (2) floats.
+   int GetNumVertices() const { return(mNumVertices); }
+   int GetVertexSize() const { return(mVertexSize); }
+   const float *GetVertices() const { return(mVertices); }
+
+   int GetNumMeshes() const { return((int)mNumIndices.size()); }
+   int GetNumIndices(int mesh) const { return(mNumIndices[mesh]); }
+   const int *GetIndices(int mesh) const { return(mIndices[mesh]); }
+
+   // Did the data come from the binary file?
+   bool IsCompiled() const { return(mCompiled); }
+
+   // Binary file name for a text geometry file.
+   static std::string GetCompiledName(const std::string& filename);
+
+private:
+
+   void Clear();
+   bool LoadCompiled(const std::string& filename, int numTCoords);
+   bool WriteCompiled(const std::string& filename) const;
+
+   int                      mNumVertices;
+   int                      mVertexSize;
+   const float              *mVertices;
+   std::vector<int>         mNumIndices;
+   std::vector<const int *> mIndices;
+   bool                     mCompiled;
+
+   // Storage for text-parsed data; compiled data stays in the mapping.
+   MappedFile                     mFile;
+   std::vector<float>             mVertexStorage;
+   std::vector<std::vector<int> > mIndexStorage;
+
+   static const char MAGIC[4];
+   static const int  VERSION;
+};
+#endif
@@ -0,0 +1,119 @@
+// Movement record.
+
+#include "MovementRecord.h"
+
+//----------------------------------------------------------------------------
+MovementRecord::MovementRecord()
+   :
+     mFile(0)
+{
+}
+
+
+//----------------------------------------------------------------------------
+MovementRecord::~MovementRecord()
+{
+   Close();
+}
+
+
+//----------------------------------------------------------------------------
+bool MovementRecord::Open(const std::string& filename)
+{
+   Close();
+   mFile = fopen(filename.c_str(), "a");
+   return(mFile != 0);
+}
+
+
+//----------------------------------------------------------------------------
+void MovementRecord::Close()
+{
+   if (mFile != 0)
+   {
+      fclose(mFile);
+      mFile = 0;
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void MovementRecord::Start(float distance)
+{
+   if (mFile != 0)
+   {
+      fprintf(mFile, "start %.9g\n", distance);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void MovementRecord::Record(const struct vector3d *gyr,
+                            const struct vector3d *acc,
+                            const struct vector3d *averageStatAcc,
+                            float dtime)
+{
+   if (mFile != 0)
+   {
+      fprintf(mFile, "step %.9g %.9g %.9g %.9g %.9g %.9g %.9g %.9g %.9g %.9g\n",
+              gyr->x, gyr->y, gyr->z, acc->x, acc->y, acc->z,
+              averageStatAcc->x, averageStatAcc->y, averageStatAcc->z, dtime);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void MovementRecord::End(float distance, float span)
+{
+   if (mFile != 0)
+   {
+      fprintf(mFile, "end %.9g %.9g\n", distance, span);
+      fflush(mFile);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+bool MovementRecord::Read(const std::string& filename,
+                          std::vector<Measurement>& measurements)
+{
+   FILE *fp = fopen(filename.c_str(), "r");
+
+   if (fp == 0)
+   {
+      return(false);
+   }
+
+   char        line[BUFSIZ];
+   Measurement measurement;
+   bool        started = false;
+   while (fgets(line, BUFSIZ, fp) != 0)
+   {
+      Step  step;
+      float distance, span;
+      if (sscanf(line, "start %f", &distance) == 1)
+      {
+         measurement.StartDistance = distance;
+         measurement.Steps.clear();
+         started = true;
+      }
+      else if (started &&
+               (sscanf(line, "step %f %f %f %f %f %f %f %f %f %f",
+                       &step.Gyr.x, &step.Gyr.y, &step.Gyr.z,
+                       &step.Acc.x, &step.Acc.y, &step.Acc.z,
+                       &step.AverageStatAcc.x, &step.AverageStatAcc.y,
+                       &step.AverageStatAcc.z, &step.DTime) == 10))
+      {
+         measurement.Steps.push_back(step);
+      }
+      else if (started && (sscanf(line, "end %f %f", &distance, &span) == 2))
+      {
+         measurement.EndDistance = distance;
+         measurement.Span        = span;
+         measurements.push_back(measurement);
+         started = false;
+      }
+   }
+   fclose(fp);
+   return(true);
+}
@@ -0,0 +1,67 @@
+// Movement record.
+// The integration steps of span measurements, as a text file that can be
+// replayed through Integrators offline. A measurement is
+//
+//    start <device to start target distance>
+//    step <gyr x y z> <acc x y z> <average stationary acc x y z> <dtime>
+//    ...
+//    end <device to end target distance> <true span>
+//
+// and a file may hold any number of them.
+
+#ifndef MOVEMENT_RECORD_H
+#define MOVEMENT_RECORD_H
+
+#include "integrator/vector3d.h"
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+class MovementRecord
+{
+public:
+
+   struct Step
+   {
+      struct vector3d Gyr;
+      struct vector3d Acc;
+      struct vector3d AverageStatAcc;
+      float           DTime;
+   };
+
+   struct Measurement
+   {
+      float             StartDistance;
+      float             EndDistance;
+      float             Span;
+      std::vector<Step> Steps;
+   };
+
+   MovementRecord();
+   ~MovementRecord();
+
+   // Append to a record file.
+   bool Open(const std::string& filename);
+   void Close();
+
+   bool IsOpen() const { return(mFile != 0); }
+
+   // Record a measurement; does nothing unless open.
+   void Start(float distance);
+   void Record(const struct vector3d *gyr, const struct vector3d *acc,
+               const struct vector3d *averageStatAcc, float dtime);
+   void End(float distance, float span);
+
+   // Complete measurements of a record file; unfinished ones are skipped.
+   static bool Read(const std::string& filename,
+                    std::vector<Measurement>& measurements);
+
+private:
+
+   // Not copyable.
+   MovementRecord(const MovementRecord&);
+   MovementRecord& operator=(const MovementRecord&);
+
+   FILE *mFile;
+};
+#endif
@@ -0,0 +1,144 @@
+// Scene ray caster.
+
+#include "RayCaster.h"
+#include "Wm5VertexBufferAccessor.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+RayCaster::RayCaster()
+   :
+     mScene(0)
+{
+}
+
+
+//----------------------------------------------------------------------------
+void RayCaster::Build(Node *scene)
+{
+   mScene = scene;
+   mMeshes.clear();
+   mFirstTriangle.clear();
+   mTriangles.clear();
+   for (int i = 0; i < scene->GetNumChildren(); ++i)
+   {
+      Spatial *child = scene->GetChild(i);
+      if (child != 0)
+      {
+         Collect(child, child->LocalTransform, mTriangles);
+      }
+   }
+   mBVH.Build(mTriangles);
+}
+
+
+//----------------------------------------------------------------------------
+bool RayCaster::RayCast(const APoint& origin, const AVector& direction,
+                        float tmax, Hit& hit) const
+{
+   if (mScene == 0)
+   {
+      return(false);
+   }
+
+   // Into the root's space; the direction is not renormalized, so T is
+   // the same parameter as in world space.
+   const HMatrix& inverse = mScene->WorldTransform.Inverse();
+   APoint         o       = inverse * origin;
+   AVector        d       = inverse * direction;
+   float          localOrigin[3]    = { o[0], o[1], o[2] };
+   float          localDirection[3] = { d[0], d[1], d[2] };
+
+   TriangleBVH::Hit bvhHit;
+   if (!mBVH.RayCast(localOrigin, localDirection, tmax, bvhHit))
+   {
+      return(false);
+   }
+
+   MakeHit(bvhHit, hit);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+void RayCaster::GetTriangles(std::vector<float>& triangles) const
+{
+   triangles.resize(mTriangles.size());
+   if (mScene == 0)
+   {
+      return;
+   }
+   const HMatrix& toWorld = mScene->WorldTransform.Matrix();
+   for (size_t i = 0; i < mTriangles.size(); i += 3)
+   {
+      APoint p = toWorld * APoint(mTriangles[i], mTriangles[i + 1],
+                                  mTriangles[i + 2]);
+      triangles[i]     = p[0];
+      triangles[i + 1] = p[1];
+      triangles[i + 2] = p[2];
+   }
+}
+
+
+//----------------------------------------------------------------------------
+void RayCaster::MakeHit(const TriangleBVH::Hit& bvhHit, Hit& hit) const
+{
+   int m = (int)(std::upper_bound(mFirstTriangle.begin(), mFirstTriangle.end(),
+                                  bvhHit.Triangle) - mFirstTriangle.begin()) - 1;
+
+   hit.T        = bvhHit.T;
+   hit.Mesh     = mMeshes[m];
+   hit.Triangle = bvhHit.Triangle - mFirstTriangle[m];
+   hit.Bary[0]  = bvhHit.Bary[0];
+   hit.Bary[1]  = bvhHit.Bary[1];
+   hit.Bary[2]  = bvhHit.Bary[2];
+}
+
+
+//----------------------------------------------------------------------------
+void RayCaster::Collect(Spatial *object, const Transform& toScene,
+                        std::vector<float>& triangles)
+{
+   Node *node = DynamicCast<Node>(object);
+
+   if (node != 0)
+   {
+      for (int i = 0; i < node->GetNumChildren(); ++i)
+      {
+         Spatial *child = node->GetChild(i);
+         if (child != 0)
+         {
+            Collect(child, toScene * child->LocalTransform, triangles);
+         }
+      }
+      return;
+   }
+
+   TriMesh *mesh = DynamicCast<TriMesh>(object);
+   if ((mesh == 0) || (mesh->GetNumTriangles() == 0))
+   {
+      return;
+   }
+
+   // Triangle i of the mesh is triangle mFirstTriangle[m] + i of the BVH,
+   // as GetTriangle numbers them.
+   VertexBufferAccessor vba(mesh);
+   mMeshes.push_back(mesh);
+   mFirstTriangle.push_back((int)triangles.size() / 9);
+   for (int t = 0; t < mesh->GetNumTriangles(); ++t)
+   {
+      int v[3];
+      if (!mesh->GetTriangle(t, v[0], v[1], v[2]))
+      {
+         // Keep the numbering; a degenerate triangle is never hit.
+         triangles.insert(triangles.end(), 9, 0.0f);
+         continue;
+      }
+      for (int j = 0; j < 3; ++j)
+      {
+         APoint p = toScene * APoint(vba.Position<Float3>(v[j]));
+         triangles.push_back(p[0]);
+         triangles.push_back(p[1]);
+         triangles.push_back(p[2]);
+      }
+   }
+}
@@ -5,8 +5,15 @@
 // Integrator noise.
 float SpanTracker::INTEGRATOR_SIGNAL_NOISE_RATIO = 2.0f;
 
-// Logfile name.
-char *SpanTracker::LOGFILE_NAME = "spantracker.log";
+// Trace file name.
+char *SpanTracker::LOGFILE_NAME = "spantracker.trace";
+
+// Movement record file name.
+char *SpanTracker::MOVEFILE_NAME = "spantracker.moves";
+
+// IMU sample rates; 0 integrates each move as two samples.
+const int SpanTracker::IMU_RATES[] = { 0, 100, 200, 500, 1000 };
+int       SpanTracker::IMU_RATE    = 0;
 
 SpanTracker::SpanTracker(Castle *castle, string guiPath)
 {
@@ -20,10 +27,16 @@ SpanTracker::SpanTracker(Castle *castle, string guiPath)
    mDevicePosition   = Vector3f::ZERO;
    mIntegrator       = new Integrator(0.0f, 0.0f, 0.0f);
    mIntegrator_noisy = new Integrator(0.0f, 0.0f, 0.0f, true, INTEGRATOR_SIGNAL_NOISE_RATIO);
+   mIntegrator_noisy->trace_source = 1;
+   mIntegrator_kalman = new KalmanIntegrator(0.0f, 0.0f, 0.0f, true, INTEGRATOR_SIGNAL_NOISE_RATIO);
+   mIntegrator_kalman->trace_source = 2;
+   motion_profile_init(&mProfile, IMU_RATE);
+   mResting          = false;
    mHelping          = false;
    mEnabled          = true;
    mLogging          = false;
    mWidth            = mHeight = guiWidth = guiHeight = -1;
+   MediaPathManager::setIndexing(true);
    MediaPathManager::registerPath(guiPath + "resource/");
    guiFrame = new GUIFrame();
    guiFrame->GUIPanel::loadXMLSettings("SpanTrackerGUILayout.xml");
@@ -48,6 +61,7 @@ SpanTracker::~SpanTracker()
    delete end;
    delete mIntegrator;
    delete mIntegrator_noisy;
+   delete mIntegrator_kalman;
 }
 
 
@@ -82,26 +96,23 @@ bool SpanTracker::ToggleEnable()
 // Toggle logging.
 bool SpanTracker::ToggleLogging()
 {
-   time_t    rawtime;
-   struct tm *timeinfo;
-
-   time(&rawtime);
-   timeinfo = localtime(&rawtime);
-   FILE *fp = fopen(LOGFILE_NAME, "a");
    mLogging = !mLogging;
    if (mLogging)
    {
-      mIntegrator->logfile       = LOGFILE_NAME;
-      mIntegrator_noisy->logfile = LOGFILE_NAME;
-      fprintf(fp, "Logging start: %s", asctime(timeinfo));
+      mTrace.Open(LOGFILE_NAME);
+      mIntegrator->trace       = &mTrace;
+      mIntegrator_noisy->trace  = &mTrace;
+      mIntegrator_kalman->trace = &mTrace;
+      mRecord.Open(MOVEFILE_NAME);
    }
    else
    {
-      mIntegrator->logfile       = NULL;
-      mIntegrator_noisy->logfile = NULL;
-      fprintf(fp, "Logging stop: %s", asctime(timeinfo));
+      mIntegrator->trace       = NULL;
+      mIntegrator_noisy->trace  = NULL;
+      mIntegrator_kalman->trace = NULL;
+      mTrace.Close();
+      mRecord.Close();
    }
-   fclose(fp);
    return(mLogging);
 }
 
@@ -111,12 +122,9 @@ float SpanTracker::SignalNoiseRatioDecrease()
 {
    float ratio = mIntegrator_noisy->signal_noise_decrease();
 
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "Signal-to-noise ratio=%f\n", ratio);
-      fclose(fp);
-   }
+   mIntegrator_kalman->signal_noise_ratio = ratio;
+
+   mTrace.Write(TraceLog::SIGNAL_NOISE_RATIO, 0, &ratio, 1);
    return(ratio);
 }
 
@@ -125,37 +133,53 @@ float SpanTracker::SignalNoiseRatioIncrease()
 {
    float ratio = mIntegrator_noisy->signal_noise_increase();
 
-   if (mLogging)
+   mIntegrator_kalman->signal_noise_ratio = ratio;
+
+   mTrace.Write(TraceLog::SIGNAL_NOISE_RATIO, 0, &ratio, 1);
+   return(ratio);
+}
+
+
+// Step to the next IMU sample rate.
+int SpanTracker::ImuRateChange()
+{
+   int n = sizeof(IMU_RATES) / sizeof(IMU_RATES[0]);
+   int i = 0;
+
+   while ((i < n - 1) && (IMU_RATES[i] != mProfile.rate))
    {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "Signal-to-noise ratio=%f\n", ratio);
-      fclose(fp);
+      i++;
    }
-   return(ratio);
+   motion_profile_init(&mProfile, IMU_RATES[(i + 1) % n]);
+   motion_profile_rest(&mProfile, mResting ? REST_TIME : 0.0f);
+   float rate = (float)mProfile.rate;
+   mTrace.Write(TraceLog::IMU_RATE, 0, &rate, 1);
+   return(mProfile.rate);
+}
+
+
+// Toggle the rest after each move.
+bool SpanTracker::ToggleRest()
+{
+   mResting = !mResting;
+   float rest = (mResting ? REST_TIME : 0.0f);
+   motion_profile_rest(&mProfile, rest);
+   mTrace.Write(TraceLog::REST_TIME, 0, &rest, 1);
+   return(mResting);
 }
 
 
 // Rotation rate change.
 void SpanTracker::RotationRateChange(float rate)
 {
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "Rotation rate=%f\n", rate);
-      fclose(fp);
-   }
+   mTrace.Write(TraceLog::ROTATION_RATE, 0, &rate, 1);
 }
 
 
 // Movement rate change.
 void SpanTracker::MovementRateChange(float rate)
 {
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "Movement rate=%f\n", rate);
-      fclose(fp);
-   }
+   mTrace.Write(TraceLog::MOVEMENT_RATE, 0, &rate, 1);
 }
 
 
@@ -233,6 +257,9 @@ void SpanTracker::DrawInstrument()
    counter.markFrameStart();
    guiFrame->render(counter.getFrameInterval());
    counter.markFrameEnd();
+   float data[2] = { (float)guiFrame->getRebuiltCount(),
+                     (float)guiFrame->getDrawCallCount() };
+   mTrace.Write(TraceLog::GUI_FRAME, 0, data, 2);
    exit2Dmode();
    glViewport(0, 0, mWidth, mHeight);
 }
@@ -258,8 +285,32 @@ void SpanTracker::ShowHelp()
    sprintf(buf, "S/s: +/- integrator signal-to-noise ratio (current value=%f)", mIntegrator_noisy->signal_noise_ratio);
    mCastle->mRenderer->Draw(20, v, black, buf);
    v += s;
+   if (mProfile.rate > 0)
+   {
+      sprintf(buf, "i: IMU sample rate (current value=%d Hz)", mProfile.rate);
+   }
+   else
+   {
+      sprintf(buf, "i: IMU sample rate (current value=two samples per move)");
+   }
+   mCastle->mRenderer->Draw(20, v, black, buf);
+   v += s;
+   if (mResting)
+   {
+      sprintf(buf, "z: toggle %.1fs rest after each move (currently resting)", REST_TIME);
+   }
+   else
+   {
+      sprintf(buf, "z: toggle %.1fs rest after each move (currently not resting)", REST_TIME);
+   }
+   mCastle->mRenderer->Draw(20, v, black, buf);
+   v += s;
    mCastle->mRenderer->Draw(20, v, black, "a: perform automatic measurement");
    v += s;
+   mCastle->mRenderer->Draw(20, v, black, "p: time ray casting against the picker");
+   v += s;
+   mCastle->mRenderer->Draw(20, v, black, "g: save collision geometry for batch measurement");
+   v += s;
    if (mLogging)
    {
       sprintf(buf, "l: toggle logging to file %s (currently logging)", LOGFILE_NAME);
@@ -436,12 +487,7 @@ bool SpanTracker::TrackStartTarget()
 
    if (distance < 0.0f)
    {
-      if (mLogging)
-      {
-         FILE *fp = fopen(LOGFILE_NAME, "a");
-         fprintf(fp, "Cannot start tracking\n");
-         fclose(fp);
-      }
+      mTrace.Write(TraceLog::TRACK_FAILED, 0, NULL, 0);
       return(false);
    }
    start->Track(targetPosition, mCastle->mCamera->GetPosition());
@@ -449,6 +495,9 @@ bool SpanTracker::TrackStartTarget()
    mDevicePosition = Vector3f(0.0f, 0.0f, -distance);
    mIntegrator->init(0.0f, 0.0f, -distance);
    mIntegrator_noisy->init(0.0f, 0.0f, -distance);
+   mIntegrator_kalman->init(0.0f, 0.0f, -distance);
+   mRecord.Start(distance);
+   mTrace.Write(TraceLog::TRACK_START, 0, &distance, 1);
    mCastle->mScene->Update();
    mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
    return(true);
@@ -463,21 +512,21 @@ bool SpanTracker::TrackEndTarget()
 
    if (distance < 0.0f)
    {
-      if (mLogging)
-      {
-         FILE *fp = fopen(LOGFILE_NAME, "a");
-         fprintf(fp, "Cannot end tracking\n");
-         fclose(fp);
-      }
+      mTrace.Write(TraceLog::TRACK_FAILED, 1, NULL, 0);
       return(false);
    }
    end->Track(targetPosition, mCastle->mCamera->GetPosition());
-   if (mLogging)
+   mRecord.End(distance, GetDistance());
+   if (mTrace.IsOpen())
    {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "integrated distance=%f, noisy distance=%f\n",
-              mIntegrator->get_target_distance(distance), mIntegrator_noisy->get_target_distance(distance));
-      fclose(fp);
+      float data[5] =
+      {
+         distance, GetDistance(),
+         mIntegrator->get_target_distance(distance),
+         mIntegrator_noisy->get_target_distance(distance),
+         mIntegrator_kalman->get_target_distance(distance)
+      };
+      mTrace.Write(TraceLog::TRACK_END, 0, data, 5);
    }
    mCastle->mScene->Update();
    mCastle->mCuller.ComputeVisibleSet(mCastle->mScene);
@@ -617,95 +666,123 @@ float SpanTracker::PickTarget(int direction, APoint& target)
       dir = mCastle->mCamera->GetRVector();
       break;
    }
-   mCastle->mPicker.Execute(mCastle->mScene, pos, dir, 0.0f, Mathf::MAX_REAL);
-   if (mCastle->mPicker.Records.size() > 0)
+   RayCaster::Hit hit;
+   if (mCastle->mRayCaster.RayCast(pos, dir, Mathf::MAX_REAL, hit))
    {
-      const PickRecord& record = mCastle->mPicker.GetClosestNonnegative();
-      TriMesh           *mesh  = DynamicCast<TriMesh>(record.Intersected);
-      APoint            tri[3];
-      mesh->GetWorldTriangle(record.Triangle, tri);
-      target = record.Bary[0] * tri[0] + record.Bary[1] * tri[1] +
-               record.Bary[2] * tri[2];
+      target = pos + hit.T * dir;
       return((mCastle->mCamera->GetPosition() - target).Length());
    }
    return(-1.0f);
 }
 
 
-// Integrate device movement.
-void SpanTracker::MoveForward()
+// Integrate the samples of the current move in batches, recording them
+// while logging.
+void SpanTracker::IntegrateProfile()
 {
-   // Integrate acceleration for 1/2 distance, then decelerate for 1/2.
-   // acceleration = 2 * distance / time ^ 2
-   struct vector3d gyr;
+   struct vector3d gyr[MOTION_BATCH];
+   struct vector3d acc[MOTION_BATCH];
+   struct vector3d average_stat_acc;
+   int             n;
+
+   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
+   while ((n = motion_profile_fill(&mProfile, gyr, acc, MOTION_BATCH)) > 0)
+   {
+      mIntegrator->integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      mIntegrator_noisy->integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      mIntegrator_kalman->integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      if (mRecord.IsOpen())
+      {
+         for (int i = 0; i < n; i++)
+         {
+            mRecord.Record(&gyr[i], &acc[i], &average_stat_acc, mProfile.dtime);
+         }
+      }
+   }
+}
+
+
+// Integrate a translation by v in device coordinates.
+void SpanTracker::IntegrateTranslation(Vector3f& v)
+{
+   struct vector3d displacement;
+
+   displacement.x = v.X();
+   displacement.y = v.Y();
+   displacement.z = v.Z();
+   motion_profile_translate(&mProfile, &displacement, MOVE_TIME);
+   IntegrateProfile();
+}
+
 
-   gyr.x = gyr.y = gyr.z = 0.0f;
+// Integrate a rotation by v (axis times angle) in device coordinates.
+void SpanTracker::IntegrateRotation(Vector3f& v)
+{
+   struct vector3d rotation;
+
+   rotation.x = v.X();
+   rotation.y = v.Y();
+   rotation.z = v.Z();
+   motion_profile_rotate(&mProfile, &rotation, MOVE_TIME);
+   IntegrateProfile();
+}
+
+
+// Trace device movement from position p.
+void SpanTracker::TraceMove(TraceLog::Move move, float speed, Vector3f& p)
+{
+   float data[7] =
+   {
+      speed, p.X(), p.Y(), p.Z(),
+      mDevicePosition.X(), mDevicePosition.Y(), mDevicePosition.Z()
+   };
+
+   mTrace.Write(TraceLog::DEVICE_MOVE, move, data, 7);
+}
+
+
+void SpanTracker::TraceTurn(TraceLog::Move move)
+{
+   float data[10];
+
+   data[0] = mCastle->mRotSpeed;
+   for (int i = 0; i < 9; i++)
+   {
+      data[i + 1] = mDeviceRotation[i / 3][i % 3];
+   }
+   mTrace.Write(TraceLog::DEVICE_TURN, move, data, 10);
+}
+
+
+void SpanTracker::MoveForward()
+{
+   // Accelerate for 1/2 distance, then decelerate for 1/2.
+   // (See motion_profile.h for the acceleration profile.)
    Vector3f f = getForwardVector(mDeviceRotation);
+
    f.Y() = 0.0f;
    f.Normalize();
    f *= mCastle->mTrnSpeed;
-   Vector3f        v = mDeviceRotation * f;
-   Vector3f        a = v / 0.25f;
-   struct vector3d acc;
-   acc.x = a.X();
-   acc.y = a.Y();
-   acc.z = a.Z();
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 0.5f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   acc.x = -acc.x;
-   acc.y = -acc.y;
-   acc.z = -acc.z;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   Vector3f v = mDeviceRotation * f;
+   IntegrateTranslation(v);
    Vector3f p = mDevicePosition;
    mDevicePosition += f;
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "forward: speed=%f pos=%f %f %f -> %f %f %f, length=%f\n", p.X(), p.Y(), p.Z(),
-              mDevicePosition.X(), mDevicePosition.Y(), mDevicePosition.Z(), mDevicePosition.Length());
-      fclose(fp);
-   }
+   TraceMove(TraceLog::FORWARD, mCastle->mTrnSpeed, p);
 }
 
 
 void SpanTracker::MoveBackward()
 {
-   struct vector3d gyr;
-
-   gyr.x = gyr.y = gyr.z = 0.0f;
    Vector3f f = -getForwardVector(mDeviceRotation);
+
    f.Y() = 0.0f;
    f.Normalize();
    f *= mCastle->mTrnSpeed;
-   Vector3f        v = mDeviceRotation * f;
-   Vector3f        a = v / 0.25f;
-   struct vector3d acc;
-   acc.x = a.X();
-   acc.y = a.Y();
-   acc.z = a.Z();
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 0.5f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   acc.x = -acc.x;
-   acc.y = -acc.y;
-   acc.z = -acc.z;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   Vector3f v = mDeviceRotation * f;
+   IntegrateTranslation(v);
    Vector3f p = mDevicePosition;
    mDevicePosition += f;
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "backward: speed=%f pos=%f %f %f -> %f %f %f, length=%f\n", p.X(), p.Y(), p.Z(),
-              mDevicePosition.X(), mDevicePosition.Y(), mDevicePosition.Z(), mDevicePosition.Length());
-      fclose(fp);
-   }
+   TraceMove(TraceLog::BACKWARD, mCastle->mTrnSpeed, p);
 }
 
 
@@ -714,36 +791,12 @@ void SpanTracker::TurnLeft()
    Vector3f v(0.0f, mCastle->mRotSpeed, 0.0f);
 
    v = mDeviceRotation * v;
-   struct vector3d gyr;
-   gyr.x = v.X();
-   gyr.y = v.Y();
-   gyr.z = v.Z();
-   struct vector3d acc;
-   acc.x = acc.y = acc.z = 0.0f;
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 1.0f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   IntegrateRotation(v);
    Quaternionf quat(Vector3f(0.0f, 1.0f, 0.0f), mCastle->mRotSpeed);
    Matrix3f    rot;
    quat.ToRotationMatrix(rot);
-   Vector3f f = getForwardVector(mDeviceRotation);
-   Vector3f u = getUpVector(mDeviceRotation);
-   Vector3f r = getRightVector(mDeviceRotation);
    mDeviceRotation = mDeviceRotation * rot;
-   if (mLogging)
-   {
-      FILE     *fp = fopen(LOGFILE_NAME, "a");
-      Vector3f f2  = getForwardVector(mDeviceRotation);
-      Vector3f u2  = getUpVector(mDeviceRotation);
-      Vector3f r2  = getRightVector(mDeviceRotation);
-      fprintf(fp, "left: speed=%f\n      f=%f %f %f -> %f %f %f\n      u=%f %f %f -> %f %f %f\n      r=%f %f %f -> %f %f %f\n",
-              f.X(), f.Y(), f.Z(), f2.X(), f2.Y(), f2.Z(),
-              u.X(), u.Y(), u.Z(), u2.X(), u2.Y(), u2.Z(),
-              r.X(), r.Y(), r.Z(), r2.X(), r2.Y(), r2.Z());
-      fclose(fp);
-   }
+   TraceTurn(TraceLog::LEFT);
 }
 
 
@@ -752,36 +805,12 @@ void SpanTracker::TurnRight()
    Vector3f v(0.0f, -mCastle->mRotSpeed, 0.0f);
 
    v = mDeviceRotation * v;
-   struct vector3d gyr;
-   gyr.x = v.X();
-   gyr.y = v.Y();
-   gyr.z = v.Z();
-   struct vector3d acc;
-   acc.x = acc.y = acc.z = 0.0f;
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 1.0f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   IntegrateRotation(v);
    Quaternionf quat(Vector3f(0.0f, -1.0f, 0.0f), mCastle->mRotSpeed);
    Matrix3f    rot;
    quat.ToRotationMatrix(rot);
-   Vector3f f = getForwardVector(mDeviceRotation);
-   Vector3f u = getUpVector(mDeviceRotation);
-   Vector3f r = getRightVector(mDeviceRotation);
    mDeviceRotation = mDeviceRotation * rot;
-   if (mLogging)
-   {
-      FILE     *fp = fopen(LOGFILE_NAME, "a");
-      Vector3f f2  = getForwardVector(mDeviceRotation);
-      Vector3f u2  = getUpVector(mDeviceRotation);
-      Vector3f r2  = getRightVector(mDeviceRotation);
-      fprintf(fp, "right: speed=%f\n      f=%f %f %f -> %f %f %f\n      u=%f %f %f -> %f %f %f\n      r=%f %f %f -> %f %f %f\n",
-              f.X(), f.Y(), f.Z(), f2.X(), f2.Y(), f2.Z(),
-              u.X(), u.Y(), u.Z(), u2.X(), u2.Y(), u2.Z(),
-              r.X(), r.Y(), r.Z(), r2.X(), r2.Y(), r2.Z());
-      fclose(fp);
-   }
+   TraceTurn(TraceLog::RIGHT);
 }
 
 
@@ -790,36 +819,12 @@ void SpanTracker::LookUp()
    Vector3f v(mCastle->mRotSpeed, 0.0f, 0.0f);
 
    v = mDeviceRotation * v;
-   struct vector3d gyr;
-   gyr.x = v.X();
-   gyr.y = v.Y();
-   gyr.z = v.Z();
-   struct vector3d acc;
-   acc.x = acc.y = acc.z = 0.0f;
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 1.0f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   IntegrateRotation(v);
    Quaternionf quat(Vector3f(1.0f, 0.0f, 0.0f), mCastle->mRotSpeed);
    Matrix3f    rot;
    quat.ToRotationMatrix(rot);
-   Vector3f f = getForwardVector(mDeviceRotation);
-   Vector3f u = getUpVector(mDeviceRotation);
-   Vector3f r = getRightVector(mDeviceRotation);
    mDeviceRotation = mDeviceRotation * rot;
-   if (mLogging)
-   {
-      FILE     *fp = fopen(LOGFILE_NAME, "a");
-      Vector3f f2  = getForwardVector(mDeviceRotation);
-      Vector3f u2  = getUpVector(mDeviceRotation);
-      Vector3f r2  = getRightVector(mDeviceRotation);
-      fprintf(fp, "up: speed=%f\n      f=%f %f %f -> %f %f %f\n      u=%f %f %f -> %f %f %f\n      r=%f %f %f -> %f %f %f\n",
-              f.X(), f.Y(), f.Z(), f2.X(), f2.Y(), f2.Z(),
-              u.X(), u.Y(), u.Z(), u2.X(), u2.Y(), u2.Z(),
-              r.X(), r.Y(), r.Z(), r2.X(), r2.Y(), r2.Z());
-      fclose(fp);
-   }
+   TraceTurn(TraceLog::UP);
 }
 
 
@@ -828,70 +833,24 @@ void SpanTracker::LookDown()
    Vector3f v(-mCastle->mRotSpeed, 0.0f, 0.0f);
 
    v = mDeviceRotation * v;
-   struct vector3d gyr;
-   gyr.x = v.X();
-   gyr.y = v.Y();
-   gyr.z = v.Z();
-   struct vector3d acc;
-   acc.x = acc.y = acc.z = 0.0f;
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 1.0f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   IntegrateRotation(v);
    Quaternionf quat(Vector3f(-1.0f, 0.0f, 0.0f), mCastle->mRotSpeed);
    Matrix3f    rot;
    quat.ToRotationMatrix(rot);
-   Vector3f f = getForwardVector(mDeviceRotation);
-   Vector3f u = getUpVector(mDeviceRotation);
-   Vector3f r = getRightVector(mDeviceRotation);
    mDeviceRotation = mDeviceRotation * rot;
-   if (mLogging)
-   {
-      FILE     *fp = fopen(LOGFILE_NAME, "a");
-      Vector3f f2  = getForwardVector(mDeviceRotation);
-      Vector3f u2  = getUpVector(mDeviceRotation);
-      Vector3f r2  = getRightVector(mDeviceRotation);
-      fprintf(fp, "down: speed=%f\n      f=%f %f %f -> %f %f %f\n      u=%f %f %f -> %f %f %f\n      r=%f %f %f -> %f %f %f\n",
-              f.X(), f.Y(), f.Z(), f2.X(), f2.Y(), f2.Z(),
-              u.X(), u.Y(), u.Z(), u2.X(), u2.Y(), u2.Z(),
-              r.X(), r.Y(), r.Z(), r2.X(), r2.Y(), r2.Z());
-      fclose(fp);
-   }
+   TraceTurn(TraceLog::DOWN);
 }
 
 
 void SpanTracker::AdjustVerticalDistance(float distance)
 {
-   struct vector3d gyr;
-
-   gyr.x = gyr.y = gyr.z = 0.0f;
    Vector3f u(0.0f, distance, 0.0f);
+
    u = mDeviceRotation * u;
-   Vector3f        a = u / 0.25f;
-   struct vector3d acc;
-   acc.x = a.X();
-   acc.y = a.Y();
-   acc.z = a.Z();
-   struct vector3d average_stat_acc;
-   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
-   float dtime = 0.5f;
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   acc.x = -a.X();
-   acc.y = -a.Y();
-   acc.z = -a.Z();
-   mIntegrator->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
-   mIntegrator_noisy->integrate_movement(&gyr, &acc, &average_stat_acc, dtime);
+   IntegrateTranslation(u);
    Vector3f p = mDevicePosition;
    mDevicePosition += Vector3f(0.0f, distance, 0.0f);
-   if (mLogging)
-   {
-      FILE *fp = fopen(LOGFILE_NAME, "a");
-      fprintf(fp, "vertical: pos=%f %f %f -> %f %f %f, length=%f\n", p.X(), p.Y(), p.Z(),
-              mDevicePosition.X(), mDevicePosition.Y(), mDevicePosition.Z(), mDevicePosition.Length());
-      fclose(fp);
-   }
+   TraceMove(TraceLog::VERTICAL, distance, p);
 }
 
 
@@ -901,6 +860,7 @@ void SpanTracker::Reset()
    mDevicePosition = Vector3f::ZERO;
    mIntegrator->init(0.0f, 0.0f, 0.0f);
    mIntegrator_noisy->init(0.0f, 0.0f, 0.0f);
+   mIntegrator_kalman->init(0.0f, 0.0f, 0.0f);
    startTargetIsTracked = false;
    startTargetTrackCheck->setChecked(false);
    endTargetIsTracked = false;
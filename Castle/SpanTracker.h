@@ -9,6 +9,10 @@
 #include "gettime.h"
 #include "RigidBall.h"
 #include "integrator/integrator.h"
+#include "integrator/kalman_integrator.h"
+#include "integrator/motion_profile.h"
+#include "MovementRecord.h"
+#include "TraceLog.h"
 #include <GL/glu.h>
 using namespace Wm5;
 using namespace std;
@@ -78,6 +82,21 @@ public:
    Integrator   *mIntegrator;
    Integrator   *mIntegrator_noisy;
 
+   // Noisy too, filtered with zero-velocity updates while resting.
+   Integrator *mIntegrator_kalman;
+
+   // IMU sample rate of moves; ImuRateChange steps through IMU_RATES.
+   static const int IMU_RATES[];
+   static int       IMU_RATE;
+   int ImuRateChange();
+
+   // Hold the device still for REST_TIME after each move, for the Kalman
+   // filter's zero-velocity updates; off by default, as a rest changes what
+   // the other integrators see.
+   bool ToggleRest();
+
+   int GetImuRate() { return(mProfile.rate); }
+
    // Change integrator signal-to-noise ratio.
    float SignalNoiseRatioDecrease();
    float SignalNoiseRatioIncrease();
@@ -100,6 +119,24 @@ private:
    bool        mEnabled;
    static char *LOGFILE_NAME;
    bool        mLogging;
+   TraceLog    mTrace;
+   void TraceMove(TraceLog::Move move, float speed, Vector3f& p);
+   void TraceTurn(TraceLog::Move move);
+
+   // Movement record, written while logging for offline replay.
+   static char    *MOVEFILE_NAME;
+   MovementRecord mRecord;
+
+   // Moves are sampled from a motion profile and integrated in batches;
+   // while resting, the device is held still for REST_TIME after each move.
+   const float           MOVE_TIME = 1.0f;
+   const float           REST_TIME = 0.5f;
+   bool                  mResting;
+   struct motion_profile mProfile;
+   void IntegrateProfile();
+   void IntegrateTranslation(Vector3f& v);
+   void IntegrateRotation(Vector3f& v);
+
    int         mWidth, mHeight;
 
    // GUI.
@@ -0,0 +1,233 @@
+// Static geometry batcher.
+
+#include "StaticBatcher.h"
+#include "Wm5VertexBufferAccessor.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+StaticBatcher::StaticBatcher(float cellSize)
+   :
+     mCellSize(cellSize)
+{
+}
+
+
+//----------------------------------------------------------------------------
+int StaticBatcher::Batch(Node *root, Texture2DEffect *effect)
+{
+   if (mVFormat == 0)
+   {
+      mVFormat = VertexFormat::Create(3,
+                                      VertexFormat::AU_POSITION, VertexFormat::AT_FLOAT3, 0,
+                                      VertexFormat::AU_NORMAL, VertexFormat::AT_FLOAT3, 0,
+                                      VertexFormat::AU_TEXCOORD, VertexFormat::AT_FLOAT2, 0);
+   }
+
+   // Find the meshes to merge, with their transforms relative to root.
+   std::vector<Part> parts;
+   for (int i = 0; i < root->GetNumChildren(); ++i)
+   {
+      Spatial *child = root->GetChild(i);
+      if (child != 0)
+      {
+         Collect(child, child->LocalTransform, effect, parts);
+      }
+   }
+
+   // Group them by texture and cell.
+   typedef std::pair<Texture2D *, std::vector<int> > Key;
+   std::map<Key, std::vector<const Part *> >        groups;
+   int i;
+   for (i = 0; i < (int)parts.size(); ++i)
+   {
+      Key key(parts[i].Texture, std::vector<int>(parts[i].Cell,
+                                                 parts[i].Cell + 3));
+      groups[key].push_back(&parts[i]);
+   }
+
+   // Build the batches before detaching anything, since the parts hold the
+   // only other references to the source geometry.
+   std::map<Key, std::vector<const Part *> >::iterator it;
+   std::vector<TriMeshPtr> batches;
+   for (it = groups.begin(); it != groups.end(); ++it)
+   {
+      BatchInfo info;
+      TriMesh   *batch = Merge(it->second, effect, info);
+      mBatches[batch] = info;
+      batches.push_back(batch);
+   }
+   for (i = 0; i < (int)parts.size(); ++i)
+   {
+      Node *parent = DynamicCast<Node>(parts[i].Mesh->GetParent());
+      parent->DetachChild(parts[i].Mesh);
+   }
+   Prune(root);
+   for (i = 0; i < (int)batches.size(); ++i)
+   {
+      root->AttachChild(batches[i]);
+   }
+   return((int)parts.size());
+}
+
+
+//----------------------------------------------------------------------------
+const std::string& StaticBatcher::GetName(const Spatial *object,
+                                          int triangle) const
+{
+   std::map<const Spatial *, BatchInfo>::const_iterator it =
+      mBatches.find(object);
+
+   if (it == mBatches.end())
+   {
+      return(object->GetName());
+   }
+
+   // Last object whose first triangle is at or before this one.
+   const BatchInfo& info = it->second;
+   int              i    = (int)(std::upper_bound(info.FirstTriangle.begin(),
+                                                  info.FirstTriangle.end(), triangle) -
+                                 info.FirstTriangle.begin()) - 1;
+   return(info.Names[i < 0 ? 0 : i]);
+}
+
+
+//----------------------------------------------------------------------------
+void StaticBatcher::Collect(Spatial *object, const Transform& toRoot,
+                            Texture2DEffect *effect,
+                            std::vector<Part>& parts) const
+{
+   Node *node = DynamicCast<Node>(object);
+
+   if (node != 0)
+   {
+      for (int i = 0; i < node->GetNumChildren(); ++i)
+      {
+         Spatial *child = node->GetChild(i);
+         if (child != 0)
+         {
+            Collect(child, toRoot * child->LocalTransform, effect, parts);
+         }
+      }
+      return;
+   }
+
+   TriMesh *mesh = DynamicCast<TriMesh>(object);
+   if ((mesh == 0) || (mesh->GetEffectInstance() == 0) ||
+       (mesh->GetEffectInstance()->GetEffect() != effect) ||
+       (mesh->GetIndexBuffer() == 0) ||
+       (mesh->GetIndexBuffer()->GetElementSize() != sizeof(int)))
+   {
+      return;
+   }
+   VertexBufferAccessor vba(mesh);
+   if (!vba.HasNormal() || !vba.HasTCoord(0))
+   {
+      return;
+   }
+
+   Part part;
+   part.Mesh    = mesh;
+   part.ToRoot  = toRoot;
+   part.Texture = StaticCast<Texture2D>(
+      mesh->GetEffectInstance()->GetPixelTexture(0, 0));
+   APoint center = toRoot * mesh->GetModelBound().GetCenter();
+   for (int j = 0; j < 3; ++j)
+   {
+      part.Cell[j] = (int)Mathf::Floor(center[j] / mCellSize);
+   }
+   parts.push_back(part);
+}
+
+
+//----------------------------------------------------------------------------
+TriMesh *StaticBatcher::Merge(const std::vector<const Part *>& parts,
+                              Texture2DEffect *effect, BatchInfo& info) const
+{
+   int numVertices = 0, numIndices = 0;
+   int i, j;
+
+   for (i = 0; i < (int)parts.size(); ++i)
+   {
+      numVertices += parts[i]->Mesh->GetVertexBuffer()->GetNumElements();
+      numIndices  += parts[i]->Mesh->GetIndexBuffer()->GetNumElements();
+   }
+
+   VertexBuffer         *vbuffer = new0 VertexBuffer(numVertices,
+                                                     mVFormat->GetStride());
+   IndexBuffer          *ibuffer = new0 IndexBuffer(numIndices, sizeof(int));
+   VertexBufferAccessor dst(mVFormat, vbuffer);
+   int                  *indices = (int *)ibuffer->GetData();
+   int                  vbase    = 0, ibase = 0;
+   for (i = 0; i < (int)parts.size(); ++i)
+   {
+      TriMesh              *mesh = parts[i]->Mesh;
+      VertexBufferAccessor src(mesh);
+      const Transform&     xfrm = parts[i]->ToRoot;
+
+      // Normals take the inverse transpose; a reflection flips the winding.
+      HMatrix      normalMatrix = xfrm.Inverse().Transpose();
+      const HMatrix& m          = xfrm.Matrix();
+      float        det          =
+         m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) -
+         m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+         m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+
+      for (j = 0; j < src.GetNumVertices(); ++j)
+      {
+         APoint  position = xfrm * APoint(src.Position<Float3>(j));
+         AVector normal   = normalMatrix * AVector(src.Normal<Float3>(j));
+         normal.Normalize();
+         dst.Position<Float3>(vbase + j) = Float3(position[0], position[1],
+                                                  position[2]);
+         dst.Normal<Float3>(vbase + j) = Float3(normal[0], normal[1],
+                                                normal[2]);
+         dst.TCoord<Float2>(0, vbase + j) = src.TCoord<Float2>(0, j);
+      }
+
+      const int *srcIndices = (const int *)mesh->GetIndexBuffer()->GetData();
+      int       count       = mesh->GetIndexBuffer()->GetNumElements();
+      for (j = 0; j < count; j += 3)
+      {
+         indices[ibase + j]     = vbase + srcIndices[j];
+         indices[ibase + j + 1] = vbase + srcIndices[j + (det < 0.0f ? 2 : 1)];
+         indices[ibase + j + 2] = vbase + srcIndices[j + (det < 0.0f ? 1 : 2)];
+      }
+
+      info.FirstTriangle.push_back(ibase / 3);
+      info.Names.push_back(mesh->GetName());
+      vbase += src.GetNumVertices();
+      ibase += count;
+   }
+
+   TriMesh *batch = new0 TriMesh(mVFormat, vbuffer, ibuffer);
+   batch->SetName("StaticBatch");
+   batch->SetEffectInstance(effect->CreateInstance(parts[0]->Texture));
+   return(batch);
+}
+
+
+//----------------------------------------------------------------------------
+bool StaticBatcher::Prune(Node *node)
+{
+   // Detach the child nodes with nothing left to draw.
+   bool empty = true;
+
+   for (int i = 0; i < node->GetNumChildren(); ++i)
+   {
+      Spatial *child = node->GetChild(i);
+      if (child == 0)
+      {
+         continue;
+      }
+      Node *childNode = DynamicCast<Node>(child);
+      if ((childNode != 0) && Prune(childNode))
+      {
+         node->DetachChildAt(i);
+      }
+      else
+      {
+         empty = false;
+      }
+   }
+   return(empty);
+}
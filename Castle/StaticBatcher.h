@@ -0,0 +1,63 @@
+// Static geometry batcher.
+// Merges the static meshes below a node that are drawn with one texture
+// effect into a few large meshes: one per texture and spatial cell, with
+// the vertices transformed into the node's space. Each batch remembers
+// which triangles came from which object so picking can still report
+// the object's name.
+
+#ifndef STATIC_BATCHER_H
+#define STATIC_BATCHER_H
+
+#include "Wm5Node.h"
+#include "Wm5TriMesh.h"
+#include "Wm5Texture2DEffect.h"
+#include <map>
+#include <string>
+#include <vector>
+using namespace Wm5;
+
+class StaticBatcher
+{
+public:
+
+   // Objects are grouped by the cell of a cubic grid holding their center.
+   StaticBatcher(float cellSize = 32.0f);
+
+   // Replace the TriMeshes below root that use an instance of effect by
+   // batch meshes attached to root; nodes left empty are removed. Returns
+   // the number of meshes merged.
+   int Batch(Node *root, Texture2DEffect *effect);
+
+   int GetNumBatches() const { return((int)mBatches.size()); }
+
+   // Name of the object a picked triangle belongs to; for anything other
+   // than a batch this is just the object's name.
+   const std::string& GetName(const Spatial *object, int triangle) const;
+
+private:
+
+   struct Part
+   {
+      TriMeshPtr Mesh;
+      Transform  ToRoot;
+      Texture2D  *Texture;
+      int        Cell[3];
+   };
+
+   struct BatchInfo
+   {
+      std::vector<int>         FirstTriangle;   // per object, ascending
+      std::vector<std::string> Names;
+   };
+
+   void Collect(Spatial *object, const Transform& toRoot,
+                Texture2DEffect *effect, std::vector<Part>& parts) const;
+   TriMesh *Merge(const std::vector<const Part *>& parts,
+                  Texture2DEffect *effect, BatchInfo& info) const;
+   static bool Prune(Node *node);
+
+   float                                mCellSize;
+   VertexFormatPtr                      mVFormat;
+   std::map<const Spatial *, BatchInfo> mBatches;
+};
+#endif
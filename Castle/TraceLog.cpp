@@ -0,0 +1,324 @@
+// Trace log.
+
+#include "TraceLog.h"
+#include <chrono>
+#include <string.h>
+#include <time.h>
+
+// Records gathered by the writer per file write.
+static const int WRITE_BATCH = 256;
+
+// Writer sleep when the buffer is empty.
+static const int IDLE_MS = 2;
+
+// Yields a per-step integrator record waits for the writer to free a slot
+// before it is dropped; other records wait as long as the trace is open.
+static const int FULL_WAITS = 1000;
+
+//----------------------------------------------------------------------------
+TraceLog::TraceLog(int capacity)
+   :
+     mHead(0),
+     mTail(0),
+     mDropped(0),
+     mOpen(false),
+     mStopping(false),
+     mStartTime(0),
+     mFile(0)
+{
+   uint64_t size = 1;
+
+   while (size < (uint64_t)capacity)
+   {
+      size <<= 1;
+   }
+   mSlots = new Slot[size];
+   mMask  = size - 1;
+   for (uint64_t i = 0; i < size; ++i)
+   {
+      mSlots[i].Sequence.store(i, std::memory_order_relaxed);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+TraceLog::~TraceLog()
+{
+   Close();
+   delete[] mSlots;
+}
+
+
+//----------------------------------------------------------------------------
+bool TraceLog::Open(const char *filename)
+{
+   Close();
+   mFile = fopen(filename, "wb");
+   if (mFile == 0)
+   {
+      return(false);
+   }
+
+   Header header;
+   memset(&header, 0, sizeof(header));
+   memcpy(header.Magic, "CTRC", 4);
+   header.Version    = 1;
+   header.RecordSize = sizeof(Record);
+   header.StartTime  = (int64_t)time(0);
+   fwrite(&header, sizeof(header), 1, mFile);
+
+   // The previous writer drained every claimed slot, but a Write racing
+   // the Close may have claimed one since: start over with an empty ring.
+   for (uint64_t i = 0; i <= mMask; ++i)
+   {
+      mSlots[i].Sequence.store(i, std::memory_order_relaxed);
+   }
+   mHead.store(0);
+   mTail = 0;
+   mDropped.store(0);
+   mStartTime = Now();
+   mStopping.store(false);
+   mThread = std::thread(&TraceLog::Writer, this);
+   mOpen.store(true);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+void TraceLog::Close()
+{
+   if (!mOpen.exchange(false))
+   {
+      return;
+   }
+   mStopping.store(true);
+   mThread.join();
+   fclose(mFile);
+   mFile = 0;
+}
+
+
+//----------------------------------------------------------------------------
+void TraceLog::Write(Type type, uint32_t source, const float *data,
+                     int count)
+{
+   if (!mOpen.load(std::memory_order_relaxed))
+   {
+      return;
+   }
+
+   // Claim a slot: its sequence equals the position while it is free.
+   bool     critical = (type != INTEGRATOR_INPUT) && (type != INTEGRATOR_STATE);
+   int      waits    = 0;
+   uint64_t position = mHead.load(std::memory_order_relaxed);
+   Slot     *slot;
+   for ( ; ; )
+   {
+      slot = &mSlots[position & mMask];
+      uint64_t sequence = slot->Sequence.load(std::memory_order_acquire);
+      int64_t  diff     = (int64_t)(sequence - position);
+      if (diff == 0)
+      {
+         if (mHead.compare_exchange_weak(position, position + 1,
+                                         std::memory_order_relaxed))
+         {
+            break;
+         }
+      }
+      else if (diff < 0)
+      {
+         // Full: let the writer drain it.
+         if ((critical || (++waits <= FULL_WAITS)) &&
+             mOpen.load(std::memory_order_relaxed))
+         {
+            std::this_thread::yield();
+            position = mHead.load(std::memory_order_relaxed);
+            continue;
+         }
+         mDropped.fetch_add(1, std::memory_order_relaxed);
+         return;
+      }
+      else
+      {
+         position = mHead.load(std::memory_order_relaxed);
+      }
+   }
+
+   Record& record = slot->Entry;
+   record.RecordType = (uint32_t)type;
+   record.Source     = source;
+   record.Time       = Now() - mStartTime;
+   if (count > MAX_DATA)
+   {
+      count = MAX_DATA;
+   }
+   if (count > 0)
+   {
+      memcpy(record.Data, data, count * sizeof(float));
+   }
+   memset(record.Data + count, 0, (MAX_DATA - count) * sizeof(float));
+   slot->Sequence.store(position + 1, std::memory_order_release);
+}
+
+
+//----------------------------------------------------------------------------
+void TraceLog::Writer()
+{
+   Record batch[WRITE_BATCH];
+   int    count = 0;
+
+   for ( ; ; )
+   {
+      // A filled slot's sequence is one past its position.
+      Slot *slot = &mSlots[mTail & mMask];
+      if (slot->Sequence.load(std::memory_order_acquire) == mTail + 1)
+      {
+         batch[count++] = slot->Entry;
+         slot->Sequence.store(mTail + mMask + 1, std::memory_order_release);
+         mTail++;
+         if (count == WRITE_BATCH)
+         {
+            fwrite(batch, sizeof(Record), count, mFile);
+            count = 0;
+         }
+         continue;
+      }
+      if (count > 0)
+      {
+         fwrite(batch, sizeof(Record), count, mFile);
+         count = 0;
+      }
+      // Stop once every claimed slot has been filled and drained.
+      if (mStopping.load() && (mHead.load() == mTail))
+      {
+         break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_MS));
+   }
+
+   uint64_t dropped = mDropped.load();
+   if (dropped > 0)
+   {
+      Record record;
+      memset(&record, 0, sizeof(record));
+      record.RecordType = DROPPED;
+      record.Source     = (uint32_t)dropped;
+      record.Time       = Now() - mStartTime;
+      fwrite(&record, sizeof(record), 1, mFile);
+   }
+   fflush(mFile);
+}
+
+
+//----------------------------------------------------------------------------
+uint64_t TraceLog::Now()
+{
+   return((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+bool TraceLog::Dump(const char *filename, FILE *out)
+{
+   static const char *moves[] =
+   {
+      "forward", "backward", "left", "right", "up", "down", "vertical"
+   };
+   FILE *fp = fopen(filename, "rb");
+
+   if (fp == 0)
+   {
+      return(false);
+   }
+   Header header;
+   if ((fread(&header, sizeof(header), 1, fp) != 1) ||
+       (memcmp(header.Magic, "CTRC", 4) != 0) ||
+       (header.RecordSize != sizeof(Record)))
+   {
+      fclose(fp);
+      return(false);
+   }
+   time_t start = (time_t)header.StartTime;
+   fprintf(out, "Trace start: %s", ctime(&start));
+
+   Record record;
+   while (fread(&record, sizeof(record), 1, fp) == 1)
+   {
+      const float *d    = record.Data;
+      const char  *move = (record.Source < 7 ? moves[record.Source] : "?");
+      fprintf(out, "%12.6f ", record.Time * 1.0e-9);
+      switch (record.RecordType)
+      {
+      case INTEGRATOR_INPUT:
+         fprintf(out, "integrator %u: gyr=%f %f %f, acc=%f %f %f, dtime=%f\n",
+                 record.Source, d[0], d[1], d[2], d[3], d[4], d[5], d[6]);
+         break;
+
+      case INTEGRATOR_STATE:
+         fprintf(out, "integrator %u: Cbi={%f,%f,%f},{%f,%f,%f},{%f,%f,%f} "
+                 "pos=%f %f %f\n", record.Source, d[0], d[1], d[2], d[3],
+                 d[4], d[5], d[6], d[7], d[8], d[9], d[10], d[11]);
+         break;
+
+      case TRACK_START:
+         fprintf(out, "start target: distance=%f\n", d[0]);
+         break;
+
+      case TRACK_END:
+         fprintf(out, "end target: distance=%f, span=%f, integrated "
+                 "distance=%f, noisy distance=%f, kalman distance=%f\n", d[0],
+                 d[1], d[2], d[3], d[4]);
+         break;
+
+      case TRACK_FAILED:
+         fprintf(out, "Cannot %s tracking\n", record.Source == 0 ? "start" : "end");
+         break;
+
+      case DEVICE_MOVE:
+         fprintf(out, "%s: speed=%f pos=%f %f %f -> %f %f %f\n", move, d[0],
+                 d[1], d[2], d[3], d[4], d[5], d[6]);
+         break;
+
+      case DEVICE_TURN:
+         fprintf(out, "%s: speed=%f rotation={%f,%f,%f},{%f,%f,%f},{%f,%f,%f}\n",
+                 move, d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8],
+                 d[9]);
+         break;
+
+      case ROTATION_RATE:
+         fprintf(out, "Rotation rate=%f\n", d[0]);
+         break;
+
+      case MOVEMENT_RATE:
+         fprintf(out, "Movement rate=%f\n", d[0]);
+         break;
+
+      case SIGNAL_NOISE_RATIO:
+         fprintf(out, "Signal-to-noise ratio=%f\n", d[0]);
+         break;
+
+      case IMU_RATE:
+         fprintf(out, "IMU sample rate=%f\n", d[0]);
+         break;
+
+      case REST_TIME:
+         fprintf(out, "Rest time=%f\n", d[0]);
+         break;
+
+      case GUI_FRAME:
+         fprintf(out, "GUI frame: rebuilt=%.0f draw calls=%.0f\n", d[0], d[1]);
+         break;
+
+      case DROPPED:
+         fprintf(out, "%u records dropped\n", record.Source);
+         break;
+
+      default:
+         fprintf(out, "unknown record type %u\n", record.RecordType);
+         break;
+      }
+   }
+   fclose(fp);
+   return(true);
+}
@@ -0,0 +1,128 @@
+// Trace log.
+// Binary event trace for the integrators and SpanTracker. Write copies a
+// fixed-size record into a lock-free ring buffer, safe to call from any
+// number of threads, and a background thread drains the buffer to the
+// trace file in large writes. When the buffer is full Write yields to the
+// writer: the per-step integrator records are dropped if it cannot free a
+// slot soon, and the count of dropped records is written at the end of
+// the trace; the other records wait. Dump converts a trace file to text
+// offline.
+//
+// File layout: a Header, then Records in the order they were written.
+
+#ifndef TRACE_LOG_H
+#define TRACE_LOG_H
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+
+class TraceLog
+{
+public:
+
+   enum Type
+   {
+      // Source is the integrator; data gyr xyz, acc xyz, dtime.
+      INTEGRATOR_INPUT = 1,
+      // Source is the integrator; data Cbi (row major), pos xyz.
+      INTEGRATOR_STATE = 2,
+      // Data distance from the device to the start target.
+      TRACK_START = 3,
+      // Data distance to the end target, span, integrated distance,
+      // noisy integrated distance, Kalman filter integrated distance.
+      TRACK_END = 4,
+      // Source is 0 for the start target, 1 for the end target.
+      TRACK_FAILED = 5,
+      // Source is a Move; data speed, device position before xyz and
+      // after xyz.
+      DEVICE_MOVE = 6,
+      // Source is a Move; data speed, device rotation after (row major).
+      DEVICE_TURN = 7,
+      // Data rate or ratio.
+      ROTATION_RATE = 8,
+      MOVEMENT_RATE = 9,
+      SIGNAL_NOISE_RATIO = 10,
+      // Source is the number of records dropped.
+      DROPPED = 11,
+      // Data IMU sample rate (0 for two samples per move).
+      IMU_RATE = 12,
+      // Data GUI elements whose geometry was rebuilt and draw calls
+      // issued in a frame.
+      GUI_FRAME = 13,
+      // Data rest after each move in seconds (0 for none).
+      REST_TIME = 14
+   };
+
+   enum Move
+   {
+      FORWARD, BACKWARD, LEFT, RIGHT, UP, DOWN, VERTICAL
+   };
+
+   enum { MAX_DATA = 12 };
+
+   struct Record
+   {
+      uint32_t RecordType;
+      uint32_t Source;
+      uint64_t Time;            // nanoseconds since the trace was opened
+      float    Data[MAX_DATA];
+   };
+
+   struct Header
+   {
+      char     Magic[4];        // "CTRC"
+      uint32_t Version;
+      uint32_t RecordSize;
+      uint32_t Reserved;
+      int64_t  StartTime;       // time_t when the trace was opened
+   };
+
+   // capacity is rounded up to a power of two.
+   TraceLog(int capacity = 16384);
+   ~TraceLog();
+
+   // Start or stop tracing to a file; Close waits for the buffer to drain.
+   // A Write racing either may be lost.
+   bool Open(const char *filename);
+   void Close();
+
+   bool IsOpen() const { return(mOpen.load(std::memory_order_relaxed)); }
+
+   // Queue a record with up to MAX_DATA floats; does nothing unless open.
+   void Write(Type type, uint32_t source, const float *data, int count);
+
+   // Records dropped since the trace was opened.
+   uint64_t GetNumDropped() const { return(mDropped.load()); }
+
+   // Write a trace file as text; returns false if it is not a trace.
+   static bool Dump(const char *filename, FILE *out);
+
+private:
+
+   struct Slot
+   {
+      std::atomic<uint64_t> Sequence;
+      Record                Entry;
+   };
+
+   void Writer();
+   static uint64_t Now();
+
+   // Not copyable.
+   TraceLog(const TraceLog&);
+   TraceLog& operator=(const TraceLog&);
+
+   Slot                  *mSlots;
+   uint64_t              mMask;
+   std::atomic<uint64_t> mHead;        // next slot to fill
+   uint64_t              mTail;        // next slot to drain (writer only)
+   std::atomic<uint64_t> mDropped;
+   std::atomic<bool>     mOpen;
+   std::atomic<bool>     mStopping;
+   uint64_t              mStartTime;
+   FILE                  *mFile;
+   std::thread           mThread;
+};
+#endif
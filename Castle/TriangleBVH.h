@@ -0,0 +1,105 @@
+// Triangle bounding volume hierarchy.
+// A static set of triangles in a four-wide BVH built with the surface
+// area heuristic. Each node holds the boxes of its four children side by
+// side and each leaf up to four triangles side by side, so a ray is
+// tested against four boxes or four triangles at once (with SSE where
+// available). Triangles are two-sided, as with Picker.
+
+#ifndef TRIANGLE_BVH_H
+#define TRIANGLE_BVH_H
+
+#include <vector>
+
+class TriangleBVH
+{
+public:
+
+   struct Hit
+   {
+      float T;          // origin + T * direction is the hit point
+      int   Triangle;
+      float Bary[3];    // weights of the triangle's vertices
+   };
+
+   TriangleBVH();
+
+   // Nine floats (three vertices) per triangle.
+   void Build(const std::vector<float>& triangles);
+
+   // Closest hit with 0 <= T <= tmax; the direction need not be unit.
+   bool RayCast(const float origin[3], const float direction[3], float tmax,
+                Hit& hit) const;
+
+   int GetNumTriangles() const { return(mNumTriangles); }
+   int GetNumNodes() const { return((int)mNodes.size()); }
+   int GetNumLeaves() const { return((int)mLeaves.size()); }
+
+private:
+
+   enum { WIDTH = 4, EMPTY = 0x7fffffff };
+
+   // Child c is node Child[c] if >= 0, leaf -1 - Child[c] if < 0, or
+   // nothing if EMPTY (its box is zero; traversal skips it by its code).
+   struct Node
+   {
+      float Min[3][WIDTH];
+      float Max[3][WIDTH];
+      int   Child[WIDTH];
+   };
+
+   // Vertex 0 and the two edges from it, per axis; unused lanes have
+   // Triangle -1 and zero edges.
+   struct Leaf
+   {
+      float V0[3][WIDTH];
+      float E1[3][WIDTH];
+      float E2[3][WIDTH];
+      int   Triangle[WIDTH];
+   };
+
+   struct Ray
+   {
+      float Origin[3];
+      float Direction[3];
+      float InvDirection[3];
+   };
+
+   // Binary SAH tree, collapsed into the four-wide one.
+   struct BuildNode
+   {
+      float Min[3], Max[3];
+      int   Left, Right;        // -1 for a leaf
+      int   First, Count;       // leaf triangles in mOrder
+   };
+
+   int BuildBinary(int first, int count, std::vector<BuildNode>& nodes,
+                   const std::vector<float>& centroids,
+                   const std::vector<float>& bounds);
+   int Collapse(const std::vector<BuildNode>& nodes, int index,
+                const std::vector<float>& triangles);
+   int MakeLeaf(const BuildNode& node, const std::vector<float>& triangles);
+
+   // Closest hit below the node or leaf with child code root, closer than
+   // best; updates the best hit.
+   void Traverse(int root, const Ray& ray, float& best, int& bestTri,
+                 float& bestU, float& bestV) const;
+   static void TestLeaf(const Leaf& leaf, const Ray& ray, float& best,
+                        int& bestTri, float& bestU, float& bestV);
+
+   static void MakeRay(const float origin[3], const float direction[3],
+                       Ray& ray);
+
+   // Masks of the child boxes or leaf triangles hit with 0 <= T <= tmax.
+   static int IntersectBoxes(const Node& node, const Ray& ray, float tmax,
+                             float tnear[WIDTH]);
+   static int IntersectTriangles(const Leaf& leaf, const Ray& ray, float tmax,
+                                 float t[WIDTH], float u[WIDTH],
+                                 float v[WIDTH]);
+
+   int               mNumTriangles;
+   int               mRoot;       // child code of the root
+   std::vector<int>  mOrder;
+   std::vector<Node> mNodes;
+   std::vector<Leaf> mLeaves;
+};
+#endif
@@ -0,0 +1,96 @@
+// Vertex welder.
+
+#include "VertexWelder.h"
+#include <assert.h>
+
+//----------------------------------------------------------------------------
+VertexWelder::VertexWelder(int tupleSize, int maxCorners)
+   :
+     mTupleSize(tupleSize),
+     mNumVertices(0)
+{
+   assert(tupleSize > 0 && maxCorners >= 0);
+
+   // Power-of-two table at most half full.
+   unsigned int size = 16;
+   while (size < 2 * (unsigned int)maxCorners)
+   {
+      size <<= 1;
+   }
+   mMask = size - 1;
+   mSlots.assign(size, -1);
+   mTuples.resize(tupleSize * maxCorners);
+}
+
+
+//----------------------------------------------------------------------------
+int VertexWelder::Insert(const int *tuple, bool& isNew)
+{
+   // Linear probing from the hashed slot.
+   unsigned int slot = Hash(tuple) & mMask;
+
+   for ( ; ; slot = (slot + 1) & mMask)
+   {
+      int vertex = mSlots[slot];
+      if (vertex < 0)
+      {
+         break;
+      }
+      if (Equal(tuple, vertex))
+      {
+         isNew = false;
+         return(vertex);
+      }
+   }
+
+   // First time the vertex is encountered.
+   assert((mNumVertices + 1) * mTupleSize <= (int)mTuples.size());
+   int vertex  = mNumVertices++;
+   int *stored = &mTuples[vertex * mTupleSize];
+   for (int i = 0; i < mTupleSize; ++i)
+   {
+      stored[i] = tuple[i];
+   }
+   mSlots[slot] = vertex;
+   isNew        = true;
+   return(vertex);
+}
+
+
+//----------------------------------------------------------------------------
+unsigned int VertexWelder::Hash(const int *tuple) const
+{
+   // Multiply-rotate mixing of each index, finished with the MurmurHash3
+   // avalanche so nearby index tuples spread across the table.
+   unsigned int h = 0x9e3779b9u;
+
+   for (int i = 0; i < mTupleSize; ++i)
+   {
+      unsigned int k = (unsigned int)tuple[i] * 0xcc9e2d51u;
+      k  = (k << 15) | (k >> 17);
+      h ^= k * 0x1b873593u;
+      h  = ((h << 13) | (h >> 19)) * 5 + 0xe6546b64u;
+   }
+   h ^= h >> 16;
+   h *= 0x85ebca6bu;
+   h ^= h >> 13;
+   h *= 0xc2b2ae35u;
+   h ^= h >> 16;
+   return(h);
+}
+
+
+//----------------------------------------------------------------------------
+bool VertexWelder::Equal(const int *tuple, int vertex) const
+{
+   const int *stored = &mTuples[vertex * mTupleSize];
+
+   for (int i = 0; i < mTupleSize; ++i)
+   {
+      if (stored[i] != tuple[i])
+      {
+         return(false);
+      }
+   }
+   return(true);
+}
@@ -0,0 +1,37 @@
+// Vertex welder.
+// Open-addressing hash table mapping vertex index tuples (position,
+// normal and texture coordinate indices) to welded vertex indices.
+// The table is sized once from the number of triangle corners, so it
+// never rehashes and allocates nothing per vertex.
+
+#ifndef VERTEX_WELDER_H
+#define VERTEX_WELDER_H
+
+#include <vector>
+
+class VertexWelder
+{
+public:
+
+   // tupleSize is the number of indices per corner; maxCorners bounds the
+   // number of distinct tuples (3 * numTriangles).
+   VertexWelder(int tupleSize, int maxCorners);
+
+   // Welded index of a tuple; isNew is set when the tuple is first seen,
+   // in which case the returned index is the next unused one.
+   int Insert(const int *tuple, bool& isNew);
+
+   int GetNumVertices() const { return(mNumVertices); }
+
+private:
+
+   unsigned int Hash(const int *tuple) const;
+   bool Equal(const int *tuple, int vertex) const;
+
+   int               mTupleSize;
+   int               mNumVertices;
+   unsigned int      mMask;
+   std::vector<int>  mSlots;    // welded index, or -1 if empty
+   std::vector<int>  mTuples;   // tuples of the welded vertices
+};
+#endif
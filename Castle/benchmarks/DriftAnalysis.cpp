@@ -0,0 +1,366 @@
+// Integrator drift analysis.
+// Replays span measurements through thousands of independently seeded
+// noisy Integrators on all cores and reports, per signal-to-noise ratio
+// and measurement, the distribution of the span error: the noisy
+// Integrator's target distance less the noise-free one's.
+//
+// The measurements are read from a SpanTracker movement record (written
+// to spantracker.moves while logging), or generated as random walks of
+// SpanTracker's moves: forward/backward steps and left/right/up/down
+// turns at the default Castle rates, sampled from the same motion profiles
+// as SpanTracker's.
+//
+// Usage: DriftAnalysis [options]
+//    -r <file>        replay a movement record
+//    -m <n,n,...>     moves per generated measurement (default 10,50,200)
+//    -hz <rate>       IMU sample rate of generated moves (default 0, two
+//                     samples per move)
+//    -rest <seconds>  rest after each generated move (default 0, none)
+//    -s <r,r,...>     signal-to-noise ratios (default 1,2,5,10,20)
+//    -n <instances>   noisy Integrators per ratio (default 4000)
+//    -t <threads>     worker threads (default one per hardware thread)
+//    -seed <seed>     first Integrator seed (default 1)
+
+#include "../MovementRecord.h"
+#include "../integrator/integrator.h"
+#include "../integrator/motion_profile.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Castle's translation and rotation speeds as set up in OnInitialize.
+static const float TRN_SPEED = 2.0f;
+static const float ROT_SPEED = 0.014f;
+
+// SpanTracker's move duration.
+static const float MOVE_TIME = 1.0f;
+
+// Error histogram bins, spanning the 1st to 99th percentile.
+static const int NUM_BINS  = 20;
+static const int BAR_WIDTH = 50;
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+static std::vector<float> ParseList(const char *list)
+{
+   std::vector<float> values;
+   std::string        text(list);
+   size_t             start = 0;
+
+   while (start < text.size())
+   {
+      size_t end = text.find(',', start);
+      if (end == std::string::npos)
+      {
+         end = text.size();
+      }
+      values.push_back((float)atof(text.substr(start, end - start).c_str()));
+      start = end + 1;
+   }
+   return(values);
+}
+
+
+//----------------------------------------------------------------------------
+// Integration steps of one SpanTracker move, in device coordinates, as
+// SpanTracker::IntegrateTranslation/IntegrateRotation sample them.
+static void AddMove(int move, struct motion_profile& profile,
+                    std::vector<MovementRecord::Step>& steps)
+{
+   struct vector3d v = { 0.0f, 0.0f, 0.0f };
+
+   switch (move)
+   {
+   case 0:
+   case 1:
+      // Forward or backward.
+      v.z = (move == 0 ? TRN_SPEED : -TRN_SPEED);
+      motion_profile_translate(&profile, &v, MOVE_TIME);
+      break;
+
+   default:
+      // Turn left/right about the up axis, look up/down about the right.
+      if (move < 4)
+      {
+         v.y = (move == 2 ? ROT_SPEED : -ROT_SPEED);
+      }
+      else
+      {
+         v.x = (move == 4 ? ROT_SPEED : -ROT_SPEED);
+      }
+      motion_profile_rotate(&profile, &v, MOVE_TIME);
+      break;
+   }
+
+   struct vector3d gyr[MOTION_BATCH];
+   struct vector3d acc[MOTION_BATCH];
+   int             n;
+   while ((n = motion_profile_fill(&profile, gyr, acc, MOTION_BATCH)) > 0)
+   {
+      for (int i = 0; i < n; ++i)
+      {
+         MovementRecord::Step step;
+         memset(&step, 0, sizeof(step));
+         step.Gyr   = gyr[i];
+         step.Acc   = acc[i];
+         step.DTime = profile.dtime;
+         steps.push_back(step);
+      }
+   }
+}
+
+
+//----------------------------------------------------------------------------
+// Random walk of numMoves moves, mostly forward and backward.
+static MovementRecord::Measurement Generate(int numMoves,
+                                            struct motion_profile& profile,
+                                            std::mt19937& random)
+{
+   MovementRecord::Measurement           measurement;
+   std::uniform_int_distribution<int>    moveDist(0, 9);
+   std::uniform_real_distribution<float> distanceDist(1.0f, 10.0f);
+
+   measurement.StartDistance = distanceDist(random);
+   measurement.EndDistance   = distanceDist(random);
+   measurement.Span          = -1.0f;
+   for (int i = 0; i < numMoves; ++i)
+   {
+      int move = moveDist(random);
+      AddMove(move < 6 ? move % 2 : move - 4, profile, measurement.Steps);
+   }
+   return(measurement);
+}
+
+
+//----------------------------------------------------------------------------
+static float Replay(Integrator& integrator,
+                    const MovementRecord::Measurement& measurement,
+                    float *pathLength)
+{
+   integrator.init(0.0f, 0.0f, -measurement.StartDistance);
+   float length = 0.0f;
+   for (int i = 0; i < (int)measurement.Steps.size(); ++i)
+   {
+      MovementRecord::Step step = measurement.Steps[i];
+      struct vector3d      pos  = integrator.pos_t;
+      integrator.integrate_movement(&step.Gyr, &step.Acc,
+                                    &step.AverageStatAcc, step.DTime);
+      pos.x   = integrator.pos_t.x - pos.x;
+      pos.y   = integrator.pos_t.y - pos.y;
+      pos.z   = integrator.pos_t.z - pos.z;
+      length += vector3d_length(&pos);
+   }
+   if (pathLength != 0)
+   {
+      *pathLength = length;
+   }
+   return(integrator.get_target_distance(measurement.EndDistance));
+}
+
+
+//----------------------------------------------------------------------------
+static float Percentile(const std::vector<float>& sorted, float p)
+{
+   int i = (int)(p * (sorted.size() - 1) + 0.5f);
+
+   return(sorted[std::min(std::max(i, 0), (int)sorted.size() - 1)]);
+}
+
+
+//----------------------------------------------------------------------------
+static void Report(std::vector<float>& errors)
+{
+   std::sort(errors.begin(), errors.end());
+
+   std::vector<float> magnitudes(errors.size());
+   double             sum = 0.0, sum2 = 0.0;
+   for (int i = 0; i < (int)errors.size(); ++i)
+   {
+      magnitudes[i] = fabsf(errors[i]);
+      sum          += errors[i];
+      sum2         += (double)errors[i] * errors[i];
+   }
+   std::sort(magnitudes.begin(), magnitudes.end());
+   double mean = sum / errors.size();
+   double rms  = sqrt(sum2 / errors.size());
+   printf("   error mean %.4f, rms %.4f, min %.4f, max %.4f\n", mean, rms,
+          errors.front(), errors.back());
+   printf("   |error| percentiles: 50%% %.4f, 90%% %.4f, 95%% %.4f, "
+          "99%% %.4f, max %.4f\n", Percentile(magnitudes, 0.5f),
+          Percentile(magnitudes, 0.9f), Percentile(magnitudes, 0.95f),
+          Percentile(magnitudes, 0.99f), magnitudes.back());
+
+   // Histogram of the signed error; the outer bins hold the tails.
+   float low  = Percentile(errors, 0.01f);
+   float high = Percentile(errors, 0.99f);
+   if (high <= low)
+   {
+      return;
+   }
+   float            width = (high - low) / NUM_BINS;
+   std::vector<int> counts(NUM_BINS, 0);
+   int              maxCount = 0;
+   for (int i = 0; i < (int)errors.size(); ++i)
+   {
+      int bin = (int)((errors[i] - low) / width);
+      bin = std::min(std::max(bin, 0), NUM_BINS - 1);
+      maxCount = std::max(maxCount, ++counts[bin]);
+   }
+   for (int bin = 0; bin < NUM_BINS; ++bin)
+   {
+      int bar = (int)((long long)counts[bin] * BAR_WIDTH / maxCount);
+      printf("   %9.4f..%9.4f %6d %s\n", low + bin * width,
+             low + (bin + 1) * width, counts[bin], std::string(bar, '#').c_str());
+   }
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   const char         *recordFile = 0;
+   std::vector<float> moveCounts  = ParseList("10,50,200");
+   std::vector<float> ratios      = ParseList("1,2,5,10,20");
+   int                numInstances = 4000;
+   int                imuRate      = 0;
+   float              rest         = 0.0f;
+   int                numThreads   = (int)std::thread::hardware_concurrency();
+   unsigned long      seed         = 1;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+      {
+         recordFile = argv[++i];
+      }
+      else if ((strcmp(argv[i], "-m") == 0) && (i + 1 < argc))
+      {
+         moveCounts = ParseList(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-hz") == 0) && (i + 1 < argc))
+      {
+         imuRate = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-rest") == 0) && (i + 1 < argc))
+      {
+         rest = (float)atof(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+      {
+         ratios = ParseList(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+      {
+         numInstances = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+      {
+         numThreads = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-seed") == 0) && (i + 1 < argc))
+      {
+         seed = strtoul(argv[++i], 0, 10);
+      }
+      else
+      {
+         fprintf(stderr, "Usage: %s [-r record file] [-m moves,...] "
+                 "[-hz rate] [-rest seconds] [-s ratios,...] [-n instances] "
+                 "[-t threads] [-seed seed]\n",
+                 argv[0]);
+         return(1);
+      }
+   }
+   numInstances = std::max(numInstances, 1);
+   numThreads   = std::max(numThreads, 1);
+
+   std::vector<MovementRecord::Measurement> measurements;
+   if (recordFile != 0)
+   {
+      if (!MovementRecord::Read(recordFile, measurements))
+      {
+         fprintf(stderr, "Cannot read movement record %s\n", recordFile);
+         return(1);
+      }
+   }
+   else
+   {
+      std::mt19937          random(seed);
+      struct motion_profile profile;
+      motion_profile_init(&profile, imuRate);
+      motion_profile_rest(&profile, rest);
+      for (int i = 0; i < (int)moveCounts.size(); ++i)
+      {
+         measurements.push_back(Generate((int)moveCounts[i], profile, random));
+      }
+   }
+   if (measurements.empty())
+   {
+      fprintf(stderr, "No complete measurements\n");
+      return(1);
+   }
+
+   printf("%d measurements, %d noisy Integrators per ratio, %d threads\n",
+          (int)measurements.size(), numInstances, numThreads);
+   double startTime = Now();
+   long long numSteps = 0;
+   for (int m = 0; m < (int)measurements.size(); ++m)
+   {
+      const MovementRecord::Measurement& measurement = measurements[m];
+      Integrator clean(0.0f, 0.0f, 0.0f);
+      float      pathLength;
+      float      distance = Replay(clean, measurement, &pathLength);
+      printf("\nmeasurement %d: %d steps, path length %.2f, "
+             "noise-free distance %.4f", m + 1,
+             (int)measurement.Steps.size(), pathLength, distance);
+      if (measurement.Span >= 0.0f)
+      {
+         printf(", true span %.4f", measurement.Span);
+      }
+      printf("\n");
+
+      for (int r = 0; r < (int)ratios.size(); ++r)
+      {
+         // Instance i always gets seed + i, so runs are repeatable for any
+         // number of threads.
+         std::vector<float>       errors(numInstances);
+         std::vector<std::thread> threads;
+         for (int t = 0; t < numThreads; ++t)
+         {
+            threads.push_back(std::thread([&, t]()
+            {
+               Integrator noisy(0.0f, 0.0f, 0.0f, true, ratios[r]);
+               for (int i = t; i < numInstances; i += numThreads)
+               {
+                  noisy.seed(seed + (unsigned long)i);
+                  errors[i] = Replay(noisy, measurement, 0) - distance;
+               }
+            }));
+         }
+         for (int t = 0; t < numThreads; ++t)
+         {
+            threads[t].join();
+         }
+         numSteps += (long long)numInstances * measurement.Steps.size();
+         printf("\n  signal-to-noise ratio %g\n", ratios[r]);
+         Report(errors);
+      }
+   }
+   double time = Now() - startTime;
+   printf("\n%lld integration steps in %.0f ms (%.0f steps/s)\n", numSteps,
+          time, 1000.0 * numSteps / time);
+   return(0);
+}
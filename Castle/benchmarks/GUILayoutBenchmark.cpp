@@ -0,0 +1,198 @@
+// GUI layout benchmark.
+// Loads a GUI layout with the sxmlgui CompiledXML loader and builds a
+// GUIFrame from it, timing both from the XML file (parsed with TinyXML and
+// compiled each time) and from its compiled binary cache: best of three
+// rounds of repeated loads and builds. The GUI textures and fonts are
+// loaded into an offscreen GLX context when a display is available, and
+// are shared by every build through the TexturesManager.
+//
+// The compiled cache is also copied alone into the working directory as
+// CACHE_ONLY's binary and loaded through CACHE_ONLY, which has no XML
+// source: the load must come from the copy, with the same elements.
+//
+// Usage: GUILayoutBenchmark [repeats] [layout]
+
+#include "EasyGL.h"
+#include <GL/glx.h>
+#include <X11/Xlib.h>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+// A layout with only a compiled cache.
+static const char *CACHE_ONLY = "GUILayoutBenchmark.xml";
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// An unmapped window with a current GL context, or false without a display.
+static bool CreateContext()
+{
+   Display *display = XOpenDisplay(NULL);
+
+   if (display == NULL)
+   {
+      return(false);
+   }
+   int         attributes[] = { GLX_RGBA, GLX_DOUBLEBUFFER, None };
+   XVisualInfo *visual      = glXChooseVisual(display, DefaultScreen(display),
+                                              attributes);
+   if (visual == NULL)
+   {
+      return(false);
+   }
+   Window               root = RootWindow(display, visual->screen);
+   XSetWindowAttributes windowAttributes;
+   windowAttributes.colormap = XCreateColormap(display, root, visual->visual,
+                                               AllocNone);
+   Window     window  = XCreateWindow(display, root, 0, 0, 64, 64, 0,
+                                      visual->depth, InputOutput,
+                                      visual->visual, CWColormap,
+                                      &windowAttributes);
+   GLXContext context = glXCreateContext(display, visual, NULL, True);
+   return(context != NULL && glXMakeCurrent(display, window, context));
+}
+
+
+//----------------------------------------------------------------------------
+static bool CopyFile(const std::string& from, const std::string& to)
+{
+   FILE *in = fopen(from.c_str(), "rb");
+
+   if (in == NULL)
+   {
+      return(false);
+   }
+   FILE *out = fopen(to.c_str(), "wb");
+   if (out == NULL)
+   {
+      fclose(in);
+      return(false);
+   }
+   char   buffer[4096];
+   size_t count;
+   bool   copied = true;
+   while ((count = fread(buffer, 1, sizeof(buffer), in)) > 0)
+   {
+      copied = copied && (fwrite(buffer, 1, count, out) == count);
+   }
+   fclose(in);
+   return((fclose(out) == 0) && copied);
+}
+
+
+//----------------------------------------------------------------------------
+// Best of three rounds, in ms per load.
+static double TimeLoad(const char *layout, int repeats, int& numElements)
+{
+   double best = 1.0e30;
+
+   for (int round = 0; round < 3; ++round)
+   {
+      double t0 = Now();
+      for (int r = 0; r < repeats; ++r)
+      {
+         CompiledXML xml;
+         xml.loadFile(layout);
+         numElements = xml.getElementCount();
+      }
+      best = std::min(best, (Now() - t0) / repeats);
+   }
+   return(best);
+}
+
+
+//----------------------------------------------------------------------------
+// Best of three rounds, in ms per GUIFrame.
+static double TimeBuild(const char *layout, int repeats)
+{
+   double best = 1.0e30;
+
+   for (int round = 0; round < 3; ++round)
+   {
+      double t0 = Now();
+      for (int r = 0; r < repeats; ++r)
+      {
+         GUIFrame frame;
+         frame.GUIPanel::loadXMLSettings(layout);
+      }
+      best = std::min(best, (Now() - t0) / repeats);
+   }
+   return(best);
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   int         repeats = (argc > 1 ? atoi(argv[1]) : 200);
+   std::string path    = (argc > 2 ? argv[2] :
+                          "../GUI/resource/SpanTrackerGUILayout.xml");
+
+   repeats = std::max(repeats, 1);
+
+   // The layout's textures and fonts are found through its directory.
+   size_t      slash  = path.find_last_of("/\\");
+   std::string layout = (slash == std::string::npos ? path :
+                         path.substr(slash + 1));
+   if (slash != std::string::npos)
+   {
+      MediaPathManager::registerPath(path.substr(0, slash + 1));
+   }
+   if (!CreateContext())
+   {
+      printf("no display: GUI textures and fonts are not loaded\n");
+   }
+
+   // Warm up: load the textures and fonts, and write the binary cache.
+   {
+      GUIFrame frame;
+      if (!frame.GUIPanel::loadXMLSettings(layout.c_str()))
+      {
+         printf("%s failed to load\n", path.c_str());
+         return(1);
+      }
+   }
+
+   int numElements = 0;
+   printf("%-10s %12s %12s\n", "", "load ms", "build ms");
+   CompiledXML::setBinaryEnabled(false);
+   double xmlLoad  = TimeLoad(layout.c_str(), repeats, numElements);
+   double xmlBuild = TimeBuild(layout.c_str(), repeats);
+   printf("%-10s %12.4f %12.4f\n", "XML", xmlLoad, xmlBuild);
+   CompiledXML::setBinaryEnabled(true);
+   double binLoad  = TimeLoad(layout.c_str(), repeats, numElements);
+   double binBuild = TimeBuild(layout.c_str(), repeats);
+   printf("%-10s %12.4f %12.4f\n", "compiled", binLoad, binBuild);
+
+   // The compiled cache alone, without its XML source.
+   std::string cacheOnly = CompiledXML::getBinaryPath(CACHE_ONLY);
+   if (!CopyFile(CompiledXML::getBinaryPath(
+                    MediaPathManager::lookUpMediaPath(layout)), cacheOnly))
+   {
+      printf("cannot copy the compiled cache to %s\n", cacheOnly.c_str());
+      return(1);
+   }
+   int         numCached = 0;
+   double      cacheLoad = TimeLoad(CACHE_ONLY, repeats, numCached);
+   CompiledXML cached;
+   bool        fromCache = cached.loadFile(CACHE_ONLY) && cached.isFromBinary();
+   remove(cacheOnly.c_str());
+   printf("%-10s %12.4f\n", "cache only", cacheLoad);
+
+   printf("\n%d elements, load %.1fx, build %.1fx faster compiled\n",
+          numElements, xmlLoad / binLoad, xmlBuild / binBuild);
+   if (!fromCache || (numCached != numElements))
+   {
+      printf("cache only load FAILED: %d elements\n", numCached);
+      return(1);
+   }
+   return(0);
+}
@@ -0,0 +1,118 @@
+// Image decode benchmark.
+// Decodes a set of images with the sxmlgui Image loaders and reports the
+// decode throughput in MB of pixel data per second: per image on the
+// calling thread (best of three rounds of repeated loads), then for the
+// whole set decoded concurrently through Image::loadAsync.
+//
+// Usage: ImageDecodeBenchmark [repeats] [image ...]
+//
+// With no images it decodes the TGA and JPEG files shipped with the games.
+
+#include "TextureUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+static const char *DEFAULT_IMAGES[] =
+{
+   "../GUI/resource/ArialSmall.tga",
+   "../../Data/Images/explosion.tga",
+   "../../Data/Images/gingerman.jpg"
+};
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+static double Size(const Image& image)
+{
+   return((double)image.getWidth() * image.getHeight() *
+          image.getComponentsCount());
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   int                       repeats = (argc > 1 ? atoi(argv[1]) : 20);
+   std::vector<const char *> paths;
+
+   repeats = std::max(repeats, 1);
+   for (int i = 2; i < argc; ++i)
+   {
+      paths.push_back(argv[i]);
+   }
+   if (paths.empty())
+   {
+      paths.assign(DEFAULT_IMAGES, DEFAULT_IMAGES +
+                   sizeof(DEFAULT_IMAGES) / sizeof(DEFAULT_IMAGES[0]));
+   }
+
+   printf("%-36s %12s %10s %10s\n", "image", "size", "ms", "MB/s");
+   double totalBytes = 0.0, totalTime = 0.0;
+   for (size_t i = 0; i < paths.size(); ++i)
+   {
+      Image image;
+      if (!image.load(paths[i]))
+      {
+         printf("%-36s failed to load\n", paths[i]);
+         continue;
+      }
+      double bytes = Size(image);
+      double best  = 1.0e30;
+      for (int round = 0; round < 3; ++round)
+      {
+         double t0 = Now();
+         for (int r = 0; r < repeats; ++r)
+         {
+            image.load(paths[i]);
+         }
+         best = std::min(best, (Now() - t0) / repeats);
+      }
+      char size[32];
+      sprintf(size, "%dx%dx%d", image.getWidth(), image.getHeight(),
+              image.getComponentsCount());
+      printf("%-36s %12s %10.3f %10.1f\n", paths[i], size, best,
+             bytes / (1000.0 * best));
+      totalBytes += bytes;
+      totalTime  += best;
+   }
+   if (totalTime <= 0.0)
+   {
+      return(1);
+   }
+   printf("%-36s %12s %10.3f %10.1f\n", "serial", "", totalTime,
+          totalBytes / (1000.0 * totalTime));
+
+   // Every repeat of every image in flight at once.
+   std::vector<std::future<Image *> > pending;
+   double t0 = Now();
+   for (int r = 0; r < repeats; ++r)
+   {
+      for (size_t i = 0; i < paths.size(); ++i)
+      {
+         pending.push_back(Image::loadAsync(paths[i]));
+      }
+   }
+   double bytes = 0.0;
+   for (size_t i = 0; i < pending.size(); ++i)
+   {
+      Image *image = pending[i].get();
+      if (image != 0)
+      {
+         bytes += Size(*image);
+         delete image;
+      }
+   }
+   double time = Now() - t0;
+   printf("%-36s %12d %10.3f %10.1f\n", "loadAsync", (int)pending.size(),
+          time, bytes / (1000.0 * time));
+   return(0);
+}
@@ -0,0 +1,255 @@
+// IMU sample rate benchmark.
+// Times the motion profile generator on its own, then drives a random
+// walk of SpanTracker moves (forward/backward steps, left/right/up/down
+// turns at the default Castle rates) through Integrators at several
+// sample rates and reports, per rate, the cost (integration steps per
+// second and speed relative to real time, generation included) and the
+// accuracy: the end position error of a noise-free Integrator and the
+// rms end position error of noisy ones, against the exact path computed
+// in double precision.
+//
+// Usage: ImuRateBenchmark [moves] [noisy instances] [signal-to-noise ratio]
+
+#include "../integrator/integrator.h"
+#include "../integrator/motion_profile.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Castle's translation and rotation speeds as set up in OnInitialize, and
+// SpanTracker's move duration.
+static const float TRN_SPEED = 2.0f;
+static const float ROT_SPEED = 0.014f;
+static const float MOVE_TIME = 1.0f;
+
+// Rates compared; 0 is SpanTracker's original two samples per move.
+static const int RATES[] = { 0, 100, 200, 500, 1000 };
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// A move in device coordinates: a displacement or a rotation vector.
+struct Move
+{
+   bool            Rotating;
+   struct vector3d V;
+};
+
+//----------------------------------------------------------------------------
+static std::vector<Move> Generate(int numMoves, std::mt19937& random)
+{
+   std::uniform_int_distribution<int> moveDist(0, 9);
+   std::vector<Move>                  moves(numMoves);
+
+   for (int i = 0; i < numMoves; ++i)
+   {
+      int   move = moveDist(random);
+      Move& m    = moves[i];
+      m.V.x = m.V.y = m.V.z = 0.0f;
+      m.Rotating = (move >= 6);
+      if (!m.Rotating)
+      {
+         m.V.z = (move % 2 == 0 ? TRN_SPEED : -TRN_SPEED);
+      }
+      else if (move < 8)
+      {
+         m.V.y = (move == 6 ? ROT_SPEED : -ROT_SPEED);
+      }
+      else
+      {
+         m.V.x = (move == 8 ? ROT_SPEED : -ROT_SPEED);
+      }
+   }
+   return(moves);
+}
+
+
+//----------------------------------------------------------------------------
+// Exact end position: rotations compose as Cbi = Psi * Cbi and a body
+// displacement d moves the device by Cbi' * d.
+static void Exact(const std::vector<Move>& moves, const double start[3],
+                  double pos[3])
+{
+   double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+
+   for (int i = 0; i < 3; ++i)
+   {
+      pos[i] = start[i];
+   }
+   for (int m = 0; m < (int)moves.size(); ++m)
+   {
+      double p[3] = { moves[m].V.x, moves[m].V.y, moves[m].V.z };
+      if (!moves[m].Rotating)
+      {
+         for (int i = 0; i < 3; ++i)
+         {
+            pos[i] += C[0][i] * p[0] + C[1][i] * p[1] + C[2][i] * p[2];
+         }
+         continue;
+      }
+
+      // Psi = c*eye(3) + k*(psi*psi') - s*psi_cross
+      double n = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+      double c = cos(n), k = (1.0 - c) / (n * n), s = sin(n) / n;
+      double cross[3][3] =
+      {
+         { 0.0, -p[2], p[1] }, { p[2], 0.0, -p[0] }, { -p[1], p[0], 0.0 }
+      };
+      double Psi[3][3], D[3][3];
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            Psi[i][j] = (i == j ? c : 0.0) + k * p[i] * p[j] - s * cross[i][j];
+         }
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            D[i][j] = Psi[i][0] * C[0][j] + Psi[i][1] * C[1][j] +
+                      Psi[i][2] * C[2][j];
+         }
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            C[i][j] = D[i][j];
+         }
+      }
+   }
+}
+
+
+//----------------------------------------------------------------------------
+// Integrate the moves' samples in batches; returns the number of samples.
+static long long Run(Integrator& integrator, struct motion_profile& profile,
+                     const std::vector<Move>& moves)
+{
+   struct vector3d gyr[MOTION_BATCH];
+   struct vector3d acc[MOTION_BATCH];
+   struct vector3d stat = { 0.0f, 0.0f, 0.0f };
+   long long       numSamples = 0;
+
+   for (int m = 0; m < (int)moves.size(); ++m)
+   {
+      struct vector3d v = moves[m].V;
+      if (moves[m].Rotating)
+      {
+         motion_profile_rotate(&profile, &v, MOVE_TIME);
+      }
+      else
+      {
+         motion_profile_translate(&profile, &v, MOVE_TIME);
+      }
+      int n;
+      while ((n = motion_profile_fill(&profile, gyr, acc, MOTION_BATCH)) > 0)
+      {
+         integrator.integrate_batch(gyr, acc, &stat, profile.dtime, n);
+         numSamples += n;
+      }
+   }
+   return(numSamples);
+}
+
+
+//----------------------------------------------------------------------------
+static double Distance(const struct vector3d& a, const double b[3])
+{
+   double dx = a.x - b[0], dy = a.y - b[1], dz = a.z - b[2];
+
+   return(sqrt(dx * dx + dy * dy + dz * dz));
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   int   numMoves     = (argc > 1 ? atoi(argv[1]) : 200);
+   int   numInstances = (argc > 2 ? atoi(argv[2]) : 100);
+   float ratio        = (argc > 3 ? (float)atof(argv[3]) : 2.0f);
+
+   numMoves     = std::max(numMoves, 1);
+   numInstances = std::max(numInstances, 1);
+
+   // The generator alone, at 1 kHz.
+   struct motion_profile profile;
+   struct vector3d       gyr[MOTION_BATCH], acc[MOTION_BATCH];
+   struct vector3d       v = { 0.0f, 0.0f, TRN_SPEED };
+   long long             numSamples = 0;
+   volatile float        sink;
+   motion_profile_init(&profile, 1000);
+   double t0 = Now();
+   for (int m = 0; m < 20000; ++m)
+   {
+      if (m % 2 == 0)
+      {
+         motion_profile_translate(&profile, &v, MOVE_TIME);
+      }
+      else
+      {
+         motion_profile_rotate(&profile, &v, MOVE_TIME);
+      }
+      int n;
+      while ((n = motion_profile_fill(&profile, gyr, acc, MOTION_BATCH)) > 0)
+      {
+         numSamples += n;
+         sink        = acc[n - 1].z + gyr[n - 1].z;
+      }
+   }
+   double time = Now() - t0;
+   (void)sink;
+   printf("generator: %.0f samples/s at 1 kHz (%.0fx real time)\n",
+          1000.0 * numSamples / time, numSamples / time);
+
+   std::mt19937      random(1);
+   std::vector<Move> moves = Generate(numMoves, random);
+   double            start[3] = { 0.0, 0.0, -5.0 }, exact[3];
+   Exact(moves, start, exact);
+   printf("%d moves, %d noisy Integrators, signal-to-noise ratio %g\n\n",
+          numMoves, numInstances, ratio);
+   printf("%6s %10s %14s %12s %14s %14s\n", "rate", "samples", "steps/s",
+          "x real time", "clean error", "noisy rms");
+   for (size_t r = 0; r < sizeof(RATES) / sizeof(RATES[0]); ++r)
+   {
+      motion_profile_init(&profile, RATES[r]);
+
+      // Noise-free, timed; best of three.
+      Integrator clean(0.0f, 0.0f, (float)start[2]);
+      double     best = 1.0e30;
+      for (int run = 0; run < 3; ++run)
+      {
+         clean.init(0.0f, 0.0f, (float)start[2]);
+         t0         = Now();
+         numSamples = Run(clean, profile, moves);
+         best       = std::min(best, Now() - t0);
+      }
+      double cleanError = Distance(clean.pos_t, exact);
+
+      double sum2 = 0.0;
+      for (int i = 0; i < numInstances; ++i)
+      {
+         Integrator noisy(0.0f, 0.0f, (float)start[2], true, ratio);
+         noisy.seed((unsigned long)(i + 1));
+         Run(noisy, profile, moves);
+         double e = Distance(noisy.pos_t, exact);
+         sum2 += e * e;
+      }
+      double simulated = numMoves * MOVE_TIME;
+      printf("%6d %10lld %14.0f %12.0f %14.6f %14.4f\n", RATES[r], numSamples,
+             1000.0 * numSamples / best, 1000.0 * simulated / best,
+             cleanError, sqrt(sum2 / numInstances));
+   }
+   return(0);
+}
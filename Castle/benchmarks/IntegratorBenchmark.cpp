@@ -0,0 +1,306 @@
+// Integrator benchmark.
+// Steps the fixed-size Integrator and the original struct matrix version
+// of integrate_movement (kept here as the reference) through the same
+// generated gyroscope/accelerometer sequence, and reports integration
+// steps per second for each and the largest difference between them.
+// Both are also timed with sensor noise added: the original way, with a
+// random engine seeded from rand() and six normal distributions per step,
+// and with the Integrator's own block noise generator. A last run traces
+// every step to a TraceLog.
+//
+// Tolerance: the two versions round differently (the old one loses most
+// of 1-cos to cancellation for small angles), so both are also checked
+// against a double precision integration of the orientation. The new
+// orientation must stay within TOLERANCE of the old one and be no further
+// from the double precision one; the benchmark fails otherwise.
+//
+// Usage: IntegratorBenchmark [steps]
+
+#include "../integrator/integrator.h"
+#include "../integrator/matrix.h"
+#include "../integrator/PSI.h"
+#include "../TraceLog.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Largest allowed difference of an orientation matrix element.
+static const double TOLERANCE = 1.0e-3;
+
+// Signal-to-noise ratio of the noisy runs.
+static const float SIGNAL_NOISE_RATIO = 5.0f;
+
+// The original integration step, without logging.
+struct ReferenceIntegrator
+{
+   bool            noisy;
+   struct vector3d vel_t;
+   struct vector3d pos_t;
+   struct matrix   *Cbi;
+   struct matrix   *psi;
+   struct matrix   *Psi;
+   struct matrix   *mwork3x3;
+   struct matrix   *mwork3x1a;
+   struct matrix   *mwork3x1b;
+
+   ReferenceIntegrator(float x, float y, float z, bool noisy = false)
+   {
+      this->noisy = noisy;
+      vel_t.x     = vel_t.y = vel_t.z = 0.0f;
+      pos_t.x   = x;
+      pos_t.y   = y;
+      pos_t.z   = z;
+      Cbi       = matrix_identity_alloc(3);
+      psi       = matrix_alloc(1, 3);
+      Psi       = matrix_alloc(3, 3);
+      mwork3x3  = matrix_alloc(3, 3);
+      mwork3x1a = matrix_alloc(3, 1);
+      mwork3x1b = matrix_alloc(3, 1);
+   }
+
+   ~ReferenceIntegrator()
+   {
+      matrix_free(Cbi);
+      matrix_free(psi);
+      matrix_free(Psi);
+      matrix_free(mwork3x3);
+      matrix_free(mwork3x1a);
+      matrix_free(mwork3x1b);
+   }
+
+   static float add_noise(float signal, std::default_random_engine& generator)
+   {
+      if (signal == 0.0f)
+      {
+         return(0.0f);
+      }
+      float sign = (signal < 0.0f ? -1.0f : 1.0f);
+      float u    = signal * sign;
+      std::normal_distribution<float> signal_dist(u, u / SIGNAL_NOISE_RATIO);
+      return(signal_dist(generator) * sign);
+   }
+
+   void integrate_movement(struct vector3d *gyr_in, struct vector3d *acc_in,
+                           struct vector3d *average_stat_acc, float dtime)
+   {
+      struct vector3d gyr_work = *gyr_in, acc_work = *acc_in;
+      struct vector3d *gyr = &gyr_work, *acc = &acc_work;
+      if (noisy)
+      {
+         std::default_random_engine generator;
+         generator.seed((unsigned long)rand());
+         gyr->x = add_noise(gyr_in->x, generator);
+         gyr->y = add_noise(gyr_in->y, generator);
+         gyr->z = add_noise(gyr_in->z, generator);
+         acc->x = add_noise(acc_in->x, generator);
+         acc->y = add_noise(acc_in->y, generator);
+         acc->z = add_noise(acc_in->z, generator);
+      }
+
+      psi->e[0] = gyr->x * dtime;
+      psi->e[1] = gyr->y * dtime;
+      psi->e[2] = gyr->z * dtime;
+      PSI(psi, Psi);
+      matrix_multiply(Psi, Cbi, mwork3x3);
+      matrix_copy(mwork3x3, Cbi);
+
+      struct vector3d acc_t;
+      matrix_transpose(Cbi, mwork3x3);
+      mwork3x1a->e[0] = acc->x;
+      mwork3x1a->e[1] = acc->y;
+      mwork3x1a->e[2] = acc->z;
+      matrix_multiply(mwork3x3, mwork3x1a, mwork3x1b);
+      acc_t.x = mwork3x1b->e[0] - average_stat_acc->x;
+      acc_t.y = mwork3x1b->e[1] - average_stat_acc->y;
+      acc_t.z = mwork3x1b->e[2] - average_stat_acc->z;
+
+      pos_t.x = pos_t.x + (vel_t.x + (acc_t.x * dtime * 0.5f)) * dtime;
+      pos_t.y = pos_t.y + (vel_t.y + (acc_t.y * dtime * 0.5f)) * dtime;
+      pos_t.z = pos_t.z + (vel_t.z + (acc_t.z * dtime * 0.5f)) * dtime;
+      vel_t.x = vel_t.x * Integrator::eta + acc_t.x * dtime;
+      vel_t.y = vel_t.y * Integrator::eta + acc_t.y * dtime;
+      vel_t.z = vel_t.z * Integrator::eta + acc_t.z * dtime;
+   }
+};
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// C = Psi * C in double precision.
+static void Rotate(double C[3][3], const struct vector3d& psi)
+{
+   double p[3] = { psi.x, psi.y, psi.z };
+   double n    = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+
+   if (n < 1e-12)
+   {
+      return;
+   }
+   double c = cos(n), k = (1.0 - c) / (n * n), s = sin(n) / n;
+   double cross[3][3] =
+   {
+      {  0.0, -p[2], p[1] },
+      {  p[2],  0.0, -p[0] },
+      { -p[1],  p[0], 0.0 }
+   };
+   double Psi[3][3], R[3][3];
+   int    i, j;
+   for (i = 0; i < 3; ++i)
+   {
+      for (j = 0; j < 3; ++j)
+      {
+         Psi[i][j] = (i == j ? c : 0.0) + p[i] * p[j] * k - cross[i][j] * s;
+      }
+   }
+   for (i = 0; i < 3; ++i)
+   {
+      for (j = 0; j < 3; ++j)
+      {
+         R[i][j] = Psi[i][0] * C[0][j] + Psi[i][1] * C[1][j] +
+                   Psi[i][2] * C[2][j];
+      }
+   }
+   memcpy(C, R, sizeof(R));
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   int numSteps = (argc > 1 ? atoi(argv[1]) : 1000000);
+
+   if (numSteps < 1)
+   {
+      numSteps = 1;
+   }
+
+   // Slowly turning and accelerating device, 100 samples per second.
+   const float          dtime = 0.01f;
+   std::vector<vector3d> gyr(numSteps), acc(numSteps);
+   for (int i = 0; i < numSteps; ++i)
+   {
+      float t = i * dtime;
+      gyr[i].x = 0.3f * sinf(0.7f * t);
+      gyr[i].y = 0.2f * cosf(0.3f * t);
+      gyr[i].z = 0.1f * sinf(1.1f * t + 0.5f);
+      acc[i].x = 0.5f * cosf(0.9f * t);
+      acc[i].y = 0.4f * sinf(0.4f * t);
+      acc[i].z = 0.3f * cosf(1.3f * t + 1.0f);
+   }
+   struct vector3d stat;
+   stat.x = stat.y = stat.z = 0.0f;
+
+   // Step both side by side and compare.
+   ReferenceIntegrator reference(0.0f, 0.0f, -10.0f);
+   Integrator          integrator(0.0f, 0.0f, -10.0f);
+   double              exact[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+   double              maxDiff = 0.0, referenceError = 0.0, integratorError = 0.0;
+   double              maxPosDiff = 0.0;
+   int                 numChecked = std::min(numSteps, 100000);
+   for (int i = 0; i < numChecked; ++i)
+   {
+      reference.integrate_movement(&gyr[i], &acc[i], &stat, dtime);
+      integrator.integrate_movement(&gyr[i], &acc[i], &stat, dtime);
+      struct vector3d psi;
+      psi.x = gyr[i].x * dtime;
+      psi.y = gyr[i].y * dtime;
+      psi.z = gyr[i].z * dtime;
+      Rotate(exact, psi);
+      for (int j = 0; j < 9; ++j)
+      {
+         double a = reference.Cbi->e[j];
+         double b = integrator.Cbi.e[j / 3][j % 3];
+         double e = exact[j / 3][j % 3];
+         maxDiff         = std::max(maxDiff, fabs(a - b));
+         referenceError  = std::max(referenceError, fabs(a - e));
+         integratorError = std::max(integratorError, fabs(b - e));
+      }
+      double dx = reference.pos_t.x - integrator.pos_t.x;
+      double dy = reference.pos_t.y - integrator.pos_t.y;
+      double dz = reference.pos_t.z - integrator.pos_t.z;
+      double d  = vector3d_length(&reference.pos_t);
+      maxPosDiff = std::max(maxPosDiff,
+                            sqrt(dx * dx + dy * dy + dz * dz) / std::max(1.0, d));
+   }
+   bool pass = (maxDiff <= TOLERANCE) && (integratorError <= referenceError);
+   printf("%d steps compared\n", numChecked);
+   printf("largest orientation difference %g (tolerance %g)\n", maxDiff,
+          TOLERANCE);
+   printf("largest orientation error: matrix %g, matrix3 %g\n",
+          referenceError, integratorError);
+   printf("largest relative position difference %g\n", maxPosDiff);
+
+   TraceLog trace;
+   double   times[5];
+   float    endPosition[5][3];
+   for (int run = 0; run < 5; ++run)
+   {
+      bool noisy = (run % 2 == 1);
+      if (run < 2)
+      {
+         ReferenceIntegrator timed(0.0f, 0.0f, -10.0f, noisy);
+         double              t0 = Now();
+         for (int i = 0; i < numSteps; ++i)
+         {
+            timed.integrate_movement(&gyr[i], &acc[i], &stat, dtime);
+         }
+         times[run]          = Now() - t0;
+         endPosition[run][0] = timed.pos_t.x;
+         endPosition[run][1] = timed.pos_t.y;
+         endPosition[run][2] = timed.pos_t.z;
+      }
+      else
+      {
+         Integrator timed(0.0f, 0.0f, -10.0f, noisy, SIGNAL_NOISE_RATIO);
+         timed.seed(1);
+         if (run == 4)
+         {
+            trace.Open("IntegratorBenchmark.trace");
+            timed.trace = &trace;
+         }
+         double     t0 = Now();
+         for (int i = 0; i < numSteps; ++i)
+         {
+            timed.integrate_movement(&gyr[i], &acc[i], &stat, dtime);
+         }
+         times[run]          = Now() - t0;
+         endPosition[run][0] = timed.pos_t.x;
+         endPosition[run][1] = timed.pos_t.y;
+         endPosition[run][2] = timed.pos_t.z;
+      }
+   }
+
+   // Print the end points so the loops are not optimized away.
+   static const char *names[5] =
+   {
+      "matrix", "matrix noisy", "matrix3", "matrix3 noisy", "matrix3 traced"
+   };
+   printf("%-14s %14s %36s\n", "", "steps/s", "end position");
+   for (int run = 0; run < 5; ++run)
+   {
+      printf("%-14s %14.0f %12.2f %11.2f %11.2f\n", names[run],
+             1000.0 * numSteps / times[run], endPosition[run][0],
+             endPosition[run][1], endPosition[run][2]);
+   }
+   trace.Close();
+   remove("IntegratorBenchmark.trace");
+   printf("traced %d steps, %.0f records dropped\n", numSteps,
+          (double)trace.GetNumDropped());
+
+   if (!pass)
+   {
+      printf("FAILED\n");
+   }
+   return(pass ? 0 : 1);
+}
@@ -0,0 +1,284 @@
+// Kalman filter integrator benchmark.
+// Drives a random walk of SpanTracker moves (forward/backward steps,
+// left/right/up/down turns at the default Castle rates), each followed by
+// a rest with the device held still, through Integrators and
+// KalmanIntegrators and compares them: the cost per integration step, and
+// at several sample rates, with and without rests, the end position error
+// of noise-free instances and the rms end position error of noisy ones
+// against the exact path computed in double precision. Noisy instance i
+// of each kind is seeded alike, so both see the same sensor noise.
+//
+// Usage: KalmanBenchmark [moves] [noisy instances] [signal-to-noise ratio]
+//                        [rest seconds]
+
+#include "../integrator/integrator.h"
+#include "../integrator/kalman_integrator.h"
+#include "../integrator/motion_profile.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Castle's translation and rotation speeds as set up in OnInitialize, and
+// SpanTracker's move duration.
+static const float TRN_SPEED = 2.0f;
+static const float ROT_SPEED = 0.014f;
+static const float MOVE_TIME = 1.0f;
+
+// Rates compared; 0 is SpanTracker's original two samples per move.
+static const int RATES[] = { 0, 100, 1000 };
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// A move in device coordinates: a displacement or a rotation vector.
+struct Move
+{
+   bool            Rotating;
+   struct vector3d V;
+};
+
+//----------------------------------------------------------------------------
+static std::vector<Move> Generate(int numMoves, std::mt19937& random)
+{
+   std::uniform_int_distribution<int> moveDist(0, 9);
+   std::vector<Move>                  moves(numMoves);
+
+   for (int i = 0; i < numMoves; ++i)
+   {
+      int   move = moveDist(random);
+      Move& m    = moves[i];
+      m.V.x = m.V.y = m.V.z = 0.0f;
+      m.Rotating = (move >= 6);
+      if (!m.Rotating)
+      {
+         m.V.z = (move % 2 == 0 ? TRN_SPEED : -TRN_SPEED);
+      }
+      else if (move < 8)
+      {
+         m.V.y = (move == 6 ? ROT_SPEED : -ROT_SPEED);
+      }
+      else
+      {
+         m.V.x = (move == 8 ? ROT_SPEED : -ROT_SPEED);
+      }
+   }
+   return(moves);
+}
+
+
+//----------------------------------------------------------------------------
+// Exact end position: rotations compose as Cbi = Psi * Cbi and a body
+// displacement d moves the device by Cbi' * d. Rests do not move it.
+static void Exact(const std::vector<Move>& moves, const double start[3],
+                  double pos[3])
+{
+   double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+
+   for (int i = 0; i < 3; ++i)
+   {
+      pos[i] = start[i];
+   }
+   for (int m = 0; m < (int)moves.size(); ++m)
+   {
+      double p[3] = { moves[m].V.x, moves[m].V.y, moves[m].V.z };
+      if (!moves[m].Rotating)
+      {
+         for (int i = 0; i < 3; ++i)
+         {
+            pos[i] += C[0][i] * p[0] + C[1][i] * p[1] + C[2][i] * p[2];
+         }
+         continue;
+      }
+
+      // Psi = c*eye(3) + k*(psi*psi') - s*psi_cross
+      double n = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+      double c = cos(n), k = (1.0 - c) / (n * n), s = sin(n) / n;
+      double cross[3][3] =
+      {
+         { 0.0, -p[2], p[1] }, { p[2], 0.0, -p[0] }, { -p[1], p[0], 0.0 }
+      };
+      double Psi[3][3], D[3][3];
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            Psi[i][j] = (i == j ? c : 0.0) + k * p[i] * p[j] - s * cross[i][j];
+         }
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            D[i][j] = Psi[i][0] * C[0][j] + Psi[i][1] * C[1][j] +
+                      Psi[i][2] * C[2][j];
+         }
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+         for (int j = 0; j < 3; ++j)
+         {
+            C[i][j] = D[i][j];
+         }
+      }
+   }
+}
+
+
+//----------------------------------------------------------------------------
+// Integrate the moves' samples in batches; returns the number of samples.
+static long long Run(Integrator& integrator, struct motion_profile& profile,
+                     const std::vector<Move>& moves)
+{
+   struct vector3d gyr[MOTION_BATCH];
+   struct vector3d acc[MOTION_BATCH];
+   struct vector3d stat = { 0.0f, 0.0f, 0.0f };
+   long long       numSamples = 0;
+
+   for (int m = 0; m < (int)moves.size(); ++m)
+   {
+      struct vector3d v = moves[m].V;
+      if (moves[m].Rotating)
+      {
+         motion_profile_rotate(&profile, &v, MOVE_TIME);
+      }
+      else
+      {
+         motion_profile_translate(&profile, &v, MOVE_TIME);
+      }
+      int n;
+      while ((n = motion_profile_fill(&profile, gyr, acc, MOTION_BATCH)) > 0)
+      {
+         integrator.integrate_batch(gyr, acc, &stat, profile.dtime, n);
+         numSamples += n;
+      }
+   }
+   return(numSamples);
+}
+
+
+//----------------------------------------------------------------------------
+static double Distance(const struct vector3d& a, const double b[3])
+{
+   double dx = a.x - b[0], dy = a.y - b[1], dz = a.z - b[2];
+
+   return(sqrt(dx * dx + dy * dy + dz * dz));
+}
+
+
+//----------------------------------------------------------------------------
+// Best of three runs, in integration steps per second.
+static double Time(Integrator& integrator, struct motion_profile& profile,
+                   const std::vector<Move>& moves, const double start[3])
+{
+   double    best       = 1.0e30;
+   long long numSamples = 0;
+
+   for (int run = 0; run < 3; ++run)
+   {
+      integrator.init((float)start[0], (float)start[1], (float)start[2]);
+      integrator.seed(1);
+      double t0 = Now();
+      numSamples = Run(integrator, profile, moves);
+      best       = std::min(best, Now() - t0);
+   }
+   return(1000.0 * numSamples / best);
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   int   numMoves     = (argc > 1 ? atoi(argv[1]) : 200);
+   int   numInstances = (argc > 2 ? atoi(argv[2]) : 100);
+   float ratio        = (argc > 3 ? (float)atof(argv[3]) : 2.0f);
+   float rest         = (argc > 4 ? (float)atof(argv[4]) : 0.5f);
+
+   numMoves     = std::max(numMoves, 1);
+   numInstances = std::max(numInstances, 1);
+
+   std::mt19937      random(1);
+   std::vector<Move> moves = Generate(numMoves, random);
+   double            start[3] = { 0.0, 0.0, -5.0 }, exact[3];
+   Exact(moves, start, exact);
+   printf("%d moves, %gs rests, %d noisy instances, signal-to-noise ratio %g\n\n",
+          numMoves, rest, numInstances, ratio);
+
+   // Cost per step at 1 kHz.
+   struct motion_profile profile;
+   motion_profile_init(&profile, 1000);
+   motion_profile_rest(&profile, rest);
+   Integrator       integrator(0.0f, 0.0f, (float)start[2]);
+   Integrator       integratorNoisy(0.0f, 0.0f, (float)start[2], true, ratio);
+   KalmanIntegrator kalman(0.0f, 0.0f, (float)start[2]);
+   KalmanIntegrator kalmanNoisy(0.0f, 0.0f, (float)start[2], true, ratio);
+   struct
+   {
+      const char *Name;
+      Integrator *Instance;
+   }
+   timed[] =
+   {
+      { "Integrator", &integrator },
+      { "Integrator noisy", &integratorNoisy },
+      { "KalmanIntegrator", &kalman },
+      { "KalmanIntegrator noisy", &kalmanNoisy }
+   };
+   printf("%-24s %14s %10s\n", "1 kHz", "steps/s", "ns/step");
+   for (size_t i = 0; i < sizeof(timed) / sizeof(timed[0]); ++i)
+   {
+      double rate = Time(*timed[i].Instance, profile, moves, start);
+      printf("%-24s %14.0f %10.1f\n", timed[i].Name, rate, 1.0e9 / rate);
+   }
+
+   // Accuracy.
+   printf("\n%6s %6s %12s %12s %12s %12s %10s %10s\n", "rate", "rest",
+          "clean DR", "clean KF", "noisy DR", "noisy KF", "KF/DR", "updates");
+   for (size_t r = 0; r < sizeof(RATES) / sizeof(RATES[0]); ++r)
+   {
+      for (int resting = 0; resting < 2; ++resting)
+      {
+         float restTime = (resting ? rest : 0.0f);
+         motion_profile_init(&profile, RATES[r]);
+         motion_profile_rest(&profile, restTime);
+
+         Integrator       clean(0.0f, 0.0f, (float)start[2]);
+         KalmanIntegrator cleanKalman(0.0f, 0.0f, (float)start[2]);
+         Run(clean, profile, moves);
+         Run(cleanKalman, profile, moves);
+
+         double sum2 = 0.0, sum2Kalman = 0.0;
+         long   numUpdates = 0;
+         for (int i = 0; i < numInstances; ++i)
+         {
+            Integrator       noisy(0.0f, 0.0f, (float)start[2], true, ratio);
+            KalmanIntegrator noisyKalman(0.0f, 0.0f, (float)start[2], true, ratio);
+            noisy.seed((unsigned long)(i + 1));
+            noisyKalman.seed((unsigned long)(i + 1));
+            Run(noisy, profile, moves);
+            Run(noisyKalman, profile, moves);
+            double e = Distance(noisy.pos_t, exact);
+            sum2 += e * e;
+            e           = Distance(noisyKalman.pos_t, exact);
+            sum2Kalman += e * e;
+            numUpdates += noisyKalman.num_updates;
+         }
+         double rms       = sqrt(sum2 / numInstances);
+         double rmsKalman = sqrt(sum2Kalman / numInstances);
+         printf("%6d %6.2f %12.6f %12.6f %12.4f %12.4f %10.3f %10ld\n",
+                RATES[r], restTime, Distance(clean.pos_t, exact),
+                Distance(cleanKalman.pos_t, exact), rms, rmsKalman,
+                rmsKalman / rms, numUpdates / numInstances);
+      }
+   }
+   return(0);
+}
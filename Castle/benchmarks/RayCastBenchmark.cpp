@@ -0,0 +1,241 @@
+// Ray casting benchmark.
+// Builds a TriangleBVH over the shipped Castle geometry, checks it against
+// a brute-force test of every triangle, and reports rays per second for
+// both. (The comparison with WM5's Picker over the live scene is in the
+// demo itself: press 'p'.)
+//
+// Usage: RayCastBenchmark [geometry directory] [rays]
+
+#include "../MeshData.h"
+#include "../TriangleBVH.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+// Geometry files and their layout, as loaded by Castle.
+struct GeometryFile
+{
+   const char *Name;
+   int        NumTCoords;
+   bool       Multi;
+};
+
+static const GeometryFile FILES[] =
+{
+   { "Barrel01.txt",          1, false },
+   { "BarrelRack01.txt",      1, false },
+   { "BarrelRack03.txt",      1, false },
+   { "Bench01.txt",           1, false },
+   { "Box01.txt",             1, false },
+   { "Bridge.txt",            1, false },
+   { "Bunk01.txt",            1, true  },
+   { "CeilingLight01.txt",    1, true  },
+   { "ChestBottom01.txt",     1, false },
+   { "ChestTop01.txt",        1, false },
+   { "Cylinder02.txt",        1, true  },
+   { "Cylinder02NCL.txt",     1, false },
+   { "Cylinder03.txt",        1, false },
+   { "Door.txt",              1, false },
+   { "DoorFrame01.txt",       1, false },
+   { "DrawBridge.txt",        1, false },
+   { "Exterior.txt",          1, true  },
+   { "FrontHall.txt",         1, true  },
+   { "FrontRamp.txt",         1, true  },
+   { "LargePort.txt",         1, false },
+   { "MainGate.txt",          1, false },
+   { "MainGate01.txt",        1, false },
+   { "Mug.txt",               1, false },
+   { "QuadPatch01.txt",       1, false },
+   { "Rope.txt",              1, false },
+   { "SimpleChair01.txt",     1, false },
+   { "SkyDome.txt",           1, false },
+   { "SmallPort.txt",         1, false },
+   { "Sphere01.txt",          1, true  },
+   { "SquareTable01.txt",     1, false },
+   { "Table01.txt",           1, false },
+   { "Terrain.txt",           1, true  },
+   { "Tube01.txt",            1, false },
+   { "Wall01.txt",            1, false },
+   { "Wall02.txt",            1, false },
+   { "WallTurret01.txt",      1, false },
+   { "WallTurret02.txt",      1, false },
+   { "Water.txt",             2, false },
+   { "Water2.txt",            1, false },
+   { "WoodShield01.txt",      1, false }
+};
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// Closest hit by testing every triangle.
+static bool BruteForce(const std::vector<float>& triangles,
+                       const float origin[3], const float dir[3],
+                       TriangleBVH::Hit& hit)
+{
+   int numTriangles = (int)triangles.size() / 9;
+   hit.Triangle = -1;
+   hit.T        = 1.0e30f;
+   for (int t = 0; t < numTriangles; ++t)
+   {
+      const float *v = &triangles[9 * t];
+      float       e1[3], e2[3], s[3], p[3], q[3];
+      for (int i = 0; i < 3; ++i)
+      {
+         e1[i] = v[3 + i] - v[i];
+         e2[i] = v[6 + i] - v[i];
+         s[i]  = origin[i] - v[i];
+      }
+      p[0] = dir[1] * e2[2] - dir[2] * e2[1];
+      p[1] = dir[2] * e2[0] - dir[0] * e2[2];
+      p[2] = dir[0] * e2[1] - dir[1] * e2[0];
+      float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+      if (det == 0.0f)
+      {
+         continue;
+      }
+      float inv = 1.0f / det;
+      float u   = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv;
+      q[0] = s[1] * e1[2] - s[2] * e1[1];
+      q[1] = s[2] * e1[0] - s[0] * e1[2];
+      q[2] = s[0] * e1[1] - s[1] * e1[0];
+      float w  = (dir[0] * q[0] + dir[1] * q[1] + dir[2] * q[2]) * inv;
+      float tt = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv;
+      if ((u >= 0.0f) && (w >= 0.0f) && (u + w <= 1.0f) && (tt >= 0.0f) &&
+          (tt < hit.T))
+      {
+         hit.T        = tt;
+         hit.Triangle = t;
+      }
+   }
+   return(hit.Triangle >= 0);
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   std::string dir     = (argc > 1 ? argv[1] : "../Geometry");
+   int         numRays = (argc > 2 ? atoi(argv[2]) : 1000000);
+
+   if (dir[dir.size() - 1] != '/')
+   {
+      dir += "/";
+   }
+   if (numRays < 1)
+   {
+      numRays = 1;
+   }
+
+   // All triangles of all files, in their own model spaces.
+   std::vector<float> triangles;
+   for (size_t f = 0; f < sizeof(FILES) / sizeof(FILES[0]); ++f)
+   {
+      const GeometryFile& file = FILES[f];
+      MeshData            data;
+      if (!data.LoadText(dir + file.Name, file.NumTCoords, file.Multi))
+      {
+         fprintf(stderr, "Cannot read %s%s\n", dir.c_str(), file.Name);
+         return(1);
+      }
+      int stride = data.GetVertexSize() / (int)sizeof(float);
+      for (int m = 0; m < data.GetNumMeshes(); ++m)
+      {
+         const int *indices = data.GetIndices(m);
+         for (int i = 0; i < data.GetNumIndices(m); ++i)
+         {
+            const float *v = data.GetVertices() + stride * indices[i];
+            triangles.insert(triangles.end(), v, v + 3);
+         }
+      }
+   }
+
+   double      t0 = Now();
+   TriangleBVH bvh;
+   bvh.Build(triangles);
+   double buildTime = Now() - t0;
+   printf("%d triangles, %d nodes, %d leaves, built in %.1f ms\n",
+          bvh.GetNumTriangles(), bvh.GetNumNodes(), bvh.GetNumLeaves(),
+          buildTime);
+
+   // Rays from random points of the scene box in random directions.
+   float min[3] = { 1.0e30f, 1.0e30f, 1.0e30f };
+   float max[3] = { -1.0e30f, -1.0e30f, -1.0e30f };
+   for (size_t i = 0; i < triangles.size(); ++i)
+   {
+      min[i % 3] = std::min(min[i % 3], triangles[i]);
+      max[i % 3] = std::max(max[i % 3], triangles[i]);
+   }
+   std::mt19937                          rng(12345);
+   std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+   std::normal_distribution<float>       gauss;
+   std::vector<float>                    rays(6 * numRays);
+   for (int r = 0; r < numRays; ++r)
+   {
+      float *ray = &rays[6 * r];
+      float len  = 0.0f;
+      for (int i = 0; i < 3; ++i)
+      {
+         ray[i]     = min[i] + unit(rng) * (max[i] - min[i]);
+         ray[3 + i] = gauss(rng);
+         len       += ray[3 + i] * ray[3 + i];
+      }
+      len = sqrtf(len);
+      for (int i = 3; i < 6; ++i)
+      {
+         ray[i] /= len;
+      }
+   }
+
+   // The BVH must agree with brute force.
+   int                           numChecked = std::min(numRays, 2000);
+   std::vector<TriangleBVH::Hit> expected(numChecked);
+   std::vector<char>             hitExpected(numChecked);
+   t0 = Now();
+   for (int r = 0; r < numChecked; ++r)
+   {
+      hitExpected[r] = BruteForce(triangles, &rays[6 * r], &rays[6 * r + 3],
+                                  expected[r]);
+   }
+   double bruteTime = Now() - t0;
+   int    numHits = 0, numWrong = 0;
+   for (int r = 0; r < numChecked; ++r)
+   {
+      TriangleBVH::Hit actual;
+      bool hitActual = bvh.RayCast(&rays[6 * r], &rays[6 * r + 3], 1.0e30f,
+                                   actual);
+      numHits += (hitActual ? 1 : 0);
+      if ((hitExpected[r] != hitActual) ||
+          (hitActual && (fabsf(expected[r].T - actual.T) >
+                         1.0e-4f * std::max(1.0f, expected[r].T))))
+      {
+         ++numWrong;
+      }
+   }
+   printf("%d rays checked against brute force, %d hits, %d mismatches\n",
+          numChecked, numHits, numWrong);
+
+   t0 = Now();
+   numHits = 0;
+   for (int r = 0; r < numRays; ++r)
+   {
+      TriangleBVH::Hit hit;
+      numHits += (bvh.RayCast(&rays[6 * r], &rays[6 * r + 3], 1.0e30f, hit) ?
+                  1 : 0);
+   }
+   double bvhTime = Now() - t0;
+   printf("%-12s %14s\n", "", "rays/s");
+   printf("%-12s %14.0f\n", "brute force", 1000.0 * numChecked / bruteTime);
+   printf("%-12s %14.0f\n", "bvh", 1000.0 * numRays / bvhTime);
+   return(numWrong == 0 ? 0 : 1);
+}
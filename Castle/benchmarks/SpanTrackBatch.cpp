@@ -0,0 +1,833 @@
+// SpanTracker batch measurement.
+// Runs the Castle demo's automatic measurement ('a', AutoSpanTrack)
+// without the scene, renderer or GUI, against a collision geometry
+// snapshot saved by the demo ('g', castle.collision), on all cores.
+//
+// A trial places the device, tracks the start target straight ahead,
+// makes moves as AutoSpanTrack does (0 to 10 of forward, backward, turn
+// left/right, look up/down), and tracks the end target. Moves go through
+// the same collision fan and vertical adjustment as in Castle, and the
+// same integration steps as in SpanTracker, into a noise-free and a noisy
+// Integrator and a noisy KalmanIntegrator. Each trial writes the true span
+// (SpanTracker::GetDistance, from the picked target points) next to the
+// integrated spans.
+//
+// Devices are placed at random within a radius of the saved camera, on
+// the first surface below the camera height, or at scripted poses.
+//
+// Usage: SpanTrackBatch [options]
+//    -g <file>        collision geometry (default ../castle.collision)
+//    -p <file>        scripted poses, one trial per line:
+//                        x y z yaw pitch [moves]
+//                     with yaw and pitch in radians from the saved camera
+//                     direction and moves a string of F (forward),
+//                     B (backward), L, R (turn left/right), U, D (look
+//                     up/down); random moves if there are none
+//    -n <trials>      random-pose trials (default 10000)
+//    -radius <r>      random poses within r of the saved camera (default 100)
+//    -s <ratio>       noisy Integrator signal-to-noise ratio (default 2)
+//    -hz <rate>       IMU sample rate (default 0, two samples per move)
+//    -rest <seconds>  rest after each move (default 0, none, as SpanTracker)
+//    -o <file>        trial results (default spantrack.trials)
+//    -r <file>        also append the measurements to a movement record
+//    -t <threads>     worker threads (default one per hardware thread)
+//    -seed <seed>     first trial seed (default 1)
+//
+// Results have one line per completed trial:
+//    trial x y z yaw pitch moves start end span integrated noisy kalman
+// where moves lists the moves made, lower case for those blocked by the
+// collision fan, start and end are the device to target distances, span
+// is the true span and integrated, noisy and kalman the integrators'
+// spans. The noisy integrators of a trial are seeded alike, so they see
+// the same sensor noise.
+
+#include "../CollisionGeometry.h"
+#include "../MovementRecord.h"
+#include "../TriangleBVH.h"
+#include "../integrator/integrator.h"
+#include "../integrator/kalman_integrator.h"
+#include "../integrator/motion_profile.h"
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// AutoSpanTrack's number of moves.
+static const int MIN_AUTO_ACTIONS = 0;
+static const int MAX_AUTO_ACTIONS = 10;
+
+// Castle's collision fan: rays within 45 degrees of the motion.
+static const int   NUM_FAN_RAYS = 5;
+static const float FAN_HALF_ANGLE = 0.25f * 3.14159265f;
+
+// SpanTracker's move duration.
+static const float MOVE_TIME = 1.0f;
+
+// Random poses tried per trial before giving up.
+static const int MAX_PLACEMENTS = 100;
+
+static const float MAX_REAL = 3.402823466e+38f;
+
+struct Vec
+{
+   float x, y, z;
+};
+
+static Vec Make(float x, float y, float z)
+{
+   Vec v = { x, y, z };
+
+   return(v);
+}
+
+
+static Vec operator+(const Vec& a, const Vec& b)
+{
+   return(Make(a.x + b.x, a.y + b.y, a.z + b.z));
+}
+
+
+static Vec operator-(const Vec& a, const Vec& b)
+{
+   return(Make(a.x - b.x, a.y - b.y, a.z - b.z));
+}
+
+
+static Vec operator*(float s, const Vec& a)
+{
+   return(Make(s * a.x, s * a.y, s * a.z));
+}
+
+
+static float Length(const Vec& a)
+{
+   return(sqrtf(a.x * a.x + a.y * a.y + a.z * a.z));
+}
+
+
+static Vec Cross(const Vec& a, const Vec& b)
+{
+   return(Make(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+               a.x * b.y - a.y * b.x));
+}
+
+
+// Row-major rotation, applied to column vectors as WM5 does.
+struct Rotation
+{
+   float m[3][3];
+};
+
+static Vec operator*(const Rotation& r, const Vec& v)
+{
+   return(Make(r.m[0][0] * v.x + r.m[0][1] * v.y + r.m[0][2] * v.z,
+               r.m[1][0] * v.x + r.m[1][1] * v.y + r.m[1][2] * v.z,
+               r.m[2][0] * v.x + r.m[2][1] * v.y + r.m[2][2] * v.z));
+}
+
+
+static Rotation operator*(const Rotation& a, const Rotation& b)
+{
+   Rotation c;
+
+   for (int i = 0; i < 3; ++i)
+   {
+      for (int j = 0; j < 3; ++j)
+      {
+         c.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] +
+                     a.m[i][2] * b.m[2][j];
+      }
+   }
+   return(c);
+}
+
+
+// Counterclockwise rotation by angle about a unit axis, as HMatrix and
+// Quaternionf::ToRotationMatrix make it.
+static Rotation AxisAngle(const Vec& axis, float angle)
+{
+   float    c = cosf(angle), s = sinf(angle), t = 1.0f - c;
+   Rotation r;
+
+   r.m[0][0] = c + t * axis.x * axis.x;
+   r.m[0][1] = t * axis.x * axis.y - s * axis.z;
+   r.m[0][2] = t * axis.x * axis.z + s * axis.y;
+   r.m[1][0] = t * axis.x * axis.y + s * axis.z;
+   r.m[1][1] = c + t * axis.y * axis.y;
+   r.m[1][2] = t * axis.y * axis.z - s * axis.x;
+   r.m[2][0] = t * axis.x * axis.z - s * axis.y;
+   r.m[2][1] = t * axis.y * axis.z + s * axis.x;
+   r.m[2][2] = c + t * axis.z * axis.z;
+   return(r);
+}
+
+
+static const Rotation IDENTITY = { { { 1.0f, 0.0f, 0.0f },
+                                     { 0.0f, 1.0f, 0.0f },
+                                     { 0.0f, 0.0f, 1.0f } } };
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// A device placement and the moves to make from it.
+struct Pose
+{
+   Vec         Position;
+   float       Yaw, Pitch;
+   std::string Moves;          // empty for random moves
+};
+
+struct Trial
+{
+   bool        Done;
+   Pose        Start;
+   std::string Moves;
+   float       StartDistance, EndDistance;
+   float       Span, Integrated, Noisy, Kalman;
+   std::vector<MovementRecord::Step> Steps;
+};
+
+// The Castle camera and the SpanTracker device during a trial.
+class Device
+{
+public:
+
+   Device(const TriangleBVH& bvh, const CollisionGeometry& geometry,
+          float signalNoiseRatio, int imuRate, float rest, bool record);
+
+   // Cast along dir; returns the distance or -1.
+   float Cast(const Vec& origin, const Vec& dir) const;
+
+   // Camera frame at the pose.
+   void Place(const Pose& pose);
+
+   // Castle::AdjustVerticalDistance for a placement; false if there is
+   // nothing below.
+   bool Settle();
+
+   // Track the target straight ahead; returns its distance or -1.
+   float Pick(Vec& target) const;
+
+   // Start tracking; resets the integrators.
+   void Start(float distance, unsigned long seed, Trial& trial);
+
+   // One of FBLRUD; returns false if the collision fan blocked it.
+   bool Move(char move, Trial& trial);
+
+   const Vec& GetPosition() const { return(mPosition); }
+
+   Integrator       mClean, mNoisy;
+   KalmanIntegrator mKalman;
+
+private:
+
+   bool AllowMotion(float sign) const;
+   void AdjustVerticalDistance(Trial& trial);
+   void Integrate(Trial& trial);
+   void Translate(const Vec& v, Trial& trial);
+   void Turn(int axis, float sign, Trial& trial);
+
+   const TriangleBVH&       mBVH;
+   const CollisionGeometry& mGeometry;
+   bool                     mRecord;
+
+   // WindowApplication3 camera frame and world axes (forward, up, right).
+   Vec mPosition, mD, mU, mR;
+   Vec mWorldAxis[3];
+
+   // SpanTracker device rotation and move samples.
+   Rotation              mRotation;
+   struct motion_profile mProfile;
+
+   float mCos[NUM_FAN_RAYS], mSin[NUM_FAN_RAYS], mTolerance[NUM_FAN_RAYS];
+};
+
+//----------------------------------------------------------------------------
+Device::Device(const TriangleBVH& bvh, const CollisionGeometry& geometry,
+               float signalNoiseRatio, int imuRate, float rest, bool record)
+   :
+     mClean(0.0f, 0.0f, 0.0f),
+     mNoisy(0.0f, 0.0f, 0.0f, true, signalNoiseRatio),
+     mKalman(0.0f, 0.0f, 0.0f, true, signalNoiseRatio),
+     mBVH(bvh),
+     mGeometry(geometry),
+     mRecord(record),
+     mRotation(IDENTITY)
+{
+   float mult = 1.0f / (NUM_FAN_RAYS / 2);
+
+   motion_profile_init(&mProfile, imuRate);
+   motion_profile_rest(&mProfile, rest);
+   for (int i = 0; i < NUM_FAN_RAYS; ++i)
+   {
+      float unit  = i * mult - 1.0f;
+      float angle = 0.5f * 3.14159265f + FAN_HALF_ANGLE * unit;
+      mCos[i]       = cosf(angle);
+      mSin[i]       = sinf(angle);
+      mTolerance[i] = 2.0f - 1.5f * fabsf(unit);
+   }
+}
+
+
+//----------------------------------------------------------------------------
+float Device::Cast(const Vec& origin, const Vec& dir) const
+{
+   TriangleBVH::Hit hit;
+
+   if (mBVH.RayCast(&origin.x, &dir.x, MAX_REAL, hit))
+   {
+      return(hit.T);
+   }
+   return(-1.0f);
+}
+
+
+//----------------------------------------------------------------------------
+void Device::Place(const Pose& pose)
+{
+   // Castle's up is +z; yaw and pitch are from the saved direction.
+   Vec forward = Make(mGeometry.DVector[0], mGeometry.DVector[1], 0.0f);
+   if (Length(forward) < 1.0e-6f)
+   {
+      forward = Make(1.0f, 0.0f, 0.0f);
+   }
+   forward = (1.0f / Length(forward)) * forward;
+
+   mWorldAxis[1] = Make(0.0f, 0.0f, 1.0f);
+   mWorldAxis[0] = AxisAngle(mWorldAxis[1], pose.Yaw) * forward;
+   mWorldAxis[2] = Cross(mWorldAxis[0], mWorldAxis[1]);
+   Rotation pitch = AxisAngle(mWorldAxis[2], pose.Pitch);
+   mPosition = pose.Position;
+   mD        = pitch * mWorldAxis[0];
+   mU        = pitch * mWorldAxis[1];
+   mR        = mWorldAxis[2];
+}
+
+
+//----------------------------------------------------------------------------
+bool Device::Settle()
+{
+   float t = Cast(mPosition, Make(0.0f, 0.0f, -1.0f));
+
+   if (t < 0.0f)
+   {
+      return(false);
+   }
+   mPosition.z += mGeometry.VerticalDistance - t;
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+float Device::Pick(Vec& target) const
+{
+   float t = Cast(mPosition, mD);
+
+   if (t < 0.0f)
+   {
+      return(-1.0f);
+   }
+   target = mPosition + t * mD;
+   return(Length(target - mPosition));
+}
+
+
+//----------------------------------------------------------------------------
+void Device::Start(float distance, unsigned long seed, Trial& trial)
+{
+   mRotation = IDENTITY;
+   mClean.init(0.0f, 0.0f, -distance);
+   mNoisy.init(0.0f, 0.0f, -distance);
+   mNoisy.seed(seed);
+   mKalman.init(0.0f, 0.0f, -distance);
+   mKalman.seed(seed);
+   trial.Steps.clear();
+}
+
+
+//----------------------------------------------------------------------------
+bool Device::Move(char move, Trial& trial)
+{
+   float trnSpeed = mGeometry.TrnSpeed;
+   float rotSpeed = mGeometry.RotSpeed;
+
+   switch (move)
+   {
+   case 'F':
+   case 'B':
+   {
+      float sign = (move == 'F' ? 1.0f : -1.0f);
+      if (!AllowMotion(sign))
+      {
+         return(false);
+      }
+      mPosition = mPosition + (sign * trnSpeed) * mWorldAxis[0];
+
+      // SpanTracker::MoveForward: level forward step in the device frame.
+      Vec   f      = Make(mRotation.m[2][0], 0.0f, mRotation.m[2][2]);
+      float length = Length(f);
+      f = (length > 1.0e-6f ? sign * trnSpeed / length : 0.0f) * f;
+      Translate(mRotation * f, trial);
+      AdjustVerticalDistance(trial);
+      return(true);
+   }
+
+   case 'L':
+   case 'R':
+   {
+      float    sign = (move == 'L' ? 1.0f : -1.0f);
+      Rotation incr = AxisAngle(mWorldAxis[1], sign * rotSpeed);
+      mWorldAxis[0] = incr * mWorldAxis[0];
+      mWorldAxis[2] = incr * mWorldAxis[2];
+      mD            = incr * mD;
+      mU            = incr * mU;
+      mR            = incr * mR;
+      Turn(1, sign, trial);
+      return(true);
+   }
+
+   case 'U':
+   case 'D':
+   {
+      float    sign = (move == 'U' ? 1.0f : -1.0f);
+      Rotation incr = AxisAngle(mWorldAxis[2], sign * rotSpeed);
+      mD = incr * mD;
+      mU = incr * mU;
+      mR = incr * mR;
+      Turn(0, sign, trial);
+      return(true);
+   }
+   }
+   return(false);
+}
+
+
+//----------------------------------------------------------------------------
+// Castle::AllowMotion.
+bool Device::AllowMotion(float sign) const
+{
+   Vec   origin = mPosition + (sign * mGeometry.TrnSpeed) * mWorldAxis[0] -
+                  (0.5f * mGeometry.VerticalDistance) * mWorldAxis[1];
+
+   for (int i = 0; i < NUM_FAN_RAYS; ++i)
+   {
+      Vec              d = mCos[i] * mWorldAxis[2] + (sign * mSin[i]) * mWorldAxis[0];
+      TriangleBVH::Hit hit;
+      if (mBVH.RayCast(&origin.x, &d.x, mTolerance[i], hit))
+      {
+         return(false);
+      }
+   }
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+// Castle::AdjustVerticalDistance and SpanTracker::AdjustVerticalDistance.
+void Device::AdjustVerticalDistance(Trial& trial)
+{
+   float z = mPosition.z;
+
+   if (!Settle())
+   {
+      return;
+   }
+   Translate(mRotation * Make(0.0f, mPosition.z - z, 0.0f), trial);
+}
+
+
+//----------------------------------------------------------------------------
+// SpanTracker::IntegrateProfile.
+void Device::Integrate(Trial& trial)
+{
+   struct vector3d gyr[MOTION_BATCH];
+   struct vector3d acc[MOTION_BATCH];
+   struct vector3d average_stat_acc;
+   int             n;
+
+   average_stat_acc.x = average_stat_acc.y = average_stat_acc.z = 0.0f;
+   while ((n = motion_profile_fill(&mProfile, gyr, acc, MOTION_BATCH)) > 0)
+   {
+      mClean.integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      mNoisy.integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      mKalman.integrate_batch(gyr, acc, &average_stat_acc, mProfile.dtime, n);
+      for (int i = 0; mRecord && (i < n); ++i)
+      {
+         MovementRecord::Step step;
+         step.Gyr            = gyr[i];
+         step.Acc            = acc[i];
+         step.AverageStatAcc = average_stat_acc;
+         step.DTime          = mProfile.dtime;
+         trial.Steps.push_back(step);
+      }
+   }
+}
+
+
+//----------------------------------------------------------------------------
+// SpanTracker::IntegrateTranslation: v in device coordinates.
+void Device::Translate(const Vec& v, Trial& trial)
+{
+   struct vector3d displacement = { v.x, v.y, v.z };
+
+   motion_profile_translate(&mProfile, &displacement, MOVE_TIME);
+   Integrate(trial);
+}
+
+
+//----------------------------------------------------------------------------
+// SpanTracker::TurnLeft/TurnRight (axis 1) and LookUp/LookDown (axis 0).
+void Device::Turn(int axis, float sign, Trial& trial)
+{
+   Vec             unit = Make(axis == 0 ? sign : 0.0f,
+                                axis == 1 ? sign : 0.0f, 0.0f);
+   Vec             v        = mRotation * (mGeometry.RotSpeed * unit);
+   struct vector3d rotation = { v.x, v.y, v.z };
+
+   motion_profile_rotate(&mProfile, &rotation, MOVE_TIME);
+   Integrate(trial);
+   mRotation = mRotation * AxisAngle(unit, mGeometry.RotSpeed);
+}
+
+
+//----------------------------------------------------------------------------
+// AutoSpanTrack at a pose; scripted moves are made as given.
+static void RunTrial(Device& device, const Pose& pose, unsigned long seed,
+                     std::mt19937& random, Trial& trial)
+{
+   static const char MOVES[] = "FBLRUD";
+
+   trial.Done  = false;
+   trial.Start = pose;
+   trial.Moves.clear();
+   device.Place(pose);
+
+   Vec startTarget, endTarget;
+   trial.StartDistance = device.Pick(startTarget);
+   if (trial.StartDistance < 0.0f)
+   {
+      return;
+   }
+   device.Start(trial.StartDistance, seed, trial);
+
+   std::string moves = pose.Moves;
+   if (moves.empty())
+   {
+      std::uniform_int_distribution<int> countDist(MIN_AUTO_ACTIONS,
+                                                   MAX_AUTO_ACTIONS);
+      std::uniform_int_distribution<int> moveDist(0, 5);
+      int                                n = countDist(random);
+      for (int i = 0; i < n; ++i)
+      {
+         moves += MOVES[moveDist(random)];
+      }
+   }
+   for (int i = 0; i < (int)moves.size(); ++i)
+   {
+      char move = (char)toupper(moves[i]);
+      trial.Moves += (device.Move(move, trial) ? move : (char)tolower(move));
+   }
+
+   trial.EndDistance = device.Pick(endTarget);
+   if (trial.EndDistance < 0.0f)
+   {
+      return;
+   }
+   trial.Span       = Length(endTarget - startTarget);
+   trial.Integrated = device.mClean.get_target_distance(trial.EndDistance);
+   trial.Noisy      = device.mNoisy.get_target_distance(trial.EndDistance);
+   trial.Kalman     = device.mKalman.get_target_distance(trial.EndDistance);
+   trial.Done       = true;
+}
+
+
+//----------------------------------------------------------------------------
+// Random pose near the saved camera, settled onto the surface below.
+static bool RandomPose(Device& device, const CollisionGeometry& geometry,
+                       float radius, std::mt19937& random, Pose& pose)
+{
+   std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+   std::uniform_real_distribution<float> yawDist(0.0f, 2.0f * 3.14159265f);
+
+   for (int attempt = 0; attempt < MAX_PLACEMENTS; ++attempt)
+   {
+      float dx = unit(random), dy = unit(random);
+      if (dx * dx + dy * dy > 1.0f)
+      {
+         continue;
+      }
+      pose.Position = Make(geometry.Position[0] + radius * dx,
+                           geometry.Position[1] + radius * dy,
+                           geometry.Position[2]);
+      pose.Yaw   = yawDist(random);
+      pose.Pitch = 0.0f;
+      pose.Moves.clear();
+      device.Place(pose);
+      if (!device.Settle())
+      {
+         continue;
+      }
+      Vec target;
+      pose.Position = device.GetPosition();
+      if (device.Pick(target) >= 0.0f)
+      {
+         return(true);
+      }
+   }
+   return(false);
+}
+
+
+//----------------------------------------------------------------------------
+static bool ReadPoses(const char *filename, std::vector<Pose>& poses)
+{
+   FILE *fp = fopen(filename, "r");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   char line[BUFSIZ];
+   while (fgets(line, BUFSIZ, fp) != NULL)
+   {
+      Pose pose;
+      char moves[BUFSIZ];
+      int  n = sscanf(line, "%f %f %f %f %f %s", &pose.Position.x,
+                      &pose.Position.y, &pose.Position.z, &pose.Yaw,
+                      &pose.Pitch, moves);
+      if (n < 5)
+      {
+         continue;
+      }
+      if (n == 6)
+      {
+         pose.Moves = moves;
+      }
+      poses.push_back(pose);
+   }
+   fclose(fp);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+static void Summarize(const char *name, std::vector<float>& errors)
+{
+   if (errors.empty())
+   {
+      return;
+   }
+   double sum = 0.0, sum2 = 0.0;
+   for (int i = 0; i < (int)errors.size(); ++i)
+   {
+      errors[i] = fabsf(errors[i]);
+      sum      += errors[i];
+      sum2     += (double)errors[i] * errors[i];
+   }
+   std::sort(errors.begin(), errors.end());
+   printf("%-11s |error| mean %.4f, rms %.4f, median %.4f, 95%% %.4f, "
+          "max %.4f\n", name, sum / errors.size(), sqrt(sum2 / errors.size()),
+          errors[errors.size() / 2], errors[(errors.size() * 95) / 100],
+          errors.back());
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   const char    *geometryFile = "../castle.collision";
+   const char    *poseFile     = 0;
+   const char    *outputFile   = "spantrack.trials";
+   const char    *recordFile   = 0;
+   int           numTrials     = 10000;
+   float         radius        = 100.0f;
+   float         ratio         = 2.0f;
+   int           imuRate       = 0;
+   float         rest          = 0.0f;
+   int           numThreads    = (int)std::thread::hardware_concurrency();
+   unsigned long seed          = 1;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      if ((strcmp(argv[i], "-g") == 0) && (i + 1 < argc))
+      {
+         geometryFile = argv[++i];
+      }
+      else if ((strcmp(argv[i], "-p") == 0) && (i + 1 < argc))
+      {
+         poseFile = argv[++i];
+      }
+      else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+      {
+         numTrials = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-radius") == 0) && (i + 1 < argc))
+      {
+         radius = (float)atof(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+      {
+         ratio = (float)atof(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-hz") == 0) && (i + 1 < argc))
+      {
+         imuRate = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-rest") == 0) && (i + 1 < argc))
+      {
+         rest = (float)atof(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+      {
+         outputFile = argv[++i];
+      }
+      else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+      {
+         recordFile = argv[++i];
+      }
+      else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+      {
+         numThreads = atoi(argv[++i]);
+      }
+      else if ((strcmp(argv[i], "-seed") == 0) && (i + 1 < argc))
+      {
+         seed = strtoul(argv[++i], 0, 10);
+      }
+      else
+      {
+         fprintf(stderr, "Usage: %s [-g geometry file] [-p pose file] "
+                 "[-n trials] [-radius r] [-s ratio] [-hz rate] [-rest seconds] "
+                 "[-o output file] [-r record file] [-t threads] [-seed seed]\n",
+                 argv[0]);
+         return(1);
+      }
+   }
+   numThreads = std::max(numThreads, 1);
+
+   CollisionGeometry geometry;
+   if (!geometry.Load(geometryFile))
+   {
+      fprintf(stderr, "Cannot read collision geometry %s (save it from the "
+              "Castle demo with 'g')\n", geometryFile);
+      return(1);
+   }
+   std::vector<Pose> poses;
+   if (poseFile != 0)
+   {
+      if (!ReadPoses(poseFile, poses))
+      {
+         fprintf(stderr, "Cannot read poses %s\n", poseFile);
+         return(1);
+      }
+      numTrials = (int)poses.size();
+   }
+   numTrials = std::max(numTrials, 0);
+
+   double      t0 = Now();
+   TriangleBVH bvh;
+   bvh.Build(geometry.Triangles);
+   printf("%d triangles, BVH built in %.1f ms\n", bvh.GetNumTriangles(),
+          Now() - t0);
+
+   // Trial i always uses seed + i, so results do not depend on the number
+   // of threads.
+   std::vector<Trial>       trials(numTrials);
+   std::vector<std::thread> threads;
+   t0 = Now();
+   for (int t = 0; t < numThreads; ++t)
+   {
+      threads.push_back(std::thread([&, t]()
+      {
+         Device device(bvh, geometry, ratio, imuRate, rest, recordFile != 0);
+         for (int i = t; i < numTrials; i += numThreads)
+         {
+            unsigned long trialSeed = seed + (unsigned long)i;
+            std::mt19937  random(trialSeed);
+            Pose          pose;
+            trials[i].Done = false;
+            if (poseFile != 0)
+            {
+               pose = poses[i];
+            }
+            else if (!RandomPose(device, geometry, radius, random, pose))
+            {
+               continue;
+            }
+            RunTrial(device, pose, trialSeed, random, trials[i]);
+         }
+      }));
+   }
+   for (int t = 0; t < numThreads; ++t)
+   {
+      threads[t].join();
+   }
+   double time = Now() - t0;
+
+   FILE *out = fopen(outputFile, "w");
+   if (out == NULL)
+   {
+      fprintf(stderr, "Cannot write %s\n", outputFile);
+      return(1);
+   }
+   MovementRecord record;
+   if ((recordFile != 0) && !record.Open(recordFile))
+   {
+      fprintf(stderr, "Cannot write movement record %s\n", recordFile);
+   }
+   fprintf(out, "# trial x y z yaw pitch moves start end span integrated "
+           "noisy kalman\n");
+   std::vector<float> integratedErrors, noisyErrors, kalmanErrors;
+   for (int i = 0; i < numTrials; ++i)
+   {
+      const Trial& trial = trials[i];
+      if (!trial.Done)
+      {
+         continue;
+      }
+      fprintf(out, "%d %.3f %.3f %.3f %.4f %.4f %s %.4f %.4f %.4f %.4f %.4f "
+              "%.4f\n",
+              i, trial.Start.Position.x, trial.Start.Position.y,
+              trial.Start.Position.z, trial.Start.Yaw, trial.Start.Pitch,
+              trial.Moves.empty() ? "-" : trial.Moves.c_str(),
+              trial.StartDistance, trial.EndDistance, trial.Span,
+              trial.Integrated, trial.Noisy, trial.Kalman);
+      integratedErrors.push_back(trial.Integrated - trial.Span);
+      noisyErrors.push_back(trial.Noisy - trial.Span);
+      kalmanErrors.push_back(trial.Kalman - trial.Span);
+      if (record.IsOpen())
+      {
+         record.Start(trial.StartDistance);
+         for (int s = 0; s < (int)trial.Steps.size(); ++s)
+         {
+            const MovementRecord::Step& step = trial.Steps[s];
+            record.Record(&step.Gyr, &step.Acc, &step.AverageStatAcc,
+                          step.DTime);
+         }
+         record.End(trial.EndDistance, trial.Span);
+      }
+   }
+   fclose(out);
+   record.Close();
+
+   int numDone = (int)integratedErrors.size();
+   printf("%d trials, %d completed, %d threads, IMU rate %d, %gs rests, "
+          "%.0f ms (%.0f trials/s)\n", numTrials, numDone, numThreads, imuRate,
+          rest, time, time > 0.0 ? 1000.0 * numTrials / time : 0.0);
+   Summarize("integrated", integratedErrors);
+   Summarize("noisy", noisyErrors);
+   Summarize("kalman", kalmanErrors);
+   printf("results written to %s\n", outputFile);
+   return(0);
+}
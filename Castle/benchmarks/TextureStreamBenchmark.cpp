@@ -0,0 +1,131 @@
+// Texture streaming benchmark.
+// Loads a PNG texture with the sxmlgui Texture loaders into an offscreen
+// GLX context, once with load2D, which decodes and uploads in one call, and
+// once with load2DAsync, which decodes on a worker thread while the calling
+// thread, standing in for the frame loop, uploads the finished rows through
+// TexturesManager::uploadTextureStreams. Reports the longest the calling
+// thread was held up by either, with and without mipmaps.
+//
+// Usage: TextureStreamBenchmark [budget KB] [image]
+
+#include "TextureUtils.h"
+#include <GL/glx.h>
+#include <X11/Xlib.h>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// An unmapped window with a current GL context, or false without a display.
+static bool CreateContext()
+{
+   Display *display = XOpenDisplay(NULL);
+
+   if (display == NULL)
+   {
+      return(false);
+   }
+   int         attributes[] = { GLX_RGBA, GLX_DOUBLEBUFFER, None };
+   XVisualInfo *visual      = glXChooseVisual(display, DefaultScreen(display),
+                                              attributes);
+   if (visual == NULL)
+   {
+      return(false);
+   }
+   Window               root = RootWindow(display, visual->screen);
+   XSetWindowAttributes windowAttributes;
+   windowAttributes.colormap = XCreateColormap(display, root, visual->visual,
+                                               AllocNone);
+   Window     window  = XCreateWindow(display, root, 0, 0, 64, 64, 0,
+                                      visual->depth, InputOutput,
+                                      visual->visual, CWColormap,
+                                      &windowAttributes);
+   GLXContext context = glXCreateContext(display, visual, NULL, True);
+   return(context != NULL && glXMakeCurrent(display, window, context));
+}
+
+
+//----------------------------------------------------------------------------
+// The whole load in one call, in ms.
+static double TimeLoad(const char *image, bool mipmap)
+{
+   Texture texture;
+   double  t0 = Now();
+
+   texture.load2D(image, GL_REPEAT, GL_REPEAT, GL_LINEAR,
+                  GL_LINEAR_MIPMAP_LINEAR, mipmap);
+   glFinish();
+   double time = Now() - t0;
+   TexturesManager::flushAllTextures();
+   return(time);
+}
+
+
+//----------------------------------------------------------------------------
+// The longest call of a streamed load, in ms, and the time and number of
+// upload calls until it completes.
+static double TimeStream(const char *image, bool mipmap, unsigned int budget,
+                         double& total, int& calls)
+{
+   Texture texture;
+   double  t0 = Now();
+
+   texture.load2DAsync(image, GL_REPEAT, GL_REPEAT, GL_LINEAR,
+                       GL_LINEAR_MIPMAP_LINEAR, mipmap);
+   glFinish();
+   double worst = Now() - t0;
+   calls = 0;
+   while (TexturesManager::getTextureStreamCount() > 0)
+   {
+      double t1 = Now();
+      TexturesManager::uploadTextureStreams(budget);
+      glFinish();
+      worst = std::max(worst, Now() - t1);
+      calls++;
+   }
+   total = Now() - t0;
+   TexturesManager::flushAllTextures();
+   return(worst);
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   unsigned int budget = (argc > 1 ? atoi(argv[1]) * 1024 :
+                          TexturesManager::UPLOAD_BUDGET);
+   const char   *image  = (argc > 2 ? argv[2] :
+                           "../GUI/resource/GUIElements.PNG");
+
+   if (!CreateContext())
+   {
+      printf("TextureStreamBenchmark needs a display\n");
+      return(1);
+   }
+
+   // Warm up the file cache and the driver.
+   TimeLoad(image, true);
+
+   printf("%-10s %12s %12s %12s %8s\n", "", "load ms", "worst ms",
+          "total ms", "calls");
+   for (int mipmap = 0; mipmap < 2; ++mipmap)
+   {
+      double load  = TimeLoad(image, mipmap != 0);
+      double total = 0.0;
+      int    calls = 0;
+      double worst = TimeStream(image, mipmap != 0, budget, total, calls);
+      printf("%-10s %12.3f %12.3f %12.3f %8d\n",
+             mipmap ? "mipmaps" : "level 0", load, worst, total, calls);
+   }
+   printf("\n%u KB upload budget per call\n", budget / 1024);
+   return(0);
+}
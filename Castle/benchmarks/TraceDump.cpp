@@ -0,0 +1,38 @@
+// Trace dump.
+// Converts a binary SpanTracker/Integrator trace (spantracker.trace) to
+// text.
+//
+// Usage: TraceDump <trace file> [text file]
+
+#include "../TraceLog.h"
+#include <stdio.h>
+
+int main(int argc, char *argv[])
+{
+   if ((argc < 2) || (argc > 3))
+   {
+      fprintf(stderr, "Usage: %s <trace file> [text file]\n", argv[0]);
+      return(1);
+   }
+   FILE *out = stdout;
+   if (argc == 3)
+   {
+      out = fopen(argv[2], "w");
+      if (out == 0)
+      {
+         fprintf(stderr, "Cannot open %s\n", argv[2]);
+         return(1);
+      }
+   }
+   bool valid = TraceLog::Dump(argv[1], out);
+   if (out != stdout)
+   {
+      fclose(out);
+   }
+   if (!valid)
+   {
+      fprintf(stderr, "Cannot read trace %s\n", argv[1]);
+      return(1);
+   }
+   return(0);
+}
@@ -0,0 +1,270 @@
+// Vertex welding benchmark.
+// Welds the index tuples of the shipped Castle geometry with the original
+// std::map scheme and with VertexWelder, and reports the time of each.
+//
+// Usage: WeldBenchmark [geometry directory] [repetitions]
+
+#include "../VertexWelder.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+// Index tuple ordered as VertexPNT1/VertexPNT2 were.
+struct Tuple
+{
+   int Index[4];
+   int Size;
+
+   bool operator<(const Tuple& tuple) const
+   {
+      for (int i = 0; i < Size; ++i)
+      {
+         if (Index[i] < tuple.Index[i])
+         {
+            return(true);
+         }
+         if (Index[i] > tuple.Index[i])
+         {
+            return(false);
+         }
+      }
+      return(false);
+   }
+};
+
+// Geometry files and their layout, as loaded by Castle.
+struct GeometryFile
+{
+   const char *Name;
+   int        NumTCoords;
+   bool       Multi;
+};
+
+static const GeometryFile FILES[] =
+{
+   { "Barrel01.txt",          1, false },
+   { "BarrelRack01.txt",      1, false },
+   { "BarrelRack03.txt",      1, false },
+   { "Bench01.txt",           1, false },
+   { "Box01.txt",             1, false },
+   { "Bridge.txt",            1, false },
+   { "Bunk01.txt",            1, true  },
+   { "CeilingLight01.txt",    1, true  },
+   { "ChestBottom01.txt",     1, false },
+   { "ChestTop01.txt",        1, false },
+   { "Cylinder02.txt",        1, true  },
+   { "Cylinder02NCL.txt",     1, false },
+   { "Cylinder03.txt",        1, false },
+   { "Door.txt",              1, false },
+   { "DoorFrame01.txt",       1, false },
+   { "DrawBridge.txt",        1, false },
+   { "Exterior.txt",          1, true  },
+   { "FrontHall.txt",         1, true  },
+   { "FrontRamp.txt",         1, true  },
+   { "LargePort.txt",         1, false },
+   { "MainGate.txt",          1, false },
+   { "MainGate01.txt",        1, false },
+   { "Mug.txt",               1, false },
+   { "QuadPatch01.txt",       1, false },
+   { "Rope.txt",              1, false },
+   { "SimpleChair01.txt",     1, false },
+   { "SkyDome.txt",           1, false },
+   { "SmallPort.txt",         1, false },
+   { "Sphere01.txt",          1, true  },
+   { "SquareTable01.txt",     1, false },
+   { "Table01.txt",           1, false },
+   { "Terrain.txt",           1, true  },
+   { "Tube01.txt",            1, false },
+   { "Wall01.txt",            1, false },
+   { "Wall02.txt",            1, false },
+   { "WallTurret01.txt",      1, false },
+   { "WallTurret02.txt",      1, false },
+   { "Water.txt",             2, false },
+   { "Water2.txt",            1, false },
+   { "WoodShield01.txt",      1, false }
+};
+
+struct Result
+{
+   std::string Name;
+   int         NumCorners;
+   int         NumVertices;
+   double      MapTime;
+   double      HashTime;
+
+   bool operator<(const Result& result) const
+   {
+      return(NumCorners > result.NumCorners);
+   }
+};
+
+//----------------------------------------------------------------------------
+static double Now()
+{
+   return(std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+//----------------------------------------------------------------------------
+// Read the corner index tuples of a geometry file.
+static bool ReadTuples(const std::string& filename, const GeometryFile& file,
+                       std::vector<int>& tuples)
+{
+   std::ifstream inFile(filename.c_str());
+
+   if (!inFile)
+   {
+      return(false);
+   }
+   int   count, i;
+   float value;
+   int   arrays[] = { 3, 3, 2, 2 };
+   for (int a = 0; a < 2 + file.NumTCoords; ++a)
+   {
+      inFile >> count;
+      for (i = 0; i < arrays[a] * count; ++i)
+      {
+         inFile >> value;
+      }
+   }
+   int numMeshes = 1, numCorners = 0;
+   if (file.Multi)
+   {
+      inFile >> numMeshes;
+   }
+   for (i = 0; i < numMeshes; ++i)
+   {
+      inFile >> count;
+      numCorners += 3 * count;
+   }
+   tuples.resize(numCorners * (2 + file.NumTCoords));
+   for (i = 0; i < (int)tuples.size(); ++i)
+   {
+      inFile >> tuples[i];
+   }
+   return(!inFile.fail());
+}
+
+
+//----------------------------------------------------------------------------
+static int WeldMap(const std::vector<int>& tuples, int tupleSize,
+                   std::vector<int>& indices)
+{
+   std::map<Tuple, int> tupleMap;
+   int                  numCorners = (int)tuples.size() / tupleSize;
+
+   for (int c = 0; c < numCorners; ++c)
+   {
+      Tuple tuple;
+      tuple.Size = tupleSize;
+      for (int i = 0; i < tupleSize; ++i)
+      {
+         tuple.Index[i] = tuples[c * tupleSize + i];
+      }
+      std::map<Tuple, int>::iterator miter = tupleMap.find(tuple);
+      if (miter != tupleMap.end())
+      {
+         indices[c] = miter->second;
+      }
+      else
+      {
+         indices[c] = (int)tupleMap.size();
+         tupleMap.insert(std::make_pair(tuple, indices[c]));
+      }
+   }
+   return((int)tupleMap.size());
+}
+
+
+//----------------------------------------------------------------------------
+static int WeldHash(const std::vector<int>& tuples, int tupleSize,
+                    std::vector<int>& indices)
+{
+   int          numCorners = (int)tuples.size() / tupleSize;
+   VertexWelder welder(tupleSize, numCorners);
+   bool         isNew;
+
+   for (int c = 0; c < numCorners; ++c)
+   {
+      indices[c] = welder.Insert(&tuples[c * tupleSize], isNew);
+   }
+   return(welder.GetNumVertices());
+}
+
+
+//----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   std::string dir         = (argc > 1 ? argv[1] : "../Geometry");
+   int         repetitions = (argc > 2 ? atoi(argv[2]) : 20);
+
+   if (dir[dir.size() - 1] != '/')
+   {
+      dir += "/";
+   }
+   if (repetitions < 1)
+   {
+      repetitions = 1;
+   }
+
+   std::vector<Result> results;
+   for (size_t f = 0; f < sizeof(FILES) / sizeof(FILES[0]); ++f)
+   {
+      const GeometryFile& file = FILES[f];
+      std::vector<int>    tuples;
+      if (!ReadTuples(dir + file.Name, file, tuples))
+      {
+         fprintf(stderr, "Cannot read %s%s\n", dir.c_str(), file.Name);
+         return(1);
+      }
+      int              tupleSize  = 2 + file.NumTCoords;
+      int              numCorners = (int)tuples.size() / tupleSize;
+      std::vector<int> mapIndices(numCorners), hashIndices(numCorners);
+
+      // Best of several runs of each scheme.
+      Result result;
+      result.Name       = file.Name;
+      result.NumCorners = numCorners;
+      result.MapTime    = result.HashTime = 1.0e30;
+      for (int r = 0; r < repetitions; ++r)
+      {
+         double t0 = Now();
+         result.NumVertices = WeldMap(tuples, tupleSize, mapIndices);
+         double t1 = Now();
+         int numVertices = WeldHash(tuples, tupleSize, hashIndices);
+         double t2 = Now();
+         result.MapTime  = std::min(result.MapTime, t1 - t0);
+         result.HashTime = std::min(result.HashTime, t2 - t1);
+         if ((numVertices != result.NumVertices) || (mapIndices != hashIndices))
+         {
+            fprintf(stderr, "%s: welded results differ\n", file.Name);
+            return(1);
+         }
+      }
+      results.push_back(result);
+   }
+
+   // Largest meshes first.
+   std::sort(results.begin(), results.end());
+   double mapTotal = 0.0, hashTotal = 0.0;
+   printf("%-20s %9s %9s %10s %10s %8s\n", "file", "corners", "vertices",
+          "map (ms)", "hash (ms)", "speedup");
+   for (size_t i = 0; i < results.size(); ++i)
+   {
+      const Result& result = results[i];
+      printf("%-20s %9d %9d %10.3f %10.3f %7.1fx\n", result.Name.c_str(),
+             result.NumCorners, result.NumVertices, result.MapTime,
+             result.HashTime, result.MapTime / result.HashTime);
+      mapTotal  += result.MapTime;
+      hashTotal += result.HashTime;
+   }
+   printf("%-20s %9s %9s %10.3f %10.3f %7.1fx\n", "total", "", "", mapTotal,
+          hashTotal, mapTotal / hashTotal);
+   return(0);
+}
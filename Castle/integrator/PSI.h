@@ -1,10 +1,120 @@
 #ifndef PSI__H
 #define PSI__H
 
+#include <math.h>
 #include "matrix.h"
+#include "matrix3.h"
 #include "vector3d.h"
 
 //function [new_Psi] = PSI(psi)
 void PSI(struct matrix *psi, struct matrix *Psi);
 
+//fixed-size, reentrant PSI: the Rodrigues rotation for the angle vector
+//psi. Per-sample angles are small, so below PSI3_SERIES_LIMIT (squared
+//norm) the cosine and sine terms come from their Taylor series, which
+//needs no sqrt, sin or cos and avoids the cancellation in 1-cos; larger
+//angles are evaluated as in PSI.
+#define PSI3_SERIES_LIMIT    1.0e-2f
+
+//Psi=c*eye(3)+k*(psi*psi')-s*psi_cross; returns psi in p
+inline void PSI3_terms(const struct vector3d *psi, float p[3], float *c,
+                       float *k, float *s)
+{
+   p[0] = psi->x;
+   p[1] = psi->y;
+   p[2] = psi->z;
+   float normpsi2 = (p[0] * p[0]) + (p[1] * p[1]) + (p[2] * p[2]);
+
+   if (normpsi2 < PSI3_SERIES_LIMIT)
+   {
+      //cos(n), (1-cos(n))/n^2 and sin(n)/n to within n^8 terms
+      float n2 = normpsi2;
+      *c = 1.0f - n2 * (1.0f / 2.0f - n2 * (1.0f / 24.0f - n2 * (1.0f / 720.0f)));
+      *k = 1.0f / 2.0f - n2 * (1.0f / 24.0f - n2 * (1.0f / 720.0f));
+      *s = 1.0f - n2 * (1.0f / 6.0f - n2 * (1.0f / 120.0f - n2 * (1.0f / 5040.0f)));
+   }
+   else
+   {
+      //new_Psi=cos(norm(psi))*eye(3)+(1-cos(norm(psi)))*(psi*psi')/((norm(psi))^2)-sin(norm(psi))*psi_cross/(norm(psi));
+      float normpsi = (float)sqrt(normpsi2);
+      *c = (float)cos(normpsi);
+      *k = (1.0f - *c) / normpsi2;
+      *s = (float)sin(normpsi) / normpsi;
+   }
+}
+
+
+inline void PSI3(const struct vector3d *psi, struct matrix3 *Psi)
+{
+   float p[3], c, k, s;
+   int   i, j;
+
+   PSI3_terms(psi, p, &c, &k, &s);
+   const float psi_cross[3][3] =
+   {
+      {   0.0f, -p[2], p[1] },
+      {   p[2],  0.0f, -p[0] },
+      {  -p[1],  p[0], 0.0f }
+   };
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         Psi->e[i][j] = ((i == j ? c : 0.0f) + (p[i] * p[j]) * k) -
+                        psi_cross[i][j] * s;
+      }
+      Psi->e[i][3] = 0.0f;
+   }
+}
+
+
+//Cbi=PSI(psi)*Cbi without forming Psi: with rows r0..r2 of Cbi and
+//q=psi'*Cbi, row i becomes c*ri+k*psi(i)*q-s*(psi_cross(i,:)*Cbi)
+inline void PSI3_rotate(const struct vector3d *psi, struct matrix3 *Cbi)
+{
+   float p[3], c, k, s;
+
+   PSI3_terms(psi, p, &c, &k, &s);
+#ifdef MATRIX3_SSE
+   __m128 r0 = _mm_loadu_ps(Cbi->e[0]);
+   __m128 r1 = _mm_loadu_ps(Cbi->e[1]);
+   __m128 r2 = _mm_loadu_ps(Cbi->e[2]);
+   __m128 p0 = _mm_set1_ps(p[0]);
+   __m128 p1 = _mm_set1_ps(p[1]);
+   __m128 p2 = _mm_set1_ps(p[2]);
+   __m128 vc = _mm_set1_ps(c);
+   __m128 vs = _mm_set1_ps(s);
+   __m128 q  = _mm_mul_ps(_mm_set1_ps(k),
+                          _mm_add_ps(_mm_add_ps(_mm_mul_ps(p0, r0),
+                                                _mm_mul_ps(p1, r1)),
+                                     _mm_mul_ps(p2, r2)));
+   __m128 x0 = _mm_sub_ps(_mm_mul_ps(p1, r2), _mm_mul_ps(p2, r1));
+   __m128 x1 = _mm_sub_ps(_mm_mul_ps(p2, r0), _mm_mul_ps(p0, r2));
+   __m128 x2 = _mm_sub_ps(_mm_mul_ps(p0, r1), _mm_mul_ps(p1, r0));
+   _mm_storeu_ps(Cbi->e[0], _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vc, r0),
+                                                 _mm_mul_ps(p0, q)),
+                                      _mm_mul_ps(vs, x0)));
+   _mm_storeu_ps(Cbi->e[1], _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vc, r1),
+                                                 _mm_mul_ps(p1, q)),
+                                      _mm_mul_ps(vs, x1)));
+   _mm_storeu_ps(Cbi->e[2], _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vc, r2),
+                                                 _mm_mul_ps(p2, q)),
+                                      _mm_mul_ps(vs, x2)));
+#else
+   struct matrix3 r = *Cbi;
+   int            j;
+
+   for (j = 0; j < 3; j++)
+   {
+      float q = k * ((p[0] * r.e[0][j] + p[1] * r.e[1][j]) + p[2] * r.e[2][j]);
+      Cbi->e[0][j] = (c * r.e[0][j] + p[0] * q) -
+                     s * (p[1] * r.e[2][j] - p[2] * r.e[1][j]);
+      Cbi->e[1][j] = (c * r.e[1][j] + p[1] * q) -
+                     s * (p[2] * r.e[0][j] - p[0] * r.e[2][j]);
+      Cbi->e[2][j] = (c * r.e[2][j] + p[2] * q) -
+                     s * (p[0] * r.e[1][j] - p[1] * r.e[0][j]);
+   }
+#endif
+}
+
 #endif
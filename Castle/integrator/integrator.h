@@ -1,10 +1,11 @@
 #ifndef INTEGRATOR__H
 #define INTEGRATOR__H
 
-#include "matrix.h"
+#include "matrix3.h"
+#include "PSI.h"
+#include "noise.h"
 #include "vector3d.h"
 #include <stdio.h>
-#include <random>
 using namespace std;
 
 class Integrator
@@ -12,17 +13,18 @@ class Integrator
 public:
 
    // Current velocity, position, and rotation
-   struct vector3d *vel_t;
-   struct vector3d *pos_t;
-   struct matrix   *Cbi;
+   struct vector3d vel_t;
+   struct vector3d pos_t;
+   struct matrix3  Cbi;
 
    Integrator(float x, float y, float z, bool noisy = false, float signal_noise_ratio = DEFAULT_SIGNAL_NOISE_RATIO);
-   void init(float x, float y, float z);
+   virtual ~Integrator() {}
+   virtual void init(float x, float y, float z);
 
-   ~Integrator();
-   void clear();
+   virtual void integrate_movement(struct vector3d *gyr, struct vector3d *acc, struct vector3d *average_stat_acc, float dtime);
 
-   void integrate_movement(struct vector3d *gyr, struct vector3d *acc, struct vector3d *average_stat_acc, float dtime);
+   // Integrate count samples of interval dtime
+   virtual void integrate_batch(struct vector3d *gyr, struct vector3d *acc, struct vector3d *average_stat_acc, float dtime, int count);
    float get_target_distance(float device_to_target_distance);
    void get_forward_vector(struct vector3d *forward);
    void get_up_vector(struct vector3d *up);
@@ -30,23 +32,94 @@ public:
 
    bool  noisy;
    float signal_noise_ratio;
-   float add_noise(float signal, default_random_engine& generator);
+   float add_noise(float signal);
+
+   // Noise generator, seeded from rand() unless seeded explicitly
+   struct noise_generator generator;
+   void seed(unsigned long s);
 
    static float DEFAULT_SIGNAL_NOISE_RATIO;
    static float SIGNAL_NOISE_RATIO_DELTA;
    float signal_noise_decrease();
    float signal_noise_increase();
 
-   char *logfile;
-   void log_matrix(struct matrix *A, FILE *fp);
-
-   // Work.
-   static float    eta;
-   struct matrix   *psi;
-   struct matrix   *Psi;
-   struct vector3d *acc_t;
-   struct matrix   *mwork3x3;
-   struct matrix   *mwork3x1a;
-   struct matrix   *mwork3x1b;
+   // Inputs and resulting state are traced while trace is set
+   class TraceLog *trace;
+   unsigned int   trace_source;
+
+   static float eta;
+
+protected:
+
+   // Sensor readings of a sample: the sample, plus noise when noisy
+   void measure(struct vector3d *gyr, struct vector3d *acc, struct vector3d *gyr_work, struct vector3d *acc_work);
+
+   // Dead-reckoning step on measured readings; returns the acceleration
+   // in global coordinates in acc_t
+   void propagate(struct vector3d *gyr_work, struct vector3d *acc_work, struct vector3d *average_stat_acc, float dtime, struct vector3d *acc_t);
+
+   void trace_input(struct vector3d *gyr_work, struct vector3d *acc_work, float dtime);
+   void trace_state();
 };
+
+
+// Sensor readings of a sample.
+inline void Integrator::measure(struct vector3d *gyr, struct vector3d *acc,
+                                struct vector3d *gyr_work, struct vector3d *acc_work)
+{
+   if (noisy && (signal_noise_ratio > 0.0f))
+   {
+      gyr_work->x = add_noise(gyr->x);
+      gyr_work->y = add_noise(gyr->y);
+      gyr_work->z = add_noise(gyr->z);
+      acc_work->x = add_noise(acc->x);
+      acc_work->y = add_noise(acc->y);
+      acc_work->z = add_noise(acc->z);
+   }
+   else
+   {
+      *gyr_work = *gyr;
+      *acc_work = *acc;
+   }
+}
+
+
+// Dead-reckoning step.
+inline void Integrator::propagate(struct vector3d *gyr_work, struct vector3d *acc_work,
+                                  struct vector3d *average_stat_acc, float dtime,
+                                  struct vector3d *acc_t)
+{
+   //psix=gyrX*dtime;
+   //psiy=gyrY*dtime;
+   //psiz=gyrZ*dtime;
+   //psi=[psix;psiy;psiz];
+   struct vector3d psi;
+   psi.x = gyr_work->x * dtime;
+   psi.y = gyr_work->y * dtime;
+   psi.z = gyr_work->z * dtime;
+
+   //% CALCULATES ORIENTATION
+   //Psi = PSI(psi);
+   //Cbi=Psi*Cbi;
+   PSI3_rotate(&psi, &Cbi);
+
+   //% CALCULATES ACCELERATION in global coordinates
+   //acc_t=Cbi'*[accX;accY;accZ]-average_stat_acc;
+   matrix3_transpose_apply(&Cbi, acc_work, acc_t);
+   acc_t->x = acc_t->x - average_stat_acc->x;
+   acc_t->y = acc_t->y - average_stat_acc->y;
+   acc_t->z = acc_t->z - average_stat_acc->z;
+
+   //% CALCULATES POSITION
+   //pos_t = pos_t + vel_t * dtime;
+   pos_t.x = pos_t.x + (vel_t.x + (acc_t->x * dtime * 0.5f)) * dtime;
+   pos_t.y = pos_t.y + (vel_t.y + (acc_t->y * dtime * 0.5f)) * dtime;
+   pos_t.z = pos_t.z + (vel_t.z + (acc_t->z * dtime * 0.5f)) * dtime;
+
+   //% CALCULATES VELOCITY
+   //vel_t = vel_t*eta + acc_t * dtime;
+   vel_t.x = vel_t.x * eta + acc_t->x * dtime;
+   vel_t.y = vel_t.y * eta + acc_t->y * dtime;
+   vel_t.z = vel_t.z * eta + acc_t->z * dtime;
+}
 #endif
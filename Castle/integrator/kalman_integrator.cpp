@@ -0,0 +1,270 @@
+// Error-state Kalman filter integrator.
+
+#include "kalman_integrator.h"
+#include <math.h>
+
+float KalmanIntegrator::ACC_NOISE           = 1.0e-3f;
+float KalmanIntegrator::GYR_NOISE           = 1.0e-4f;
+float KalmanIntegrator::ZERO_VELOCITY_NOISE = 1.0e-3f;
+float KalmanIntegrator::STATIONARY_ACC      = 1.0e-3f;
+float KalmanIntegrator::STATIONARY_GYR      = 1.0e-3f;
+float KalmanIntegrator::STATIONARY_TIME     = 0.1f;
+
+KalmanIntegrator::KalmanIntegrator(float x, float y, float z, bool noisy, float signal_noise_ratio)
+   : Integrator(x, y, z, noisy, signal_noise_ratio)
+{
+   init(x, y, z);
+}
+
+
+// The device starts at rest at a known position and orientation, so the
+// error covariance starts at zero.
+void KalmanIntegrator::init(float x, float y, float z)
+{
+   Integrator::init(x, y, z);
+   for (int i = 0; i < 9; i++)
+   {
+      for (int j = 0; j < 9; j++)
+      {
+         P[i][j] = 0.0;
+      }
+   }
+   num_updates     = 0;
+   stationary_time = 0.0f;
+}
+
+
+// One filter step: dead reckoning, covariance prediction and, while
+// stationary, a zero-velocity update.
+void KalmanIntegrator::integrate_movement(struct vector3d *gyr, struct vector3d *acc,
+                                          struct vector3d *average_stat_acc, float dtime)
+{
+   struct vector3d gyr_work;
+   struct vector3d acc_work;
+   struct vector3d acc_t;
+   struct vector3d force;
+
+   measure(gyr, acc, &gyr_work, &acc_work);
+   if (trace != NULL)
+   {
+      trace_input(&gyr_work, &acc_work, dtime);
+   }
+   propagate(&gyr_work, &acc_work, average_stat_acc, dtime, &acc_t);
+
+   //specific force in global coordinates
+   force.x = acc_t.x + average_stat_acc->x;
+   force.y = acc_t.y + average_stat_acc->y;
+   force.z = acc_t.z + average_stat_acc->z;
+   predict(&gyr_work, &acc_work, &force, dtime);
+
+   if ((vector3d_dot(&gyr_work, &gyr_work) < STATIONARY_GYR * STATIONARY_GYR) &&
+       (vector3d_dot(&acc_t, &acc_t) < STATIONARY_ACC * STATIONARY_ACC))
+   {
+      stationary_time += dtime;
+      if (stationary_time >= STATIONARY_TIME)
+      {
+         zero_velocity_update();
+      }
+   }
+   else
+   {
+      stationary_time = 0.0f;
+   }
+
+   if (trace != NULL)
+   {
+      trace_state();
+   }
+}
+
+
+//R=F*M', F the error transition
+//   [ I  dtime*I  B ]
+//   [ 0  eta*I    A ]   A=-[force]x*dtime, B=A*dtime/2
+//   [ 0  0        I ]
+//M is transposed first so that F is applied by rows, each a sum of
+//scaled rows; with P symmetric, F*P*F' is transition(F, transition(F, P))
+static void transition(double A[3][3], double B[3][3], double dtime, double eta,
+                       double M[9][9], double R[9][9])
+{
+   double T[9][9];
+   int    i, j;
+
+   for (i = 0; i < 9; i++)
+   {
+      for (j = 0; j < 9; j++)
+      {
+         T[i][j] = M[j][i];
+      }
+   }
+   for (i = 0; i < 3; i++)
+   {
+      //row i of A and B, read once for the j loop
+      double a0 = A[i][0], a1 = A[i][1], a2 = A[i][2];
+      double b0 = B[i][0], b1 = B[i][1], b2 = B[i][2];
+      for (j = 0; j < 9; j++)
+      {
+         R[i][j] = T[i][j] + dtime * T[3 + i][j] + b0 * T[6][j] +
+                   b1 * T[7][j] + b2 * T[8][j];
+         R[3 + i][j] = eta * T[3 + i][j] + a0 * T[6][j] + a1 * T[7][j] +
+                       a2 * T[8][j];
+         R[6 + i][j] = T[6 + i][j];
+      }
+   }
+}
+
+
+//P=F*P*F'+Q
+void KalmanIntegrator::predict(struct vector3d *gyr_work, struct vector3d *acc_work,
+                               struct vector3d *force, float dtime)
+{
+   double A[3][3], B[3][3], X[9][9];
+   double qa[3], qg[3];
+   int   i, j, k;
+
+   A[0][0] = 0.0;
+   A[0][1] = force->z * dtime;
+   A[0][2] = -force->y * dtime;
+   A[1][0] = -force->z * dtime;
+   A[1][1] = 0.0;
+   A[1][2] = force->x * dtime;
+   A[2][0] = force->y * dtime;
+   A[2][1] = -force->x * dtime;
+   A[2][2] = 0.0;
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         B[i][j] = A[i][j] * dtime * 0.5;
+      }
+   }
+   transition(A, B, dtime, eta, P, X);
+   transition(A, B, dtime, eta, X, P);
+
+   //reading variances: the noise floor, plus noise proportional to the
+   //signal as in add_noise
+   float gyr_v[3] = { gyr_work->x, gyr_work->y, gyr_work->z };
+   float acc_v[3] = { acc_work->x, acc_work->y, acc_work->z };
+   for (k = 0; k < 3; k++)
+   {
+      double sa = ACC_NOISE;
+      double sg = GYR_NOISE;
+      if (noisy && (signal_noise_ratio > 0.0f))
+      {
+         sa += fabsf(acc_v[k]) / signal_noise_ratio;
+         sg += fabsf(gyr_v[k]) / signal_noise_ratio;
+      }
+      qa[k] = sa * sa * dtime * dtime;
+      qg[k] = sg * sg * dtime * dtime;
+   }
+
+   //rotate into global coordinates: Cbi'*diag(q)*Cbi
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         double a = 0.0, g = 0.0;
+         for (k = 0; k < 3; k++)
+         {
+            double c = Cbi.e[k][i] * Cbi.e[k][j];
+            a += c * qa[k];
+            g += c * qg[k];
+         }
+         P[3 + i][3 + j] += a;
+         P[6 + i][6 + j] += g;
+      }
+   }
+}
+
+
+//measure vel_t=0: H=[0 I 0], S=H*P*H'+R, K=P*H'/S
+void KalmanIntegrator::zero_velocity_update()
+{
+   double S[3][3], Si[3][3], K[9][3], HP[3][9], dx[9];
+   double r = (double)ZERO_VELOCITY_NOISE * ZERO_VELOCITY_NOISE;
+   int   i, j, k;
+
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         S[i][j] = P[3 + i][3 + j] + (i == j ? r : 0.0);
+      }
+   }
+
+   //inverse by cofactors
+   Si[0][0] = S[1][1] * S[2][2] - S[1][2] * S[2][1];
+   Si[0][1] = S[0][2] * S[2][1] - S[0][1] * S[2][2];
+   Si[0][2] = S[0][1] * S[1][2] - S[0][2] * S[1][1];
+   Si[1][0] = S[1][2] * S[2][0] - S[1][0] * S[2][2];
+   Si[1][1] = S[0][0] * S[2][2] - S[0][2] * S[2][0];
+   Si[1][2] = S[0][2] * S[1][0] - S[0][0] * S[1][2];
+   Si[2][0] = S[1][0] * S[2][1] - S[1][1] * S[2][0];
+   Si[2][1] = S[0][1] * S[2][0] - S[0][0] * S[2][1];
+   Si[2][2] = S[0][0] * S[1][1] - S[0][1] * S[1][0];
+   double det = S[0][0] * Si[0][0] + S[0][1] * Si[1][0] + S[0][2] * Si[2][0];
+   if (!(det > 0.0))
+   {
+      return;
+   }
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         Si[i][j] /= det;
+      }
+   }
+
+   //innovation 0-vel_t
+   double y[3] = { -vel_t.x, -vel_t.y, -vel_t.z };
+   for (i = 0; i < 9; i++)
+   {
+      dx[i] = 0.0;
+      for (j = 0; j < 3; j++)
+      {
+         K[i][j] = P[i][3] * Si[0][j] + P[i][4] * Si[1][j] + P[i][5] * Si[2][j];
+         dx[i]  += K[i][j] * y[j];
+      }
+   }
+
+   //P=(I-K*H)*P, kept symmetric
+   for (k = 0; k < 3; k++)
+   {
+      for (j = 0; j < 9; j++)
+      {
+         HP[k][j] = P[3 + k][j];
+      }
+   }
+   for (i = 0; i < 9; i++)
+   {
+      for (j = 0; j < 9; j++)
+      {
+         P[i][j] -= K[i][0] * HP[0][j] + K[i][1] * HP[1][j] + K[i][2] * HP[2][j];
+      }
+   }
+   for (i = 0; i < 9; i++)
+   {
+      for (j = 0; j < i; j++)
+      {
+         double m = (P[i][j] + P[j][i]) * 0.5;
+         P[i][j] = P[j][i] = m;
+      }
+   }
+
+   //inject the error and reset it: Cbi'=(I+[dtheta]x)*Cbi' is
+   //Cbi=Cbi*PSI(dtheta)
+   pos_t.x += (float)dx[0];
+   pos_t.y += (float)dx[1];
+   pos_t.z += (float)dx[2];
+   vel_t.x += (float)dx[3];
+   vel_t.y += (float)dx[4];
+   vel_t.z += (float)dx[5];
+   struct vector3d dtheta;
+   struct matrix3  Psi;
+   dtheta.x = (float)dx[6];
+   dtheta.y = (float)dx[7];
+   dtheta.z = (float)dx[8];
+   PSI3(&dtheta, &Psi);
+   matrix3_multiply(&Cbi, &Psi, &Cbi);
+   num_updates++;
+}
@@ -0,0 +1,60 @@
+#ifndef KALMAN_INTEGRATOR__H
+#define KALMAN_INTEGRATOR__H
+
+// Error-state Kalman filter integrator.
+// The nominal state (position, velocity and Cbi) is dead-reckoned exactly
+// as by Integrator. Alongside it the filter propagates the covariance of
+// the 9-element error state
+//
+//    dx = [ dpos; dvel; dtheta ]
+//
+// where dtheta is a small rotation in global coordinates, true Cbi' =
+// (I + [dtheta]x) * Cbi'. Process noise follows the sensor noise model
+// of add_noise. While the device is stationary (gyr and global
+// acceleration below thresholds for STATIONARY_TIME) each sample applies
+// a zero-velocity update: velocity is measured as zero, the estimated
+// error is injected into the nominal state and reset. Through the
+// correlations built up during a move this corrects position and
+// attitude as well as velocity.
+//
+// All matrices are fixed-size members or on the stack; nothing is
+// allocated per step.
+
+#include "integrator.h"
+
+class KalmanIntegrator : public Integrator
+{
+public:
+
+   KalmanIntegrator(float x, float y, float z, bool noisy = false, float signal_noise_ratio = DEFAULT_SIGNAL_NOISE_RATIO);
+   void init(float x, float y, float z);
+
+   void integrate_movement(struct vector3d *gyr, struct vector3d *acc, struct vector3d *average_stat_acc, float dtime);
+
+   // Error covariance, rows and columns ordered as dx; double, since its
+   // entries span many orders of magnitude at high sample rates
+   double P[9][9];
+
+   // Zero-velocity updates applied since init
+   int num_updates;
+
+   // Sensor noise floors (standard deviation of a reading)
+   static float ACC_NOISE;
+   static float GYR_NOISE;
+
+   // Standard deviation of a zero-velocity measurement
+   static float ZERO_VELOCITY_NOISE;
+
+   // Stationary detection thresholds
+   static float STATIONARY_ACC;
+   static float STATIONARY_GYR;
+   static float STATIONARY_TIME;
+
+private:
+
+   float stationary_time;
+
+   void predict(struct vector3d *gyr_work, struct vector3d *acc_work, struct vector3d *force, float dtime);
+   void zero_velocity_update();
+};
+#endif
@@ -0,0 +1,104 @@
+#ifndef MATRIX3_H
+#define MATRIX3_H
+
+// Fixed-size 3x3 matrix and 3x1 vector operations for the integrator.
+// Unlike struct matrix these live on the stack or inside their owner and
+// need no allocation. Rows are padded to four floats so that a row can be
+// loaded as one SSE register; with SSE a product is computed as sums of
+// scaled rows, in the same order as the scalar loops, so both give the
+// same results as matrix_multiply.
+
+#include "vector3d.h"
+
+#if defined(__SSE__) || defined(_M_X64) || \
+   (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define MATRIX3_SSE
+#include <xmmintrin.h>
+#endif
+
+// 3x3 matrix; e[i][3] is padding.
+struct matrix3
+{
+   float e[3][4];
+};
+
+//set A to the identity
+inline void matrix3_identity(struct matrix3 *A)
+{
+   int i, j;
+
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         A->e[i][j] = (i == j ? 1.0f : 0.0f);
+      }
+   }
+}
+
+
+//multiply A by B, put result in C (C may be A or B)
+inline void matrix3_multiply(const struct matrix3 *A, const struct matrix3 *B,
+                             struct matrix3 *C)
+{
+#ifdef MATRIX3_SSE
+   __m128 b0 = _mm_loadu_ps(B->e[0]);
+   __m128 b1 = _mm_loadu_ps(B->e[1]);
+   __m128 b2 = _mm_loadu_ps(B->e[2]);
+   __m128 c[3];
+   int    i;
+
+   for (i = 0; i < 3; i++)
+   {
+      c[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(A->e[i][0]), b0),
+                                   _mm_mul_ps(_mm_set1_ps(A->e[i][1]), b1)),
+                        _mm_mul_ps(_mm_set1_ps(A->e[i][2]), b2));
+   }
+   for (i = 0; i < 3; i++)
+   {
+      _mm_storeu_ps(C->e[i], c[i]);
+   }
+#else
+   struct matrix3 c;
+   int            i, j;
+
+   for (i = 0; i < 3; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         c.e[i][j] = A->e[i][0] * B->e[0][j] + A->e[i][1] * B->e[1][j] +
+                     A->e[i][2] * B->e[2][j];
+      }
+   }
+   *C = c;
+#endif
+}
+
+
+//multiply the transpose of A by v, put result in w (w may be v)
+inline void matrix3_transpose_apply(const struct matrix3 *A,
+                                    const struct vector3d *v,
+                                    struct vector3d *w)
+{
+#ifdef MATRIX3_SSE
+   float  r[4];
+   __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(v->x),
+                                                 _mm_loadu_ps(A->e[0])),
+                                      _mm_mul_ps(_mm_set1_ps(v->y),
+                                                 _mm_loadu_ps(A->e[1]))),
+                           _mm_mul_ps(_mm_set1_ps(v->z), _mm_loadu_ps(A->e[2])));
+   _mm_storeu_ps(r, sum);
+   w->x = r[0];
+   w->y = r[1];
+   w->z = r[2];
+#else
+   float x = A->e[0][0] * v->x + A->e[1][0] * v->y + A->e[2][0] * v->z;
+   float y = A->e[0][1] * v->x + A->e[1][1] * v->y + A->e[2][1] * v->z;
+   float z = A->e[0][2] * v->x + A->e[1][2] * v->y + A->e[2][2] * v->z;
+   w->x = x;
+   w->y = y;
+   w->z = z;
+#endif
+}
+
+#endif
@@ -0,0 +1,167 @@
+#include <math.h>
+#include "motion_profile.h"
+
+#define MOTION_TWO_PI    6.28318530717958647692
+
+
+void motion_profile_init(struct motion_profile *p, int rate)
+{
+   p->rate        = (rate > 0 ? rate : 0);
+   p->rotating    = 0;
+   p->peak.x      = p->peak.y = p->peak.z = 0.0f;
+   p->num_samples = 0;
+   p->next        = 0;
+   p->dtime       = 0.0f;
+   p->rest        = 0.0f;
+   p->num_rest    = 0;
+   p->c           = 1.0;
+   p->s           = 0.0;
+   p->dc          = 1.0;
+   p->ds          = 0.0;
+}
+
+
+void motion_profile_rest(struct motion_profile *p, float rest)
+{
+   p->rest = (rest > 0.0f ? rest : 0.0f);
+}
+
+
+//sample count and phase of a move; samples at the middle of each interval
+static void begin(struct motion_profile *p, float duration, int two_sample)
+{
+   if (p->rate == 0)
+   {
+      p->num_samples = two_sample;
+   }
+   else
+   {
+      p->num_samples = (int)(duration * p->rate + 0.5f);
+      if (p->num_samples < 2)
+      {
+         p->num_samples = 2;
+      }
+   }
+   p->next  = 0;
+   p->dtime = duration / p->num_samples;
+   if (p->rest == 0.0f)
+   {
+      p->num_rest = 0;
+   }
+   else if (p->rate == 0)
+   {
+      p->num_rest = 1;
+   }
+   else
+   {
+      p->num_rest = (int)(p->rest * p->rate + 0.5f);
+      if (p->num_rest < 1)
+      {
+         p->num_rest = 1;
+      }
+   }
+
+   double step = MOTION_TWO_PI / p->num_samples;
+   p->c  = cos(0.5 * step);
+   p->s  = sin(0.5 * step);
+   p->dc = cos(step);
+   p->ds = sin(step);
+}
+
+
+void motion_profile_translate(struct motion_profile *p,
+                              struct vector3d *displacement, float duration)
+{
+   float a;
+
+   begin(p, duration, 2);
+   p->rotating = 0;
+   if (p->rate == 0)
+   {
+      //d = 2 * (a/2 * (T/2)^2)
+      a = 4.0f / (duration * duration);
+   }
+   else
+   {
+      a = (float)(MOTION_TWO_PI / (duration * duration));
+   }
+   vector3d_scale(a, displacement, &p->peak);
+}
+
+
+void motion_profile_rotate(struct motion_profile *p,
+                           struct vector3d *rotation, float duration)
+{
+   begin(p, duration, 1);
+   p->rotating = 1;
+   vector3d_scale(1.0f / duration, rotation, &p->peak);
+}
+
+
+int motion_profile_fill(struct motion_profile *p, struct vector3d *gyr,
+                        struct vector3d *acc, int max)
+{
+   struct vector3d *out, *zero;
+   int             i, n;
+
+   if (p->next >= p->num_samples)
+   {
+      //resting
+      n = p->num_samples + p->num_rest - p->next;
+      if (n > max)
+      {
+         n = max;
+      }
+      if (n > 0)
+      {
+         p->dtime = (p->rate == 0 ? p->rest : p->rest / p->num_rest);
+      }
+      for (i = 0; i < n; i++)
+      {
+         gyr[i].x = gyr[i].y = gyr[i].z = 0.0f;
+         acc[i].x = acc[i].y = acc[i].z = 0.0f;
+      }
+      p->next += n;
+      return(n);
+   }
+   n = p->num_samples - p->next;
+   if (n > max)
+   {
+      n = max;
+   }
+   if (p->rotating)
+   {
+      out  = gyr;
+      zero = acc;
+   }
+   else
+   {
+      out  = acc;
+      zero = gyr;
+   }
+   for (i = 0; i < n; i++)
+   {
+      float  shape;
+      double c;
+
+      if (p->rate == 0)
+      {
+         shape = ((p->rotating || (p->next + i == 0)) ? 1.0f : -1.0f);
+      }
+      else
+      {
+         shape = (float)(p->rotating ? 1.0 - p->c : p->s);
+
+         //advance the phase
+         c    = p->c * p->dc - p->s * p->ds;
+         p->s = p->s * p->dc + p->c * p->ds;
+         p->c = c;
+      }
+      out[i].x  = p->peak.x * shape;
+      out[i].y  = p->peak.y * shape;
+      out[i].z  = p->peak.z * shape;
+      zero[i].x = zero[i].y = zero[i].z = 0.0f;
+   }
+   p->next += n;
+   return(n);
+}
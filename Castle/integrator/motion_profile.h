@@ -0,0 +1,63 @@
+#ifndef MOTION_PROFILE__H
+#define MOTION_PROFILE__H
+
+// IMU sample streams for device moves.
+// A move is a translation or a rotation over a duration, sampled at a
+// fixed rate. Both profiles start and end at rest with zero acceleration,
+// so jerk stays bounded:
+//
+//    translation by d:  acc(t) = d * (2*pi/T^2) * sin(2*pi*t/T)
+//    rotation by r:     gyr(t) = r / T * (1 - cos(2*pi*t/T))
+//
+// (r is the rotation axis scaled by the angle). Each sample is the value
+// at the middle of its interval, so the samples of a move sum to exactly
+// zero velocity change and the full rotation. The phase is advanced by a
+// fixed rotation of (cos, sin) rather than evaluated per sample, so a
+// sample costs a few multiplies. Samples come out in batches of up to
+// MOTION_BATCH.
+//
+// A rate of 0 gives the original two-sample model of a move: for a
+// translation, constant acceleration for half the duration and constant
+// deceleration for the other half; for a rotation, one constant-rate
+// sample.
+//
+// A move may be followed by a rest, the device held still: zero samples at
+// the profile rate (one sample for the whole rest at rate 0). A filtering
+// integrator detects these and applies zero-velocity updates.
+
+#include "vector3d.h"
+
+#define MOTION_BATCH    256
+
+struct motion_profile
+{
+   int             rate;        //samples per second, 0 for two-sample moves
+   int             rotating;    //moving gyr rather than acc
+   struct vector3d peak;        //profile amplitude
+   int             num_samples; //samples in the move
+   int             next;        //next sample
+   float           dtime;       //sample interval
+   float           rest;        //rest after each move, in seconds
+   int             num_rest;    //samples in the rest
+   double          c, s;        //cos and sin of the next sample's phase
+   double          dc, ds;      //cos and sin of the phase step
+};
+
+void motion_profile_init(struct motion_profile *p, int rate);
+
+//set the rest following each move; 0 (the default) for none
+void motion_profile_rest(struct motion_profile *p, float rest);
+
+//begin a move; samples of a previous move not yet taken are dropped
+void motion_profile_translate(struct motion_profile *p,
+                              struct vector3d *displacement, float duration);
+void motion_profile_rotate(struct motion_profile *p,
+                           struct vector3d *rotation, float duration);
+
+//fill up to max samples (acc and gyr) of the current move and its rest;
+//returns the number filled, 0 once the move is done; every sample has
+//interval p->dtime (a batch never spans the move and its rest)
+int motion_profile_fill(struct motion_profile *p, struct vector3d *gyr,
+                        struct vector3d *acc, int max);
+
+#endif
@@ -0,0 +1,255 @@
+#include <math.h>
+#include <string.h>
+#include "noise.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+   (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define NOISE_SSE2
+#include <emmintrin.h>
+#endif
+
+//ln(x) = ln(m) + e*ln(2) with m in [sqrt(1/2), sqrt(2)); cephes logf
+#define LOG_SQRTHF    0.707106781186547524f
+#define LOG_P0        7.0376836292e-2f
+#define LOG_P1        -1.1514610310e-1f
+#define LOG_P2        1.1676998740e-1f
+#define LOG_P3        -1.2420140846e-1f
+#define LOG_P4        1.4249322787e-1f
+#define LOG_P5        -1.6668057665e-1f
+#define LOG_P6        2.0000714765e-1f
+#define LOG_P7        -2.4999993993e-1f
+#define LOG_P8        3.3333331174e-1f
+#define LOG_Q1        -2.12194440e-4f
+#define LOG_Q2        0.693359375f
+
+//sin and cos of h in [-pi/2, pi/2) by Taylor series
+#define SIN_P1        (-1.0f / 6.0f)
+#define SIN_P2        (1.0f / 120.0f)
+#define SIN_P3        (-1.0f / 5040.0f)
+#define SIN_P4        (1.0f / 362880.0f)
+#define COS_P1        (-1.0f / 2.0f)
+#define COS_P2        (1.0f / 24.0f)
+#define COS_P3        (-1.0f / 720.0f)
+#define COS_P4        (1.0f / 40320.0f)
+#define COS_P5        (-1.0f / 3628800.0f)
+
+#define NOISE_PI      3.14159265358979f
+
+//splitmix64, to spread one seed over the stream states
+static unsigned long long splitmix64(unsigned long long *x)
+{
+   unsigned long long z = (*x += 0x9e3779b97f4a7c15ULL);
+
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+   return(z ^ (z >> 31));
+}
+
+
+void noise_seed(struct noise_generator *gen, unsigned long long seed)
+{
+   int i, j;
+
+   for (j = 0; j < NOISE_LANES; j++)
+   {
+      for (i = 0; i < 4; i += 2)
+      {
+         unsigned long long z = splitmix64(&seed);
+         gen->s[i][j]     = (uint32_t)z;
+         gen->s[i + 1][j] = (uint32_t)(z >> 32);
+      }
+   }
+   gen->next = NOISE_BLOCK;
+}
+
+
+#ifdef NOISE_SSE2
+//next uniform in (0, 1] of each lane
+static __m128 uniform4(__m128i s[4])
+{
+   __m128i r = _mm_add_epi32(s[0], s[3]);
+   __m128i t = _mm_slli_epi32(s[1], 9);
+
+   s[2] = _mm_xor_si128(s[2], s[0]);
+   s[3] = _mm_xor_si128(s[3], s[1]);
+   s[1] = _mm_xor_si128(s[1], s[2]);
+   s[0] = _mm_xor_si128(s[0], s[3]);
+   s[2] = _mm_xor_si128(s[2], t);
+   s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+   r    = _mm_add_epi32(_mm_srli_epi32(r, 8), _mm_set1_epi32(1));
+   return(_mm_mul_ps(_mm_cvtepi32_ps(r), _mm_set1_ps(1.0f / 16777216.0f)));
+}
+
+
+//natural logarithm of x in (0, 1]
+static __m128 log4(__m128 x)
+{
+   __m128i bits = _mm_castps_si128(x);
+   __m128  e    = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23),
+                                                _mm_set1_epi32(126)));
+   __m128  m = _mm_castsi128_ps(_mm_or_si128(
+                                   _mm_and_si128(bits, _mm_set1_epi32(0x807fffff)),
+                                   _mm_set1_epi32(0x3f000000)));
+   __m128 one  = _mm_set1_ps(1.0f);
+   __m128 mask = _mm_cmplt_ps(m, _mm_set1_ps(LOG_SQRTHF));
+   __m128 tmp  = _mm_and_ps(m, mask);
+
+   m = _mm_sub_ps(m, one);
+   e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+   m = _mm_add_ps(m, tmp);
+
+   __m128 z = _mm_mul_ps(m, m);
+   __m128 y = _mm_set1_ps(LOG_P0);
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P1));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P2));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P3));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P4));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P5));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P6));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P7));
+   y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P8));
+   y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+   y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(LOG_Q1)));
+   y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+   return(_mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(LOG_Q2))));
+}
+
+
+void noise_fill(struct noise_generator *gen)
+{
+   __m128i s[4];
+   int     i;
+
+   for (i = 0; i < 4; i++)
+   {
+      s[i] = _mm_loadu_si128((const __m128i *)gen->s[i]);
+   }
+   for (i = 0; i < NOISE_BLOCK; i += 2 * NOISE_LANES)
+   {
+      //r = sqrt(-2*ln(u1)), theta = 2*pi*u2 - pi = 2*h
+      __m128 u1 = uniform4(s);
+      __m128 u2 = uniform4(s);
+      __m128 r  = _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), log4(u1)));
+      __m128 h  = _mm_mul_ps(_mm_sub_ps(u2, _mm_set1_ps(0.5f)),
+                             _mm_set1_ps(NOISE_PI));
+      __m128 h2 = _mm_mul_ps(h, h);
+      __m128 sn = _mm_set1_ps(SIN_P4);
+      sn = _mm_add_ps(_mm_mul_ps(sn, h2), _mm_set1_ps(SIN_P3));
+      sn = _mm_add_ps(_mm_mul_ps(sn, h2), _mm_set1_ps(SIN_P2));
+      sn = _mm_add_ps(_mm_mul_ps(sn, h2), _mm_set1_ps(SIN_P1));
+      sn = _mm_add_ps(_mm_mul_ps(sn, h2), _mm_set1_ps(1.0f));
+      sn = _mm_mul_ps(sn, h);
+      __m128 cs = _mm_set1_ps(COS_P5);
+      cs = _mm_add_ps(_mm_mul_ps(cs, h2), _mm_set1_ps(COS_P4));
+      cs = _mm_add_ps(_mm_mul_ps(cs, h2), _mm_set1_ps(COS_P3));
+      cs = _mm_add_ps(_mm_mul_ps(cs, h2), _mm_set1_ps(COS_P2));
+      cs = _mm_add_ps(_mm_mul_ps(cs, h2), _mm_set1_ps(COS_P1));
+      cs = _mm_add_ps(_mm_mul_ps(cs, h2), _mm_set1_ps(1.0f));
+
+      //cos(theta) = c^2 - s^2, sin(theta) = 2*s*c
+      __m128 cost = _mm_sub_ps(_mm_mul_ps(cs, cs), _mm_mul_ps(sn, sn));
+      __m128 sint = _mm_mul_ps(_mm_add_ps(sn, sn), cs);
+      _mm_storeu_ps(&gen->block[i], _mm_mul_ps(r, cost));
+      _mm_storeu_ps(&gen->block[i + NOISE_LANES], _mm_mul_ps(r, sint));
+   }
+   for (i = 0; i < 4; i++)
+   {
+      _mm_storeu_si128((__m128i *)gen->s[i], s[i]);
+   }
+   gen->next = 0;
+}
+
+
+#else
+//next uniform in (0, 1] of each lane
+static void uniform4(uint32_t s[4][NOISE_LANES], float u[NOISE_LANES])
+{
+   int j;
+
+   for (j = 0; j < NOISE_LANES; j++)
+   {
+      uint32_t r = s[0][j] + s[3][j];
+      uint32_t t = s[1][j] << 9;
+      s[2][j] ^= s[0][j];
+      s[3][j] ^= s[1][j];
+      s[1][j] ^= s[2][j];
+      s[0][j] ^= s[3][j];
+      s[2][j] ^= t;
+      s[3][j]  = (s[3][j] << 11) | (s[3][j] >> 21);
+      u[j]     = (float)((int32_t)((r >> 8) + 1)) * (1.0f / 16777216.0f);
+   }
+}
+
+
+//natural logarithm of x in (0, 1]
+static float log_scalar(float x)
+{
+   uint32_t bits, mbits;
+   float    m, e, z, y;
+
+   memcpy(&bits, &x, sizeof(bits));
+   e     = (float)((int32_t)(bits >> 23) - 126);
+   mbits = (bits & 0x807fffff) | 0x3f000000;
+   memcpy(&m, &mbits, sizeof(m));
+   if (m < LOG_SQRTHF)
+   {
+      e -= 1.0f;
+      m  = (m - 1.0f) + m;
+   }
+   else
+   {
+      m = m - 1.0f;
+   }
+   z = m * m;
+   y = LOG_P0;
+   y = y * m + LOG_P1;
+   y = y * m + LOG_P2;
+   y = y * m + LOG_P3;
+   y = y * m + LOG_P4;
+   y = y * m + LOG_P5;
+   y = y * m + LOG_P6;
+   y = y * m + LOG_P7;
+   y = y * m + LOG_P8;
+   y = (y * m) * z;
+   y = y + e * LOG_Q1;
+   y = y - z * 0.5f;
+   return((m + y) + e * LOG_Q2);
+}
+
+
+void noise_fill(struct noise_generator *gen)
+{
+   float u1[NOISE_LANES], u2[NOISE_LANES];
+   int   i, j;
+
+   for (i = 0; i < NOISE_BLOCK; i += 2 * NOISE_LANES)
+   {
+      uniform4(gen->s, u1);
+      uniform4(gen->s, u2);
+      for (j = 0; j < NOISE_LANES; j++)
+      {
+         //r = sqrt(-2*ln(u1)), theta = 2*pi*u2 - pi = 2*h
+         float r  = sqrtf(-2.0f * log_scalar(u1[j]));
+         float h  = (u2[j] - 0.5f) * NOISE_PI;
+         float h2 = h * h;
+         float sn = SIN_P4;
+         sn = sn * h2 + SIN_P3;
+         sn = sn * h2 + SIN_P2;
+         sn = sn * h2 + SIN_P1;
+         sn = sn * h2 + 1.0f;
+         sn = sn * h;
+         float cs = COS_P5;
+         cs = cs * h2 + COS_P4;
+         cs = cs * h2 + COS_P3;
+         cs = cs * h2 + COS_P2;
+         cs = cs * h2 + COS_P1;
+         cs = cs * h2 + 1.0f;
+
+         //cos(theta) = c^2 - s^2, sin(theta) = 2*s*c
+         gen->block[i + j] = r * (cs * cs - sn * sn);
+         gen->block[i + NOISE_LANES + j] = r * ((sn + sn) * cs);
+      }
+   }
+   gen->next = 0;
+}
+#endif
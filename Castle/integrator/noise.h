@@ -0,0 +1,39 @@
+#ifndef NOISE__H
+#define NOISE__H
+
+// Seedable Gaussian noise for the integrator.
+// Four xoshiro128+ streams run side by side (one per SSE lane) and their
+// uniforms are turned into standard normal samples by Box-Muller, a block
+// of NOISE_BLOCK samples at a time. The logarithm and sine/cosine are
+// polynomial approximations good to about 1e-6, evaluated four at a time
+// with SSE2 where available; the scalar path computes the same values.
+
+#include <stdint.h>
+
+#define NOISE_LANES    4
+#define NOISE_BLOCK    256
+
+struct noise_generator
+{
+   uint32_t s[4][NOISE_LANES];   //xoshiro128+ state word i of each lane
+   float    block[NOISE_BLOCK];  //samples not yet used
+   int      next;                //next sample in block
+};
+
+//seed the streams from a 64-bit seed; equal seeds give equal samples
+void noise_seed(struct noise_generator *gen, unsigned long long seed);
+
+//regenerate the block of samples
+void noise_fill(struct noise_generator *gen);
+
+//standard normal sample (mean 0, standard deviation 1)
+inline float noise_gaussian(struct noise_generator *gen)
+{
+   if (gen->next >= NOISE_BLOCK)
+   {
+      noise_fill(gen);
+   }
+   return(gen->block[gen->next++]);
+}
+
+#endif
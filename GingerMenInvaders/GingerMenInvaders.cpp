@@ -263,113 +263,128 @@ void GingerMenInvaders::OnIdle()
       case STATUS:
       case HELP:
          // Vary wind.
-         if ((currentTime - m_windTimer) >= 1000)
          {
-            m_windTimer = currentTime;
-            if (Mathf::UnitRandom() < fWindChangeProb)
+            PROFILE_ZONE("Wind");
+            if ((currentTime - m_windTimer) >= 1000)
             {
-               float alpha = Mathf::IntervalRandom(0.0f, fMaxWindAlpha);
-               m_windVector = (m_windVector * (1.0f - alpha)) +
-                              (alpha * Vector3f(
-                                  Mathf::IntervalRandom(-fMaxWindSpeed, fMaxWindSpeed),
-                                  Mathf::IntervalRandom(-fMaxWindSpeed, fMaxWindSpeed),
-                                  0.0f));
-               if (m_windVector.Length() > fMaxWindSpeed)
+               m_windTimer = currentTime;
+               if (Mathf::UnitRandom() < fWindChangeProb)
                {
-                  m_windVector.Normalize();
-                  m_windVector *= fMaxWindSpeed;
+                  float alpha = Mathf::IntervalRandom(0.0f, fMaxWindAlpha);
+                  m_windVector = (m_windVector * (1.0f - alpha)) +
+                                 (alpha * Vector3f(
+                                     Mathf::IntervalRandom(-fMaxWindSpeed, fMaxWindSpeed),
+                                     Mathf::IntervalRandom(-fMaxWindSpeed, fMaxWindSpeed),
+                                     0.0f));
+                  if (m_windVector.Length() > fMaxWindSpeed)
+                  {
+                     m_windVector.Normalize();
+                     m_windVector *= fMaxWindSpeed;
+                  }
                }
             }
          }
 
+         {
+            PROFILE_ZONE("AI");
 #ifdef NETWORK
-         DoNetwork();
+            DoNetwork();
 #else
-         // Run "NPC" cannons.
-         for (i = 0; i < NUM_CANNONS; i++)
-         {
-            if ((m_cannons[i] != NULL) && (i != m_currentCannon))
+            // Run "NPC" cannons.
+            for (i = 0; i < NUM_CANNONS; i++)
             {
-               RigidBall *cannonball = m_cannons[i]->DoAI(m_cannons[m_currentCannon], fCannonMovementIncrement, m_frameRate.speedFactor);
-               if (cannonball != NULL)
+               if ((m_cannons[i] != NULL) && (i != m_currentCannon))
                {
-                  m_cannonBalls->Add(cannonball);
+                  RigidBall *cannonball = m_cannons[i]->DoAI(m_cannons[m_currentCannon], fCannonMovementIncrement, m_frameRate.speedFactor);
+                  if (cannonball != NULL)
+                  {
+                     m_cannonBalls->Add(cannonball);
+                  }
                }
             }
-         }
 #endif
+         }
 
          // Update gingerbread men.
-         if ((i = m_gingerMother->Update(m_frameRate.speedFactor)) != 0)
          {
+            PROFILE_ZONE("GingerMen");
+            if ((i = m_gingerMother->Update(m_frameRate.speedFactor)) != 0)
+            {
 #ifdef NETWORK
-            TerminateNetwork();
+               TerminateNetwork();
 #endif
-            if (i == -1)
-            {
-               // Gingerbread man landed!
-               m_state = DIE;
-            }
-            else
-            {
-               // Earth is safe!
-               m_state = WIN;
+               if (i == -1)
+               {
+                  // Gingerbread man landed!
+                  m_state = DIE;
+               }
+               else
+               {
+                  // Earth is safe!
+                  m_state = WIN;
+               }
             }
          }
 
          // Update fired cannonballs.
-         m_cannonBalls->Update(m_simTime, m_simDelta * m_frameRate.speedFactor);
+         {
+            PROFILE_ZONE("CannonBalls");
+            m_cannonBalls->Update(m_simTime, m_simDelta * m_frameRate.speedFactor);
+         }
 
          // Check for cannonball collisions with cannons.
-#ifdef NETWORK
-         for (i = 0; i < NUM_CANNONS; i++)
          {
-            if (network->currentPlayers[i])
+            PROFILE_ZONE("Collisions");
+#ifdef NETWORK
+            for (i = 0; i < NUM_CANNONS; i++)
             {
-               if (m_cannonBalls->Collides(m_cannons[i]->GetPosition(),
-                                           m_cannons[i]->GetRadius(), ballColor))
+               if (network->currentPlayers[i])
                {
-                  for (int j = 0; j < NUM_CANNONS; j++)
+                  if (m_cannonBalls->Collides(m_cannons[i]->GetPosition(),
+                                              m_cannons[i]->GetRadius(), ballColor))
                   {
-                     if (network->currentPlayers[j] &&
-                         (m_gameState.cannons[j].color == ballColor))
+                     for (int j = 0; j < NUM_CANNONS; j++)
                      {
-                        m_gameState.cannons[j].score++;
-                        break;
+                        if (network->currentPlayers[j] &&
+                            (m_gameState.cannons[j].color == ballColor))
+                        {
+                           m_gameState.cannons[j].score++;
+                           break;
+                        }
                      }
-                  }
 
-                  if (i == m_currentCannon)
-                  {
-                     TerminateNetwork();
-                     m_state = DIE;
+                     if (i == m_currentCannon)
+                     {
+                        TerminateNetwork();
+                        m_state = DIE;
+                     }
                   }
                }
             }
-         }
 #else
-         for (i = 0; i < NUM_CANNONS; i++)
-         {
-            if (m_cannons[i] != NULL)
+            for (i = 0; i < NUM_CANNONS; i++)
             {
-               if (m_cannonBalls->Collides(m_cannons[i]->GetPosition(),
-                                           m_cannons[i]->GetRadius(), ballColor))
+               if (m_cannons[i] != NULL)
                {
-                  if (m_cannonNodes[i]->GetNumChildren() == 1)
+                  if (m_cannonBalls->Collides(m_cannons[i]->GetPosition(),
+                                              m_cannons[i]->GetRadius(), ballColor))
                   {
-                     m_cannonNodes[i]->DetachChild(m_cannons[i]->GetBaseNode());
-                     m_cannonNodes[i]->Update();
+                     if (m_cannonNodes[i]->GetNumChildren() == 1)
+                     {
+                        m_cannonNodes[i]->DetachChild(m_cannons[i]->GetBaseNode());
+                        m_cannonNodes[i]->Update();
+                     }
+                     delete0(m_cannons[i]);
+                     m_cannons[i] = NULL;
                   }
-                  delete0(m_cannons[i]);
-                  m_cannons[i] = NULL;
                }
             }
-         }
-         if (m_cannons[m_currentCannon] == NULL)
-         {
-            m_state = DIE;
-         }
+            if (m_cannons[m_currentCannon] == NULL)
+            {
+               m_state = DIE;
+            }
 #endif
+         }
 
          switch (m_state)
          {
@@ -385,10 +400,16 @@ void GingerMenInvaders::OnIdle()
                m_SkyDome->Update();
 
                // Update the active terrain pages.
-               m_Terrain->OnCameraMotion();
+               {
+                  PROFILE_ZONE("OnCameraMotion");
+                  m_Terrain->OnCameraMotion();
+               }
 
                // Update explosions.
-               m_explosions->Update(m_frameRate.speedFactor);
+               {
+                  PROFILE_ZONE("Explosions");
+                  m_explosions->Update(m_frameRate.speedFactor);
+               }
 
                // Draw scene.
                Spatial::CullingMode cullingMode = m_cannonNodes[m_currentCannon]->Culling;
@@ -397,12 +418,21 @@ void GingerMenInvaders::OnIdle()
 #else
                m_cannonNodes[m_currentCannon]->Culling = (Spatial::CullingMode)1;
 #endif
-               m_Culler.ComputeVisibleSet(m_Scene);
-               mRenderer->Draw(m_Culler.GetVisibleSet());
+               {
+                  PROFILE_ZONE("ComputeVisibleSet");
+                  m_Culler.ComputeVisibleSet(m_Scene);
+               }
+               {
+                  PROFILE_ZONE("Draw");
+                  mRenderer->Draw(m_Culler.GetVisibleSet());
+               }
                m_cannonNodes[m_currentCannon]->Culling = cullingMode;
 
                // Draw GUI.
-               DrawGUI();
+               {
+                  PROFILE_ZONE("DrawGUI");
+                  DrawGUI();
+               }
 
 #ifdef WIN32
 #ifndef LOOP_AROUND
@@ -495,6 +525,9 @@ void GingerMenInvaders::OnIdle()
 
    // Set frame-rate independence speed factor.
    m_frameRate.update();
+
+   // Mark the frame for the profiler.
+   Profiler::FrameMark();
 }
 
 
@@ -687,6 +720,13 @@ bool GingerMenInvaders::OnKeyDown(unsigned char ucKey, int iX, int iY)
    case 'W':
       mWireState->Enabled = !mWireState->Enabled;
       return(true);
+
+   case 'p':
+   case 'P':
+      // Dump the frame profile.
+      Profiler::DumpTrace("profile.json");
+      Profiler::DumpFrameTimes("FrameTimes.txt");
+      return(true);
    }
 
    return(false);
@@ -1398,7 +1438,8 @@ void GingerMenInvaders::ShowHelp()
    mRenderer->Draw(150, 300, white, "F ......... Decrease shot power");
    mRenderer->Draw(150, 330, white, "H ......... Open help screen (this one you're looking at)");
    mRenderer->Draw(150, 360, white, "S ......... Status screen to see who's in game and scores");
-   mRenderer->Draw(150, 390, white, "ESC ....... Quit");
+   mRenderer->Draw(150, 390, white, "P ......... Write frame profile (profile.json, FrameTimes.txt)");
+   mRenderer->Draw(150, 420, white, "ESC ....... Quit");
 }
 
 
@@ -13,6 +13,7 @@
 #include "GingerMother.h"
 #include "glbmp.h"
 #include "frameRate.hpp"
+#include "profiler.hpp"
 #ifdef NETWORK
 #include "network.hpp"
 #endif
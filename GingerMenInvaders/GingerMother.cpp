@@ -34,64 +34,14 @@ GingerMother::GingerMother(Vector3f position, Node *scene,
    m_network = NULL;
 #endif
 
-   // Load gingerman meshes, normals and materials.
-   ObjLoader loader(Environment::GetDirectory(0) + "Data/Models/", "gingerman.obj");
-   m_materials = loader.GetMaterials();
-
-   // Access the vertices and normals.
-   const vector<ObjLoader::Float3> positions = loader.GetPositions();
-   m_vertexPositions.resize(positions.size());
-   for (int i = 0, j = (int)positions.size(); i < j; i++)
-   {
-      m_vertexPositions[i] = positions[i];
-   }
-   int numVertices = m_vertexPositions.size();
-   const vector<ObjLoader::Float3> normalsRaw = loader.GetNormals();
-   m_vertexNormals.resize(numVertices);
-
-   // Align normal indices with vertex indices.
-   const vector<ObjLoader::Group> groups = loader.GetGroups();
-   assert(groups.size() == 1);
-   ObjLoader::Group group     = groups[0];
-   int              numMeshes = group.Meshes.size();
-   assert(numMeshes > 0);
-   for (int i = 0; i < numMeshes; i++)
-   {
-      ObjLoader::Mesh         mesh  = group.Meshes[i];
-      vector<ObjLoader::Face> faces = mesh.Faces;
-      int numFaces = faces.size();
-      for (int j = 0; j < numFaces; j++)
-      {
-         ObjLoader::Face           face     = faces[j];
-         vector<ObjLoader::Vertex> vertices = face.Vertices;
-         for (int k = 0; k < 3; k++)
-         {
-            m_vertexNormals[vertices[k].PosIndex] = normalsRaw[vertices[k].NorIndex];
-         }
-      }
-   }
-
-   // Create vertex indices.
-   m_vertexIndices.resize(numMeshes);
-   for (int i = 0; i < numMeshes; i++)
-   {
-      ObjLoader::Mesh         mesh  = group.Meshes[i];
-      vector<ObjLoader::Face> faces = mesh.Faces;
-      int numFaces   = faces.size();
-      int numIndices = faces.size() * 3;
-      m_vertexIndices[i].resize(numIndices);
-      int idx = 0;
-      for (int j = 0; j < numFaces; j++)
-      {
-         ObjLoader::Face           face     = faces[j];
-         vector<ObjLoader::Vertex> vertices = face.Vertices;
-         for (int k = 0; k < 3; k++)
-         {
-            m_vertexIndices[i][idx] = vertices[k].PosIndex;
-            idx++;
-         }
-      }
-   }
+   // Load gingerman meshes, normals and materials, from the binary
+   // cache when it is current with the model files.
+   ObjMeshCache loader(Environment::GetDirectory(0) + "Data/Models/", "gingerman.obj");
+   assert(loader.IsValid());
+   m_materials       = loader.GetMaterials();
+   m_vertexPositions = loader.GetPositions();
+   m_vertexNormals   = loader.GetNormals();
+   m_vertexIndices   = loader.GetIndices();
 
    // Create nodes.
    m_baseNode = new0 Node();
@@ -5,6 +5,7 @@
 
 #include "Wm5WindowApplication3.h"
 #include "GingerMan.h"
+#include "ObjMtl/ObjMeshCache.h"
 #include "Cannon.h"
 #include "CannonBalls.h"
 #include "explosionController.hpp"
@@ -0,0 +1,53 @@
+// Read-only memory-mapped file.
+// Falls back to reading the file into memory where mapping is unavailable.
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+using namespace std;
+
+class MappedFile
+{
+public:
+    MappedFile ();
+    ~MappedFile ();
+
+    // Map the file; returns false if it cannot be opened.
+    bool Open (const string& filename);
+    void Close ();
+
+    inline const char* GetData () const;
+    inline size_t GetSize () const;
+
+    // Size and modification time of a file without mapping it.
+    static bool GetFileStamp (const string& filename, long long& size,
+        long long& mtime);
+
+private:
+    // Not copyable.
+    MappedFile (const MappedFile&);
+    MappedFile& operator= (const MappedFile&);
+
+    const char* mData;
+    size_t mSize;
+    bool mMapped;
+#ifndef UNIX
+    void* mFileHandle;
+    void* mMapHandle;
+#endif
+};
+
+//----------------------------------------------------------------------------
+inline const char* MappedFile::GetData () const
+{
+    return mData;
+}
+//----------------------------------------------------------------------------
+inline size_t MappedFile::GetSize () const
+{
+    return mSize;
+}
+//----------------------------------------------------------------------------
+
+#endif
@@ -14,9 +14,9 @@
 // File Version: 1.1 (2/10/11)
 
 #include "MtlLoader.h"
+#include "MappedFile.h"
 #include <cassert>
 #include <cfloat>
-#include <fstream>
 
 // Disable Microsoft warning about unsafe functions (security).
 #pragma warning(disable:4996)
@@ -36,8 +36,8 @@ MtlLoader::MtlLoader (const string& path, const string& filename)
     }
 
     string filePath = path + filename;
-    ifstream inFile(filePath.c_str());
-    if (!inFile)
+    MappedFile inFile;
+    if (!inFile.Open(filePath))
     {
 		mCode = EC_FILE_OPEN_FAILED;
 		fclose(mLogFile);
@@ -53,10 +53,19 @@ MtlLoader::MtlLoader (const string& path, const string& filename)
 
     string line;
     vector<string> tokens;
+    const char* next = inFile.GetData();
+    const char* end = next + inFile.GetSize();
 
-    while (!inFile.eof())
+    while (next < end)
     {
-        getline(inFile, line);
+        const char* lineEnd = (const char*)memchr(next, '\n', end - next);
+        if (!lineEnd) { lineEnd = end; }
+        line.assign(next, lineEnd);
+        next = lineEnd + 1;
+        if (!line.empty() && line[line.size() - 1] == '\r')
+        {
+            line.erase(line.size() - 1);
+        }
 
         // Skip blank lines.
         if (line == "") { continue; }
@@ -121,7 +130,7 @@ MtlLoader::MtlLoader (const string& path, const string& filename)
         fprintf(mLogFile, "%s\n", msCodeString[EC_SUCCESSFUL]);
     }
     fclose(mLogFile);
-    inFile.close();
+    inFile.Close();
 }
 //----------------------------------------------------------------------------
 MtlLoader::~MtlLoader ()
@@ -15,8 +15,9 @@
 
 
 #include "ObjLoader.h"
+#include "MappedFile.h"
 #include <cassert>
-#include <fstream>
+#include <cmath>
 
 // Disable Microsoft warning about unsafe functions (security).
 #pragma warning(disable:4996)
@@ -47,9 +48,11 @@ ObjLoader::ObjLoader (const string& path, const string& filename)
         return;
     }
 
+    // The file is parsed in place: lines and tokens are ranges within
+    // the mapped buffer, so no strings are built per token.
     string filePath = path + filename;
-    ifstream inFile(filePath.c_str());
-    if (!inFile)
+    MappedFile inFile;
+    if (!inFile.Open(filePath))
     {
         mCode = EC_FILE_OPEN_FAILED;
         fprintf(mLogFile, "%s: %s\n", msCodeString[mCode], filePath.c_str());
@@ -58,97 +61,170 @@ ObjLoader::ObjLoader (const string& path, const string& filename)
         return;
     }
 
-    string line;
-    vector<string> tokens;
+    const char* next = inFile.GetData();
+    const char* end = next + inFile.GetSize();
+    const char* line = next;
+    const char* lineEnd = next;
+    ReserveStorage(next, end);
+    mTokens.reserve(16);
 
-    while (!inFile.eof())
+    while (next < end)
     {
-        getline(inFile, line);
+        line = next;
+        lineEnd = (const char*)memchr(line, '\n', end - line);
+        if (!lineEnd) { lineEnd = end; }
+        next = lineEnd + 1;
+        if (lineEnd > line && lineEnd[-1] == '\r') { --lineEnd; }
 
         // Lines too skip
-        if (line == "") { continue; }
+        if (line == lineEnd) { continue; }
         if (line[0] == '#') { continue; }
 
         //Tokenize
-		GetTokens(line, tokens);
-        if (tokens.size() == 0) { mCode = EC_NO_TOKENS; break; }
+		GetTokens(line, lineEnd);
+        if (mTokens.size() == 0) { mCode = EC_NO_TOKENS; break; }
 
-        // mtllib
-        if (GetMaterialLibrary(path, tokens)) { continue; }
+        // Dispatch on the keyword.
+        const Token& keyword = mTokens[0];
+        bool handled = false;
+        switch (keyword.Begin[0])
+        {
+        case 'v':
+            // v x y z
+            if (keyword.Equals("v")) { handled = GetPosition(); }
 
-        // g default
-        if (GetDefaultGroup(tokens)) { continue; }
+            // vt x y
+            else if (keyword.Equals("vt")) { handled = GetTCoord(); }
 
-        // v x y z
-        if (GetPosition(tokens)) { continue; }
+            // vn x y z
+            else if (keyword.Equals("vn")) { handled = GetNormal(); }
+            break;
 
-        // vt x y
-        if (GetTCoord(tokens)) { continue; }
+        case 'f':
+            // f vertexList
+            if (keyword.Equals("f")) { handled = GetFace(); }
+            break;
 
-        // vn x y z
-        if (GetNormal(tokens)) { continue; }
+        case 'g':
+            if (keyword.Equals("g"))
+            {
+                // g default
+                if (mTokens.size() > 1 && mTokens[1].Equals("default"))
+                {
+                    InitDefaultGroup();
+                    handled = true;
+                }
 
-        // g groupname
-        if (GetGroup(tokens)) { continue; }
+                // g groupname
+                else { handled = GetGroup(); }
+            }
+            break;
 
-        // usemtl mtlname
-        if (GetMaterialAndMesh(tokens)) { continue; }
+        case 'u':
+            // usemtl mtlname
+            if (keyword.Equals("usemtl")) { handled = GetMaterialAndMesh(); }
+            break;
 
-        // f vertexList
-        if (GetFace(tokens)) { continue; }
+        case 'm':
+            // mtllib
+            if (keyword.Equals("mtllib")) { handled = GetMaterialLibrary(path); }
+            break;
+        }
+        if (handled) { continue; }
 
         //Ignore unknown symbols
-		fprintf(mLogFile, "%s: %s\n", "Unrecognized Token: ", tokens[0].c_str());
+		fprintf(mLogFile, "%s: %.*s\n", "Unrecognized Token: ",
+            (int)(keyword.End - keyword.Begin), keyword.Begin);
 		
 		//If there was an error to halt parser
 		if (mCode == EC_TOO_FEW_VERTEX_TOKENS || mCode == EC_TOO_FEW_TEXTURE_TOKENS ||
 			mCode == EC_TOO_FEW_NORMAL_TOKENS)
 		{
-			fprintf(mLogFile, "%s: %s\n", msCodeString[mCode], line.c_str());
-			fclose(mLogFile);
-			inFile.close();
+			fprintf(mLogFile, "%s: %.*s\n", msCodeString[mCode],
+                (int)(lineEnd - line), line);
 			assert(false);
+            break;
 		}	
     }
 	
 	//If no textures were supplied, make note of it
 	if (!mHasTextures)
 	{
-		fprintf(mLogFile, "%s: %s\n", msCodeString[EC_NO_TEXTURES_SUPPLIED], line.c_str());
+		fprintf(mLogFile, "%s: %.*s\n", msCodeString[EC_NO_TEXTURES_SUPPLIED],
+            (int)(lineEnd - line), line);
 	}
 	
 	//if no normals were supplied, make note of it
 	if (!mHasNormals)
 	{
-		fprintf(mLogFile, "%s: %s\n", msCodeString[EC_NO_NORMALS_SUPPLIED], line.c_str());
+		fprintf(mLogFile, "%s: %.*s\n", msCodeString[EC_NO_NORMALS_SUPPLIED],
+            (int)(lineEnd - line), line);
 	}
 	
 	//Write out final result
-	fprintf(mLogFile, "%s\n", msCodeString[EC_SUCCESSFUL]);
+	fprintf(mLogFile, "%s\n", msCodeString[mCode]);
 	fclose(mLogFile);
-    inFile.close();
+    inFile.Close();
 }
 //----------------------------------------------------------------------------
 ObjLoader::~ObjLoader ()
 {
 }
 //----------------------------------------------------------------------------
-void ObjLoader::GetTokens (const string & line, vector<string>& tokens)
+bool ObjLoader::Token::Equals (const char* keyword) const
 {
-    tokens.clear();
-
-    string::size_type begin, end = 0;
-    string token;
+    const size_t length = strlen(keyword);
+    return (size_t)(End - Begin) == length
+        && memcmp(Begin, keyword, length) == 0;
+}
+//----------------------------------------------------------------------------
+string ObjLoader::Token::ToString () const
+{
+    return string(Begin, End);
+}
+//----------------------------------------------------------------------------
+void ObjLoader::ReserveStorage (const char* data, const char* end)
+{
+    // Count the vertex attribute lines up front so the arrays grow once.
+    int numPos = 0, numTcd = 0, numNor = 0;
+    const char* line = data;
+    while (line + 2 < end)
+    {
+        if (line[0] == 'v')
+        {
+            if (line[1] == ' ' || line[1] == '\t') { ++numPos; }
+            else if (line[1] == 't') { ++numTcd; }
+            else if (line[1] == 'n') { ++numNor; }
+        }
+        line = (const char*)memchr(line, '\n', end - line);
+        if (!line) { break; }
+        ++line;
+    }
+    mPositions.reserve(numPos);
+    mTCoords.reserve(numTcd);
+    mNormals.reserve(numNor);
+}
+//----------------------------------------------------------------------------
+void ObjLoader::GetTokens (const char* begin, const char* end)
+{
+    // The token array keeps its capacity from line to line.
+    mTokens.clear();
 
-    while ((begin = line.find_first_not_of(" \t", end)) != string::npos)
+    const char* p = begin;
+    while (p < end)
     {
-        end = line.find_first_of(" \t", begin);
-        token = line.substr(begin, end-begin);
-        tokens.push_back(token);
+        while (p < end && (*p == ' ' || *p == '\t')) { ++p; }
+        if (p == end) { break; }
+
+        Token token;
+        token.Begin = p;
+        while (p < end && *p != ' ' && *p != '\t') { ++p; }
+        token.End = p;
+        mTokens.push_back(token);
     }
 }
 //----------------------------------------------------------------------------
-unsigned char ObjLoader::GetFaceIndices (const string &line, vector<string>& tokens)
+unsigned char ObjLoader::GetFaceIndices (const Token& token, int indices[3])
 {
 	// 111 = v vt vn
 	// 110 = v vt
@@ -157,86 +233,168 @@ unsigned char ObjLoader::GetFaceIndices (const string &line, vector<string>& tok
 	// 000 = ERROR
 	unsigned char bitflag = 0;	//Signals what indices were read
 	
-    tokens.clear();
-    string::size_type begin, end = 0;
-    string token;
+    const char* p = token.Begin;
+    const char* end = token.End;
 	
 	//Look for first vertex index
-	begin = line.find_first_of("0123456789", end);
-	if (begin == string::npos) { return bitflag; }  //No number found
+    while (p < end && (*p < '0' || *p > '9')) { ++p; }
+	if (p == end) { return bitflag; }  //No number found
 	
-	end = line.find_first_not_of("0123456789", begin);
-	tokens.push_back(line.substr(begin, end-begin));
+    p = ParseUInt(p, end, indices[0]);
 	bitflag = 100;
 	
 	//Look for second vertex index
-    begin = line.find_first_of("0123456789", end);
-	if (begin - end == 1)	//Vertex texture found
+    const char* separator = p;
+    while (p < end && (*p < '0' || *p > '9')) { ++p; }
+	if (p == end) { return bitflag; } //No vertex texture or normal index
+	if (p - separator == 1)	//Vertex texture found
 	{
-		end = line.find_first_not_of("0123456789", begin);
-		tokens.push_back(line.substr(begin, end-begin));
+        p = ParseUInt(p, end, indices[1]);
 		bitflag += 10;
 		
 		//Look for third vertex index
-		begin = line.find_first_of("0123456789", end);
-		if (begin == string::npos) { return bitflag; }		//No vertex normal index
+        while (p < end && (*p < '0' || *p > '9')) { ++p; }
+		if (p == end) { return bitflag; }		//No vertex normal index
+        p = ParseUInt(p, end, indices[2]);
 	}
-	else if (begin == string::npos) { return bitflag; } //No vertex texture or normal index
-	
-	//Handle vertex normal index
-	end = line.find_first_not_of("0123456789", begin);
-	tokens.push_back(line.substr(begin, end-begin));
+    else
+    {
+        //Handle vertex normal index
+        p = ParseUInt(p, end, indices[1]);
+    }
 	bitflag += 1;
 	
 	return bitflag;
 }
-
 //----------------------------------------------------------------------------
-bool ObjLoader::GetMaterialLibrary (const string& path,
-    const vector<string>& tokens)
+const char* ObjLoader::ParseUInt (const char* p, const char* end, int& value)
+{
+    int result = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        result = result*10 + (*p - '0');
+        ++p;
+    }
+    value = result;
+    return p;
+}
+//----------------------------------------------------------------------------
+bool ObjLoader::ParseFloat (const Token& token, float& value)
 {
-    if (tokens[0] == "mtllib")
+    // Exact powers of ten representable as doubles.
+    static const double powers[] =
     {
-        if (tokens.size() == 1)
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const int maxPower = (int)(sizeof(powers)/sizeof(powers[0])) - 1;
+
+    const char* p = token.Begin;
+    const char* end = token.End;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    // Accumulate up to 18 significant digits; anything longer is rare
+    // enough to hand to strtod.
+    unsigned long long mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool any = false;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, any = true)
+    {
+        if (digits < 18)
         {
-            mCode = EC_MTLLIB_MISSING_NAME;
-            return false;
+            mantissa = mantissa*10 + (*p - '0');
+            if (mantissa != 0) { ++digits; }
         }
-        if (tokens.size() > 2)
+        else { ++exponent; }
+    }
+    if (p < end && *p == '.')
+    {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p, any = true)
         {
-            mCode = EC_MTLLIB_UNKNOWN_TOKEN;
-            return false;
+            if (digits < 18)
+            {
+                mantissa = mantissa*10 + (*p - '0');
+                if (mantissa != 0) { ++digits; }
+                --exponent;
+            }
         }
+    }
+    if (!any) { value = 0.0f; return false; }
 
-        MtlLoader loader(path, tokens[1]);
-        if (loader.GetCode() != MtlLoader::EC_SUCCESSFUL)
-        {	//Had probelm with Material file, ignore and continue parsing
-			mMatRead = false;
-            mCode = EC_SUCCESSFUL;
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        bool negExp = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negExp = (*p == '-');
+            ++p;
         }
-		else
-		{
-			mMatRead = true;
-			mMaterials = loader.GetMaterials();
-		}
-		
-		return true;
-		
+        int e = 0;
+        p = ParseUInt(p, end, e);
+        exponent += (negExp ? -e : e);
     }
-	
-    return false;
+
+    double result = (double)mantissa;
+    if (exponent < 0)
+    {
+        result = (-exponent <= maxPower ? result/powers[-exponent]
+            : result*pow(10.0, exponent));
+    }
+    else if (exponent > 0)
+    {
+        result = (exponent <= maxPower ? result*powers[exponent]
+            : result*pow(10.0, exponent));
+    }
+    if (digits == 18)
+    {
+        // Precision may have been dropped; defer to the library.
+        char buffer[64];
+        size_t length = (size_t)(token.End - token.Begin);
+        if (length < sizeof(buffer))
+        {
+            memcpy(buffer, token.Begin, length);
+            buffer[length] = 0;
+            value = (float)strtod(buffer, 0);
+            return true;
+        }
+    }
+    value = (float)(negative ? -result : result);
+    return true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetDefaultGroup (const vector<string>& tokens)
+bool ObjLoader::GetMaterialLibrary (const string& path)
 {
-    if (tokens[0] == "g" && tokens[1] == "default")
-    {	
-		InitDefaultGroup();
-            
-		return true;
-	}
-	
-	return false;
+    if (mTokens.size() == 1)
+    {
+        mCode = EC_MTLLIB_MISSING_NAME;
+        return false;
+    }
+    if (mTokens.size() > 2)
+    {
+        mCode = EC_MTLLIB_UNKNOWN_TOKEN;
+        return false;
+    }
+
+    mMtlFilename = mTokens[1].ToString();
+    MtlLoader loader(path, mMtlFilename);
+    if (loader.GetCode() != MtlLoader::EC_SUCCESSFUL)
+    {	//Had probelm with Material file, ignore and continue parsing
+        mMatRead = false;
+        mCode = EC_SUCCESSFUL;
+    }
+    else
+    {
+        mMatRead = true;
+        mMaterials = loader.GetMaterials();
+    }
+		
+    return true;
 }
 //----------------------------------------------------------------------------
 void ObjLoader::InitDefaultGroup ()
@@ -248,269 +406,238 @@ void ObjLoader::InitDefaultGroup ()
 }
 
 //----------------------------------------------------------------------------
-bool ObjLoader::GetPosition (const vector<string>& tokens)
+bool ObjLoader::GetPosition ()
 {
-    if (tokens[0] == "v")
-    {
-		//If no default group was detected by now, add one
-		if (!mDefGroup) { InitDefaultGroup(); }
+    //If no default group was detected by now, add one
+    if (!mDefGroup) { InitDefaultGroup(); }
 		
-        if (tokens.size() < 4)
-        {
-            mCode = EC_TOO_FEW_VERTEX_TOKENS;
-            return false;
-        }
-        if (tokens.size() > 4)
-        {
-            mCode = EC_TOO_MANY_VERTEX_TOKENS;
-            return false;
-        }
-
-        Float3 pos;
-        pos.x = (float)atof(tokens[1].c_str());
-        pos.y = (float)atof(tokens[2].c_str());
-        pos.z = (float)atof(tokens[3].c_str());
-        mPositions.push_back(pos);
-        return true;
+    if (mTokens.size() < 4)
+    {
+        mCode = EC_TOO_FEW_VERTEX_TOKENS;
+        return false;
     }
-	
-    return false;
+    if (mTokens.size() > 4)
+    {
+        mCode = EC_TOO_MANY_VERTEX_TOKENS;
+        return false;
+    }
+
+    Float3 pos;
+    ParseFloat(mTokens[1], pos.x);
+    ParseFloat(mTokens[2], pos.y);
+    ParseFloat(mTokens[3], pos.z);
+    mPositions.push_back(pos);
+    return true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetTCoord (const vector<string>& tokens)
+bool ObjLoader::GetTCoord ()
 {
-    if (tokens[0] == "vt")
-    {
-		//If no default group was detected by now, add one
-		if (!mDefGroup) { InitDefaultGroup(); }
+    //If no default group was detected by now, add one
+    if (!mDefGroup) { InitDefaultGroup(); }
 		
-        if (tokens.size() < 3)
-        {
-            mCode = EC_TOO_FEW_TEXTURE_TOKENS;
-            return false;
-        }
-        if (tokens.size() > 3)
-        {
-            //TODO.  Need to handle 3D texture coordinates.
-            mCode = EC_TOO_MANY_TEXTURE_TOKENS;
-        }
+    if (mTokens.size() < 3)
+    {
+        mCode = EC_TOO_FEW_TEXTURE_TOKENS;
+        return false;
+    }
+    if (mTokens.size() > 3)
+    {
+        //TODO.  Need to handle 3D texture coordinates.
+        mCode = EC_TOO_MANY_TEXTURE_TOKENS;
+    }
 
-		mHasTextures = true;
+    mHasTextures = true;
 		
-        Float2 tcd;
-        tcd.x = (float)atof(tokens[1].c_str());
-        tcd.y = (float)atof(tokens[2].c_str());
-        mTCoords.push_back(tcd);
-        return true;
-    }
-	
-    return false;
+    Float2 tcd;
+    ParseFloat(mTokens[1], tcd.x);
+    ParseFloat(mTokens[2], tcd.y);
+    mTCoords.push_back(tcd);
+    return true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetNormal (const vector<string>& tokens)
+bool ObjLoader::GetNormal ()
 {
-    if (tokens[0] == "vn")
-    {
-		//If no default group was detected by now, add one
-		if (!mDefGroup) { InitDefaultGroup(); }
+    //If no default group was detected by now, add one
+    if (!mDefGroup) { InitDefaultGroup(); }
 		
-        if (tokens.size() < 4)
-        {
-            mCode = EC_TOO_FEW_NORMAL_TOKENS;
-            return false;
-        }
-        if (tokens.size() > 4)
-        {
-            mCode = EC_TOO_MANY_NORMAL_TOKENS;
-            return false;
-        }
+    if (mTokens.size() < 4)
+    {
+        mCode = EC_TOO_FEW_NORMAL_TOKENS;
+        return false;
+    }
+    if (mTokens.size() > 4)
+    {
+        mCode = EC_TOO_MANY_NORMAL_TOKENS;
+        return false;
+    }
 
-		mHasNormals = true;
+    mHasNormals = true;
 		
-        Float3 nor;
-        nor.x = (float)atof(tokens[1].c_str());
-        nor.y = (float)atof(tokens[2].c_str());
-        nor.z = (float)atof(tokens[3].c_str());
-        mNormals.push_back(nor);
-        return true;
-    }
-    return false;
+    Float3 nor;
+    ParseFloat(mTokens[1], nor.x);
+    ParseFloat(mTokens[2], nor.y);
+    ParseFloat(mTokens[3], nor.z);
+    mNormals.push_back(nor);
+    return true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetGroup (const vector<string>& tokens)
+bool ObjLoader::GetGroup ()
 {
-    if (tokens[0] == "g")
+    if (mTokens.size() == 1)
     {
-        mCurrentGroup = (int)mGroups.size();
-        mGroups.push_back(Group());
-        Group& group = mGroups[mCurrentGroup];
-		
-		if (tokens.size() == 1)
-		{
-			group.Name = "Forgot_a_Group_Name";
-		} 
-		else
-		{	
-			group.Name = tokens[1];
-			for (int i = 2; i < (int)tokens.size(); ++i)
-			{
-				group.Name += tokens[i];
-			}
-		}
-        
-        group.PosStart = mCurrentPos;
-        group.TcdStart = mCurrentTcd;
-        group.NorStart = mCurrentNor;
-        mCurrentPos = (int)mPositions.size();
-        mCurrentTcd = (int)mTCoords.size();
-        mCurrentNor = (int)mNormals.size();
-        mRegGroup = true;
-		
-        return true;
+        InitGroup("Forgot_a_Group_Name");
+    } 
+    else
+    {	
+        string name = mTokens[1].ToString();
+        for (int i = 2; i < (int)mTokens.size(); ++i)
+        {
+            name.append(mTokens[i].Begin, mTokens[i].End);
+        }
+        InitGroup(name);
     }
 	
-    return false;
+    return true;
 }
 //----------------------------------------------------------------------------
-void ObjLoader::InitGroup ()
+void ObjLoader::InitGroup (const string& name)
 {
-	vector<string> gTokens;
-	gTokens.push_back("g");
-	gTokens.push_back("No_Group_Found");
-	
-	GetGroup(gTokens);
+    mCurrentGroup = (int)mGroups.size();
+    mGroups.push_back(Group());
+    Group& group = mGroups[mCurrentGroup];
+    group.Name = name;
+        
+    group.PosStart = mCurrentPos;
+    group.TcdStart = mCurrentTcd;
+    group.NorStart = mCurrentNor;
+    mCurrentPos = (int)mPositions.size();
+    mCurrentTcd = (int)mTCoords.size();
+    mCurrentNor = (int)mNormals.size();
+    mRegGroup = true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetMaterialAndMesh (const vector<string>& tokens)
+bool ObjLoader::GetMaterialAndMesh ()
 {
 	static unsigned int count = 0;
 	
-    if (tokens[0] == "usemtl")
+    if (!mRegGroup) { InitGroup("No_Group_Found"); }
+    if (mTokens.size() == 1)
     {
-		if (!mRegGroup) { InitGroup(); }
-        if (tokens.size() == 1)
-        {
-            mCode = EC_TOO_FEW_MTL_TOKENS;
-            return false;
-        }
-        if (tokens.size() > 2)
-        {
-            mCode = EC_TOO_MANY_MTL_TOKENS;
-            return false;
-        }
+        mCode = EC_TOO_FEW_MTL_TOKENS;
+        return false;
+    }
+    if (mTokens.size() > 2)
+    {
+        mCode = EC_TOO_MANY_MTL_TOKENS;
+        return false;
+    }
 		
-		int i;
+    int i;
 		
-		if (mMatRead)	//If material file has been read
-		{
-			for (i = 0; i < (int)mMaterials.size(); ++i)
-			{
-				if (tokens[1] == mMaterials[i].Name)
-				{
-					break;
-				}
-			}
-			if (i == (int)mMaterials.size())
-			{
-				mCode = EC_FAILED_TO_FIND_MATERIAL;
-				return false;
-			}
-			mCurrentMtl = i;	
-		}
-        else	//Pretend we did read a material file
-		{
-			mCurrentMtl = count++;
-			tokens[1] == "default_material";
-		}
-
-        Group& group = mGroups[mCurrentGroup];
-        for (i = 0; i < (int)group.Meshes.size(); ++i)
+    if (mMatRead)	//If material file has been read
+    {
+        const Token& name = mTokens[1];
+        const size_t length = (size_t)(name.End - name.Begin);
+        for (i = 0; i < (int)mMaterials.size(); ++i)
         {
-            if (group.Meshes[i].MtlIndex == mCurrentMtl)
+            if (mMaterials[i].Name.size() == length
+            &&  memcmp(mMaterials[i].Name.data(), name.Begin, length) == 0)
             {
                 break;
             }
         }
-        if (i == (int)group.Meshes.size())
+        if (i == (int)mMaterials.size())
         {
-            // Mesh with this material does not yet exist.
-            group.Meshes.push_back(Mesh());
-            group.Meshes.back().MtlIndex = mCurrentMtl;
+            mCode = EC_FAILED_TO_FIND_MATERIAL;
+            return false;
         }
+        mCurrentMtl = i;	
+    }
+    else	//Pretend we did read a material file
+    {
+        mCurrentMtl = count++;
+    }
 
-        mCurrentMesh = i;
-		
-        return true;
+    Group& group = mGroups[mCurrentGroup];
+    for (i = 0; i < (int)group.Meshes.size(); ++i)
+    {
+        if (group.Meshes[i].MtlIndex == mCurrentMtl)
+        {
+            break;
+        }
     }
-	
-    return false;
+    if (i == (int)group.Meshes.size())
+    {
+        // Mesh with this material does not yet exist.
+        group.Meshes.push_back(Mesh());
+        group.Meshes.back().MtlIndex = mCurrentMtl;
+    }
+
+    mCurrentMesh = i;
+		
+    return true;
 }
 //----------------------------------------------------------------------------
-bool ObjLoader::GetFace (const vector<string>& tokens)
+bool ObjLoader::GetFace ()
 {
-    if (tokens[0] == "f")
+    if (!mRegGroup) { InitGroup("No_Group_Found"); }
+    if (mTokens.size() < 4)
     {
-		if (!mRegGroup) { InitGroup(); }
-        if (tokens.size() < 4)
-        {
-            // A face must have at least three vertices.
-            mCode = EC_TOO_FEW_FACE_TOKENS;
-            return false;
-        }
+        // A face must have at least three vertices.
+        mCode = EC_TOO_FEW_FACE_TOKENS;
+        return false;
+    }
 
-        Group& group = mGroups[mCurrentGroup];
-        Mesh& mesh = group.Meshes[mCurrentMesh];
-        mesh.Faces.push_back(Face());
-        Face& face = mesh.Faces.back();
-
-        /* A vertex is one of the following:
-        v/vt/vn/
-		 v/vt/vn
-        v/vt/
-		 v/vt
-		 v//vn
-        v//
-		 v/
-		 v
-		 where "/" is any none space, none numeric character 
-		*/
+    Group& group = mGroups[mCurrentGroup];
+    Mesh& mesh = group.Meshes[mCurrentMesh];
+    mesh.Faces.push_back(Face());
+    Face& face = mesh.Faces.back();
+
+    /* A vertex is one of the following:
+    v/vt/vn/
+     v/vt/vn
+    v/vt/
+     v/vt
+     v//vn
+    v//
+     v/
+     v
+     where "/" is any none space, none numeric character 
+    */
 		
-        const int numVertices = (int)tokens.size() - 1;
-        face.Vertices.resize(numVertices);
-        for (int i = 0; i < numVertices; ++i)
-        {            
-			vector<string> nTokens;			
-			switch (GetFaceIndices(tokens[i + 1], nTokens)) 
-			{
-				case 100:	//v
-					face.Vertices[i].PosIndex = atoi(nTokens[0].c_str()) - 1;
-					break;
+    const int numVertices = (int)mTokens.size() - 1;
+    face.Vertices.resize(numVertices);
+    for (int i = 0; i < numVertices; ++i)
+    {            
+        int indices[3];
+        switch (GetFaceIndices(mTokens[i + 1], indices)) 
+        {
+            case 100:	//v
+                face.Vertices[i].PosIndex = indices[0] - 1;
+                break;
 					
-				case 110:	//v vt
-					face.Vertices[i].PosIndex = atoi(nTokens[0].c_str()) - 1;
-					face.Vertices[i].TcdIndex = atoi(nTokens[1].c_str()) - 1;
-					break;
+            case 110:	//v vt
+                face.Vertices[i].PosIndex = indices[0] - 1;
+                face.Vertices[i].TcdIndex = indices[1] - 1;
+                break;
 					
-				case 111:	//v vt vn
-					face.Vertices[i].PosIndex = atoi(nTokens[0].c_str()) - 1;
-					face.Vertices[i].TcdIndex = atoi(nTokens[1].c_str()) - 1;
-					face.Vertices[i].NorIndex = atoi(nTokens[2].c_str()) - 1;
-					break;
+            case 111:	//v vt vn
+                face.Vertices[i].PosIndex = indices[0] - 1;
+                face.Vertices[i].TcdIndex = indices[1] - 1;
+                face.Vertices[i].NorIndex = indices[2] - 1;
+                break;
 					
-				case 101:	//v    vn
-					face.Vertices[i].PosIndex = atoi(nTokens[0].c_str()) - 1;
-					face.Vertices[i].NorIndex = atoi(nTokens[1].c_str()) - 1;
-					break;
+            case 101:	//v    vn
+                face.Vertices[i].PosIndex = indices[0] - 1;
+                face.Vertices[i].NorIndex = indices[1] - 1;
+                break;
 					
-				default:	//Error
-					mCode = EC_INVALID_FACE_VERTEX;
-					return false;
-			}
+            default:	//Error
+                mCode = EC_INVALID_FACE_VERTEX;
+                return false;
         }
-		
-        return true;
     }
-	
-    return false;
+		
+    return true;
 }
 //----------------------------------------------------------------------------
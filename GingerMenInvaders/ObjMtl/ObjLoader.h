@@ -176,21 +176,40 @@ public:
     inline const vector<Float3>& GetPositions () const;
     inline const vector<Float2>& GetTCoords () const;
     inline const vector<Float3>& GetNormals () const;
+    inline const string& GetMtlFilename () const;
 
 private:
-    void GetTokens (const string& line, vector<string>& tokens);
-	unsigned char GetFaceIndices (const string& line, vector<string>& tokens);
-    bool GetMaterialLibrary (const string& path, const vector<string>& tokens);
-    bool GetDefaultGroup (const vector<string>& tokens);
-    bool GetPosition (const vector<string>& tokens);
-    bool GetTCoord (const vector<string>& tokens);
-    bool GetNormal (const vector<string>& tokens);
-    bool GetGroup (const vector<string>& tokens);
-    bool GetMaterialAndMesh (const vector<string>& tokens);
-    bool GetFace (const vector<string>& tokens);
-	void InitDefaultGroup ();
-	void InitGroup ();
+    // A token is a character range within the mapped file.
+    class Token
+    {
+    public:
+        bool Equals (const char* keyword) const;
+        string ToString () const;
+
+        const char* Begin;
+        const char* End;
+    };
 
+    void ReserveStorage (const char* data, const char* end);
+    void GetTokens (const char* begin, const char* end);
+    unsigned char GetFaceIndices (const Token& token, int indices[3]);
+    bool GetMaterialLibrary (const string& path);
+    bool GetPosition ();
+    bool GetTCoord ();
+    bool GetNormal ();
+    bool GetGroup ();
+    bool GetMaterialAndMesh ();
+    bool GetFace ();
+    void InitDefaultGroup ();
+    void InitGroup (const string& name);
+
+    // Locale-independent number parsing over a token, no allocation.
+    static bool ParseFloat (const Token& token, float& value);
+    static const char* ParseUInt (const char* p, const char* end,
+        int& value);
+
+    vector<Token> mTokens;
+    string mMtlFilename;
     ErrorCode mCode;
     FILE* mLogFile;
     vector<MtlLoader::Material> mMaterials;
@@ -47,3 +47,8 @@ inline const vector<ObjLoader::Float3>& ObjLoader::GetNormals () const
     return mNormals;
 }
 //----------------------------------------------------------------------------
+inline const string& ObjLoader::GetMtlFilename () const
+{
+    return mMtlFilename;
+}
+//----------------------------------------------------------------------------
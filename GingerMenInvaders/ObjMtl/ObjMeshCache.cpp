@@ -0,0 +1,370 @@
+// OBJ mesh with a binary sidecar cache.
+
+#include "ObjMeshCache.h"
+#include "MappedFile.h"
+#include <cassert>
+
+// Disable Microsoft warning about unsafe functions (security).
+#pragma warning(disable:4996)
+
+const char ObjMeshCache::msMagic[4] = { 'W', 'M', 'O', 'C' };
+const int ObjMeshCache::msVersion = 1;
+
+namespace
+{
+// Sequential writer of the cache fields.
+class CacheWriter
+{
+public:
+    CacheWriter (FILE* file) : mFile(file), mOk(true) {}
+
+    void Bytes (const void* data, size_t size)
+    {
+        if (mOk && size > 0)
+        {
+            mOk = (fwrite(data, 1, size, mFile) == size);
+        }
+    }
+    template <typename T> void Value (const T& value)
+    {
+        Bytes(&value, sizeof(T));
+    }
+    void String (const string& value)
+    {
+        Value((int)value.size());
+        Bytes(value.data(), value.size());
+    }
+
+    FILE* mFile;
+    bool mOk;
+};
+
+// Bounds-checked reader over the mapped cache.
+class CacheReader
+{
+public:
+    CacheReader (const char* data, size_t size)
+        : mNext(data), mEnd(data + size), mOk(true) {}
+
+    void Bytes (void* data, size_t size)
+    {
+        if (!mOk || (size_t)(mEnd - mNext) < size)
+        {
+            mOk = false;
+            return;
+        }
+        memcpy(data, mNext, size);
+        mNext += size;
+    }
+    template <typename T> void Value (T& value)
+    {
+        Bytes(&value, sizeof(T));
+    }
+    void String (string& value)
+    {
+        int size = -1;
+        Value(size);
+        if (!mOk || size < 0 || (size_t)(mEnd - mNext) < (size_t)size)
+        {
+            mOk = false;
+            return;
+        }
+        value.assign(mNext, mNext + size);
+        mNext += size;
+    }
+    int Count ()
+    {
+        int count = -1;
+        Value(count);
+        if (count < 0) { mOk = false; return 0; }
+        return count;
+    }
+
+    const char* mNext;
+    const char* mEnd;
+    bool mOk;
+};
+
+//----------------------------------------------------------------------------
+template <typename Stream>
+void SerializeTexture (Stream& stream, MtlLoader::Texture& texture)
+{
+    stream.String(texture.Filename);
+    stream.Value(texture.BlendU);
+    stream.Value(texture.BlendV);
+    stream.Value(texture.BumpMultiplier);
+    stream.Value(texture.Boost);
+    stream.Value(texture.ColorCorrection);
+    stream.Value(texture.Clamp);
+    stream.Value(texture.IMFChannel);
+    stream.Value(texture.Base);
+    stream.Value(texture.Gain);
+    stream.Bytes(texture.Offset, sizeof(texture.Offset));
+    stream.Bytes(texture.Scale, sizeof(texture.Scale));
+    stream.Bytes(texture.Turbulence, sizeof(texture.Turbulence));
+    stream.Value(texture.TexResolution);
+}
+//----------------------------------------------------------------------------
+template <typename Stream>
+void SerializeMaterial (Stream& stream, MtlLoader::Material& material)
+{
+    stream.String(material.Name);
+    stream.Value(material.IlluminationModel);
+    stream.Bytes(material.AmbientColor, sizeof(material.AmbientColor));
+    stream.Bytes(material.DiffuseColor, sizeof(material.DiffuseColor));
+    stream.Bytes(material.SpecularColor, sizeof(material.SpecularColor));
+    stream.Bytes(material.TransmissionFilter,
+        sizeof(material.TransmissionFilter));
+    stream.Value(material.OpticalDensity);
+    stream.Value(material.SpecularExponent);
+    SerializeTexture(stream, material.AmbientMap);
+    SerializeTexture(stream, material.DiffuseMap);
+    SerializeTexture(stream, material.SpecularMap);
+}
+//----------------------------------------------------------------------------
+}
+
+//----------------------------------------------------------------------------
+ObjMeshCache::ObjMeshCache (const string& path, const string& filename,
+    bool useCache)
+    :
+    mValid(false),
+    mLoadedFromCache(false)
+{
+    if (useCache && Read(path, filename))
+    {
+        mValid = true;
+        mLoadedFromCache = true;
+        return;
+    }
+
+    ObjLoader loader(path, filename);
+    if (loader.GetCode() != ObjLoader::EC_SUCCESSFUL)
+    {
+        return;
+    }
+    Build(loader);
+    mValid = true;
+
+    if (useCache)
+    {
+        // A read-only data directory just means no cache next time.
+        Write(path, filename, loader.GetMtlFilename());
+    }
+}
+//----------------------------------------------------------------------------
+ObjMeshCache::~ObjMeshCache ()
+{
+}
+//----------------------------------------------------------------------------
+void ObjMeshCache::Build (const ObjLoader& loader)
+{
+    mMaterials = loader.GetMaterials();
+    mPositions = loader.GetPositions();
+
+    // Align normal indices with vertex indices.
+    const vector<ObjLoader::Float3>& normals = loader.GetNormals();
+    const int numVertices = (int)mPositions.size();
+    mNormals.resize(numVertices);
+
+    const vector<ObjLoader::Group>& groups = loader.GetGroups();
+    assert(groups.size() == 1);
+    const ObjLoader::Group& group = groups[0];
+    const int numMeshes = (int)group.Meshes.size();
+    assert(numMeshes > 0);
+
+    // Create vertex indices, one triangle list per mesh.
+    mIndices.resize(numMeshes);
+    for (int i = 0; i < numMeshes; ++i)
+    {
+        const vector<ObjLoader::Face>& faces = group.Meshes[i].Faces;
+        const int numFaces = (int)faces.size();
+        vector<int>& indices = mIndices[i];
+        indices.resize(numFaces*3);
+        int idx = 0;
+        for (int j = 0; j < numFaces; ++j)
+        {
+            const vector<ObjLoader::Vertex>& vertices = faces[j].Vertices;
+            for (int k = 0; k < 3; ++k)
+            {
+                const ObjLoader::Vertex& vertex = vertices[k];
+                if (vertex.NorIndex >= 0)
+                {
+                    mNormals[vertex.PosIndex] = normals[vertex.NorIndex];
+                }
+                indices[idx++] = vertex.PosIndex;
+            }
+        }
+    }
+}
+//----------------------------------------------------------------------------
+bool ObjMeshCache::Read (const string& path, const string& filename)
+{
+    long long objSize, objMtime;
+    if (!MappedFile::GetFileStamp(path + filename, objSize, objMtime))
+    {
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.Open(path + filename + ".cache"))
+    {
+        return false;
+    }
+    CacheReader reader(file.GetData(), file.GetSize());
+
+    // Validate against the sources.
+    char magic[4];
+    int version = 0;
+    long long size = -1, mtime = -1;
+    reader.Bytes(magic, sizeof(magic));
+    reader.Value(version);
+    reader.Value(size);
+    reader.Value(mtime);
+    if (!reader.mOk || memcmp(magic, msMagic, sizeof(magic)) != 0
+    ||  version != msVersion || size != objSize || mtime != objMtime)
+    {
+        return false;
+    }
+    string mtlFilename;
+    reader.String(mtlFilename);
+    reader.Value(size);
+    reader.Value(mtime);
+    if (!reader.mOk)
+    {
+        return false;
+    }
+    if (mtlFilename != "")
+    {
+        long long mtlSize, mtlMtime;
+        if (!MappedFile::GetFileStamp(path + mtlFilename, mtlSize, mtlMtime)
+        ||  size != mtlSize || mtime != mtlMtime)
+        {
+            return false;
+        }
+    }
+
+    // Vertex data.
+    const int numVertices = reader.Count();
+    if (!reader.mOk
+    ||  (size_t)numVertices > file.GetSize()/(2*sizeof(ObjLoader::Float3)))
+    {
+        return false;
+    }
+    mPositions.resize(numVertices);
+    mNormals.resize(numVertices);
+    if (numVertices > 0)
+    {
+        reader.Bytes(&mPositions[0], numVertices*sizeof(ObjLoader::Float3));
+        reader.Bytes(&mNormals[0], numVertices*sizeof(ObjLoader::Float3));
+    }
+
+    // Index data.
+    const int numMeshes = reader.Count();
+    mIndices.resize(reader.mOk ? numMeshes : 0);
+    for (int i = 0; i < numMeshes && reader.mOk; ++i)
+    {
+        const int numIndices = reader.Count();
+        if (!reader.mOk || (size_t)numIndices > file.GetSize()/sizeof(int))
+        {
+            return false;
+        }
+        mIndices[i].resize(numIndices);
+        if (numIndices > 0)
+        {
+            reader.Bytes(&mIndices[i][0], numIndices*sizeof(int));
+        }
+    }
+
+    // Materials.
+    const int numMaterials = reader.Count();
+    mMaterials.resize(reader.mOk ? numMaterials : 0);
+    for (int i = 0; i < numMaterials && reader.mOk; ++i)
+    {
+        SerializeMaterial(reader, mMaterials[i]);
+    }
+
+    if (!reader.mOk)
+    {
+        mPositions.clear();
+        mNormals.clear();
+        mIndices.clear();
+        mMaterials.clear();
+        return false;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
+bool ObjMeshCache::Write (const string& path, const string& filename,
+    const string& mtlFilename) const
+{
+    long long objSize, objMtime;
+    if (!MappedFile::GetFileStamp(path + filename, objSize, objMtime))
+    {
+        return false;
+    }
+    long long mtlSize = -1, mtlMtime = -1;
+    if (mtlFilename != "")
+    {
+        MappedFile::GetFileStamp(path + mtlFilename, mtlSize, mtlMtime);
+    }
+
+    // Write to a temporary and rename, so a concurrent reader never sees
+    // a partial cache.
+    const string cachePath = path + filename + ".cache";
+    const string tempPath = cachePath + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    CacheWriter writer(file);
+    writer.Bytes(msMagic, sizeof(msMagic));
+    writer.Value(msVersion);
+    writer.Value(objSize);
+    writer.Value(objMtime);
+    writer.String(mtlFilename);
+    writer.Value(mtlSize);
+    writer.Value(mtlMtime);
+
+    const int numVertices = (int)mPositions.size();
+    writer.Value(numVertices);
+    if (numVertices > 0)
+    {
+        writer.Bytes(&mPositions[0], numVertices*sizeof(ObjLoader::Float3));
+        writer.Bytes(&mNormals[0], numVertices*sizeof(ObjLoader::Float3));
+    }
+
+    writer.Value((int)mIndices.size());
+    for (int i = 0; i < (int)mIndices.size(); ++i)
+    {
+        const int numIndices = (int)mIndices[i].size();
+        writer.Value(numIndices);
+        if (numIndices > 0)
+        {
+            writer.Bytes(&mIndices[i][0], numIndices*sizeof(int));
+        }
+    }
+
+    writer.Value((int)mMaterials.size());
+    for (int i = 0; i < (int)mMaterials.size(); ++i)
+    {
+        MtlLoader::Material material = mMaterials[i];
+        SerializeMaterial(writer, material);
+    }
+
+    const bool ok = writer.mOk;
+    if (fclose(file) != 0 || !ok)
+    {
+        remove(tempPath.c_str());
+        return false;
+    }
+    remove(cachePath.c_str());
+    if (rename(tempPath.c_str(), cachePath.c_str()) != 0)
+    {
+        remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+//----------------------------------------------------------------------------
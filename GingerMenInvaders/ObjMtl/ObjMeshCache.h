@@ -0,0 +1,47 @@
+// OBJ mesh with a binary sidecar cache.
+//
+// The OBJ model is flattened to what the vertex buffers want: one normal
+// per position, and a triangle index list per material mesh. The result
+// is written next to the model as <filename>.cache, stamped with the
+// size and modification time of the OBJ and MTL sources; later loads
+// that find a current cache skip text parsing entirely.
+
+#ifndef OBJMESHCACHE_H
+#define OBJMESHCACHE_H
+
+#include "ObjLoader.h"
+
+class ObjMeshCache
+{
+public:
+    ObjMeshCache (const string& path, const string& filename,
+        bool useCache = true);
+    ~ObjMeshCache ();
+
+    inline bool IsValid () const;
+    inline bool GetLoadedFromCache () const;
+    inline const vector<MtlLoader::Material>& GetMaterials () const;
+    inline const vector<ObjLoader::Float3>& GetPositions () const;
+    inline const vector<ObjLoader::Float3>& GetNormals () const;
+    inline const vector<vector<int> >& GetIndices () const;
+
+private:
+    void Build (const ObjLoader& loader);
+    bool Read (const string& path, const string& filename);
+    bool Write (const string& path, const string& filename,
+        const string& mtlFilename) const;
+
+    bool mValid;
+    bool mLoadedFromCache;
+    vector<MtlLoader::Material> mMaterials;
+    vector<ObjLoader::Float3> mPositions;
+    vector<ObjLoader::Float3> mNormals;
+    vector<vector<int> > mIndices;
+
+    static const char msMagic[4];
+    static const int msVersion;
+};
+
+#include "ObjMeshCache.inl"
+
+#endif
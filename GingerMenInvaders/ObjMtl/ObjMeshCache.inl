@@ -0,0 +1,33 @@
+// OBJ mesh with a binary sidecar cache.
+
+//----------------------------------------------------------------------------
+inline bool ObjMeshCache::IsValid () const
+{
+    return mValid;
+}
+//----------------------------------------------------------------------------
+inline bool ObjMeshCache::GetLoadedFromCache () const
+{
+    return mLoadedFromCache;
+}
+//----------------------------------------------------------------------------
+inline const vector<MtlLoader::Material>& ObjMeshCache::GetMaterials () const
+{
+    return mMaterials;
+}
+//----------------------------------------------------------------------------
+inline const vector<ObjLoader::Float3>& ObjMeshCache::GetPositions () const
+{
+    return mPositions;
+}
+//----------------------------------------------------------------------------
+inline const vector<ObjLoader::Float3>& ObjMeshCache::GetNormals () const
+{
+    return mNormals;
+}
+//----------------------------------------------------------------------------
+inline const vector<vector<int> >& ObjMeshCache::GetIndices () const
+{
+    return mIndices;
+}
+//----------------------------------------------------------------------------
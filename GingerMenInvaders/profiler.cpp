@@ -0,0 +1,162 @@
+//***************************************************************************//
+//* File Name: profiler.cpp                                                 *//
+//* File Desc: Scoped-zone frame profiler.                                  *//
+//*                                                                         *//
+//***************************************************************************//
+
+#include "profiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#ifdef UNIX
+#define THREAD_LOCAL    __thread
+#else
+#define THREAD_LOCAL    __declspec(thread)
+#endif
+
+// A recorded zone.
+struct ProfileEvent
+{
+   const char *name;
+   TIME_NS    begin;
+   TIME_NS    end;
+};
+
+// A thread's zones: written only by the owning thread, which publishes
+// each zone by advancing the count.
+struct ProfileRing
+{
+   ProfileEvent              events[Profiler::RING_SIZE];
+   std::atomic<unsigned int> count;
+   int                       thread;
+};
+
+// Every thread's ring, for dumping. Rings are kept until exit so a dump
+// still shows the zones of threads that have finished.
+static std::mutex                 ringsLock;
+static std::vector<ProfileRing *> rings;
+static THREAD_LOCAL ProfileRing   *threadRing = NULL;
+
+// Frame times in milliseconds: FrameMark is called by the frame loop only.
+static float        frameTimes[Profiler::FRAME_HISTORY];
+static unsigned int frameCount = 0;
+static TIME_NS      frameStart = 0;
+static bool         framing    = false;
+
+//----------------------------------------------------------------------------
+static ProfileRing *GetThreadRing()
+{
+   if (threadRing == NULL)
+   {
+      ProfileRing *ring = new ProfileRing;
+      ring->count = 0;
+      std::lock_guard<std::mutex> lock(ringsLock);
+      ring->thread = (int)rings.size();
+      rings.push_back(ring);
+      threadRing = ring;
+   }
+   return(threadRing);
+}
+
+
+//----------------------------------------------------------------------------
+void Profiler::Record(const char *name, TIME_NS begin, TIME_NS end)
+{
+   ProfileRing  *ring  = GetThreadRing();
+   unsigned int count  = ring->count.load(std::memory_order_relaxed);
+   ProfileEvent &event = ring->events[count % RING_SIZE];
+
+   event.name  = name;
+   event.begin = begin;
+   event.end   = end;
+   ring->count.store(count + 1, std::memory_order_release);
+}
+
+
+//----------------------------------------------------------------------------
+void Profiler::FrameMark()
+{
+   TIME_NS now = gettime_ns();
+
+   if (framing)
+   {
+      frameTimes[frameCount % FRAME_HISTORY] = (float)((double)(now - frameStart) / 1.0e6);
+      frameCount++;
+      Record("Frame", frameStart, now);
+   }
+   frameStart = now;
+   framing    = true;
+}
+
+
+//----------------------------------------------------------------------------
+float Profiler::FramePercentile(float percentile)
+{
+   unsigned int count = std::min(frameCount, (unsigned int)FRAME_HISTORY);
+
+   if (count == 0)
+   {
+      return(0.0f);
+   }
+   std::vector<float> times(frameTimes, frameTimes + count);
+   std::sort(times.begin(), times.end());
+   percentile = std::max(0.0f, std::min(percentile, 100.0f));
+   return(times[(unsigned int)((percentile / 100.0f) * (float)(count - 1) + 0.5f)]);
+}
+
+
+//----------------------------------------------------------------------------
+// Zones another thread is recording while the dump runs may be torn:
+// dump from the frame loop, whose own ring is then quiet.
+bool Profiler::DumpTrace(const char *filename)
+{
+   FILE *fp = fopen(filename, "w");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   fprintf(fp, "{\"traceEvents\":[");
+   bool first = true;
+   std::lock_guard<std::mutex> lock(ringsLock);
+   for (size_t i = 0; i < rings.size(); i++)
+   {
+      ProfileRing  *ring  = rings[i];
+      unsigned int count  = ring->count.load(std::memory_order_acquire);
+      unsigned int oldest = (count > RING_SIZE ? count - RING_SIZE : 0);
+      for (unsigned int j = oldest; j < count; j++)
+      {
+         ProfileEvent& event = ring->events[j % RING_SIZE];
+         fprintf(fp, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                 "\"ts\":%.3f,\"dur\":%.3f}", first ? "" : ",", event.name,
+                 ring->thread, (double)event.begin / 1000.0,
+                 (double)(event.end - event.begin) / 1000.0);
+         first = false;
+      }
+   }
+   fprintf(fp, "\n]}\n");
+   fclose(fp);
+   return(true);
+}
+
+
+//----------------------------------------------------------------------------
+bool Profiler::DumpFrameTimes(const char *filename)
+{
+   FILE *fp = fopen(filename, "w");
+
+   if (fp == NULL)
+   {
+      return(false);
+   }
+   fprintf(fp, "Frame times over the last %u frames (ms):\n",
+           std::min(frameCount, (unsigned int)FRAME_HISTORY));
+   fprintf(fp, "p50 %8.3f\n", FramePercentile(50.0f));
+   fprintf(fp, "p90 %8.3f\n", FramePercentile(90.0f));
+   fprintf(fp, "p99 %8.3f\n", FramePercentile(99.0f));
+   fprintf(fp, "max %8.3f\n", FramePercentile(100.0f));
+   fclose(fp);
+   return(true);
+}
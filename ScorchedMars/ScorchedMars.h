@@ -17,6 +17,7 @@
 #include "glbmp.h"
 #include "gettime.h"
 #include "frameRate.hpp"
+#include "profiler.hpp"
 #ifdef NETWORK
 #include "network.hpp"
 #endif
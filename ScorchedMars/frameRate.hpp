@@ -29,7 +29,7 @@ public:
       FPS             = (float)targetFPS;
       speedFactor     = 0.0f;
       frameCount      = 0;
-      lastTime        = gettime();
+      lastTime        = gettime_ns();
    }
 
 
@@ -43,20 +43,21 @@ public:
    // Update: call per frame.
    void update()
    {
-      TIME currentTime, delta;
+      TIME_NS currentTime;
+      float   delta;
 
       // Count the frame.
       frameCount++;
 
-      // Get the time delta.
-      currentTime = gettime();
-      delta       = (currentTime - lastTime) / 1000;
+      // Get the time delta in seconds.
+      currentTime = gettime_ns();
+      delta       = (float)((double)(currentTime - lastTime) / 1.0e9);
 
       // Has >= 1 second elapsed?
-      if (delta >= 1)
+      if (delta >= 1.0f)
       {
          // Calculate new values.
-         FPS = (float)frameCount / (float)delta;
+         FPS = (float)frameCount / delta;
          if (FPS > 0.0f)
          {
             speedFactor = (float)targetFPS / FPS;
@@ -78,14 +79,14 @@ public:
       FPS         = (float)targetFPS;
       speedFactor = 1.0f;
       frameCount  = 0;
-      lastTime    = gettime();
+      lastTime    = gettime_ns();
    }
 
 
 private:
 
-   int  frameCount;
-   TIME lastTime;
+   int     frameCount;
+   TIME_NS lastTime;
 };
 
 // Default target frame rate.
@@ -3,47 +3,53 @@
  */
 
 #ifdef UNIX
-#include <stdio.h>
-#include <stdlib.h>
-#include <sys/time.h>
+#include <time.h>
 #else
 #include <windows.h>
 #endif
 #include "gettime.h"
-#include <assert.h>
 
 TIME gettime()
 {
-   TIME t;
+   return((TIME)(gettime_ns() / 1000000ULL));
+}
+
+
+/*
+ * Get monotonic time in nanoseconds since the initial call.
+ */
+
+TIME_NS gettime_ns()
+{
+   TIME_NS t;
 
 #ifdef UNIX
-   static time_t      base_sec  = 0;
-   static suseconds_t base_usec = 0;
-   struct timeval     tv;
-   gettimeofday(&tv, NULL);
-   if (base_sec == 0)
-   {
-      base_sec  = tv.tv_sec;
-      base_usec = tv.tv_usec;
-      return(0);
-   }
-   else
-   {
-      t = (TIME)(((tv.tv_sec - base_sec) * 1000) + ((tv.tv_usec - base_usec) / 1000));
-      return(t);
-   }
+   static TIME_NS  base_time = 0;
+   static bool     based     = false;
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   t = ((TIME_NS)ts.tv_sec * 1000000000ULL) + (TIME_NS)ts.tv_nsec;
 #else
-   static TIME base_time = 0;
-   if (base_time == 0)
+   static TIME_NS       base_time = 0;
+   static bool          based     = false;
+   static LARGE_INTEGER frequency;
+   LARGE_INTEGER        counter;
+   if (!based)
    {
-      base_time = (TIME)GetTickCount64();
-      return(0);
+      QueryPerformanceFrequency(&frequency);
    }
-   else
+   QueryPerformanceCounter(&counter);
+
+   // Whole seconds and the remainder separately, so the scaling cannot overflow.
+   t = ((TIME_NS)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL) +
+       ((TIME_NS)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL /
+        (TIME_NS)frequency.QuadPart);
+#endif
+   if (!based)
    {
-      t = (TIME)GetTickCount64();
-      assert(t >= base_time);
-      return(t - base_time);
+      base_time = t;
+      based     = true;
+      return(0);
    }
-#endif
+   return(t - base_time);
 }
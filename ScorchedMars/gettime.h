@@ -5,3 +5,10 @@
 typedef unsigned long   TIME;
 #define INVALID_TIME    0xffffffffUL
 TIME gettime();
+
+/*
+ * Get monotonic time in nanoseconds since the initial call.
+ */
+
+typedef unsigned long long   TIME_NS;
+TIME_NS gettime_ns();
@@ -0,0 +1,67 @@
+//***************************************************************************//
+//* File Name: profiler.hpp                                                 *//
+//* File Desc: Scoped-zone frame profiler.                                  *//
+//*            Zones record their begin and end times into a ring buffer    *//
+//*            owned by the calling thread; frame marks record frame times. *//
+//*            The rings can be dumped as Chrome trace JSON (load it in     *//
+//*            chrome://tracing) and the frame times as percentiles.        *//
+//*                                                                         *//
+//***************************************************************************//
+#ifndef __PROFILER_HPP__
+#define __PROFILER_HPP__
+
+#include <stdio.h>
+#include "gettime.h"
+
+class Profiler
+{
+public:
+
+   // Zones kept per thread, and frame times kept.
+   enum { RING_SIZE = 4096, FRAME_HISTORY = 1024 };
+
+   // Record a zone for the calling thread.
+   // The name must be a string literal: only the pointer is kept.
+   static void Record(const char *name, TIME_NS begin, TIME_NS end);
+
+   // Mark the end of a frame: call once per frame.
+   static void FrameMark();
+
+   // Frame time percentile (0-100) in milliseconds over the kept frames.
+   static float FramePercentile(float percentile);
+
+   // Write the zones of every thread as Chrome trace JSON.
+   static bool DumpTrace(const char *filename);
+
+   // Write the frame time percentiles.
+   static bool DumpFrameTimes(const char *filename);
+};
+
+// Records the zone from construction to the end of the enclosing scope.
+class ProfileZone
+{
+public:
+
+   ProfileZone(const char *name)
+   {
+      this->name = name;
+      begin      = gettime_ns();
+   }
+
+
+   ~ProfileZone()
+   {
+      Profiler::Record(name, begin, gettime_ns());
+   }
+
+
+private:
+
+   const char *name;
+   TIME_NS    begin;
+};
+
+#define PROFILE_ZONE_JOIN2(a, b)    a ## b
+#define PROFILE_ZONE_JOIN(a, b)     PROFILE_ZONE_JOIN2(a, b)
+#define PROFILE_ZONE(name)          ProfileZone PROFILE_ZONE_JOIN(profileZone, __LINE__)(name)
+#endif